@@ -14,6 +14,7 @@
 
 #include <limits>
 #include <algorithm>
+#include <cstdint>
 
 // TODO: to remove when moving to eigen 3.4
 namespace Eigen {
@@ -33,14 +34,43 @@ bool CheckerDetector::process(const image::Image<image::RGBColor>& source, bool
 
     const Vec2 center(grayscale.width() / 2, grayscale.height() / 2);
 
+    // Normalize image between 0 and 1 once, the pyramid levels are derived from it
+    // (the normalization is affine and the resize filter is linear, so resizing the
+    // normalized image then renormalizing the level matches normalizing a resized
+    // grayscale image)
+    image::Image<float> normalized;
+    normalizeImage(normalized, grayscale);
+
     const double scales[] = {1.0, 0.75, 0.5, 0.25};
 
     std::vector<IntermediateCorner> allCorners;
+
+    // Shared pyramid: each level is resized from the previous (larger) one instead of
+    // the full resolution image, so the resize cost shrinks with the level size.
+    image::Image<float> level = normalized;
+
     for (double scale : scales)
     {
         ALICEVISION_LOG_INFO("[CheckerDetector] extracting corners at scale " << scale);
+
+        if (scale != 1.0)
+        {
+            const unsigned int nw = static_cast<unsigned int>(floor(static_cast<float>(grayscale.width()) * scale));
+            const unsigned int nh = static_cast<unsigned int>(floor(static_cast<float>(grayscale.height()) * scale));
+
+            image::Image<float> rescaled(nw, nh);
+            const oiio::ImageSpec imageSpecResized(nw, nh, 1, oiio::TypeDesc::FLOAT);
+            const oiio::ImageSpec imageSpecOrigin(level.width(), level.height(), 1, oiio::TypeDesc::FLOAT);
+            const oiio::ImageBuf inBuf(imageSpecOrigin, level.data());
+            oiio::ImageBuf outBuf(imageSpecResized, rescaled.data());
+            oiio::ImageBufAlgo::resize(outBuf, inBuf);
+
+            // Normalize level between 0 and 1
+            normalizeImage(level, rescaled);
+        }
+
         std::vector<Vec2> corners;
-        if (!processLevel(corners, grayscale, scale))
+        if (!processLevel(corners, level, scale))
         {
             ALICEVISION_LOG_DEBUG("[CheckerDetector] detection failed");
             return false;
@@ -74,10 +104,6 @@ bool CheckerDetector::process(const image::Image<image::RGBColor>& source, bool
 
     ALICEVISION_LOG_DEBUG("[CheckerDetector] kept " << allCorners.size() << " corners positions after merge between levels");
 
-    // Normalize image between 0 and 1
-    image::Image<float> normalized;
-    normalizeImage(normalized, grayscale);
-
     std::vector<CheckerBoardCorner> fittedCorners;
     fitCorners(fittedCorners, allCorners, normalized);
 
@@ -149,35 +175,16 @@ bool CheckerDetector::process(const image::Image<image::RGBColor>& source, bool
 
 bool CheckerDetector::processLevel(std::vector<Vec2>& corners, const image::Image<float>& input, double scale) const
 {
-    // Get resized size
-    const unsigned int w = input.width();
-    const unsigned int h = input.height();
-    const unsigned int nw = static_cast<unsigned int>(floor(static_cast<float>(w) * scale));
-    const unsigned int nh = static_cast<unsigned int>(floor(static_cast<float>(h) * scale));
-
-    // Resize image
-    image::Image<float> toUpdate = input;
-    image::Image<float> rescaled(nw, nh);
-    const oiio::ImageSpec imageSpecResized(nw, nh, 1, oiio::TypeDesc::FLOAT);
-    const oiio::ImageSpec imageSpecOrigin(w, h, 1, oiio::TypeDesc::FLOAT);
-    const oiio::ImageBuf inBuf(imageSpecOrigin, toUpdate.data());
-    oiio::ImageBuf outBuf(imageSpecResized, rescaled.data());
-    oiio::ImageBufAlgo::resize(outBuf, inBuf);
-
-    // Normalize image between 0 and 1
-    image::Image<float> normalized;
-    normalizeImage(normalized, rescaled);
-
     image::Image<float> hessian;
-    computeHessianResponse(hessian, normalized);
+    computeHessianResponse(hessian, input);
 
     std::vector<Vec2> rawCorners;
     extractCorners(rawCorners, hessian);
 
     std::vector<Vec2> refinedCorners;
-    refineCorners(refinedCorners, rawCorners, normalized);
+    refineCorners(refinedCorners, rawCorners, input);
 
-    pruneCorners(corners, refinedCorners, normalized);
+    pruneCorners(corners, refinedCorners, input);
 
     for (Vec2& v : corners)
     {
@@ -194,10 +201,16 @@ void CheckerDetector::pruneCorners(std::vector<Vec2>& prunedCorners, const std::
     const int radius = 5;
     const int samples = 50;
 
-    float vector[samples];
+    // Each candidate is checked independently, the results are compacted afterwards to
+    // keep the output order deterministic
+    std::vector<char> valid(rawCorners.size(), 0);
 
-    for (const Vec2& corner : rawCorners)
+#pragma omp parallel for
+    for (std::int64_t cornerIndex = 0; cornerIndex < static_cast<std::int64_t>(rawCorners.size()); ++cornerIndex)
     {
+        const Vec2& corner = rawCorners[cornerIndex];
+
+        float vector[samples];
         float min = std::numeric_limits<float>::max();
         float max = std::numeric_limits<float>::min();
 
@@ -240,7 +253,15 @@ void CheckerDetector::pruneCorners(std::vector<Vec2>& prunedCorners, const std::
         if (count != 4)
             continue;
 
-        prunedCorners.push_back(corner);
+        valid[cornerIndex] = 1;
+    }
+
+    for (std::size_t cornerIndex = 0; cornerIndex < rawCorners.size(); ++cornerIndex)
+    {
+        if (valid[cornerIndex])
+        {
+            prunedCorners.push_back(rawCorners[cornerIndex]);
+        }
     }
 }
 
@@ -294,7 +315,10 @@ void CheckerDetector::extractCorners(std::vector<Vec2>& rawCorners, const image:
     const int radius = 7;
 
     // Find peaks (local maxima) of the Hessian response
-    image::Image<float> output(hessianResponse.width(), hessianResponse.height(), true, 0.0f);
+    // (rows are independent, the candidates are gathered per row to keep the output order deterministic)
+    std::vector<std::vector<Vec2>> rowCorners(hessianResponse.height());
+
+#pragma omp parallel for
     for (int i = radius; i < hessianResponse.height() - radius; ++i)
     {
         for (int j = radius; j < hessianResponse.width() - radius; ++j)
@@ -303,13 +327,14 @@ void CheckerDetector::extractCorners(std::vector<Vec2>& rawCorners, const image:
             const float val = hessianResponse(i, j);
 
             // Compare value to neighborhood
-            for (int k = -radius; k <= radius; ++k)
+            for (int k = -radius; k <= radius && isMaximal; ++k)
             {
                 for (int l = -radius; l <= radius; ++l)
                 {
                     if (hessianResponse(i + k, j + l) > val)
                     {
                         isMaximal = false;
+                        break;
                     }
                 }
             }
@@ -320,10 +345,15 @@ void CheckerDetector::extractCorners(std::vector<Vec2>& rawCorners, const image:
             // Peak must be higher than a global threshold
             if (val > threshold)
             {
-                rawCorners.emplace_back(j, i);
+                rowCorners[i].emplace_back(j, i);
             }
         }
     }
+
+    for (const std::vector<Vec2>& row : rowCorners)
+    {
+        rawCorners.insert(rawCorners.end(), row.begin(), row.end());
+    }
 }
 
 void CheckerDetector::getMinMax(float& min, float& max, const image::Image<float>& input) const
@@ -348,8 +378,16 @@ void CheckerDetector::refineCorners(std::vector<Vec2>& refinedCorners, const std
 
     const int radius = 5;
 
-    for (const Vec2& pt : rawCorners)
+    // Each candidate is refined independently, the results are compacted afterwards to
+    // keep the output order deterministic
+    std::vector<Vec2> candidates(rawCorners.size());
+    std::vector<char> valid(rawCorners.size(), 0);
+
+#pragma omp parallel for
+    for (std::int64_t cornerIndex = 0; cornerIndex < static_cast<std::int64_t>(rawCorners.size()); ++cornerIndex)
     {
+        const Vec2& pt = rawCorners[cornerIndex];
+
         if (pt.x() < radius)
             continue;
         if (pt.y() < radius)
@@ -398,7 +436,16 @@ void CheckerDetector::refineCorners(std::vector<Vec2>& refinedCorners, const std
         if (dist > radius)
             continue;
 
-        refinedCorners.push_back(update);
+        candidates[cornerIndex] = update;
+        valid[cornerIndex] = 1;
+    }
+
+    for (std::size_t cornerIndex = 0; cornerIndex < candidates.size(); ++cornerIndex)
+    {
+        if (valid[cornerIndex])
+        {
+            refinedCorners.push_back(candidates[cornerIndex]);
+        }
     }
 }
 
@@ -431,16 +478,24 @@ void CheckerDetector::fitCorners(std::vector<CheckerBoardCorner>& refinedCorners
     image::Image<float> filtered;
     image::imageConvolution(input, kernel, filtered);
 
-    Eigen::MatrixXd AtA(6, 6);
-    Eigen::Vector<double, 6> Atb;
-
     const image::Sampler2d<image::SamplerLinear> sampler;
 
-    for (const IntermediateCorner& sc : rawCorners)
+    // Each candidate is fitted independently, the results are compacted afterwards to
+    // keep the output order deterministic
+    std::vector<Vec2> fitted(rawCorners.size());
+    std::vector<char> valid(rawCorners.size(), 0);
+
+#pragma omp parallel for
+    for (std::int64_t cornerIndex = 0; cornerIndex < static_cast<std::int64_t>(rawCorners.size()); ++cornerIndex)
     {
+        const IntermediateCorner& sc = rawCorners[cornerIndex];
+
         Vec2 corner = sc.center;
         bool isValid = true;
 
+        Eigen::MatrixXd AtA(6, 6);
+        Eigen::Vector<double, 6> Atb;
+
         const double cx = corner(0);
         const double cy = corner(1);
 
@@ -527,15 +582,30 @@ void CheckerDetector::fitCorners(std::vector<CheckerBoardCorner>& refinedCorners
 
         if (isValid)
         {
-            refinedCorners.emplace_back(corner, sc.scale);
+            fitted[cornerIndex] = corner;
+            valid[cornerIndex] = 1;
         }
     }
 
-    for (CheckerBoardCorner& corner : refinedCorners)
+    for (std::size_t cornerIndex = 0; cornerIndex < rawCorners.size(); ++cornerIndex)
     {
+        if (valid[cornerIndex])
+        {
+            refinedCorners.emplace_back(fitted[cornerIndex], rawCorners[cornerIndex].scale);
+        }
+    }
+
+#pragma omp parallel for
+    for (std::int64_t cornerIndex = 0; cornerIndex < static_cast<std::int64_t>(refinedCorners.size()); ++cornerIndex)
+    {
+        CheckerBoardCorner& corner = refinedCorners[cornerIndex];
+
         const double cx = corner.center(0);
         const double cy = corner.center(1);
 
+        Eigen::MatrixXd AtA(6, 6);
+        Eigen::Vector<double, 6> Atb;
+
         AtA.fill(0);
         Atb.fill(0);
 
@@ -145,15 +145,14 @@ class CheckerDetector
      * @brief Extract corners positions from the image at the given scale.
      *
      * Algorithm steps:
-     * 1. apply scale and normalize the input image
-     * 2. compute Hessian response of the image
-     * 3. extract corners positions using the Hessian response
-     * 4. refine the corners positions using the image
-     * 5. prune corners
-     *
-     * @param[out] corners Container for extracted corners.
-     * @param[in] input Input grayscale image.
-     * @param[in] scale Scale applied to the image before the extraction.
+     * 1. compute Hessian response of the image
+     * 2. extract corners positions using the Hessian response
+     * 3. refine the corners positions using the image
+     * 4. prune corners
+     *
+     * @param[out] corners Container for extracted corners, in full resolution coordinates.
+     * @param[in] input Normalized pyramid level at the given scale.
+     * @param[in] scale Scale of the pyramid level.
      * @return False if a problem occured during extraction, otherwise true.
      */
     bool processLevel(std::vector<Vec2>& corners, const image::Image<float>& input, double scale) const;
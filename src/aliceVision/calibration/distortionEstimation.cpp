@@ -6,6 +6,7 @@
 
 #include "distortionEstimation.hpp"
 
+#include <aliceVision/alicevision_omp.hpp>
 #include <aliceVision/system/Logger.hpp>
 
 #include <ceres/ceres.h>
@@ -20,7 +21,9 @@ class CostLine : public ceres::CostFunction
   public:
     CostLine(const std::shared_ptr<camera::Undistortion>& undistortion, const Vec2& pt)
       : _pt(pt),
-        _undistortion(undistortion)
+        // each cost owns its copy of the undistortion, so that Evaluate does not mutate
+        // state shared with other residuals and the solver can evaluate them in parallel
+        _undistortion(undistortion->clone())
     {
         set_num_residuals(1);
 
@@ -201,6 +204,22 @@ bool estimate(std::shared_ptr<camera::Undistortion> undistortionToEstimate,
     options.use_inner_iterations = true;
     options.max_num_iterations = 100;
     options.logging_type = ceres::SILENT;
+    options.num_threads = omp_get_max_threads();
+
+    // Each residual couples a single line with the shared center and distortion blocks:
+    // eliminate the per-line blocks with a Schur complement and solve the small reduced
+    // system densely, instead of factorizing the whole Jacobian.
+    options.linear_solver_type = ceres::DENSE_SCHUR;
+
+    std::shared_ptr<ceres::ParameterBlockOrdering> ordering = std::make_shared<ceres::ParameterBlockOrdering>();
+    for (auto& l : lines)
+    {
+        ordering->AddElementToGroup(&l.angle, 0);
+        ordering->AddElementToGroup(&l.dist, 0);
+    }
+    ordering->AddElementToGroup(center, 1);
+    ordering->AddElementToGroup(ptrUndistortionParameters, 1);
+    options.linear_solver_ordering = ordering;
 
     ceres::Solver::Summary summary;
     ceres::Solve(options, &problem, &summary);
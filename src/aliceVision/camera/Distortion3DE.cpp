@@ -283,8 +283,8 @@ Eigen::Matrix2d Distortion3DEAnamorphic4::getDerivativeAddDistoWrtPt(const Vec2&
 
     const double cy_xx = cy02 + cy22;
     const double cy_yy = cy02 - cy22;
-    const double cy_xxyy = cy04 + cy24 + cy44;
-    const double cy_xxxx = 2 * cy04 - 6 * cy44;
+    const double cy_xxyy = 2 * cy04 - 6 * cy44;
+    const double cy_xxxx = cy04 + cy24 + cy44;
     const double cy_yyyy = cy04 - cy24 + cy44;
 
     const double& x = p.x();
@@ -323,7 +323,11 @@ Eigen::Matrix2d Distortion3DEAnamorphic4::getDerivativeAddDistoWrtPt(const Vec2&
     d_d_d_r(1, 0) = 2.0 * xy * cy_xx + 4.0 * xxxy * cy_xxxx + 2.0 * xyyy * cy_xxyy;
     d_d_d_r(1, 1) = 1.0 + xx * cy_xx + 3.0 * yy * cy_yy + xxxx * cy_xxxx + 3.0 * xxyy * cy_xxyy + 5.0 * yyyy * cy_yyyy;
 
-    Eigen::Matrix2d d_r_d_p = Eigen::Matrix2d::Identity();
+    Eigen::Matrix2d d_r_d_p;
+    d_r_d_p(0, 0) = cphi;
+    d_r_d_p(0, 1) = sphi;
+    d_r_d_p(1, 0) = -sphi;
+    d_r_d_p(1, 1) = cphi;
 
     return d_np_d_squizzed * d_squizzed_d_d * d_d_d_r * d_r_d_p;
 }
@@ -354,8 +358,8 @@ Eigen::MatrixXd Distortion3DEAnamorphic4::getDerivativeAddDistoWrtDisto(const Ve
     const double cx_yyyy = cx04 - cx24 + cx44;
     const double cy_xx = cy02 + cy22;
     const double cy_yy = cy02 - cy22;
-    const double cy_xxyy = cy04 + cy24 + cy44;
-    const double cy_xxxx = 2 * cy04 - 6 * cy44;
+    const double cy_xxyy = 2 * cy04 - 6 * cy44;
+    const double cy_xxxx = cy04 + cy24 + cy44;
     const double cy_yyyy = cy04 - cy24 + cy44;
 
     const double& x = p.x();
@@ -440,17 +444,18 @@ Eigen::MatrixXd Distortion3DEAnamorphic4::getDerivativeAddDistoWrtDisto(const Ve
     d_distop_d_disto(5, 3) = 1.0;
     d_distop_d_disto(6, 1) = 1.0;
     d_distop_d_disto(6, 3) = -1.0;
-    d_distop_d_disto(7, 5) = 2.0;
-    d_distop_d_disto(7, 9) = -6.0;
-    d_distop_d_disto(8, 5) = 1.0;
-    d_distop_d_disto(8, 7) = 1.0;
-    d_distop_d_disto(8, 9) = 1.0;
+    d_distop_d_disto(7, 5) = 1.0;
+    d_distop_d_disto(7, 7) = 1.0;
+    d_distop_d_disto(7, 9) = 1.0;
+    d_distop_d_disto(8, 5) = 2.0;
+    d_distop_d_disto(8, 9) = -6.0;
     d_distop_d_disto(9, 5) = 1.0;
     d_distop_d_disto(9, 7) = -1.0;
     d_distop_d_disto(9, 9) = 1.0;
 
     Eigen::Matrix<double, 2, 14> J = (d_np_d_squizzed * d_squizzed_d_disto) + (d_np_d_squizzed * d_squizzed_d_d * d_d_d_distop * d_distop_d_disto);
 
+    // the lens geometry parameters (phi, sqx, sqy, ps) are kept fixed during optimization
     J.block(0, 10, 2, 4) = Eigen::Matrix<double, 2, 4>::Zero();
 
     return J;
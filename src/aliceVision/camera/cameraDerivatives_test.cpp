@@ -0,0 +1,187 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2025 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <aliceVision/camera/camera.hpp>
+
+#define BOOST_TEST_MODULE cameraDerivatives
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <aliceVision/unitTest.hpp>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace aliceVision;
+using namespace aliceVision::camera;
+
+// The symbolic bundle adjustment relies on the analytic Jacobians of the camera models
+// (getDerivativeProjectWrt* and getDerivativeAddDistoWrt*). A model with an incorrect
+// derivative still converges on simple scenes, just slower, so the error easily stays
+// unnoticed. These tests pin every model's Jacobians against central finite differences.
+
+namespace {
+
+constexpr double fdEpsilon = 1e-6;
+// finite differences have a truncation error in O(eps^2), scaled by the focal for projections
+constexpr double distoTolerance = 1e-6;
+constexpr double projectTolerance = 1e-4;
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(distortion_derivatives_finite_differences)
+{
+    makeRandomOperationsReproducible();
+
+    std::vector<std::unique_ptr<Distortion>> models;
+    models.emplace_back(new DistortionBrown(-0.25349, 0.11868, -0.00028, 0.00005, 0.0000001));
+    models.emplace_back(new DistortionFisheye(0.02, -0.03, 0.1, -0.2));
+    models.emplace_back(new DistortionFisheye1(0.02));
+    models.emplace_back(new DistortionRadialK1(0.02));
+    models.emplace_back(new DistortionRadialK3(-1.8061369278146561e-01, 1.8759742680633607e-01, -2.5341468279930644e-02));
+    models.emplace_back(new DistortionRadialK3PT(-1.8061369278146561e-01, 1.8759742680633607e-01, -2.5341468279930644e-02));
+    models.emplace_back(new Distortion3DERadial4(0.2, 0.1, 0.05, -0.03, 0.01, -0.02));
+    models.emplace_back(new Distortion3DEAnamorphic4(0.1, 0.08, 0.06, -0.05, 0.04, -0.03, 0.02, -0.01, 0.015, 0.9, 1.1, 0.99, 1.02, 1.0));
+    models.emplace_back(new Distortion3DEClassicLD(0.2, 1.1, 0.05, -0.03, 0.01));
+
+    const std::size_t numPts{100};
+    for (std::size_t i = 0; i < numPts; ++i)
+    {
+        const Vec2 p = 0.5 * Vec2::Random();
+
+        for (auto& model : models)
+        {
+            // derivative with respect to the input point
+            const Eigen::Matrix2d jacobianPt = model->getDerivativeAddDistoWrtPt(p);
+            for (int col = 0; col < 2; ++col)
+            {
+                Vec2 pPlus = p, pMinus = p;
+                pPlus(col) += fdEpsilon;
+                pMinus(col) -= fdEpsilon;
+                const Vec2 fd = (model->addDistortion(pPlus) - model->addDistortion(pMinus)) / (2.0 * fdEpsilon);
+                EXPECT_MATRIX_NEAR(Vec2(jacobianPt.col(col)), fd, distoTolerance);
+            }
+
+            // derivative with respect to the distortion parameters
+            const Eigen::MatrixXd jacobianDisto = model->getDerivativeAddDistoWrtDisto(p);
+            const std::vector<double> params = model->getParameters();
+            BOOST_CHECK_EQUAL(std::size_t(jacobianDisto.cols()), params.size());
+
+            // the anamorphic lens geometry parameters (phi, sqx, sqy, ps) are deliberately
+            // not differentiated: they are kept fixed during optimization.
+            const std::size_t differentiableCount = (model->getType() == EDISTORTION::DISTORTION_3DEANAMORPHIC4) ? 10 : params.size();
+
+            for (std::size_t col = 0; col < differentiableCount; ++col)
+            {
+                std::vector<double> paramsPlus = params, paramsMinus = params;
+                paramsPlus[col] += fdEpsilon;
+                paramsMinus[col] -= fdEpsilon;
+
+                model->setParameters(paramsPlus);
+                const Vec2 distortedPlus = model->addDistortion(p);
+                model->setParameters(paramsMinus);
+                const Vec2 distortedMinus = model->addDistortion(p);
+                model->setParameters(params);
+
+                const Vec2 fd = (distortedPlus - distortedMinus) / (2.0 * fdEpsilon);
+                EXPECT_MATRIX_NEAR(Vec2(jacobianDisto.col(col)), fd, distoTolerance);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(projection_derivatives_finite_differences)
+{
+    makeRandomOperationsReproducible();
+
+    std::vector<std::shared_ptr<IntrinsicBase>> cameras;
+    cameras.push_back(createPinhole(EINTRINSIC::PINHOLE_CAMERA, 1920, 1080, 900, 900, 80, 50));
+    cameras.push_back(createPinhole(EINTRINSIC::PINHOLE_CAMERA_RADIAL1, 1920, 1080, 900, 900, 80, 50, {0.5}));
+    cameras.push_back(createPinhole(EINTRINSIC::PINHOLE_CAMERA_RADIAL3, 1920, 1080, 900, 900, 80, 50, {0.5, -0.4, 1.2}));
+    cameras.push_back(createPinhole(EINTRINSIC::PINHOLE_CAMERA_BROWN, 1920, 1080, 900, 900, 80, 50, {-0.054, 0.014, 0.006, 0.001, -0.001}));
+    cameras.push_back(createPinhole(EINTRINSIC::PINHOLE_CAMERA_FISHEYE, 1920, 1080, 900, 900, 80, 50, {0.5, -0.4, 0.1, 0.2}));
+    cameras.push_back(createPinhole(EINTRINSIC::PINHOLE_CAMERA_FISHEYE1, 1920, 1080, 900, 900, 80, 50, {0.5}));
+    cameras.push_back(createPinhole(EINTRINSIC::PINHOLE_CAMERA_3DERADIAL4, 1920, 1080, 900, 900, 80, 50, {0.2, 0.0, 0.01, -0.01, 0.005, -0.005}));
+    cameras.push_back(createPinhole(
+      EINTRINSIC::PINHOLE_CAMERA_3DEANAMORPHIC4, 1920, 1080, 900, 900, 80, 50, {0.1, 0.1, 0.02, -0.02, 0.01, 0.01, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0}));
+    cameras.push_back(createPinhole(EINTRINSIC::PINHOLE_CAMERA_3DECLASSICLD, 1920, 1080, 900, 900, 80, 50, {0.2, 1.0, 0.05, -0.03, 0.01}));
+    cameras.push_back(createEquidistant(EINTRINSIC::EQUIDISTANT_CAMERA, 1920, 1080, 1500, 80, 50));
+    cameras.push_back(createEquidistant(EINTRINSIC::EQUIDISTANT_CAMERA_RADIAL3, 1920, 1080, 1500, 80, 50, {0.11, -0.30, 0.1}));
+
+    const std::size_t numPoses{20};
+    for (std::size_t i = 0; i < numPoses; ++i)
+    {
+        // random pose close to identity, point in front of the camera
+        Eigen::Matrix4d T = Eigen::Matrix4d::Identity();
+        const Vec3 axis = Vec3::Random().normalized();
+        T.block<3, 3>(0, 0) = Eigen::AngleAxisd(0.1 * Vec2::Random()(0), axis).toRotationMatrix();
+        T.block<3, 1>(0, 3) = 0.2 * Vec3::Random();
+
+        Vec4 pt;
+        pt.head<3>() = Vec3(0.15 * Vec2::Random()(0), 0.15 * Vec2::Random()(1), 2.5) + 0.5 * Vec3::Random();
+        pt(3) = 1.0;
+
+        for (const auto& camera : cameras)
+        {
+            // derivative with respect to the pose matrix (column major, as vec(T))
+            const Eigen::Matrix<double, 2, 16> jacobianPose = camera->getDerivativeProjectWrtPose(T, pt);
+            for (int col = 0; col < 16; ++col)
+            {
+                Eigen::Matrix4d TPlus = T, TMinus = T;
+                TPlus(col % 4, col / 4) += fdEpsilon;
+                TMinus(col % 4, col / 4) -= fdEpsilon;
+                const Vec2 fd = (camera->project(TPlus, pt, true) - camera->project(TMinus, pt, true)) / (2.0 * fdEpsilon);
+                EXPECT_MATRIX_NEAR(Vec2(jacobianPose.col(col)), fd, projectTolerance);
+            }
+
+            // derivative with respect to a left update U.T around U = Id
+            const Eigen::Matrix<double, 2, 16> jacobianPoseLeft = camera->getDerivativeProjectWrtPoseLeft(T, pt);
+            for (int col = 0; col < 16; ++col)
+            {
+                Eigen::Matrix4d UPlus = Eigen::Matrix4d::Identity(), UMinus = Eigen::Matrix4d::Identity();
+                UPlus(col % 4, col / 4) += fdEpsilon;
+                UMinus(col % 4, col / 4) -= fdEpsilon;
+                const Vec2 fd = (camera->project(UPlus * T, pt, true) - camera->project(UMinus * T, pt, true)) / (2.0 * fdEpsilon);
+                EXPECT_MATRIX_NEAR(Vec2(jacobianPoseLeft.col(col)), fd, projectTolerance);
+            }
+
+            // derivative with respect to the 3d point
+            const Eigen::Matrix<double, 2, 3> jacobianPoint = camera->getDerivativeProjectWrtPoint3(T, pt);
+            for (int col = 0; col < 3; ++col)
+            {
+                Vec4 ptPlus = pt, ptMinus = pt;
+                ptPlus(col) += fdEpsilon;
+                ptMinus(col) -= fdEpsilon;
+                const Vec2 fd = (camera->project(T, ptPlus, true) - camera->project(T, ptMinus, true)) / (2.0 * fdEpsilon);
+                EXPECT_MATRIX_NEAR(Vec2(jacobianPoint.col(col)), fd, projectTolerance);
+            }
+
+            // derivative with respect to the intrinsic parameters [fx, fy, cx, cy, disto...]
+            const Eigen::Matrix<double, 2, Eigen::Dynamic> jacobianParams = camera->getDerivativeProjectWrtParams(T, pt);
+            const std::vector<double> params = camera->getParams();
+            BOOST_CHECK_EQUAL(std::size_t(jacobianParams.cols()), params.size());
+
+            // skip the fixed anamorphic lens geometry parameters (see the distortion test)
+            const std::size_t differentiableCount = (camera->getType() == EINTRINSIC::PINHOLE_CAMERA_3DEANAMORPHIC4) ? 14 : params.size();
+
+            for (std::size_t col = 0; col < differentiableCount; ++col)
+            {
+                std::vector<double> paramsPlus = params, paramsMinus = params;
+                paramsPlus[col] += fdEpsilon;
+                paramsMinus[col] -= fdEpsilon;
+
+                camera->updateFromParams(paramsPlus);
+                const Vec2 projectedPlus = camera->project(T, pt, true);
+                camera->updateFromParams(paramsMinus);
+                const Vec2 projectedMinus = camera->project(T, pt, true);
+                camera->updateFromParams(params);
+
+                const Vec2 fd = (projectedPlus - projectedMinus) / (2.0 * fdEpsilon);
+                EXPECT_MATRIX_NEAR(Vec2(jacobianParams.col(col)), fd, projectTolerance);
+            }
+        }
+    }
+}
@@ -77,6 +77,100 @@ void UndistortImage(const image::Image<T>& imageIn,
     }
 }
 
+/// Compute the undistortion map of an intrinsic (undistorted pixel towards distorted source pixel),
+/// so that the distortion model can be evaluated once per intrinsic and shared by all its views
+inline void computeUndistortionMap(const camera::IntrinsicBase* intrinsicPtr,
+                                   image::Image<Vec2f>& undistortionMap,
+                                   bool correctPrincipalPoint = false,
+                                   const oiio::ROI& roi = oiio::ROI())
+{
+    const Vec2 center(intrinsicPtr->w() * 0.5, intrinsicPtr->h() * 0.5);
+    Vec2 ppCorrection(0.0, 0.0);
+
+    if (correctPrincipalPoint)
+    {
+        if (camera::isPinhole(intrinsicPtr->getType()))
+        {
+            const camera::Pinhole* pinholePtr = dynamic_cast<const camera::Pinhole*>(intrinsicPtr);
+            ppCorrection = pinholePtr->getPrincipalPoint() - center;
+        }
+    }
+
+    int widthRoi = intrinsicPtr->w();
+    int heightRoi = intrinsicPtr->h();
+    int xOffset = 0;
+    int yOffset = 0;
+    if (roi.defined())
+    {
+        widthRoi = roi.width();
+        heightRoi = roi.height();
+        xOffset = roi.xbegin;
+        yOffset = roi.ybegin;
+    }
+
+    undistortionMap.resize(widthRoi, heightRoi);
+
+#pragma omp parallel for
+    for (int y = 0; y < heightRoi; ++y)
+    {
+        for (int x = 0; x < widthRoi; ++x)
+        {
+            const Vec2 undisto_pix(x + xOffset, y + yOffset);
+            // compute coordinates with distortion
+            const Vec2 disto_pix = intrinsicPtr->get_d_pixel(undisto_pix + ppCorrection);
+
+            undistortionMap(y, x) = disto_pix.cast<float>();
+        }
+    }
+}
+
+/// Undistort an image using a precomputed undistortion map (see computeUndistortionMap)
+template<typename T>
+void UndistortImage(const image::Image<T>& imageIn, const image::Image<Vec2f>& undistortionMap, image::Image<T>& image_ud, T fillcolor)
+{
+    image_ud.resize(undistortionMap.width(), undistortionMap.height(), true, fillcolor);
+    const image::Sampler2d<image::SamplerLinear> sampler;
+
+    const int inWidth = imageIn.width();
+    const int inHeight = imageIn.height();
+
+#pragma omp parallel for
+    for (int y = 0; y < undistortionMap.height(); ++y)
+    {
+        for (int x = 0; x < undistortionMap.width(); ++x)
+        {
+            const Vec2f& disto_pix = undistortionMap(y, x);
+
+            // pick pixel if it is in the image domain
+            if (!imageIn.contains(disto_pix(1), disto_pix(0)))
+                continue;
+
+            const int x0 = static_cast<int>(disto_pix(0));
+            const int y0 = static_cast<int>(disto_pix(1));
+
+            if (x0 + 1 < inWidth && y0 + 1 < inHeight)
+            {
+                // interior fast path: direct mix of the four neighbors, without the generic
+                // sampler's per-pixel weight arrays and normalization (same linear scheme)
+                const double dx = static_cast<double>(disto_pix(0)) - x0;
+                const double dy = static_cast<double>(disto_pix(1)) - y0;
+
+                using Real = typename image::RealPixel<T>::real_type;
+                const Real top = image::RealPixel<T>::convert_to_real(imageIn(y0, x0)) * (1.0 - dx) +
+                                 image::RealPixel<T>::convert_to_real(imageIn(y0, x0 + 1)) * dx;
+                const Real bottom = image::RealPixel<T>::convert_to_real(imageIn(y0 + 1, x0)) * (1.0 - dx) +
+                                    image::RealPixel<T>::convert_to_real(imageIn(y0 + 1, x0 + 1)) * dx;
+                image_ud(y, x) = image::RealPixel<T>::convert_from_real(top * (1.0 - dy) + bottom * dy);
+            }
+            else
+            {
+                // border: the generic sampler handles the partial neighborhoods
+                image_ud(y, x) = sampler(imageIn, disto_pix(1), disto_pix(0));
+            }
+        }
+    }
+}
+
 /// Undistort an image according a given camera and its distortion model
 template<typename T>
 void UndistortImage(const image::Image<T>& imageIn,
@@ -1,6 +1,7 @@
 #include "cmdline.hpp"
 
 #include <aliceVision/system/cpu.hpp>
+#include <aliceVision/system/Trace.hpp>
 #include <aliceVision/alicevision_omp.hpp>
 
 namespace aliceVision {
@@ -8,11 +9,15 @@ namespace aliceVision {
 bool CmdLine::execute(int argc, char** argv)
 {
     std::string verboseLevel = system::EVerboseLevel_enumToString(system::Logger::getDefaultVerboseLevel());
+    std::string traceFilepath;
 
     boost::program_options::options_description logParams("Log parameters");
     logParams.add_options()("verboseLevel,v",
                             boost::program_options::value<std::string>(&verboseLevel)->default_value(verboseLevel),
-                            "verbosity level (fatal, error, warning, info, debug, trace).");
+                            "verbosity level (fatal, error, warning, info, debug, trace).")(
+      "traceFile",
+      boost::program_options::value<std::string>(&traceFilepath)->default_value(traceFilepath),
+      "Write a chrome://tracing compatible JSON trace of the run to the given file.");
 
     _allParams.add(logParams);
 
@@ -20,10 +25,14 @@ bool CmdLine::execute(int argc, char** argv)
 
     size_t uma = _hContext.getUserMaxMemoryAvailable();
     unsigned int uca = _hContext.getUserMaxCoresAvailable();
+    int numaNode = _hContext.getUserNumaNode();
 
     hardwareParams.add_options()(
       "maxMemoryAvailable", boost::program_options::value<size_t>(&uma)->default_value(uma), "User specified available RAM")(
-      "maxCoresAvailable", boost::program_options::value<unsigned int>(&uca)->default_value(uca), "User specified available number of cores");
+      "maxCoresAvailable", boost::program_options::value<unsigned int>(&uca)->default_value(uca), "User specified available number of cores")(
+      "numaNode",
+      boost::program_options::value<int>(&numaNode)->default_value(numaNode),
+      "Bind the process to the cpus of the given NUMA node, so that it works on node-local memory (-1: no binding)");
 
     _allParams.add(hardwareParams);
 
@@ -58,8 +67,14 @@ bool CmdLine::execute(int argc, char** argv)
     // set verbose level
     system::Logger::get()->setLogLevel(verboseLevel);
 
+    // enable the trace session, the collected spans are exported when the process exits
+    if (!traceFilepath.empty())
+        system::TraceSession::get().setOutputFilepath(traceFilepath);
+
     _hContext.setUserMaxMemoryAvailable(uma);
     _hContext.setUserMaxCoresAvailable(uca);
+    _hContext.setUserNumaNode(numaNode);
+    _hContext.bindToUserNumaNode();
     _hContext.displayHardware();
 
     return true;
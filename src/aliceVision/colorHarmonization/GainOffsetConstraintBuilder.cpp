@@ -32,6 +32,9 @@ void Encode_histo_relation(const size_t nImage,
     const size_t NVar = 2 * Nima + 1;
 
     A.resize(Nconstraint, NVar);
+    // Each constraint row holds exactly 5 non-zero coefficients (gain and offset of
+    // the two images, plus gamma): reserve them so the insertions below never reallocate
+    A.reserve(Eigen::VectorXi::Constant(Nconstraint, 5));
 
     C.resize(Nconstraint, 1);
     C.fill(0.0);
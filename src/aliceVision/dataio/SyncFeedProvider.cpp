@@ -0,0 +1,144 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "SyncFeedProvider.hpp"
+
+#include <aliceVision/system/Logger.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace aliceVision {
+namespace dataio {
+
+SyncFeedProvider::SyncFeedProvider(const std::vector<std::string>& feedPaths, const std::vector<std::string>& calibPaths, std::size_t prefetchDepth)
+  : _prefetchDepth(std::max<std::size_t>(1, prefetchDepth))
+{
+    if (feedPaths.empty())
+    {
+        ALICEVISION_THROW(std::invalid_argument, "Cannot create SyncFeedProvider without at least one feed path!");
+    }
+    if (!calibPaths.empty() && calibPaths.size() != feedPaths.size())
+    {
+        ALICEVISION_THROW(std::invalid_argument, "The number of calibration files does not match the number of feeds!");
+    }
+
+    _streams.reserve(feedPaths.size());
+    for (std::size_t i = 0; i < feedPaths.size(); ++i)
+    {
+        auto stream = std::make_unique<Stream>();
+        stream->provider = std::make_unique<FeedProvider>(feedPaths[i], calibPaths.empty() ? "" : calibPaths[i]);
+        _streams.push_back(std::move(stream));
+    }
+
+    // Start the prefetch threads only once every provider is initialized, so that
+    // a failed stream can be detected through isInit() before any decoding starts.
+    if (isInit())
+    {
+        for (auto& stream : _streams)
+        {
+            Stream& streamRef = *stream;
+            streamRef.prefetchThread = std::thread(&SyncFeedProvider::prefetchProc, this, std::ref(streamRef));
+        }
+    }
+}
+
+SyncFeedProvider::~SyncFeedProvider()
+{
+    for (auto& stream : _streams)
+    {
+        {
+            const std::scoped_lock lock(stream->mutex);
+            stream->stopRequested = true;
+        }
+        stream->slotAvailable.notify_all();
+        if (stream->prefetchThread.joinable())
+            stream->prefetchThread.join();
+    }
+}
+
+void SyncFeedProvider::prefetchProc(Stream& stream)
+{
+    while (true)
+    {
+        // Decode the next frame outside of the lock, this is where the time is spent
+        // and where the overlap between the streams happens.
+        Frame frame;
+        const bool haveImage = stream.provider->readImage(frame.image, frame.camIntrinsics, frame.mediaPath, frame.hasIntrinsics);
+        if (haveImage)
+            stream.provider->goToNextFrame();
+
+        std::unique_lock<std::mutex> lock(stream.mutex);
+        if (!haveImage)
+        {
+            stream.exhausted = true;
+            stream.frameAvailable.notify_all();
+            return;
+        }
+
+        stream.slotAvailable.wait(lock, [&stream, this]() { return stream.queue.size() < _prefetchDepth || stream.stopRequested; });
+        if (stream.stopRequested)
+            return;
+
+        stream.queue.push_back(std::move(frame));
+        stream.frameAvailable.notify_all();
+    }
+}
+
+bool SyncFeedProvider::readNextSynchronizedFrames(std::vector<Frame>& frames)
+{
+    frames.clear();
+    frames.resize(_streams.size());
+
+    // Wait for the next frame of every stream: this is the frame-aligned barrier.
+    bool allAvailable = true;
+    for (std::size_t i = 0; i < _streams.size(); ++i)
+    {
+        Stream& stream = *_streams[i];
+        std::unique_lock<std::mutex> lock(stream.mutex);
+        stream.frameAvailable.wait(lock, [&stream]() { return !stream.queue.empty() || stream.exhausted; });
+
+        if (stream.queue.empty())
+        {
+            // The stream ended; if the other streams still have frames the rig is desynchronized
+            if (i > 0)
+            {
+                ALICEVISION_LOG_WARNING("Stream " << i << " has no more frames while some other streams do, "
+                                                  << "stopping the synchronized feed.");
+            }
+            allAvailable = false;
+            break;
+        }
+
+        frames[i] = std::move(stream.queue.front());
+        stream.queue.pop_front();
+        lock.unlock();
+        stream.slotAvailable.notify_all();
+    }
+
+    if (!allAvailable)
+        frames.clear();
+    return allAvailable;
+}
+
+bool SyncFeedProvider::isInit() const
+{
+    for (const auto& stream : _streams)
+        if (!stream->provider->isInit())
+            return false;
+    return !_streams.empty();
+}
+
+std::size_t SyncFeedProvider::nbFrames() const
+{
+    std::size_t nbFrames = std::numeric_limits<std::size_t>::max();
+    for (const auto& stream : _streams)
+        nbFrames = std::min(nbFrames, stream->provider->nbFrames());
+    return nbFrames;
+}
+
+}  // namespace dataio
+}  // namespace aliceVision
@@ -0,0 +1,112 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "FeedProvider.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace aliceVision {
+namespace dataio {
+
+/**
+ * @brief Synchronized multi-stream feed provider for camera rigs.
+ *
+ * It owns one FeedProvider per stream and decodes every stream in its own prefetch
+ * thread, so the decoding of the N cameras of a rig overlaps instead of being
+ * serialized per timestamp. Frames are served through a frame-aligned barrier:
+ * readNextSynchronizedFrames() blocks until the frame of every stream is available
+ * and always returns the frames of a single timestamp.
+ */
+class SyncFeedProvider
+{
+  public:
+    /// A decoded frame of one stream, as provided by FeedProvider::readImage().
+    struct Frame
+    {
+        image::Image<float> image;
+        camera::Pinhole camIntrinsics;
+        std::string mediaPath;
+        bool hasIntrinsics{false};
+    };
+
+    /**
+     * @brief SyncFeedProvider constructor, one prefetch thread is started per stream.
+     * @param[in] feedPaths video file path, image sequence directory or SfMData file of each stream
+     * @param[in] calibPaths calibration file of each stream, empty if no calibration is available
+     * @param[in] prefetchDepth the number of frames decoded ahead of the consumer on each stream
+     */
+    SyncFeedProvider(const std::vector<std::string>& feedPaths,
+                     const std::vector<std::string>& calibPaths = {},
+                     std::size_t prefetchDepth = 2);
+
+    /**
+     * @brief SyncFeedProvider copy constructor - NO COPY
+     */
+    SyncFeedProvider(const SyncFeedProvider&) = delete;
+
+    ~SyncFeedProvider();
+
+    /**
+     * @brief Frame-aligned barrier: provide the next frame of every stream.
+     *
+     * Blocks until the next frame of each stream has been decoded. If a stream is
+     * exhausted while the others still have frames, a warning is logged and false
+     * is returned, as the rig cannot be synchronized anymore.
+     *
+     * @param[out] frames the decoded frames, one per stream, all at the same timestamp
+     * @return true if a frame was provided for every stream, false when any stream is exhausted
+     */
+    bool readNextSynchronizedFrames(std::vector<Frame>& frames);
+
+    /**
+     * @brief Return true if all the underlying feeds are correctly initialized.
+     * @return true if all the underlying feeds are correctly initialized
+     */
+    bool isInit() const;
+
+    /**
+     * @brief Return the number of synchronized frames, i.e. the shortest stream length.
+     * @return the number of frames available on every stream
+     */
+    std::size_t nbFrames() const;
+
+    /// Return the number of streams.
+    std::size_t nbStreams() const { return _streams.size(); }
+
+    /// Access the underlying provider of a stream (e.g. to query isVideo()).
+    const FeedProvider& feed(std::size_t streamIndex) const { return *_streams.at(streamIndex)->provider; }
+
+  private:
+    /// Per-stream state: the provider, its prefetch thread and the bounded frame queue.
+    struct Stream
+    {
+        std::unique_ptr<FeedProvider> provider;
+        std::thread prefetchThread;
+        std::deque<Frame> queue;
+        std::mutex mutex;
+        std::condition_variable frameAvailable;
+        std::condition_variable slotAvailable;
+        bool exhausted{false};
+        bool stopRequested{false};
+    };
+
+    /// Decode loop of one stream, run by its prefetch thread.
+    void prefetchProc(Stream& stream);
+
+    std::vector<std::unique_ptr<Stream>> _streams;
+    std::size_t _prefetchDepth;
+};
+
+}  // namespace dataio
+}  // namespace aliceVision
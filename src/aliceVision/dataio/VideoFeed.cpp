@@ -15,6 +15,7 @@
 #include <opencv2/core/eigen.hpp>
 #include <opencv2/videoio.hpp>
 
+#include <cstring>
 #include <iostream>
 #include <exception>
 
@@ -62,7 +63,14 @@ VideoFeed::FeederImpl::FeederImpl(const std::string& videoPath, const std::strin
     _videoPath(videoPath)
 {
     // load the video
+#if CV_VERSION_MAJOR > 4 || (CV_VERSION_MAJOR == 4 && CV_VERSION_MINOR >= 6)
+    // Let OpenCV pick a hardware decoder (NVDEC, VAAPI, ...) when one is available,
+    // it falls back to software decoding otherwise.
+    const std::vector<int> params = {cv::CAP_PROP_HW_ACCELERATION, cv::VIDEO_ACCELERATION_ANY};
+    _videoCapture.open(videoPath, cv::CAP_ANY, params);
+#else
     _videoCapture.open(videoPath);
+#endif
     if (!_videoCapture.isOpened())
     {
         ALICEVISION_LOG_WARNING("Unable to open the video : " << videoPath);
@@ -119,19 +127,14 @@ bool VideoFeed::FeederImpl::readImage(image::Image<image::RGBColor>& imageRGB,
     if (frame.channels() == 3)
     {
         cv::Mat color;
-        resize(frame, color, cv::Size(frame.cols, frame.rows));
-
         cv::cvtColor(frame, color, cv::COLOR_BGR2RGB);
         imageRGB.resize(color.cols, color.rows);
 
-        unsigned char* pixelPtr = (unsigned char*)color.data;
+        // Both layouts are interleaved 8-bit RGB, so the rows can be copied as a whole
+        unsigned char* dstPtr = reinterpret_cast<unsigned char*>(imageRGB.data());
         for (int i = 0; i < color.rows; i++)
         {
-            for (int j = 0; j < color.cols; j++)
-            {
-                const size_t index = i * color.cols * 3 + j * 3;
-                imageRGB(i, j) = image::RGBColor(pixelPtr[index], pixelPtr[index + 1], pixelPtr[index + 2]);
-            }
+            std::memcpy(dstPtr + static_cast<size_t>(i) * color.cols * 3, color.ptr<unsigned char>(i), static_cast<size_t>(color.cols) * 3);
         }
     }
     else
@@ -7,6 +7,8 @@
 #include "DepthMapEstimator.hpp"
 
 #include <aliceVision/system/Logger.hpp>
+#include <aliceVision/system/MemoryGovernor.hpp>
+#include <aliceVision/system/ProgressDisplay.hpp>
 #include <aliceVision/system/Timer.hpp>
 #include <aliceVision/mvsUtils/fileIO.hpp>
 #include <aliceVision/mvsUtils/mapIO.hpp>
@@ -16,11 +18,18 @@
 #include <aliceVision/depthMap/SgmDepthList.hpp>
 #include <aliceVision/depthMap/Sgm.hpp>
 #include <aliceVision/depthMap/Refine.hpp>
+#include <aliceVision/depthMap/volumeIO.hpp>
 #include <aliceVision/depthMap/cuda/host/utils.hpp>
 #include <aliceVision/depthMap/cuda/host/patchPattern.hpp>
 #include <aliceVision/depthMap/cuda/host/DeviceCache.hpp>
+#include <aliceVision/depthMap/cuda/host/DeviceMemoryPool.hpp>
 #include <aliceVision/depthMap/cuda/host/DeviceStreamManager.hpp>
 #include <aliceVision/depthMap/cuda/planeSweeping/deviceDepthSimilarityMap.hpp>
+#include <aliceVision/gpu/GpuRegistry.hpp>
+
+#include <chrono>
+#include <memory>
+#include <thread>
 
 namespace aliceVision {
 namespace depthMap {
@@ -115,6 +124,16 @@ int DepthMapEstimator::getNbSimultaneousTiles() const
         double availableMB, usedMB, totalMB;
         getDeviceMemoryInfo(availableMB, usedMB, totalMB);
         deviceMemoryMB = availableMB * 0.8;  // available memory margin
+
+        // discount the device memory reserved through the node-level registry by concurrent
+        // processes that have claimed this device but not allocated their buffers yet
+        gpu::GpuRegistry gpuRegistry;
+        const double reservedMB = static_cast<double>(gpuRegistry.reservedMemoryMB(getCudaDeviceId()));
+        if (reservedMB > 0.0)
+        {
+            ALICEVISION_LOG_INFO("Device memory reserved by concurrent processes: " << reservedMB << " MB.");
+            deviceMemoryMB = std::max(0.0, deviceMemoryMB - reservedMB);
+        }
     }
 
     // number of full R camera computation that can be done simultaneously
@@ -227,6 +246,15 @@ void DepthMapEstimator::compute(int cudaDeviceId, const std::vector<int>& cams)
     // the CUDA runtime API is thread-safe, it maintains per-thread state about the current device
     setCudaDeviceId(cudaDeviceId);
 
+    // publish our device memory budget on the node-level registry for the duration of this
+    // computation, so concurrent processes discount it when sizing their own batches
+    gpu::GpuRegistry gpuRegistry;
+    {
+        double availableMB, usedMB, totalMB;
+        getDeviceMemoryInfo(availableMB, usedMB, totalMB);
+        gpuRegistry.reserveMemory(cudaDeviceId, static_cast<std::size_t>(availableMB * 0.8));
+    }
+
     // initialize RAM image cache
     // note: maybe move it as class member in order to share it across multiple GPUs
     mvsUtils::ImagesCache<image::Image<image::RGBAfColor>> ic(_mp, image::EImageColorSpace::LINEAR);
@@ -236,9 +264,11 @@ void DepthMapEstimator::compute(int cudaDeviceId, const std::vector<int>& cams)
     getTilesList(cams, tiles);
 
     // get maximum number of simultaneous tiles
-    // for now, we use one CUDA stream per tile (SGM + Refine)
+    // in pipelined mode, each tile uses two CUDA streams (SGM and Refine)
+    // so the Refine of a tile can overlap the SGM of the next tile on the same tile slot
+    const bool pipelineSgmRefine = _depthMapParams.useRefine && _depthMapParams.pipelineSgmRefine;
     const int nbStreams = std::min(getNbSimultaneousTiles(), static_cast<int>(tiles.size()));
-    DeviceStreamManager deviceStreamManager(nbStreams);
+    DeviceStreamManager deviceStreamManager(pipelineSgmRefine ? (2 * nbStreams) : nbStreams);
 
     // constants
     const bool hasRcSameDownscale = (_sgmParams.scale == _refineParams.scale);  // we only need one camera params per image
@@ -290,9 +320,19 @@ void DepthMapEstimator::compute(int cudaDeviceId, const std::vector<int>& cams)
             sgmPerStream.emplace_back(_mp, _tileParams, _sgmParams, sgmComputeDepthSimMap, sgmComputeNormalMap, deviceStreamManager.getStream(i));
 
         // initialize Refine objects
+        // in pipelined mode, each Refine object gets its own stream (after the SGM streams)
         if (_depthMapParams.useRefine)
             for (int i = 0; i < nbStreams; ++i)
-                refinePerStream.emplace_back(_mp, _tileParams, _refineParams, deviceStreamManager.getStream(i));
+                refinePerStream.emplace_back(_mp, _tileParams, _refineParams, deviceStreamManager.getStream(pipelineSgmRefine ? (nbStreams + i) : i));
+    }
+
+    // per-stream events used in pipelined mode to chain the SGM outputs to the Refine stream
+    std::vector<cudaEvent_t> sgmOutputsReadyEvents;
+    if (pipelineSgmRefine)
+    {
+        sgmOutputsReadyEvents.resize(nbStreams);
+        for (cudaEvent_t& event : sgmOutputsReadyEvents)
+            CHECK_CUDA_RETURN_ERROR(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
     }
 
     // allocate final deth/similarity map tile list in host memory
@@ -324,9 +364,22 @@ void DepthMapEstimator::compute(int cudaDeviceId, const std::vector<int>& cams)
     const int minMipmapDownscale = std::min(_refineParams.scale, _sgmParams.scale);
     const int maxMipmapDownscale = std::max(_refineParams.scale, _sgmParams.scale) * std::pow(2, 6);  // we add 6 downscale levels
 
+    // runtime governor: when other jobs exhaust the host memory, pause the batch
+    // admission instead of getting the process killed
+    system::MemoryGovernor memoryGovernor;
+
+    // periodically report the tile throughput and the estimated time of completion
+    auto progressDisplay = system::createRateProgressDisplay(tiles.size(), "Depth map tiles");
+
     // compute each batch of R cameras
     for (int b = 0; b < nbBatches; ++b)
     {
+        while (memoryGovernor.underPressure())
+        {
+            ALICEVISION_LOG_WARNING("Available host memory is critically low, waiting before computing the next depth map batch.");
+            std::this_thread::sleep_for(std::chrono::seconds(10));
+        }
+
         // find first/last tile to compute
         const int firstTileIndex = b * nbTilesPerBatch;
         const int lastTileIndex = std::min((b + 1) * nbTilesPerBatch, static_cast<int>(tiles.size()));
@@ -371,6 +424,33 @@ void DepthMapEstimator::compute(int cudaDeviceId, const std::vector<int>& cams)
         // wait for camera loading in device cache
         cudaDeviceSynchronize();
 
+        // compute the batch tiles SGM depth lists
+        // depth lists are CPU-only and independent per tile: compute them in parallel ahead
+        // of GPU submission so the streams are fed without waiting on the CPU for each tile
+        std::vector<std::unique_ptr<SgmDepthList>> sgmDepthListPerTile(lastTileIndex - firstTileIndex);
+
+#pragma omp parallel for
+        for (int i = firstTileIndex; i < lastTileIndex; ++i)
+        {
+            Tile& tile = tiles.at(i);
+
+            // empty ROI or no T camera found, nothing to compute
+            if (tile.roi.isEmpty() || tile.sgmTCams.empty() || (_depthMapParams.useRefine && tile.refineTCams.empty()))
+                continue;
+
+            // build tile SGM depth list
+            auto sgmDepthList = std::make_unique<SgmDepthList>(_mp, _sgmParams, tile);
+
+            // compute the R camera depth list
+            sgmDepthList->computeListRc();
+
+            // remove T cameras with no depth found.
+            if (!sgmDepthList->getDepths().empty())
+                sgmDepthList->removeTcWithNoDepth(tile);
+
+            sgmDepthListPerTile.at(i - firstTileIndex) = std::move(sgmDepthList);
+        }
+
         // compute each batch tile
         for (int i = firstTileIndex; i < lastTileIndex; ++i)
         {
@@ -393,11 +473,8 @@ void DepthMapEstimator::compute(int cudaDeviceId, const std::vector<int>& cams)
                 continue;
             }
 
-            // build tile SGM depth list
-            SgmDepthList sgmDepthList(_mp, _sgmParams, tile);
-
-            // compute the R camera depth list
-            sgmDepthList.computeListRc();
+            // get the precomputed tile SGM depth list
+            SgmDepthList& sgmDepthList = *sgmDepthListPerTile.at(i - firstTileIndex);
 
             // check number of depths
             if (sgmDepthList.getDepths().empty())  // no depth found
@@ -407,9 +484,6 @@ void DepthMapEstimator::compute(int cudaDeviceId, const std::vector<int>& cams)
                 continue;
             }
 
-            // remove T cameras with no depth found.
-            sgmDepthList.removeTcWithNoDepth(tile);
-
             // store min/max depth
             depthMinMaxTilePerCam.at(batchCamIndex).at(tile.id) = sgmDepthList.getMinMaxDepths();
 
@@ -431,10 +505,26 @@ void DepthMapEstimator::compute(int cudaDeviceId, const std::vector<int>& cams)
 
                 // compute Refine
                 Refine& refine = refinePerStream.at(streamIndex);
+                const cudaStream_t refineStream = deviceStreamManager.getStream(pipelineSgmRefine ? (nbStreams + streamIndex) : streamIndex);
+
+                if (pipelineSgmRefine)
+                {
+                    // make the Refine stream wait for the SGM outputs of this tile,
+                    // the host can then immediately enqueue the SGM of the next tile on the SGM stream
+                    cudaEventRecord(sgmOutputsReadyEvents.at(streamIndex), deviceStreamManager.getStream(streamIndex));
+                    cudaStreamWaitEvent(refineStream, sgmOutputsReadyEvents.at(streamIndex), 0);
+                }
+
                 refine.refineRc(tile, sgm.getDeviceDepthThicknessMap(), sgm.getDeviceNormalMap());
 
+                if (pipelineSgmRefine)
+                {
+                    // the next SGM on this stream may only overwrite its result maps once Refine has consumed them
+                    cudaStreamWaitEvent(deviceStreamManager.getStream(streamIndex), refine.getSgmInputsConsumedEvent(), 0);
+                }
+
                 // copy Refine depth/similarity map from device to host
-                tileDepthSimMap_hmh.copyFrom(refine.getDeviceDepthSimMap(), deviceStreamManager.getStream(streamIndex));
+                tileDepthSimMap_hmh.copyFrom(refine.getDeviceDepthSimMap(), refineStream);
             }
             else
             {
@@ -446,6 +536,9 @@ void DepthMapEstimator::compute(int cudaDeviceId, const std::vector<int>& cams)
         // wait for tiles batch computation
         cudaDeviceSynchronize();
 
+        // the whole batch of tiles is now computed on the device
+        progressDisplay += (lastTileIndex - firstTileIndex);
+
         // find first and last tile R camera
         const int firstRc = tiles.at(firstTileIndex).rc;
         int lastRc = tiles.at(lastTileIndex - 1).rc;
@@ -498,17 +591,33 @@ void DepthMapEstimator::compute(int cudaDeviceId, const std::vector<int>& cams)
                 if (_refineParams.exportIntermediateNormalMaps)
                 {
                     mergeNormalMapTiles(rc, _mp, _refineParams.scale, _refineParams.stepXY, "refinedFused");
+                }
+
+                if (_refineParams.computeNormalMaps || _refineParams.exportIntermediateNormalMaps)
+                {
                     mergeNormalMapTiles(rc, _mp, _refineParams.scale, _refineParams.stepXY);
                 }
             }
         }
     }
 
+    // destroy the pipelining events (each batch ends with a device synchronization)
+    for (cudaEvent_t& event : sgmOutputsReadyEvents)
+        cudaEventDestroy(event);
+
+    // wait for the background debug/QA export tasks,
+    // they reference the Sgm and Refine objects destroyed below
+    flushDebugExports();
+
     // some objects countains CUDA objects
     // this objects should be destroyed before the end of the program (i.e. the end of the CUDA context)
     DeviceCache::getInstance().clear();
     sgmPerStream.clear();
     refinePerStream.clear();
+
+    // log pooled device memory usage and free the cached buffers before the end of the CUDA context
+    DeviceMemoryPool::getInstance().logStatistics();
+    DeviceMemoryPool::getInstance().clear();
 }
 
 }  // namespace depthMap
@@ -31,7 +31,8 @@ struct DepthMapParams
 
     // constant parameters
 
-    const bool useRefine = true;  //< for debug purposes: enable or disable Refine process
+    const bool useRefine = true;          //< for debug purposes: enable or disable Refine process
+    const bool pipelineSgmRefine = true;  //< for debug purposes: overlap the Refine of a tile with the SGM of the next tile (separate streams)
 };
 
 }  // namespace depthMap
@@ -13,10 +13,13 @@
 #include <aliceVision/mvsUtils/fileIO.hpp>
 #include <aliceVision/depthMap/depthMapUtils.hpp>
 #include <aliceVision/depthMap/volumeIO.hpp>
+#include <aliceVision/depthMap/cuda/host/utils.hpp>
 #include <aliceVision/depthMap/cuda/host/DeviceCache.hpp>
 #include <aliceVision/depthMap/cuda/planeSweeping/deviceDepthSimilarityMap.hpp>
 #include <aliceVision/depthMap/cuda/planeSweeping/deviceSimilarityVolume.hpp>
 
+#include <memory>
+
 namespace aliceVision {
 namespace depthMap {
 
@@ -44,7 +47,7 @@ Refine::Refine(const mvsUtils::MultiViewParams& mp, const mvsUtils::TileParams&
         _sgmNormalMap_dmp.allocate(depthSimMapDim);
 
     // allocate normal map in device memory
-    if (_refineParams.exportIntermediateNormalMaps)
+    if (_refineParams.computeNormalMaps || _refineParams.exportIntermediateNormalMaps)
         _normalMap_dmp.allocate(depthSimMapDim);
 
     // compute volume maximum dimensions
@@ -60,6 +63,15 @@ Refine::Refine(const mvsUtils::MultiViewParams& mp, const mvsUtils::TileParams&
         _optTmpDepthMap_dmp.allocate(depthSimMapDim);
         _optImgVariance_dmp.allocate(depthSimMapDim);
     }
+
+    // create the SGM inputs consumed event (no timing needed)
+    CHECK_CUDA_RETURN_ERROR(cudaEventCreateWithFlags(&_sgmInputsConsumedEvent, cudaEventDisableTiming));
+}
+
+Refine::~Refine()
+{
+    // the event can be destroyed while still recorded, pending stream waits complete normally
+    cudaEventDestroy(_sgmInputsConsumedEvent);
 }
 
 double Refine::getDeviceMemoryConsumption() const
@@ -137,6 +149,10 @@ void Refine::refineRc(const Tile& tile,
         }
     }
 
+    // the SGM result maps are no longer read beyond this point,
+    // signal it so that the next SGM computation may overwrite them (see DepthMapEstimator)
+    cudaEventRecord(_sgmInputsConsumedEvent, _stream);
+
     // refine and fuse depth/sim map
     if (_refineParams.useRefineFuse)
     {
@@ -168,8 +184,9 @@ void Refine::refineRc(const Tile& tile,
         _optimizedDepthSimMap_dmp.copyFrom(_refinedDepthSimMap_dmp, _stream);
     }
 
-    // export intermediate normal map (if requested by user)
-    if (_refineParams.exportIntermediateNormalMaps)
+    // compute and write the output normal map from the final depth/sim map (if requested by user)
+    // the depth/sim map is still in device memory, no read-decode-upload cycle is needed
+    if (_refineParams.computeNormalMaps || _refineParams.exportIntermediateNormalMaps)
         computeAndWriteNormalMap(tile, _optimizedDepthSimMap_dmp);
 
     ALICEVISION_LOG_INFO(tile << "Refine depth/sim map done.");
@@ -307,45 +324,46 @@ void Refine::exportVolumeInformation(const Tile& tile, const std::string& name)
     }
 
     // copy device similarity volume to host memory
-    CudaHostMemoryHeap<TSimRefine, 3> volumeSim_hmh(_volumeRefineSim_dmp.getSize());
-    volumeSim_hmh.copyFrom(_volumeRefineSim_dmp);
+    // the host copies are owned by the export tasks, the GPU pipeline can go on
+    auto volumeSim_hmh = std::make_shared<CudaHostMemoryHeap<TSimRefine, 3>>(_volumeRefineSim_dmp.getSize());
+    volumeSim_hmh->copyFrom(_volumeRefineSim_dmp);
 
     // copy device SGM upscale depth/sim map to host memory
-    CudaHostMemoryHeap<float2, 2> depthPixSizeMapSgmUpscale_hmh(_sgmDepthPixSizeMap_dmp.getSize());
-    depthPixSizeMapSgmUpscale_hmh.copyFrom(_sgmDepthPixSizeMap_dmp);
+    auto depthPixSizeMapSgmUpscale_hmh = std::make_shared<CudaHostMemoryHeap<float2, 2>>(_sgmDepthPixSizeMap_dmp.getSize());
+    depthPixSizeMapSgmUpscale_hmh->copyFrom(_sgmDepthPixSizeMap_dmp);
 
     if (_refineParams.exportIntermediateCrossVolumes)
     {
-        ALICEVISION_LOG_INFO(tile << "Export similarity volume cross (" << name << ").");
-
         const std::string volumeCrossPath = getFileNameFromIndex(_mp, tile.rc, mvsUtils::EFileType::volumeCross, "_" + name, tileBeginX, tileBeginY);
 
-        exportSimilarityVolumeCross(volumeSim_hmh, depthPixSizeMapSgmUpscale_hmh, _mp, tile.rc, _refineParams, volumeCrossPath, tile.roi);
-
-        ALICEVISION_LOG_INFO(tile << "Export similarity volume cross (" << name << ") done.");
+        enqueueDebugExport([this, tile, name, volumeSim_hmh, depthPixSizeMapSgmUpscale_hmh, volumeCrossPath] {
+            ALICEVISION_LOG_INFO(tile << "Export similarity volume cross (" << name << ").");
+            exportSimilarityVolumeCross(*volumeSim_hmh, *depthPixSizeMapSgmUpscale_hmh, _mp, tile.rc, _refineParams, volumeCrossPath, tile.roi);
+            ALICEVISION_LOG_INFO(tile << "Export similarity volume cross (" << name << ") done.");
+        });
     }
 
     if (_refineParams.exportIntermediateTopographicCutVolumes)
     {
-        ALICEVISION_LOG_INFO(tile << "Export similarity volume topographic cut (" << name << ").");
-
         const std::string volumeCutPath =
           getFileNameFromIndex(_mp, tile.rc, mvsUtils::EFileType::volumeTopographicCut, "_" + name, tileBeginX, tileBeginY);
 
-        exportSimilarityVolumeTopographicCut(volumeSim_hmh, depthPixSizeMapSgmUpscale_hmh, _mp, tile.rc, _refineParams, volumeCutPath, tile.roi);
-
-        ALICEVISION_LOG_INFO(tile << "Export similarity volume topographic cut (" << name << ") done.");
+        enqueueDebugExport([this, tile, name, volumeSim_hmh, depthPixSizeMapSgmUpscale_hmh, volumeCutPath] {
+            ALICEVISION_LOG_INFO(tile << "Export similarity volume topographic cut (" << name << ").");
+            exportSimilarityVolumeTopographicCut(*volumeSim_hmh, *depthPixSizeMapSgmUpscale_hmh, _mp, tile.rc, _refineParams, volumeCutPath, tile.roi);
+            ALICEVISION_LOG_INFO(tile << "Export similarity volume topographic cut (" << name << ") done.");
+        });
     }
 
     if (_refineParams.exportIntermediateVolume9pCsv)
     {
-        ALICEVISION_LOG_INFO(tile << "Export similarity volume 9 points CSV (" << name << ").");
-
         const std::string stats9Path = getFileNameFromIndex(_mp, tile.rc, mvsUtils::EFileType::stats9p, "_refine", tileBeginX, tileBeginY);
 
-        exportSimilaritySamplesCSV(volumeSim_hmh, name, _refineParams, stats9Path, tile.roi);
-
-        ALICEVISION_LOG_INFO(tile << "Export similarity volume 9 points CSV (" << name << ") done.");
+        enqueueDebugExport([this, tile, name, volumeSim_hmh, stats9Path] {
+            ALICEVISION_LOG_INFO(tile << "Export similarity volume 9 points CSV (" << name << ").");
+            exportSimilaritySamplesCSV(*volumeSim_hmh, name, _refineParams, stats9Path, tile.roi);
+            ALICEVISION_LOG_INFO(tile << "Export similarity volume 9 points CSV (" << name << ") done.");
+        });
     }
 }
 
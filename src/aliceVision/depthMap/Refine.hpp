@@ -39,12 +39,17 @@ class Refine
     // no default constructor
     Refine() = delete;
 
-    // default destructor
-    ~Refine() = default;
+    // destructor
+    ~Refine();
 
     // final depth/similarity map getter
     inline const CudaDeviceMemoryPitched<float2, 2>& getDeviceDepthSimMap() const { return _optimizedDepthSimMap_dmp; }
 
+    // SGM inputs consumed event getter
+    // the event is recorded (in the Refine stream) once refineRc() has read the SGM result maps,
+    // waiting for it allows the caller to overwrite these maps with the next SGM computation
+    inline cudaEvent_t getSgmInputsConsumedEvent() const { return _sgmInputsConsumedEvent; }
+
     /**
      * @brief Get memory consumpyion in device memory.
      * @return device memory consumpyion (in MB)
@@ -114,6 +119,7 @@ class Refine
     CudaDeviceMemoryPitched<float, 2> _optTmpDepthMap_dmp;         //< for color optimization: temporary depth map buffer
     CudaDeviceMemoryPitched<float, 2> _optImgVariance_dmp;         //< for color optimization: image variance buffer
     cudaStream_t _stream;                                          //< stream for gpu execution
+    cudaEvent_t _sgmInputsConsumedEvent;                           //< recorded once the SGM result maps have been consumed by refineRc()
 };
 
 }  // namespace depthMap
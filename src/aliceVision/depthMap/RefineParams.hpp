@@ -31,6 +31,7 @@ struct RefineParams
     bool useCustomPatchPattern = false;
     bool useRefineFuse = true;
     bool useColorOptimization = true;
+    bool computeNormalMaps = false;
 
     // intermediate results export parameters
 
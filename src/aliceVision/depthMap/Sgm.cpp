@@ -16,6 +16,7 @@
 #include <aliceVision/depthMap/cuda/planeSweeping/deviceSimilarityVolume.hpp>
 
 #include <iostream>
+#include <memory>
 #include <sstream>
 
 namespace aliceVision {
@@ -329,7 +330,8 @@ void Sgm::exportVolumeInformation(const Tile& tile,
                                   const CudaDeviceMemoryPitched<TSim, 3>& in_volume_dmp,
                                   const std::string& name) const
 {
-    if (!_sgmParams.exportIntermediateVolumes && !_sgmParams.exportIntermediateCrossVolumes && !_sgmParams.exportIntermediateVolume9pCsv)
+    if (!_sgmParams.exportIntermediateVolumes && !_sgmParams.exportIntermediateCompressedVolumes && !_sgmParams.exportIntermediateCrossVolumes &&
+        !_sgmParams.exportIntermediateVolume9pCsv)
     {
         // nothing to do
         return;
@@ -346,52 +348,69 @@ void Sgm::exportVolumeInformation(const Tile& tile,
     }
 
     // copy device similarity volume to host memory
-    CudaHostMemoryHeap<TSim, 3> volumeSim_hmh(in_volume_dmp.getSize());
-    volumeSim_hmh.copyFrom(in_volume_dmp);
+    // the host copy and the depth list are owned by the export tasks, the GPU pipeline can go on
+    auto volumeSim_hmh = std::make_shared<CudaHostMemoryHeap<TSim, 3>>(in_volume_dmp.getSize());
+    volumeSim_hmh->copyFrom(in_volume_dmp);
+
+    auto depths = std::make_shared<std::vector<float>>(tileDepthList.getDepths());
 
     if (_sgmParams.exportIntermediateVolumes)
     {
-        ALICEVISION_LOG_INFO(tile << "Export similarity volume (" << name << ").");
-
         const std::string volumePath = getFileNameFromIndex(_mp, tile.rc, mvsUtils::EFileType::volume, "_" + name, tileBeginX, tileBeginY);
 
-        exportSimilarityVolume(volumeSim_hmh, tileDepthList.getDepths(), _mp, tile.rc, _sgmParams, volumePath, tile.roi);
+        enqueueDebugExport([this, tile, name, volumeSim_hmh, depths, volumePath] {
+            ALICEVISION_LOG_INFO(tile << "Export similarity volume (" << name << ").");
+            exportSimilarityVolume(*volumeSim_hmh, *depths, _mp, tile.rc, _sgmParams, volumePath, tile.roi);
+            ALICEVISION_LOG_INFO(tile << "Export similarity volume (" << name << ") done.");
+        });
+    }
+
+    if (_sgmParams.exportIntermediateCompressedVolumes)
+    {
+        const std::string volumePath = getFileNameFromIndex(_mp, tile.rc, mvsUtils::EFileType::volumeCompressed, "_" + name, tileBeginX, tileBeginY);
+
+        // quantize to 16 bits when the device similarity type is wider than a byte
+        const int nbBits = (sizeof(TSim) == 1) ? 8 : 16;
 
-        ALICEVISION_LOG_INFO(tile << "Export similarity volume (" << name << ") done.");
+        enqueueDebugExport([this, tile, name, volumeSim_hmh, depths, nbBits, volumePath] {
+            ALICEVISION_LOG_INFO(tile << "Export compressed similarity volume (" << name << ").");
+            exportSimilarityVolumeCompressed(*volumeSim_hmh, *depths, _sgmParams, nbBits, volumePath, tile.roi);
+            ALICEVISION_LOG_INFO(tile << "Export compressed similarity volume (" << name << ") done.");
+        });
     }
 
     if (_sgmParams.exportIntermediateCrossVolumes)
     {
-        ALICEVISION_LOG_INFO(tile << "Export similarity volume cross (" << name << ").");
-
         const std::string volumeCrossPath = getFileNameFromIndex(_mp, tile.rc, mvsUtils::EFileType::volumeCross, "_" + name, tileBeginX, tileBeginY);
 
-        exportSimilarityVolumeCross(volumeSim_hmh, tileDepthList.getDepths(), _mp, tile.rc, _sgmParams, volumeCrossPath, tile.roi);
-
-        ALICEVISION_LOG_INFO(tile << "Export similarity volume cross (" << name << ") done.");
+        enqueueDebugExport([this, tile, name, volumeSim_hmh, depths, volumeCrossPath] {
+            ALICEVISION_LOG_INFO(tile << "Export similarity volume cross (" << name << ").");
+            exportSimilarityVolumeCross(*volumeSim_hmh, *depths, _mp, tile.rc, _sgmParams, volumeCrossPath, tile.roi);
+            ALICEVISION_LOG_INFO(tile << "Export similarity volume cross (" << name << ") done.");
+        });
     }
 
     if (_sgmParams.exportIntermediateTopographicCutVolumes)
     {
-        ALICEVISION_LOG_INFO(tile << "Export similarity volume topographic cut (" << name << ").");
-
         const std::string volumeCutPath =
           getFileNameFromIndex(_mp, tile.rc, mvsUtils::EFileType::volumeTopographicCut, "_" + name, tileBeginX, tileBeginY);
 
-        exportSimilarityVolumeTopographicCut(volumeSim_hmh, tileDepthList.getDepths(), _mp, tile.rc, _sgmParams, volumeCutPath, tile.roi);
-
-        ALICEVISION_LOG_INFO(tile << "Export similarity volume topographic cut (" << name << ") done.");
+        enqueueDebugExport([this, tile, name, volumeSim_hmh, depths, volumeCutPath] {
+            ALICEVISION_LOG_INFO(tile << "Export similarity volume topographic cut (" << name << ").");
+            exportSimilarityVolumeTopographicCut(*volumeSim_hmh, *depths, _mp, tile.rc, _sgmParams, volumeCutPath, tile.roi);
+            ALICEVISION_LOG_INFO(tile << "Export similarity volume topographic cut (" << name << ") done.");
+        });
     }
 
     if (_sgmParams.exportIntermediateVolume9pCsv)
     {
-        ALICEVISION_LOG_INFO(tile << "Export similarity volume 9 points CSV (" << name << ").");
-
         const std::string stats9Path = getFileNameFromIndex(_mp, tile.rc, mvsUtils::EFileType::stats9p, "_sgm", tileBeginX, tileBeginY);
 
-        exportSimilaritySamplesCSV(volumeSim_hmh, tileDepthList.getDepths(), name, _sgmParams, stats9Path, tile.roi);
-
-        ALICEVISION_LOG_INFO(tile << "Export similarity volume 9 points CSV (" << name << ") done.");
+        enqueueDebugExport([this, tile, name, volumeSim_hmh, depths, stats9Path] {
+            ALICEVISION_LOG_INFO(tile << "Export similarity volume 9 points CSV (" << name << ").");
+            exportSimilaritySamplesCSV(*volumeSim_hmh, *depths, name, _sgmParams, stats9Path, tile.roi);
+            ALICEVISION_LOG_INFO(tile << "Export similarity volume 9 points CSV (" << name << ") done.");
+        });
     }
 }
 
@@ -140,18 +140,50 @@ void SgmDepthList::computeListRc()
     // filter out depths if computeDepths gave too many values
     if (_sgmParams.maxDepths > 0 && _depths.size() > _sgmParams.maxDepths)
     {
-        const float scaleFactor = float(_depths.size()) / float(_sgmParams.maxDepths);
+        const std::size_t maxDepths = _sgmParams.maxDepths;
 
-        ALICEVISION_LOG_DEBUG(_tile << "Too many values in R camera depth list, filter out with scale factor:" << std::endl
-                                    << "\t- nb depths: " << _depths.size() << std::endl
-                                    << "\t- max depths: " << _sgmParams.maxDepths << std::endl
-                                    << "\t- scale factor to apply: " << scaleFactor);
+        if (_sgmParams.useSfmSeeds && nbObsDepths > 10)
+        {
+            // adaptive depth plane budget:
+            // spend the fixed budget on the depth range supported by landmarks first,
+            // the range outside the landmark depth spread only gets the remainder
+            std::size_t nbInside = 0;
+            for (const float depth : _depths)
+                if (depth >= minObsDepth && depth <= maxObsDepth)
+                    ++nbInside;
+            const std::size_t nbOutside = _depths.size() - nbInside;
+
+            // always keep at least a coarse sampling outside the landmark depth spread
+            const std::size_t insideBudget = std::min(nbInside, maxDepths - std::min(nbOutside, maxDepths / 8));
+            const std::size_t outsideBudget = maxDepths - insideBudget;
+
+            const float scaleFactorInside = std::max(1.f, float(nbInside) / float(std::max<std::size_t>(insideBudget, 1)));
+            const float scaleFactorOutside = std::max(1.f, float(nbOutside) / float(std::max<std::size_t>(outsideBudget, 1)));
+
+            ALICEVISION_LOG_DEBUG(_tile << "Too many values in R camera depth list, adaptive filter out:" << std::endl
+                                        << "\t- nb depths: " << _depths.size() << std::endl
+                                        << "\t- max depths: " << maxDepths << std::endl
+                                        << "\t- nb depths in landmark depth spread: " << nbInside << std::endl
+                                        << "\t- scale factor to apply inside: " << scaleFactorInside << std::endl
+                                        << "\t- scale factor to apply outside: " << scaleFactorOutside);
+
+            computeAdaptiveRcDepthList(firstDepth, lastDepth, minObsDepth, maxObsDepth, scaleFactorInside, scaleFactorOutside, depthsPerTc);
+        }
+        else
+        {
+            const float scaleFactor = float(_depths.size()) / float(maxDepths);
+
+            ALICEVISION_LOG_DEBUG(_tile << "Too many values in R camera depth list, filter out with scale factor:" << std::endl
+                                        << "\t- nb depths: " << _depths.size() << std::endl
+                                        << "\t- max depths: " << maxDepths << std::endl
+                                        << "\t- scale factor to apply: " << scaleFactor);
 
-        computeRcDepthList(firstDepth, lastDepth, scaleFactor, depthsPerTc);
+            computeRcDepthList(firstDepth, lastDepth, scaleFactor, depthsPerTc);
+        }
 
         // ensure depth list size is not greater than maxDepths
-        if (_depths.size() > _sgmParams.maxDepths)
-            _depths.resize(_sgmParams.maxDepths);  // reduce to depth list first maxDepths elements
+        if (_depths.size() > maxDepths)
+            _depths.resize(maxDepths);  // reduce to depth list first maxDepths elements
     }
 
     ALICEVISION_LOG_DEBUG(_tile << "Final depth range for R camera:" << std::endl
@@ -653,6 +685,49 @@ void SgmDepthList::computeRcDepthList(float firstDepth, float lastDepth, float s
     }
 }
 
+void SgmDepthList::computeAdaptiveRcDepthList(float firstDepth,
+                                              float lastDepth,
+                                              float minObsDepth,
+                                              float maxObsDepth,
+                                              float scaleFactorInside,
+                                              float scaleFactorOutside,
+                                              const std::vector<std::vector<float>>& dephtsPerTc)
+{
+    _depths.clear();
+
+    float depth = firstDepth;
+
+    while (depth < lastDepth)
+    {
+        _depths.push_back(depth);
+
+        // get min tc step at depth
+        float minTcStep = lastDepth - firstDepth;
+
+        // for each tc camera
+        for (const std::vector<float>& tcDepths : dephtsPerTc)
+        {
+            // get the tc depth closest to the current depth
+            const int id = indexOfNearestSorted(tcDepths, depth);
+
+            // continue on no result or last element (we need id + 1)
+            if (id < 0 || id >= tcDepths.size() - 1)
+                continue;
+
+            // enclosing depth range
+            const float tcStep = fabs(tcDepths.at(id) - tcDepths.at(id + 1));  // (closest - next) depths distance
+
+            // keep this value if smallest step so far
+            minTcStep = std::min(minTcStep, tcStep);
+        }
+
+        // coarsen the sampling outside the landmark depth spread only
+        const float scaleFactor = (depth >= minObsDepth && depth <= maxObsDepth) ? scaleFactorInside : scaleFactorOutside;
+
+        depth += minTcStep * scaleFactor;
+    }
+}
+
 void SgmDepthList::exportTxtFiles(const std::vector<std::vector<float>>& dephtsPerTc) const
 {
     const std::string prefix(_mp.getDepthMapsFolder() + std::to_string(_mp.getViewId(_tile.rc)) + std::string("_"));
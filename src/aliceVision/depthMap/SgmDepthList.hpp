@@ -109,6 +109,25 @@ class SgmDepthList
      */
     void computeRcDepthList(float firstDepth, float lastDepth, float scaleFactor, const std::vector<std::vector<float>>& dephtsPerTc);
 
+    /**
+     * @brief Fill the list of "best" depths (_depths) for rc with a depth plane budget spent adaptively:
+     *        the sampling is kept fine inside the landmark depth spread and coarsened outside of it.
+     * @param[in] firstDepth The first depth
+     * @param[in] lastDepth The last depth
+     * @param[in] minObsDepth The minimum depth observation
+     * @param[in] maxObsDepth The maximum depth observation
+     * @param[in] scaleFactorInside The scale factor to apply between each depth inside the observations range
+     * @param[in] scaleFactorOutside The scale factor to apply between each depth outside the observations range
+     * @param[in] dephtsPerTc The depth list per T camera
+     */
+    void computeAdaptiveRcDepthList(float firstDepth,
+                                    float lastDepth,
+                                    float minObsDepth,
+                                    float maxObsDepth,
+                                    float scaleFactorInside,
+                                    float scaleFactorOutside,
+                                    const std::vector<std::vector<float>>& dephtsPerTc);
+
     /**
      * @brief Export multiple intermediate depth list txt files.
      * @param[in] dephtsPerTc The depth list per T camera
@@ -42,6 +42,7 @@ struct SgmParams
     bool exportIntermediateDepthSimMaps = false;
     bool exportIntermediateNormalMaps = false;
     bool exportIntermediateVolumes = false;
+    bool exportIntermediateCompressedVolumes = false;
     bool exportIntermediateCrossVolumes = false;
     bool exportIntermediateTopographicCutVolumes = false;
     bool exportIntermediateVolume9pCsv = false;
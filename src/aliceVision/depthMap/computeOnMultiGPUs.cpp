@@ -8,6 +8,10 @@
 
 #include <aliceVision/alicevision_omp.hpp>
 #include <aliceVision/depthMap/cuda/host/utils.hpp>
+#include <aliceVision/gpu/GpuRegistry.hpp>
+
+#include <algorithm>
+#include <atomic>
 
 namespace aliceVision {
 namespace depthMap {
@@ -27,44 +31,70 @@ void computeOnMultiGPUs(const std::vector<int>& cams, IGPUJob& gpujob, int nbGPU
         nbThreads = std::min(nbThreads, nbGPUsToUse);
     }
 
+    // arbitrate the devices with the other processes of the node: the registry hands out the
+    // least claimed devices, so two concurrent pipelines do not both pick device 0
+    gpu::GpuRegistry gpuRegistry;
+
     if (nbThreads == 1)
     {
         // the GPU sorting is determined by an environment variable named CUDA_DEVICE_ORDER
         // possible values: FASTEST_FIRST (default) or PCI_BUS_ID
-        const int cudaDeviceId = 0;
+        const int cudaDeviceId = gpuRegistry.claimDevice(nbGPUDevices);
         gpujob.compute(cudaDeviceId, cams);
+        gpuRegistry.releaseDevice(cudaDeviceId);
     }
     else
     {
+        // dynamic work distribution: each GPU worker thread pulls the next chunk of cameras
+        // from a shared queue, so all devices stay busy until the last chunk even when
+        // per-camera cost is heterogeneous (image sizes, number of T cameras, ...)
+        // note: chunks keep several cameras to amortize the per-call device setup of the job
+        const int nbCams = static_cast<int>(cams.size());
+        const int chunkSize = std::max(1, nbCams / (nbThreads * 4));
+        std::atomic<int> sharedCamIndex(0);
+
+        // claim one device per worker thread, least claimed first
+        std::vector<int> claimedDevices;
+        claimedDevices.reserve(nbThreads);
+        for (int i = 0; i < nbThreads; ++i)
+            claimedDevices.push_back(gpuRegistry.claimDevice(nbGPUDevices));
+
         // backup max threads to keep potentially previously set value
         int previous_count_threads = omp_get_max_threads();
         omp_set_num_threads(nbThreads);  // create as many CPU threads as there are CUDA devices
 #pragma omp parallel
         {
             const int cpuThreadId = omp_get_thread_num();
-            const int cudaDeviceId = cpuThreadId % nbThreads;
+            const int cudaDeviceId = claimedDevices.at(cpuThreadId % nbThreads);
 
             ALICEVISION_LOG_INFO("CPU thread " << cpuThreadId << " (of " << nbThreads << ") uses CUDA device: " << cudaDeviceId);
 
-            const int nbCamsPerThread = (cams.size() / nbThreads);
-            const int rcFrom = cudaDeviceId * nbCamsPerThread;
-            int rcTo = (cudaDeviceId + 1) * nbCamsPerThread;
-            if (cudaDeviceId == nbThreads - 1)
+            while (true)
             {
-                rcTo = cams.size();
-            }
+                const int rcFrom = sharedCamIndex.fetch_add(chunkSize);
 
-            std::vector<int> subcams;
-            subcams.reserve(cams.size());
+                if (rcFrom >= nbCams)
+                {
+                    break;
+                }
 
-            for (int rc = rcFrom; rc < rcTo; ++rc)
-            {
-                subcams.push_back(cams[rc]);
-            }
+                const int rcTo = std::min(rcFrom + chunkSize, nbCams);
+
+                std::vector<int> subcams;
+                subcams.reserve(rcTo - rcFrom);
+
+                for (int rc = rcFrom; rc < rcTo; ++rc)
+                {
+                    subcams.push_back(cams[rc]);
+                }
 
-            gpujob.compute(cudaDeviceId, subcams);
+                gpujob.compute(cudaDeviceId, subcams);
+            }
         }
         omp_set_num_threads(previous_count_threads);
+
+        for (const int cudaDeviceId : claimedDevices)
+            gpuRegistry.releaseDevice(cudaDeviceId);
     }
 }
 
@@ -177,6 +177,10 @@ DeviceCache::SingleDeviceCache::SingleDeviceCache(int maxMipmapImages, int maxCa
     {
         mipmaps.push_back(std::make_unique<DeviceMipmapImage>());
     }
+
+    // allocate the pinned host-side camera parameters staging buffer once for the whole run,
+    // a per-insertion cudaMallocHost/cudaFreeHost pair synchronizes the device
+    cameraParams_hmh.allocate(CudaSize<2>(maxCameraParams, 1));
 }
 
 void DeviceCache::clear()
@@ -303,22 +307,28 @@ void DeviceCache::addCameraParams(int camId, int downscale, const mvsUtils::Mult
 
     ALICEVISION_LOG_TRACE("Add camera parameters on device cache (id: " << camId << ", view id: " << viewId << ", downscale: " << downscale << ").");
 
-    // build host-side device camera parameters struct
-    DeviceCameraParams* cameraParameters_h = nullptr;
+    // get the pinned host-side staging slot associated with the constant memory array entry
+    DeviceCameraParams& cameraParameters_h = currentDeviceCache.cameraParams_hmh(deviceCameraParamsId, 0);
 
-    const cudaError_t err = cudaMallocHost(&cameraParameters_h, sizeof(DeviceCameraParams));
-    CHECK_CUDA_RETURN_ERROR(err);
-    THROW_ON_CUDA_ERROR(err, "Failed to allocate camera parameters in pinned host memory.");
+    // host-side camera parameters are computed once per (camera id, downscale) for the whole run,
+    // a re-insertion after a cache eviction only re-uploads them
+    const CameraPair cameraPair(camId, downscale);
+    const auto memoIt = currentDeviceCache.cameraParamsMemo.find(cameraPair);
 
-    // fill the host-side camera parameters from multi-view parameters.
-    fillHostCameraParameters(*cameraParameters_h, camId, downscale, mp);
+    if (memoIt != currentDeviceCache.cameraParamsMemo.end())
+    {
+        cameraParameters_h = memoIt->second;
+    }
+    else
+    {
+        // fill the host-side camera parameters from multi-view parameters.
+        fillHostCameraParameters(cameraParameters_h, camId, downscale, mp);
+        currentDeviceCache.cameraParamsMemo.emplace(cameraPair, cameraParameters_h);
+    }
 
     // copy host-side device camera parameters struct to device-side camera parameters array
     // note: device-side camera parameters array is in constant memory
-    fillDeviceCameraParameters(*cameraParameters_h, deviceCameraParamsId);
-
-    // free host-side device camera parameters struct
-    CHECK_CUDA_RETURN_ERROR(cudaFreeHost(cameraParameters_h));
+    fillDeviceCameraParameters(cameraParameters_h, deviceCameraParamsId);
 
     // check last error
     CHECK_CUDA_ERROR();
@@ -12,6 +12,7 @@
 #include <aliceVision/mvsUtils/ImagesCache.hpp>
 #include <aliceVision/depthMap/cuda/host/LRUCameraCache.hpp>
 #include <aliceVision/depthMap/cuda/host/DeviceMipmapImage.hpp>
+#include <aliceVision/depthMap/cuda/host/memory.hpp>
 #include <aliceVision/depthMap/cuda/device/DeviceCameraParams.hpp>
 
 namespace aliceVision {
@@ -105,6 +106,9 @@ class DeviceCache
         LRUCameraCache cameraParamCache;  //< device camera parameters id cached per (camera id, downscale)
 
         std::vector<std::unique_ptr<DeviceMipmapImage>> mipmaps;  //< cached device mipmap images
+
+        CudaHostMemoryHeap<DeviceCameraParams, 2> cameraParams_hmh;  //< pinned staging buffer, one slot per constant memory array entry
+        std::map<CameraPair, DeviceCameraParams> cameraParamsMemo;   //< host-side camera parameters computed once per (camera id, downscale)
     };
     std::map<int, std::unique_ptr<SingleDeviceCache>> _cachePerDevice;  // <cudaDeviceId, SingleDeviceCachePtr>
 
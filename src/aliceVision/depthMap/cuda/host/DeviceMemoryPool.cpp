@@ -0,0 +1,186 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "DeviceMemoryPool.hpp"
+
+#include <aliceVision/system/Logger.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+namespace aliceVision {
+namespace depthMap {
+
+DeviceMemoryPool::~DeviceMemoryPool()
+{
+    // free the remaining cached buffers, ignoring errors:
+    // the CUDA context may already be destroyed at program exit
+    for (auto& freeListIt : _freeLists)
+        for (void* buffer : freeListIt.second)
+            cudaFree(buffer);
+}
+
+void* DeviceMemoryPool::acquireCached(const BufferShape& shape, size_t& outPitch)
+{
+    const std::scoped_lock<std::mutex> lock(_mutex);
+
+    ++_nbRequests;
+
+    auto freeListIt = _freeLists.find(shape);
+    if (freeListIt == _freeLists.end() || freeListIt->second.empty())
+        return nullptr;
+
+    void* buffer = freeListIt->second.back();
+    freeListIt->second.pop_back();
+
+    const BufferInfo& info = _bufferInfos.at(buffer);
+    outPitch = info.pitch;
+
+    ++_nbReuses;
+    _bytesCached -= info.bytesPadded;
+    _bytesInUse += info.bytesPadded;
+
+    return buffer;
+}
+
+void DeviceMemoryPool::registerAllocation(void* buffer, const BufferShape& shape, size_t pitch, size_t bytesPadded)
+{
+    const std::scoped_lock<std::mutex> lock(_mutex);
+
+    _bufferInfos[buffer] = {shape, pitch, bytesPadded};
+    _bytesInUse += bytesPadded;
+    _peakBytes = std::max(_peakBytes, _bytesInUse + _bytesCached);
+}
+
+void* DeviceMemoryPool::allocatePitched(size_t unpaddedBytesInRow, size_t height, size_t& outPitch)
+{
+    int deviceId = -1;
+    cudaGetDevice(&deviceId);
+
+    const BufferShape shape{deviceId, unpaddedBytesInRow, height, 1};
+
+    if (void* buffer = acquireCached(shape, outPitch))
+        return buffer;
+
+    void* buffer = nullptr;
+    cudaError_t err = cudaMallocPitch(&buffer, &outPitch, unpaddedBytesInRow, height);
+    if (err != cudaSuccess)
+    {
+        std::stringstream ss;
+        ss << "Could not allocate pitched device memory.\n"
+           << "Device " << deviceId << " alloc " << unpaddedBytesInRow * height << " bytes failed, " << cudaGetErrorString(err);
+        throw std::runtime_error(ss.str());
+    }
+
+    registerAllocation(buffer, shape, outPitch, outPitch * height);
+
+    return buffer;
+}
+
+void* DeviceMemoryPool::allocate3D(size_t unpaddedBytesInRow, size_t height, size_t depth, size_t& outPitch)
+{
+    int deviceId = -1;
+    cudaGetDevice(&deviceId);
+
+    const BufferShape shape{deviceId, unpaddedBytesInRow, height, depth};
+
+    if (void* buffer = acquireCached(shape, outPitch))
+        return buffer;
+
+    cudaExtent extent;
+    extent.width = unpaddedBytesInRow;
+    extent.height = height;
+    extent.depth = depth;
+
+    cudaPitchedPtr pitchDevPtr;
+    cudaError_t err = cudaMalloc3D(&pitchDevPtr, extent);
+    if (err != cudaSuccess)
+    {
+        std::stringstream ss;
+        ss << "Could not allocate 3D device memory.\n"
+           << "Device " << deviceId << " alloc " << unpaddedBytesInRow << "x" << height << "x" << depth << " = "
+           << unpaddedBytesInRow * height * depth << " bytes failed, " << cudaGetErrorString(err);
+        throw std::runtime_error(ss.str());
+    }
+
+    outPitch = pitchDevPtr.pitch;
+
+    registerAllocation(pitchDevPtr.ptr, shape, outPitch, outPitch * height * depth);
+
+    return pitchDevPtr.ptr;
+}
+
+void DeviceMemoryPool::release(void* buffer)
+{
+    if (buffer == nullptr)
+        return;
+
+    {
+        const std::scoped_lock<std::mutex> lock(_mutex);
+
+        auto infoIt = _bufferInfos.find(buffer);
+        if (infoIt != _bufferInfos.end())
+        {
+            const BufferInfo& info = infoIt->second;
+            _freeLists[info.shape].push_back(buffer);
+            _bytesInUse -= info.bytesPadded;
+            _bytesCached += info.bytesPadded;
+            return;
+        }
+    }
+
+    // buffer unknown to the pool (e.g. released after clear() dropped its bookkeeping)
+    cudaError_t err = cudaFree(buffer);
+    if (err != cudaSuccess)
+    {
+        std::stringstream ss;
+        ss << "DeviceMemoryPool: Device free failed, " << cudaGetErrorString(err);
+        throw std::runtime_error(ss.str());
+    }
+}
+
+void DeviceMemoryPool::clear()
+{
+    int deviceId = -1;
+    cudaGetDevice(&deviceId);
+
+    const std::scoped_lock<std::mutex> lock(_mutex);
+
+    for (auto& freeListIt : _freeLists)
+    {
+        if (freeListIt.first.deviceId != deviceId)
+            continue;
+
+        for (void* buffer : freeListIt.second)
+        {
+            const BufferInfo& info = _bufferInfos.at(buffer);
+            _bytesCached -= info.bytesPadded;
+            _bufferInfos.erase(buffer);
+
+            cudaError_t err = cudaFree(buffer);
+            if (err != cudaSuccess)
+                ALICEVISION_LOG_WARNING("DeviceMemoryPool: Device free failed, " << cudaGetErrorString(err));
+        }
+        freeListIt.second.clear();
+    }
+}
+
+void DeviceMemoryPool::logStatistics() const
+{
+    const std::scoped_lock<std::mutex> lock(_mutex);
+
+    ALICEVISION_LOG_INFO("Device memory pool statistics: "
+                         << "\n\t- # allocation requests: " << _nbRequests << "\n\t- # served from the pool: " << _nbReuses
+                         << "\n\t- in use: " << (_bytesInUse / (1024.0 * 1024.0)) << " MB"
+                         << "\n\t- cached: " << (_bytesCached / (1024.0 * 1024.0)) << " MB"
+                         << "\n\t- peak: " << (_peakBytes / (1024.0 * 1024.0)) << " MB");
+}
+
+}  // namespace depthMap
+}  // namespace aliceVision
@@ -0,0 +1,134 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <tuple>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace aliceVision {
+namespace depthMap {
+
+/**
+ * @class Device memory pool
+ * @brief This singleton recycles CUDA device allocations across depth map tiles.
+ *
+ * cudaMallocPitch / cudaMalloc3D / cudaFree synchronize the device and their churn
+ * becomes significant when per-tile buffers are re-allocated for each batch.
+ * Released buffers are kept in per-shape free lists and handed back to the next
+ * allocation with the same shape on the same device, so the SGM and Refine buffers
+ * are effectively allocated once and reused until the pool is cleared.
+ */
+class DeviceMemoryPool
+{
+  public:
+    static DeviceMemoryPool& getInstance()
+    {
+        static DeviceMemoryPool instance;
+        return instance;
+    }
+
+    // Singleton, no copy constructor
+    DeviceMemoryPool(DeviceMemoryPool const&) = delete;
+
+    // Singleton, no copy operator
+    void operator=(DeviceMemoryPool const&) = delete;
+
+    /**
+     * @brief Allocate or recycle a pitched 2D device buffer.
+     * @param[in] unpaddedBytesInRow the requested row size (in bytes)
+     * @param[in] height the requested number of rows
+     * @param[out] outPitch the pitch (in bytes) of the returned buffer
+     * @return pointer to the device buffer
+     * @throw std::runtime_error if the device allocation fails
+     */
+    void* allocatePitched(size_t unpaddedBytesInRow, size_t height, size_t& outPitch);
+
+    /**
+     * @brief Allocate or recycle a pitched 3D device buffer.
+     * @param[in] unpaddedBytesInRow the requested row size (in bytes)
+     * @param[in] height the requested number of rows
+     * @param[in] depth the requested number of slices
+     * @param[out] outPitch the pitch (in bytes) of the returned buffer
+     * @return pointer to the device buffer
+     * @throw std::runtime_error if the device allocation fails
+     */
+    void* allocate3D(size_t unpaddedBytesInRow, size_t height, size_t depth, size_t& outPitch);
+
+    /**
+     * @brief Return a buffer obtained from this pool to its per-shape free list.
+     * @param[in] buffer pointer to the device buffer
+     */
+    void release(void* buffer);
+
+    /**
+     * @brief Free the cached buffers of the current CUDA device.
+     * @note Should be called before the end of the CUDA context, like DeviceCache::clear().
+     */
+    void clear();
+
+    /**
+     * @brief Log pool usage statistics (number of allocations served from the pool, cached bytes, ...).
+     */
+    void logStatistics() const;
+
+  private:
+    // private constructor
+    DeviceMemoryPool() = default;
+
+    ~DeviceMemoryPool();
+
+    /// identifies reusable allocations: same device and same requested shape
+    struct BufferShape
+    {
+        int deviceId;
+        size_t bytesInRow;
+        size_t height;
+        size_t depth;
+
+        bool operator<(const BufferShape& other) const
+        {
+            return std::tie(deviceId, bytesInRow, height, depth) < std::tie(other.deviceId, other.bytesInRow, other.height, other.depth);
+        }
+    };
+
+    struct BufferInfo
+    {
+        BufferShape shape;
+        size_t pitch;
+        size_t bytesPadded;
+    };
+
+    /// try to pop a cached buffer with the given shape, returns nullptr if none is available
+    void* acquireCached(const BufferShape& shape, size_t& outPitch);
+
+    /// record a fresh device allocation
+    void registerAllocation(void* buffer, const BufferShape& shape, size_t pitch, size_t bytesPadded);
+
+    /// per-shape free lists of released buffers
+    std::map<BufferShape, std::vector<void*>> _freeLists;
+
+    /// information about every buffer currently managed by the pool (in use or cached)
+    std::unordered_map<void*, BufferInfo> _bufferInfos;
+
+    /// usage statistics
+    size_t _nbRequests = 0;
+    size_t _nbReuses = 0;
+    size_t _bytesInUse = 0;
+    size_t _bytesCached = 0;
+    size_t _peakBytes = 0;
+
+    mutable std::mutex _mutex;
+};
+
+}  // namespace depthMap
+}  // namespace aliceVision
@@ -15,6 +15,7 @@
     #include <cuda_fp16.h>
 #endif
 
+#include <aliceVision/depthMap/cuda/host/DeviceMemoryPool.hpp>
 #include <aliceVision/depthMap/cuda/host/utils.hpp>
 #include <aliceVision/system/Logger.hpp>
 
@@ -477,48 +478,22 @@ class CudaDeviceMemoryPitched : public CudaMemorySizeBase<Type, Dim>
     {
         this->setSize(size, false);
 
+        // allocations go through the device memory pool, which recycles
+        // previously released buffers with the same shape (see DeviceMemoryPool)
         if (Dim == 2)
         {
-            cudaError_t err = cudaMallocPitch<Type>(&buffer, &this->getPitchRef(), this->getUnpaddedBytesInRow(), this->getUnitsInDim(1));
-            if (err != cudaSuccess)
-            {
-                int devid;
-                cudaGetDevice(&devid);
-                std::stringstream ss;
-                ss << "Could not allocate pitched device memory.\n"
-                   << "Device " << devid << " alloc " << this->getBytesUnpadded() << " bytes failed in " << __FILE__ << ":" << __LINE__ << ", "
-                   << cudaGetErrorString(err);
-                throw std::runtime_error(ss.str());
-            }
+            buffer = static_cast<Type*>(
+              DeviceMemoryPool::getInstance().allocatePitched(this->getUnpaddedBytesInRow(), this->getUnitsInDim(1), this->getPitchRef()));
         }
         else if (Dim == 3)
         {
-            cudaExtent extent;
-            extent.width = this->getUnpaddedBytesInRow();
-            extent.height = this->getUnitsInDim(1);
-            extent.depth = this->getUnitsInDim(2);
-            cudaPitchedPtr pitchDevPtr;
-            cudaError_t err = cudaMalloc3D(&pitchDevPtr, extent);
-            if (err != cudaSuccess)
-            {
-                int devid;
-                cudaGetDevice(&devid);
-                size_t bytes = this->getBytesUnpadded();
-                size_t sx = this->getUnitsInDim(0);
-                size_t sy = this->getUnitsInDim(1);
-                size_t sz = this->getUnitsInDim(2);
-                std::stringstream ss;
-                ss << "Could not allocate 3D device memory.\n"
-                   << "Device " << devid << " alloc " << sx << "x" << sy << "x" << sz << "x" << sizeof(Type) << " = " << bytes << " bytes ("
-                   << (int)(bytes / 1024.0f / 1024.0f) << " MB) failed in " << __FILE__ << ":" << __LINE__ << ", " << cudaGetErrorString(err);
-                throw std::runtime_error(ss.str());
-            }
-
-            buffer = (Type*)pitchDevPtr.ptr;
-            this->setPitch(pitchDevPtr.pitch);
+            size_t pitch = 0;
+            buffer = static_cast<Type*>(
+              DeviceMemoryPool::getInstance().allocate3D(this->getUnpaddedBytesInRow(), this->getUnitsInDim(1), this->getUnitsInDim(2), pitch));
+            this->setPitch(pitch);
 
             ALICEVISION_LOG_DEBUG("GPU 3D allocation: " << this->getUnitsInDim(0) << "x" << this->getUnitsInDim(1) << "x" << this->getUnitsInDim(2)
-                                                        << ", type size=" << sizeof(Type) << ", pitch=" << pitchDevPtr.pitch);
+                                                        << ", type size=" << sizeof(Type) << ", pitch=" << pitch);
             ALICEVISION_LOG_DEBUG("                 : "
                                   << this->getBytesUnpadded() << ", padded=" << this->getBytesPadded()
                                   << ", wasted=" << this->getBytesPadded() - this->getBytesUnpadded() << ", wasted ratio="
@@ -535,13 +510,8 @@ class CudaDeviceMemoryPitched : public CudaMemorySizeBase<Type, Dim>
         if (buffer == nullptr)
             return;
 
-        cudaError_t err = cudaFree(buffer);
-        if (err != cudaSuccess)
-        {
-            std::stringstream ss;
-            ss << "CudaDeviceMemoryPitched: Device free failed, " << cudaGetErrorString(err);
-            throw std::runtime_error(ss.str());
-        }
+        // the buffer returns to the device memory pool free list instead of being freed
+        DeviceMemoryPool::getInstance().release(buffer);
 
         buffer = nullptr;
     }
@@ -152,17 +152,18 @@ __host__ void cuda_volumeUpdateUninitializedSimilarity(const CudaDeviceMemoryPit
     CHECK_CUDA_ERROR();
 }
 
-__host__ void cuda_volumeComputeSimilarity(CudaDeviceMemoryPitched<TSim, 3>& out_volBestSim_dmp,
-                                           CudaDeviceMemoryPitched<TSim, 3>& out_volSecBestSim_dmp,
-                                           const CudaDeviceMemoryPitched<float, 2>& in_depths_dmp,
-                                           const int rcDeviceCameraParamsId,
-                                           const int tcDeviceCameraParamsId,
-                                           const DeviceMipmapImage& rcDeviceMipmapImage,
-                                           const DeviceMipmapImage& tcDeviceMipmapImage,
-                                           const SgmParams& sgmParams,
-                                           const Range& depthRange,
-                                           const ROI& roi,
-                                           cudaStream_t stream)
+template<bool TUseCustomPatchPattern>
+__host__ static void volumeComputeSimilarity_launch(CudaDeviceMemoryPitched<TSim, 3>& out_volBestSim_dmp,
+                                                    CudaDeviceMemoryPitched<TSim, 3>& out_volSecBestSim_dmp,
+                                                    const CudaDeviceMemoryPitched<float, 2>& in_depths_dmp,
+                                                    const int rcDeviceCameraParamsId,
+                                                    const int tcDeviceCameraParamsId,
+                                                    const DeviceMipmapImage& rcDeviceMipmapImage,
+                                                    const DeviceMipmapImage& tcDeviceMipmapImage,
+                                                    const SgmParams& sgmParams,
+                                                    const Range& depthRange,
+                                                    const ROI& roi,
+                                                    cudaStream_t stream)
 {
     // get mipmap images level and dimensions
     const float rcMipmapLevel = rcDeviceMipmapImage.getLevel(sgmParams.scale);
@@ -170,11 +171,11 @@ __host__ void cuda_volumeComputeSimilarity(CudaDeviceMemoryPitched<TSim, 3>& out
     const CudaSize<2> tcLevelDim = tcDeviceMipmapImage.getDimensions(sgmParams.scale);
 
     // kernel launch parameters
-    const dim3 block = getMaxPotentialBlockSize(volume_computeSimilarity_kernel);
+    const dim3 block = getMaxPotentialBlockSize(volume_computeSimilarity_kernel<TUseCustomPatchPattern>);
     const dim3 grid(divUp(roi.width(), block.x), divUp(roi.height(), block.y), depthRange.size());
 
     // kernel execution
-    volume_computeSimilarity_kernel<<<grid, block, 0, stream>>>(
+    volume_computeSimilarity_kernel<TUseCustomPatchPattern><<<grid, block, 0, stream>>>(
         out_volBestSim_dmp.getBuffer(),
         out_volBestSim_dmp.getBytesPaddedUpToDim(1),
         out_volBestSim_dmp.getBytesPaddedUpToDim(0),
@@ -197,7 +198,6 @@ __host__ void cuda_volumeComputeSimilarity(CudaDeviceMemoryPitched<TSim, 3>& out
         (1.f / float(sgmParams.gammaC)), // inverted gammaC
         (1.f / float(sgmParams.gammaP)), // inverted gammaP
         sgmParams.useConsistentScale,
-        sgmParams.useCustomPatchPattern,
         depthRange,
         roi);
 
@@ -205,17 +205,47 @@ __host__ void cuda_volumeComputeSimilarity(CudaDeviceMemoryPitched<TSim, 3>& out
     CHECK_CUDA_ERROR();
 }
 
-extern void cuda_volumeRefineSimilarity(CudaDeviceMemoryPitched<TSimRefine, 3>& inout_volSim_dmp, 
-                                        const CudaDeviceMemoryPitched<float2, 2>& in_sgmDepthPixSizeMap_dmp,
-                                        const CudaDeviceMemoryPitched<float3, 2>* in_sgmNormalMap_dmpPtr,
-                                        const int rcDeviceCameraParamsId,
-                                        const int tcDeviceCameraParamsId,
-                                        const DeviceMipmapImage& rcDeviceMipmapImage,
-                                        const DeviceMipmapImage& tcDeviceMipmapImage,
-                                        const RefineParams& refineParams, 
-                                        const Range& depthRange,
-                                        const ROI& roi,
-                                        cudaStream_t stream)
+__host__ void cuda_volumeComputeSimilarity(CudaDeviceMemoryPitched<TSim, 3>& out_volBestSim_dmp,
+                                           CudaDeviceMemoryPitched<TSim, 3>& out_volSecBestSim_dmp,
+                                           const CudaDeviceMemoryPitched<float, 2>& in_depths_dmp,
+                                           const int rcDeviceCameraParamsId,
+                                           const int tcDeviceCameraParamsId,
+                                           const DeviceMipmapImage& rcDeviceMipmapImage,
+                                           const DeviceMipmapImage& tcDeviceMipmapImage,
+                                           const SgmParams& sgmParams,
+                                           const Range& depthRange,
+                                           const ROI& roi,
+                                           cudaStream_t stream)
+{
+    // select the kernel instantiation at launch time, the pattern is uniform per launch
+    if(sgmParams.useCustomPatchPattern)
+    {
+        volumeComputeSimilarity_launch<true>(out_volBestSim_dmp, out_volSecBestSim_dmp, in_depths_dmp,
+                                             rcDeviceCameraParamsId, tcDeviceCameraParamsId,
+                                             rcDeviceMipmapImage, tcDeviceMipmapImage,
+                                             sgmParams, depthRange, roi, stream);
+    }
+    else
+    {
+        volumeComputeSimilarity_launch<false>(out_volBestSim_dmp, out_volSecBestSim_dmp, in_depths_dmp,
+                                              rcDeviceCameraParamsId, tcDeviceCameraParamsId,
+                                              rcDeviceMipmapImage, tcDeviceMipmapImage,
+                                              sgmParams, depthRange, roi, stream);
+    }
+}
+
+template<bool TUseCustomPatchPattern>
+__host__ static void volumeRefineSimilarity_launch(CudaDeviceMemoryPitched<TSimRefine, 3>& inout_volSim_dmp,
+                                                   const CudaDeviceMemoryPitched<float2, 2>& in_sgmDepthPixSizeMap_dmp,
+                                                   const CudaDeviceMemoryPitched<float3, 2>* in_sgmNormalMap_dmpPtr,
+                                                   const int rcDeviceCameraParamsId,
+                                                   const int tcDeviceCameraParamsId,
+                                                   const DeviceMipmapImage& rcDeviceMipmapImage,
+                                                   const DeviceMipmapImage& tcDeviceMipmapImage,
+                                                   const RefineParams& refineParams,
+                                                   const Range& depthRange,
+                                                   const ROI& roi,
+                                                   cudaStream_t stream)
 {
     // get mipmap images level and dimensions
     const float rcMipmapLevel = rcDeviceMipmapImage.getLevel(refineParams.scale);
@@ -223,11 +253,11 @@ extern void cuda_volumeRefineSimilarity(CudaDeviceMemoryPitched<TSimRefine, 3>&
     const CudaSize<2> tcLevelDim = tcDeviceMipmapImage.getDimensions(refineParams.scale);
 
     // kernel launch parameters
-    const dim3 block = getMaxPotentialBlockSize(volume_refineSimilarity_kernel);
+    const dim3 block = getMaxPotentialBlockSize(volume_refineSimilarity_kernel<TUseCustomPatchPattern>);
     const dim3 grid(divUp(roi.width(), block.x), divUp(roi.height(), block.y), depthRange.size());
 
     // kernel execution
-    volume_refineSimilarity_kernel<<<grid, block, 0, stream>>>(
+    volume_refineSimilarity_kernel<TUseCustomPatchPattern><<<grid, block, 0, stream>>>(
         inout_volSim_dmp.getBuffer(),
         inout_volSim_dmp.getBytesPaddedUpToDim(1),
         inout_volSim_dmp.getBytesPaddedUpToDim(0),
@@ -250,7 +280,6 @@ extern void cuda_volumeRefineSimilarity(CudaDeviceMemoryPitched<TSimRefine, 3>&
         (1.f / float(refineParams.gammaC)), // inverted gammaC
         (1.f / float(refineParams.gammaP)), // inverted gammaP
         refineParams.useConsistentScale,
-        refineParams.useCustomPatchPattern,
         depthRange,
         roi);
 
@@ -258,6 +287,35 @@ extern void cuda_volumeRefineSimilarity(CudaDeviceMemoryPitched<TSimRefine, 3>&
     CHECK_CUDA_ERROR();
 }
 
+extern void cuda_volumeRefineSimilarity(CudaDeviceMemoryPitched<TSimRefine, 3>& inout_volSim_dmp,
+                                        const CudaDeviceMemoryPitched<float2, 2>& in_sgmDepthPixSizeMap_dmp,
+                                        const CudaDeviceMemoryPitched<float3, 2>* in_sgmNormalMap_dmpPtr,
+                                        const int rcDeviceCameraParamsId,
+                                        const int tcDeviceCameraParamsId,
+                                        const DeviceMipmapImage& rcDeviceMipmapImage,
+                                        const DeviceMipmapImage& tcDeviceMipmapImage,
+                                        const RefineParams& refineParams,
+                                        const Range& depthRange,
+                                        const ROI& roi,
+                                        cudaStream_t stream)
+{
+    // select the kernel instantiation at launch time, the pattern is uniform per launch
+    if(refineParams.useCustomPatchPattern)
+    {
+        volumeRefineSimilarity_launch<true>(inout_volSim_dmp, in_sgmDepthPixSizeMap_dmp, in_sgmNormalMap_dmpPtr,
+                                            rcDeviceCameraParamsId, tcDeviceCameraParamsId,
+                                            rcDeviceMipmapImage, tcDeviceMipmapImage,
+                                            refineParams, depthRange, roi, stream);
+    }
+    else
+    {
+        volumeRefineSimilarity_launch<false>(inout_volSim_dmp, in_sgmDepthPixSizeMap_dmp, in_sgmNormalMap_dmpPtr,
+                                             rcDeviceCameraParamsId, tcDeviceCameraParamsId,
+                                             rcDeviceMipmapImage, tcDeviceMipmapImage,
+                                             refineParams, depthRange, roi, stream);
+    }
+}
+
 
 __host__ void cuda_volumeAggregatePath(CudaDeviceMemoryPitched<TSim, 3>& out_volAgr_dmp,
                                        CudaDeviceMemoryPitched<TSimAcc, 2>& inout_volSliceAccA_dmp,
@@ -106,6 +106,11 @@ __global__ void volume_updateUninitialized_kernel(TSim* inout_volume2nd_d, int i
     }
 }
 
+/**
+ * @note The patch pattern choice is a template parameter so that each instantiation
+ *       only compiles one similarity path, instead of carrying both in every thread.
+ */
+template<bool TUseCustomPatchPattern>
 __global__ void volume_computeSimilarity_kernel(TSim* out_volume1st_d, int out_volume1st_s, int out_volume1st_p,
                                                 TSim* out_volume2nd_d, int out_volume2nd_s, int out_volume2nd_p,
                                                 const float* in_depths_d, const int in_depths_p,
@@ -123,7 +128,6 @@ __global__ void volume_computeSimilarity_kernel(TSim* out_volume1st_d, int out_v
                                                 const float invGammaC,
                                                 const float invGammaP,
                                                 const bool useConsistentScale,
-                                                const bool useCustomPatchPattern,
                                                 const Range depthRange,
                                                 const ROI roi)
 {
@@ -160,7 +164,7 @@ __global__ void volume_computeSimilarity_kernel(TSim* out_volume1st_d, int out_v
     float fsim = CUDART_INF_F;
 
     // compute patch similarity
-    if(useCustomPatchPattern)
+    if(TUseCustomPatchPattern)
     {
         fsim = compNCCby3DptsYK_customPatchPattern<invertAndFilter>(rcDeviceCamParams,
                                                                     tcDeviceCamParams,
@@ -232,6 +236,11 @@ __global__ void volume_computeSimilarity_kernel(TSim* out_volume1st_d, int out_v
     }
 }
 
+/**
+ * @note The patch pattern choice is a template parameter so that each instantiation
+ *       only compiles one similarity path, instead of carrying both in every thread.
+ */
+template<bool TUseCustomPatchPattern>
 __global__ void volume_refineSimilarity_kernel(TSimRefine* inout_volSim_d, int inout_volSim_s, int inout_volSim_p,
                                                const float2* in_sgmDepthPixSizeMap_d, const int in_sgmDepthPixSizeMap_p,
                                                const float3* in_sgmNormalMap_d, const int in_sgmNormalMap_p,
@@ -250,7 +259,6 @@ __global__ void volume_refineSimilarity_kernel(TSimRefine* inout_volSim_d, int i
                                                const float invGammaC,
                                                const float invGammaP,
                                                const bool useConsistentScale,
-                                               const bool useCustomPatchPattern,
                                                const Range depthRange,
                                                const ROI roi)
 {
@@ -336,7 +344,7 @@ __global__ void volume_refineSimilarity_kernel(TSimRefine* inout_volSim_d, int i
     float fsimInvertedFiltered = CUDART_INF_F;
 
     // compute similarity
-    if(useCustomPatchPattern)
+    if(TUseCustomPatchPattern)
     {
         fsimInvertedFiltered = compNCCby3DptsYK_customPatchPattern<invertAndFilter>(rcDeviceCamParams,
                                                                                     tcDeviceCamParams,
@@ -35,9 +35,10 @@ void copyFloat2Map(image::Image<float>& out_mapX,
     out_mapY.resize(width, height);
 
     // copy image from host memory to output images
-    for (int x = 0; x < width; ++x)
+    // x is the contiguous dimension on both sides, keep it innermost
+    for (int y = 0; y < height; ++y)
     {
-        for (int y = 0; y < height; ++y)
+        for (int x = 0; x < width; ++x)
         {
             const float2& value = in_map_hmh(size_t(x), size_t(y));
             out_mapX(y, x) = value.x;
@@ -126,9 +127,9 @@ void writeFloat3Map(int rc,
     // copy map from host memory to an Image
     image::Image<image::RGBfColor> map(width, height, true, {0.f, 0.f, 0.f});
 
-    for (size_t x = 0; x < size_t(width); ++x)
+    for (size_t y = 0; y < size_t(height); ++y)
     {
-        for (size_t y = 0; y < size_t(height); ++y)
+        for (size_t x = 0; x < size_t(width); ++x)
         {
             const float3& rgba_hmh = map_hmh(x, y);
             image::RGBfColor& rgb = map(int(y), int(x));
@@ -153,9 +154,9 @@ void writeDeviceImage(const CudaDeviceMemoryPitched<CudaRGBA, 2>& in_img_dmp, co
     // copy image from host memory to an Image
     image::Image<image::RGBfColor> img(imgSize.x(), imgSize.y(), true, {0.f, 0.f, 0.f});
 
-    for (size_t x = 0; x < imgSize.x(); ++x)
+    for (size_t y = 0; y < imgSize.y(); ++y)
     {
-        for (size_t y = 0; y < imgSize.y(); ++y)
+        for (size_t x = 0; x < imgSize.x(); ++x)
         {
             const CudaRGBA& rgba_hmh = img_hmh(x, y);
             image::RGBfColor& rgb = img(int(y), int(x));
@@ -288,9 +289,9 @@ void resetDepthSimMap(CudaHostMemoryHeap<float2, 2>& inout_depthSimMap_hmh, floa
 {
     const CudaSize<2>& depthSimMapSize = inout_depthSimMap_hmh.getSize();
 
-    for (size_t x = 0; x < depthSimMapSize.x(); ++x)
+    for (size_t y = 0; y < depthSimMapSize.y(); ++y)
     {
-        for (size_t y = 0; y < depthSimMapSize.y(); ++y)
+        for (size_t x = 0; x < depthSimMapSize.x(); ++x)
         {
             float2& depthSim_hmh = inout_depthSimMap_hmh(x, y);
             depthSim_hmh.x = depth;
@@ -18,13 +18,42 @@
 #include <aliceVision/sfmDataIO/sfmDataIO.hpp>
 #include <aliceVision/depthMap/BufPtr.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <iostream>
+#include <limits>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
+#include <thread>
 
 namespace aliceVision {
 namespace depthMap {
 
+namespace {
+
+// compressed similarity volume file format identifier
+constexpr char compressedVolumeMagic[8] = {'A', 'V', 'S', 'I', 'M', 'V', 'O', 'L'};
+constexpr std::uint32_t compressedVolumeVersion = 1;
+
+template<typename T>
+void writeRaw(std::ofstream& file, const T& value)
+{
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+void readRaw(std::istream& file, T& value)
+{
+    file.read(reinterpret_cast<char*>(&value), sizeof(T));
+}
+
+}  // namespace
+
 void exportSimilaritySamplesCSV(const CudaHostMemoryHeap<TSim, 3>& in_volumeSim_hmh,
                                 const std::vector<float>& in_depths,
                                 const std::string& name,
@@ -145,6 +174,189 @@ void exportSimilaritySamplesCSV(const CudaHostMemoryHeap<TSimRefine, 3>& in_volu
         file << ss.str();
 }
 
+void exportSimilarityVolumeCompressed(const CudaHostMemoryHeap<TSim, 3>& in_volumeSim_hmh,
+                                      const std::vector<float>& in_depths,
+                                      const SgmParams& sgmParams,
+                                      int nbBits,
+                                      const std::string& filepath,
+                                      const ROI& roi)
+{
+    if (nbBits != 8 && nbBits != 16)
+        ALICEVISION_THROW_ERROR("Cannot export compressed similarity volume, unsupported quantization bit depth (nbBits: " << nbBits << ").");
+
+    const auto volDim = in_volumeSim_hmh.getSize();
+    const size_t spitch = in_volumeSim_hmh.getBytesPaddedUpToDim(1);
+    const size_t pitch = in_volumeSim_hmh.getBytesPaddedUpToDim(0);
+
+    const size_t volDimX = volDim[0];
+    const size_t volDimY = volDim[1];
+    const size_t volDimZ = in_depths.size();  // number of depths can be smaller than the allocated volume depth
+
+    std::ofstream file(filepath, std::ios::binary);
+    if (!file.is_open())
+        ALICEVISION_THROW_ERROR("Cannot create compressed similarity volume file (path: " << filepath << ").");
+
+    // write the file header
+    file.write(compressedVolumeMagic, sizeof(compressedVolumeMagic));
+    writeRaw(file, compressedVolumeVersion);
+    writeRaw(file, std::uint32_t(nbBits));
+    writeRaw(file, std::uint64_t(volDimX));
+    writeRaw(file, std::uint64_t(volDimY));
+    writeRaw(file, std::uint64_t(volDimZ));
+    writeRaw(file, std::int32_t(sgmParams.scale));
+    writeRaw(file, std::int32_t(sgmParams.stepXY));
+    writeRaw(file, std::uint32_t(roi.x.begin));
+    writeRaw(file, std::uint32_t(roi.x.end));
+    writeRaw(file, std::uint32_t(roi.y.begin));
+    writeRaw(file, std::uint32_t(roi.y.end));
+
+    // write the SGM depth list
+    for (const float depth : in_depths)
+        writeRaw(file, depth);
+
+    // write each volume slice lossy-quantized with a per-slice minimum and scale
+    const std::uint32_t maxQuantized = (nbBits == 8) ? 255u : 65535u;
+    std::vector<unsigned char> sliceData(volDimX * volDimY * (nbBits / 8));
+
+    for (size_t vz = 0; vz < volDimZ; ++vz)
+    {
+        // compute the slice similarity range
+        float simMin = std::numeric_limits<float>::max();
+        float simMax = std::numeric_limits<float>::lowest();
+
+        for (size_t vy = 0; vy < volDimY; ++vy)
+        {
+            for (size_t vx = 0; vx < volDimX; ++vx)
+            {
+                const float simValue = float(*get3DBufferAt_h<TSim>(in_volumeSim_hmh.getBuffer(), spitch, pitch, vx, vy, vz));
+                simMin = std::min(simMin, simValue);
+                simMax = std::max(simMax, simValue);
+            }
+        }
+
+        const float simScale = (simMax > simMin) ? ((simMax - simMin) / float(maxQuantized)) : 1.f;
+
+        writeRaw(file, simMin);
+        writeRaw(file, simScale);
+
+        // quantize the slice
+        for (size_t vy = 0; vy < volDimY; ++vy)
+        {
+            for (size_t vx = 0; vx < volDimX; ++vx)
+            {
+                const float simValue = float(*get3DBufferAt_h<TSim>(in_volumeSim_hmh.getBuffer(), spitch, pitch, vx, vy, vz));
+                const std::uint32_t quantized = std::uint32_t(std::lround((simValue - simMin) / simScale));
+                const size_t idx = vy * volDimX + vx;
+
+                if (nbBits == 8)
+                    sliceData[idx] = static_cast<unsigned char>(std::min(quantized, maxQuantized));
+                else
+                    reinterpret_cast<std::uint16_t*>(sliceData.data())[idx] = static_cast<std::uint16_t>(std::min(quantized, maxQuantized));
+            }
+        }
+
+        file.write(reinterpret_cast<const char*>(sliceData.data()), sliceData.size());
+    }
+
+    if (!file)
+        ALICEVISION_THROW_ERROR("Failed to write compressed similarity volume file (path: " << filepath << ").");
+}
+
+CompressedVolumeReader::CompressedVolumeReader(const std::string& filepath)
+  : _file(filepath, std::ios::binary)
+{
+    if (!_file.is_open())
+        ALICEVISION_THROW_ERROR("Cannot open compressed similarity volume file (path: " << filepath << ").");
+
+    // read and check the file header
+    char magic[8];
+    _file.read(magic, sizeof(magic));
+
+    std::uint32_t version = 0;
+    readRaw(_file, version);
+
+    if (!_file || !std::equal(std::begin(magic), std::end(magic), std::begin(compressedVolumeMagic)) || version != compressedVolumeVersion)
+        ALICEVISION_THROW_ERROR("Cannot read compressed similarity volume file, invalid header (path: " << filepath << ").");
+
+    std::uint32_t nbBits = 0;
+    readRaw(_file, nbBits);
+
+    if (nbBits != 8 && nbBits != 16)
+        ALICEVISION_THROW_ERROR("Cannot read compressed similarity volume file, unsupported quantization bit depth (path: " << filepath << ").");
+
+    _nbBits = int(nbBits);
+
+    std::uint64_t volDimX = 0, volDimY = 0, volDimZ = 0;
+    readRaw(_file, volDimX);
+    readRaw(_file, volDimY);
+    readRaw(_file, volDimZ);
+
+    _volDimX = size_t(volDimX);
+    _volDimY = size_t(volDimY);
+    _volDimZ = size_t(volDimZ);
+
+    std::int32_t scale = 0, stepXY = 0;
+    readRaw(_file, scale);
+    readRaw(_file, stepXY);
+
+    _scale = int(scale);
+    _stepXY = int(stepXY);
+
+    std::uint32_t roiBeginX = 0, roiEndX = 0, roiBeginY = 0, roiEndY = 0;
+    readRaw(_file, roiBeginX);
+    readRaw(_file, roiEndX);
+    readRaw(_file, roiBeginY);
+    readRaw(_file, roiEndY);
+
+    _roi = ROI(roiBeginX, roiEndX, roiBeginY, roiEndY);
+
+    // read the SGM depth list
+    _depths.resize(_volDimZ);
+    _file.read(reinterpret_cast<char*>(_depths.data()), _depths.size() * sizeof(float));
+
+    if (!_file)
+        ALICEVISION_THROW_ERROR("Cannot read compressed similarity volume file, truncated header (path: " << filepath << ").");
+
+    // slices have a fixed size, their offsets can be computed for random access
+    _firstSliceOffset = size_t(_file.tellg());
+    _sliceBytes = 2 * sizeof(float) + _volDimX * _volDimY * (_nbBits / 8);
+}
+
+void CompressedVolumeReader::readDepthSlice(std::vector<float>& out_slice, size_t vz)
+{
+    if (vz >= _volDimZ)
+        ALICEVISION_THROW_ERROR("Cannot read compressed similarity volume slice, invalid slice index (vz: " << vz << ", volDimZ: " << _volDimZ
+                                                                                                            << ").");
+
+    _file.seekg(_firstSliceOffset + vz * _sliceBytes);
+
+    float simMin = 0.f;
+    float simScale = 1.f;
+    readRaw(_file, simMin);
+    readRaw(_file, simScale);
+
+    std::vector<unsigned char> sliceData(_volDimX * _volDimY * (_nbBits / 8));
+    _file.read(reinterpret_cast<char*>(sliceData.data()), sliceData.size());
+
+    if (!_file)
+        ALICEVISION_THROW_ERROR("Cannot read compressed similarity volume slice, truncated file (vz: " << vz << ").");
+
+    // dequantize the slice
+    out_slice.resize(_volDimX * _volDimY);
+
+    if (_nbBits == 8)
+    {
+        for (size_t idx = 0; idx < out_slice.size(); ++idx)
+            out_slice[idx] = simMin + float(sliceData[idx]) * simScale;
+    }
+    else
+    {
+        const std::uint16_t* quantized = reinterpret_cast<const std::uint16_t*>(sliceData.data());
+        for (size_t idx = 0; idx < out_slice.size(); ++idx)
+            out_slice[idx] = simMin + float(quantized[idx]) * simScale;
+    }
+}
+
 void exportSimilarityVolume(const CudaHostMemoryHeap<TSim, 3>& in_volumeSim_hmh,
                             const std::vector<float>& in_depths,
                             const mvsUtils::MultiViewParams& mp,
@@ -501,5 +713,126 @@ void exportColorVolume(const CudaHostMemoryHeap<float4, 3>& in_volumeSim_hmh,
     sfmDataIO::save(pointCloud, filepath, sfmDataIO::ESfMData::STRUCTURE);
 }
 
+namespace {
+
+/**
+ * @brief Background writer thread for debug/QA exports.
+ *
+ * Tasks are executed in submission order on a single worker thread.
+ * The pending queue is bounded so that enabling diagnostics cannot
+ * accumulate an unbounded number of host-side volume copies.
+ */
+class DebugExportWriter
+{
+  public:
+    static DebugExportWriter& getInstance()
+    {
+        static DebugExportWriter instance;
+        return instance;
+    }
+
+    void enqueue(std::function<void()> writeTask)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+
+        if (!_worker.joinable())
+            _worker = std::thread(&DebugExportWriter::run, this);
+
+        if (_pendingTasks.size() >= maxPendingTasks)
+        {
+            // backpressure: wait for the writer to catch up
+            const auto blockedStart = std::chrono::steady_clock::now();
+            ++_nbBlockedEnqueues;
+            _taskDoneCondition.wait(lock, [&] { return _pendingTasks.size() < maxPendingTasks; });
+            _blockedTime += std::chrono::steady_clock::now() - blockedStart;
+        }
+
+        _pendingTasks.push_back(std::move(writeTask));
+        ++_nbTasks;
+        _taskPushedCondition.notify_one();
+    }
+
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+
+        if (!_worker.joinable())
+            return;
+
+        _taskDoneCondition.wait(lock, [&] { return _pendingTasks.empty() && !_taskRunning; });
+
+        ALICEVISION_LOG_INFO("Background debug export writer:" << std::endl
+                             << "\t- # exported files: " << _nbTasks << std::endl
+                             << "\t- # enqueues blocked on full queue: " << _nbBlockedEnqueues << std::endl
+                             << "\t- time blocked on full queue: "
+                             << std::chrono::duration_cast<std::chrono::milliseconds>(_blockedTime).count() << " ms");
+
+        _nbTasks = 0;
+        _nbBlockedEnqueues = 0;
+        _blockedTime = std::chrono::steady_clock::duration::zero();
+    }
+
+  private:
+    DebugExportWriter() = default;
+
+    ~DebugExportWriter()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopRequested = true;
+            _taskPushedCondition.notify_one();
+        }
+
+        if (_worker.joinable())
+            _worker.join();
+    }
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+
+        while (true)
+        {
+            _taskPushedCondition.wait(lock, [&] { return _stopRequested || !_pendingTasks.empty(); });
+
+            if (_pendingTasks.empty())  // stop requested, queue drained
+                break;
+
+            std::function<void()> writeTask = std::move(_pendingTasks.front());
+            _pendingTasks.pop_front();
+            _taskRunning = true;
+
+            lock.unlock();
+            writeTask();
+            lock.lock();
+
+            _taskRunning = false;
+            _taskDoneCondition.notify_all();
+        }
+    }
+
+    // maximum number of pending tasks, each task owns its host-side volume copy
+    static const std::size_t maxPendingTasks = 4;
+
+    std::thread _worker;
+    std::mutex _mutex;
+    std::condition_variable _taskPushedCondition;
+    std::condition_variable _taskDoneCondition;
+    std::deque<std::function<void()>> _pendingTasks;
+    bool _taskRunning = false;
+    bool _stopRequested = false;
+
+    // backpressure statistics, reset at each flush
+    std::size_t _nbTasks = 0;
+    std::size_t _nbBlockedEnqueues = 0;
+    std::chrono::steady_clock::duration _blockedTime = std::chrono::steady_clock::duration::zero();
+};
+
+}  // namespace
+
+void enqueueDebugExport(std::function<void()> writeTask) { DebugExportWriter::getInstance().enqueue(std::move(writeTask)); }
+
+void flushDebugExports() { DebugExportWriter::getInstance().flush(); }
+
 }  // namespace depthMap
 }  // namespace aliceVision
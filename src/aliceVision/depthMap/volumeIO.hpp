@@ -11,6 +11,9 @@
 #include <aliceVision/depthMap/cuda/host/memory.hpp>
 #include <aliceVision/depthMap/cuda/planeSweeping/similarity.hpp>
 
+#include <cstdint>
+#include <fstream>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -47,6 +50,87 @@ void exportSimilaritySamplesCSV(const CudaHostMemoryHeap<TSimRefine, 3>& in_volu
                                 const std::string& filepath,
                                 const ROI& roi);
 
+/**
+ * @brief Export the given similarity volume to a compressed binary file.
+ *
+ * The volume is written slice-by-slice along the depth axis, each slice lossy-quantized
+ * to 8 or 16 bits with a per-slice minimum and scale. The resulting file is 4x/2x smaller
+ * than a raw float volume and can be read back slice-by-slice with CompressedVolumeReader.
+ *
+ * @param[in] in_volumeSim_hmh the similarity in host memory
+ * @param[in] in_depths the SGM depth list
+ * @param[in] sgmParams the Semi Global Matching parameters
+ * @param[in] nbBits the quantization bit depth (8 or 16)
+ * @param[in] filepath the export filepath
+ * @param[in] roi the 2d region of interest
+ */
+void exportSimilarityVolumeCompressed(const CudaHostMemoryHeap<TSim, 3>& in_volumeSim_hmh,
+                                      const std::vector<float>& in_depths,
+                                      const SgmParams& sgmParams,
+                                      int nbBits,
+                                      const std::string& filepath,
+                                      const ROI& roi);
+
+/**
+ * @class Compressed volume reader
+ * @brief Streaming reader for similarity volumes written by exportSimilarityVolumeCompressed.
+ *
+ * Slices are dequantized on request, only one slice needs to fit in memory at a time.
+ */
+class CompressedVolumeReader
+{
+  public:
+    /**
+     * @brief CompressedVolumeReader constructor, reads the file header and the depth list.
+     * @param[in] filepath the compressed volume filepath
+     */
+    explicit CompressedVolumeReader(const std::string& filepath);
+
+    // this class handles a file stream, no copy constructor
+    CompressedVolumeReader(CompressedVolumeReader const&) = delete;
+
+    // this class handles a file stream, no copy operator
+    void operator=(CompressedVolumeReader const&) = delete;
+
+    // volume dimensions getters
+    inline size_t getVolDimX() const { return _volDimX; }
+    inline size_t getVolDimY() const { return _volDimY; }
+    inline size_t getVolDimZ() const { return _volDimZ; }
+
+    // quantization bit depth getter (8 or 16)
+    inline int getNbBits() const { return _nbBits; }
+
+    // downscale factors getters
+    inline int getScale() const { return _scale; }
+    inline int getStepXY() const { return _stepXY; }
+
+    // 2d region of interest getter
+    inline const ROI& getRoi() const { return _roi; }
+
+    // SGM depth list getter
+    inline const std::vector<float>& getDepths() const { return _depths; }
+
+    /**
+     * @brief Read and dequantize a single volume slice.
+     * @param[out] out_slice the dequantized similarity slice (row-major, volDimX * volDimY)
+     * @param[in] vz the slice index on the depth axis
+     */
+    void readDepthSlice(std::vector<float>& out_slice, size_t vz);
+
+  private:
+    std::ifstream _file;
+    std::vector<float> _depths;
+    ROI _roi;
+    size_t _volDimX = 0;
+    size_t _volDimY = 0;
+    size_t _volDimZ = 0;
+    size_t _firstSliceOffset = 0;
+    size_t _sliceBytes = 0;
+    int _nbBits = 0;
+    int _scale = 0;
+    int _stepXY = 0;
+};
+
 /**
  * @brief Export the given similarity volume to an Alembic file.
  * @param[in] in_volumeSim_hmh the similarity in host memory
@@ -151,5 +235,25 @@ void exportColorVolume(const CudaHostMemoryHeap<float4, 3>& in_volumeSim_hmh,
                        const std::string& filepath,
                        const ROI& roi);
 
+/**
+ * @brief Enqueue a debug/QA export task on the background writer thread.
+ *
+ * Intermediate volume exports are pure disk writes once the similarity volume
+ * has been copied to host memory, so they can run concurrently with the GPU
+ * pipeline. The queue is bounded: when too many tasks are pending the calling
+ * thread blocks until the writer catches up, keeping host memory usage in check.
+ *
+ * @param[in] writeTask the export task, owning the host-side buffers it writes
+ */
+void enqueueDebugExport(std::function<void()> writeTask);
+
+/**
+ * @brief Wait until every enqueued debug/QA export task has been written to disk.
+ *
+ * Should be called before destroying the objects referenced by the enqueued tasks.
+ * Logs backpressure statistics (number of tasks, time spent blocked on the full queue).
+ */
+void flushDebugExports();
+
 }  // namespace depthMap
 }  // namespace aliceVision
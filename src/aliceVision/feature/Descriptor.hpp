@@ -8,11 +8,16 @@
 #pragma once
 
 #include <aliceVision/numeric/numeric.hpp>
+#include <aliceVision/system/MemoryMappedFile.hpp>
 
+#include <cstddef>
+#include <cstring>
 #include <iostream>
 #include <iterator>
 #include <fstream>
+#include <new>
 #include <string>
+#include <type_traits>
 #include <vector>
 #include <exception>
 
@@ -119,6 +124,48 @@ inline std::istream& operator>>(std::istream& in, Descriptor<T, N>& obj)
     return obj.read(in);  // simply call the read method.
 }
 
+/**
+ * @brief Minimal STL-compatible allocator returning storage aligned on \p Alignment bytes.
+ *
+ * The default std::allocator only guarantees alignof(T), which is a single byte for
+ * unsigned char descriptors: the matchers that map the descriptor block as a flat
+ * scalar array (Eigen::Map, FLANN) then cannot rely on aligned SIMD loads.
+ */
+template<typename T, std::size_t Alignment = 64>
+class AlignedAllocator
+{
+  public:
+    typedef T value_type;
+
+    AlignedAllocator() = default;
+
+    template<typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&)
+    {}
+
+    template<typename U>
+    struct rebind
+    {
+        typedef AlignedAllocator<U, Alignment> other;
+    };
+
+    T* allocate(std::size_t n) { return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment))); }
+
+    void deallocate(T* p, std::size_t) noexcept { ::operator delete(p, std::align_val_t(Alignment)); }
+
+    bool operator==(const AlignedAllocator&) const { return true; }
+    bool operator!=(const AlignedAllocator&) const { return false; }
+};
+
+/**
+ * @brief Contiguous container for descriptors.
+ *
+ * Descriptors are stored back to back in one aligned block, so the data can be
+ * consumed zero-copy as a dense row-major matrix (one descriptor per row).
+ */
+template<typename DescriptorT>
+using DescriptorVector = std::vector<DescriptorT, AlignedAllocator<DescriptorT>>;
+
 //-- Use specialization to handle unsigned char case.
 //-- We do not want confuse unsigned char value with the spaces written in the file
 
@@ -241,12 +288,43 @@ void convertDesc(const DescFrom& descFrom, DescTo& descTo)
  *            (default value is 0 which means all descriptors).
  * @return true if everything went well
  */
-template<typename DescriptorT, typename FileDescriptorT = DescriptorT>
-inline void loadDescsFromBinFile(const std::string& sfileNameDescs, std::vector<DescriptorT>& vec_desc, bool append = false, const int Nmax = 0)
+template<typename DescriptorT, typename FileDescriptorT = DescriptorT, typename AllocatorT = std::allocator<DescriptorT>>
+inline void loadDescsFromBinFile(const std::string& sfileNameDescs,
+                                 std::vector<DescriptorT, AllocatorT>& vec_desc,
+                                 bool append = false,
+                                 const int Nmax = 0)
 {
     if (!append)  // for compatibility
         vec_desc.clear();
 
+    // Fast path: when the file layout matches the in-memory layout, map the file
+    // read-only and bulk-copy the descriptor block, so loading is page-cache bound
+    // instead of going through stream I/O and a per-descriptor conversion loop.
+    if (std::is_same<DescriptorT, FileDescriptorT>::value)
+    {
+        system::MemoryMappedFile mapping;
+        if (mapping.open(sfileNameDescs))
+        {
+            if (mapping.size() < sizeof(std::size_t))
+                throw std::runtime_error("Can't load descriptor binary file, '" + sfileNameDescs + "' is incorrect !");
+
+            std::size_t cardDesc = 0;
+            std::memcpy(&cardDesc, mapping.data(), sizeof(std::size_t));
+
+            constexpr std::size_t oneDescSize = FileDescriptorT::static_size * sizeof(typename FileDescriptorT::bin_type);
+            if (mapping.size() < sizeof(std::size_t) + cardDesc * oneDescSize)
+                throw std::runtime_error("Can't load descriptor binary file, '" + sfileNameDescs + "' is incorrect !");
+
+            const std::size_t nbDesc = (Nmax != 0) ? std::min(cardDesc, std::size_t(Nmax)) : cardDesc;
+            const std::size_t previousSize = vec_desc.size();
+            vec_desc.resize(previousSize + nbDesc);
+            if (nbDesc > 0)
+                std::memcpy(vec_desc[previousSize].getData(), mapping.data() + sizeof(std::size_t), nbDesc * oneDescSize);
+            return;
+        }
+        // fall back on stream loading when the file cannot be mapped (e.g. empty file)
+    }
+
     std::ifstream fileIn(sfileNameDescs, std::ios::in | std::ios::binary);
 
     if (!fileIn.is_open())
@@ -262,14 +340,14 @@ inline void loadDescsFromBinFile(const std::string& sfileNameDescs, std::vector<
         vec_desc.resize(vec_desc.size() + std::min((int)cardDesc, Nmax));
     else
         vec_desc.resize(vec_desc.size() + cardDesc);
-    typename std::vector<DescriptorT>::iterator begin = vec_desc.begin();
+    typename std::vector<DescriptorT, AllocatorT>::iterator begin = vec_desc.begin();
     std::advance(begin, previousSize);
 
     // Compute the memory size of one descriptor
     constexpr std::size_t oneDescSize = FileDescriptorT::static_size * sizeof(typename FileDescriptorT::bin_type);
 
     FileDescriptorT fileDescriptor;
-    for (typename std::vector<DescriptorT>::iterator iter = begin; iter != vec_desc.end(); ++iter)
+    for (typename std::vector<DescriptorT, AllocatorT>::iterator iter = begin; iter != vec_desc.end(); ++iter)
     {
         fileIn.read((char*)fileDescriptor.getData(), oneDescSize);
         convertDesc<FileDescriptorT, DescriptorT>(fileDescriptor, *iter);
@@ -19,10 +19,21 @@ typedef unsigned __int64 uint64_t;
     #include <stdint.h>
 #endif
 
-#ifdef __ARM_NEON__
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
     #include "arm_neon.h"
 #endif
 
+#if defined(__aarch64__)
+    // NEON byte popcount is baseline on aarch64, no runtime dispatch needed.
+    #define ALICEVISION_HAMMING_NEON 1
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    // Runtime-dispatched AVX-512 popcount kernel (gcc/clang only: rely on target attributes).
+    #define ALICEVISION_HAMMING_AVX512_DISPATCH 1
+    #include <immintrin.h>
+#endif
+
 // Brief:
 // Hamming distance count the number of bits in common between descriptors
 //  by using a XOR operation + a count.
@@ -71,6 +82,59 @@ static const unsigned char pop_count_LUT[256] = {
 #undef ALICEVISION_B6
 };
 
+#if defined(ALICEVISION_HAMMING_AVX512_DISPATCH)
+
+namespace optim_avx512 {
+
+/// Check once at runtime whether the AVX-512 popcount kernel can be used on this CPU.
+inline bool hasAvx512Popcnt()
+{
+    static const bool available = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vpopcntdq");
+    return available;
+}
+
+// Hamming distance over full 512-bit blocks with the VPOPCNTDQ instruction.
+__attribute__((target("avx512f,avx512vpopcntdq"))) inline unsigned int hamming_avx512(const unsigned char* a, const unsigned char* b, size_t size)
+{
+    __m512i cumSum = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 64 <= size; i += 64)
+    {
+        const __m512i srcA = _mm512_loadu_si512(a + i);
+        const __m512i srcB = _mm512_loadu_si512(b + i);
+        cumSum = _mm512_add_epi64(cumSum, _mm512_popcnt_epi64(_mm512_xor_si512(srcA, srcB)));
+    }
+    unsigned int result = static_cast<unsigned int>(_mm512_reduce_add_epi64(cumSum));
+    // Process the last 0-63 bytes (not needed for standard descriptor lengths).
+    for (; i < size; ++i)
+        result += pop_count_LUT[a[i] ^ b[i]];
+    return result;
+}
+
+}  // namespace optim_avx512
+
+#endif  // ALICEVISION_HAMMING_AVX512_DISPATCH
+
+#if defined(ALICEVISION_HAMMING_NEON)
+
+// Hamming distance on raw bytes with the NEON byte popcount, 16 bytes per iteration.
+inline unsigned int hamming_neon(const unsigned char* a, const unsigned char* b, size_t size)
+{
+    uint32x4_t cumSum = vdupq_n_u32(0);
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        const uint8x16_t count = vcntq_u8(veorq_u8(vld1q_u8(a + i), vld1q_u8(b + i)));
+        cumSum = vaddq_u32(cumSum, vpaddlq_u16(vpaddlq_u8(count)));
+    }
+    unsigned int result = vaddvq_u32(cumSum);
+    for (; i < size; ++i)
+        result += pop_count_LUT[a[i] ^ b[i]];
+    return result;
+}
+
+#endif  // ALICEVISION_HAMMING_NEON
+
 // Hamming distance to work on raw memory
 //  like unsigned char *
 template<typename T>
@@ -114,6 +178,20 @@ struct Hamming
     inline ResultType operator()(Iterator1 a, Iterator2 b, size_t size) const
     {
         ResultType result = 0;
+
+#if defined(ALICEVISION_HAMMING_AVX512_DISPATCH)
+        if (size >= 64 && optim_avx512::hasAvx512Popcnt())
+        {
+            return optim_avx512::hamming_avx512(reinterpret_cast<const unsigned char*>(a), reinterpret_cast<const unsigned char*>(b), size);
+        }
+#endif
+#if defined(ALICEVISION_HAMMING_NEON)
+        if (size >= 16)
+        {
+            return hamming_neon(reinterpret_cast<const unsigned char*>(a), reinterpret_cast<const unsigned char*>(b), size);
+        }
+#endif
+
         // Windows & generic platforms:
 
 #ifdef PLATFORM_64_BIT
@@ -169,6 +247,32 @@ struct Hamming
 #endif  // PLATFORM_64_BIT
         return result;
     }
+
+    /**
+     * @brief Distance with an early-exit bound for matcher loops.
+     * The distance is accumulated over 512-bit blocks and the computation stops as soon
+     * as the partial sum exceeds maxDistance, so rejected candidates only pay for the
+     * blocks needed to rule them out. Whenever the true distance is <= maxDistance,
+     * the exact distance is returned.
+     */
+    template<typename Iterator1, typename Iterator2>
+    inline ResultType operator()(Iterator1 a, Iterator2 b, size_t size, ResultType maxDistance) const
+    {
+        static const size_t blockSize = 64;  // bytes between two early-exit checks
+
+        ResultType result = 0;
+        size_t processed = 0;
+        while (processed + blockSize <= size)
+        {
+            result += operator()(a + processed, b + processed, blockSize);
+            if (result > maxDistance)
+                return result;
+            processed += blockSize;
+        }
+        if (processed < size)
+            result += operator()(a + processed, b + processed, size - processed);
+        return result;
+    }
 };
 
 template<typename T>
@@ -12,6 +12,10 @@
 #include <aliceVision/feature/sift/ImageDescriber_SIFT_vlfeatFloat.hpp>
 #include <aliceVision/feature/sift/ImageDescriber_DSPSIFT_vlfeat.hpp>
 #include <aliceVision/feature/akaze/ImageDescriber_AKAZE.hpp>
+
+#if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_POPSIFT)
+    #include <aliceVision/feature/sift/ImageDescriber_SIFT_popSIFT.hpp>
+#endif  // ALICEVISION_HAVE_POPSIFT
 #include <aliceVision/utils/filesIO.hpp>
 
 #if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_CCTAG)
@@ -219,6 +223,12 @@ std::unique_ptr<ImageDescriber> createImageDescriber(EImageDescriberType imageDe
             describerPtr.reset(new ImageDescriber_DSPSIFT_vlfeat(DspSiftParams(), true));
             break;
 
+#if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_POPSIFT)
+        case EImageDescriberType::SIFT_GPU:
+            describerPtr.reset(new ImageDescriber_SIFT_popSIFT(SiftParams(), true, true));
+            break;
+#endif  // ALICEVISION_HAVE_POPSIFT
+
         case EImageDescriberType::AKAZE:
             describerPtr.reset(new ImageDescriber_AKAZE(AKAZEParams(AKAZEOptions(), feature::AKAZE_MSURF)));
             break;
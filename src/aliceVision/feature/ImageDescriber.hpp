@@ -123,6 +123,7 @@ struct ConfigurationPreset
     bool gridFiltering{true};
     EFeatureConstrastFiltering contrastFiltering{EFeatureConstrastFiltering::Static};
     float relativePeakThreshold{0.02f};
+    bool parallelOctaves{false};
 
     inline ConfigurationPreset& setDescPreset(EImageDescriberPreset v)
     {
@@ -151,6 +152,12 @@ struct ConfigurationPreset
         contrastFiltering = EFeatureConstrastFiltering_stringToEnum(v);
         return *this;
     }
+
+    inline ConfigurationPreset& setParallelOctaves(bool v)
+    {
+        parallelOctaves = v;
+        return *this;
+    }
 };
 
 /**
@@ -10,11 +10,33 @@
 
 #include "aliceVision/feature/PointFeature.hpp"
 #include "aliceVision/feature/Descriptor.hpp"
+#include <aliceVision/system/MemoryMappedFile.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace aliceVision {
 namespace feature {
 
+/// Layout of the single-container file written by KeypointSet::saveToContainerFile().
+/// Both data sections start on a 64-byte boundary, so the descriptor block can be
+/// consumed in place from a read-only mapping.
+struct KeypointContainerHeader
+{
+    std::uint32_t magic = 0x504B5641;  // "AVKP"
+    std::uint32_t version = 1;
+    std::uint64_t nbFeatures = 0;
+    std::uint64_t featureByteSize = 0;  // 4 floats: x, y, scale, orientation
+    std::uint64_t nbDescriptors = 0;
+    std::uint64_t descriptorByteSize = 0;
+    std::uint64_t featuresOffset = 0;
+    std::uint64_t descriptorsOffset = 0;
+};
+
 /// Association storage of associated feature and descriptor for a given image.
 /// Load, save, R/W accessor operation.
 ///
@@ -59,6 +81,87 @@ class KeypointSet
         saveDescsToBinFile(sfileNameDescs, _descs);
     }
 
+    /// Export the feats and their corresponding descriptors in a single container file
+    /// (fixed header + 64-byte aligned binary sections), halving the file count per view.
+    void saveToContainerFile(const std::string& sfileName) const
+    {
+        static const std::size_t sectionAlignment = 64;
+
+        KeypointContainerHeader header;
+        header.nbFeatures = _feats.size();
+        header.featureByteSize = 4 * sizeof(float);
+        header.nbDescriptors = _descs.size();
+        header.descriptorByteSize = DescriptorT::static_size * sizeof(typename DescriptorT::bin_type);
+        header.featuresOffset = ((sizeof(KeypointContainerHeader) + sectionAlignment - 1) / sectionAlignment) * sectionAlignment;
+        header.descriptorsOffset =
+          ((header.featuresOffset + header.nbFeatures * header.featureByteSize + sectionAlignment - 1) / sectionAlignment) * sectionAlignment;
+
+        // pack the features as plain floats, independent of the FeatureT memory layout
+        std::vector<float> featData;
+        featData.reserve(4 * _feats.size());
+        for (const FeatureT& feat : _feats)
+        {
+            featData.push_back(feat.x());
+            featData.push_back(feat.y());
+            featData.push_back(feat.scale());
+            featData.push_back(feat.orientation());
+        }
+
+        std::ofstream file(sfileName, std::ios::out | std::ios::binary);
+        if (!file.is_open())
+            throw std::runtime_error("Can't save keypoint container file, can't open '" + sfileName + "' !");
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.seekp(header.featuresOffset);
+        file.write(reinterpret_cast<const char*>(featData.data()), featData.size() * sizeof(float));
+        file.seekp(header.descriptorsOffset);
+        for (const DescriptorT& desc : _descs)
+            file.write(reinterpret_cast<const char*>(desc.getData()), header.descriptorByteSize);
+
+        if (!file.good())
+            throw std::runtime_error("Can't save keypoint container file, '" + sfileName + "' is incorrect !");
+    }
+
+    /// Read the feats and their corresponding descriptors from a single container file
+    /// written by saveToContainerFile().
+    /// The file is mapped read-only: the descriptor block is bulk-copied straight from the
+    /// page cache and the feature section is decoded without stream I/O.
+    void loadFromContainerFile(const std::string& sfileName)
+    {
+        system::MemoryMappedFile mapping;
+        if (!mapping.open(sfileName))
+            throw std::runtime_error("Can't load keypoint container file, can't open '" + sfileName + "' !");
+
+        KeypointContainerHeader header;
+        if (mapping.size() < sizeof(header))
+            throw std::runtime_error("Can't load keypoint container file, '" + sfileName + "' is incorrect !");
+        std::memcpy(&header, mapping.data(), sizeof(header));
+
+        if (header.magic != KeypointContainerHeader().magic || header.version != KeypointContainerHeader().version ||
+            header.featureByteSize != 4 * sizeof(float) ||
+            header.descriptorByteSize != DescriptorT::static_size * sizeof(typename DescriptorT::bin_type))
+            throw std::runtime_error("Can't load keypoint container file, '" + sfileName + "' is incorrect !");
+
+        if (mapping.size() < header.featuresOffset + header.nbFeatures * header.featureByteSize ||
+            mapping.size() < header.descriptorsOffset + header.nbDescriptors * header.descriptorByteSize)
+            throw std::runtime_error("Can't load keypoint container file, '" + sfileName + "' is truncated !");
+
+        _feats.resize(header.nbFeatures);
+        const float* featData = reinterpret_cast<const float*>(mapping.data() + header.featuresOffset);
+        for (std::size_t i = 0; i < header.nbFeatures; ++i)
+        {
+            FeatureT& feat = _feats[i];
+            feat.x() = featData[4 * i + 0];
+            feat.y() = featData[4 * i + 1];
+            feat.scale() = featData[4 * i + 2];
+            feat.orientation() = featData[4 * i + 3];
+        }
+
+        _descs.resize(header.nbDescriptors);
+        if (header.nbDescriptors > 0)
+            std::memcpy(_descs[0].getData(), mapping.data() + header.descriptorsOffset, header.nbDescriptors * header.descriptorByteSize);
+    }
+
     /// Mutable and non-mutable FeatureT getters.
     inline FeaturesT& features() { return _feats; }
     inline const FeaturesT& features() const { return _feats; }
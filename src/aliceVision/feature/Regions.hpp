@@ -15,6 +15,7 @@
 
 #include <string>
 #include <cstddef>
+#include <type_traits>
 #include <typeinfo>
 #include <memory>
 
@@ -85,17 +86,21 @@ class Regions
     virtual std::string Type_id() const = 0;
     virtual std::size_t DescriptorLength() const = 0;
 
+    /// Return an estimate of the memory used by the features and descriptors (in bytes)
+    virtual std::size_t getMemoryConsumption() const = 0;
+
     /**
      * @brief Return a blind pointer to the container of the descriptors array.
      *
-     * @note: Descriptors are always stored as an std::vector<DescType>.
+     * @note: Descriptors are always stored as a DescriptorVector<DescType>.
      */
     virtual const void* blindDescriptors() const = 0;
 
     /**
      * @brief Return a pointer to the first value of the descriptor array.
      *
-     * @note: Descriptors are always stored as a flat array of descriptors.
+     * @note: Descriptors are always stored as one packed, aligned block of scalar
+     *        values, so consumers can map it as a dense matrix without any copy.
      */
     virtual const void* DescriptorRawData() const = 0;
 
@@ -147,16 +152,27 @@ class FeatDescRegions : public Regions
     typedef FeatDescRegions<T, L, regionType> This;
     /// Region descriptor
     typedef Descriptor<T, L> DescriptorT;
-    /// Container for multiple regions description
-    typedef std::vector<DescriptorT> DescsT;
+    /// Container for multiple regions description, stored as one aligned contiguous block
+    typedef DescriptorVector<DescriptorT> DescsT;
+
+    // The matchers and the vocabulary tree consume the descriptors through
+    // DescriptorRawData() as a flat scalar array, and the binary descriptor files
+    // are bulk-loaded with a single memcpy: both rely on a packed layout.
+    static_assert(std::is_trivially_copyable<DescriptorT>::value, "Descriptors must be trivially copyable");
+    static_assert(sizeof(DescriptorT) == L * sizeof(T), "Descriptors must be packed, without any padding");
 
   protected:
-    std::vector<DescriptorT> _vec_descs;  // region descriptions
+    DescsT _vec_descs;  // region descriptions
 
   public:
     std::string Type_id() const override { return typeid(T).name(); }
     std::size_t DescriptorLength() const override { return static_cast<std::size_t>(L); }
 
+    std::size_t getMemoryConsumption() const override
+    {
+        return this->_vec_feats.capacity() * sizeof(PointFeature) + _vec_descs.capacity() * sizeof(DescriptorT);
+    }
+
     bool IsScalar() const override { return regionType == ERegionType::Scalar; }
     bool IsBinary() const override { return regionType == ERegionType::Binary; }
 
@@ -179,8 +195,8 @@ class FeatDescRegions : public Regions
     void SaveDesc(const std::string& sfileNameDescs) const override { saveDescsToBinFile(sfileNameDescs, _vec_descs); }
 
     /// Mutable and non-mutable DescriptorT getters.
-    inline std::vector<DescriptorT>& Descriptors() { return _vec_descs; }
-    inline const std::vector<DescriptorT>& Descriptors() const { return _vec_descs; }
+    inline DescsT& Descriptors() { return _vec_descs; }
+    inline const DescsT& Descriptors() const { return _vec_descs; }
 
     inline const void* blindDescriptors() const override { return &_vec_descs; }
 
@@ -0,0 +1,80 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "RegionsPerViewCache.hpp"
+
+#include <aliceVision/system/Logger.hpp>
+
+namespace aliceVision {
+namespace feature {
+
+RegionsPerViewCache::RegionsPerViewCache(Loader loader, std::size_t maxMemory)
+  : _loader(std::move(loader)),
+    _maxMemory(maxMemory)
+{
+    if (!_loader)
+        ALICEVISION_THROW_ERROR("RegionsPerViewCache: no loader provided.");
+}
+
+std::shared_ptr<const Regions> RegionsPerViewCache::getRegions(IndexT viewId, EImageDescriberType descType)
+{
+    const Key key(viewId, descType);
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto it = _entries.find(key);
+        if (it != _entries.end())
+        {
+            // the entry becomes MRU
+            _lru.splice(_lru.end(), _lru, it->second.lruIt);
+            return it->second.regions;
+        }
+    }
+
+    // load outside the lock so that other views can be loaded concurrently
+    std::shared_ptr<const Regions> regions = _loader(viewId, descType);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const auto it = _entries.find(key);
+    if (it != _entries.end())
+    {
+        // another thread loaded the same view meanwhile, keep its entry
+        _lru.splice(_lru.end(), _lru, it->second.lruIt);
+        return it->second.regions;
+    }
+
+    Entry& entry = _entries[key];
+    entry.regions = regions;
+    entry.lruIt = _lru.insert(_lru.end(), key);
+    entry.memory = regions->getMemoryConsumption();
+    _contentMemory += entry.memory;
+
+    evict();
+
+    return regions;
+}
+
+void RegionsPerViewCache::evict()
+{
+    auto lruIt = _lru.begin();
+    while (_contentMemory > _maxMemory && lruIt != _lru.end())
+    {
+        const auto entryIt = _entries.find(*lruIt);
+        if (entryIt->second.regions.use_count() > 1)
+        {
+            // still referenced externally, try the next one
+            ++lruIt;
+            continue;
+        }
+        _contentMemory -= entryIt->second.memory;
+        _entries.erase(entryIt);
+        lruIt = _lru.erase(lruIt);
+    }
+}
+
+}  // namespace feature
+}  // namespace aliceVision
@@ -0,0 +1,90 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <aliceVision/types.hpp>
+#include <aliceVision/feature/Regions.hpp>
+#include <aliceVision/feature/imageDescriberCommon.hpp>
+
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace aliceVision {
+namespace feature {
+
+/**
+ * @brief Lazy-loading facade over the per-view Regions, with a memory budget.
+ *
+ * Unlike RegionsPerView, which requires the regions of every view to be resident before
+ * matching begins, this cache pulls a view's Regions through the user-provided loader on
+ * first touch and keeps them in an LRU cache. When the memory estimate exceeds the budget,
+ * the least recently used entries that are not referenced externally anymore are released,
+ * mirroring the image::ImageCache semantics: callers hold the returned shared pointer for
+ * as long as they use the regions, which pins the entry in the cache.
+ *
+ * The cache is thread-safe; the loads are performed outside the internal lock so that
+ * several views can be loaded concurrently.
+ */
+class RegionsPerViewCache
+{
+  public:
+    /// Load from disk the Regions of one view for one describer type
+    using Loader = std::function<std::unique_ptr<Regions>(IndexT viewId, EImageDescriberType descType)>;
+
+    /**
+     * @brief Create the cache.
+     * @param[in] loader The function used to load the regions of a view on first touch
+     * @param[in] maxMemory The memory budget of the cached regions (in bytes)
+     */
+    RegionsPerViewCache(Loader loader, std::size_t maxMemory);
+
+    /**
+     * @brief Retrieve the Regions of a view, loading them on first touch.
+     *
+     * The entry cannot be evicted while the caller holds the returned pointer.
+     *
+     * @param[in] viewId The view id
+     * @param[in] descType The describer type
+     * @return The regions of the view
+     */
+    std::shared_ptr<const Regions> getRegions(IndexT viewId, EImageDescriberType descType);
+
+    /// Return the memory estimate of the cached regions (in bytes)
+    std::size_t getContentMemory() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _contentMemory;
+    }
+
+  private:
+    using Key = std::pair<IndexT, EImageDescriberType>;
+
+    struct Entry
+    {
+        std::shared_ptr<const Regions> regions;
+        std::list<Key>::iterator lruIt;
+        std::size_t memory = 0;
+    };
+
+    /// Release the least recently used unreferenced entries until the budget is met.
+    /// The internal lock must be held by the caller.
+    void evict();
+
+    Loader _loader;
+    const std::size_t _maxMemory;
+    std::size_t _contentMemory = 0;
+    /// cached entries ordered from LRU (Least Recently Used) to MRU (Most Recently Used)
+    std::list<Key> _lru;
+    std::map<Key, Entry> _entries;
+    mutable std::mutex _mutex;
+};
+
+}  // namespace feature
+}  // namespace aliceVision
@@ -40,6 +40,20 @@ inline float sigma(const float sigma0, const int p, const int q, const int Q)
         return sigma0 * powf(2.f, p + static_cast<float>(q) / static_cast<float>(Q));
 }
 
+/**
+ * @brief Scratch buffers of computeAKAZESlice, reused from one slice to the next
+ * The images are only reallocated when the octave (hence the slice size) changes.
+ */
+struct AKAZESliceScratch
+{
+    /// slightly smoothed image, also reused as the diffusivity image
+    image::Image<float> smoothed;
+    /// second order spatial derivatives
+    image::Image<float> Lxx, Lyy, Lxy;
+    /// FED cycle timings
+    std::vector<float> tau;
+};
+
 /**
  * @brief Compute an AKAZE slice
  * @param[in] src Input image for the given octave
@@ -48,6 +62,7 @@ inline float sigma(const float sigma0, const int p, const int q, const int Q)
  * @param[in] nbSlice Slices per octave
  * @param[in] sigma0 First octave initial scale
  * @param[in] contrastFactor
+ * @param scratch Scratch buffers reused across the slices
  * @param Li Diffusion image
  * @param Lx X derivatives
  * @param Ly Y derivatives
@@ -59,6 +74,7 @@ void computeAKAZESlice(const image::Image<float>& src,
                        const int nbSlice,
                        const float sigma0,
                        const float contrastFactor,
+                       AKAZESliceScratch& scratch,
                        image::Image<float>& Li,
                        image::Image<float>& Lx,
                        image::Image<float>& Ly,
@@ -68,7 +84,7 @@ void computeAKAZESlice(const image::Image<float>& src,
     const float ratio = 1 << p;  // pow(2,p);
     const int sigmaScale = MathTrait<float>::round(sigmaCur * derivativeFactor / ratio);
 
-    image::Image<float> smoothed;
+    image::Image<float>& smoothed = scratch.smoothed;
 
     if (p == 0 && q == 0)
     {
@@ -77,15 +93,14 @@ void computeAKAZESlice(const image::Image<float>& src,
     }
     else
     {
-        // general case
-        image::Image<float> in;
+        // general case: diffuse directly in the evolution image to avoid a copy per slice
         if (q == 0)
         {
-            image::imageHalfSample(src, in);
+            image::imageHalfSample(src, Li);
         }
         else
         {
-            in = src;
+            Li = src;
         }
 
         const float sigmaPrev = (q == 0) ? sigma(sigma0, p - 1, nbSlice - 1, nbSlice) : sigma(sigma0, p, q - 1, nbSlice);
@@ -96,7 +111,7 @@ void computeAKAZESlice(const image::Image<float>& src,
         const float total_cycle_time = t_cur - t_prev;
 
         // compute first derivatives (Scharr scale 1, non normalized) for diffusion coef
-        image::imageGaussianFilter(in, 1.f, smoothed, 0, 0);
+        image::imageGaussianFilter(Li, 1.f, smoothed, 0, 0);
         image::imageScharrXDerivative(smoothed, Lx, false);
         image::imageScharrYDerivative(smoothed, Ly, false);
 
@@ -105,10 +120,8 @@ void computeAKAZESlice(const image::Image<float>& src,
         image::imagePeronaMalikG2DiffusionCoef(Lx, Ly, contrastFactor, diff);
 
         // compute FED cycles
-        std::vector<float> tau;
-        image::fedCycleTimings(total_cycle_time, 0.25f, tau);
-        image::imageFEDCycle(in, diff, tau);
-        Li = in;  // evolution image
+        image::fedCycleTimings(total_cycle_time, 0.25f, scratch.tau);
+        image::imageFEDCycle(Li, diff, scratch.tau);
     }
 
     // compute Hessian response
@@ -127,7 +140,9 @@ void computeAKAZESlice(const image::Image<float>& src,
     image::imageScaledScharrYDerivative(smoothed, Ly, sigmaScale);
 
     // second order spatial derivatives
-    image::Image<float> Lxx, Lyy, Lxy;
+    image::Image<float>& Lxx = scratch.Lxx;
+    image::Image<float>& Lyy = scratch.Lyy;
+    image::Image<float>& Lxy = scratch.Lxy;
     image::imageScaledScharrXDerivative(Lx, Lxx, sigmaScale);
     image::imageScaledScharrYDerivative(Lx, Lxy, sigmaScale);
     image::imageScaledScharrYDerivative(Ly, Lyy, sigmaScale);
@@ -165,7 +180,13 @@ AKAZE::AKAZE(const image::Image<float>& image, const AKAZEOptions& options)
 void AKAZE::computeScaleSpace()
 {
     float contrastFactor = computeAutomaticContrastFactor(_input, 0.7f);
-    image::Image<float> input = _input;
+
+    // reserve all the slices upfront so the input reference stays valid across emplace_back
+    _evolution.reserve(_options.nbOctaves * _options.nbSlicePerOctave);
+    const image::Image<float>* input = &_input;
+
+    // scratch buffers shared by all the slices
+    AKAZESliceScratch scratch;
 
     // octave computation
     for (int p = 0; p < _options.nbOctaves; ++p)
@@ -178,10 +199,10 @@ void AKAZE::computeScaleSpace()
             TEvolution& evo = _evolution.back();
 
             // compute Slice at (p,q) index
-            computeAKAZESlice(input, p, q, _options.nbSlicePerOctave, _options.sigma0, contrastFactor, evo.cur, evo.Lx, evo.Ly, evo.Lhess);
+            computeAKAZESlice(*input, p, q, _options.nbSlicePerOctave, _options.sigma0, contrastFactor, scratch, evo.cur, evo.Lx, evo.Ly, evo.Lhess);
 
             // Prepare inputs for next slice
-            input = evo.cur;
+            input = &evo.cur;
 
             // DEBUG octave image
 #if DEBUG_OCTAVE
@@ -22,6 +22,9 @@ std::string EImageDescriberType_informations()
            "* sift: Scale-invariant feature transform.\n"
            "* sift_float: SIFT stored as float.\n"
            "* sift_upright: SIFT with upright feature.\n"
+#if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_POPSIFT)
+           "* sift_gpu: GPU implementation of SIFT (PopSIFT), same descriptor layout as sift.\n"
+#endif
            "* akaze: A-KAZE with floating point descriptors.\n"
            "* akaze_liop: A-KAZE with Local Intensity Order Pattern descriptors.\n"
            "* akaze_mldb: A-KAZE with Modified-Local Difference Binary descriptors.\n"
@@ -55,6 +58,11 @@ std::string EImageDescriberType_enumToString(EImageDescriberType imageDescriberT
         case EImageDescriberType::DSPSIFT:
             return "dspsift";
 
+#if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_POPSIFT)
+        case EImageDescriberType::SIFT_GPU:
+            return "sift_gpu";
+#endif
+
         case EImageDescriberType::AKAZE:
             return "akaze";
         case EImageDescriberType::AKAZE_LIOP:
@@ -106,6 +114,11 @@ EImageDescriberType EImageDescriberType_stringToEnum(const std::string& imageDes
     if (type == "dspsift")
         return EImageDescriberType::DSPSIFT;
 
+#if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_POPSIFT)
+    if (type == "sift_gpu")
+        return EImageDescriberType::SIFT_GPU;
+#endif
+
     if (type == "akaze")
         return EImageDescriberType::AKAZE;
     if (type == "akaze_liop")
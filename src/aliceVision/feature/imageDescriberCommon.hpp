@@ -25,6 +25,11 @@ enum class EImageDescriberType : unsigned char
     SIFT_UPRIGHT = 12,
     DSPSIFT = 13
 
+#if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_POPSIFT)
+    ,
+    SIFT_GPU = 14
+#endif
+
     ,
     AKAZE = 20,
     AKAZE_LIOP = 21,
@@ -108,6 +113,9 @@ inline float getStrongSupportCoeff(EImageDescriberType imageDescriberType)
         case EImageDescriberType::SIFT_FLOAT:
         case EImageDescriberType::SIFT_UPRIGHT:
         case EImageDescriberType::DSPSIFT:
+#if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_POPSIFT)
+        case EImageDescriberType::SIFT_GPU:
+#endif
         case EImageDescriberType::AKAZE:
         case EImageDescriberType::AKAZE_LIOP:
         case EImageDescriberType::AKAZE_MLDB:
@@ -15,6 +15,11 @@
 #if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_SSE)
     #include <aliceVision/system/Logger.hpp>
     #include <xmmintrin.h>
+    #if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        // Runtime-dispatched AVX2 kernels (gcc/clang only: rely on target attributes).
+        #define ALICEVISION_METRIC_AVX2_DISPATCH 1
+        #include <immintrin.h>
+    #endif
 #endif
 
 #include <cstddef>
@@ -123,6 +128,77 @@ inline float l2_sse(const float* b1, const float* b2, int size)
 }
 }  // namespace optim_ss2
 
+#if defined(ALICEVISION_METRIC_AVX2_DISPATCH)
+
+namespace optim_avx2 {
+
+/// Check once at runtime whether AVX2 kernels can be used on this CPU.
+inline bool hasAvx2()
+{
+    static const bool available = __builtin_cpu_supports("avx2");
+    return available;
+}
+
+// Euclidean distance (AVX2 method) (squared result) on float vector
+__attribute__((target("avx2"))) inline float l2_avx2(const float* b1, const float* b2, int size)
+{
+    __m256 cumSum = _mm256_setzero_ps();
+    int i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        const __m256 srcA = _mm256_loadu_ps(b1 + i);
+        const __m256 srcB = _mm256_loadu_ps(b2 + i);
+        const __m256 diff = _mm256_sub_ps(srcA, srcB);
+        cumSum = _mm256_add_ps(cumSum, _mm256_mul_ps(diff, diff));
+    }
+    __m128 sum4 = _mm_add_ps(_mm256_castps256_ps128(cumSum), _mm256_extractf128_ps(cumSum, 1));
+    sum4 = _mm_add_ps(sum4, _mm_movehl_ps(sum4, sum4));
+    sum4 = _mm_add_ss(sum4, _mm_shuffle_ps(sum4, sum4, 1));
+    float result = _mm_cvtss_f32(sum4);
+    // Process the last 0-7 components (not needed for standard descriptor lengths).
+    for (; i < size; ++i)
+    {
+        const float diff = b1[i] - b2[i];
+        result += diff * diff;
+    }
+    return result;
+}
+
+// Euclidean distance (AVX2 method) (squared result) on unsigned char vector
+// (e.g. quantized SIFT descriptors): 32 components per iteration, widened to
+// 16 bits so the squared differences can be accumulated with _mm256_madd_epi16.
+__attribute__((target("avx2"))) inline int l2_avx2(const unsigned char* b1, const unsigned char* b2, int size)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i cumSum = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        const __m256i srcA = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b1 + i));
+        const __m256i srcB = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b2 + i));
+        // Absolute difference on unsigned bytes via saturated subtractions.
+        const __m256i diff = _mm256_or_si256(_mm256_subs_epu8(srcA, srcB), _mm256_subs_epu8(srcB, srcA));
+        const __m256i lo = _mm256_unpacklo_epi8(diff, zero);
+        const __m256i hi = _mm256_unpackhi_epi8(diff, zero);
+        cumSum = _mm256_add_epi32(cumSum, _mm256_madd_epi16(lo, lo));
+        cumSum = _mm256_add_epi32(cumSum, _mm256_madd_epi16(hi, hi));
+    }
+    __m128i sum4 = _mm_add_epi32(_mm256_castsi256_si128(cumSum), _mm256_extracti128_si256(cumSum, 1));
+    sum4 = _mm_add_epi32(sum4, _mm_srli_si128(sum4, 8));
+    sum4 = _mm_add_epi32(sum4, _mm_srli_si128(sum4, 4));
+    int result = _mm_cvtsi128_si32(sum4);
+    for (; i < size; ++i)
+    {
+        const int diff = int(b1[i]) - int(b2[i]);
+        result += diff * diff;
+    }
+    return result;
+}
+
+}  // namespace optim_avx2
+
+#endif  // ALICEVISION_METRIC_AVX2_DISPATCH
+
 // Template specification to run SSE L2 squared distance
 //  on float vector
 template<>
@@ -134,10 +210,58 @@ struct L2_Vectorized<float>
     template<typename Iterator1, typename Iterator2>
     inline ResultType operator()(Iterator1 a, Iterator2 b, size_t size) const
     {
+#if defined(ALICEVISION_METRIC_AVX2_DISPATCH)
+        if (optim_avx2::hasAvx2())
+            return optim_avx2::l2_avx2(&(*a), &(*b), static_cast<int>(size));
+#endif
         return optim_ss2::l2_sse(a, b, size);
     }
 };
 
+#if defined(ALICEVISION_METRIC_AVX2_DISPATCH)
+
+// Template specification to run AVX2 L2 squared distance
+//  on unsigned char vector (quantized descriptors)
+template<>
+struct L2_Vectorized<unsigned char>
+{
+    typedef unsigned char ElementType;
+    typedef Accumulator<unsigned char>::Type ResultType;
+
+    template<typename Iterator1, typename Iterator2>
+    inline ResultType operator()(Iterator1 a, Iterator2 b, size_t size) const
+    {
+        if (optim_avx2::hasAvx2())
+            return static_cast<ResultType>(optim_avx2::l2_avx2(&(*a), &(*b), static_cast<int>(size)));
+
+        ResultType result = ResultType();
+        ResultType diff0, diff1, diff2, diff3;
+        Iterator1 last = a + size;
+        Iterator1 lastgroup = last - 3;
+
+        // Process 4 items with each loop for efficiency.
+        while (a < lastgroup)
+        {
+            diff0 = a[0] - b[0];
+            diff1 = a[1] - b[1];
+            diff2 = a[2] - b[2];
+            diff3 = a[3] - b[3];
+            result += diff0 * diff0 + diff1 * diff1 + diff2 * diff2 + diff3 * diff3;
+            a += 4;
+            b += 4;
+        }
+        // Process last 0-3 components.  Not needed for standard vector lengths.
+        while (a < last)
+        {
+            diff0 = *a++ - *b++;
+            result += diff0 * diff0;
+        }
+        return result;
+    }
+};
+
+#endif  // ALICEVISION_METRIC_AVX2_DISPATCH
+
 #endif  // ALICEVISION_HAVE_SSE
 
 }  // namespace feature
@@ -19,23 +19,33 @@
 namespace aliceVision {
 namespace feature {
 
-std::unique_ptr<PopSift> ImageDescriber_SIFT_popSIFT::_popSift{nullptr};
+std::map<int, std::unique_ptr<PopSift>> ImageDescriber_SIFT_popSIFT::_popSiftPerDevice;
+std::mutex ImageDescriber_SIFT_popSIFT::_popSiftMutex;
 std::atomic<int> ImageDescriber_SIFT_popSIFT::_instanceCounter{0};
 
 void ImageDescriber_SIFT_popSIFT::setConfigurationPreset(ConfigurationPreset preset)
 {
     _params.setPreset(preset);
-    _popSift.reset(nullptr);  // reset by describe method
+    std::lock_guard<std::mutex> lock(_popSiftMutex);
+    _popSiftPerDevice.clear();  // re-created by describe method
+}
+
+PopSift& ImageDescriber_SIFT_popSIFT::getPopSiftOnDevice()
+{
+    std::lock_guard<std::mutex> lock(_popSiftMutex);
+    std::unique_ptr<PopSift>& popSift = _popSiftPerDevice[_cudaPipe];
+    if (popSift == nullptr)
+        resetConfiguration();
+    return *_popSiftPerDevice.at(_cudaPipe);
 }
 
 bool ImageDescriber_SIFT_popSIFT::describe(const image::Image<float>& image,
                                            std::unique_ptr<Regions>& regions,
                                            const image::Image<unsigned char>* mask)
 {
-    if (_popSift == nullptr)
-        resetConfiguration();
+    PopSift& popSift = getPopSiftOnDevice();
 
-    std::unique_ptr<SiftJob> job(_popSift->enqueue(image.width(), image.height(), &image(0, 0)));
+    std::unique_ptr<SiftJob> job(popSift.enqueue(image.width(), image.height(), &image(0, 0)));
     std::unique_ptr<popsift::Features> popFeatures(job->get());
 
     allocate(regions);
@@ -73,12 +83,13 @@ bool ImageDescriber_SIFT_popSIFT::describe(const image::Image<float>& image,
 
 void ImageDescriber_SIFT_popSIFT::resetConfiguration()
 {
-    // destroy all allocations and reset all state
-    // on the current device in the current process
+    // select the requested device, then destroy all allocations
+    // and reset all state on it in the current process
+    cudaSetDevice(_cudaPipe);
     cudaDeviceReset();
 
     popsift::cuda::device_prop_t deviceInfo;
-    deviceInfo.set(0, true);  // use only the first device & print information
+    deviceInfo.set(_cudaPipe, true);  // use the selected device & print information
 
     // reset configuration
     popsift::Config config;
@@ -91,13 +102,14 @@ void ImageDescriber_SIFT_popSIFT::resetConfiguration()
     config.setFilterMaxExtrema(_params._maxTotalKeypoints);
     config.setFilterSorting(popsift::Config::LargestScaleFirst);
 
-    _popSift.reset(new PopSift(config, popsift::Config::ExtractingMode, PopSift::FloatImages));
+    _popSiftPerDevice[_cudaPipe].reset(new PopSift(config, popsift::Config::ExtractingMode, PopSift::FloatImages));
 }
 
-ImageDescriber_SIFT_popSIFT::ImageDescriber_SIFT_popSIFT(const SiftParams& params, bool isOriented)
+ImageDescriber_SIFT_popSIFT::ImageDescriber_SIFT_popSIFT(const SiftParams& params, bool isOriented, bool asGpuDescriberType)
   : ImageDescriber(),
     _params(params),
-    _isOriented(isOriented)
+    _isOriented(isOriented),
+    _asGpuDescriberType(asGpuDescriberType)
 {
     _instanceCounter++;
 }
@@ -108,7 +120,8 @@ ImageDescriber_SIFT_popSIFT::~ImageDescriber_SIFT_popSIFT()
 
     if (_instanceCounter.load() == 0)
     {
-        _popSift.reset(nullptr);
+        std::lock_guard<std::mutex> lock(_popSiftMutex);
+        _popSiftPerDevice.clear();
     }
 }
 
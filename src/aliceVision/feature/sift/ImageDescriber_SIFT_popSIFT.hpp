@@ -12,7 +12,11 @@
 #include <aliceVision/feature/regionsFactory.hpp>
 #include <aliceVision/feature/sift/SIFT.hpp>
 
+#include <atomic>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <numeric>
 
 class PopSift;
@@ -26,7 +30,13 @@ namespace feature {
 class ImageDescriber_SIFT_popSIFT : public ImageDescriber
 {
   public:
-    explicit ImageDescriber_SIFT_popSIFT(const SiftParams& params = SiftParams(), bool isOriented = true);
+    /**
+     * @param[in] params The SIFT parameters
+     * @param[in] isOriented Compute feature orientations
+     * @param[in] asGpuDescriberType Report SIFT_GPU as describer type instead of SIFT/SIFT_UPRIGHT,
+     *            when the GPU backend is selected explicitly (the descriptor layout is the same).
+     */
+    explicit ImageDescriber_SIFT_popSIFT(const SiftParams& params = SiftParams(), bool isOriented = true, bool asGpuDescriberType = false);
 
     /**
      * @brief Check if the image describer use CUDA
@@ -46,6 +56,8 @@ class ImageDescriber_SIFT_popSIFT : public ImageDescriber
      */
     EImageDescriberType getDescriberType() const override
     {
+        if (_asGpuDescriberType)
+            return EImageDescriberType::SIFT_GPU;
         if (!_isOriented)
             return EImageDescriberType::SIFT_UPRIGHT;
         return EImageDescriberType::SIFT;
@@ -76,6 +88,12 @@ class ImageDescriber_SIFT_popSIFT : public ImageDescriber
      */
     void setConfigurationPreset(ConfigurationPreset preset) override;
 
+    /**
+     * @brief Select the CUDA device running the extraction, one PopSift instance is kept per device
+     * @param[in] pipe The CUDA device id
+     */
+    void setCudaPipe(int pipe) override { _cudaPipe = pipe; }
+
     /**
      * @brief Detect regions on the 8-bit image and compute their attributes (description)
      * @param[in] image Image.
@@ -98,11 +116,17 @@ class ImageDescriber_SIFT_popSIFT : public ImageDescriber
     ~ImageDescriber_SIFT_popSIFT() override;
 
   private:
+    /// get (or create) the PopSift instance of the current CUDA device
+    PopSift& getPopSiftOnDevice();
     void resetConfiguration();
 
     SiftParams _params;
     bool _isOriented = true;
-    static std::unique_ptr<PopSift> _popSift;
+    bool _asGpuDescriberType = false;
+    int _cudaPipe = 0;
+    /// one PopSift instance per CUDA device, shared by all the describer instances
+    static std::map<int, std::unique_ptr<PopSift>> _popSiftPerDevice;
+    static std::mutex _popSiftMutex;
     static std::atomic<int> _instanceCounter;
 };
 
@@ -89,6 +89,7 @@ void SiftParams::setPreset(ConfigurationPreset preset)
         _gridSize = 0;
     }
     _contrastFiltering = preset.contrastFiltering;
+    _parallelOctaves = preset.parallelOctaves;
 }
 
 std::size_t getMemoryConsumptionVLFeat(std::size_t width, std::size_t height, const SiftParams& params)
@@ -136,6 +137,224 @@ void VLFeatInstance::destroy()
         vl_destructor();
 }
 
+namespace {
+
+/**
+ * @brief Detect the keypoints of the current octave of the given filter,
+ * compute their descriptors and append them to the given regions.
+ */
+template<typename T>
+void extractOctaveKeypoints(VlSiftFilt* filt,
+                            const SiftParams& params,
+                            bool orientation,
+                            const image::Image<unsigned char>* mask,
+                            int w,
+                            int h,
+                            ScalarRegions<T, 128>& regions,
+                            std::vector<float>& featuresPeakValue)
+{
+    size_t maxOctaveKeypoints = params._maxTotalKeypoints;
+
+    vl_sift_detect(filt);
+
+    VlSiftKeypoint const* keys = vl_sift_get_keypoints(filt);
+    const int nkeys = vl_sift_get_nkeypoints(filt);
+
+    std::vector<IndexT> filteredKeypointsIndex;
+
+    // TODO: should we reduce maxOctaveKeypoints per octave?
+
+    // grid filtering at the octave level
+    if (params._gridSize && params._maxTotalKeypoints &&
+        (params._contrastFiltering == EFeatureConstrastFiltering::GridSort ||
+         params._contrastFiltering == EFeatureConstrastFiltering::GridSortScaleSteps ||
+         params._contrastFiltering == EFeatureConstrastFiltering::GridSortOctaves))
+    {
+        // Only filter features if we have more features than the maxTotalKeypoints
+        if (nkeys > maxOctaveKeypoints)
+        {
+            // Sorting the extracted features according to their dog value (peak threshold)
+            std::vector<std::size_t> keysIndexSort(nkeys);
+            std::iota(keysIndexSort.begin(), keysIndexSort.end(), 0);
+
+            if (params._contrastFiltering == EFeatureConstrastFiltering::GridSortScaleSteps)
+            {
+                std::sort(keysIndexSort.begin(), keysIndexSort.end(), [&](std::size_t a, std::size_t b) {
+                    const int scaleA = int(log2(keys[a].sigma) * 3.0f);  // 3 scale steps per octave
+                    const int scaleB = int(log2(keys[b].sigma) * 3.0f);
+                    if (scaleA == scaleB)
+                    {
+                        // sort by peak value, when we are in the same scale
+                        return keys[a].peak_value > keys[b].peak_value;
+                    }
+                    return scaleA > scaleB;
+                });
+            }
+            else if (params._contrastFiltering == EFeatureConstrastFiltering::GridSortOctaveSteps)
+            {
+                std::sort(keysIndexSort.begin(), keysIndexSort.end(), [&](std::size_t a, std::size_t b) {
+                    const int scaleA = int(log2(keys[a].sigma));  // 3 scale steps per octave
+                    const int scaleB = int(log2(keys[b].sigma));
+                    if (scaleA == scaleB)
+                    {
+                        // sort by peak value, when we are in the same scale
+                        return keys[a].peak_value > keys[b].peak_value;
+                    }
+                    return scaleA > scaleB;
+                });
+            }
+            else if (params._contrastFiltering == EFeatureConstrastFiltering::GridSort)
+            {
+                std::sort(keysIndexSort.begin(), keysIndexSort.end(), [&](std::size_t a, std::size_t b) {
+                    return keys[a].sigma * keys[a].peak_value > keys[b].sigma * keys[b].peak_value;
+                });
+            }
+            else  // GridSortOctaves
+            {
+                // sort from largest peaks to smallest ones
+                std::sort(keysIndexSort.begin(), keysIndexSort.end(), [&](std::size_t a, std::size_t b) {
+                    return keys[a].peak_value > keys[b].peak_value;
+                });
+            }
+
+            std::vector<IndexT> rejected_indexes;
+            filteredKeypointsIndex.reserve(maxOctaveKeypoints);
+            rejected_indexes.reserve(nkeys);
+
+            const std::size_t sizeMat = params._gridSize * params._gridSize;
+            std::vector<std::size_t> countFeatPerCell(sizeMat, 0);
+            for (int idx = 0; idx < sizeMat; ++idx)
+            {
+                countFeatPerCell[idx] = 0;
+            }
+            const std::size_t keypointsPerCell = params._maxTotalKeypoints / sizeMat;
+            const double regionWidth = w / double(params._gridSize);
+            const double regionHeight = h / double(params._gridSize);
+
+            for (IndexT ii = 0; ii < nkeys; ++ii)
+            {
+                const IndexT i = keysIndexSort[ii];  // use sorted keypoints
+                const auto& keypoint = keys[i];
+
+                const std::size_t cellX = std::min(std::size_t(keypoint.x / regionWidth), params._gridSize);
+                const std::size_t cellY = std::min(std::size_t(keypoint.y / regionHeight), params._gridSize);
+
+                std::size_t& count = countFeatPerCell[cellX * params._gridSize + cellY];
+                ++count;
+
+                if (count < keypointsPerCell)
+                    filteredKeypointsIndex.push_back(i);
+                else
+                    rejected_indexes.push_back(i);
+            }
+            // If we don't have enough features (less than maxTotalKeypoints) after the grid filtering (empty
+            // regions in the grid for example). We add the best other ones, without repartition constraint.
+            if (filteredKeypointsIndex.size() < params._maxTotalKeypoints && !rejected_indexes.empty())
+            {
+                const std::size_t remainingElements =
+                  std::min(rejected_indexes.size(), params._maxTotalKeypoints - filteredKeypointsIndex.size());
+                ALICEVISION_LOG_TRACE("Octave Grid filtering -- Copy remaining points: " << remainingElements);
+                filteredKeypointsIndex.insert(
+                  filteredKeypointsIndex.end(), rejected_indexes.begin(), rejected_indexes.begin() + remainingElements);
+            }
+
+            ALICEVISION_LOG_TRACE("Octave SIFT keypoints:\n"
+                                  << " * detected: " << nkeys << "\n"
+                                  << " * max octave keypoints: " << maxOctaveKeypoints << "\n"
+                                  << " * after grid filtering: " << filteredKeypointsIndex.size());
+        }
+    }
+    else if (params._maxTotalKeypoints && params._contrastFiltering == EFeatureConstrastFiltering::NonExtremaFiltering)
+    {
+        std::vector<float> radiusMaxima(nkeys, std::numeric_limits<float>::max());
+        for (IndexT i = 0; i < nkeys; ++i)
+        {
+            const auto& keypointI = keys[i];
+            for (IndexT j = 0; j < nkeys; ++j)
+            {
+                const auto& keypointJ = keys[j];
+                if (keypointJ.peak_value > keypointI.peak_value)
+                {
+                    const float dx = (keypointJ.x - keypointI.x);
+                    const float dy = (keypointJ.y - keypointI.y);
+                    const float radius = dx * dx + dy * dy;
+                    if (radius < radiusMaxima[i])
+                        radiusMaxima[i] = radius;
+                }
+            }
+        }
+        filteredKeypointsIndex.resize(nkeys);
+        std::iota(filteredKeypointsIndex.begin(), filteredKeypointsIndex.end(), 0);
+        const std::size_t maxKeypoints = std::min(params._maxTotalKeypoints, std::size_t(nkeys));
+        std::partial_sort(filteredKeypointsIndex.begin(),
+                          filteredKeypointsIndex.begin() + maxKeypoints,
+                          filteredKeypointsIndex.end(),
+                          [&](int a, int b) { return radiusMaxima[a] * keys[a].sigma > radiusMaxima[b] * keys[b].sigma; });
+        filteredKeypointsIndex.resize(maxKeypoints);
+    }
+
+    if (filteredKeypointsIndex.empty())
+    {
+        ALICEVISION_LOG_TRACE("Octave SIFT nb keypoints:\n" << nkeys << " (no grid filtering)");
+        filteredKeypointsIndex.resize(nkeys);
+        std::iota(filteredKeypointsIndex.begin(), filteredKeypointsIndex.end(), 0);
+    }
+
+    // Update gradient before launching parallel extraction
+    vl_sift_update_gradient(filt);
+
+    // Feature masking
+    if (mask)
+    {
+        std::vector<IndexT> newFilteredKeypointsIndex;
+        const image::Image<unsigned char>& maskIma = *mask;
+
+        for (int ii = 0; ii < filteredKeypointsIndex.size(); ++ii)
+        {
+            const int i = filteredKeypointsIndex[ii];
+            if (maskIma(keys[i].y, keys[i].x) > 0)
+                continue;
+            newFilteredKeypointsIndex.push_back(i);
+        }
+        filteredKeypointsIndex.swap(newFilteredKeypointsIndex);
+    }
+
+    std::vector<std::vector<double>> anglesPerKeypoint(filteredKeypointsIndex.size());
+
+#pragma omp parallel for
+    for (int ii = 0; ii < filteredKeypointsIndex.size(); ++ii)
+    {
+        const int i = filteredKeypointsIndex[ii];
+
+        double angles[4] = {0.0, 0.0, 0.0, 0.0};
+        int nangles = 1;  // by default (1 upright feature)
+        if (orientation)
+        {  // compute from 1 to 4 orientations
+            nangles = vl_sift_calc_keypoint_orientations(filt, angles, keys + i);
+        }
+
+        Descriptor<vl_sift_pix, 128> vlFeatDescriptor;
+        Descriptor<T, 128> descriptor;
+
+        for (int q = 0; q < nangles; ++q)
+        {
+            const PointFeature fp(keys[i].x, keys[i].y, keys[i].sigma, static_cast<float>(angles[q]));
+
+            vl_sift_calc_keypoint_descriptor(filt, &vlFeatDescriptor[0], keys + i, angles[q]);
+            convertSIFT<T>(&vlFeatDescriptor[0], descriptor, params._rootSift);
+
+#pragma omp critical
+            {
+                regions.Descriptors().push_back(descriptor);
+                regions.Features().push_back(fp);
+                featuresPeakValue.push_back(keys[i].peak_value);
+            }
+        }
+    }
+}
+
+}  // namespace
+
 template<typename T>
 bool extractSIFT(const image::Image<float>& image,
                  std::unique_ptr<Regions>& regions,
@@ -144,22 +363,17 @@ bool extractSIFT(const image::Image<float>& image,
                  const image::Image<unsigned char>* mask)
 {
     const int w = image.width(), h = image.height();
-    const int numOctaves = -1;  // auto
     // if image resolution is low, increase resolution for extraction
     const int firstOctave = params.getImageFirstOctave(w, h);
-    VlSiftFilt* filt = vl_sift_new(w, h, numOctaves, params._numScales, firstOctave);
-    if (params._edgeThreshold >= 0)
-        vl_sift_set_edge_thresh(filt, params._edgeThreshold);
 
+    // resolve the contrast threshold once, it is shared by all the octave filters
+    float peakThreshold = -1.f;
     switch (params._contrastFiltering)
     {
         case EFeatureConstrastFiltering::Static:
         {
             ALICEVISION_LOG_TRACE("SIFT constrastTreshold Static: " << params._peakThreshold);
-            if (params._peakThreshold >= 0)
-            {
-                vl_sift_set_peak_thresh(filt, params._peakThreshold / params._numScales);
-            }
+            peakThreshold = params._peakThreshold;
             break;
         }
         case EFeatureConstrastFiltering::AdaptiveToMedianVariance:
@@ -171,7 +385,7 @@ bool extractSIFT(const image::Image<float>& image,
                                   << " - relativePeakThreshold: " << relativePeakThreshold << "\n"
                                   << " - medianOfGradiants: " << medianOfGradiants << "\n"
                                   << " - peakTreshold: " << dynPeakTreshold);
-            vl_sift_set_peak_thresh(filt, dynPeakTreshold / params._numScales);
+            peakThreshold = dynPeakTreshold;
             break;
         }
         case EFeatureConstrastFiltering::NoFiltering:
@@ -186,9 +400,6 @@ bool extractSIFT(const image::Image<float>& image,
         }
     }
 
-    // Process SIFT computation
-    vl_sift_process_first_octave(filt, image.data());
-
     using SIFT_Region_T = ScalarRegions<T, 128>;
     SIFT_Region_T* regionsCasted = new SIFT_Region_T();
     regions.reset(regionsCasted);
@@ -201,211 +412,64 @@ bool extractSIFT(const image::Image<float>& image,
     std::vector<float> featuresPeakValue;
     featuresPeakValue.reserve(reserveSize);
 
-    size_t maxOctaveKeypoints = params._maxTotalKeypoints;
-
-    while (true)
+    if (params._parallelOctaves)
     {
-        vl_sift_detect(filt);
-
-        VlSiftKeypoint const* keys = vl_sift_get_keypoints(filt);
-        const int nkeys = vl_sift_get_nkeypoints(filt);
-
-        std::vector<IndexT> filteredKeypointsIndex;
-
-        // TODO: should we reduce maxOctaveKeypoints per octave?
-
-        // grid filtering at the octave level
-        if (params._gridSize && params._maxTotalKeypoints &&
-            (params._contrastFiltering == EFeatureConstrastFiltering::GridSort ||
-             params._contrastFiltering == EFeatureConstrastFiltering::GridSortScaleSteps ||
-             params._contrastFiltering == EFeatureConstrastFiltering::GridSortOctaves))
+        // Octave-parallel extraction: each octave is processed concurrently by its own
+        // single-octave filter, seeded by decimating the input image as vlfeat does for
+        // a positive first octave. The seeding slightly differs from the sequential
+        // Gaussian cascade, which may marginally change the detections in the upper
+        // octaves, but it makes the octaves independent and lowers the per-image latency.
+        // Same octave count as vl_sift_new() with automatic numOctaves.
+        const int numOctaves = std::max(int(std::floor(std::log2(std::min(w, h))) - firstOctave - 3), 1);
+
+        std::vector<SIFT_Region_T> octaveRegions(numOctaves);
+        std::vector<std::vector<float>> octavePeakValues(numOctaves);
+
+#pragma omp parallel for schedule(dynamic)
+        for (int octave = 0; octave < numOctaves; ++octave)
         {
-            // Only filter features if we have more features than the maxTotalKeypoints
-            if (nkeys > maxOctaveKeypoints)
-            {
-                // Sorting the extracted features according to their dog value (peak threshold)
-                std::vector<std::size_t> keysIndexSort(nkeys);
-                std::iota(keysIndexSort.begin(), keysIndexSort.end(), 0);
-
-                if (params._contrastFiltering == EFeatureConstrastFiltering::GridSortScaleSteps)
-                {
-                    std::sort(keysIndexSort.begin(), keysIndexSort.end(), [&](std::size_t a, std::size_t b) {
-                        const int scaleA = int(log2(keys[a].sigma) * 3.0f);  // 3 scale steps per octave
-                        const int scaleB = int(log2(keys[b].sigma) * 3.0f);
-                        if (scaleA == scaleB)
-                        {
-                            // sort by peak value, when we are in the same scale
-                            return keys[a].peak_value > keys[b].peak_value;
-                        }
-                        return scaleA > scaleB;
-                    });
-                }
-                else if (params._contrastFiltering == EFeatureConstrastFiltering::GridSortOctaveSteps)
-                {
-                    std::sort(keysIndexSort.begin(), keysIndexSort.end(), [&](std::size_t a, std::size_t b) {
-                        const int scaleA = int(log2(keys[a].sigma));  // 3 scale steps per octave
-                        const int scaleB = int(log2(keys[b].sigma));
-                        if (scaleA == scaleB)
-                        {
-                            // sort by peak value, when we are in the same scale
-                            return keys[a].peak_value > keys[b].peak_value;
-                        }
-                        return scaleA > scaleB;
-                    });
-                }
-                else if (params._contrastFiltering == EFeatureConstrastFiltering::GridSort)
-                {
-                    std::sort(keysIndexSort.begin(), keysIndexSort.end(), [&](std::size_t a, std::size_t b) {
-                        return keys[a].sigma * keys[a].peak_value > keys[b].sigma * keys[b].peak_value;
-                    });
-                }
-                else  // GridSortOctaves
-                {
-                    // sort from largest peaks to smallest ones
-                    std::sort(keysIndexSort.begin(), keysIndexSort.end(), [&](std::size_t a, std::size_t b) {
-                        return keys[a].peak_value > keys[b].peak_value;
-                    });
-                }
-
-                std::vector<IndexT> rejected_indexes;
-                filteredKeypointsIndex.reserve(maxOctaveKeypoints);
-                rejected_indexes.reserve(nkeys);
-
-                const std::size_t sizeMat = params._gridSize * params._gridSize;
-                std::vector<std::size_t> countFeatPerCell(sizeMat, 0);
-                for (int idx = 0; idx < sizeMat; ++idx)
-                {
-                    countFeatPerCell[idx] = 0;
-                }
-                const std::size_t keypointsPerCell = params._maxTotalKeypoints / sizeMat;
-                const double regionWidth = w / double(params._gridSize);
-                const double regionHeight = h / double(params._gridSize);
-
-                for (IndexT ii = 0; ii < nkeys; ++ii)
-                {
-                    const IndexT i = keysIndexSort[ii];  // use sorted keypoints
-                    const auto& keypoint = keys[i];
-
-                    const std::size_t cellX = std::min(std::size_t(keypoint.x / regionWidth), params._gridSize);
-                    const std::size_t cellY = std::min(std::size_t(keypoint.y / regionHeight), params._gridSize);
-
-                    std::size_t& count = countFeatPerCell[cellX * params._gridSize + cellY];
-                    ++count;
-
-                    if (count < keypointsPerCell)
-                        filteredKeypointsIndex.push_back(i);
-                    else
-                        rejected_indexes.push_back(i);
-                }
-                // If we don't have enough features (less than maxTotalKeypoints) after the grid filtering (empty
-                // regions in the grid for example). We add the best other ones, without repartition constraint.
-                if (filteredKeypointsIndex.size() < params._maxTotalKeypoints && !rejected_indexes.empty())
-                {
-                    const std::size_t remainingElements =
-                      std::min(rejected_indexes.size(), params._maxTotalKeypoints - filteredKeypointsIndex.size());
-                    ALICEVISION_LOG_TRACE("Octave Grid filtering -- Copy remaining points: " << remainingElements);
-                    filteredKeypointsIndex.insert(
-                      filteredKeypointsIndex.end(), rejected_indexes.begin(), rejected_indexes.begin() + remainingElements);
-                }
-
-                ALICEVISION_LOG_TRACE("Octave SIFT keypoints:\n"
-                                      << " * detected: " << nkeys << "\n"
-                                      << " * max octave keypoints: " << maxOctaveKeypoints << "\n"
-                                      << " * after grid filtering: " << filteredKeypointsIndex.size());
-            }
-        }
-        else if (params._maxTotalKeypoints && params._contrastFiltering == EFeatureConstrastFiltering::NonExtremaFiltering)
-        {
-            std::vector<float> radiusMaxima(nkeys, std::numeric_limits<float>::max());
-            for (IndexT i = 0; i < nkeys; ++i)
-            {
-                const auto& keypointI = keys[i];
-                for (IndexT j = 0; j < nkeys; ++j)
-                {
-                    const auto& keypointJ = keys[j];
-                    if (keypointJ.peak_value > keypointI.peak_value)
-                    {
-                        const float dx = (keypointJ.x - keypointI.x);
-                        const float dy = (keypointJ.y - keypointI.y);
-                        const float radius = dx * dx + dy * dy;
-                        if (radius < radiusMaxima[i])
-                            radiusMaxima[i] = radius;
-                    }
-                }
-            }
-            filteredKeypointsIndex.resize(nkeys);
-            std::iota(filteredKeypointsIndex.begin(), filteredKeypointsIndex.end(), 0);
-            const std::size_t maxKeypoints = std::min(params._maxTotalKeypoints, std::size_t(nkeys));
-            std::partial_sort(filteredKeypointsIndex.begin(),
-                              filteredKeypointsIndex.begin() + maxKeypoints,
-                              filteredKeypointsIndex.end(),
-                              [&](int a, int b) { return radiusMaxima[a] * keys[a].sigma > radiusMaxima[b] * keys[b].sigma; });
-            filteredKeypointsIndex.resize(maxKeypoints);
+            VlSiftFilt* filt = vl_sift_new(w, h, 1, params._numScales, firstOctave + octave);
+            if (params._edgeThreshold >= 0)
+                vl_sift_set_edge_thresh(filt, params._edgeThreshold);
+            if (peakThreshold >= 0)
+                vl_sift_set_peak_thresh(filt, peakThreshold / params._numScales);
+
+            if (vl_sift_process_first_octave(filt, image.data()) != VL_ERR_EOF)
+                extractOctaveKeypoints(filt, params, orientation, mask, w, h, octaveRegions[octave], octavePeakValues[octave]);
+            vl_sift_delete(filt);
         }
 
-        if (filteredKeypointsIndex.empty())
+        // merge the per-octave outputs in octave order
+        for (int octave = 0; octave < numOctaves; ++octave)
         {
-            ALICEVISION_LOG_TRACE("Octave SIFT nb keypoints:\n" << nkeys << " (no grid filtering)");
-            filteredKeypointsIndex.resize(nkeys);
-            std::iota(filteredKeypointsIndex.begin(), filteredKeypointsIndex.end(), 0);
-        }
-
-        // Update gradient before launching parallel extraction
-        vl_sift_update_gradient(filt);
-
-        // Feature masking
-        if (mask)
-        {
-            std::vector<IndexT> newFilteredKeypointsIndex;
-            const image::Image<unsigned char>& maskIma = *mask;
-
-            for (int ii = 0; ii < filteredKeypointsIndex.size(); ++ii)
-            {
-                const int i = filteredKeypointsIndex[ii];
-                if (maskIma(keys[i].y, keys[i].x) > 0)
-                    continue;
-                newFilteredKeypointsIndex.push_back(i);
-            }
-            filteredKeypointsIndex.swap(newFilteredKeypointsIndex);
+            regionsCasted->Features().insert(
+              regionsCasted->Features().end(), octaveRegions[octave].Features().begin(), octaveRegions[octave].Features().end());
+            regionsCasted->Descriptors().insert(
+              regionsCasted->Descriptors().end(), octaveRegions[octave].Descriptors().begin(), octaveRegions[octave].Descriptors().end());
+            featuresPeakValue.insert(featuresPeakValue.end(), octavePeakValues[octave].begin(), octavePeakValues[octave].end());
         }
+    }
+    else
+    {
+        const int numOctaves = -1;  // auto
+        VlSiftFilt* filt = vl_sift_new(w, h, numOctaves, params._numScales, firstOctave);
+        if (params._edgeThreshold >= 0)
+            vl_sift_set_edge_thresh(filt, params._edgeThreshold);
+        if (peakThreshold >= 0)
+            vl_sift_set_peak_thresh(filt, peakThreshold / params._numScales);
 
-        std::vector<std::vector<double>> anglesPerKeypoint(filteredKeypointsIndex.size());
+        // Process SIFT computation
+        vl_sift_process_first_octave(filt, image.data());
 
-#pragma omp parallel for
-        for (int ii = 0; ii < filteredKeypointsIndex.size(); ++ii)
+        while (true)
         {
-            const int i = filteredKeypointsIndex[ii];
-
-            double angles[4] = {0.0, 0.0, 0.0, 0.0};
-            int nangles = 1;  // by default (1 upright feature)
-            if (orientation)
-            {  // compute from 1 to 4 orientations
-                nangles = vl_sift_calc_keypoint_orientations(filt, angles, keys + i);
-            }
+            extractOctaveKeypoints(filt, params, orientation, mask, w, h, *regionsCasted, featuresPeakValue);
 
-            Descriptor<vl_sift_pix, 128> vlFeatDescriptor;
-            Descriptor<T, 128> descriptor;
-
-            for (int q = 0; q < nangles; ++q)
-            {
-                const PointFeature fp(keys[i].x, keys[i].y, keys[i].sigma, static_cast<float>(angles[q]));
-
-                vl_sift_calc_keypoint_descriptor(filt, &vlFeatDescriptor[0], keys + i, angles[q]);
-                convertSIFT<T>(&vlFeatDescriptor[0], descriptor, params._rootSift);
-
-#pragma omp critical
-                {
-                    regionsCasted->Descriptors().push_back(descriptor);
-                    regionsCasted->Features().push_back(fp);
-                    featuresPeakValue.push_back(keys[i].peak_value);
-                }
-            }
+            if (vl_sift_process_next_octave(filt))
+                break;  // Last octave
         }
-
-        if (vl_sift_process_next_octave(filt))
-            break;  // Last octave
+        vl_sift_delete(filt);
     }
-    vl_sift_delete(filt);
 
     assert(regionsCasted->Features().size() == regionsCasted->Descriptors().size());
 
@@ -453,7 +517,7 @@ bool extractSIFT(const image::Image<float>& image,
         }
 
         std::vector<PointFeature> sortedFeatures(features.size());
-        std::vector<typename SIFT_Region_T::DescriptorT> sortedDescriptors(features.size());
+        typename SIFT_Region_T::DescsT sortedDescriptors(features.size());
         std::vector<float> sortedFeaturesPeakValue(features.size());
         for (std::size_t i : indexSort)
         {
@@ -500,7 +564,7 @@ bool extractSIFT(const image::Image<float>& image,
             indexSort.resize(std::min(params._maxTotalKeypoints, features.size()));
 
             std::vector<PointFeature> filteredFeatures(indexSort.size());
-            std::vector<typename SIFT_Region_T::DescriptorT> filteredDescriptors(indexSort.size());
+            typename SIFT_Region_T::DescsT filteredDescriptors(indexSort.size());
             for (IndexT i = 0; i < indexSort.size(); ++i)
             {
                 filteredFeatures[i] = features[indexSort[i]];
@@ -555,7 +619,7 @@ bool extractSIFT(const image::Image<float>& image,
             }
 
             std::vector<PointFeature> filteredFeatures(filteredIndexes.size());
-            std::vector<typename SIFT_Region_T::DescriptorT> filteredDescriptors(filteredIndexes.size());
+            typename SIFT_Region_T::DescsT filteredDescriptors(filteredIndexes.size());
             for (IndexT i = 0; i < filteredIndexes.size(); ++i)
             {
                 filteredFeatures[i] = features[filteredIndexes[i]];
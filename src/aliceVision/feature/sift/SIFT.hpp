@@ -50,6 +50,9 @@ struct SiftParams
     std::size_t _maxTotalKeypoints = 10000;
     /// see [1]
     bool _rootSift = true;
+    /// Process the octaves concurrently to lower the per-image latency,
+    /// at the cost of a slightly different seeding of the upper octaves.
+    bool _parallelOctaves = false;
 
     virtual void setPreset(ConfigurationPreset preset);
 
@@ -0,0 +1,156 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "DescriberMemoryCalibration.hpp"
+
+#include <aliceVision/system/Logger.hpp>
+
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace pt = boost::property_tree;
+
+namespace aliceVision {
+namespace featureEngine {
+
+std::size_t DescriberMemoryProfile::predict(std::size_t width, std::size_t height) const
+{
+    const double pixels = double(width) * double(height);
+    return std::size_t(std::max(0.0, bytesPerPixel * pixels + constantBytes));
+}
+
+void DescriberMemoryCalibration::addSample(feature::EImageDescriberType describerType, std::size_t nbPixels, std::size_t peakBytes)
+{
+    _samples[describerType].emplace_back(double(nbPixels), double(peakBytes));
+}
+
+void DescriberMemoryCalibration::fit()
+{
+    for (const auto& describerSamples : _samples)
+    {
+        const std::vector<std::pair<double, double>>& samples = describerSamples.second;
+        if (samples.empty())
+            continue;
+
+        DescriberMemoryProfile profile;
+        profile.nbSamples = samples.size();
+
+        double meanPixels = 0.0;
+        double meanBytes = 0.0;
+        for (const auto& sample : samples)
+        {
+            meanPixels += sample.first;
+            meanBytes += sample.second;
+        }
+        meanPixels /= samples.size();
+        meanBytes /= samples.size();
+
+        double covariance = 0.0;
+        double variance = 0.0;
+        for (const auto& sample : samples)
+        {
+            covariance += (sample.first - meanPixels) * (sample.second - meanBytes);
+            variance += (sample.first - meanPixels) * (sample.first - meanPixels);
+        }
+
+        if (variance > 0.0)
+        {
+            // least squares fit of bytes = bytesPerPixel * pixels + constantBytes
+            profile.bytesPerPixel = covariance / variance;
+            profile.constantBytes = meanBytes - profile.bytesPerPixel * meanPixels;
+        }
+        else
+        {
+            // all the samples have the same size: fall back to a proportional model
+            profile.bytesPerPixel = meanBytes / meanPixels;
+            profile.constantBytes = 0.0;
+        }
+
+        // raise the intercept to the largest positive residual, so the model bounds
+        // every measurement from above instead of splitting them
+        double maxResidual = 0.0;
+        for (const auto& sample : samples)
+            maxResidual = std::max(maxResidual, sample.second - (profile.bytesPerPixel * sample.first + profile.constantBytes));
+        profile.constantBytes += maxResidual;
+
+        _profiles[describerSamples.first] = profile;
+    }
+}
+
+const DescriberMemoryProfile* DescriberMemoryCalibration::getProfile(feature::EImageDescriberType describerType) const
+{
+    const auto it = _profiles.find(describerType);
+    return (it == _profiles.end()) ? nullptr : &it->second;
+}
+
+bool DescriberMemoryCalibration::load(const std::string& filename)
+{
+    pt::ptree tree;
+    try
+    {
+        pt::read_json(filename, tree);
+    }
+    catch (const std::exception& e)
+    {
+        ALICEVISION_LOG_WARNING("Cannot read the describer memory calibration file '" << filename << "': " << e.what());
+        return false;
+    }
+
+    _profiles.clear();
+    for (const auto& describerNode : tree.get_child("describers", pt::ptree()))
+    {
+        feature::EImageDescriberType describerType;
+        try
+        {
+            describerType = feature::EImageDescriberType_stringToEnum(describerNode.first);
+        }
+        catch (const std::exception&)
+        {
+            ALICEVISION_LOG_WARNING("Unknown describer type '" << describerNode.first << "' in calibration file '" << filename << "', skipped.");
+            continue;
+        }
+
+        DescriberMemoryProfile profile;
+        profile.bytesPerPixel = describerNode.second.get<double>("bytesPerPixel", 0.0);
+        profile.constantBytes = describerNode.second.get<double>("constantBytes", 0.0);
+        profile.nbSamples = describerNode.second.get<std::size_t>("nbSamples", 0);
+        _profiles[describerType] = profile;
+    }
+    return !_profiles.empty();
+}
+
+bool DescriberMemoryCalibration::save(const std::string& filename) const
+{
+    pt::ptree describersTree;
+    for (const auto& describerProfile : _profiles)
+    {
+        pt::ptree profileTree;
+        profileTree.put("bytesPerPixel", describerProfile.second.bytesPerPixel);
+        profileTree.put("constantBytes", describerProfile.second.constantBytes);
+        profileTree.put("nbSamples", describerProfile.second.nbSamples);
+        describersTree.add_child(feature::EImageDescriberType_enumToString(describerProfile.first), profileTree);
+    }
+
+    pt::ptree tree;
+    tree.add_child("describers", describersTree);
+
+    try
+    {
+        pt::write_json(filename, tree);
+    }
+    catch (const std::exception& e)
+    {
+        ALICEVISION_LOG_WARNING("Cannot write the describer memory calibration file '" << filename << "': " << e.what());
+        return false;
+    }
+    return true;
+}
+
+}  // namespace featureEngine
+}  // namespace aliceVision
@@ -0,0 +1,93 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <aliceVision/feature/imageDescriberCommon.hpp>
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace aliceVision {
+namespace featureEngine {
+
+/**
+ * @brief Measured memory profile of one image describer.
+ * The profile is a linear model of the peak memory in bytes as a function of the
+ * number of input pixels, fitted from per-job peak RSS measurements.
+ */
+struct DescriberMemoryProfile
+{
+    /// slope of the fitted model (bytes per input pixel)
+    double bytesPerPixel = 0.0;
+    /// intercept of the fitted model (bytes)
+    double constantBytes = 0.0;
+    /// number of measurements behind the fit
+    std::size_t nbSamples = 0;
+
+    /// predicted peak memory in bytes for an image of the given size
+    std::size_t predict(std::size_t width, std::size_t height) const;
+};
+
+/**
+ * @brief Measured per-describer memory profiles used by the feature extraction scheduler.
+ *
+ * The analytical ImageDescriber::getMemoryConsumption() estimates can be badly off for
+ * some describers, which makes the scheduler over-reserve memory and under-fill the
+ * machine. This class records the actual peak resident memory of calibration jobs,
+ * fits one linear model per describer and persists the models to a file, so later
+ * runs can schedule with measured numbers instead of analytical ones.
+ */
+class DescriberMemoryCalibration
+{
+  public:
+    /**
+     * @brief Record one peak memory measurement for a describer.
+     * @param[in] describerType The measured image describer
+     * @param[in] nbPixels Number of pixels of the input image
+     * @param[in] peakBytes Measured peak resident memory of the extraction, in bytes
+     */
+    void addSample(feature::EImageDescriberType describerType, std::size_t nbPixels, std::size_t peakBytes);
+
+    /**
+     * @brief Fit one linear model per describer from the recorded samples.
+     * The intercept is raised so that the model is an upper envelope of the samples:
+     * the scheduler needs a bound, not an average.
+     */
+    void fit();
+
+    /// the fitted profile of a describer, nullptr when it has not been calibrated
+    const DescriberMemoryProfile* getProfile(feature::EImageDescriberType describerType) const;
+
+    /// true when no profile is available
+    bool empty() const { return _profiles.empty(); }
+
+    /**
+     * @brief Load the profiles from a calibration file.
+     * @param[in] filename The calibration file path
+     * @return false if the file cannot be read
+     */
+    bool load(const std::string& filename);
+
+    /**
+     * @brief Save the fitted profiles to a calibration file.
+     * @param[in] filename The calibration file path
+     * @return false if the file cannot be written
+     */
+    bool save(const std::string& filename) const;
+
+  private:
+    /// fitted profile per describer
+    std::map<feature::EImageDescriberType, DescriberMemoryProfile> _profiles;
+    /// recorded measurements per describer: <nbPixels, peakBytes>
+    std::map<feature::EImageDescriberType, std::vector<std::pair<double, double>>> _samples;
+};
+
+}  // namespace featureEngine
+}  // namespace aliceVision
@@ -5,12 +5,20 @@
 // You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include "FeatureExtractor.hpp"
+#include <aliceVision/gpu/gpu.hpp>
 #include <aliceVision/image/io.hpp>
+#include <aliceVision/system/MemoryGovernor.hpp>
 #include <aliceVision/system/MemoryInfo.hpp>
 #include <aliceVision/alicevision_omp.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
 #include <iomanip>
+#include <mutex>
+#include <thread>
 
 namespace fs = std::filesystem;
 
@@ -24,7 +32,28 @@ FeatureExtractorViewJob::FeatureExtractorViewJob(const sfmData::View& view, cons
 
 FeatureExtractorViewJob::~FeatureExtractorViewJob() = default;
 
-void FeatureExtractorViewJob::setImageDescribers(const std::vector<std::shared_ptr<feature::ImageDescriber>>& imageDescribers)
+namespace {
+
+/// memory estimate of one describer job: the measured profile when available,
+/// the analytical estimate of the describer otherwise
+std::size_t describerMemoryEstimate(const feature::ImageDescriber& imageDescriber,
+                                    std::size_t width,
+                                    std::size_t height,
+                                    const DescriberMemoryCalibration* memoryCalibration)
+{
+    if (memoryCalibration != nullptr)
+    {
+        const DescriberMemoryProfile* profile = memoryCalibration->getProfile(imageDescriber.getDescriberType());
+        if (profile != nullptr)
+            return profile->predict(width, height);
+    }
+    return imageDescriber.getMemoryConsumption(width, height);
+}
+
+}  // namespace
+
+void FeatureExtractorViewJob::setImageDescribers(const std::vector<std::shared_ptr<feature::ImageDescriber>>& imageDescribers,
+                                                 const DescriberMemoryCalibration* memoryCalibration)
 {
     for (std::size_t i = 0; i < imageDescribers.size(); ++i)
     {
@@ -36,7 +65,7 @@ void FeatureExtractorViewJob::setImageDescribers(const std::vector<std::shared_p
             continue;
         }
 
-        _memoryConsuption += imageDescriber->getMemoryConsumption(_view.getImage().getWidth(), _view.getImage().getHeight());
+        _memoryConsuption += describerMemoryEstimate(*imageDescriber, _view.getImage().getWidth(), _view.getImage().getHeight(), memoryCalibration);
 
         if (imageDescriber->useCuda())
             _gpuImageDescriberIndexes.push_back(i);
@@ -45,6 +74,16 @@ void FeatureExtractorViewJob::setImageDescribers(const std::vector<std::shared_p
     }
 }
 
+void FeatureExtractorViewJob::updateMemoryConsumption(const std::vector<std::shared_ptr<feature::ImageDescriber>>& imageDescribers,
+                                                      const DescriberMemoryCalibration& memoryCalibration)
+{
+    _memoryConsuption = 0;
+    for (const std::vector<std::size_t>* indexes : {&_cpuImageDescriberIndexes, &_gpuImageDescriberIndexes})
+        for (std::size_t i : *indexes)
+            _memoryConsuption +=
+              describerMemoryEstimate(*imageDescribers.at(i), _view.getImage().getWidth(), _view.getImage().getHeight(), &memoryCalibration);
+}
+
 FeatureExtractor::FeatureExtractor(const sfmData::SfMData& sfmData)
   : _sfmData(sfmData)
 {}
@@ -68,6 +107,10 @@ void FeatureExtractor::process(const HardwareContext& hContext, const image::EIm
         std::advance(itViewEnd, _rangeSize);
     }
 
+    // measured describer memory profiles from a previous calibration run
+    if (!_memoryCalibrationFile.empty() && fs::exists(_memoryCalibrationFile) && _memoryCalibration.load(_memoryCalibrationFile))
+        ALICEVISION_LOG_INFO("Describer memory profiles loaded from '" << _memoryCalibrationFile << "'.");
+
     std::size_t jobMaxMemoryConsuption = 0;
 
     std::vector<FeatureExtractorViewJob> cpuJobs;
@@ -78,7 +121,7 @@ void FeatureExtractor::process(const HardwareContext& hContext, const image::EIm
         const sfmData::View& view = *(it->second.get());
         FeatureExtractorViewJob viewJob(view, _outputFolder);
 
-        viewJob.setImageDescribers(_imageDescribers);
+        viewJob.setImageDescribers(_imageDescribers, _memoryCalibration.empty() ? nullptr : &_memoryCalibration);
         jobMaxMemoryConsuption = std::max(jobMaxMemoryConsuption, viewJob.memoryConsuption());
 
         if (viewJob.useCPU())
@@ -88,6 +131,34 @@ void FeatureExtractor::process(const HardwareContext& hContext, const image::EIm
             gpuJobs.push_back(viewJob);
     }
 
+    // calibration run: measure the actual peak memory of the first jobs, fit and persist
+    // the per-describer models, then reschedule the remaining jobs with measured numbers
+    if (!_memoryCalibrationFile.empty() && _memoryCalibration.empty() && !cpuJobs.empty())
+    {
+        const std::size_t nbCalibrationJobs = std::min<std::size_t>(4, cpuJobs.size());
+        ALICEVISION_LOG_INFO("Describer memory calibration: measuring the peak memory of " << nbCalibrationJobs << " jobs.");
+
+        for (std::size_t i = 0; i < nbCalibrationJobs; ++i)
+        {
+            DecodedViewJob decoded;
+            decodeViewJob(cpuJobs.at(i), workingColorSpace, decoded);
+            describeDecodedJob(decoded, false, &_memoryCalibration);
+        }
+
+        _memoryCalibration.fit();
+        if (_memoryCalibration.save(_memoryCalibrationFile))
+            ALICEVISION_LOG_INFO("Describer memory profiles written to '" << _memoryCalibrationFile << "'.");
+
+        // the calibration jobs are already extracted, schedule the others with the measured profiles
+        cpuJobs.erase(cpuJobs.begin(), cpuJobs.begin() + nbCalibrationJobs);
+        jobMaxMemoryConsuption = 0;
+        for (FeatureExtractorViewJob& job : cpuJobs)
+        {
+            job.updateMemoryConsumption(_imageDescribers, _memoryCalibration);
+            jobMaxMemoryConsuption = std::max(jobMaxMemoryConsuption, job.memoryConsuption());
+        }
+    }
+
     if (!cpuJobs.empty())
     {
         system::MemoryInfo memoryInformation = system::getMemoryInfo();
@@ -148,43 +219,156 @@ void FeatureExtractor::process(const HardwareContext& hContext, const image::EIm
         ALICEVISION_LOG_INFO("# threads for extraction: " << nbThreads);
         omp_set_nested(1);
 
-#pragma omp parallel for num_threads(nbThreads)
-        for (int i = 0; i < cpuJobs.size(); ++i)
-            computeViewJob(cpuJobs.at(i), false, workingColorSpace);
+        // Two-stage pipeline: a decode pool reads and prepares the next images while the
+        // compute pool runs the describers on the already decoded ones, so the image
+        // decoding and the feature extraction overlap instead of alternating.
+        // The decoded images waiting for a compute thread are admitted under a byte
+        // budget taken on the memory left over by the extraction jobs themselves.
+        const std::size_t computeMemory = nbThreads * jobMaxMemoryConsuption;
+        const std::size_t usableMemory = std::size_t(0.9 * maxMemory);
+        const std::size_t decodeBudget = (usableMemory > computeMemory) ? (usableMemory - computeMemory) : 0;
+
+        const std::size_t nbDecodeThreads = std::max(std::size_t(1), std::min(std::size_t(4), nbThreads));
+        ALICEVISION_LOG_INFO("# threads for image decoding: " << nbDecodeThreads << " (prefetch budget: " << decodeBudget / (1024 * 1024)
+                                                              << " MB)");
+
+        std::deque<DecodedViewJob> decodedQueue;
+        std::size_t queuedBytes = 0;
+        std::size_t nbActiveDecoders = nbDecodeThreads;
+        std::atomic<std::size_t> nextJobIndex(0);
+        std::mutex mutex;
+        std::condition_variable decoderCond;
+        std::condition_variable computeCond;
+
+        // runtime governor: the startup snapshot does not hold when other jobs share the
+        // node, so the admission also checks the memory actually available right now,
+        // with the compute pool consumption accounted as reserved
+        system::MemoryGovernor memoryGovernor(computeMemory);
+
+        const auto decodeLoop = [&]() {
+            while (true)
+            {
+                const std::size_t i = nextJobIndex++;
+                if (i >= cpuJobs.size())
+                    break;
+
+                const FeatureExtractorViewJob& job = cpuJobs.at(i);
+                const std::size_t jobBytes = job.decodedMemoryConsuption();
+
+                {
+                    // admission: wait until the decoded image fits in both the byte budget and
+                    // the memory currently available on the host
+                    // (an empty queue always admits one, so the pipeline degrades to a single
+                    // in-flight image under memory pressure instead of dying)
+                    std::unique_lock<std::mutex> lock(mutex);
+                    const auto admit = [&]() {
+                        if (queuedBytes == 0)
+                            return true;
+                        if (queuedBytes + jobBytes > decodeBudget)
+                            return false;
+                        return !memoryGovernor.underPressure() && (queuedBytes + jobBytes <= memoryGovernor.availableBytes());
+                    };
+                    // wait with a timeout: the governor's view changes with the load of the
+                    // whole node, not only with our own notifications
+                    while (!admit())
+                        decoderCond.wait_for(lock, std::chrono::milliseconds(500));
+                    queuedBytes += jobBytes;
+                }
+
+                DecodedViewJob decoded;
+                decoded.reservedBytes = jobBytes;
+                decodeViewJob(job, workingColorSpace, decoded);
+
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    decodedQueue.push_back(std::move(decoded));
+                }
+                computeCond.notify_one();
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                --nbActiveDecoders;
+            }
+            computeCond.notify_all();
+        };
+
+        const auto computeLoop = [&]() {
+            while (true)
+            {
+                DecodedViewJob decoded;
+
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    computeCond.wait(lock, [&]() { return !decodedQueue.empty() || nbActiveDecoders == 0; });
+
+                    if (decodedQueue.empty())
+                        break;
+
+                    decoded = std::move(decodedQueue.front());
+                    decodedQueue.pop_front();
+                    queuedBytes -= decoded.reservedBytes;
+                }
+                decoderCond.notify_one();
+
+                describeDecodedJob(decoded, false);
+            }
+        };
+
+        std::vector<std::thread> pool;
+        pool.reserve(nbDecodeThreads + nbThreads);
+        for (std::size_t i = 0; i < nbDecodeThreads; ++i)
+            pool.emplace_back(decodeLoop);
+        for (std::size_t i = 0; i < nbThreads; ++i)
+            pool.emplace_back(computeLoop);
+        for (std::thread& thread : pool)
+            thread.join();
     }
 
     if (!gpuJobs.empty())
     {
+        // distribute the GPU jobs over the available CUDA devices in round-robin
+        const int nbCudaDevices = std::max(1, gpu::gpuDeviceCount());
+
+        if (nbCudaDevices > 1)
+            ALICEVISION_LOG_INFO("# CUDA devices for extraction: " << nbCudaDevices);
+
+        std::size_t gpuJobIndex = 0;
         for (const auto& job : gpuJobs)
+        {
+            if (nbCudaDevices > 1)
+            {
+                const int cudaDevice = int(gpuJobIndex % nbCudaDevices);
+                for (const auto& imageDescriberIndex : job.imageDescriberIndexes(true))
+                    _imageDescribers.at(imageDescriberIndex)->setCudaPipe(cudaDevice);
+            }
             computeViewJob(job, true, workingColorSpace);
+            ++gpuJobIndex;
+        }
     }
 }
 
-void FeatureExtractor::computeViewJob(const FeatureExtractorViewJob& job, bool useGPU, const image::EImageColorSpace workingColorSpace)
+void FeatureExtractor::decodeViewJob(const FeatureExtractorViewJob& job, const image::EImageColorSpace workingColorSpace, DecodedViewJob& decoded) const
 {
-    image::Image<float> imageGrayFloat;
-    image::Image<unsigned char> imageGrayUChar;
-    image::Image<unsigned char> mask;
+    decoded.job = &job;
 
-    
+    image::readImage(job.view().getImage().getImagePath(), decoded.imageGrayFloat, workingColorSpace);
 
-    image::readImage(job.view().getImage().getImagePath(), imageGrayFloat, workingColorSpace);
+    decoded.pixelRatio = 1.0;
+    job.view().getImage().getDoubleMetadata({"PixelAspectRatio"}, decoded.pixelRatio);
 
-    double pixelRatio = 1.0;
-    job.view().getImage().getDoubleMetadata({"PixelAspectRatio"}, pixelRatio);
-
-    if (pixelRatio != 1.0)
+    if (decoded.pixelRatio != 1.0)
     {
         // Resample input image in order to work with square pixels
-        const int w = imageGrayFloat.width();
-        const int h = imageGrayFloat.height();
+        const int w = decoded.imageGrayFloat.width();
+        const int h = decoded.imageGrayFloat.height();
 
-        const int nw = static_cast<int>(static_cast<double>(w) * pixelRatio);
+        const int nw = static_cast<int>(static_cast<double>(w) * decoded.pixelRatio);
         const int nh = h;
 
         image::Image<float> resizedInput;
-        imageAlgo::resizeImage(nw, nh, imageGrayFloat, resizedInput);
-        imageGrayFloat.swap(resizedInput);
+        imageAlgo::resizeImage(nw, nh, decoded.imageGrayFloat, resizedInput);
+        decoded.imageGrayFloat.swap(resizedInput);
     }
 
     if (!_masksFolder.empty() && fs::exists(_masksFolder))
@@ -195,13 +379,22 @@ void FeatureExtractor::computeViewJob(const FeatureExtractorViewJob& job, bool u
 
         if (fs::exists(idMaskPath))
         {
-            image::readImage(idMaskPath.string(), mask, image::EImageColorSpace::LINEAR);
+            image::readImage(idMaskPath.string(), decoded.mask, image::EImageColorSpace::LINEAR);
         }
         else if (fs::exists(nameMaskPath))
         {
-            image::readImage(nameMaskPath.string(), mask, image::EImageColorSpace::LINEAR);
+            image::readImage(nameMaskPath.string(), decoded.mask, image::EImageColorSpace::LINEAR);
         }
     }
+}
+
+void FeatureExtractor::describeDecodedJob(const DecodedViewJob& decoded, bool useGPU, DescriberMemoryCalibration* memoryCalibration)
+{
+    const FeatureExtractorViewJob& job = *decoded.job;
+    const image::Image<float>& imageGrayFloat = decoded.imageGrayFloat;
+    const image::Image<unsigned char>& mask = decoded.mask;
+    const double pixelRatio = decoded.pixelRatio;
+    image::Image<unsigned char> imageGrayUChar;
 
     for (const auto& imageDescriberIndex : job.imageDescriberIndexes(useGPU))
     {
@@ -213,6 +406,25 @@ void FeatureExtractor::computeViewJob(const FeatureExtractorViewJob& job, bool u
         ALICEVISION_LOG_INFO("Extracting " << imageDescriberTypeName << " features from view '" << job.view().getImage().getImagePath() << "' "
                                            << (useGPU ? "[gpu]" : "[cpu]"));
 
+        // calibration: sample the resident memory of the process while the describer runs
+        std::atomic<bool> samplingDone(false);
+        std::atomic<std::size_t> sampledPeakMemory(0);
+        std::thread samplerThread;
+        std::size_t baselineMemory = 0;
+        if (memoryCalibration != nullptr)
+        {
+            baselineMemory = system::getProcessMemoryUsage().residentMemory;
+            samplerThread = std::thread([&samplingDone, &sampledPeakMemory]() {
+                while (!samplingDone)
+                {
+                    const std::size_t residentMemory = system::getProcessMemoryUsage().residentMemory;
+                    if (residentMemory > sampledPeakMemory)
+                        sampledPeakMemory = residentMemory;
+                    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                }
+            });
+        }
+
         std::unique_ptr<feature::Regions> regions;
         if (imageDescriber->useFloatImage())
         {
@@ -227,6 +439,17 @@ void FeatureExtractor::computeViewJob(const FeatureExtractorViewJob& job, bool u
             imageDescriber->describe(imageGrayUChar, regions);
         }
 
+        if (memoryCalibration != nullptr)
+        {
+            samplingDone = true;
+            samplerThread.join();
+            const std::size_t peakMemory = std::max(sampledPeakMemory.load(), system::getProcessMemoryUsage().residentMemory);
+            const std::size_t peakDelta = (peakMemory > baselineMemory) ? peakMemory - baselineMemory : 0;
+            memoryCalibration->addSample(
+              imageDescriberType, std::size_t(imageGrayFloat.width()) * imageGrayFloat.height(), peakDelta);
+            ALICEVISION_LOG_INFO("Measured peak memory of " << imageDescriberTypeName << ": " << peakDelta / (1024 * 1024) << " MB");
+        }
+
         if (pixelRatio != 1.0)
         {
             // Re-position point features on input image
@@ -303,5 +526,12 @@ void FeatureExtractor::computeViewJob(const FeatureExtractorViewJob& job, bool u
     }
 }
 
+void FeatureExtractor::computeViewJob(const FeatureExtractorViewJob& job, bool useGPU, const image::EImageColorSpace workingColorSpace)
+{
+    DecodedViewJob decoded;
+    decodeViewJob(job, workingColorSpace, decoded);
+    describeDecodedJob(decoded, useGPU);
+}
+
 }  // namespace featureEngine
 }  // namespace aliceVision
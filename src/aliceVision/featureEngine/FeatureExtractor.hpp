@@ -5,6 +5,7 @@
 // You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include <aliceVision/feature/feature.hpp>
+#include <aliceVision/featureEngine/DescriberMemoryCalibration.hpp>
 #include <aliceVision/sfmData/SfMData.hpp>
 #include <aliceVision/sfmData/View.hpp>
 #include <aliceVision/system/hardwareContext.hpp>
@@ -32,12 +33,20 @@ class FeatureExtractorViewJob
         return _outputBasename + "." + EImageDescriberType_enumToString(imageDescriberType) + ".desc";
     }
 
-    void setImageDescribers(const std::vector<std::shared_ptr<feature::ImageDescriber>>& imageDescribers);
+    void setImageDescribers(const std::vector<std::shared_ptr<feature::ImageDescriber>>& imageDescribers,
+                            const DescriberMemoryCalibration* memoryCalibration = nullptr);
+
+    /// re-evaluate the memory estimate of the job, e.g. once a memory calibration pass has run
+    void updateMemoryConsumption(const std::vector<std::shared_ptr<feature::ImageDescriber>>& imageDescribers,
+                                 const DescriberMemoryCalibration& memoryCalibration);
 
     const sfmData::View& view() const { return _view; }
 
     std::size_t memoryConsuption() const { return _memoryConsuption; }
 
+    /// estimated size in bytes of the decoded image buffers of this job
+    std::size_t decodedMemoryConsuption() const { return std::size_t(_view.getImage().getWidth()) * _view.getImage().getHeight() * sizeof(float); }
+
     const std::vector<std::size_t>& imageDescriberIndexes(bool useGPU) const
     {
         return useGPU ? _gpuImageDescriberIndexes : _cpuImageDescriberIndexes;
@@ -72,11 +81,35 @@ class FeatureExtractor
 
     void setOutputFolder(const std::string& folder) { _outputFolder = folder; }
 
+    /// Set the describer memory calibration file. When the file exists, the measured
+    /// profiles it contains replace the analytical memory estimates for the scheduling;
+    /// otherwise a calibration pass measures the first jobs and writes the file.
+    void setMemoryCalibrationFile(const std::string& filename) { _memoryCalibrationFile = filename; }
+
     void addImageDescriber(std::shared_ptr<feature::ImageDescriber>& imageDescriber) { _imageDescribers.push_back(imageDescriber); }
 
     void process(const HardwareContext& hcontext, const image::EImageColorSpace workingColorSpace = image::EImageColorSpace::SRGB);
 
   private:
+    /// decoded inputs of a view job, produced by the decode pool and consumed by the compute pool
+    struct DecodedViewJob
+    {
+        const FeatureExtractorViewJob* job = nullptr;
+        image::Image<float> imageGrayFloat;
+        image::Image<unsigned char> mask;
+        double pixelRatio = 1.0;
+        /// bytes accounted on the decode byte budget while this job is in flight
+        std::size_t reservedBytes = 0;
+    };
+
+    /// read the input image (and the optional mask) of a view job
+    void decodeViewJob(const FeatureExtractorViewJob& job, const image::EImageColorSpace workingColorSpace, DecodedViewJob& decoded) const;
+
+    /// run the image describers of a view job on its decoded image
+    /// when memoryCalibration is set, the peak resident memory of each describer is
+    /// sampled while it runs and recorded as a calibration sample
+    void describeDecodedJob(const DecodedViewJob& decoded, bool useGPU, DescriberMemoryCalibration* memoryCalibration = nullptr);
+
     void computeViewJob(const FeatureExtractorViewJob& job,
                         bool useGPU,
                         const image::EImageColorSpace workingColorSpace = image::EImageColorSpace::SRGB);
@@ -87,6 +120,8 @@ class FeatureExtractor
     std::string _maskExtension;
     bool _maskInvert;
     std::string _outputFolder;
+    std::string _memoryCalibrationFile;
+    DescriberMemoryCalibration _memoryCalibration;
     int _rangeStart = -1;
     int _rangeSize = -1;
 };
@@ -17,6 +17,7 @@
 #include <aliceVision/mvsUtils/mapIO.hpp>
 #include <aliceVision/image/io.hpp>
 #include <aliceVision/image/imageAlgo.hpp>
+#include <aliceVision/alicevision_omp.hpp>
 
 #include <boost/accumulators/accumulators.hpp>
 #include <boost/accumulators/statistics.hpp>
@@ -43,6 +44,49 @@ unsigned long computeNumberOfAllPoints(const mvsUtils::MultiViewParams& mp, int
     return npts;
 }
 
+DepthMapsCache::DepthMapsCache(const mvsUtils::MultiViewParams& mp, int capacity)
+  : _mp(mp),
+    _capacity(capacity),
+    _camMutexes(mp.ncams)
+{}
+
+std::shared_ptr<const image::Image<float>> DepthMapsCache::get(int camId)
+{
+    // serialize the loading per camera: concurrent users of the same map wait for the first
+    // one to decode it instead of each decoding the file again
+    std::lock_guard<std::mutex> camLock(_camMutexes.at(camId));
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto it = _depthMaps.find(camId);
+        if (it != _depthMaps.end())
+        {
+            _lastUsedCamIds.remove(camId);
+            _lastUsedCamIds.push_front(camId);
+            return it->second;
+        }
+    }
+
+    auto depthMap = std::make_shared<image::Image<float>>();
+
+    // read depth map from depthMapEstimation folder
+    mvsUtils::readMap(camId, _mp, mvsUtils::EFileType::depthMap, *depthMap);
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _depthMaps[camId] = depthMap;
+        _lastUsedCamIds.push_front(camId);
+        while (static_cast<int>(_lastUsedCamIds.size()) > _capacity)
+        {
+            // current users keep the evicted map alive through their shared pointer
+            _depthMaps.erase(_lastUsedCamIds.back());
+            _lastUsedCamIds.pop_back();
+        }
+    }
+
+    return depthMap;
+}
+
 Fuser::Fuser(const mvsUtils::MultiViewParams& mp)
   : _mp(mp)
 {}
@@ -125,18 +169,28 @@ void Fuser::filterGroups(const std::vector<int>& cams, float pixToleranceFactor,
 {
     ALICEVISION_LOG_INFO("Precomputing groups.");
     long t1 = clock();
+
+    // sliding-window cache of decoded depth maps: each R camera and its nearest T cameras
+    // stay resident while the neighboring R cameras, which share most of them, are processed
+    DepthMapsCache depthMapsCache(_mp, omp_get_max_threads() * (nNearestCams + 1));
+
 #pragma omp parallel for
     for (int c = 0; c < cams.size(); c++)
     {
         int rc = cams[c];
-        filterGroupsRC(rc, pixToleranceFactor, pixSizeBall, pixSizeBallWSP, nNearestCams);
+        filterGroupsRC(rc, pixToleranceFactor, pixSizeBall, pixSizeBallWSP, nNearestCams, depthMapsCache);
     }
 
     mvsUtils::printfElapsedTime(t1);
 }
 
 // minNumOfModals number of other cams including this cam ... minNumOfModals /in 2,3,...
-bool Fuser::filterGroupsRC(int rc, float pixToleranceFactor, int pixSizeBall, int pixSizeBallWSP, int nNearestCams)
+bool Fuser::filterGroupsRC(int rc,
+                           float pixToleranceFactor,
+                           int pixSizeBall,
+                           int pixSizeBallWSP,
+                           int nNearestCams,
+                           DepthMapsCache& depthMapsCache)
 {
     if (fs::exists(getFileNameFromIndex(_mp, rc, mvsUtils::EFileType::nmodMap)))
     {
@@ -147,11 +201,11 @@ bool Fuser::filterGroupsRC(int rc, float pixToleranceFactor, int pixSizeBall, in
     int w = _mp.getWidth(rc);
     int h = _mp.getHeight(rc);
 
-    image::Image<float> depthMap;
-    image::Image<float> simMap;
+    const std::shared_ptr<const image::Image<float>> depthMapPtr = depthMapsCache.get(rc);
+    const image::Image<float>& depthMap = *depthMapPtr;
 
-    // read depth/sim maps from depthMapEstimation folder
-    mvsUtils::readMap(rc, _mp, mvsUtils::EFileType::depthMap, depthMap);
+    // read sim map from depthMapEstimation folder
+    image::Image<float> simMap;
     mvsUtils::readMap(rc, _mp, mvsUtils::EFileType::simMap, simMap);
 
     image::Image<unsigned char> numOfModalsMap(w, h, true, 0);
@@ -175,10 +229,9 @@ bool Fuser::filterGroupsRC(int rc, float pixToleranceFactor, int pixSizeBall, in
         numOfPtsMap->resize_with(w * h, 0);
         int tc = tcams[c];
 
-        image::Image<float> tcdepthMap;
-
-        // read Tc depth map from depthMapEstimation folder
-        mvsUtils::readMap(tc, _mp, mvsUtils::EFileType::depthMap, tcdepthMap);
+        // get Tc depth map from the shared cache
+        const std::shared_ptr<const image::Image<float>> tcdepthMapPtr = depthMapsCache.get(tc);
+        const image::Image<float>& tcdepthMap = *tcdepthMapPtr;
 
         if (tcdepthMap.height() > 0 && tcdepthMap.width() > 0)
         {
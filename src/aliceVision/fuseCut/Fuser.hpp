@@ -14,10 +14,41 @@
 #include <aliceVision/mvsData/Voxel.hpp>
 #include <aliceVision/sfmData/SfMData.hpp>
 
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+
 namespace aliceVision {
 
 namespace fuseCut {
 
+/**
+ * @brief Bounded thread-safe cache of decoded depth maps, shared across the R cameras of a
+ * depth map filtering pass.
+ *
+ * The nearest T cameras of consecutive R cameras overlap heavily, so each depth map is decoded
+ * once and shared through a sliding window instead of being re-read from disk for every R camera
+ * using it as a neighbor.
+ */
+class DepthMapsCache
+{
+  public:
+    DepthMapsCache(const mvsUtils::MultiViewParams& mp, int capacity);
+
+    /// @brief Get the decoded depth map of the given camera, loading it on first use.
+    std::shared_ptr<const image::Image<float>> get(int camId);
+
+  private:
+    const mvsUtils::MultiViewParams& _mp;
+    const int _capacity;
+
+    std::mutex _mutex;
+    std::vector<std::mutex> _camMutexes;
+    std::map<int, std::shared_ptr<const image::Image<float>>> _depthMaps;
+    std::list<int> _lastUsedCamIds;  //< most recently used first
+};
+
 class Fuser
 {
   public:
@@ -29,7 +60,12 @@ class Fuser
     // minNumOfModals number of other cams including this cam ... minNumOfModals /in 2,3,... default 3
     // pixSizeBall = default 2
     void filterGroups(const std::vector<int>& cams, float pixToleranceFactor, int pixSizeBall, int pixSizeBallWSP, int nNearestCams);
-    bool filterGroupsRC(int rc, float pixToleranceFactor, int pixSizeBall, int pixSizeBallWSP, int nNearestCams);
+    bool filterGroupsRC(int rc,
+                        float pixToleranceFactor,
+                        int pixSizeBall,
+                        int pixSizeBallWSP,
+                        int nNearestCams,
+                        DepthMapsCache& depthMapsCache);
     void filterDepthMaps(const std::vector<int>& cams, int minNumOfModals, int minNumOfModalsWSP2SSP);
     bool filterDepthMapsRC(int rc, int minNumOfModals, int minNumOfModalsWSP2SSP);
 
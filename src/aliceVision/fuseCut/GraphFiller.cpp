@@ -8,10 +8,14 @@
 
 #include <aliceVision/mvsUtils/common.hpp>
 #include <aliceVision/fuseCut/Intersections.hpp>
-#include <aliceVision/fuseCut/MaxFlow_AdjList.hpp>
+#include <aliceVision/fuseCut/MaxFlow_PushRelabel.hpp>
 
 #include <boost/atomic/atomic_ref.hpp>
 
+#include <aliceVision/alicevision_omp.hpp>
+
+#include <numeric>
+
 
 namespace aliceVision {
 namespace fuseCut {
@@ -83,37 +87,102 @@ void GraphFiller::fillGraph(double nPixelSizeBehind, float fullWeight)
 {
     ALICEVISION_LOG_INFO("Computing s-t graph weights.");
 
-    // choose random order to prevent waiting
     const unsigned int seed = (unsigned int)_mp.userParams.get<unsigned int>("delaunaycut.seed", 0);
-    const std::vector<int> verticesRandIds = mvsUtils::createRandomArrayOfIntegers(_verticesAttr.size(), seed);
 
-#pragma omp parallel for 
-    for (int i = 0; i < verticesRandIds.size(); i++)
+    // The rays of a vertex vote for cells spread over the whole volume, so concurrent updates
+    // of the shared cell attributes serialize on the same cache lines past a few threads.
+    // Each group of threads votes into its own accumulator instead, and the accumulators are
+    // merged in a final reduction pass.
+    // The number of accumulators is bounded by a memory budget: threads sharing an
+    // accumulator still update it atomically, but the contention is divided accordingly.
+    const std::size_t maxAccumulatorsMB = _mp.userParams.get<std::size_t>("delaunaycut.maxAccumulatorsMB", 8192);
+    const std::size_t accumulatorBytes = std::max<std::size_t>(1, _cellsAttr.size() * sizeof(GC_cellInfo));
+    const int nbAccumulators =
+      std::max(1, std::min(omp_get_max_threads(), int((maxAccumulatorsMB * 1024 * 1024) / accumulatorBytes)));
+
+    // The vertices are spatially sorted upstream, so walking them in order makes consecutive
+    // rays march through largely overlapping cells and the packed cell array stays in cache.
+    // This only pays off when every thread owns its accumulator: with shared accumulators the
+    // order is randomized instead to spread the atomic updates and prevent waiting.
+    std::vector<int> verticesIds;
+    if (nbAccumulators == omp_get_max_threads())
     {
-        const int vertexIndex = verticesRandIds[i];
-        const GC_vertexInfo& v = _verticesAttr[vertexIndex];
+        verticesIds.resize(_verticesAttr.size());
+        std::iota(verticesIds.begin(), verticesIds.end(), 0);
+    }
+    else
+    {
+        verticesIds = mvsUtils::createRandomArrayOfIntegers(_verticesAttr.size(), seed);
+    }
 
-        if (!v.isReal())
-        {  
-            continue;
+    std::vector<std::vector<GC_cellInfo>> accumulators(nbAccumulators);
+
+#pragma omp parallel for
+    for (int a = 0; a < nbAccumulators; ++a)
+    {
+        accumulators[a].resize(_cellsAttr.size());
+    }
+
+#pragma omp parallel
+    {
+        std::vector<GC_cellInfo>& cellsAttr = accumulators[omp_get_thread_num() % nbAccumulators];
+
+#pragma omp for
+        for (int i = 0; i < verticesIds.size(); i++)
+        {
+            const int vertexIndex = verticesIds[i];
+            const GC_vertexInfo& v = _verticesAttr[vertexIndex];
+
+            if (!v.isReal())
+            {
+                continue;
+            }
+
+            float weight = (float)v.nrc;  // number of cameras
+
+            //Overwrite with forced weight if available
+            weight = (float)_mp.userParams.get<double>("LargeScale.forceWeight", weight);
+
+            // compiled out in release builds, the arguments are never evaluated
+            ALICEVISION_LOG_TRACE("fillGraph: march vertex " << vertexIndex << " from " << v.cams.size() << " cameras (weight: " << weight << ").");
+
+            for (int c = 0; c < v.cams.size(); c++)
+            {
+                rayMarchingGraphEmpty(vertexIndex, v.cams[c], weight, cellsAttr);
+                rayMarchingGraphFull(vertexIndex, v.cams[c], weight* fullWeight, nPixelSizeBehind, cellsAttr);
+            }
         }
-        
-        float weight = (float)v.nrc;  // number of cameras
+    }
 
-        //Overwrite with forced weight if available
-        weight = (float)_mp.userParams.get<double>("LargeScale.forceWeight", weight);
+    // reduction pass: merge the accumulators into the shared cell attributes
+#pragma omp parallel for
+    for (std::ptrdiff_t ci = 0; ci < std::ptrdiff_t(_cellsAttr.size()); ++ci)
+    {
+        GC_cellInfo& c = _cellsAttr[ci];
 
-        for (int c = 0; c < v.cams.size(); c++)
+        for (const std::vector<GC_cellInfo>& cellsAttr : accumulators)
         {
-            rayMarchingGraphEmpty(vertexIndex, v.cams[c], weight);
-            rayMarchingGraphFull(vertexIndex, v.cams[c], weight* fullWeight, nPixelSizeBehind);
+            const GC_cellInfo& a = cellsAttr[ci];
+
+            c.emptinessScore += a.emptinessScore;
+            c.cellTWeight += a.cellTWeight;
+            for (int s = 0; s < 4; ++s)
+            {
+                c.gEdgeVisWeight[s] += a.gEdgeVisWeight[s];
+            }
+            // cellSWeight is only ever assigned the maxint constant by the ray marching
+            if (a.cellSWeight > 0.0f)
+            {
+                c.cellSWeight = a.cellSWeight;
+            }
         }
     }
 }
 
 void GraphFiller::rayMarchingGraphEmpty(int vertexIndex,
                                          int cam,
-                                         float weight)
+                                         float weight,
+                                         std::vector<GC_cellInfo>& cellsAttr)
 {
     const int maxint = std::numeric_limits<int>::max();
 
@@ -159,8 +228,8 @@ void GraphFiller::rayMarchingGraphEmpty(int vertexIndex,
         {
             GeometryIntersection previousGeometry = marching.getPreviousIntersection();
 
-            boost::atomic_ref<float>{_cellsAttr[previousGeometry.facet.cellIndex].emptinessScore} += weight;
-            boost::atomic_ref<float>{_cellsAttr[previousGeometry.facet.cellIndex].gEdgeVisWeight[previousGeometry.facet.localVertexIndex]} += weight;
+            boost::atomic_ref<float>{cellsAttr[previousGeometry.facet.cellIndex].emptinessScore} += weight;
+            boost::atomic_ref<float>{cellsAttr[previousGeometry.facet.cellIndex].gEdgeVisWeight[previousGeometry.facet.localVertexIndex]} += weight;
 
             
             lastIntersectedFacet = geometry.facet;
@@ -169,7 +238,7 @@ void GraphFiller::rayMarchingGraphEmpty(int vertexIndex,
         {
             if (previousGeometry.type == EGeometryType::Facet)
             {
-                boost::atomic_ref<float>{_cellsAttr[previousGeometry.facet.cellIndex].emptinessScore} += weight;
+                boost::atomic_ref<float>{cellsAttr[previousGeometry.facet.cellIndex].emptinessScore} += weight;
             }
 
             if (geometry.type == EGeometryType::Vertex)
@@ -184,21 +253,22 @@ void GraphFiller::rayMarchingGraphEmpty(int vertexIndex,
         // Declare the last part of the empty path as connected to EMPTY (S node in the graph cut)
         if (lastIntersectedFacet.cellIndex != GEO::NO_CELL && (_mp.CArr[cam] - intersectPt).size() < 0.2 * pointCamDistance)
         {
-            boost::atomic_ref<float>{_cellsAttr[lastIntersectedFacet.cellIndex].cellSWeight} = (float)maxint;
+            boost::atomic_ref<float>{cellsAttr[lastIntersectedFacet.cellIndex].cellSWeight} = (float)maxint;
         }
     }
 
     // Vote for the last intersected facet (close to the cam)
     if (lastIntersectedFacet.cellIndex != GEO::NO_CELL)
     {
-        boost::atomic_ref<float>{_cellsAttr[lastIntersectedFacet.cellIndex].cellSWeight} = (float)maxint;
+        boost::atomic_ref<float>{cellsAttr[lastIntersectedFacet.cellIndex].cellSWeight} = (float)maxint;
     }
 }
 
 void GraphFiller::rayMarchingGraphFull(int vertexIndex,
                                          int cam,
                                          float fullWeight,
-                                         double nPixelSizeBehind)
+                                         double nPixelSizeBehind,
+                                         std::vector<GC_cellInfo>& cellsAttr)
 {
     const int maxint = std::numeric_limits<int>::max();
     const Point3d& originPt = _verticesCoords[vertexIndex];
@@ -242,14 +312,14 @@ void GraphFiller::rayMarchingGraphFull(int vertexIndex,
         if (geometry.type == EGeometryType::Facet)
         {
             lastIntersectedFacet = geometry.facet;
-            boost::atomic_ref<float>{_cellsAttr[geometry.facet.cellIndex].gEdgeVisWeight[geometry.facet.localVertexIndex]} += fullWeight;
+            boost::atomic_ref<float>{cellsAttr[geometry.facet.cellIndex].gEdgeVisWeight[geometry.facet.localVertexIndex]} += fullWeight;
         }
     }
 
     // found facet Vote for the last intersected facet (farthest from the camera)
     if (lastIntersectedFacet.cellIndex != GEO::NO_CELL)
     {
-        boost::atomic_ref<float>{_cellsAttr[lastIntersectedFacet.cellIndex].cellTWeight} += fullWeight;
+        boost::atomic_ref<float>{cellsAttr[lastIntersectedFacet.cellIndex].cellTWeight} += fullWeight;
     }
 }
 
@@ -480,7 +550,7 @@ void GraphFiller::binarize()
 {
     const std::size_t nbCells = _cellsAttr.size();
 
-    MaxFlow_AdjList maxFlowGraph(nbCells);
+    MaxFlow_PushRelabel maxFlowGraph(nbCells);
 
     // fill s-t edges
     for (CellIndex ci = 0; ci < nbCells; ++ci)
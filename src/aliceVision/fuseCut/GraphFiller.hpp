@@ -39,8 +39,8 @@ private:
     void addToInfiniteSw(float sW);
 
     void fillGraph(double nPixelSizeBehind, float fullWeight);
-    void rayMarchingGraphEmpty(int vertexIndex, int cam, float weight);
-    void rayMarchingGraphFull(int vertexIndex, int cam, float fullWeight, double nPixelSizeBehind);
+    void rayMarchingGraphEmpty(int vertexIndex, int cam, float weight, std::vector<GC_cellInfo>& cellsAttr);
+    void rayMarchingGraphFull(int vertexIndex, int cam, float fullWeight, double nPixelSizeBehind, std::vector<GC_cellInfo>& cellsAttr);
     void forceTedgesByGradientIJCV(float nPixelSizeBehind);
     
     std::vector<CellIndex> getNeighboringCellsByGeometry(const GeometryIntersection& g) const;
@@ -157,7 +157,9 @@ GeometryIntersection TetrahedronsRayMarching::intersectNextGeomEdge()
    
     GeometryIntersection result;
 
-    for (CellIndex adjCellIndex : _tetrahedralization.getNeighboringCellsByEdge(_intersection.edge))
+    _tetrahedralization.getNeighboringCellsByEdge(_intersection.edge, _edgeNeighboringCells);
+
+    for (CellIndex adjCellIndex : _edgeNeighboringCells)
     {
         if (_tetrahedralization.isInvalidOrInfiniteCell(adjCellIndex))
             continue;
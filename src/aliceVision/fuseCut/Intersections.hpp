@@ -151,6 +151,9 @@ private:
     size_t _facetCount;
     size_t _vertexCount;
     size_t _edgeCount;
+
+    /// scratch buffer for the cells around the current edge, reused across marching steps
+    std::vector<CellIndex> _edgeNeighboringCells;
 };
 
 }
@@ -97,6 +97,33 @@ class SmallerPixSizeInRadius
     inline DistanceType worstDist() const { return radius; }
 };
 
+/**
+ * @brief Reusable nearest-vertex query context.
+ *
+ * The result set and search parameters are created once and reused across
+ * queries, so hot loops issuing one lookup per pixel or per grid cell avoid
+ * the per-query setup. A context must not be shared between threads.
+ */
+class NearestVertexSearch
+{
+    nanoflann::KNNResultSet<double, std::size_t> _resultSet;
+    const nanoflann::SearchParameters _searchParams;
+
+  public:
+    NearestVertexSearch()
+      : _resultSet(1)
+    {}
+
+    bool locateNearestVertex(const KdTree& tree, const Point3d& p, std::size_t& index, double& sq_dist)
+    {
+        index = std::numeric_limits<std::size_t>::max();
+        sq_dist = std::numeric_limits<double>::max();
+
+        _resultSet.init(&index, &sq_dist);
+        return tree.findNeighbors(_resultSet, p.m, _searchParams);
+    }
+};
+
 class Tree
 {
     std::unique_ptr<KdTree> _tree;
@@ -116,16 +143,14 @@ class Tree
 
     bool locateNearestVertex(const Point3d& p, std::size_t& index, double& sq_dist) const
     {
-        index = std::numeric_limits<std::size_t>::max();
-        sq_dist = std::numeric_limits<double>::max();
+        NearestVertexSearch search;
+        return locateNearestVertex(p, index, sq_dist, search);
+    }
 
-        nanoflann::KNNResultSet<double, std::size_t> resultSet(1);
-        resultSet.init(&index, &sq_dist);
-        if (!_tree->findNeighbors(resultSet, p.m, nanoflann::SearchParameters()))
-        {
-            return false;
-        }
-        return true;
+    /// @brief Same lookup reusing the given query context across calls.
+    bool locateNearestVertex(const Point3d& p, std::size_t& index, double& sq_dist, NearestVertexSearch& search) const
+    {
+        return search.locateNearestVertex(*_tree, p, index, sq_dist);
     }
 };
 
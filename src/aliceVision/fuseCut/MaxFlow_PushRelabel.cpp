@@ -0,0 +1,277 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "MaxFlow_PushRelabel.hpp"
+
+#include <aliceVision/system/Logger.hpp>
+
+#include <boost/atomic/atomic_ref.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+namespace aliceVision {
+namespace fuseCut {
+
+MaxFlow_PushRelabel::MaxFlow_PushRelabel(std::size_t numNodes)
+  : _numNodes(numNodes),
+    _sourceCap(numNodes, 0.0f),
+    _sinkCap(numNodes, 0.0f)
+{
+    // every node of the meshing graph has up to 4 facet neighbors, seen from both sides
+    _inputEdges.reserve(numNodes * 4);
+}
+
+void MaxFlow_PushRelabel::addNode(NodeType n, ValueType source, ValueType sink)
+{
+    assert(source >= 0 && sink >= 0);
+    const ValueType score = source - sink;
+    if (score > 0)
+        _sourceCap[n] = score;
+    else
+        _sinkCap[n] = -score;
+}
+
+void MaxFlow_PushRelabel::addEdge(NodeType n1, NodeType n2, ValueType capacity, ValueType reverseCapacity)
+{
+    assert(capacity >= 0 && reverseCapacity >= 0);
+    _inputEdges.push_back({n1, n2, capacity, reverseCapacity});
+}
+
+void MaxFlow_PushRelabel::buildArcs()
+{
+    const std::size_t nbArcs = 2 * _inputEdges.size();
+
+    _firstArc.assign(_numNodes + 1, 0);
+    for (const InputEdge& e : _inputEdges)
+    {
+        ++_firstArc[e.n1 + 1];
+        ++_firstArc[e.n2 + 1];
+    }
+    for (std::size_t n = 0; n < _numNodes; ++n)
+        _firstArc[n + 1] += _firstArc[n];
+
+    _arcTo.resize(nbArcs);
+    _arcReverse.resize(nbArcs);
+    _arcResidual.resize(nbArcs);
+
+    std::vector<std::size_t> nextArc(_firstArc.begin(), _firstArc.end() - 1);
+    for (const InputEdge& e : _inputEdges)
+    {
+        const std::size_t a = nextArc[e.n1]++;
+        const std::size_t b = nextArc[e.n2]++;
+        _arcTo[a] = e.n2;
+        _arcReverse[a] = b;
+        _arcResidual[a] = e.capacity;
+        _arcTo[b] = e.n1;
+        _arcReverse[b] = a;
+        _arcResidual[b] = e.reverseCapacity;
+    }
+
+    // the input edges are no longer needed, release the memory before the sweeps
+    std::vector<InputEdge>().swap(_inputEdges);
+}
+
+void MaxFlow_PushRelabel::globalRelabel(std::vector<NodeType>& bfsQueue)
+{
+    // nodes which cannot reach the sink in the residual graph get the unreachable height
+    const int unreachable = int(_numNodes) + 1;
+
+    _height.assign(_numNodes, unreachable);
+
+    bfsQueue.clear();
+    for (std::size_t n = 0; n < _numNodes; ++n)
+    {
+        if (_sinkCap[n] > 0)
+        {
+            _height[n] = 1;
+            bfsQueue.push_back(NodeType(n));
+        }
+    }
+
+    for (std::size_t head = 0; head < bfsQueue.size(); ++head)
+    {
+        const NodeType u = bfsQueue[head];
+        const int hv = _height[u] + 1;
+
+        for (std::size_t a = _firstArc[u]; a < _firstArc[u + 1]; ++a)
+        {
+            // v can step to u iff the arc (v, u), the reverse of (u, v), has residual capacity
+            const NodeType v = _arcTo[a];
+            if (_height[v] == unreachable && _arcResidual[_arcReverse[a]] > 0)
+            {
+                _height[v] = hv;
+                bfsQueue.push_back(v);
+            }
+        }
+    }
+}
+
+MaxFlow_PushRelabel::ValueType MaxFlow_PushRelabel::compute()
+{
+    ALICEVISION_LOG_INFO("Compute parallel push-relabel max-flow (nodes: " << _numNodes << ", edges: " << _inputEdges.size() << ").");
+
+    buildArcs();
+
+    const int unreachable = int(_numNodes) + 1;
+
+    // saturate the source arcs
+    _excess.assign(_numNodes, 0.0);
+    for (std::size_t n = 0; n < _numNodes; ++n)
+        _excess[n] = _sourceCap[n];
+
+    std::vector<NodeType> bfsQueue;
+    bfsQueue.reserve(_numNodes);
+    globalRelabel(bfsQueue);
+
+    std::vector<NodeType> active;
+    std::vector<NodeType> nextActive;
+    std::vector<NodeType> relabelList;
+    std::vector<std::uint8_t> queued(_numNodes, 0);
+
+    const auto collectActive = [&]() {
+        active.clear();
+        for (std::size_t n = 0; n < _numNodes; ++n)
+            if (_excess[n] > 0 && _height[n] < unreachable)
+                active.push_back(NodeType(n));
+    };
+    collectActive();
+
+    double totalFlow = 0.0;
+
+    // amortize the global relabeling against the sweep work, as in sequential implementations
+    const std::size_t globalRelabelThreshold = _arcTo.size() + _numNodes;
+    std::size_t workSinceRelabel = 0;
+    std::size_t nbSweeps = 0;
+
+    while (!active.empty())
+    {
+        if (workSinceRelabel > globalRelabelThreshold)
+        {
+            globalRelabel(bfsQueue);
+            collectActive();
+            workSinceRelabel = 0;
+            continue;
+        }
+        ++nbSweeps;
+
+        // push phase: the heights are frozen, so admissibility is consistent across threads;
+        // residuals and excesses are updated atomically
+        nextActive.clear();
+        relabelList.clear();
+
+#pragma omp parallel reduction(+ : totalFlow, workSinceRelabel)
+        {
+            std::vector<NodeType> localNext;
+            std::vector<NodeType> localRelabel;
+
+#pragma omp for schedule(dynamic, 1024) nowait
+            for (std::ptrdiff_t i = 0; i < std::ptrdiff_t(active.size()); ++i)
+            {
+                const NodeType u = active[i];
+                double e = boost::atomic_ref<double>{_excess[u]}.load();
+                if (e <= 0)
+                    continue;
+
+                const int hu = _height[u];
+
+                // the sink arc, admissible at height 1 (only this thread touches _sinkCap[u])
+                if (hu == 1 && _sinkCap[u] > 0)
+                {
+                    const double d = std::min(e, double(_sinkCap[u]));
+                    _sinkCap[u] -= ValueType(d);
+                    boost::atomic_ref<double>{_excess[u]} -= d;
+                    totalFlow += d;
+                    e -= d;
+                }
+
+                for (std::size_t a = _firstArc[u]; (a < _firstArc[u + 1]) && (e > 0); ++a)
+                {
+                    const NodeType v = _arcTo[a];
+                    if (_height[v] != hu - 1)
+                        continue;
+
+                    // a concurrent push on the reverse arc can only increase the residual,
+                    // so the stale read never makes us push more than the arc can take
+                    const ValueType r = boost::atomic_ref<ValueType>{_arcResidual[a]}.load();
+                    if (r <= 0)
+                        continue;
+
+                    const double d = std::min(e, double(r));
+                    boost::atomic_ref<ValueType>{_arcResidual[a]} -= ValueType(d);
+                    boost::atomic_ref<ValueType>{_arcResidual[_arcReverse[a]]} += ValueType(d);
+                    boost::atomic_ref<double>{_excess[v]} += d;
+                    boost::atomic_ref<double>{_excess[u]} -= d;
+                    e -= d;
+
+                    if (!boost::atomic_ref<std::uint8_t>{queued[v]}.exchange(1))
+                        localNext.push_back(v);
+                }
+
+                workSinceRelabel += (_firstArc[u + 1] - _firstArc[u]) + 1;
+
+                if (e > 0)
+                    localRelabel.push_back(u);
+            }
+
+#pragma omp critical
+            {
+                nextActive.insert(nextActive.end(), localNext.begin(), localNext.end());
+                relabelList.insert(relabelList.end(), localRelabel.begin(), localRelabel.end());
+            }
+        }
+
+        // relabel phase: each node only writes its own height, reading the neighbors' heights
+        // (possibly already raised by a concurrent relabel, which keeps the labeling valid)
+#pragma omp parallel for schedule(dynamic, 1024)
+        for (std::ptrdiff_t i = 0; i < std::ptrdiff_t(relabelList.size()); ++i)
+        {
+            const NodeType u = relabelList[i];
+            const int hu = _height[u];
+
+            int newHeight = (_sinkCap[u] > 0) ? 1 : unreachable;
+            for (std::size_t a = _firstArc[u]; a < _firstArc[u + 1]; ++a)
+            {
+                if (boost::atomic_ref<ValueType>{_arcResidual[a]}.load() > 0)
+                    newHeight = std::min(newHeight, _height[_arcTo[a]] + 1);
+            }
+
+            // a concurrent push may have opened an admissible arc back to us: never lower the height
+            if (newHeight > hu)
+                _height[u] = std::min(newHeight, unreachable);
+        }
+
+        // activate the nodes which received excess or kept some after relabeling
+        active.clear();
+        for (const NodeType v : nextActive)
+        {
+            if (_excess[v] > 0 && _height[v] < unreachable)
+                active.push_back(v);
+        }
+        for (const NodeType u : relabelList)
+        {
+            // nodes already queued by a push are covered by the previous loop
+            if (!queued[u] && _excess[u] > 0 && _height[u] < unreachable)
+                active.push_back(u);
+        }
+        for (const NodeType v : nextActive)
+            queued[v] = 0;
+    }
+
+    // the minimum cut is saturated: the full side is the set of nodes which can still
+    // reach the sink in the residual graph, all the others belong to the source side
+    globalRelabel(bfsQueue);
+    _reachesSink.assign(_numNodes, 0);
+    for (std::size_t n = 0; n < _numNodes; ++n)
+        _reachesSink[n] = (_height[n] < unreachable);
+
+    ALICEVISION_LOG_INFO("Parallel push-relabel max-flow done (sweeps: " << nbSweeps << ", flow: " << totalFlow << ").");
+
+    return ValueType(totalFlow);
+}
+
+}  // namespace fuseCut
+}  // namespace aliceVision
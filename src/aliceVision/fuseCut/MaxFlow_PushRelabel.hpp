@@ -0,0 +1,92 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace aliceVision {
+namespace fuseCut {
+
+/**
+ * @brief Parallel maxflow computation based on the push-relabel algorithm.
+ *
+ * Drop-in replacement for MaxFlow_AdjList, which wraps the single-threaded
+ * boykov_kolmogorov_max_flow: same building interface and same source/sink
+ * classification of the nodes after compute().
+ *
+ * The preflow is advanced by synchronous sweeps over the active nodes: a push
+ * phase (heights are read-only, residuals and excesses are updated with
+ * atomics) followed by a relabel phase (each node only writes its own height),
+ * both parallelized with OpenMP, with periodic global relabeling (backward
+ * breadth-first search from the sink) to keep the heights tight. Only the
+ * first phase of the algorithm is run: once no node below the sink
+ * reachability bound is active the minimum cut is saturated, and the side of
+ * each node is recovered by a residual reachability search from the sink
+ * instead of converting the preflow into a complete flow.
+ */
+class MaxFlow_PushRelabel
+{
+  public:
+    using NodeType = int;
+    using ValueType = float;
+
+    explicit MaxFlow_PushRelabel(std::size_t numNodes);
+
+    /// add the terminal capacities of a node (same netting as MaxFlow_AdjList)
+    void addNode(NodeType n, ValueType source, ValueType sink);
+
+    /// add a directed edge and its reverse between two nodes
+    void addEdge(NodeType n1, NodeType n2, ValueType capacity, ValueType reverseCapacity);
+
+    /// compute the maximum preflow and the associated minimum cut
+    ValueType compute();
+
+    /// is empty
+    inline bool isSource(NodeType n) const { return !_reachesSink[n]; }
+    /// is full
+    inline bool isTarget(NodeType n) const { return bool(_reachesSink[n]); }
+
+  private:
+    /// input edge, kept until compute() packs the arcs
+    struct InputEdge
+    {
+        NodeType n1;
+        NodeType n2;
+        ValueType capacity;
+        ValueType reverseCapacity;
+    };
+
+    /// pack the input edges into per-node arc arrays with reverse arc indexes
+    void buildArcs();
+
+    /// set the heights to the exact residual distances to the sink (backward BFS)
+    void globalRelabel(std::vector<NodeType>& bfsQueue);
+
+    std::size_t _numNodes;
+
+    /// residual capacity from the (implicit) source to each node
+    std::vector<ValueType> _sourceCap;
+    /// residual capacity from each node to the (implicit) sink
+    std::vector<ValueType> _sinkCap;
+
+    std::vector<InputEdge> _inputEdges;
+
+    /// arcs of node n: [_firstArc[n], _firstArc[n + 1])
+    std::vector<std::size_t> _firstArc;
+    std::vector<NodeType> _arcTo;
+    std::vector<std::size_t> _arcReverse;
+    std::vector<ValueType> _arcResidual;
+
+    std::vector<int> _height;
+    std::vector<double> _excess;
+    std::vector<std::uint8_t> _reachesSink;
+};
+
+}  // namespace fuseCut
+}  // namespace aliceVision
@@ -9,7 +9,11 @@
 
 #include <aliceVision/types.hpp>
 
+#include <array>
+#include <cstdint>
+#include <limits>
 #include <memory>
+#include <vector>
 #include <Eigen/Dense>
 
 namespace aliceVision {
@@ -21,71 +25,123 @@ struct RayInfo
     IndexT end;
 };
 
+/**
+ * @brief Flat pool-allocated octree over points.
+ *
+ * All the nodes live in one contiguous vector and reference their children by
+ * index, so building the tree over huge lidar clouds grows one pool instead of
+ * performing one heap allocation per node, and traversals walk packed memory.
+ */
 class SimpleNode
 {
   public:
-    using uptr = std::unique_ptr<SimpleNode>;
-    using ptr = SimpleNode*;
+    using NodeIndex = std::uint32_t;
+    static constexpr NodeIndex NO_NODE = std::numeric_limits<std::uint32_t>::max();
 
   public:
-    SimpleNode(const Eigen::Vector3d& bbmin, const Eigen::Vector3d& bbmax)
+    SimpleNode(const Eigen::Vector3d& bbmin, const Eigen::Vector3d& bbmax) { createNode(bbmin, bbmax); }
+
+    void store(const Eigen::Vector3d& pt) { store(0, pt); }
+
+    /// @brief Merge subtrees holding less than maxPointsPerNode points into their root.
+    void regroup(size_t maxPointsPerNode) { regroup(0, maxPointsPerNode); }
+
+    /// @brief Collect the indices of the nodes holding points, in depth-first order.
+    void visit(std::vector<NodeIndex>& list) const { visit(0, list); }
+
+    const Eigen::Vector3d& getBBMin(NodeIndex node) const { return _cells[node].bbMin; }
+
+    const Eigen::Vector3d& getBBMax(NodeIndex node) const { return _cells[node].bbMax; }
+
+    size_t getCount(NodeIndex node) const
     {
-        _bbMin = bbmin;
-        _bbMax = bbmax;
+        const Cell& cell = _cells[node];
+
+        size_t count = cell.count;
+        for (const NodeIndex child : cell.children)
+        {
+            if (child != NO_NODE)
+            {
+                count += getCount(child);
+            }
+        }
+
+        return count;
     }
 
-    double getSize()
+  private:
+    struct Cell
     {
-        Eigen::Vector3d rel = _bbMax - _bbMin;
+        Eigen::Vector3d bbMin;
+        Eigen::Vector3d bbMax;
+        std::array<NodeIndex, 8> children;
+        size_t count = 0;
+    };
+
+    NodeIndex createNode(const Eigen::Vector3d& bbmin, const Eigen::Vector3d& bbmax)
+    {
+        Cell cell;
+        cell.bbMin = bbmin;
+        cell.bbMax = bbmax;
+        cell.children.fill(NO_NODE);
+        _cells.push_back(cell);
+
+        return NodeIndex(_cells.size() - 1);
+    }
+
+    double getSize(NodeIndex node) const
+    {
+        Eigen::Vector3d rel = _cells[node].bbMax - _cells[node].bbMin;
         return rel.maxCoeff();
     }
 
-    void store(const Eigen::Vector3d& pt)
+    bool isInside(NodeIndex node, const Eigen::Vector3d& pt) const
     {
-        if (!isInside(pt))
+        const Cell& cell = _cells[node];
+        return (pt.x() >= cell.bbMin.x() && pt.y() >= cell.bbMin.y() && pt.z() >= cell.bbMin.z() && pt.x() <= cell.bbMax.x() &&
+                pt.y() <= cell.bbMax.y() && pt.z() <= cell.bbMax.z());
+    }
+
+    void store(NodeIndex node, const Eigen::Vector3d& pt)
+    {
+        if (!isInside(node, pt))
         {
             return;
         }
 
-        double size = getSize();
+        double size = getSize(node);
         if (size > _minSize)
         {
-            subdivide();
+            subdivide(node);
 
-            for (auto& item : _nodes)
+            // copy the children indices, the recursion may grow the pool
+            const std::array<NodeIndex, 8> children = _cells[node].children;
+            for (const NodeIndex child : children)
             {
-                if (item == nullptr)
-                {
-                    continue;
-                }
-
-                item->store(pt);
+                store(child, pt);
             }
         }
         else
         {
-            _count++;
+            _cells[node].count++;
         }
     }
 
-    bool isInside(const Eigen::Vector3d& pt) const
+    void subdivide(NodeIndex node)
     {
-        return (pt.x() >= _bbMin.x() && pt.y() >= _bbMin.y() && pt.z() >= _bbMin.z() && pt.x() <= _bbMax.x() && pt.y() <= _bbMax.y() &&
-                pt.z() <= _bbMax.z());
-    }
-
-    void subdivide()
-    {
-        if (_nodes[0] != nullptr)
+        if (_cells[node].children[0] != NO_NODE)
         {
             return;
         }
 
-        Eigen::Vector3d center = (_bbMin + _bbMax) * 0.5;
+        // copy the bounds, createNode below may grow the pool
+        const Eigen::Vector3d bbMin = _cells[node].bbMin;
+        const Eigen::Vector3d bbMax = _cells[node].bbMax;
+        const Eigen::Vector3d center = (bbMin + bbMax) * 0.5;
 
-        double xs[] = {_bbMin.x(), center.x(), _bbMax.x()};
-        double ys[] = {_bbMin.y(), center.y(), _bbMax.y()};
-        double zs[] = {_bbMin.z(), center.z(), _bbMax.z()};
+        double xs[] = {bbMin.x(), center.x(), bbMax.x()};
+        double ys[] = {bbMin.y(), center.y(), bbMax.y()};
+        double zs[] = {bbMin.z(), center.z(), bbMax.z()};
 
         int pos = 0;
         for (int ix = 0; ix < 2; ix++)
@@ -104,32 +160,35 @@ class SimpleNode
                     lmax.y() = ys[iy + 1];
                     lmax.z() = zs[iz + 1];
 
-                    _nodes[pos] = std::make_unique<SimpleNode>(lmin, lmax);
+                    const NodeIndex child = createNode(lmin, lmax);
+                    _cells[node].children[pos] = child;
                     pos++;
                 }
             }
         }
     }
 
-    void visit(std::vector<SimpleNode::ptr>& list)
+    void visit(NodeIndex node, std::vector<NodeIndex>& list) const
     {
-        if (_count > 0)
+        const Cell& cell = _cells[node];
+
+        if (cell.count > 0)
         {
-            list.push_back(this);
+            list.push_back(node);
         }
 
-        for (auto& item : _nodes)
+        for (const NodeIndex child : cell.children)
         {
-            if (item)
+            if (child != NO_NODE)
             {
-                item->visit(list);
+                visit(child, list);
             }
         }
     }
 
-    void regroup(size_t maxPointsPerNode)
+    void regroup(NodeIndex node, size_t maxPointsPerNode)
     {
-        size_t count = getCount();
+        size_t count = getCount(node);
 
         if (count == 0)
         {
@@ -138,50 +197,25 @@ class SimpleNode
 
         if (count < maxPointsPerNode)
         {
-            _count = count;
-
-            for (auto& item : _nodes)
-            {
-                item.reset();
-                item = nullptr;
-            }
+            // detach the subtree, the children stay in the pool but are no longer reachable
+            Cell& cell = _cells[node];
+            cell.count = count;
+            cell.children.fill(NO_NODE);
 
             return;
         }
 
-        for (auto& item : _nodes)
+        for (const NodeIndex child : _cells[node].children)
         {
-            if (item)
-            {
-                item->regroup(maxPointsPerNode);
-            }
-        }
-    }
-
-    const size_t getCount() const
-    {
-        size_t count = _count;
-
-        for (const auto& item : _nodes)
-        {
-            if (item)
+            if (child != NO_NODE)
             {
-                count += item->getCount();
+                regroup(child, maxPointsPerNode);
             }
         }
-
-        return count;
     }
 
-    const Eigen::Vector3d& getBBMin() const { return _bbMin; }
-
-    const Eigen::Vector3d& getBBMax() const { return _bbMax; }
-
   private:
-    std::array<SimpleNode::uptr, 8> _nodes;
-    Eigen::Vector3d _bbMin;
-    Eigen::Vector3d _bbMax;
-    size_t _count = 0;
+    std::vector<Cell> _cells;
     double _minSize = 2.0;
 };
 
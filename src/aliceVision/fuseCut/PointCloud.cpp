@@ -13,6 +13,7 @@
 #include <aliceVision/mvsData/geometry.hpp>
 
 #include <aliceVision/fuseCut/Kdtree.hpp>
+#include <aliceVision/mesh/spatialSort.hpp>
 
 #include <geogram/mesh/mesh.h>
 #include <geogram/basic/geometry_nd.h>
@@ -171,56 +172,60 @@ void createVerticesWithVisibilities(const StaticVector<int>& cams,
         }
 
 // Add visibility
-#pragma omp parallel for
-        for (int y = 0; y < depthMap.height(); ++y)
+#pragma omp parallel
         {
-            for (int x = 0; x < depthMap.width(); ++x)
+            // one query context per thread, reused for every pixel lookup
+            NearestVertexSearch nearestVertexSearch;
+
+#pragma omp for
+            for (int y = 0; y < depthMap.height(); ++y)
             {
-                const std::size_t index = y * depthMap.width() + x;
-                const float depth = depthMap(index);
-                if (depth <= 0.0f)
-                    continue;
+                for (int x = 0; x < depthMap.width(); ++x)
+                {
+                    const std::size_t index = y * depthMap.width() + x;
+                    const float depth = depthMap(index);
+                    if (depth <= 0.0f)
+                        continue;
 
-                const Point3d p = mp.backproject(c, Point2d(x, y), depth);
-                const double pixSize = mp.getCamPixelSize(p, c);
+                    const Point3d p = mp.backproject(c, Point2d(x, y), depth);
+                    const double pixSize = mp.getCamPixelSize(p, c);
 
-                nanoflann::KNNResultSet<double, std::size_t> resultSet(1);
-                std::size_t nearestVertexIndex = std::numeric_limits<std::size_t>::max();
-                double dist = std::numeric_limits<double>::max();
-                resultSet.init(&nearestVertexIndex, &dist);
-                if (!kdTree.findNeighbors(resultSet, p.m, nanoflann::SearchParameters()))
-                {
-                    ALICEVISION_LOG_TRACE("Failed to find Neighbors.");
-                    continue;
-                }
+                    std::size_t nearestVertexIndex = std::numeric_limits<std::size_t>::max();
+                    double dist = std::numeric_limits<double>::max();
+                    if (!nearestVertexSearch.locateNearestVertex(kdTree, p, nearestVertexIndex, dist))
+                    {
+                        ALICEVISION_LOG_TRACE("Failed to find Neighbors.");
+                        continue;
+                    }
 
-                const float pixSizeScoreI = simScorePrepare[nearestVertexIndex] * pixSize * pixSize;
-                const float pixSizeScoreV =
-                  simScorePrepare[nearestVertexIndex] * pixSizePrepare[nearestVertexIndex] * pixSizePrepare[nearestVertexIndex];
+                    const float pixSizeScoreI = simScorePrepare[nearestVertexIndex] * pixSize * pixSize;
+                    const float pixSizeScoreV =
+                      simScorePrepare[nearestVertexIndex] * pixSizePrepare[nearestVertexIndex] * pixSizePrepare[nearestVertexIndex];
 
-                if (dist < voteMarginFactor * std::max(pixSizeScoreI, pixSizeScoreV))
-                {
-                    GC_vertexInfo& va = verticesAttrPrepare[nearestVertexIndex];
-                    Point3d& vc = verticesCoordsPrepare[nearestVertexIndex];
-                    const float simValue = simMap(index);
-                    // remap similarity values from [-1;+1] to [+1;+simFactor]
-                    // interpretation is [goodSimilarity;badSimilarity]
-                    const float simScore = simValue < -1.0f ? 1.0f : 1.0f + (1.0f + simValue) * simFactor;
-
-                    // Custom locks to limit it to the index: nearestVertexIndex
-                    // to avoid using "omp critical"
-                    omp_lock_t* lock = &locks[nearestVertexIndex];
-                    omp_set_lock(lock);
+                    if (dist < voteMarginFactor * std::max(pixSizeScoreI, pixSizeScoreV))
                     {
-                        va.cams.push_back_distinct(c);
-                        if (dist < contributeMarginFactor * pixSizeScoreV)
+                        GC_vertexInfo& va = verticesAttrPrepare[nearestVertexIndex];
+                        Point3d& vc = verticesCoordsPrepare[nearestVertexIndex];
+                        const float simValue = simMap(index);
+                        // remap similarity values from [-1;+1] to [+1;+simFactor]
+                        // interpretation is [goodSimilarity;badSimilarity]
+                        const float simScore = simValue < -1.0f ? 1.0f : 1.0f + (1.0f + simValue) * simFactor;
+
+                        // Custom locks to limit it to the index: nearestVertexIndex
+                        // to avoid using "omp critical"
+                        omp_lock_t* lock = &locks[nearestVertexIndex];
+                        omp_set_lock(lock);
                         {
-                            vc = (vc * (double)va.nrc + p) / double(va.nrc + 1);
+                            va.cams.push_back_distinct(c);
+                            if (dist < contributeMarginFactor * pixSizeScoreV)
+                            {
+                                vc = (vc * (double)va.nrc + p) / double(va.nrc + 1);
 
-                            va.nrc += 1;
+                                va.nrc += 1;
+                            }
                         }
+                        omp_unset_lock(lock);
                     }
-                    omp_unset_lock(lock);
                 }
             }
         }
@@ -431,6 +436,31 @@ void PointCloud::fuseFromDepthMaps(const StaticVector<int>& cams, const Point3d
 
     ALICEVISION_LOG_INFO("3D points loaded and filtered to " << verticesCoordsPrepare.size() << " points.");
 
+    // sort the candidate points along a space-filling curve: the points come ordered by
+    // camera and pixel, so the kd-tree filtering and visibility passes below jump all over
+    // memory; after the sort spatially close points are contiguous, and the compaction
+    // steps keep this order across the filtering iterations
+    {
+        std::vector<int> order;
+        mesh::computeSpatialOrder(verticesCoordsPrepare, order);
+
+        std::vector<Point3d> verticesCoordsSorted(verticesCoordsPrepare.size());
+        std::vector<double> pixSizeSorted(pixSizePrepare.size());
+        std::vector<float> simScoreSorted(simScorePrepare.size());
+
+#pragma omp parallel for
+        for (int i = 0; i < static_cast<int>(order.size()); ++i)
+        {
+            verticesCoordsSorted[i] = verticesCoordsPrepare[order[i]];
+            pixSizeSorted[i] = pixSizePrepare[order[i]];
+            simScoreSorted[i] = simScorePrepare[order[i]];
+        }
+
+        verticesCoordsPrepare.swap(verticesCoordsSorted);
+        pixSizePrepare.swap(pixSizeSorted);
+        simScorePrepare.swap(simScoreSorted);
+    }
+
     ALICEVISION_LOG_INFO("Init visibilities to compute angle scores");
     std::vector<GC_vertexInfo> verticesAttrPrepare(verticesCoordsPrepare.size());
 
@@ -777,29 +807,35 @@ void PointCloud::addGridHelperPoints(int helperPointsGridSize, const Point3d vox
     std::vector<bool> valid(gridVerticesCoords.size());
 
     ALICEVISION_LOG_TRACE("Create helper points.");
-#pragma omp parallel for
-    for (int x = 0; x <= ns; ++x)
+#pragma omp parallel
     {
-        for (int y = 0; y <= ns; ++y)
+        // one query context per thread, reused for every grid cell lookup
+        NearestVertexSearch nearestVertexSearch;
+
+#pragma omp for
+        for (int x = 0; x <= ns; ++x)
         {
-            for (int z = 0; z <= ns; ++z)
+            for (int y = 0; y <= ns; ++y)
             {
-                int i = x * (ns + 1) * (ns + 1) + y * (ns + 1) + z;
-                const Point3d pt = voxel[0] + vx * ((double)x / double(ns)) + vy * ((double)y / double(ns)) + vz * ((double)z / double(ns));
-                const Point3d noise(maxNoiseSize.x * rand(), maxNoiseSize.y * rand(), maxNoiseSize.z * rand());
-                const Point3d p = pt + noise;
-                std::size_t vi{};
-                double sq_dist{};
-
-                // if there is no nearest vertex or the nearest vertex is not too close
-                if (!kdTree.locateNearestVertex(p, vi, sq_dist) || (sq_dist > minDist2))
+                for (int z = 0; z <= ns; ++z)
                 {
-                    gridVerticesCoords[i] = p;
-                    valid[i] = true;
-                }
-                else
-                {
-                    valid[i] = false;
+                    int i = x * (ns + 1) * (ns + 1) + y * (ns + 1) + z;
+                    const Point3d pt = voxel[0] + vx * ((double)x / double(ns)) + vy * ((double)y / double(ns)) + vz * ((double)z / double(ns));
+                    const Point3d noise(maxNoiseSize.x * rand(), maxNoiseSize.y * rand(), maxNoiseSize.z * rand());
+                    const Point3d p = pt + noise;
+                    std::size_t vi{};
+                    double sq_dist{};
+
+                    // if there is no nearest vertex or the nearest vertex is not too close
+                    if (!kdTree.locateNearestVertex(p, vi, sq_dist, nearestVertexSearch) || (sq_dist > minDist2))
+                    {
+                        gridVerticesCoords[i] = p;
+                        valid[i] = true;
+                    }
+                    else
+                    {
+                        valid[i] = false;
+                    }
                 }
             }
         }
@@ -12,6 +12,8 @@
 #include <geogram/delaunay/delaunay.h>
 #include <geogram/delaunay/delaunay_3d.h>
 
+#include <aliceVision/alicevision_omp.hpp>
+
 namespace aliceVision {
 namespace fuseCut {
 
@@ -20,7 +22,21 @@ Tetrahedralization::Tetrahedralization(const std::vector<Point3d> & vertices)
 {
     //Use geogram to build tetrahedrons
     GEO::initialize();
-    GEO::Delaunay_var tetrahedralization = GEO::Delaunay::create(3, "BDEL");
+
+    //Prefer geogram's multithreaded Delaunay backend when it is compiled in
+    //and more than one core is available. The insertion order and thus the
+    //cell numbering differ from the sequential backend, but the vertices,
+    //cell/adjacency structure and orientation conventions are identical for
+    //the consumers.
+    GEO::Delaunay_var tetrahedralization;
+    if (omp_get_max_threads() > 1)
+    {
+        tetrahedralization = GEO::Delaunay::create(3, "PDEL");
+    }
+    if (tetrahedralization.get() == nullptr)
+    {
+        tetrahedralization = GEO::Delaunay::create(3, "BDEL");
+    }
     tetrahedralization->set_stores_neighbors(true);
     tetrahedralization->set_vertices(_vertices.size(), _vertices.front().m);
 
@@ -51,9 +67,10 @@ Tetrahedralization::Tetrahedralization(const std::vector<Point3d> & vertices)
 void Tetrahedralization::updateVertexToCellsCache(const size_t verticesCount)
 {
     _neighboringCellsPerVertex.clear();
+    _neighboringCellsPerVertex.resize(verticesCount);
 
-    std::map<VertexIndex, std::set<CellIndex>> neighboringCellsPerVertexTmp;
-
+    //Count the cells around each vertex first to allocate every list exactly once
+    std::vector<std::size_t> cellsPerVertexCount(verticesCount, 0);
     for (CellIndex ci = 0; ci < nb_cells(); ++ci)
     {
         for (VertexIndex k = 0; k < 4; ++k)
@@ -65,16 +82,30 @@ void Tetrahedralization::updateVertexToCellsCache(const size_t verticesCount)
                 continue;
             }
 
-            neighboringCellsPerVertexTmp[vi].insert(ci);
+            ++cellsPerVertexCount[vi];
         }
     }
-    
-    _neighboringCellsPerVertex.resize(verticesCount);
-    for (const auto& it : neighboringCellsPerVertexTmp)
+
+    for (std::size_t vi = 0; vi < verticesCount; ++vi)
+    {
+        _neighboringCellsPerVertex[vi].reserve(cellsPerVertexCount[vi]);
+    }
+
+    //A vertex appears at most once per cell and the cells are visited by increasing index,
+    //so each list comes out sorted and duplicate-free as getNeighboringCellsByEdge expects
+    for (CellIndex ci = 0; ci < nb_cells(); ++ci)
     {
-        const std::set<CellIndex>& input = it.second;
-        std::vector<CellIndex>& output = _neighboringCellsPerVertex[it.first];
-        output.assign(input.begin(), input.end());
+        for (VertexIndex k = 0; k < 4; ++k)
+        {
+            const VertexIndex vi = cell_vertex(ci, k);
+
+            if (vi == GEO::NO_VERTEX || vi >= verticesCount)
+            {
+                continue;
+            }
+
+            _neighboringCellsPerVertex[vi].push_back(ci);
+        }
     }
 }
 
@@ -268,15 +299,21 @@ VertexIndex Tetrahedralization::getVertexIndex(const Facet& f, int i) const
 
 std::vector<CellIndex> Tetrahedralization::getNeighboringCellsByEdge(const Edge& e) const
 {
-    const std::vector<CellIndex> & v0ci = getNeighboringCellsPerVertex().at(e.v0);
-    const std::vector<CellIndex> & v1ci = getNeighboringCellsPerVertex().at(e.v1);
-
     std::vector<CellIndex> neighboringCells;
-    std::set_intersection(v0ci.begin(), v0ci.end(), v1ci.begin(), v1ci.end(), std::back_inserter(neighboringCells));
+    getNeighboringCellsByEdge(e, neighboringCells);
 
     return neighboringCells;
 }
 
+void Tetrahedralization::getNeighboringCellsByEdge(const Edge& e, std::vector<CellIndex>& out_neighboringCells) const
+{
+    const std::vector<CellIndex> & v0ci = getNeighboringCellsPerVertex().at(e.v0);
+    const std::vector<CellIndex> & v1ci = getNeighboringCellsPerVertex().at(e.v1);
+
+    out_neighboringCells.clear();
+    std::set_intersection(v0ci.begin(), v0ci.end(), v1ci.begin(), v1ci.end(), std::back_inserter(out_neighboringCells));
+}
+
 std::vector<CellIndex> Tetrahedralization::getNeighboringCellsByFacet(const Facet& f) const
 {
     std::vector<CellIndex> neighboringCells;
@@ -214,7 +214,19 @@ public:
     }
 
     std::vector<CellIndex> getNeighboringCellsByEdge(const Edge& e) const;
-    
+
+    /**
+     * @brief Retrieves the global indexes of the cells around an edge.
+     *
+     * Fills the caller's buffer so that hot loops can reuse it across calls
+     * instead of allocating a new list per edge.
+     *
+     * @param[in] e the concerned edge
+     * @param[out] out_neighboringCells the neighboring cell indices
+     */
+    void getNeighboringCellsByEdge(const Edge& e, std::vector<CellIndex>& out_neighboringCells) const;
+
+
     /**
      * @brief Retrieves the two global indexes of neighboring cells using a facet.
      *
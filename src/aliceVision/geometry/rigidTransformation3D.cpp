@@ -138,13 +138,64 @@ bool ACRansac_FindRTS(const Mat& x1,
     using SolverT = geometry::RTSSolver;
     using KernelT = ACKernelAdaptor_PointsRegistrationSRT<SolverT, geometry::RTSSquaredResidualError>;
 
-    const KernelT kernel = KernelT(x1, x2);
+    const std::size_t nbPoints = x1.cols();
+    // Beyond this size the robust estimation runs on a stratified subsample: the RANSAC
+    // scoring is linear in the number of points per hypothesis and a few tens of thousands
+    // of correspondences already over-constrain a 7 DoF similarity. The model found on the
+    // subsample is then classified against the full set, so vec_inliers stays exhaustive.
+    const std::size_t maxPointsForRansac = 50000;
 
     robustEstimation::MatrixModel<Mat4> RTS;
 
-    // robust estimation of the Projection matrix and its precision
-    const std::pair<double, double> ACRansacOut =
-      robustEstimation::ACRANSAC(kernel, randomNumberGenerator, vec_inliers, numIterations, &RTS, dPrecision);
+    if (nbPoints <= maxPointsForRansac)
+    {
+        const KernelT kernel = KernelT(x1, x2);
+
+        // robust estimation of the Projection matrix and its precision
+        const std::pair<double, double> ACRansacOut =
+          robustEstimation::ACRANSAC(kernel, randomNumberGenerator, vec_inliers, numIterations, &RTS, dPrecision);
+        (void)ACRansacOut;
+    }
+    else
+    {
+        // constant stride over the input keeps one sample per stratum of the original ordering
+        const std::size_t step = (nbPoints + maxPointsForRansac - 1) / maxPointsForRansac;
+        const std::size_t nbSamples = (nbPoints + step - 1) / step;
+
+        Mat sub1 = Mat3X(3, nbSamples);
+        Mat sub2 = Mat3X(3, nbSamples);
+        for (std::size_t i = 0; i < nbSamples; ++i)
+        {
+            sub1.col(i) = x1.col(i * step);
+            sub2.col(i) = x2.col(i * step);
+        }
+
+        const KernelT kernel = KernelT(sub1, sub2);
+
+        std::vector<std::size_t> subInliers;
+        const std::pair<double, double> ACRansacOut =
+          robustEstimation::ACRANSAC(kernel, randomNumberGenerator, subInliers, numIterations, &RTS, dPrecision);
+        const double errorMax = ACRansacOut.first;
+
+        // classify the full set against the subsample model, with the kernel's error definition
+        const Mat3 RS = RTS.getMatrix().topLeftCorner<3, 3>();
+        const Vec3 translation = RTS.getMatrix().topRightCorner<3, 1>();
+
+        std::vector<char> isInlier(nbPoints, 0);
+#pragma omp parallel for
+        for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(nbPoints); ++i)
+        {
+            const double squaredResidual = (x2.col(i) - (RS * x1.col(i) + translation)).squaredNorm();
+            isInlier[i] = (Square(squaredResidual) <= errorMax) ? 1 : 0;
+        }
+
+        vec_inliers.clear();
+        for (std::size_t i = 0; i < nbPoints; ++i)
+        {
+            if (isInlier[i])
+                vec_inliers.push_back(i);
+        }
+    }
 
     const bool good = decomposeRTS(RTS.getMatrix(), S, t, R);
 
@@ -153,14 +204,17 @@ bool ACRansac_FindRTS(const Mat& x1,
         return good;
 
     const std::size_t nbInliers = vec_inliers.size();
-    // only refine the inliers
-    Mat inliers1 = Mat3X(3, nbInliers);
-    Mat inliers2 = Mat3X(3, nbInliers);
-
-    for (std::size_t i = 0; i < nbInliers; ++i)
+    // only refine the inliers; on huge inlier sets a stratified subset is enough for the
+    // least-squares refinement and keeps the numerical differentiation cost bounded
+    const std::size_t refineStep = std::max<std::size_t>(1, (nbInliers + maxPointsForRansac - 1) / maxPointsForRansac);
+    const std::size_t nbRefine = (nbInliers + refineStep - 1) / refineStep;
+    Mat inliers1 = Mat3X(3, nbRefine);
+    Mat inliers2 = Mat3X(3, nbRefine);
+
+    for (std::size_t i = 0; i < nbRefine; ++i)
     {
-        inliers1.col(i) = x1.col(vec_inliers[i]);
-        inliers2.col(i) = x2.col(vec_inliers[i]);
+        inliers1.col(i) = x1.col(vec_inliers[i * refineStep]);
+        inliers2.col(i) = x2.col(vec_inliers[i * refineStep]);
     }
 
     geometry::Refine_RTS(inliers1, inliers2, S, t, R);
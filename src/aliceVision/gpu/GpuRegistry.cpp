@@ -0,0 +1,291 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "GpuRegistry.hpp"
+
+#include <aliceVision/system/Logger.hpp>
+#include <aliceVision/system/system.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <utility>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#if defined(_WIN32)
+    #include <process.h>
+#else
+    #include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace aliceVision {
+namespace gpu {
+
+namespace {
+
+long currentProcessId()
+{
+#if defined(_WIN32)
+    return _getpid();
+#else
+    return getpid();
+#endif
+}
+
+/**
+ * @brief Check whether the process owning a claim is still alive.
+ * On Linux the process table is checked directly; elsewhere claims older
+ * than a day are considered abandoned.
+ */
+bool isClaimLive(long pid, const fs::path& claimPath)
+{
+#if defined(__LINUX__)
+    (void)claimPath;
+    return fs::exists("/proc/" + std::to_string(pid));
+#else
+    std::error_code ec;
+    const auto age = fs::file_time_type::clock::now() - fs::last_write_time(claimPath, ec);
+    return !ec && age < std::chrono::hours(24);
+#endif
+}
+
+/**
+ * @brief Parse a claim filename of the form "device<id>.<pid>.<sequence>.claim".
+ * The sequence number distinguishes multiple claims of the same process.
+ * @return true on success
+ */
+bool parseClaimFilename(const std::string& filename, int& deviceId, long& pid)
+{
+    if (filename.compare(0, 6, "device") != 0 || filename.size() < 7)
+        return false;
+    if (filename.size() < 6 || filename.substr(filename.size() - 6) != ".claim")
+        return false;
+
+    const std::string core = filename.substr(6, filename.size() - 6 - 6);  // "<id>.<pid>.<sequence>"
+    const std::size_t firstDot = core.find('.');
+    const std::size_t secondDot = (firstDot == std::string::npos) ? std::string::npos : core.find('.', firstDot + 1);
+    if (secondDot == std::string::npos)
+        return false;
+
+    try
+    {
+        deviceId = std::stoi(core.substr(0, firstDot));
+        pid = std::stol(core.substr(firstDot + 1, secondDot - firstDot - 1));
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+    return true;
+}
+
+/// in-process sequence used to give every claim its own file
+std::atomic<int> claimSequence{0};
+
+/**
+ * @brief Boot time of the node, used to invalidate the capability cache across reboots.
+ * @return the boot time in seconds since epoch, 0 when not available
+ */
+long long nodeBootTime()
+{
+#if defined(__LINUX__)
+    std::ifstream stat("/proc/stat");
+    std::string line;
+    while (std::getline(stat, line))
+    {
+        if (line.compare(0, 6, "btime ") == 0)
+            return std::stoll(line.substr(6));
+    }
+#endif
+    return 0;
+}
+
+}  // namespace
+
+GpuRegistry::GpuRegistry(const std::string& folder)
+  : _folder(folder)
+{
+    if (_folder.empty())
+        _folder = (fs::temp_directory_path() / "aliceVision_gpuRegistry").string();
+
+    std::error_code ec;
+    fs::create_directories(_folder, ec);
+    if (ec)
+        ALICEVISION_LOG_DEBUG("Cannot create the GPU registry folder (" << _folder << "), GPU arbitration is disabled.");
+}
+
+GpuRegistry::~GpuRegistry()
+{
+    std::error_code ec;
+    for (const auto& claim : _claims)
+        fs::remove(claim.second, ec);
+}
+
+int GpuRegistry::claimDevice(int nbDevices, std::size_t reservedMemoryMB)
+{
+    if (nbDevices <= 0)
+        return 0;
+
+    // count the live claims of all processes and drop the abandoned claim files on the way
+    std::vector<int> claims(nbDevices, 0);
+
+    std::error_code ec;
+    for (const fs::directory_entry& entry : fs::directory_iterator(_folder, ec))
+    {
+        int deviceId = -1;
+        long pid = -1;
+        if (!parseClaimFilename(entry.path().filename().string(), deviceId, pid))
+            continue;
+
+        if (!isClaimLive(pid, entry.path()))
+        {
+            fs::remove(entry.path(), ec);
+            continue;
+        }
+
+        if (deviceId >= 0 && deviceId < nbDevices)
+            ++claims.at(deviceId);
+    }
+
+    // pick the least claimed device, lowest id first
+    int bestDeviceId = 0;
+    for (int deviceId = 1; deviceId < nbDevices; ++deviceId)
+    {
+        if (claims.at(deviceId) < claims.at(bestDeviceId))
+            bestDeviceId = deviceId;
+    }
+
+    // publish the claim, a failure only loses the coordination with other processes
+    const fs::path claimPath = fs::path(_folder) / ("device" + std::to_string(bestDeviceId) + "." + std::to_string(currentProcessId()) + "." +
+                                                    std::to_string(claimSequence++) + ".claim");
+    std::ofstream claimFile(claimPath.string());
+    if (claimFile.is_open())
+        claimFile << reservedMemoryMB << std::endl;
+    else
+        ALICEVISION_LOG_DEBUG("Cannot publish a claim on GPU device " << bestDeviceId << " (path: " << claimPath.string() << ").");
+
+    _claims.emplace_back(bestDeviceId, claimPath.string());
+
+    ALICEVISION_LOG_INFO("GPU registry: claimed device " << bestDeviceId << " (" << claims.at(bestDeviceId)
+                                                         << " concurrent claim(s) on the node).");
+    return bestDeviceId;
+}
+
+void GpuRegistry::releaseDevice(int deviceId)
+{
+    const auto it =
+      std::find_if(_claims.begin(), _claims.end(), [deviceId](const std::pair<int, std::string>& claim) { return claim.first == deviceId; });
+    if (it == _claims.end())
+        return;
+
+    std::error_code ec;
+    fs::remove(it->second, ec);
+    _claims.erase(it);
+}
+
+void GpuRegistry::reserveMemory(int deviceId, std::size_t reservedMemoryMB)
+{
+    // update the claim already held on this device, or publish a new one
+    const auto it =
+      std::find_if(_claims.begin(), _claims.end(), [deviceId](const std::pair<int, std::string>& claim) { return claim.first == deviceId; });
+
+    fs::path claimPath;
+    if (it != _claims.end())
+    {
+        claimPath = it->second;
+    }
+    else
+    {
+        claimPath = fs::path(_folder) / ("device" + std::to_string(deviceId) + "." + std::to_string(currentProcessId()) + "." +
+                                         std::to_string(claimSequence++) + ".claim");
+        _claims.emplace_back(deviceId, claimPath.string());
+    }
+
+    std::ofstream claimFile(claimPath.string());
+    if (claimFile.is_open())
+        claimFile << reservedMemoryMB << std::endl;
+}
+
+int GpuRegistry::claimCount(int deviceId) const
+{
+    int count = 0;
+
+    std::error_code ec;
+    for (const fs::directory_entry& entry : fs::directory_iterator(_folder, ec))
+    {
+        int claimDeviceId = -1;
+        long pid = -1;
+        if (!parseClaimFilename(entry.path().filename().string(), claimDeviceId, pid))
+            continue;
+        if (claimDeviceId == deviceId && isClaimLive(pid, entry.path()))
+            ++count;
+    }
+    return count;
+}
+
+std::size_t GpuRegistry::reservedMemoryMB(int deviceId) const
+{
+    std::size_t reserved = 0;
+
+    std::error_code ec;
+    for (const fs::directory_entry& entry : fs::directory_iterator(_folder, ec))
+    {
+        int claimDeviceId = -1;
+        long pid = -1;
+        if (!parseClaimFilename(entry.path().filename().string(), claimDeviceId, pid))
+            continue;
+        if (claimDeviceId != deviceId || pid == currentProcessId() || !isClaimLive(pid, entry.path()))
+            continue;
+
+        std::ifstream claimFile(entry.path().string());
+        std::size_t claimReservedMB = 0;
+        if (claimFile >> claimReservedMB)
+            reserved += claimReservedMB;
+    }
+    return reserved;
+}
+
+bool GpuRegistry::readCapabilityCache(int& nbDevices, std::string& information) const
+{
+    const long long bootTime = nodeBootTime();
+    if (bootTime == 0)
+        return false;  // no way to detect a stale cache, always re-enumerate
+
+    std::ifstream cacheFile((fs::path(_folder) / "capabilities.txt").string());
+    if (!cacheFile.is_open())
+        return false;
+
+    long long cachedBootTime = 0;
+    if (!(cacheFile >> cachedBootTime >> nbDevices) || cachedBootTime != bootTime)
+        return false;
+    cacheFile.ignore();  // end of the header line
+
+    std::stringstream buffer;
+    buffer << cacheFile.rdbuf();
+    information = buffer.str();
+    return true;
+}
+
+void GpuRegistry::writeCapabilityCache(int nbDevices, const std::string& information)
+{
+    const long long bootTime = nodeBootTime();
+    if (bootTime == 0)
+        return;
+
+    std::ofstream cacheFile((fs::path(_folder) / "capabilities.txt").string());
+    if (!cacheFile.is_open())
+        return;  // the cache is an optimization, failures are non-fatal
+
+    cacheFile << bootTime << " " << nbDevices << std::endl << information;
+}
+
+}  // namespace gpu
+}  // namespace aliceVision
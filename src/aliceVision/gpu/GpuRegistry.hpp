@@ -0,0 +1,86 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace aliceVision {
+namespace gpu {
+
+/**
+ * @brief Node-level GPU arbitration registry.
+ *
+ * Cooperating AliceVision processes running on the same machine coordinate their GPU usage
+ * through small claim files in a shared folder. A scheduler claims a device before computing
+ * on it and the registry hands out the least claimed one, so concurrent pipelines spread over
+ * the available GPUs instead of all selecting device 0. Claims belonging to dead processes
+ * are detected and ignored. The registry also caches the device capability summary, so the
+ * many short-lived processes of a pipeline do not all pay the CUDA runtime enumeration.
+ *
+ * Every operation is best-effort: when the registry folder is not usable the callers simply
+ * fall back to the previous uncoordinated behavior.
+ */
+class GpuRegistry
+{
+  public:
+    /**
+     * @param[in] folder registry folder shared by all processes of the node,
+     * defaults to a fixed folder under the system temporary directory
+     */
+    explicit GpuRegistry(const std::string& folder = "");
+
+    /// releases the claims still held by this object
+    ~GpuRegistry();
+
+    /**
+     * @brief Claim the least claimed device of the node.
+     * @param[in] nbDevices the number of devices to arbitrate between
+     * @param[in] reservedMemoryMB device memory this process intends to use, published to other processes
+     * @return the claimed device id in [0; nbDevices), 0 when the registry is not usable
+     */
+    int claimDevice(int nbDevices, std::size_t reservedMemoryMB = 0);
+
+    /// @brief Release a claim previously obtained with claimDevice().
+    void releaseDevice(int deviceId);
+
+    /**
+     * @brief Update the memory reservation published on a device for this process.
+     * Typically refines the claim made by the scheduler once the job knows its memory budget.
+     * @param[in] deviceId the device id
+     * @param[in] reservedMemoryMB device memory this process intends to use
+     */
+    void reserveMemory(int deviceId, std::size_t reservedMemoryMB);
+
+    /// @return the number of live claims on the given device, across all processes of the node
+    int claimCount(int deviceId) const;
+
+    /// @return the device memory in MB reserved on the given device by live claims of other processes
+    std::size_t reservedMemoryMB(int deviceId) const;
+
+    /**
+     * @brief Read the cached device capability summary.
+     * @param[out] nbDevices the cached number of CUDA devices
+     * @param[out] information the cached capability summary
+     * @return false when the cache is missing or belongs to a previous boot of the node
+     */
+    bool readCapabilityCache(int& nbDevices, std::string& information) const;
+
+    /// @brief Cache the device capability summary for the other processes of the node.
+    void writeCapabilityCache(int nbDevices, const std::string& information);
+
+  private:
+    /// registry folder shared by all processes of the node
+    std::string _folder;
+    /// claims held by this object as (device id, claim file path), released on destruction
+    std::vector<std::pair<int, std::string>> _claims;
+};
+
+}  // namespace gpu
+}  // namespace aliceVision
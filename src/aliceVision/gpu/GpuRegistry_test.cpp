@@ -0,0 +1,107 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <aliceVision/gpu/GpuRegistry.hpp>
+
+#define BOOST_TEST_MODULE gpuRegistry
+
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+using namespace aliceVision;
+
+namespace {
+
+struct RegistryFolder
+{
+    RegistryFolder()
+      : path(fs::temp_directory_path() / "aliceVision_gpuRegistry_test")
+    {
+        fs::remove_all(path);
+        fs::create_directories(path);
+    }
+
+    ~RegistryFolder() { fs::remove_all(path); }
+
+    const fs::path path;
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(GpuRegistry_ClaimSpreadsOverDevices)
+{
+    const RegistryFolder folder;
+    gpu::GpuRegistry registry(folder.path.string());
+
+    // successive claims go to the least claimed device, lowest id first
+    BOOST_CHECK_EQUAL(registry.claimDevice(2), 0);
+    BOOST_CHECK_EQUAL(registry.claimDevice(2), 1);
+    BOOST_CHECK_EQUAL(registry.claimDevice(2), 0);
+
+    BOOST_CHECK_EQUAL(registry.claimCount(0), 2);
+    BOOST_CHECK_EQUAL(registry.claimCount(1), 1);
+
+    registry.releaseDevice(0);
+    BOOST_CHECK_EQUAL(registry.claimCount(0), 1);
+
+    // a second registry (e.g. another process) sees the remaining claims
+    gpu::GpuRegistry other(folder.path.string());
+    BOOST_CHECK_EQUAL(other.claimDevice(2), 0);
+    BOOST_CHECK_EQUAL(other.claimCount(0), 2);
+}
+
+BOOST_AUTO_TEST_CASE(GpuRegistry_ClaimsReleasedOnDestruction)
+{
+    const RegistryFolder folder;
+
+    {
+        gpu::GpuRegistry registry(folder.path.string());
+        registry.claimDevice(2);
+        registry.claimDevice(2);
+    }
+
+    gpu::GpuRegistry registry(folder.path.string());
+    BOOST_CHECK_EQUAL(registry.claimCount(0), 0);
+    BOOST_CHECK_EQUAL(registry.claimCount(1), 0);
+}
+
+BOOST_AUTO_TEST_CASE(GpuRegistry_StaleClaimsIgnored)
+{
+    const RegistryFolder folder;
+
+    // claim from a process id that cannot exist
+    {
+        std::ofstream staleClaim((folder.path / "device0.999999999.0.claim").string());
+        staleClaim << 1024 << std::endl;
+    }
+
+    gpu::GpuRegistry registry(folder.path.string());
+    BOOST_CHECK_EQUAL(registry.claimCount(0), 0);
+    BOOST_CHECK_EQUAL(registry.reservedMemoryMB(0), 0);
+}
+
+BOOST_AUTO_TEST_CASE(GpuRegistry_ReservedMemoryOfOtherProcesses)
+{
+    const RegistryFolder folder;
+    gpu::GpuRegistry registry(folder.path.string());
+
+    // the reservation of this process is not counted against itself
+    registry.claimDevice(1, 2048);
+    BOOST_CHECK_EQUAL(registry.reservedMemoryMB(0), 0);
+
+    // claim from another live process (pid 1 always exists)
+    {
+        std::ofstream otherClaim((folder.path / "device0.1.0.claim").string());
+        otherClaim << 512 << std::endl;
+    }
+
+    BOOST_CHECK_EQUAL(registry.reservedMemoryMB(0), 512);
+    BOOST_CHECK_EQUAL(registry.claimCount(0), 2);
+}
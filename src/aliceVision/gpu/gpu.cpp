@@ -1,4 +1,5 @@
 #include "gpu.hpp"
+#include "GpuRegistry.hpp"
 
 #include <aliceVision/config.hpp>
 #include <aliceVision/system/Logger.hpp>
@@ -63,6 +64,32 @@ bool gpuSupportCUDA(int minComputeCapabilityMajor, int minComputeCapabilityMinor
     return false;
 }
 
+int gpuDeviceCount()
+{
+#if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_CUDA)
+    // consult the node-level capability cache first: the enumeration result is shared between
+    // the many short-lived processes of a pipeline, so most of them do not have to initialize
+    // the CUDA runtime just to count the devices
+    {
+        GpuRegistry registry;
+        int cachedNbDevices = 0;
+        std::string cachedInformation;
+        if (registry.readCapabilityCache(cachedNbDevices, cachedInformation))
+            return cachedNbDevices;
+    }
+
+    int nbDevices = 0;
+    if (cudaGetDeviceCount(&nbDevices) != cudaSuccess)
+    {
+        ALICEVISION_LOG_WARNING("Could not determine number of CUDA cards in this system");
+        nbDevices = 0;
+    }
+    return nbDevices;
+#else
+    return 0;
+#endif
+}
+
 std::string gpuInformationCUDA()
 {
     std::string information;
@@ -156,6 +183,12 @@ std::string gpuInformationCUDA()
     std::stringstream ss;
     ss << "CUDA build version: " << CUDART_VERSION / 1000 << "." << CUDART_VERSION / 10 % 100;
     information += ss.str();
+
+    // refresh the node-level capability cache for the other processes of the pipeline
+    {
+        GpuRegistry registry;
+        registry.writeCapabilityCache(nbDevices, information);
+    }
 #else
     information = "AliceVision built without CUDA support.";
 #endif
@@ -20,6 +20,12 @@ namespace gpu {
  */
 bool gpuSupportCUDA(int minComputeCapabilityMajor, int minComputeCapabilityMinor, int minTotalDeviceMemory = 0);
 
+/**
+ * @brief Get the number of CUDA devices of the system
+ * @return The number of CUDA devices, 0 if CUDA is not supported
+ */
+int gpuDeviceCount();
+
 /**
  * @brief gpuInformationCUDA
  * @return string with all CUDA device(s) information
@@ -0,0 +1,227 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <aliceVision/types.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <numeric>
+#include <set>
+#include <vector>
+
+namespace aliceVision {
+namespace graph {
+
+/**
+ * @brief Immutable undirected view graph stored in Compressed Sparse Row form.
+ *
+ * The graph is built once from an iterable of image pairs and cannot be modified
+ * afterwards: node identifiers are remapped to a dense [0, N) range and the
+ * adjacency lists live in two contiguous arrays (offsets + neighbors). Compared
+ * to a node-based structure (lemon::ListGraph allocates every node and edge on
+ * the heap), traversals stream through memory, which is what the analysis passes
+ * on large view graphs (connected components, spanning tree) are bound by.
+ *
+ * For algorithms that need to edit the graph (e.g. bi-edge connectivity cuts),
+ * keep using graph::indexedGraph.
+ */
+class ViewGraph
+{
+  public:
+    ViewGraph() = default;
+
+    /**
+     * @brief Build the graph from an iterable of (IndexT, IndexT) pairs.
+     * Duplicate pairs are kept as parallel edges; self-pairs are ignored.
+     */
+    template<typename IterablePairs>
+    explicit ViewGraph(const IterablePairs& pairs)
+    {
+        // A-- Collect the node ids and remap them to dense indexes
+        for (const auto& pair : pairs)
+        {
+            if (pair.first == pair.second)
+                continue;
+            _nodeIds.push_back(pair.first);
+            _nodeIds.push_back(pair.second);
+        }
+        std::sort(_nodeIds.begin(), _nodeIds.end());
+        _nodeIds.erase(std::unique(_nodeIds.begin(), _nodeIds.end()), _nodeIds.end());
+        _nodeIds.shrink_to_fit();
+
+        // B-- Store the edges on the dense indexes
+        for (const auto& pair : pairs)
+        {
+            if (pair.first == pair.second)
+                continue;
+            _edges.emplace_back(nodeIndex(pair.first), nodeIndex(pair.second));
+        }
+        _edges.shrink_to_fit();
+
+        // C-- Build the CSR adjacency: count the degrees, then fill per node
+        _offsets.assign(_nodeIds.size() + 1, 0);
+        for (const auto& edge : _edges)
+        {
+            ++_offsets[edge.first + 1];
+            ++_offsets[edge.second + 1];
+        }
+        std::partial_sum(_offsets.begin(), _offsets.end(), _offsets.begin());
+
+        _neighbors.resize(2 * _edges.size());
+        std::vector<std::size_t> cursor(_offsets.begin(), _offsets.end() - 1);
+        for (const auto& edge : _edges)
+        {
+            _neighbors[cursor[edge.first]++] = edge.second;
+            _neighbors[cursor[edge.second]++] = edge.first;
+        }
+    }
+
+    std::size_t nodeCount() const { return _nodeIds.size(); }
+
+    std::size_t edgeCount() const { return _edges.size(); }
+
+    /// @return the original image id of the given dense node index
+    IndexT nodeId(std::size_t node) const { return _nodeIds[node]; }
+
+    /// @return the dense node index of the given image id
+    std::size_t nodeIndex(IndexT id) const
+    {
+        const auto it = std::lower_bound(_nodeIds.begin(), _nodeIds.end(), id);
+        assert(it != _nodeIds.end() && *it == id);
+        return std::distance(_nodeIds.begin(), it);
+    }
+
+    std::size_t degree(std::size_t node) const { return _offsets[node + 1] - _offsets[node]; }
+
+    /// @return the [begin, end) range of the neighbors of the given node
+    std::pair<const std::size_t*, const std::size_t*> neighbors(std::size_t node) const
+    {
+        return {_neighbors.data() + _offsets[node], _neighbors.data() + _offsets[node + 1]};
+    }
+
+    /**
+     * @brief Label the connected components of the graph.
+     * @param[out] outComponentPerNode The component label of each dense node index, in [0, count)
+     * @return the number of connected components
+     */
+    std::size_t connectedComponents(std::vector<std::size_t>& outComponentPerNode) const
+    {
+        // Union-find with path halving and union by size
+        std::vector<std::size_t> parent(nodeCount());
+        std::vector<std::size_t> size(nodeCount(), 1);
+        std::iota(parent.begin(), parent.end(), std::size_t(0));
+
+        const auto find = [&parent](std::size_t x) {
+            while (parent[x] != x)
+            {
+                parent[x] = parent[parent[x]];
+                x = parent[x];
+            }
+            return x;
+        };
+
+        for (const auto& edge : _edges)
+        {
+            std::size_t rootA = find(edge.first);
+            std::size_t rootB = find(edge.second);
+            if (rootA == rootB)
+                continue;
+            if (size[rootA] < size[rootB])
+                std::swap(rootA, rootB);
+            parent[rootB] = rootA;
+            size[rootA] += size[rootB];
+        }
+
+        // Compact the root ids into consecutive component labels
+        outComponentPerNode.assign(nodeCount(), 0);
+        std::size_t componentCount = 0;
+        std::vector<std::size_t> rootLabel(nodeCount(), std::numeric_limits<std::size_t>::max());
+        for (std::size_t node = 0; node < nodeCount(); ++node)
+        {
+            const std::size_t root = find(node);
+            if (rootLabel[root] == std::numeric_limits<std::size_t>::max())
+                rootLabel[root] = componentCount++;
+            outComponentPerNode[node] = rootLabel[root];
+        }
+        return componentCount;
+    }
+
+    /// @return the image ids of the largest connected component (ties broken by the first label met)
+    std::set<IndexT> largestConnectedComponent() const
+    {
+        std::vector<std::size_t> componentPerNode;
+        const std::size_t componentCount = connectedComponents(componentPerNode);
+
+        std::vector<std::size_t> componentSizes(componentCount, 0);
+        for (const std::size_t component : componentPerNode)
+            ++componentSizes[component];
+        const std::size_t largest =
+          std::distance(componentSizes.begin(), std::max_element(componentSizes.begin(), componentSizes.end()));
+
+        std::set<IndexT> ids;
+        for (std::size_t node = 0; node < nodeCount(); ++node)
+        {
+            if (componentPerNode[node] == largest)
+                ids.insert(nodeId(node));
+        }
+        return ids;
+    }
+
+    /**
+     * @brief Compute a minimum spanning forest with Kruskal's algorithm.
+     * @param[in] edgeWeights One weight per edge, in the construction order of the pairs
+     * @return the selected edges as image id pairs (nodeCount - componentCount edges)
+     */
+    std::vector<Pair> minimumSpanningTree(const std::vector<double>& edgeWeights) const
+    {
+        assert(edgeWeights.size() == _edges.size());
+
+        std::vector<std::size_t> order(_edges.size());
+        std::iota(order.begin(), order.end(), std::size_t(0));
+        std::sort(order.begin(), order.end(), [&edgeWeights](std::size_t a, std::size_t b) { return edgeWeights[a] < edgeWeights[b]; });
+
+        std::vector<std::size_t> parent(nodeCount());
+        std::iota(parent.begin(), parent.end(), std::size_t(0));
+        const auto find = [&parent](std::size_t x) {
+            while (parent[x] != x)
+            {
+                parent[x] = parent[parent[x]];
+                x = parent[x];
+            }
+            return x;
+        };
+
+        std::vector<Pair> tree;
+        tree.reserve(nodeCount() > 0 ? nodeCount() - 1 : 0);
+        for (const std::size_t edgeIndex : order)
+        {
+            const auto& edge = _edges[edgeIndex];
+            const std::size_t rootA = find(edge.first);
+            const std::size_t rootB = find(edge.second);
+            if (rootA == rootB)
+                continue;
+            parent[rootB] = rootA;
+            tree.emplace_back(nodeId(edge.first), nodeId(edge.second));
+        }
+        return tree;
+    }
+
+  private:
+    /// Sorted original image ids; the position of an id is its dense node index
+    std::vector<IndexT> _nodeIds;
+    /// Edges on dense node indexes, in construction order
+    std::vector<std::pair<std::size_t, std::size_t>> _edges;
+    /// CSR row offsets (nodeCount + 1 entries)
+    std::vector<std::size_t> _offsets;
+    /// CSR adjacency (2 * edgeCount entries)
+    std::vector<std::size_t> _neighbors;
+};
+
+}  // namespace graph
+}  // namespace aliceVision
@@ -12,3 +12,4 @@
 #include "aliceVision/graph/indexedGraphGraphvizExport.hpp"
 #include "aliceVision/graph/connectedComponent.hpp"
 #include "aliceVision/graph/Triplet.hpp"
+#include "aliceVision/graph/ViewGraph.hpp"
@@ -0,0 +1,79 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "aliceVision/graph/ViewGraph.hpp"
+
+#include <vector>
+
+#define BOOST_TEST_MODULE viewGraph
+
+#include <boost/test/unit_test.hpp>
+
+using namespace aliceVision;
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+    const graph::ViewGraph g(std::vector<Pair>{});
+
+    BOOST_CHECK_EQUAL(0, g.nodeCount());
+    BOOST_CHECK_EQUAL(0, g.edgeCount());
+
+    std::vector<std::size_t> components;
+    BOOST_CHECK_EQUAL(0, g.connectedComponents(components));
+}
+
+BOOST_AUTO_TEST_CASE(OneCC)
+{
+    // 10 -- 20 -- 30, sparse original ids
+    const std::vector<Pair> pairs = {{10, 20}, {20, 30}};
+    const graph::ViewGraph g(pairs);
+
+    BOOST_CHECK_EQUAL(3, g.nodeCount());
+    BOOST_CHECK_EQUAL(2, g.edgeCount());
+    BOOST_CHECK_EQUAL(2, g.degree(g.nodeIndex(20)));
+
+    std::vector<std::size_t> components;
+    BOOST_CHECK_EQUAL(1, g.connectedComponents(components));
+}
+
+BOOST_AUTO_TEST_CASE(TwoCC_KeepLargest)
+{
+    // {0,1,2} and {5,6}
+    const std::vector<Pair> pairs = {{0, 1}, {1, 2}, {5, 6}};
+    const graph::ViewGraph g(pairs);
+
+    std::vector<std::size_t> components;
+    BOOST_CHECK_EQUAL(2, g.connectedComponents(components));
+
+    const std::set<IndexT> largest = g.largestConnectedComponent();
+    const std::set<IndexT> expected = {0, 1, 2};
+    BOOST_CHECK(largest == expected);
+}
+
+BOOST_AUTO_TEST_CASE(MinimumSpanningTree)
+{
+    // A square with one heavy diagonal: the tree must drop the two heaviest edges
+    const std::vector<Pair> pairs = {{0, 1}, {1, 2}, {2, 3}, {3, 0}, {0, 2}};
+    const std::vector<double> weights = {1.0, 2.0, 1.0, 5.0, 4.0};
+    const graph::ViewGraph g(pairs);
+
+    const std::vector<Pair> tree = g.minimumSpanningTree(weights);
+
+    BOOST_CHECK_EQUAL(3, tree.size());
+    double total = 0.0;
+    for (const Pair& edge : tree)
+    {
+        if (edge == Pair(0, 1))
+            total += 1.0;
+        else if (edge == Pair(1, 2))
+            total += 2.0;
+        else if (edge == Pair(2, 3))
+            total += 1.0;
+        else
+            BOOST_FAIL("unexpected edge in the spanning tree");
+    }
+    BOOST_CHECK_EQUAL(4.0, total);
+}
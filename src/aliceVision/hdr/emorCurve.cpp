@@ -13,7 +13,7 @@
 namespace aliceVision {
 namespace hdr {
 
-static const double kEmor[kEmorMDimension][kEmorQuantization] = {
+alignas(64) static constexpr double kEmor[kEmorMDimension][kEmorQuantization] = {
   {0.000000e+000, 8.833750e-003, 1.497601e-002, 2.023710e-002, 2.498590e-002, 2.937536e-002, 3.348347e-002, 3.740247e-002, 4.116645e-002,
    4.481240e-002, 4.835121e-002, 5.178991e-002, 5.514774e-002, 5.843527e-002, 6.167138e-002, 6.485830e-002, 6.799864e-002, 7.109369e-002,
    7.414113e-002, 7.714684e-002, 8.011208e-002, 8.303313e-002, 8.591695e-002, 8.876004e-002, 9.156913e-002, 9.434381e-002, 9.708718e-002,
@@ -17,8 +17,8 @@
 namespace aliceVision {
 namespace hdr {
 
-const std::size_t kEmorMDimension = 26;
-const std::size_t kEmorQuantization = 1024;
+constexpr std::size_t kEmorMDimension = 26;
+constexpr std::size_t kEmorQuantization = 1024;
 
 /**
  * @brief hcurve accessor
@@ -13,7 +13,7 @@
 namespace aliceVision {
 namespace hdr {
 
-static const double kEmorInv[kEmorMDimension][kEmorQuantization] = {
+alignas(64) static constexpr double kEmorInv[kEmorMDimension][kEmorQuantization] = {
   {0.000000e+000, 1.477256e-003, 2.737898e-003, 3.858105e-003, 4.877501e-003, 5.819777e-003, 6.700519e-003, 7.532015e-003, 8.323902e-003,
    9.085110e-003, 9.816742e-003, 1.051719e-002, 1.119348e-002, 1.184927e-002, 1.248706e-002, 1.310836e-002, 1.371501e-002, 1.430845e-002,
    1.488919e-002, 1.545915e-002, 1.601947e-002, 1.656868e-002, 1.710786e-002, 1.763954e-002, 1.816409e-002, 1.868202e-002, 1.919384e-002,
@@ -50,6 +50,44 @@ void hdrMerge::process(const std::vector<image::Image<image::RGBfColor>>& images
                        image::Image<image::RGBfColor>& highLight,
                        image::Image<image::RGBfColor>& noMidLight,
                        MergingParams& mergingParams)
+{
+    std::vector<const image::Image<image::RGBfColor>*> imagePtrs;
+    for (const image::Image<image::RGBfColor>& img : images)
+    {
+        imagePtrs.push_back(&img);
+    }
+
+    process(imagePtrs, times, weight, response, radiance, lowLight, highLight, noMidLight, mergingParams);
+}
+
+void hdrMerge::process(const std::vector<std::shared_ptr<image::Image<image::RGBfColor>>>& images,
+                       const std::vector<double>& times,
+                       const rgbCurve& weight,
+                       const rgbCurve& response,
+                       image::Image<image::RGBfColor>& radiance,
+                       image::Image<image::RGBfColor>& lowLight,
+                       image::Image<image::RGBfColor>& highLight,
+                       image::Image<image::RGBfColor>& noMidLight,
+                       MergingParams& mergingParams)
+{
+    std::vector<const image::Image<image::RGBfColor>*> imagePtrs;
+    for (const std::shared_ptr<image::Image<image::RGBfColor>>& img : images)
+    {
+        imagePtrs.push_back(img.get());
+    }
+
+    process(imagePtrs, times, weight, response, radiance, lowLight, highLight, noMidLight, mergingParams);
+}
+
+void hdrMerge::process(const std::vector<const image::Image<image::RGBfColor>*>& images,
+                       const std::vector<double>& times,
+                       const rgbCurve& weight,
+                       const rgbCurve& response,
+                       image::Image<image::RGBfColor>& radiance,
+                       image::Image<image::RGBfColor>& lowLight,
+                       image::Image<image::RGBfColor>& highLight,
+                       image::Image<image::RGBfColor>& noMidLight,
+                       MergingParams& mergingParams)
 {
     // checks
     assert(!response.isEmpty());
@@ -57,8 +95,8 @@ void hdrMerge::process(const std::vector<image::Image<image::RGBfColor>>& images
     assert(images.size() == times.size());
 
     // get images width, height
-    const std::size_t width = images.front().width();
-    const std::size_t height = images.front().height();
+    const std::size_t width = images.front()->width();
+    const std::size_t height = images.front()->height();
 
     // resize and reset radiance image to 0.0
     radiance.resize(width, height, true, image::RGBfColor(0.f, 0.f, 0.f));
@@ -66,7 +104,7 @@ void hdrMerge::process(const std::vector<image::Image<image::RGBfColor>>& images
     ALICEVISION_LOG_TRACE("[hdrMerge] Images to fuse:");
     for (int i = 0; i < images.size(); ++i)
     {
-        ALICEVISION_LOG_TRACE(images[i].width() << "x" << images[i].height() << ", time: " << times[i]);
+        ALICEVISION_LOG_TRACE(images[i]->width() << "x" << images[i]->height() << ", time: " << times[i]);
     }
 
     rgbCurve weightShortestExposure = weight;
@@ -105,14 +143,14 @@ void hdrMerge::process(const std::vector<image::Image<image::RGBfColor>>& images
             {
                 int firstIndex = mergingParams.refImageIndex;
                 while (firstIndex > 0 &&
-                       (response(images[firstIndex](y, x)(channel), channel) > v_minValue[channel] || firstIndex == images.size() - 1))
+                       (response((*images[firstIndex])(y, x)(channel), channel) > v_minValue[channel] || firstIndex == images.size() - 1))
                 {
                     firstIndex--;
                 }
                 v_firstIndex.push_back(firstIndex);
 
                 int lastIndex = v_firstIndex[channel] + 1;
-                while (lastIndex < images.size() - 1 && response(images[lastIndex](y, x)(channel), channel) < v_maxValue[channel])
+                while (lastIndex < images.size() - 1 && response((*images[lastIndex])(y, x)(channel), channel) < v_maxValue[channel])
                 {
                     lastIndex++;
                 }
@@ -128,7 +166,7 @@ void hdrMerge::process(const std::vector<image::Image<image::RGBfColor>>& images
 
                 for (std::size_t e = 0; e < images.size(); ++e)
                 {
-                    const double value = images[e](y, x)(channel);
+                    const double value = (*images[e])(y, x)(channel);
                     const double resp = response(value, channel);
                     const double normalizedValue = resp / times[e];
                     double coeff = std::max(0.001f,
@@ -201,6 +239,42 @@ void hdrMerge::postProcessHighlight(const std::vector<image::Image<image::RGBfCo
                                     float targetCameraExposure,
                                     float highlightCorrectionFactor,
                                     float highlightTargetLux)
+{
+    std::vector<const image::Image<image::RGBfColor>*> imagePtrs;
+    for (const image::Image<image::RGBfColor>& img : images)
+    {
+        imagePtrs.push_back(&img);
+    }
+
+    postProcessHighlight(imagePtrs, times, weight, response, radiance, targetCameraExposure, highlightCorrectionFactor, highlightTargetLux);
+}
+
+void hdrMerge::postProcessHighlight(const std::vector<std::shared_ptr<image::Image<image::RGBfColor>>>& images,
+                                    const std::vector<double>& times,
+                                    const rgbCurve& weight,
+                                    const rgbCurve& response,
+                                    image::Image<image::RGBfColor>& radiance,
+                                    float targetCameraExposure,
+                                    float highlightCorrectionFactor,
+                                    float highlightTargetLux)
+{
+    std::vector<const image::Image<image::RGBfColor>*> imagePtrs;
+    for (const std::shared_ptr<image::Image<image::RGBfColor>>& img : images)
+    {
+        imagePtrs.push_back(img.get());
+    }
+
+    postProcessHighlight(imagePtrs, times, weight, response, radiance, targetCameraExposure, highlightCorrectionFactor, highlightTargetLux);
+}
+
+void hdrMerge::postProcessHighlight(const std::vector<const image::Image<image::RGBfColor>*>& images,
+                                    const std::vector<double>& times,
+                                    const rgbCurve& weight,
+                                    const rgbCurve& response,
+                                    image::Image<image::RGBfColor>& radiance,
+                                    float targetCameraExposure,
+                                    float highlightCorrectionFactor,
+                                    float highlightTargetLux)
 {
     // checks
     assert(!response.isEmpty());
@@ -210,7 +284,7 @@ void hdrMerge::postProcessHighlight(const std::vector<image::Image<image::RGBfCo
     if (highlightCorrectionFactor == 0.0f)
         return;
 
-    const image::Image<image::RGBfColor>& inputImage = images.front();
+    const image::Image<image::RGBfColor>& inputImage = *images.front();
     // Target Camera Exposure = 1 for EV-0 (iso=100, shutter=1, fnumber=1) => 2.5 lux
     float highlightTarget = highlightTargetLux * targetCameraExposure * 2.5;
 
@@ -8,6 +8,7 @@
 #include "rgbCurve.hpp"
 #include <aliceVision/image/all.hpp>
 #include <cmath>
+#include <memory>
 
 namespace aliceVision {
 namespace hdr {
@@ -42,6 +43,20 @@ class hdrMerge
                  image::Image<image::RGBfColor>& noMidLight,
                  MergingParams& mergingParams);
 
+    /**
+     * @brief Same merge over images held through shared pointers (e.g. by an image cache),
+     * avoiding a copy of the brackets.
+     */
+    void process(const std::vector<std::shared_ptr<image::Image<image::RGBfColor>>>& images,
+                 const std::vector<double>& times,
+                 const rgbCurve& weight,
+                 const rgbCurve& response,
+                 image::Image<image::RGBfColor>& radiance,
+                 image::Image<image::RGBfColor>& lowLight,
+                 image::Image<image::RGBfColor>& highLight,
+                 image::Image<image::RGBfColor>& noMidLight,
+                 MergingParams& mergingParams);
+
     void postProcessHighlight(const std::vector<image::Image<image::RGBfColor>>& images,
                               const std::vector<double>& times,
                               const rgbCurve& weight,
@@ -50,6 +65,35 @@ class hdrMerge
                               float clampedValueCorrection,
                               float targetCameraExposure,
                               float highlightMaxLumimance);
+
+    void postProcessHighlight(const std::vector<std::shared_ptr<image::Image<image::RGBfColor>>>& images,
+                              const std::vector<double>& times,
+                              const rgbCurve& weight,
+                              const rgbCurve& response,
+                              image::Image<image::RGBfColor>& radiance,
+                              float clampedValueCorrection,
+                              float targetCameraExposure,
+                              float highlightMaxLumimance);
+
+  private:
+    void process(const std::vector<const image::Image<image::RGBfColor>*>& images,
+                 const std::vector<double>& times,
+                 const rgbCurve& weight,
+                 const rgbCurve& response,
+                 image::Image<image::RGBfColor>& radiance,
+                 image::Image<image::RGBfColor>& lowLight,
+                 image::Image<image::RGBfColor>& highLight,
+                 image::Image<image::RGBfColor>& noMidLight,
+                 MergingParams& mergingParams);
+
+    void postProcessHighlight(const std::vector<const image::Image<image::RGBfColor>*>& images,
+                              const std::vector<double>& times,
+                              const rgbCurve& weight,
+                              const rgbCurve& response,
+                              image::Image<image::RGBfColor>& radiance,
+                              float clampedValueCorrection,
+                              float targetCameraExposure,
+                              float highlightMaxLumimance);
 };
 
 }  // namespace hdr
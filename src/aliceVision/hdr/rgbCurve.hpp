@@ -240,11 +240,26 @@ class rgbCurve
 
     /**
      * @brief Right accessor
+     * Defined inline so that the linear interpolation can be inlined in per-pixel loops.
      * @param[in] sample
      * @param[in] channel
      * @return the value at the index corresponding to the sample of the channel curve
      */
-    float operator()(float sample, std::size_t channel) const;
+    float operator()(float sample, std::size_t channel) const
+    {
+        assert(channel < _data.size());
+
+        float fractionalPart = 0.0;
+        std::size_t infIndex = getIndex(sample, fractionalPart);
+
+        /* Do not interpolate 1.0 */
+        if (infIndex == getSize() - 1)
+        {
+            return _data[channel][infIndex];
+        }
+
+        return (1.0f - fractionalPart) * _data[channel][infIndex] + fractionalPart * _data[channel][infIndex + 1];
+    }
 
     /**
      * @brief Operator+ Call sum method
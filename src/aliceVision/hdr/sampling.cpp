@@ -147,6 +147,38 @@ void square(image::Image<image::RGBfColor>& dest, const Eigen::Matrix<image::RGB
     }
 }
 
+namespace {
+
+/**
+ * @brief Bounded uniform sample set over a stream of candidates (reservoir sampling).
+ * Each candidate of the stream ends up in the reservoir with probability capacity / seen.
+ */
+struct SampleReservoir
+{
+    std::vector<ImageSample> samples;
+    std::size_t seen = 0;
+
+    void add(const ImageSample& sample, std::size_t capacity, std::mt19937& rng)
+    {
+        ++seen;
+
+        if (samples.size() < capacity)
+        {
+            samples.push_back(sample);
+            return;
+        }
+
+        std::uniform_int_distribution<std::size_t> distribution(0, seen - 1);
+        const std::size_t pos = distribution(rng);
+        if (pos < capacity)
+        {
+            samples[pos] = sample;
+        }
+    }
+};
+
+}  // namespace
+
 bool Sampling::extractSamplesFromImages(std::vector<ImageSample>& out_samples,
                                         const std::vector<std::string>& imagePaths,
                                         const std::vector<IndexT>& viewIds,
@@ -158,29 +190,12 @@ bool Sampling::extractSamplesFromImages(std::vector<ImageSample>& out_samples,
                                         const Sampling::Params params,
                                         const bool simplified)
 {
-    const int radiusp1 = params.radius + 1;
-    const int diameter = (params.radius * 2) + 1;
-    const double area = double(diameter * diameter);
-
-    std::vector<std::pair<int, int>> vec_blocks;
-    const auto step = params.blockSize - diameter;
-    vec_blocks.reserve(int(imageHeight / step) * int(imageWidth / step));
-    for (int cy = 0; cy < imageHeight; cy += step)
-    {
-        for (int cx = 0; cx < imageWidth; cx += step)
-        {
-            vec_blocks.push_back(std::make_pair(cx, cy));
-        }
-    }
-
     Image<RGBfColor> img;
 
     // For all brackets, For each pixel, compute image sample
     image::Image<ImageSample> samples(imageWidth, imageHeight, true);
     for (unsigned int idBracket = 0; idBracket < imagePaths.size(); ++idBracket)
     {
-        const double exposure = times[idBracket];
-
         // Load image
         readImage(imagePaths[idBracket], img, imgReadOptions);
 
@@ -194,234 +209,409 @@ bool Sampling::extractSamplesFromImages(std::vector<ImageSample>& out_samples,
             throw std::runtime_error(ss.str());
         }
 
-        if (simplified)
+        analyzeBracket(samples, img, viewIds[idBracket], times[idBracket], params, simplified);
+    }
+
+    return selectSamples(out_samples, samples, channelQuantization, params, simplified);
+}
+
+bool Sampling::extractSamplesFromImages(std::vector<ImageSample>& out_samples,
+                                        const std::vector<std::shared_ptr<image::Image<image::RGBfColor>>>& images,
+                                        const std::vector<IndexT>& viewIds,
+                                        const std::vector<double>& times,
+                                        const size_t imageWidth,
+                                        const size_t imageHeight,
+                                        const size_t channelQuantization,
+                                        const Sampling::Params params,
+                                        const bool simplified)
+{
+    // For all brackets, For each pixel, compute image sample
+    image::Image<ImageSample> samples(imageWidth, imageHeight, true);
+    for (unsigned int idBracket = 0; idBracket < images.size(); ++idBracket)
+    {
+        const Image<RGBfColor>& img = *images[idBracket];
+
+        if (img.width() != imageWidth || img.height() != imageHeight)
         {
-            // Luminance statistics are calculated from a subsampled square, centered and rotated by 45�.
-            // 2 vertices of this square are the centers of the longest sides of the image.
-            // Such a shape is suitable for both fisheye and classic images.
+            std::stringstream ss;
+            ss << "Failed to extract samples, the images with multi-bracketing do not have the same image resolution.\n"
+               << " Current image resolution is: " << img.width() << "x" << img.height() << ", instead of: " << imageWidth << "x" << imageHeight
+               << ".\n"
+               << "Current view id is: " << viewIds[idBracket];
+            throw std::runtime_error(ss.str());
+        }
 
-            const int H = imageHeight;
-            const int W = imageWidth;
-            const int hH = imageHeight / 2;
-            const int hW = imageWidth / 2;
+        analyzeBracket(samples, img, viewIds[idBracket], times[idBracket], params, simplified);
+    }
 
-            const int a1 = (H <= W) ? hW : hH;
-            const int a2 = (H <= W) ? hW : W - hH;
-            const int a3 = (H <= W) ? H - hW : hH;
-            const int a4 = (H <= W) ? hW + H : W + hH;
+    return selectSamples(out_samples, samples, channelQuantization, params, simplified);
+}
 
-            // All rows must be considered if image orientation is landscape (H < W)
-            // Only imgW rows centered on imgH/2 must be considered if image orientation is portrait (H > W)
-            const int rmin = (H <= W) ? 0 : (H - W) / 2;
-            const int rmax = (H <= W) ? H : (H + W) / 2;
+bool Sampling::extractSamplesFromImagesStreaming(std::vector<ImageSample>& out_samples,
+                                                 const std::vector<std::string>& imagePaths,
+                                                 const std::vector<IndexT>& viewIds,
+                                                 const std::vector<double>& times,
+                                                 const size_t imageWidth,
+                                                 const size_t imageHeight,
+                                                 const size_t channelQuantization,
+                                                 const image::ImageReadOptions& imgReadOptions,
+                                                 const Sampling::Params params,
+                                                 const bool simplified)
+{
+    if (simplified)
+    {
+        // The simplified pattern only samples a sparse diagonal band, nothing to win with stripes
+        return extractSamplesFromImages(
+          out_samples, imagePaths, viewIds, times, imageWidth, imageHeight, channelQuantization, imgReadOptions, params, simplified);
+    }
 
-            const int sampling = 16;
+    const int diameter = (params.radius * 2) + 1;
+    const int step = params.blockSize - diameter;
 
-#pragma omp parallel for
-            for (int r = rmin; r < rmax; r = r + sampling)
-            {
-                const int cmin = (r < hH) ? a1 - r : r - a3;
-                const int cmax = (r < hH) ? a2 + r : a4 - r;
+    std::map<UniqueDescriptor, SampleReservoir> reservoirs;
 
-                for (int c = cmin; c < cmax; c = c + sampling)
-                {
-                    PixelDescription pd;
+    std::random_device randomDevice;
+    std::mt19937 rng(randomDevice());
 
-                    pd.srcId = viewIds[idBracket];
-                    pd.exposure = exposure;
-                    pd.mean.r() = img(r, c).r();
-                    pd.mean.g() = img(r, c).g();
-                    pd.mean.b() = img(r, c).b();
-                    pd.variance.r() = 0.0;
-                    pd.variance.g() = 0.0;
-                    pd.variance.b() = 0.0;
-
-                    samples(r, c).x = c;
-                    samples(r, c).y = r;
-                    samples(r, c).descriptions.push_back(pd);
-                }
-            }
-        }
-        else
+    // Process the brackets stripe by stripe, a stripe being one row of the block grid
+    // used by analyzeBracket, so the sample patches are the same as with a full decode
+    for (int cy = 0; cy < int(imageHeight); cy += step)
+    {
+        const int stripeHeight = std::min(params.blockSize, int(imageHeight) - cy);
+
+        image::Image<ImageSample> samples(imageWidth, stripeHeight, true);
+
+        for (unsigned int idBracket = 0; idBracket < imagePaths.size(); ++idBracket)
         {
-#pragma omp parallel for
-            for (int idx = 0; idx < vec_blocks.size(); ++idx)
+            // Windowed decode of the stripe only
+            Image<RGBfColor> stripe;
+            const oiio::ROI roi(0, int(imageWidth), cy, cy + stripeHeight);
+            readImageRegion(imagePaths[idBracket], roi, stripe, imgReadOptions);
+
+            if (stripe.width() != imageWidth || stripe.height() != stripeHeight)
             {
-                int cx = vec_blocks[idx].first;
-                int cy = vec_blocks[idx].second;
+                std::stringstream ss;
+                ss << "Failed to extract samples, the images with multi-bracketing do not have the same image resolution.\n"
+                   << "Current image path is: " << imagePaths[idBracket];
+                throw std::runtime_error(ss.str());
+            }
 
-                int blockWidth = ((img.width() - cx) > params.blockSize) ? params.blockSize : img.width() - cx;
-                int blockHeight = ((img.height() - cy) > params.blockSize) ? params.blockSize : img.height() - cy;
+            analyzeBracket(samples, stripe, viewIds[idBracket], times[idBracket], params, simplified);
+        }
 
-                auto blockInput = img.block(cy, cx, blockHeight, blockWidth);
-                auto blockOutput = samples.block(cy, cx, blockHeight, blockWidth);
+        filterDescriptions(samples, params);
 
-                // Stats for deviation
-                Image<Rgb<double>> imgIntegral, imgIntegralSquare;
-                Image<RGBfColor> imgSquare;
+        // Feed the valid samples of this stripe to the per stratum reservoirs
+        for (int y = params.radius; y < samples.height() - params.radius; ++y)
+        {
+            for (int x = params.radius; x < samples.width() - params.radius; ++x)
+            {
+                ImageSample& sample = samples(y, x);
+                if (sample.descriptions.empty())
+                {
+                    continue;
+                }
 
-                square(imgSquare, blockInput);
-                integral(imgIntegral, blockInput);
-                integral(imgIntegralSquare, imgSquare);
+                // Move the coordinates back to the full image frame
+                sample.y += cy;
 
-                for (int y = radiusp1; y < imgIntegral.height() - params.radius; ++y)
+                UniqueDescriptor desc;
+                for (int k = 0; k < sample.descriptions.size(); ++k)
                 {
-                    for (int x = radiusp1; x < imgIntegral.width() - params.radius; ++x)
+                    desc.exposure = sample.descriptions[k].exposure;
+
+                    for (int channel = 0; channel < 3; ++channel)
                     {
-                        image::Rgb<double> S1 = imgIntegral(y + params.radius, x + params.radius) + imgIntegral(y - radiusp1, x - radiusp1) -
-                                                imgIntegral(y + params.radius, x - radiusp1) - imgIntegral(y - radiusp1, x + params.radius);
-                        image::Rgb<double> S2 = imgIntegralSquare(y + params.radius, x + params.radius) +
-                                                imgIntegralSquare(y - radiusp1, x - radiusp1) - imgIntegralSquare(y + params.radius, x - radiusp1) -
-                                                imgIntegralSquare(y - radiusp1, x + params.radius);
-
-                        PixelDescription pd;
-
-                        pd.srcId = viewIds[idBracket];
-                        pd.exposure = exposure;
-                        pd.mean.r() = blockInput(y, x).r();
-                        pd.mean.g() = blockInput(y, x).g();
-                        pd.mean.b() = blockInput(y, x).b();
-                        pd.variance.r() = (S2.r() - (S1.r() * S1.r()) / area) / area;
-                        pd.variance.g() = (S2.g() - (S1.g() * S1.g()) / area) / area;
-                        pd.variance.b() = (S2.b() - (S1.b() * S1.b()) / area) / area;
-
-                        blockOutput(y, x).x = cx + x;
-                        blockOutput(y, x).y = cy + y;
-                        blockOutput(y, x).descriptions.push_back(pd);
+                        desc.channel = channel;
+                        desc.quantizedValue = int(std::round(sample.descriptions[k].mean(channel) * (channelQuantization - 1)));
+                        if (desc.quantizedValue < 0 || desc.quantizedValue >= channelQuantization)
+                        {
+                            continue;
+                        }
+
+                        reservoirs[desc].add(sample, params.maxCountSample, rng);
                     }
                 }
             }
         }
     }
 
-    if (samples.width() == 0)
+    // A sample may sit in several reservoirs, only export it once
+    std::set<std::pair<size_t, size_t>> exported;
+    for (const auto& item : reservoirs)
     {
-        // Why? just to be sure
-        return false;
+        for (const ImageSample& sample : item.second.samples)
+        {
+            if (exported.insert(std::make_pair(sample.x, sample.y)).second)
+            {
+                out_samples.push_back(sample);
+            }
+        }
     }
 
-    if (!simplified)
+    return true;
+}
+
+void Sampling::analyzeBracket(image::Image<ImageSample>& samples,
+                              const image::Image<image::RGBfColor>& img,
+                              IndexT viewId,
+                              double exposure,
+                              const Sampling::Params& params,
+                              bool simplified)
+{
+    const int radiusp1 = params.radius + 1;
+    const int diameter = (params.radius * 2) + 1;
+    const double area = double(diameter * diameter);
+
+    if (simplified)
     {
-// Create samples image
+        // Luminance statistics are calculated from a subsampled square, centered and rotated by 45�.
+        // 2 vertices of this square are the centers of the longest sides of the image.
+        // Such a shape is suitable for both fisheye and classic images.
+
+        const int H = img.height();
+        const int W = img.width();
+        const int hH = img.height() / 2;
+        const int hW = img.width() / 2;
+
+        const int a1 = (H <= W) ? hW : hH;
+        const int a2 = (H <= W) ? hW : W - hH;
+        const int a3 = (H <= W) ? H - hW : hH;
+        const int a4 = (H <= W) ? hW + H : W + hH;
+
+        // All rows must be considered if image orientation is landscape (H < W)
+        // Only imgW rows centered on imgH/2 must be considered if image orientation is portrait (H > W)
+        const int rmin = (H <= W) ? 0 : (H - W) / 2;
+        const int rmax = (H <= W) ? H : (H + W) / 2;
+
+        const int sampling = 16;
+
 #pragma omp parallel for
-        for (int y = params.radius; y < samples.height() - params.radius; ++y)
+        for (int r = rmin; r < rmax; r = r + sampling)
         {
-            for (int x = params.radius; x < samples.width() - params.radius; ++x)
+            const int cmin = (r < hH) ? a1 - r : r - a3;
+            const int cmax = (r < hH) ? a2 + r : a4 - r;
+
+            for (int c = cmin; c < cmax; c = c + sampling)
             {
-                ImageSample& sample = samples(y, x);
-                if (sample.descriptions.size() < 2)
+                PixelDescription pd;
+
+                pd.srcId = viewId;
+                pd.exposure = exposure;
+                pd.mean.r() = img(r, c).r();
+                pd.mean.g() = img(r, c).g();
+                pd.mean.b() = img(r, c).b();
+                pd.variance.r() = 0.0;
+                pd.variance.g() = 0.0;
+                pd.variance.b() = 0.0;
+
+                samples(r, c).x = c;
+                samples(r, c).y = r;
+                samples(r, c).descriptions.push_back(pd);
+            }
+        }
+    }
+    else
+    {
+        std::vector<std::pair<int, int>> vec_blocks;
+        const auto step = params.blockSize - diameter;
+        vec_blocks.reserve(int(img.height() / step) * int(img.width() / step));
+        for (int cy = 0; cy < img.height(); cy += step)
+        {
+            for (int cx = 0; cx < img.width(); cx += step)
+            {
+                vec_blocks.push_back(std::make_pair(cx, cy));
+            }
+        }
+
+#pragma omp parallel for
+        for (int idx = 0; idx < vec_blocks.size(); ++idx)
+        {
+            int cx = vec_blocks[idx].first;
+            int cy = vec_blocks[idx].second;
+
+            int blockWidth = ((img.width() - cx) > params.blockSize) ? params.blockSize : img.width() - cx;
+            int blockHeight = ((img.height() - cy) > params.blockSize) ? params.blockSize : img.height() - cy;
+
+            auto blockInput = img.block(cy, cx, blockHeight, blockWidth);
+            auto blockOutput = samples.block(cy, cx, blockHeight, blockWidth);
+
+            // Stats for deviation
+            Image<Rgb<double>> imgIntegral, imgIntegralSquare;
+            Image<RGBfColor> imgSquare;
+
+            square(imgSquare, blockInput);
+            integral(imgIntegral, blockInput);
+            integral(imgIntegralSquare, imgSquare);
+
+            for (int y = radiusp1; y < imgIntegral.height() - params.radius; ++y)
+            {
+                for (int x = radiusp1; x < imgIntegral.width() - params.radius; ++x)
                 {
-                    continue;
+                    image::Rgb<double> S1 = imgIntegral(y + params.radius, x + params.radius) + imgIntegral(y - radiusp1, x - radiusp1) -
+                                            imgIntegral(y + params.radius, x - radiusp1) - imgIntegral(y - radiusp1, x + params.radius);
+                    image::Rgb<double> S2 = imgIntegralSquare(y + params.radius, x + params.radius) +
+                                            imgIntegralSquare(y - radiusp1, x - radiusp1) - imgIntegralSquare(y + params.radius, x - radiusp1) -
+                                            imgIntegralSquare(y - radiusp1, x + params.radius);
+
+                    PixelDescription pd;
+
+                    pd.srcId = viewId;
+                    pd.exposure = exposure;
+                    pd.mean.r() = blockInput(y, x).r();
+                    pd.mean.g() = blockInput(y, x).g();
+                    pd.mean.b() = blockInput(y, x).b();
+                    pd.variance.r() = (S2.r() - (S1.r() * S1.r()) / area) / area;
+                    pd.variance.g() = (S2.g() - (S1.g() * S1.g()) / area) / area;
+                    pd.variance.b() = (S2.b() - (S1.b() * S1.b()) / area) / area;
+
+                    blockOutput(y, x).x = cx + x;
+                    blockOutput(y, x).y = cy + y;
+                    blockOutput(y, x).descriptions.push_back(pd);
                 }
+            }
+        }
+    }
+}
 
-                int last_ok = 0;
+void Sampling::filterDescriptions(image::Image<ImageSample>& samples, const Params& params)
+{
+#pragma omp parallel for
+    for (int y = params.radius; y < samples.height() - params.radius; ++y)
+    {
+        for (int x = params.radius; x < samples.width() - params.radius; ++x)
+        {
+            ImageSample& sample = samples(y, x);
+            if (sample.descriptions.size() < 2)
+            {
+                continue;
+            }
 
-                // Make sure we don't have a patch with high variance on any bracket.
-                // If the variance is too high somewhere, ignore the whole coordinate samples
-                bool valid = true;
-                const float maxVariance = 0.05f;
-                for (int k = 0; k < sample.descriptions.size(); ++k)
+            int last_ok = 0;
+
+            // Make sure we don't have a patch with high variance on any bracket.
+            // If the variance is too high somewhere, ignore the whole coordinate samples
+            bool valid = true;
+            const float maxVariance = 0.05f;
+            for (int k = 0; k < sample.descriptions.size(); ++k)
+            {
+                if (sample.descriptions[k].variance.r() > maxVariance || sample.descriptions[k].variance.g() > maxVariance ||
+                    sample.descriptions[k].variance.b() > maxVariance)
                 {
-                    if (sample.descriptions[k].variance.r() > maxVariance || sample.descriptions[k].variance.g() > maxVariance ||
-                        sample.descriptions[k].variance.b() > maxVariance)
-                    {
-                        valid = false;
-                        break;
-                    }
+                    valid = false;
+                    break;
                 }
+            }
+
+            if (!valid)
+            {
+                sample.descriptions.clear();
+                continue;
+            }
 
-                if (!valid)
+            // Makes sure the curve is monotonic
+            int firstvalid = -1;
+            int lastvalid = 0;
+            for (std::size_t k = 1; k < sample.descriptions.size(); ++k)
+            {
+                bool valid = false;
+
+                // Threshold on the max values, to avoid using fully saturated pixels
+                // TODO: on RAW images, values can be higher. May need to be computed dynamically?
+                const float maxValue = 0.99f;
+                if (sample.descriptions[k].mean.r() > maxValue || sample.descriptions[k].mean.g() > maxValue ||
+                    sample.descriptions[k].mean.b() > maxValue)
                 {
-                    sample.descriptions.clear();
                     continue;
                 }
 
-                // Makes sure the curve is monotonic
-                int firstvalid = -1;
-                int lastvalid = 0;
-                for (std::size_t k = 1; k < sample.descriptions.size(); ++k)
+                // Ensures that at least one channel is strictly increasing with increasing exposure
+                // TODO: check "exposure" params, we may have the same exposure multiple times
+                const float minIncreaseRatio = 1.004f;
+                if (sample.descriptions[k].mean.r() > minIncreaseRatio * sample.descriptions[k - 1].mean.r() ||
+                    sample.descriptions[k].mean.g() > minIncreaseRatio * sample.descriptions[k - 1].mean.g() ||
+                    sample.descriptions[k].mean.b() > minIncreaseRatio * sample.descriptions[k - 1].mean.b())
                 {
-                    bool valid = false;
-
-                    // Threshold on the max values, to avoid using fully saturated pixels
-                    // TODO: on RAW images, values can be higher. May need to be computed dynamically?
-                    const float maxValue = 0.99f;
-                    if (sample.descriptions[k].mean.r() > maxValue || sample.descriptions[k].mean.g() > maxValue ||
-                        sample.descriptions[k].mean.b() > maxValue)
-                    {
-                        continue;
-                    }
+                    valid = true;
+                }
 
-                    // Ensures that at least one channel is strictly increasing with increasing exposure
-                    // TODO: check "exposure" params, we may have the same exposure multiple times
-                    const float minIncreaseRatio = 1.004f;
-                    if (sample.descriptions[k].mean.r() > minIncreaseRatio * sample.descriptions[k - 1].mean.r() ||
-                        sample.descriptions[k].mean.g() > minIncreaseRatio * sample.descriptions[k - 1].mean.g() ||
-                        sample.descriptions[k].mean.b() > minIncreaseRatio * sample.descriptions[k - 1].mean.b())
-                    {
-                        valid = true;
-                    }
+                // Ensures that the values of each channel are increasing with increasing exposure
+                if (sample.descriptions[k].mean.r() < sample.descriptions[k - 1].mean.r() ||
+                    sample.descriptions[k].mean.g() < sample.descriptions[k - 1].mean.g() ||
+                    sample.descriptions[k].mean.b() < sample.descriptions[k - 1].mean.b())
+                {
+                    valid = false;
+                }
 
-                    // Ensures that the values of each channel are increasing with increasing exposure
-                    if (sample.descriptions[k].mean.r() < sample.descriptions[k - 1].mean.r() ||
-                        sample.descriptions[k].mean.g() < sample.descriptions[k - 1].mean.g() ||
-                        sample.descriptions[k].mean.b() < sample.descriptions[k - 1].mean.b())
+                // If we have enough information to analyze the chrominance
+                const float minGlobalValue = 0.1f;
+                if (sample.descriptions[k - 1].mean.norm() > minGlobalValue)
+                {
+                    // Check that both colors are similars
+                    const float n1 = sample.descriptions[k - 1].mean.norm();
+                    const float n2 = sample.descriptions[k].mean.norm();
+                    const float dot = sample.descriptions[k - 1].mean.dot(sample.descriptions[k].mean);
+                    const float cosa = dot / (n1 * n2);
+
+                    const float maxCosa = 0.95f;  // ~ 18deg
+                    if (cosa < maxCosa)
                     {
                         valid = false;
                     }
+                }
 
-                    // If we have enough information to analyze the chrominance
-                    const float minGlobalValue = 0.1f;
-                    if (sample.descriptions[k - 1].mean.norm() > minGlobalValue)
-                    {
-                        // Check that both colors are similars
-                        const float n1 = sample.descriptions[k - 1].mean.norm();
-                        const float n2 = sample.descriptions[k].mean.norm();
-                        const float dot = sample.descriptions[k - 1].mean.dot(sample.descriptions[k].mean);
-                        const float cosa = dot / (n1 * n2);
-
-                        const float maxCosa = 0.95f;  // ~ 18deg
-                        if (cosa < maxCosa)
-                        {
-                            valid = false;
-                        }
-                    }
-
-                    if (valid)
+                if (valid)
+                {
+                    if (firstvalid < 0)
                     {
-                        if (firstvalid < 0)
-                        {
-                            firstvalid = int(k) - 1;
-                        }
-                        lastvalid = int(k);
+                        firstvalid = int(k) - 1;
                     }
-                    else
+                    lastvalid = int(k);
+                }
+                else
+                {
+                    if (lastvalid != 0)
                     {
-                        if (lastvalid != 0)
-                        {
-                            break;
-                        }
+                        break;
                     }
                 }
+            }
 
-                if (lastvalid == 0 || firstvalid < 0)
-                {
-                    sample.descriptions.clear();
-                    continue;
-                }
+            if (lastvalid == 0 || firstvalid < 0)
+            {
+                sample.descriptions.clear();
+                continue;
+            }
 
-                if (firstvalid > 0 || lastvalid < int(sample.descriptions.size()) - 1)
+            if (firstvalid > 0 || lastvalid < int(sample.descriptions.size()) - 1)
+            {
+                std::vector<PixelDescription> replace;
+                for (int pos = firstvalid; pos <= lastvalid; ++pos)
                 {
-                    std::vector<PixelDescription> replace;
-                    for (int pos = firstvalid; pos <= lastvalid; ++pos)
-                    {
-                        replace.push_back(sample.descriptions[pos]);
-                    }
-                    sample.descriptions = replace;
+                    replace.push_back(sample.descriptions[pos]);
                 }
+                sample.descriptions = replace;
             }
         }
     }
+}
+
+bool Sampling::selectSamples(std::vector<ImageSample>& out_samples,
+                             image::Image<ImageSample>& samples,
+                             size_t channelQuantization,
+                             const Sampling::Params& params,
+                             bool simplified)
+{
+    if (samples.width() == 0)
+    {
+        // Why? just to be sure
+        return false;
+    }
+
+    if (!simplified)
+    {
+        filterDescriptions(samples, params);
+    }
 
     // Get a counter for all unique descriptors
     using Coordinates = std::pair<int, int>;
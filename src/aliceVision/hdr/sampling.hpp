@@ -77,6 +77,58 @@ class Sampling
                                          const Params params,
                                          const bool simplified = false);
 
+    /**
+     * @brief Streaming variant of extractSamplesFromImages.
+     * The brackets are decoded stripe by stripe through windowed reads and the candidate
+     * samples of each (exposure, channel, quantized value) stratum are kept in a bounded
+     * reservoir, so the full resolution brackets never reside in memory at the same time.
+     * The simplified sampling pattern only touches a sparse diagonal band, for which a
+     * stripe based decode does not help; in that case the full decode is used.
+     */
+    static bool extractSamplesFromImagesStreaming(std::vector<ImageSample>& out_samples,
+                                                  const std::vector<std::string>& imagePaths,
+                                                  const std::vector<IndexT>& viewIds,
+                                                  const std::vector<double>& times,
+                                                  const size_t imageWidth,
+                                                  const size_t imageHeight,
+                                                  const size_t channelQuantization,
+                                                  const image::ImageReadOptions& imgReadOptions,
+                                                  const Params params,
+                                                  const bool simplified = false);
+
+    /**
+     * @brief Same extraction over images which are already decoded in memory,
+     * so that a caller holding the brackets (e.g. in an image cache) does not pay a second decode.
+     */
+    static bool extractSamplesFromImages(std::vector<ImageSample>& out_samples,
+                                         const std::vector<std::shared_ptr<image::Image<image::RGBfColor>>>& images,
+                                         const std::vector<IndexT>& viewIds,
+                                         const std::vector<double>& times,
+                                         const size_t imageWidth,
+                                         const size_t imageHeight,
+                                         const size_t channelQuantization,
+                                         const Params params,
+                                         const bool simplified = false);
+
+  private:
+    /// Accumulate the sample descriptions of one bracket into the per-pixel samples image
+    static void analyzeBracket(image::Image<ImageSample>& samples,
+                               const image::Image<image::RGBfColor>& img,
+                               IndexT viewId,
+                               double exposure,
+                               const Params& params,
+                               bool simplified);
+
+    /// Filter the per-pixel samples and select a bounded set of output samples
+    static bool selectSamples(std::vector<ImageSample>& out_samples,
+                              image::Image<ImageSample>& samples,
+                              size_t channelQuantization,
+                              const Params& params,
+                              bool simplified);
+
+    /// Remove the per-pixel descriptions which are saturated, noisy or not monotonic with exposure
+    static void filterDescriptions(image::Image<ImageSample>& samples, const Params& params);
+
   private:
     MapSampleRefList _positions;
 };
@@ -118,7 +118,55 @@ ImageCache::ImageCache(float capacity_MiB, float maxSize_MiB, const ImageReadOpt
     _options(options)
 {}
 
-ImageCache::~ImageCache() {}
+ImageCache::~ImageCache()
+{
+    // stop the prefetch threads, dropping the requests that have not started yet
+    {
+        const std::scoped_lock<std::mutex> lockPrefetch(_mutexPrefetch);
+        _stopPrefetch = true;
+        _prefetchQueue.clear();
+    }
+    _prefetchCondition.notify_all();
+
+    for (std::thread& thread : _prefetchThreads)
+    {
+        thread.join();
+    }
+}
+
+void ImageCache::startPrefetchThreadsNoLock()
+{
+    if (!_prefetchThreads.empty())
+    {
+        return;
+    }
+
+    // prefetching is I/O bound, a small pool is enough to keep the disk busy
+    const unsigned int nbThreads = std::max(2u, std::thread::hardware_concurrency() / 4);
+
+    for (unsigned int i = 0; i < nbThreads; ++i)
+    {
+        _prefetchThreads.emplace_back([this]() {
+            while (true)
+            {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lockPrefetch(_mutexPrefetch);
+                    _prefetchCondition.wait(lockPrefetch, [this]() { return _stopPrefetch || !_prefetchQueue.empty(); });
+
+                    if (_stopPrefetch)
+                    {
+                        return;
+                    }
+
+                    task = std::move(_prefetchQueue.front());
+                    _prefetchQueue.pop_front();
+                }
+                task();
+            }
+        });
+    }
+}
 
 std::string ImageCache::toString() const
 {
@@ -142,7 +190,8 @@ std::string ImageCache::toString() const
     std::string statsDesc = "\nUsage statistics: "
                             "\n * nb load from disk: " +
                             std::to_string(_info.nbLoadFromDisk) + "\n * nb load from cache: " + std::to_string(_info.nbLoadFromCache) +
-                            "\n * nb remove unused: " + std::to_string(_info.nbRemoveUnused);
+                            "\n * nb remove unused: " + std::to_string(_info.nbRemoveUnused) +
+                            "\n * lock wait time (us): " + std::to_string(_info.lockWaitTimeUs);
     description += statsDesc;
 
     return description;
@@ -16,13 +16,18 @@
 
 #include <boost/functional/hash.hpp>
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <functional>
 #include <list>
 #include <mutex>
 #include <thread>
+#include <vector>
 #include <algorithm>
 
 namespace aliceVision {
@@ -86,6 +91,9 @@ struct CacheInfo
     int nbLoadFromCache = 0;
     int nbRemoveUnused = 0;
 
+    /// cumulated time spent waiting for the cache lock (in microseconds)
+    unsigned long long int lockWaitTimeUs = 0;
+
     CacheInfo(float capacity_MiB, float maxSize_MiB)
       : capacity(capacity_MiB * 1024 * 1024),
         maxSize(maxSize_MiB * 1024 * 1024)
@@ -237,6 +245,20 @@ class ImageCache
     template<typename TPix>
     std::shared_ptr<Image<TPix>> get(const std::string& filename, int downscaleLevel = 1, bool cachedOnly = false, bool lazyCleaning = true);
 
+    /**
+     * @brief Request asynchronous loading of images at a given downscale level.
+     *
+     * The images are loaded by a background I/O thread pool so that disk reads and decoding
+     * overlap with the caller's computations, and a subsequent get() returns them from memory.
+     * Requests for images that are already cached or already queued are coalesced.
+     * @note This method is thread-safe and returns immediately.
+     * @param[in] filenames the images' filenames on disk
+     * @param[in] downscaleLevel the downscale level
+     * @param[in] highPriority if true, the requests are served before the already queued ones
+     */
+    template<typename TPix>
+    void prefetch(const std::vector<std::string>& filenames, int downscaleLevel = 1, bool highPriority = false);
+
     /**
      * @brief Check if an image at a given downscale level is currently in the cache.
      * @note This method is thread-safe.
@@ -272,14 +294,30 @@ class ImageCache
     template<typename TPix>
     void load(const CacheKey& key, std::unique_lock<std::mutex>& lockPeek);
 
+    /**
+     * @brief Start the background prefetch threads if they are not running yet.
+     * @note Must be called with the prefetch mutex held.
+     */
+    void startPrefetchThreadsNoLock();
+
     CacheInfo _info;
     ImageReadOptions _options;
     std::unordered_map<CacheKey, CacheValue, CacheKeyHasher> _imagePtrs;
     /// ordered from LRU (Least Recently Used) to MRU (Most Recently Used)
     std::list<CacheKey> _keys;
+    /// position of each key in the LRU list, so that cache hits are O(1) instead of scanning the list
+    std::unordered_map<CacheKey, std::list<CacheKey>::iterator, CacheKeyHasher> _keyPosition;
 
     mutable std::mutex _mutexGeneral;
     mutable std::mutex _mutexPeek;
+
+    /// background prefetching
+    std::deque<std::function<void()>> _prefetchQueue;
+    std::unordered_set<CacheKey, CacheKeyHasher> _pendingPrefetch;
+    std::vector<std::thread> _prefetchThreads;
+    std::condition_variable _prefetchCondition;
+    mutable std::mutex _mutexPrefetch;
+    bool _stopPrefetch = false;
 };
 
 // Since some methods in the ImageCache class are templated
@@ -294,7 +332,9 @@ std::shared_ptr<Image<TPix>> ImageCache::get(const std::string& filename, int do
                                 << "request was made with downscale level " << downscaleLevel);
     }
 
+    const auto lockStart = std::chrono::steady_clock::now();
     std::unique_lock<std::mutex> lockPeek(_mutexPeek);
+    _info.lockWaitTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - lockStart).count();
 
     ALICEVISION_LOG_TRACE("[image] ImageCache: reading " << filename << " with downscale level " << downscaleLevel << " from thread "
                                                          << std::this_thread::get_id());
@@ -306,12 +346,11 @@ std::shared_ptr<Image<TPix>> ImageCache::get(const std::string& filename, int do
 
     // find the requested image in the cached images
     {
-        auto it = std::find(_keys.begin(), _keys.end(), keyReq);
-        if (it != _keys.end())
+        auto it = _keyPosition.find(keyReq);
+        if (it != _keyPosition.end())
         {
-            // image becomes LRU
-            _keys.erase(it);
-            _keys.push_back(keyReq);
+            // image becomes MRU, splicing keeps the stored iterator valid
+            _keys.splice(_keys.end(), _keys, it->second);
 
             _info.nbLoadFromCache++;
 
@@ -357,6 +396,7 @@ std::shared_ptr<Image<TPix>> ImageCache::get(const std::string& filename, int do
                 _info.nbImages--;
                 _info.contentSize -= value.memorySize();
                 _imagePtrs.erase(key);
+                _keyPosition.erase(key);
                 _keys.erase(it);
 
                 _info.nbRemoveUnused++;
@@ -383,6 +423,7 @@ std::shared_ptr<Image<TPix>> ImageCache::get(const std::string& filename, int do
             _info.nbImages--;
             _info.contentSize -= value.memorySize();
             _imagePtrs.erase(key);
+            _keyPosition.erase(key);
             _keys.erase(it);
 
             _info.nbRemoveUnused++;
@@ -435,12 +476,68 @@ void ImageCache::load(const CacheKey& key, std::unique_lock<std::mutex>& lockPee
     // add to cache as MRU
     _imagePtrs.insert({key, value});
     _keys.push_back(key);
+    _keyPosition[key] = std::prev(_keys.end());
 
     // update memory usage
     _info.nbImages++;
     _info.contentSize += value.memorySize();
 }
 
+template<typename TPix>
+void ImageCache::prefetch(const std::vector<std::string>& filenames, int downscaleLevel, bool highPriority)
+{
+    if (downscaleLevel < 1)
+    {
+        ALICEVISION_THROW_ERROR("[image] ImageCache: cannot prefetch image with downscale level < 1, "
+                                << "request was made with downscale level " << downscaleLevel);
+    }
+
+    using TInfo = ColorTypeInfo<TPix>;
+
+    std::unique_lock<std::mutex> lockPrefetch(_mutexPrefetch);
+
+    startPrefetchThreadsNoLock();
+
+    for (const std::string& filename : filenames)
+    {
+        auto lastWriteTime = utils::getLastWriteTime(filename);
+        CacheKey key(filename, TInfo::size, TInfo::typeDesc, downscaleLevel, lastWriteTime);
+
+        // coalesce requests for images that are already queued or already cached
+        if (_pendingPrefetch.count(key) != 0 || contains<TPix>(filename, downscaleLevel))
+        {
+            continue;
+        }
+
+        _pendingPrefetch.insert(key);
+
+        auto task = [this, filename, downscaleLevel, key]() {
+            try
+            {
+                get<TPix>(filename, downscaleLevel);
+            }
+            catch (const std::exception& e)
+            {
+                ALICEVISION_LOG_DEBUG("[image] ImageCache: prefetch of " << filename << " failed: " << e.what());
+            }
+            const std::scoped_lock<std::mutex> lock(_mutexPrefetch);
+            _pendingPrefetch.erase(key);
+        };
+
+        if (highPriority)
+        {
+            _prefetchQueue.push_front(std::move(task));
+        }
+        else
+        {
+            _prefetchQueue.push_back(std::move(task));
+        }
+    }
+
+    lockPrefetch.unlock();
+    _prefetchCondition.notify_all();
+}
+
 template<typename TPix>
 bool ImageCache::contains(const std::string& filename, int downscaleLevel) const
 {
@@ -457,9 +554,7 @@ bool ImageCache::contains(const std::string& filename, int downscaleLevel) const
     auto lastWriteTime = utils::getLastWriteTime(filename);
     CacheKey keyReq(filename, TInfo::size, TInfo::typeDesc, downscaleLevel, lastWriteTime);
 
-    auto it = std::find(_keys.begin(), _keys.end(), keyReq);
-
-    return it != _keys.end();
+    return _keyPosition.find(keyReq) != _keyPosition.end();
 }
 
 }  // namespace image
@@ -3,6 +3,8 @@
 #include <aliceVision/system/Logger.hpp>
 #include <aliceVision/utils/filesIO.hpp>
 
+#include <zlib.h>
+
 #include <filesystem>
 
 namespace aliceVision {
@@ -112,13 +114,16 @@ bool CacheManager::prepareBlockGroup(size_t startBlockId, size_t blocksCount)
     return true;
 }
 
-std::unique_ptr<unsigned char> CacheManager::load(size_t startBlockId, size_t blockCount)
+std::unique_ptr<unsigned char> CacheManager::load(size_t startBlockId, size_t blockCount, size_t compressedSize)
 {
     const size_t indexId = startBlockId / _blockCountPerIndex;
     const size_t blockIdInIndex = startBlockId % _blockCountPerIndex;
     const size_t positionInIndex = blockIdInIndex * _blockSize;
     const size_t groupLength = _blockSize * blockCount;
 
+    /*A zero compressed size means the group was stored raw*/
+    const size_t storedLength = (compressedSize > 0) ? compressedSize : groupLength;
+
     const std::string path = getPathForIndex(indexId);
 
     std::ifstream file_index(path, std::ios::binary);
@@ -133,19 +138,38 @@ std::unique_ptr<unsigned char> CacheManager::load(size_t startBlockId, size_t bl
         return std::unique_ptr<unsigned char>();
     }
 
-    ALICEVISION_LOG_TRACE("CacheManager::load: read " << groupLength << " bytes from '" << path << "' at position " << positionInIndex << ".");
+    ALICEVISION_LOG_TRACE("CacheManager::load: read " << storedLength << " bytes from '" << path << "' at position " << positionInIndex << ".");
 
-    std::unique_ptr<unsigned char> data(new unsigned char[groupLength]);
-    file_index.read(reinterpret_cast<char*>(data.get()), groupLength);
+    if (compressedSize == 0)
+    {
+        std::unique_ptr<unsigned char> data(new unsigned char[groupLength]);
+        file_index.read(reinterpret_cast<char*>(data.get()), groupLength);
+        if (!file_index)
+        {
+            return std::unique_ptr<unsigned char>();
+        }
+
+        return data;
+    }
+
+    std::unique_ptr<unsigned char> compressed(new unsigned char[compressedSize]);
+    file_index.read(reinterpret_cast<char*>(compressed.get()), compressedSize);
     if (!file_index)
     {
         return std::unique_ptr<unsigned char>();
     }
 
+    std::unique_ptr<unsigned char> data(new unsigned char[groupLength]);
+    uLongf uncompressedLength = uLongf(groupLength);
+    if (uncompress(data.get(), &uncompressedLength, compressed.get(), uLong(compressedSize)) != Z_OK || uncompressedLength != groupLength)
+    {
+        return std::unique_ptr<unsigned char>();
+    }
+
     return data;
 }
 
-bool CacheManager::save(std::unique_ptr<unsigned char>&& data, size_t startBlockId, size_t blockCount)
+bool CacheManager::save(std::unique_ptr<unsigned char>&& data, size_t startBlockId, size_t blockCount, size_t& compressedSize)
 {
     const size_t indexId = startBlockId / _blockCountPerIndex;
     const size_t blockIdInIndex = startBlockId % _blockCountPerIndex;
@@ -171,13 +195,33 @@ bool CacheManager::save(std::unique_ptr<unsigned char>&& data, size_t startBlock
     {
         return false;
     }
-    else
+
+    /*
+    Try to compress the group into the booked disk span.
+    The group keeps its full-size span on disk, only the write and future reads shrink.
+    If the data does not compress below the raw size, it is stored raw and compressedSize stays 0.
+    */
+    compressedSize = 0;
+    size_t writeLength = groupLength;
+    std::unique_ptr<unsigned char> compressed;
+    if (_compressionEnabled)
     {
-        // Write data
-        ALICEVISION_LOG_TRACE("CacheManager::save: write " << groupLength << " bytes to '" << path << "' at position " << positionInIndex << ".");
-        file_index.write(reinterpret_cast<const char*>(bytesToWrite), groupLength);
+        const uLong bound = compressBound(uLong(groupLength));
+        compressed.reset(new unsigned char[bound]);
+
+        uLongf compressedLength = bound;
+        if (compress2(compressed.get(), &compressedLength, bytesToWrite, uLong(groupLength), Z_BEST_SPEED) == Z_OK && compressedLength < groupLength)
+        {
+            bytesToWrite = compressed.get();
+            writeLength = compressedLength;
+            compressedSize = compressedLength;
+        }
     }
 
+    // Write data
+    ALICEVISION_LOG_TRACE("CacheManager::save: write " << writeLength << " bytes to '" << path << "' at position " << positionInIndex << ".");
+    file_index.write(reinterpret_cast<const char*>(bytesToWrite), writeLength);
+
     if (!file_index)
     {
         return false;
@@ -215,6 +259,7 @@ bool CacheManager::createObject(size_t& objectId, size_t blockCount)
     MemoryItem item;
     item.startBlockId = ~0;
     item.countBlock = blockCount;
+    item.compressedSize = 0;
     _memoryMap[objectId] = item;
 
     return true;
@@ -248,7 +293,7 @@ bool CacheManager::acquireObject(std::unique_ptr<unsigned char>& data, size_t ob
         }
         else
         {
-            data = std::move(load(memitem.startBlockId, memitem.countBlock));
+            data = std::move(load(memitem.startBlockId, memitem.countBlock, memitem.compressedSize));
         }
 
         /*Update memory usage*/
@@ -297,11 +342,15 @@ bool CacheManager::saveObject(std::unique_ptr<unsigned char>&& data, size_t obje
         prepareBlockGroup(item.startBlockId, item.countBlock);
     }
 
-    if (!save(std::move(data), item.startBlockId, item.countBlock))
+    size_t compressedSize = 0;
+    if (!save(std::move(data), item.startBlockId, item.countBlock, compressedSize))
     {
         return false;
     }
 
+    /*Remember how the group was stored for the next load*/
+    _memoryMap[objectId].compressedSize = compressedSize;
+
     return true;
 }
 
@@ -148,6 +148,8 @@ class CacheManager
     {
         size_t startBlockId;
         size_t countBlock;
+        /*Byte count of the spilled data once compressed, 0 when it is stored raw*/
+        size_t compressedSize;
     };
 
     using MemoryMap = std::map<size_t, MemoryItem>;
@@ -186,6 +188,14 @@ class CacheManager
      */
     void setInCoreMaxObjectCount(size_t max);
 
+    /**
+     * Enable or disable lossless compression of the spilled objects.
+     * Compression trades some cpu time for a large cut of the cache file traffic.
+     * Objects which do not compress are transparently stored raw.
+     * @param enabled the new compression state
+     */
+    void setCompression(bool enabled) { _compressionEnabled = enabled; }
+
     /**
      * Create a new object of size block count
      * @param objectId the created object index
@@ -214,8 +224,8 @@ class CacheManager
     void wipe();
 
     bool prepareBlockGroup(size_t startBlockId, size_t blocksCount);
-    std::unique_ptr<unsigned char> load(size_t startBlockId, size_t blocksCount);
-    bool save(std::unique_ptr<unsigned char>&& data, size_t startBlockId, size_t blockCount);
+    std::unique_ptr<unsigned char> load(size_t startBlockId, size_t blocksCount, size_t compressedSize);
+    bool save(std::unique_ptr<unsigned char>&& data, size_t startBlockId, size_t blockCount, size_t& compressedSize);
     bool saveObject(std::unique_ptr<unsigned char>&& data, size_t objectId);
 
     virtual void onRemovedFromMRU(size_t objectId) = 0;
@@ -230,6 +240,7 @@ class CacheManager
     size_t _blockCountPerIndex{0};
     size_t _nextStartBlockId{0};
     size_t _nextObjectId{0};
+    bool _compressionEnabled{true};
 
     std::string _basePathStorage;
     IndexedStoragePaths _indexPaths;
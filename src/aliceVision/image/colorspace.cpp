@@ -13,18 +13,39 @@
 #include <boost/algorithm/string.hpp>
 
 #include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace aliceVision {
 namespace image {
 
-namespace {
-oiio::ColorConfig colorConfigOCIO(getDefaultColorConfigFilePath());
+namespace fs = std::filesystem;
+
+oiio::ColorConfig& getGlobalColorConfigOCIO()
+{
+    // Parsing the OCIO configuration is a noticeable part of the process startup time,
+    // so the global config is built on first use instead of at static initialization time:
+    // the tools which never resolve a color space do not pay for it.
+    static oiio::ColorConfig colorConfigOCIO(getDefaultColorConfigFilePath());
+    return colorConfigOCIO;
 }
 
-namespace fs = std::filesystem;
+oiio::ColorConfig& getColorConfigOCIO(const std::string& colorConfigFilePath)
+{
+    static std::map<std::string, std::unique_ptr<oiio::ColorConfig>> colorConfigsCache;
+    static std::mutex colorConfigsCacheMutex;
 
-oiio::ColorConfig& getGlobalColorConfigOCIO() { return colorConfigOCIO; }
+    std::lock_guard<std::mutex> lock(colorConfigsCacheMutex);
+
+    auto it = colorConfigsCache.find(colorConfigFilePath);
+    if (it == colorConfigsCache.end())
+    {
+        it = colorConfigsCache.emplace(colorConfigFilePath, std::make_unique<oiio::ColorConfig>(colorConfigFilePath)).first;
+    }
+    return *it->second;
+}
 
 std::string getColorConfigFilePathFromSourceCode()
 {
@@ -126,6 +147,7 @@ std::string getDefaultColorConfigFilePath()
 
 void initColorConfigOCIO(const std::string& colorConfigFilePath)
 {
+    oiio::ColorConfig& colorConfigOCIO = getGlobalColorConfigOCIO();
     colorConfigOCIO.reset(colorConfigFilePath);
     if (!colorConfigOCIO.supportsOpenColorIO())
     {
@@ -62,5 +62,14 @@ std::string getDefaultColorConfigFilePath();
 void initColorConfigOCIO(const std::string& colorConfigFilePath);
 oiio::ColorConfig& getGlobalColorConfigOCIO();
 
+/**
+ * @brief Get a shared OCIO color configuration for a given configuration file, creating it on first use.
+ * The configuration caches the OCIO processors per (source, destination) color space pair, so reusing
+ * it across images avoids both the configuration parsing and the processor creation per image.
+ * @param[in] colorConfigFilePath The OCIO configuration file path
+ * @return the shared color configuration
+ */
+oiio::ColorConfig& getColorConfigOCIO(const std::string& colorConfigFilePath);
+
 }  // namespace image
 }  // namespace aliceVision
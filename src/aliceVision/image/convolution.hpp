@@ -91,27 +91,31 @@ void imageHorizontalConvolution(const ImageTypeIn& img, const Kernel& kernel, Im
     const int kernelWidth = kernel.size();
     const int halfKernelWidth = kernelWidth / 2;
 
-    std::vector<pix_t> line(cols + kernelWidth);
-
-    for (int row = 0; row < rows; ++row)
+#pragma omp parallel
     {
-        // Copy line
-        const pix_t startPix = img.coeffRef(row, 0);
-        for (int k = 0; k < halfKernelWidth; ++k)  // pad before
-        {
-            line[k] = startPix;
-        }
-        memcpy(&line[0] + halfKernelWidth, img.data() + row * cols, sizeof(pix_t) * cols);
-        const pix_t endPix = img.coeffRef(row, cols - 1);
-        for (int k = 0; k < halfKernelWidth; ++k)  // pad after
+        std::vector<pix_t> line(cols + kernelWidth);
+
+#pragma omp for
+        for (int row = 0; row < rows; ++row)
         {
-            line[k + halfKernelWidth + cols] = endPix;
-        }
+            // Copy line
+            const pix_t startPix = img.coeffRef(row, 0);
+            for (int k = 0; k < halfKernelWidth; ++k)  // pad before
+            {
+                line[k] = startPix;
+            }
+            memcpy(&line[0] + halfKernelWidth, img.data() + row * cols, sizeof(pix_t) * cols);
+            const pix_t endPix = img.coeffRef(row, cols - 1);
+            for (int k = 0; k < halfKernelWidth; ++k)  // pad after
+            {
+                line[k + halfKernelWidth + cols] = endPix;
+            }
 
-        // Apply convolution
-        convBuffer(&line[0], kernel.data(), cols, kernelWidth);
+            // Apply convolution
+            convBufferDispatch(&line[0], kernel.data(), cols, kernelWidth);
 
-        memcpy(out.data() + row * cols, &line[0], sizeof(pix_t) * cols);
+            memcpy(out.data() + row * cols, &line[0], sizeof(pix_t) * cols);
+        }
     }
 }
 
@@ -135,30 +139,34 @@ void imageVerticalConvolution(const ImageTypeIn& img, const Kernel& kernel, Imag
 
     out.resize(cols, rows);
 
-    std::vector<pix_t> line(rows + kernelWidth);
-
-    for (int col = 0; col < cols; ++col)
+#pragma omp parallel
     {
-        // Copy column
-        for (int k = 0; k < halfKernelWidth; ++k)
-        {
-            line[k] = img.coeffRef(0, col);
-        }
-        for (int k = 0; k < rows; ++k)
-        {
-            line[k + halfKernelWidth] = img.coeffRef(k, col);
-        }
-        for (int k = 0; k < halfKernelWidth; ++k)
+        std::vector<pix_t> line(rows + kernelWidth);
+
+#pragma omp for
+        for (int col = 0; col < cols; ++col)
         {
-            line[k + halfKernelWidth + rows] = img.coeffRef(rows - 1, col);
-        }
+            // Copy column
+            for (int k = 0; k < halfKernelWidth; ++k)
+            {
+                line[k] = img.coeffRef(0, col);
+            }
+            for (int k = 0; k < rows; ++k)
+            {
+                line[k + halfKernelWidth] = img.coeffRef(k, col);
+            }
+            for (int k = 0; k < halfKernelWidth; ++k)
+            {
+                line[k + halfKernelWidth + rows] = img.coeffRef(rows - 1, col);
+            }
 
-        // Apply convolution
-        convBuffer(&line[0], kernel.data(), rows, kernelWidth);
+            // Apply convolution
+            convBufferDispatch(&line[0], kernel.data(), rows, kernelWidth);
 
-        for (int row = 0; row < rows; ++row)
-        {
-            out.coeffRef(row, col) = line[row];
+            for (int row = 0; row < rows; ++row)
+            {
+                out.coeffRef(row, col) = line[row];
+            }
         }
     }
 }
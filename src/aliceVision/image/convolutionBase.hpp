@@ -31,5 +31,63 @@ inline void convBuffer(T1* buffer, const T2* kernel, int rsize, int ksize)
         buffer[i] = sum;
     }
 }
+
+/**
+ ** Same filtering with the kernel length known at compile time,
+ ** so that the inner loop can be unrolled and vectorized by the compiler
+ ** @param buffer data to filter
+ ** @param kernel kernel array
+ ** @param rsize buffer length
+ **/
+template<int KSize, class T1, class T2>
+inline void convBufferFixed(T1* buffer, const T2* kernel, int rsize)
+{
+    for (int i = 0; i < rsize; ++i)
+    {
+        T2 sum(0);
+        for (int j = 0; j < KSize; ++j)
+        {
+            sum += buffer[i + j] * kernel[j];
+        }
+        buffer[i] = sum;
+    }
+}
+
+/**
+ ** Dispatch the filtering to a fixed-size instantiation for the common
+ ** Gaussian kernel lengths, falling back to the generic loop otherwise
+ ** @param buffer data to filter
+ ** @param kernel kernel array
+ ** @param rsize buffer length
+ ** @param ksize kernel length
+ **/
+template<class T1, class T2>
+inline void convBufferDispatch(T1* buffer, const T2* kernel, int rsize, int ksize)
+{
+    switch (ksize)
+    {
+        case 3:
+            convBufferFixed<3>(buffer, kernel, rsize);
+            break;
+        case 5:
+            convBufferFixed<5>(buffer, kernel, rsize);
+            break;
+        case 7:
+            convBufferFixed<7>(buffer, kernel, rsize);
+            break;
+        case 9:
+            convBufferFixed<9>(buffer, kernel, rsize);
+            break;
+        case 11:
+            convBufferFixed<11>(buffer, kernel, rsize);
+            break;
+        case 13:
+            convBufferFixed<13>(buffer, kernel, rsize);
+            break;
+        default:
+            convBuffer(buffer, kernel, rsize, ksize);
+            break;
+    }
+}
 }  // namespace image
 }  // namespace aliceVision
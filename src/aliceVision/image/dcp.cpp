@@ -1348,6 +1348,12 @@ void DCPProfile::apply(OIIO::ImageBuf& image, const DCPProfileApplyParams& param
         }
     }
 
+    // Compile the non linear transform into a 3D LUT, built once per (profile, parameters)
+    // pair and reused across all the frames sharing the profile. When the transform reduces
+    // to the exposure scale (no look table, no tone curve) the exact evaluation is kept.
+    const bool useLut = params.use_tone_curve || params.apply_look_table;
+    const NonLinearLut& lut = useLut ? getOrBuildNonLinearLut(params) : _nonLinearLut;
+
     // Apply DCP profile
 #pragma omp parallel for
     for (int i = 0; i < image.spec().height; ++i)
@@ -1359,7 +1365,15 @@ void DCPProfile::apply(OIIO::ImageBuf& image, const DCPProfileApplyParams& param
             {
                 rgb[c] *= 65535.0;
             }
-            apply(rgb, params);
+            if (useLut && rgb[0] >= 0.f && rgb[0] <= 65535.f && rgb[1] >= 0.f && rgb[1] <= 65535.f && rgb[2] >= 0.f && rgb[2] <= 65535.f)
+            {
+                applyLut(lut, rgb);
+            }
+            else
+            {
+                // Out-of-range values are evaluated exactly instead of being clamped into the LUT domain
+                apply(rgb, params);
+            }
             for (int c = 0; c < 3; ++c)
             {
                 rgb[c] /= 65535.0;
@@ -1448,6 +1462,80 @@ void DCPProfile::apply(float* rgb, const DCPProfileApplyParams& params) const
     }
 }
 
+const DCPProfile::NonLinearLut& DCPProfile::getOrBuildNonLinearLut(const DCPProfileApplyParams& params)
+{
+    // Grid resolution per axis. 65 is the usual cube LUT resolution and keeps the
+    // compilation below a third of a million evaluations of the exact transform.
+    constexpr int lutSize = 65;
+
+    const std::string key = std::to_string(params.apply_hue_shift) + "|" + std::to_string(params.apply_baseline_exposure_offset) + "|" +
+                            std::to_string(params.use_tone_curve) + "|" + std::to_string(params.apply_look_table) + "|" + params.working_space;
+
+    if (!_nonLinearLut.empty() && _nonLinearLut.key == key)
+    {
+        return _nonLinearLut;
+    }
+
+    _nonLinearLut.size = lutSize;
+    _nonLinearLut.key = key;
+    _nonLinearLut.values.resize(static_cast<size_t>(lutSize) * lutSize * lutSize);
+
+#pragma omp parallel for
+    for (int r = 0; r < lutSize; ++r)
+    {
+        for (int g = 0; g < lutSize; ++g)
+        {
+            for (int b = 0; b < lutSize; ++b)
+            {
+                // Grid points are placed on the sRGB-gamma shaper curve
+                float rgb[3] = {igammatab_srgb[r * 65535.f / (lutSize - 1)] * 65535.f,
+                                igammatab_srgb[g * 65535.f / (lutSize - 1)] * 65535.f,
+                                igammatab_srgb[b * 65535.f / (lutSize - 1)] * 65535.f};
+                apply(rgb, params);
+
+                std::array<float, 3>& value = _nonLinearLut.values[(static_cast<size_t>(r) * lutSize + g) * lutSize + b];
+                value[0] = rgb[0];
+                value[1] = rgb[1];
+                value[2] = rgb[2];
+            }
+        }
+    }
+
+    return _nonLinearLut;
+}
+
+void DCPProfile::applyLut(const NonLinearLut& lut, float* rgb) const
+{
+    const int maxIndex0 = lut.size - 2;
+
+    // Encode the input through the shaper to recover the grid coordinates
+    float fract[3];
+    int index0[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        const float scaled = gammatab_srgb[rgb[c]] * (lut.size - 1);
+        index0[c] = std::max(std::min(static_cast<int>(scaled), maxIndex0), 0);
+        fract[c] = scaled - static_cast<float>(index0[c]);
+    }
+
+    const size_t rStep = static_cast<size_t>(lut.size) * lut.size;
+    const size_t gStep = lut.size;
+    const size_t e000 = index0[0] * rStep + index0[1] * gStep + index0[2];
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const float v00 = (1.f - fract[2]) * lut.values[e000][c] + fract[2] * lut.values[e000 + 1][c];
+        const float v01 = (1.f - fract[2]) * lut.values[e000 + gStep][c] + fract[2] * lut.values[e000 + gStep + 1][c];
+        const float v10 = (1.f - fract[2]) * lut.values[e000 + rStep][c] + fract[2] * lut.values[e000 + rStep + 1][c];
+        const float v11 = (1.f - fract[2]) * lut.values[e000 + rStep + gStep][c] + fract[2] * lut.values[e000 + rStep + gStep + 1][c];
+
+        const float v0 = (1.f - fract[1]) * v00 + fract[1] * v01;
+        const float v1 = (1.f - fract[1]) * v10 + fract[1] * v11;
+
+        rgb[c] = (1.f - fract[0]) * v0 + fract[0] * v1;
+    }
+}
+
 inline void DCPProfile::hsdApply(const HsdTableInfo& table_info, const std::vector<HsbModify>& table_base, float& h, float& s, float& v) const
 {
     // Apply the HueSatMap. Ported from Adobes reference implementation.
@@ -255,6 +255,35 @@ class DCPProfile final
         } pc;
     };
 
+    /**
+     * @brief NonLinearLut is the non linear part of the profile (look table, tone curve,
+     * baseline exposure) compiled once into a regular 3D grid, sampled with an sRGB-gamma
+     * shaper on each axis so that the resolution is spent where the tone curve varies.
+     */
+    struct NonLinearLut
+    {
+        int size = 0;
+        std::string key;                           ///< application parameters the LUT was compiled for
+        std::vector<std::array<float, 3>> values;  ///< grid of output RGB values, red-major ordering
+
+        bool empty() const { return values.empty(); }
+    };
+
+    /**
+     * @brief Get the 3D LUT compiled for a set of application parameters, building it on first use.
+     * The LUT is cached in the profile, so all the frames sharing it reuse the same compilation.
+     * param[in] params contains the application parameters indicating which parts of the profile must be applied
+     * @return the compiled LUT
+     */
+    const NonLinearLut& getOrBuildNonLinearLut(const DCPProfileApplyParams& params);
+
+    /**
+     * @brief Apply the compiled non linear transform on a rgb pixel by trilinear interpolation in the LUT.
+     * param[in] lut The compiled LUT
+     * param[in] rgb The pixel values on which the transform must be applied
+     */
+    void applyLut(const NonLinearLut& lut, float* rgb) const;
+
     void hsdApply(const HsdTableInfo& table_info, const std::vector<HsbModify>& table_base, float& h, float& s, float& v) const;
 
     Matrix matMult(const Matrix& A, const Matrix& B) const;
@@ -296,6 +325,8 @@ class DCPProfile final
 
     SplineToneCurve gammatab_srgb;
     SplineToneCurve igammatab_srgb;
+
+    NonLinearLut _nonLinearLut;  // compiled non linear transform, rebuilt when the application parameters change
 };
 
 /**
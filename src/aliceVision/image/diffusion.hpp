@@ -47,7 +47,7 @@ void imagePeronaMalikG2DiffusionCoef(const Image& Lx, const Image& Ly, const typ
 ** @param src input image
 ** @param diff diffusion coefficient image
 ** @param half_t Half diffusion time
-** @param out Output image
+** @param out Output image (updated image : src + explicit diffusion step)
 ** @param row_start Row range beginning (range is [row_start ; row_end [ )
 ** @param row_end Row range end (range is [row_start ; row_end [ )
 **/
@@ -81,7 +81,7 @@ void imageFEDCentral(const Image& src, const Image& diff, const typename Image::
             const Real c = (cur_diff + n_diff[2]) * (cur_src - n_src[2]);
             const Real d = (cur_diff + n_diff[3]) * (n_src[3] - cur_src);
             const Real value = half_t * (a - c + d - b);
-            out(i, j) = value;
+            out(i, j) = cur_src + value;
         }
     }
 }
@@ -91,7 +91,7 @@ void imageFEDCentral(const Image& src, const Image& diff, const typename Image::
 ** @param src input image
 ** @param diff diffusion coefficient image
 ** @param half_t Half diffusion time
-** @param out Output image
+** @param out Output image (updated image : src + explicit diffusion step)
 **/
 template<typename Image>
 void imageFEDCentralCPPThread(const Image& src, const Image& diff, const typename Image::Tpixel half_t, Image& out)
@@ -111,10 +111,12 @@ void imageFEDCentralCPPThread(const Image& src, const Image& diff, const typenam
 
 /**
 ** Apply Fast Explicit Diffusion of an Image
+** The diffusion step is fused with the update : out directly receives the updated
+** image (src + step), so no separate accumulation pass over the image is needed.
 ** @param src input image
 ** @param diff diffusion coefficient image
 ** @param t diffusion time
-** @param out output image
+** @param out output image (updated image : src + explicit diffusion step)
 **/
 template<typename Image>
 void imageFED(const Image& src, const Image& diff, const typename Image::Tpixel t, Image& out)
@@ -137,6 +139,12 @@ void imageFED(const Image& src, const Image& diff, const typename Image::Tpixel
     // - first/last row
     // - first/last col
 
+    // The diffusion stencil does not reach the corners: keep the source values
+    out(0, 0) = src(0, 0);
+    out(0, width - 1) = src(0, width - 1);
+    out(height - 1, 0) = src(height - 1, 0);
+    out(height - 1, width - 1) = src(height - 1, width - 1);
+
     // Compute FED step on first row
     for (int j = 1; j < width - 1; ++j)
     {
@@ -154,7 +162,7 @@ void imageFED(const Image& src, const Image& diff, const typename Image::Tpixel
         const Real c = (cur_diff + n_diff[2]) * (cur_src - n_src[2]);
         const Real d = (cur_diff + n_diff[3]) * (n_src[3] - cur_src);
         const Real value = half_t * (a - c + d);
-        out(0, j) = value;
+        out(0, j) = cur_src + value;
     }
 
     // Compute FED step on last row
@@ -174,7 +182,7 @@ void imageFED(const Image& src, const Image& diff, const typename Image::Tpixel
         const Real b = (cur_diff + n_diff[1]) * (cur_src - n_src[1]);
         const Real c = (cur_diff + n_diff[2]) * (cur_src - n_src[2]);
         const Real value = half_t * (a - c - b);
-        out(height - 1, j) = value;
+        out(height - 1, j) = cur_src + value;
     }
 
     // Compute FED step on first col
@@ -194,7 +202,7 @@ void imageFED(const Image& src, const Image& diff, const typename Image::Tpixel
         const Real b = (cur_diff + n_diff[1]) * (cur_src - n_src[1]);
         const Real d = (cur_diff + n_diff[3]) * (n_src[3] - cur_src);
         const Real value = half_t * (a + d - b);
-        out(i, 0) = value;
+        out(i, 0) = cur_src + value;
     }
 
     // Compute FED step on last col
@@ -214,7 +222,7 @@ void imageFED(const Image& src, const Image& diff, const typename Image::Tpixel
         const Real c = (cur_diff + n_diff[2]) * (cur_src - n_src[2]);
         const Real d = (cur_diff + n_diff[3]) * (n_src[3] - cur_src);
         const Real value = half_t * (-c + d - b);
-        out(i, width - 1) = value;
+        out(i, width - 1) = cur_src + value;
     }
 }
 
@@ -227,11 +235,13 @@ void imageFED(const Image& src, const Image& diff, const typename Image::Tpixel
 template<typename Image>
 void imageFEDCycle(Image& self, const Image& diff, const std::vector<typename Image::Tpixel>& tau)
 {
+    // Each step writes the updated image into tmp, the two buffers are then swapped:
+    // the result always ends up in self and the single scratch image is reused for every step.
     Image tmp;
     for (int i = 0; i < tau.size(); ++i)
     {
         imageFED(self, diff, tau[i], tmp);
-        self.array() += tmp.array();
+        self.swap(tmp);
     }
 }
 
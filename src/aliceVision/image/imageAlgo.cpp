@@ -16,9 +16,13 @@
 
 #include <Eigen/Eigen>
 
+#include <filesystem>
+
 namespace aliceVision {
 namespace imageAlgo {
 
+namespace fs = std::filesystem;
+
 float func_XYZtoLAB(float t)
 {
     if (t > 0.008856f)
@@ -655,5 +659,80 @@ void laplacianPyramid(std::vector<image::Image<image::RGBfColor>>& out_pyramidL,
         ALICEVISION_LOG_DEBUG("laplacianDownscalePyramid: Size level " << i << " : " << out_pyramidL[i].width() << "x" << out_pyramidL[i].height());
 }
 
+std::string ImagePyramidCache::diskLevelPath(const std::string& imagePath, int level) const
+{
+    const fs::path p(imagePath);
+    return (p.parent_path() / (p.stem().string() + ".pyr" + std::to_string(level) + ".exr")).string();
+}
+
+const image::Image<image::RGBfColor>& ImagePyramidCache::get(const std::string& imagePath, int level, image::EImageColorSpace colorSpace)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const std::string key = imagePath + "#" + image::EImageColorSpace_enumToString(colorSpace);
+    std::map<int, image::Image<image::RGBfColor>>& pyramid = _pyramids[key];
+
+    // Build the missing levels, each one halving the previous one
+    for (int l = 0; l <= level; ++l)
+    {
+        if (pyramid.find(l) != pyramid.end())
+            continue;
+
+        image::Image<image::RGBfColor>& img = pyramid[l];
+
+        // The on-disk mirrors are stored as EXR, only valid for linear reads
+        const bool useDiskMirror = _storeOnDisk && (l > 0) && (colorSpace == image::EImageColorSpace::LINEAR);
+
+        if (useDiskMirror && fs::exists(diskLevelPath(imagePath, l)))
+        {
+            image::readImage(diskLevelPath(imagePath, l), img, image::EImageColorSpace::NO_CONVERSION);
+            continue;
+        }
+
+        if (l == 0)
+        {
+            image::readImage(imagePath, img, colorSpace);
+        }
+        else
+        {
+            resizeImage(2, pyramid.at(l - 1), img);
+        }
+
+        if (useDiskMirror)
+        {
+            try
+            {
+                image::writeImage(diskLevelPath(imagePath, l), img, image::ImageWriteOptions().toColorSpace(image::EImageColorSpace::NO_CONVERSION));
+            }
+            catch (const std::exception& e)
+            {
+                // The source folder may not be writable: the mirror is only an accelerator
+                ALICEVISION_LOG_DEBUG("Cannot write pyramid level next to '" << imagePath << "': " << e.what());
+            }
+        }
+    }
+
+    return pyramid.at(level);
+}
+
+void ImagePyramidCache::clear(const std::string& imagePath)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    for (auto it = _pyramids.begin(); it != _pyramids.end();)
+    {
+        if (it->first.compare(0, imagePath.size(), imagePath) == 0)
+            it = _pyramids.erase(it);
+        else
+            ++it;
+    }
+}
+
+void ImagePyramidCache::clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pyramids.clear();
+}
+
 }  // namespace imageAlgo
 }  // namespace aliceVision
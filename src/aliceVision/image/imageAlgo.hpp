@@ -1,5 +1,7 @@
 #pragma once
 
+#include <map>
+#include <mutex>
 #include <string>
 
 #include <aliceVision/image/io.hpp>
@@ -211,6 +213,63 @@ void imageDiff(const image::Image<image::RGBfColor>& inImg,
                image::Image<image::RGBfColor>& outImg,
                unsigned int downscale);
 
+/**
+ * @brief ImagePyramidCache computes and caches the power-of-two downscales of source images,
+ *        so that stages needing the same image at several resolutions (feature octaves,
+ *        keyframe selection, depth map computation, segmentation) do not resample
+ *        identical data repeatedly.
+ *
+ * Levels are cached in memory, keyed on the source image path and color space: level 0 is
+ * the source resolution and each level halves the previous one. When reading in linear
+ * color space, computed levels can optionally be mirrored on disk next to the source file
+ * so that they can be shared across tools.
+ */
+class ImagePyramidCache
+{
+  public:
+    ImagePyramidCache() = default;
+
+    /**
+     * @brief ImagePyramidCache constructor
+     * @param[in] storeOnDisk Mirror the computed levels on disk next to the source images
+     */
+    explicit ImagePyramidCache(bool storeOnDisk)
+      : _storeOnDisk(storeOnDisk)
+    {}
+
+    /**
+     * @brief Get a downscaled version of a source image, computing the missing levels on demand.
+     * @param[in] imagePath The source image path on disk
+     * @param[in] level The pyramid level, the image is downscaled by 2^level
+     * @param[in] colorSpace The color space the source image must be read in
+     * @return the cached image at the requested level
+     */
+    const image::Image<image::RGBfColor>& get(const std::string& imagePath,
+                                              int level,
+                                              image::EImageColorSpace colorSpace = image::EImageColorSpace::LINEAR);
+
+    /**
+     * @brief Drop all the cached levels of one image.
+     * @param[in] imagePath The source image path on disk
+     */
+    void clear(const std::string& imagePath);
+
+    /**
+     * @brief Drop all the cached levels of all images.
+     */
+    void clear();
+
+  private:
+    std::string diskLevelPath(const std::string& imagePath, int level) const;
+
+    /// Cached levels per (source image path, color space) key
+    std::map<std::string, std::map<int, image::Image<image::RGBfColor>>> _pyramids;
+    /// Protect the cache against concurrent accesses
+    std::mutex _mutex;
+    /// Mirror the computed levels on disk next to the source images
+    bool _storeOnDisk = false;
+};
+
 /**
  * @brief Calculate the laplacian pyramid of a given image,
  *        ie. its decomposition in frequency bands
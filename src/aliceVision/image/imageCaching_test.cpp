@@ -10,6 +10,9 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <chrono>
+#include <thread>
+
 using namespace aliceVision;
 using namespace aliceVision::image;
 
@@ -56,3 +59,22 @@ BOOST_AUTO_TEST_CASE(load_all_pixel_types)
     BOOST_CHECK_EQUAL(cache.info().nbImages, 6);
     BOOST_CHECK_EQUAL(cache.info().nbLoadFromDisk, 6);
 }
+
+BOOST_AUTO_TEST_CASE(prefetch_image)
+{
+    ImageCache cache(256, 1024, EImageColorSpace::LINEAR);
+    const std::string filename = std::string(THIS_SOURCE_DIR) + "/image_test/lena.png";
+    cache.prefetch<RGBAfColor>({filename});
+
+    // wait until the background pool has loaded the image
+    while (!cache.contains<RGBAfColor>(filename))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    auto img = cache.get<RGBAfColor>(filename);
+    BOOST_CHECK(img != nullptr);
+    BOOST_CHECK_EQUAL(cache.info().nbImages, 1);
+    BOOST_CHECK_EQUAL(cache.info().nbLoadFromDisk, 1);
+    BOOST_CHECK_EQUAL(cache.info().nbLoadFromCache, 1);
+}
@@ -565,7 +565,12 @@ bool isRawFormat(const std::string& path)
 }
 
 template<typename T>
-void readImage(const std::string& path, oiio::TypeDesc format, int nchannels, Image<T>& image, const ImageReadOptions& imageReadOptions)
+void readImage(const std::string& path,
+               oiio::TypeDesc format,
+               int nchannels,
+               Image<T>& image,
+               const ImageReadOptions& imageReadOptions,
+               const oiio::ROI& roi = oiio::ROI())
 {
     ALICEVISION_LOG_DEBUG("[IO] Read Image: " << path);
 
@@ -731,10 +736,52 @@ void readImage(const std::string& path, oiio::TypeDesc format, int nchannels, Im
 
     oiio::ImageBuf inBuf(path, 0, 0, NULL, &configSpec);
 
-    inBuf.read(0, 0, true, oiio::TypeDesc::FLOAT);  // force image convertion to float (for grayscale and color space convertion)
+    if (roi.defined() && !isRawImage)
+    {
+        // windowed decode: keep the buffer backed by the OIIO cache so that only
+        // the scanlines/tiles of the file covering the requested region are read
+        if (!inBuf.initialized())
+            ALICEVISION_THROW_ERROR("Failed to open the image file: '" << path << "'. The file might not exist.");
+
+        oiio::ROI region = roi;
+        region.chbegin = 0;
+        region.chend = inBuf.spec().nchannels;
+        region = oiio::roi_intersection(region, inBuf.roi());
+
+        if (!region.defined())
+            ALICEVISION_THROW_ERROR("Requested image region is outside the image bounds. Image file: '" << path << "'.");
+
+        oiio::ImageBuf regionBuf;
+        oiio::ImageBufAlgo::cut(regionBuf, inBuf, region);
+
+        // force image convertion to float (for grayscale and color space convertion)
+        oiio::ImageBuf floatBuf;
+        floatBuf.copy(regionBuf, oiio::TypeDesc::FLOAT);
+        inBuf.swap(floatBuf);
+    }
+    else
+    {
+        inBuf.read(0, 0, true, oiio::TypeDesc::FLOAT);  // force image convertion to float (for grayscale and color space convertion)
 
-    if (!inBuf.initialized())
-        ALICEVISION_THROW_ERROR("Failed to open the image file: '" << path << "'. The file might not exist.");
+        if (!inBuf.initialized())
+            ALICEVISION_THROW_ERROR("Failed to open the image file: '" << path << "'. The file might not exist.");
+
+        if (roi.defined())
+        {
+            // raw files are demosaiced as a whole frame, crop after the full decode
+            oiio::ROI region = roi;
+            region.chbegin = 0;
+            region.chend = inBuf.spec().nchannels;
+            region = oiio::roi_intersection(region, inBuf.roi());
+
+            if (!region.defined())
+                ALICEVISION_THROW_ERROR("Requested image region is outside the image bounds. Image file: '" << path << "'.");
+
+            oiio::ImageBuf regionBuf;
+            oiio::ImageBufAlgo::cut(regionBuf, inBuf, region);
+            inBuf.swap(regionBuf);
+        }
+    }
 
     // check picture channels number
     if (inBuf.spec().nchannels == 0)
@@ -875,7 +922,7 @@ void readImage(const std::string& path, oiio::TypeDesc format, int nchannels, Im
             throw std::runtime_error("ALICEVISION_ROOT is not defined, OCIO config file cannot be accessed.");
         }
         oiio::ImageBuf colorspaceBuf;
-        oiio::ColorConfig colorConfig(colorConfigPath);
+        // Shared configuration: the OCIO processor for the color space pair is created once and reused across images
         oiio::ImageBufAlgo::colorconvert(colorspaceBuf,
                                          inBuf,
                                          fromColorSpaceName,
@@ -883,7 +930,7 @@ void readImage(const std::string& path, oiio::TypeDesc format, int nchannels, Im
                                          true,
                                          "",
                                          "",
-                                         &colorConfig);
+                                         &getColorConfigOCIO(colorConfigPath));
         inBuf = colorspaceBuf;
     }
     else
@@ -1105,7 +1152,7 @@ void writeImage(const std::string& path,
         {
             throw std::runtime_error("ALICEVISION_ROOT is not defined, OCIO config file cannot be accessed.");
         }
-        oiio::ColorConfig colorConfig(colorConfigPath);
+        // Shared configuration: the OCIO processor for the color space pair is created once and reused across images
         oiio::ImageBufAlgo::colorconvert(colorspaceBuf,
                                          *outBuf,
                                          EImageColorSpace_enumToOIIOString(fromColorSpace),
@@ -1113,7 +1160,7 @@ void writeImage(const std::string& path,
                                          true,
                                          "",
                                          "",
-                                         &colorConfig);
+                                         &getColorConfigOCIO(colorConfigPath));
         outBuf = &colorspaceBuf;
     }
     else
@@ -1254,6 +1301,36 @@ void readImage(const std::string& path, Image<RGBColor>& image, const ImageReadO
     readImage(path, oiio::TypeDesc::UINT8, 3, image, imageReadOptions);
 }
 
+void readImageRegion(const std::string& path, const oiio::ROI& roi, Image<float>& image, const ImageReadOptions& imageReadOptions)
+{
+    readImage(path, oiio::TypeDesc::FLOAT, 1, image, imageReadOptions, roi);
+}
+
+void readImageRegion(const std::string& path, const oiio::ROI& roi, Image<unsigned char>& image, const ImageReadOptions& imageReadOptions)
+{
+    readImage(path, oiio::TypeDesc::UINT8, 1, image, imageReadOptions, roi);
+}
+
+void readImageRegion(const std::string& path, const oiio::ROI& roi, Image<RGBAfColor>& image, const ImageReadOptions& imageReadOptions)
+{
+    readImage(path, oiio::TypeDesc::FLOAT, 4, image, imageReadOptions, roi);
+}
+
+void readImageRegion(const std::string& path, const oiio::ROI& roi, Image<RGBAColor>& image, const ImageReadOptions& imageReadOptions)
+{
+    readImage(path, oiio::TypeDesc::UINT8, 4, image, imageReadOptions, roi);
+}
+
+void readImageRegion(const std::string& path, const oiio::ROI& roi, Image<RGBfColor>& image, const ImageReadOptions& imageReadOptions)
+{
+    readImage(path, oiio::TypeDesc::FLOAT, 3, image, imageReadOptions, roi);
+}
+
+void readImageRegion(const std::string& path, const oiio::ROI& roi, Image<RGBColor>& image, const ImageReadOptions& imageReadOptions)
+{
+    readImage(path, oiio::TypeDesc::UINT8, 3, image, imageReadOptions, roi);
+}
+
 void logOIIOImageCacheInfo()
 {
     oiio::ImageCache* cache = oiio::ImageCache::create(true);
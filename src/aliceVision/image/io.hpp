@@ -397,6 +397,24 @@ void readImage(const std::string& path, Image<RGBAColor>& image, const ImageRead
 void readImage(const std::string& path, Image<RGBfColor>& image, const ImageReadOptions& imageReadOptions);
 void readImage(const std::string& path, Image<RGBColor>& image, const ImageReadOptions& imageReadOptions);
 
+/**
+ * @brief read a rectangular region of an image with a given path and buffer
+ *
+ * For non-raw formats only the scanlines/tiles of the file covering the requested
+ * region are decoded, which reduces both latency and peak memory compared to a
+ * full-frame read. The region is clipped against the image bounds.
+ * @param[in] path The given path to the image
+ * @param[in] roi The rectangular region of interest (in pixels)
+ * @param[out] image The output image buffer, sized to the clipped region
+ * @param[in] image color space
+ */
+void readImageRegion(const std::string& path, const oiio::ROI& roi, Image<float>& image, const ImageReadOptions& imageReadOptions);
+void readImageRegion(const std::string& path, const oiio::ROI& roi, Image<unsigned char>& image, const ImageReadOptions& imageReadOptions);
+void readImageRegion(const std::string& path, const oiio::ROI& roi, Image<RGBAfColor>& image, const ImageReadOptions& imageReadOptions);
+void readImageRegion(const std::string& path, const oiio::ROI& roi, Image<RGBAColor>& image, const ImageReadOptions& imageReadOptions);
+void readImageRegion(const std::string& path, const oiio::ROI& roi, Image<RGBfColor>& image, const ImageReadOptions& imageReadOptions);
+void readImageRegion(const std::string& path, const oiio::ROI& roi, Image<RGBColor>& image, const ImageReadOptions& imageReadOptions);
+
 /**
  * @brief read an image with a given path and buffer without any processing such as color conversion
  * @param[in] path The given path to the image
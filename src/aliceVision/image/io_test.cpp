@@ -88,6 +88,20 @@ BOOST_AUTO_TEST_CASE(read_png_rgb)
     BOOST_CHECK_EQUAL(image(0, 1).b(), 255);
 }
 
+BOOST_AUTO_TEST_CASE(read_png_rgb_region)
+{
+    Image<RGBColor> image;
+    const std::string png_filename = string(THIS_SOURCE_DIR) + "/image_test/two_pixels_color.png";
+    const oiio::ROI roi(1, 2, 0, 1);
+    BOOST_CHECK_NO_THROW(readImageRegion(png_filename, roi, image, image::EImageColorSpace::NO_CONVERSION));
+    BOOST_CHECK_EQUAL(1, image.width());
+    BOOST_CHECK_EQUAL(1, image.height());
+    BOOST_CHECK_EQUAL(3, image.depth());
+    BOOST_CHECK_EQUAL(image(0, 0).r(), 20);
+    BOOST_CHECK_EQUAL(image(0, 0).g(), 127);
+    BOOST_CHECK_EQUAL(image(0, 0).b(), 255);
+}
+
 BOOST_AUTO_TEST_CASE(read_png_rgba)
 {
     Image<RGBAColor> image;
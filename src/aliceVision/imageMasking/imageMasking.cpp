@@ -25,20 +25,6 @@ float clamp(float value) { return std::min(1.f, std::max(0.f, value)); }
 uint8_t remap_float2uint8(float value) { return uint8_t(clamp(value) * 255.f + 0.49999f); }
 
 cv::Mat wrapCvMask(OutImage& result) { return cv::Mat(result.rows(), result.cols(), CV_8UC1, result.data(), result.rowStride()); }
-
-void rotateHue(cv::Mat& hsv, uint8_t delta)
-{
-    // cannot use cv::add because it saturates the output.
-    // do not use forEach because this call is already parallelized.
-    for (int r = 0; r < hsv.rows; r++)
-    {
-        for (int c = 0; c < hsv.cols; c++)
-        {
-            auto& pixel = hsv.at<cv::Point3_<uint8_t>>(r, c);
-            pixel.x += delta;
-        }
-    }
-}
 }  // namespace
 
 void hsv(OutImage& result,
@@ -61,18 +47,33 @@ void hsv(OutImage& result,
     cv::Mat input_hsv;
     cv::eigen2cv(input.getMat(), input_hsv);                     // copy the buffer, but a copy is needed to convert to HSV colorspace anyway.
     cv::cvtColor(input_hsv, input_hsv, cv::COLOR_RGB2HSV_FULL);  // "_FULL" to encode hue in the [0, 255] range.
-    rotateHue(input_hsv, uint8_t((0.5f - hue) * 256.f));         // hue == 0 <=> hue == 1
 
     result.resize(input.width(), input.height(), false);  // allocate un-initialized
-    const cv::Mat result_cv = wrapCvMask(result);
 
+    const uint8_t deltaH = uint8_t((0.5f - hue) * 256.f);  // hue == 0 <=> hue == 1
     const uint8_t lowH = remap_float2uint8(0.5f - hueRange);
     const uint8_t highH = remap_float2uint8(0.5f + hueRange);
     const uint8_t lowS = remap_float2uint8(minSaturation);
     const uint8_t highS = remap_float2uint8(maxSaturation);
     const uint8_t lowV = remap_float2uint8(minValue);
     const uint8_t highV = remap_float2uint8(maxValue);
-    cv::inRange(input_hsv, cv::Scalar(lowH, lowS, lowV), cv::Scalar(highH, highS, highV), result_cv);
+
+    // Fused hue rotation and range test: one pass over the image writing the mask
+    // in place, instead of a full rotation pass followed by cv::inRange.
+    // (cannot use cv::add for the rotation because it saturates the output)
+#pragma omp parallel for
+    for (int r = 0; r < input_hsv.rows; ++r)
+    {
+        const auto* hsvRow = input_hsv.ptr<cv::Point3_<uint8_t>>(r);
+        for (int c = 0; c < input_hsv.cols; ++c)
+        {
+            const cv::Point3_<uint8_t>& pixel = hsvRow[c];
+            const uint8_t rotatedHue = uint8_t(pixel.x + deltaH);
+            const bool selected = rotatedHue >= lowH && rotatedHue <= highH && pixel.y >= lowS && pixel.y <= highS  //
+                                  && pixel.z >= lowV && pixel.z <= highV;
+            result(r, c) = selected ? 255 : 0;
+        }
+    }
 };
 
 void autoGrayscaleThreshold(OutImage& result, const std::string& inputPath)
@@ -7,6 +7,10 @@
 #include "ImageMatching.hpp"
 #include <aliceVision/voctree/databaseIO.hpp>
 
+#include "nanoflann.hpp"
+
+#include <filesystem>
+
 namespace aliceVision {
 namespace imageMatching {
 
@@ -40,6 +44,8 @@ std::string EImageMatchingMethod_enumToString(EImageMatchingMethod m)
             return "Frustum";
         case EImageMatchingMethod::FRUSTUM_OR_VOCABULARYTREE:
             return "FrustumOrVocabularyTree";
+        case EImageMatchingMethod::SPATIAL:
+            return "Spatial";
     }
     throw std::out_of_range("Invalid EImageMatchingMethod enum: " + std::to_string(int(m)));
 }
@@ -61,6 +67,8 @@ EImageMatchingMethod EImageMatchingMethod_stringToEnum(const std::string& m)
         return EImageMatchingMethod::FRUSTUM;
     if (mode == "frustumorvocabularytree")
         return EImageMatchingMethod::FRUSTUM_OR_VOCABULARYTREE;
+    if (mode == "spatial")
+        return EImageMatchingMethod::SPATIAL;
 
     throw std::out_of_range("Invalid EImageMatchingMethod: " + m);
 }
@@ -185,6 +193,94 @@ void generateSequentialMatches(const sfmData::SfMData& sfmData, size_t nbMatches
     }
 }
 
+namespace {
+
+static const std::size_t MAX_LEAF_ELEMENTS = 10;
+
+/// Adapt a vector of GPS positions to the nanoflann dataset interface
+struct GpsPositionsAdaptator
+{
+    const std::vector<Vec3>& _data;
+
+    GpsPositionsAdaptator(const std::vector<Vec3>& data)
+      : _data(data)
+    {}
+
+    inline size_t kdtree_get_point_count() const { return _data.size(); }
+
+    inline double kdtree_get_pt(const size_t idx, int dim) const { return _data[idx][dim]; }
+
+    template<class BBOX>
+    bool kdtree_get_bbox(BBOX& bb) const
+    {
+        return false;
+    }
+};
+
+using GpsKdTree = nanoflann::KDTreeSingleIndexAdaptor<nanoflann::L2_Simple_Adaptor<double, GpsPositionsAdaptator>, GpsPositionsAdaptator, 3>;
+
+}  // namespace
+
+void generateSpatialMatches(const sfmData::SfMData& sfmData, std::size_t nbMatches, double maxDistance, OrderedPairList& outPairList)
+{
+    // gather the GPS position of every geo-tagged view
+    std::vector<IndexT> viewIds;
+    std::vector<Vec3> gpsPositions;
+    viewIds.reserve(sfmData.getViews().size());
+    gpsPositions.reserve(sfmData.getViews().size());
+
+    std::size_t nbViewsWithoutGps = 0;
+    for (const auto& viewIt : sfmData.getViews())
+    {
+        if (viewIt.second->getImage().hasGpsMetadata())
+        {
+            viewIds.push_back(viewIt.first);
+            gpsPositions.push_back(viewIt.second->getImage().getGpsPositionFromMetadata());
+        }
+        else
+        {
+            ++nbViewsWithoutGps;
+        }
+    }
+
+    if (nbViewsWithoutGps > 0)
+        ALICEVISION_LOG_WARNING("Spatial image matching: " << nbViewsWithoutGps << " views have no GPS metadata and are left unpaired.");
+
+    if (gpsPositions.size() < 2)
+    {
+        ALICEVISION_LOG_WARNING("Spatial image matching: not enough geo-tagged views to generate pairs.");
+        return;
+    }
+
+    GpsPositionsAdaptator adaptator(gpsPositions);
+    GpsKdTree tree(3, adaptator, nanoflann::KDTreeSingleIndexAdaptorParams(MAX_LEAF_ELEMENTS));
+    tree.buildIndex();
+
+    // the query view is its own nearest neighbor
+    const std::size_t nbNeighbors = (nbMatches == 0) ? gpsPositions.size() : std::min(nbMatches + 1, gpsPositions.size());
+    const double sqMaxDistance = maxDistance * maxDistance;
+
+    std::vector<std::size_t> neighborIndexes(nbNeighbors);
+    std::vector<double> sqDistances(nbNeighbors);
+
+    for (std::size_t i = 0; i < gpsPositions.size(); ++i)
+    {
+        const std::size_t found = tree.knnSearch(gpsPositions[i].data(), nbNeighbors, neighborIndexes.data(), sqDistances.data());
+        for (std::size_t n = 0; n < found; ++n)
+        {
+            if (neighborIndexes[n] == i)
+                continue;
+            // neighbors are sorted by increasing distance
+            if (maxDistance > 0.0 && sqDistances[n] > sqMaxDistance)
+                break;
+
+            const IndexT a = viewIds[i];
+            const IndexT b = viewIds[neighborIndexes[n]];
+            outPairList[std::min(a, b)].insert(std::max(a, b));
+        }
+    }
+}
+
 void generateAllMatchesInOneMap(const std::set<IndexT>& viewIds, OrderedPairList& outPairList)
 {
     for (const IndexT imgA : viewIds)
@@ -306,7 +402,8 @@ void conditionVocTree(const std::string& treeName,
                       bool useMultiSfM,
                       const std::map<IndexT, std::string>& descriptorsFilesA,
                       std::size_t numImageQuery,
-                      OrderedPairList& selectedPairs)
+                      OrderedPairList& selectedPairs,
+                      const std::string& databaseSnapshotFilepath)
 {
     if (treeName.empty())
     {
@@ -334,6 +431,15 @@ void conditionVocTree(const std::string& treeName,
     aliceVision::voctree::Database db(tree.words());
     aliceVision::voctree::Database db2;
 
+    // restore the documents of the previous runs, so only the new views are quantized
+    const bool snapshotLoaded = !databaseSnapshotFilepath.empty() && std::filesystem::exists(databaseSnapshotFilepath);
+    if (snapshotLoaded)
+    {
+        ALICEVISION_LOG_INFO("Loading database snapshot...");
+        db.load(databaseSnapshotFilepath);
+        ALICEVISION_LOG_INFO("Database snapshot loaded with " << db.size() << " documents.");
+    }
+
     if (withWeights)
     {
         ALICEVISION_LOG_INFO("Loading weights...");
@@ -368,7 +474,7 @@ void conditionVocTree(const std::string& treeName,
                 nbFeaturesLoadedInputA = voctree::populateDatabase<DescriptorUChar>(sfmDataA, featuresFolders, tree, db, nbMaxDescriptors);
                 nbSetDescriptors = db.getSparseHistogramPerImage().size();
 
-                if (nbFeaturesLoadedInputA == 0)
+                if (nbFeaturesLoadedInputA == 0 && !snapshotLoaded)
                 {
                     throw std::runtime_error("No descriptors loaded in '" + sfmDataFilenameA + "'");
                 }
@@ -386,7 +492,7 @@ void conditionVocTree(const std::string& treeName,
                 nbSetDescriptors += db2.getSparseHistogramPerImage().size();
             }
 
-            if (useMultiSfM && (nbFeaturesLoadedInputB == 0))
+            if (useMultiSfM && (nbFeaturesLoadedInputB == 0) && !snapshotLoaded)
             {
                 throw std::runtime_error("No descriptors loaded in '" + sfmDataFilenameB + "'");
             }
@@ -409,6 +515,12 @@ void conditionVocTree(const std::string& treeName,
             db2.computeTfIdfWeights();
     }
 
+    if (!databaseSnapshotFilepath.empty())
+    {
+        ALICEVISION_LOG_INFO("Saving database snapshot: " << databaseSnapshotFilepath);
+        db.save(databaseSnapshotFilepath);
+    }
+
     {
         PairList allMatches;
 
@@ -54,7 +54,8 @@ enum class EImageMatchingMethod
     SEQUENTIAL = 2,
     SEQUENTIAL_AND_VOCABULARYTREE = 3,
     FRUSTUM = 4,
-    FRUSTUM_OR_VOCABULARYTREE = 5
+    FRUSTUM_OR_VOCABULARYTREE = 5,
+    SPATIAL = 6
 };
 
 /**
@@ -116,6 +117,21 @@ EImageMatchingMode EImageMatchingMode_stringToEnum(const std::string& modeMultiS
 void convertAllMatchesToPairList(const PairList& allMatches, std::size_t numMatches, OrderedPairList& outPairList);
 
 void generateSequentialMatches(const sfmData::SfMData& sfmData, size_t nbMatches, OrderedPairList& outPairList);
+
+/**
+ * @brief Generate the pairs of views that are spatially close, using the GPS position
+ *        embedded in the image metadata as a prior.
+ *
+ * A KD-tree is built over the GPS positions of the views, so only the nbMatches nearest
+ * neighbors of each view are paired instead of all the O(N^2) combinations.
+ * Views without GPS metadata are left unpaired and reported in the log.
+ *
+ * @param[in] sfmData The SfMData containing the views
+ * @param[in] nbMatches The maximum number of nearest views to pair with each view
+ * @param[in] maxDistance The maximum distance in meters between the paired views (0: no limit)
+ * @param[out] outPairList The selected pairs
+ */
+void generateSpatialMatches(const sfmData::SfMData& sfmData, std::size_t nbMatches, double maxDistance, OrderedPairList& outPairList);
 void generateAllMatchesInOneMap(const std::set<IndexT>& viewIds, OrderedPairList& outPairList);
 void generateAllMatchesBetweenTwoMap(const std::set<IndexT>& viewIdsA, const std::set<IndexT>& viewIdsB, OrderedPairList& outPairList);
 
@@ -140,7 +156,8 @@ void conditionVocTree(const std::string& treeName,
                       bool useMultiSfM,
                       const std::map<IndexT, std::string>& descriptorsFilesA,
                       std::size_t numImageQuery,
-                      OrderedPairList& selectedPairs);
+                      OrderedPairList& selectedPairs,
+                      const std::string& databaseSnapshotFilepath = "");
 
 EImageMatchingMethod selectImageMatchingMethod(EImageMatchingMethod method,
                                                const sfmData::SfMData& sfmDataA,
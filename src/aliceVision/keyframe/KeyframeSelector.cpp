@@ -188,16 +188,38 @@ void KeyframeSelector::processSmart(const float pxDisplacement,
     // Step 0: compute all the scores
     computeScores(rescaledWidthSharpness, rescaledWidthFlow, sharpnessWindowSize, flowCellSize, skipSharpnessComputation);
 
-    // Step 1: determine subsequences based on the motion accumulation
-    std::vector<unsigned int> subsequenceLimits;
-    subsequenceLimits.push_back(0);  // Always use the first frame as the starting point
+    // Steps 1 and 2: determine the subsequences based on the motion accumulation
+    const std::vector<unsigned int> subsequenceLimits = computeSubsequenceLimits(pxDisplacement);
 
-    std::size_t sequenceSize = _sharpnessScores.size();
+    const std::size_t sequenceSize = _sharpnessScores.size();
 
     // All frames are unselected so far
     _selectedFrames.resize(sequenceSize);
     std::fill(_selectedFrames.begin(), _selectedFrames.end(), '0');
 
+    // Step 3: for each subsequence, find the keyframe
+    for (std::size_t i = 1; i < subsequenceLimits.size(); ++i)
+    {
+        ALICEVISION_LOG_DEBUG("Subsequence [" << subsequenceLimits.at(i - 1) << ", " << subsequenceLimits.at(i) << "]");
+        const std::size_t bestIndex =
+          findBestFrame(_sharpnessScores, subsequenceLimits.at(i - 1), subsequenceLimits.at(i), subsequenceLimits.at(i - 1), subsequenceLimits.at(i));
+        ALICEVISION_LOG_INFO("Selecting frame with ID " << bestIndex);
+        _selectedKeyframes.push_back(bestIndex);
+        _selectedFrames.at(bestIndex) = '1';  // The frame has been selected, flip it to 1
+    }
+
+    ALICEVISION_LOG_INFO("Finished selecting all the keyframes! " << _selectedKeyframes.size() << "/" << sequenceSize
+                                                                  << " frames have been selected.");
+}
+
+std::vector<unsigned int> KeyframeSelector::computeSubsequenceLimits(const float pxDisplacement) const
+{
+    // Step 1: determine subsequences based on the motion accumulation
+    std::vector<unsigned int> subsequenceLimits;
+    subsequenceLimits.push_back(0);  // Always use the first frame as the starting point
+
+    std::size_t sequenceSize = _sharpnessScores.size();
+
     float step = pxDisplacement * std::min(_frameWidth, _frameHeight) / 100.0;
     double motionAcc = 0.0;
 
@@ -296,47 +318,203 @@ void KeyframeSelector::processSmart(const float pxDisplacement,
         subsequenceLimits = newLimits;
     }
 
-    // Step 3: for each subsequence, find the keyframe
-    for (std::size_t i = 1; i < subsequenceLimits.size(); ++i)
+    return subsequenceLimits;
+}
+
+std::size_t KeyframeSelector::findBestFrame(const std::map<std::size_t, double>& sharpnessScores,
+                                            const std::size_t subsequenceStart,
+                                            const std::size_t subsequenceEnd,
+                                            const std::size_t searchStart,
+                                            const std::size_t searchEnd) const
+{
+    double bestSharpness = 0.0;
+    std::size_t bestIndex = 0;
+    const std::size_t subsequenceSize = subsequenceEnd - subsequenceStart;
+
+    // Weights for the whole subsequence [1.0; 2.0] (1.0 is on the subsequence's limits, 2.0 on its center)
+    std::deque<double> weights;
+    const double weightStep = 1.f / (static_cast<double>(subsequenceSize - 1) / 2.f);
+    weights.push_back(2.0);  // The frame in the middle of the subsequence has the biggest weight
+    if (subsequenceSize % 2 == 0)
+        weights.push_back(2.0);  // For subsequences of even size, two frames are equally in the middle
+
+    float currentWeight = 2.0;
+    while (weights.size() != subsequenceSize)
     {
-        double bestSharpness = 0.0;
-        std::size_t bestIndex = 0;
-        std::size_t subsequenceSize = subsequenceLimits.at(i) - subsequenceLimits.at(i - 1);
-        ALICEVISION_LOG_DEBUG("Subsequence [" << subsequenceLimits.at(i - 1) << ", " << subsequenceLimits.at(i) << "]");
+        currentWeight -= weightStep;
+        weights.push_front(currentWeight);
+        weights.push_back(currentWeight);
+    }
 
-        // Weights for the whole subsequence [1.0; 2.0] (1.0 is on the subsequence's limits, 2.0 on its center)
-        std::deque<double> weights;
-        const double weightStep = 1.f / (static_cast<double>(subsequenceSize - 1) / 2.f);
-        weights.push_back(2.0);  // The frame in the middle of the subsequence has the biggest weight
-        if (subsequenceSize % 2 == 0)
-            weights.push_back(2.0);  // For subsequences of even size, two frames are equally in the middle
+    for (std::size_t j = searchStart; j < searchEnd; ++j)
+    {
+        const auto sharpness = sharpnessScores.at(j) * weights.at(j - subsequenceStart);
+        if (sharpness > bestSharpness)
+        {
+            bestIndex = j;
+            bestSharpness = sharpness;
+        }
+    }
+    return bestIndex;
+}
 
-        float currentWeight = 2.0;
-        while (weights.size() != subsequenceSize)
+void KeyframeSelector::processSmartCoarseToFine(const float pxDisplacement,
+                                                const std::size_t rescaledWidthSharpness,
+                                                const std::size_t rescaledWidthFlow,
+                                                const std::size_t sharpnessWindowSize,
+                                                const std::size_t flowCellSize,
+                                                const std::size_t coarseScale,
+                                                const std::size_t refinementRadius,
+                                                const bool skipSharpnessComputation)
+{
+    if (coarseScale <= 1 || rescaledWidthSharpness == 0 || rescaledWidthFlow == 0)
+    {
+        ALICEVISION_LOG_WARNING("The coarse-to-fine selection requires a coarse scale greater than 1 and explicit "
+                                "rescaled widths. Falling back to the single-pass smart selection.");
+        processSmart(pxDisplacement, rescaledWidthSharpness, rescaledWidthFlow, sharpnessWindowSize, flowCellSize, skipSharpnessComputation);
+        return;
+    }
+
+    _selectedKeyframes.clear();
+    _selectedFrames.clear();
+    _keyframesPaths.clear();
+    _outputSfmKeyframes.clear();
+    _outputSfmFrames.clear();
+
+    /* Step 0: compute all the scores at an aggressively subsampled resolution. The sharpness window
+     * and flow cells are scaled down accordingly so the scores keep the same meaning, and since the
+     * motion criterion is expressed as a percentage of the image size, the subsequence boundaries
+     * computed from the coarse scores closely match the full-resolution ones. */
+    const std::size_t coarseWidthSharpness = std::max<std::size_t>(1, rescaledWidthSharpness / coarseScale);
+    const std::size_t coarseWidthFlow = std::max<std::size_t>(1, rescaledWidthFlow / coarseScale);
+    const std::size_t coarseSharpnessWindow = std::max<std::size_t>(8, sharpnessWindowSize / coarseScale);
+    const std::size_t coarseFlowCellSize = std::max<std::size_t>(8, flowCellSize / coarseScale);
+    computeScores(coarseWidthSharpness, coarseWidthFlow, coarseSharpnessWindow, coarseFlowCellSize, skipSharpnessComputation);
+
+    // Steps 1 and 2: determine the subsequences based on the motion accumulation
+    const std::vector<unsigned int> subsequenceLimits = computeSubsequenceLimits(pxDisplacement);
+
+    const std::size_t sequenceSize = _sharpnessScores.size();
+
+    // All frames are unselected so far
+    _selectedFrames.resize(sequenceSize);
+    std::fill(_selectedFrames.begin(), _selectedFrames.end(), '0');
+
+    // Feeds for the refinement pass, reused across subsequences
+    std::vector<std::unique_ptr<dataio::FeedProvider>> feeds;
+    std::vector<std::unique_ptr<dataio::FeedProvider>> maskFeeds;
+    if (!skipSharpnessComputation)
+    {
+        for (std::size_t mediaIndex = 0; mediaIndex < _mediaPaths.size(); ++mediaIndex)
         {
-            currentWeight -= weightStep;
-            weights.push_front(currentWeight);
-            weights.push_back(currentWeight);
+            feeds.push_back(std::make_unique<dataio::FeedProvider>(_mediaPaths.at(mediaIndex)));
+            if (!feeds.back()->isInit())
+            {
+                ALICEVISION_THROW(std::invalid_argument, "Cannot initialize the FeedProvider with " << _mediaPaths.at(mediaIndex));
+            }
+
+            if (_maskPaths.size() > 0)
+            {
+                maskFeeds.push_back(std::make_unique<dataio::FeedProvider>(_maskPaths.at(mediaIndex)));
+                if (!maskFeeds.back()->isInit())
+                {
+                    ALICEVISION_THROW(std::invalid_argument, "Invalid path to masks: " << _maskPaths.at(mediaIndex));
+                }
+            }
         }
+    }
+
+    /* Step 3: for each subsequence, find the candidate keyframe on the coarse scores, then rescore
+     * only the frames around the candidate at the requested resolution and pick the keyframe among
+     * them. Most frames are never near a candidate, so they are only ever scored at coarse scale. */
+    std::size_t nbRefinedFrames = 0;
+    for (std::size_t i = 1; i < subsequenceLimits.size(); ++i)
+    {
+        const std::size_t subsequenceStart = subsequenceLimits.at(i - 1);
+        const std::size_t subsequenceEnd = subsequenceLimits.at(i);
+        ALICEVISION_LOG_DEBUG("Subsequence [" << subsequenceStart << ", " << subsequenceEnd << "]");
+
+        std::size_t bestIndex = findBestFrame(_sharpnessScores, subsequenceStart, subsequenceEnd, subsequenceStart, subsequenceEnd);
 
-        std::size_t weightPosition = 0;
-        for (std::size_t j = subsequenceLimits.at(i - 1); j < subsequenceLimits.at(i); ++j)
+        if (!skipSharpnessComputation)
         {
-            auto sharpness = _sharpnessScores.at(j) * weights.at(weightPosition);
-            ++weightPosition;
-            if (sharpness > bestSharpness)
+            // Refinement window around the coarse candidate, clamped to the subsequence
+            const std::size_t windowStart = bestIndex > subsequenceStart + refinementRadius ? bestIndex - refinementRadius : subsequenceStart;
+            const std::size_t windowEnd = std::min<std::size_t>(bestIndex + refinementRadius + 1, subsequenceEnd);
+
+            const std::map<std::size_t, double> refinedScores =
+              computeRefinedSharpness(feeds, maskFeeds, windowStart, windowEnd, rescaledWidthSharpness, sharpnessWindowSize);
+            nbRefinedFrames += refinedScores.size();
+
+            if (refinedScores.size() == windowEnd - windowStart)
+            {
+                const std::size_t refinedBest = findBestFrame(refinedScores, subsequenceStart, subsequenceEnd, windowStart, windowEnd);
+                if (refinedBest >= windowStart && refinedBest < windowEnd)
+                    bestIndex = refinedBest;
+            }
+            else
             {
-                bestIndex = j;
-                bestSharpness = sharpness;
+                ALICEVISION_LOG_WARNING("Could not refine the sharpness scores around frame " << bestIndex
+                                                                                              << ", keeping the coarse candidate.");
             }
         }
+
         ALICEVISION_LOG_INFO("Selecting frame with ID " << bestIndex);
         _selectedKeyframes.push_back(bestIndex);
         _selectedFrames.at(bestIndex) = '1';  // The frame has been selected, flip it to 1
     }
 
     ALICEVISION_LOG_INFO("Finished selecting all the keyframes! " << _selectedKeyframes.size() << "/" << sequenceSize
-                                                                  << " frames have been selected.");
+                                                                  << " frames have been selected (" << nbRefinedFrames << "/" << sequenceSize
+                                                                  << " frames rescored at the requested resolution).");
+}
+
+std::map<std::size_t, double> KeyframeSelector::computeRefinedSharpness(std::vector<std::unique_ptr<dataio::FeedProvider>>& feeds,
+                                                                        std::vector<std::unique_ptr<dataio::FeedProvider>>& maskFeeds,
+                                                                        const std::size_t startFrame,
+                                                                        const std::size_t endFrame,
+                                                                        const std::size_t rescaledWidth,
+                                                                        const std::size_t windowSize)
+{
+    std::map<std::size_t, double> scores;
+    const bool masksProvided = maskFeeds.size() > 0;
+    cv::Mat mat, matMask;
+
+    for (std::size_t frame = startFrame; frame < endFrame; ++frame)
+    {
+        double minimalSharpness = std::numeric_limits<double>::max();
+        bool success = true;
+
+        for (std::size_t mediaIndex = 0; mediaIndex < feeds.size(); ++mediaIndex)
+        {
+            try
+            {
+                if (!feeds.at(mediaIndex)->goToFrame(frame))
+                    ALICEVISION_THROW(std::invalid_argument, "Invalid frame position " << frame);
+                mat = readImage(*feeds.at(mediaIndex), rescaledWidth);
+
+                matMask = cv::Mat();
+                if (masksProvided)
+                {
+                    maskFeeds.at(mediaIndex)->goToFrame(frame);
+                    matMask = readImage(*maskFeeds.at(mediaIndex), rescaledWidth);
+                }
+
+                minimalSharpness = std::min(minimalSharpness, computeSharpness(mat, windowSize, matMask));
+            }
+            catch (const std::invalid_argument&)
+            {
+                // Keep the coarse score for frames that cannot be read back
+                ALICEVISION_LOG_WARNING("Invalid or missing frame " << frame + 1 << " during the sharpness refinement.");
+                success = false;
+                break;
+            }
+        }
+
+        if (success)
+            scores[frame] = minimalSharpness;
+    }
+    return scores;
 }
 
 bool KeyframeSelector::computeScores(const std::size_t rescaledWidthSharpness,
@@ -540,6 +718,10 @@ bool KeyframeSelector::computeScoresProc(const std::size_t startFrame,
     cv::Mat previousMatFlow, currentMatFlow;  // OpenCV matrices for the optical flow computation
     auto ptrFlow = cv::optflow::createOptFlow_DeepFlow();
 
+    // Last decoded flow frame of each media, kept in memory so that it does not have to be
+    // decoded a second time as the previous frame of the next iteration
+    std::vector<cv::Mat> previousMatFlows(feeds.size());
+
     cv::Mat currentMatFlowMask, currentMatMask;  // OpenCV matrices that will contain the masks
 
     while (currentFrame < endFrame)
@@ -552,8 +734,8 @@ bool KeyframeSelector::computeScoresProc(const std::size_t startFrame,
             auto& feed = *feeds.at(mediaIndex);
 
             if (currentFrame > startFrame)
-            {  // Get currentFrame - 1 for the optical flow computation
-                previousMatFlow = readImage(feed, rescaledWidthFlow);
+            {  // Get currentFrame - 1 for the optical flow computation, decoded during the previous iteration
+                previousMatFlow = previousMatFlows.at(mediaIndex);
                 feed.goToNextFrame();
 
                 if (masksProvided)
@@ -649,6 +831,9 @@ bool KeyframeSelector::computeScoresProc(const std::size_t startFrame,
                 minimalFlow = std::min(minimalFlow, flow);
             }
 
+            // Keep the current flow frame as the previous frame of the next iteration
+            previousMatFlows.at(mediaIndex) = currentMatFlow;
+
             std::string rigInfo = feeds.size() > 1 ? " (media " + std::to_string(mediaIndex + 1) + "/" + std::to_string(feeds.size()) + ")" : "";
             ALICEVISION_LOG_INFO("Finished processing frame " << currentFrame + 1 << "/" << nbFrames << rigInfo);
         }
@@ -102,6 +102,37 @@ class KeyframeSelector
                       const std::size_t flowCellSize,
                       const bool skipSharpnessComputation = false);
 
+    /**
+     * @brief Same selection as processSmart(), but with a two-pass coarse-to-fine scoring: all the
+     *        frames are first scored at an aggressively subsampled resolution (the rescaled widths,
+     *        sharpness window and flow cell size are divided by the coarse scale), and only the
+     *        frames around each candidate keyframe are rescored at the requested resolution before
+     *        the final pick. Since most frames are never near a candidate, this cuts most of the
+     *        scoring cost on long takes.
+     * @param[in] pxDisplacement in percent, the minimum of displaced pixels in the image since the last selected frame
+     * @param[in] rescaledWidthSharpness the width to resize the input frames to before using them to compute the
+     *            sharpness scores in the refinement pass (must not be 0)
+     * @param[in] rescaledWidthFlow the width to resize the input frames to before using them to compute the
+     *            motion scores (must not be 0)
+     * @param[in] sharpnessWindowSize the size of the sliding window used to compute sharpness scores, in pixels
+     * @param[in] flowCellSize the size of the cells within a frame that are used to compute the optical flow scores,
+     *            in pixels
+     * @param[in] coarseScale the divider applied to the rescaled widths for the coarse scoring pass (must be
+     *            greater than 1, otherwise the single-pass selection is used)
+     * @param[in] refinementRadius the number of frames on each side of a candidate keyframe that are rescored
+     *            at the requested resolution
+     * @param[in] skipSharpnessComputation if true, the sharpness score computations will not be performed and a fixed
+     *            sharpness score will be given to all the input frames
+     */
+    void processSmartCoarseToFine(const float pxDisplacement,
+                                  const std::size_t rescaledWidthSharpness,
+                                  const std::size_t rescaledWidthFlow,
+                                  const std::size_t sharpnessWindowSize,
+                                  const std::size_t flowCellSize,
+                                  const std::size_t coarseScale,
+                                  const std::size_t refinementRadius,
+                                  const bool skipSharpnessComputation = false);
+
     /**
      * @brief Compute the sharpness and optical flow scores for the input media paths
      * @param[in] rescaledWidthSharpness the width to resize the input frames to before using them to compute the
@@ -243,6 +274,46 @@ class KeyframeSelector
                            const std::size_t flowCellSize,
                            const bool skipSharpnessComputation);
 
+    /**
+     * @brief Determine the subsequence limits from the computed motion scores ("motion step"), adjusting
+     *        the displacement step until the number of subsequences fits the min/max output frame constraints
+     * @param[in] pxDisplacement in percent, the minimum of displaced pixels in the image since the last selected frame
+     * @return the frame IDs delimiting the subsequences, starting with the first and ending with the last frame
+     */
+    std::vector<unsigned int> computeSubsequenceLimits(const float pxDisplacement) const;
+
+    /**
+     * @brief Find the frame that best fits both the sharpness and the temporal criteria within a subsequence
+     * @param[in] sharpnessScores the sharpness scores to use, which must cover at least the search range
+     * @param[in] subsequenceStart the frame ID of the beginning of the subsequence (used to center the temporal weights)
+     * @param[in] subsequenceEnd the frame ID of the end of the subsequence
+     * @param[in] searchStart the frame ID of the beginning of the search range
+     * @param[in] searchEnd the frame ID of the end of the search range
+     * @return the frame ID with the best weighted sharpness score within the search range
+     */
+    std::size_t findBestFrame(const std::map<std::size_t, double>& sharpnessScores,
+                              const std::size_t subsequenceStart,
+                              const std::size_t subsequenceEnd,
+                              const std::size_t searchStart,
+                              const std::size_t searchEnd) const;
+
+    /**
+     * @brief Compute the sharpness scores of a contiguous range of frames at the requested resolution
+     * @param[in,out] feeds the feed providers of the input medias
+     * @param[in,out] maskFeeds the feed providers of the masks, empty if no masks are provided
+     * @param[in] startFrame the index of the first frame to compute the scores for
+     * @param[in] endFrame the index of the frame after the last one to compute the scores for
+     * @param[in] rescaledWidth the width to resize the input frames to (if equal to 0, no rescale will be performed)
+     * @param[in] windowSize the size of the sliding window used to compute sharpness scores, in pixels
+     * @return the sharpness score of every frame of the range that could be read back
+     */
+    std::map<std::size_t, double> computeRefinedSharpness(std::vector<std::unique_ptr<dataio::FeedProvider>>& feeds,
+                                                          std::vector<std::unique_ptr<dataio::FeedProvider>>& maskFeeds,
+                                                          const std::size_t startFrame,
+                                                          const std::size_t endFrame,
+                                                          const std::size_t rescaledWidth,
+                                                          const std::size_t windowSize);
+
     /**
      * @brief Compute the sharpness scores for an input grayscale frame with a sliding window
      * @param[in] grayscaleImage the input grayscale matrix of the frame
@@ -7,6 +7,7 @@
 #include <expat.h>
 
 #include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <math.h>
 
@@ -1146,6 +1147,118 @@ void LCPdatabase::loadDirectory(const std::filesystem::path& p)
     }
 }
 
+namespace {
+
+// First line of the compiled index of LCP headers.
+// Bump the version number whenever the layout of the entries changes, so that
+// outdated index files are ignored and rebuilt.
+const char* const lcpHeaderIndexMagic = "aliceVision LCP header index 1";
+
+long long lcpFileTimestamp(const std::filesystem::path& p) { return static_cast<long long>(std::filesystem::last_write_time(p).time_since_epoch().count()); }
+
+}  // namespace
+
+LCPdatabase::~LCPdatabase()
+{
+    if (_headerIndexDirty)
+    {
+        saveHeaderIndex();
+    }
+}
+
+void LCPdatabase::loadHeaderIndex(const std::filesystem::path& folder)
+{
+    if (!std::filesystem::is_directory(folder))
+        return;
+
+    _headerIndexFilepath = folder / "lcpHeaders.index";
+
+    std::ifstream is(_headerIndexFilepath);
+    if (!is)
+        return;
+
+    std::string line;
+    if (!std::getline(is, line) || line != lcpHeaderIndexMagic)
+        // Unknown or outdated layout: the index will be rebuilt on save
+        return;
+
+    while (std::getline(is, line))
+    {
+        try
+        {
+            std::vector<std::string> fields;
+            boost::split(fields, line, boost::is_any_of("\t"));
+            if (fields.size() != 9)
+                continue;
+
+            const std::string& filepath = fields[0];
+            if (!std::filesystem::is_regular_file(filepath) || std::to_string(lcpFileTimestamp(filepath)) != fields[1])
+                // The file changed on disk since the index was compiled: it will be re-parsed on demand
+                continue;
+
+            LCPinfo header;
+            if (fields[2] == "1")
+                header.setAsRawProfile();
+            header.setCameraMaker(fields[3]);
+            header.setCameraModel(fields[4]);
+            header.setCameraPrettyName(fields[5]);
+            header.setLensPrettyName(fields[6]);
+            if (!fields[7].empty())
+            {
+                std::vector<std::string> lensIDs;
+                boost::split(lensIDs, fields[7], boost::is_any_of(","));
+                for (const std::string& lensID : lensIDs)
+                    header.addLensID(std::stoi(lensID));
+            }
+            if (!fields[8].empty())
+            {
+                std::vector<std::string> lensModels;
+                boost::split(lensModels, fields[8], boost::is_any_of("|"));
+                for (const std::string& lensModel : lensModels)
+                    header.addLensModel(lensModel);
+            }
+            _lcpHeaderCache[filepath] = header;
+        }
+        catch (const std::exception&)
+        {
+            // A corrupted entry is not an error: the corresponding file will be re-parsed on demand
+            continue;
+        }
+    }
+}
+
+void LCPdatabase::saveHeaderIndex() const
+{
+    if (_headerIndexFilepath.empty())
+        return;
+
+    std::ofstream os(_headerIndexFilepath);
+    if (!os)
+        // The profile folder may not be writable: the index is only an accelerator
+        return;
+
+    os << lcpHeaderIndexMagic << "\n";
+    for (const auto& cacheItem : _lcpHeaderCache)
+    {
+        const std::string& filepath = cacheItem.first;
+        const LCPinfo& header = cacheItem.second;
+
+        std::vector<int> lensIDs;
+        header.getLensIDs(lensIDs);
+        std::vector<std::string> lensModels;
+        header.getLensModels(lensModels);
+
+        os << filepath << "\t" << lcpFileTimestamp(filepath) << "\t" << (header.isRawProfile() ? 1 : 0) << "\t" << header.getCameraMaker() << "\t"
+           << header.getCameraModel() << "\t" << header.getCameraPrettyName() << "\t" << header.getLensPrettyName() << "\t";
+        for (size_t i = 0; i < lensIDs.size(); ++i)
+            os << (i ? "," : "") << lensIDs[i];
+        os << "\t";
+        for (size_t i = 0; i < lensModels.size(); ++i)
+            os << (i ? "|" : "") << lensModels[i];
+        os << "\n";
+    }
+}
+
 std::string reduceString(const std::string& str)
 {
     std::string s = str;
@@ -1212,12 +1325,13 @@ LCPinfo* LCPdatabase::findLCP(const std::string& cameraMake,
         if (!filepathContainsMake)
             continue;
 
-        auto headerIt = _lcpHeaderCache.find(lcpPath.reducedPath);
+        auto headerIt = _lcpHeaderCache.find(lcpPath.path.string());
         if (headerIt == _lcpHeaderCache.end())
         {
-            // If not already in the cache of LCP headers, add it.
+            // If not already in the cache of LCP headers, parse it and schedule a rewrite of the index.
             _lcpHeaderCache[lcpPath.path.string()] = LCPinfo(lcpPath.path.string(), false);
             headerIt = _lcpHeaderCache.find(lcpPath.path.string());
+            _headerIndexDirty = true;
         }
 
         const LCPinfo& lcpHeader = headerIt->second;
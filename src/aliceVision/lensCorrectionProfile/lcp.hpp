@@ -589,7 +589,7 @@ class LCPinfo
     std::string Make = "";
     std::string Model = "";
     std::string UniqueCameraModel = "";
-    bool CameraRawProfile;
+    bool CameraRawProfile = false;
     std::vector<int> LensID;
     std::vector<std::string> Lens;
     std::string LensInfo = "";
@@ -627,8 +627,9 @@ class LCPdatabase
       : _omitCameraModel(omitCameraModel)
     {
         loadDirectory(folder);
+        loadHeaderIndex(folder);
     }
-    ~LCPdatabase() = default;
+    ~LCPdatabase();
 
     bool empty() const { return _lcpFilepaths.empty(); }
 
@@ -661,6 +662,20 @@ class LCPdatabase
     LCPinfo* findLCP(const std::string& cameraMake, const std::string& cameraModel, const std::string& lensModel, const int lensID, int rawMode);
 
   private:
+    /**
+     * @brief Load the compiled index of LCP headers stored in the profile folder, if any.
+     * Entries whose LCP file changed on disk since the index was compiled are ignored
+     * and will be re-parsed on demand.
+     * @param[in] folder The folder containing all lcp files
+     */
+    void loadHeaderIndex(const std::filesystem::path& folder);
+
+    /**
+     * @brief Write the compiled index of all the LCP headers parsed so far back to the
+     * profile folder, so that the next run can skip the XML parsing of unchanged files.
+     */
+    void saveHeaderIndex() const;
+
     struct LcpPath
     {
         LcpPath(const std::filesystem::path& p)
@@ -682,4 +697,8 @@ class LCPdatabase
     /// The matching could be strict and fully match the camera Make, Model and Lens.
     /// As we are looking for lens information, we can omit the CameraModel to get generic values valid for more lenses.
     bool _omitCameraModel = false;
+    /// Location of the compiled index of LCP headers
+    std::filesystem::path _headerIndexFilepath;
+    /// Set when a header missing from the index has been parsed, requiring a rewrite of the index
+    bool _headerIndexDirty = false;
 };
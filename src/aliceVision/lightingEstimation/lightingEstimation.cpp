@@ -95,9 +95,13 @@ void LighthingEstimator::addImage(const image::Image<float>& albedo,
 
     prepareImageData(channelAlbedo, channelPicture, augmentedNormals, rhoTimesN, colors);
 
-    // store image data
-    _all_rhoTimesN.at(0).push_back(rhoTimesN);
-    _all_pictureChannel.at(0).push_back(colors);
+    // accumulate the normal equations of the image (in double precision, as forming
+    // the normal matrix squares the conditioning), so that the per-pixel design matrix
+    // does not need to be stored nor rebuilt at estimation time
+    const Eigen::MatrixXd rhoTimesNd = rhoTimesN.cast<double>();
+    _all_normalMatrix.at(0) += rhoTimesNd.transpose() * rhoTimesNd;
+    _all_normalRhs.at(0) += rhoTimesNd.transpose() * colors.cast<double>();
+    _all_nbValidPoints.at(0) += rhoTimesN.rows();
 }
 
 void LighthingEstimator::addImage(const image::Image<image::RGBfColor>& albedo,
@@ -123,9 +127,13 @@ void LighthingEstimator::addImage(const image::Image<image::RGBfColor>& albedo,
 
         prepareImageData(channelAlbedo, channelPicture, augmentedNormals, rhoTimesN, colors);
 
-        // store image data
-        _all_rhoTimesN.at(channel).push_back(rhoTimesN);
-        _all_pictureChannel.at(channel).push_back(colors);
+        // accumulate the normal equations of the image (in double precision, as forming
+        // the normal matrix squares the conditioning), so that the per-pixel design matrix
+        // does not need to be stored nor rebuilt at estimation time
+        const Eigen::MatrixXd rhoTimesNd = rhoTimesN.cast<double>();
+        _all_normalMatrix.at(channel) += rhoTimesNd.transpose() * rhoTimesNd;
+        _all_normalRhs.at(channel) += rhoTimesNd.transpose() * colors.cast<double>();
+        _all_nbValidPoints.at(channel) += rhoTimesN.rows();
     }
 }
 
@@ -136,7 +144,7 @@ void LighthingEstimator::estimateLigthing(LightingVector& lighting) const
     // check number of channels
     for (int channel = 0; channel < 3; ++channel)
     {
-        if (_all_rhoTimesN.at(channel).empty())
+        if (_all_nbValidPoints.at(channel) == 0)
         {
             nbChannels = channel;
             break;
@@ -146,63 +154,31 @@ void LighthingEstimator::estimateLigthing(LightingVector& lighting) const
     // for each channel
     for (int channel = 0; channel < nbChannels; ++channel)
     {
-        std::size_t nbRows_all_rhoTimesN = 0;
-        std::size_t nbRows_all_pictureChannel = 0;
-
-        // count and check matrices rows
-        {
-            for (const MatrixXf& matrix : _all_rhoTimesN.at(channel))
-                nbRows_all_rhoTimesN += matrix.rows();
-
-            for (const MatrixXf& matrix : _all_pictureChannel.at(channel))
-                nbRows_all_pictureChannel += matrix.rows();
-
-            assert(nbRows_all_rhoTimesN == nbRows_all_pictureChannel);
-        }
-
-        // agglomerate rhoTimesN
-        MatrixXf rhoTimesN(nbRows_all_rhoTimesN, 9);
-        {
-            std::size_t nbRow = 0;
-            for (const MatrixXf& matrix : _all_rhoTimesN.at(channel))
-            {
-                for (int matrixRow = 0; matrixRow < matrix.rows(); ++matrixRow)
-                    rhoTimesN.row(nbRow + matrixRow) = matrix.row(matrixRow);
-                nbRow += matrix.rows();
-            }
-        }
-
-        // agglomerate pictureChannel
-        MatrixXf pictureChannel(nbRows_all_pictureChannel, 1);
-        {
-            std::size_t nbRow = 0;
-            for (const MatrixXf& matrix : _all_pictureChannel.at(channel))
-            {
-                for (int matrixRow = 0; matrixRow < matrix.rows(); ++matrixRow)
-                    pictureChannel.row(nbRow + matrixRow) = matrix.row(matrixRow);
-                nbRow += matrix.rows();
-            }
-        }
-
-        ALICEVISION_LOG_INFO("Estimate ligthing channel: rhoTimesN(" << rhoTimesN.rows() << "x" << rhoTimesN.cols() << ")");
-        Eigen::Matrix<float, 9, 1> lightingC = rhoTimesN.colPivHouseholderQr().solve(pictureChannel);
+        // The per-pixel normal equations have been accumulated at addImage time:
+        // only the small 9x9 system remains to be solved here.
+        ALICEVISION_LOG_INFO("Estimate ligthing channel: " << _all_nbValidPoints.at(channel) << " accumulated points");
+        const Eigen::Matrix<double, 9, 1> lightingC = _all_normalMatrix.at(channel).ldlt().solve(_all_normalRhs.at(channel));
 
         // lighting vectors fusion
-        lighting.col(channel) = lightingC;
+        lighting.col(channel) = lightingC.cast<float>();
 
         // luminance estimation
         if (nbChannels == 1)
         {
-            lighting.col(1) = lightingC;
-            lighting.col(2) = lightingC;
+            lighting.col(1) = lighting.col(0);
+            lighting.col(2) = lighting.col(0);
         }
     }
 }
 
 void LighthingEstimator::clear()
 {
-    _all_rhoTimesN = std::array<std::vector<MatrixXf>, 3>();
-    _all_pictureChannel = std::array<std::vector<MatrixXf>, 3>();
+    for (int channel = 0; channel < 3; ++channel)
+    {
+        _all_normalMatrix.at(channel).setZero();
+        _all_normalRhs.at(channel).setZero();
+        _all_nbValidPoints.at(channel) = 0;
+    }
 }
 
 }  // namespace lightingEstimation
@@ -66,8 +66,17 @@ class LighthingEstimator
     void clear();
 
   private:
-    std::array<std::vector<MatrixXf>, 3> _all_rhoTimesN;
-    std::array<std::vector<MatrixXf>, 3> _all_pictureChannel;
+    /// Accumulated normal matrices (A^T * A) per channel, updated once per added image
+    /// so that each estimateLigthing call only solves the small 9x9 system
+    std::array<Eigen::Matrix<double, 9, 9>, 3> _all_normalMatrix{
+      {Eigen::Matrix<double, 9, 9>::Zero(), Eigen::Matrix<double, 9, 9>::Zero(), Eigen::Matrix<double, 9, 9>::Zero()}};
+
+    /// Accumulated right hand sides (A^T * b) per channel
+    std::array<Eigen::Matrix<double, 9, 1>, 3> _all_normalRhs{
+      {Eigen::Matrix<double, 9, 1>::Zero(), Eigen::Matrix<double, 9, 1>::Zero(), Eigen::Matrix<double, 9, 1>::Zero()}};
+
+    /// Number of valid points accumulated per channel
+    std::array<std::size_t, 3> _all_nbValidPoints{{0, 0, 0}};
 };
 
 }  // namespace lightingEstimation
@@ -71,6 +71,13 @@ class BoundedBuffer
      */
     const_iterator end() const { return _buffer.end(); }
 
+    /**
+     * @brief Returns whether the buffer is empty.
+     *
+     * @return true if the buffer contains no element.
+     */
+    bool empty() const { return _buffer.empty(); }
+
     /**
      * @brief It add a new element at the end of the buffer. If the buffer is full
      * the first element is removed before the insertion (FIFO strategy).
@@ -363,6 +363,48 @@ bool CCTagLocalizer::localize(const feature::MapRegionsPerDesc& genQueryRegions,
     return localizationResult.isValid();
 }
 
+std::size_t CCTagLocalizer::localizeBatch(const std::vector<feature::MapRegionsPerDesc>& vec_queryRegions,
+                                          const std::vector<std::pair<std::size_t, std::size_t>>& vec_imageSize,
+                                          const LocalizerParameters* parameters,
+                                          std::mt19937& randomNumberGenerator,
+                                          bool useInputIntrinsics,
+                                          std::vector<camera::Pinhole>& vec_queryIntrinsics,
+                                          std::vector<LocalizationResult>& vec_localizationResults)
+{
+    const std::size_t numQueries = vec_queryRegions.size();
+
+    assert(numQueries == vec_imageSize.size());
+    assert(numQueries == vec_queryIntrinsics.size());
+
+    vec_localizationResults.resize(numQueries);
+
+    // draw the per-query seeds upfront so the batch is reproducible whatever the thread scheduling
+    std::vector<std::mt19937::result_type> seeds(numQueries);
+    for (auto& seed : seeds)
+        seed = randomNumberGenerator();
+
+    std::size_t numLocalized = 0;
+
+    // the localization only reads the database, each query works on its own scratch data
+#pragma omp parallel for reduction(+ : numLocalized)
+    for (int i = 0; i < static_cast<int>(numQueries); ++i)
+    {
+        std::mt19937 queryRandomNumberGenerator(seeds[i]);
+        if (localize(vec_queryRegions[i],
+                     vec_imageSize[i],
+                     parameters,
+                     queryRandomNumberGenerator,
+                     useInputIntrinsics,
+                     vec_queryIntrinsics[i],
+                     vec_localizationResults[i]))
+        {
+            ++numLocalized;
+        }
+    }
+
+    return numLocalized;
+}
+
 CCTagLocalizer::~CCTagLocalizer() {}
 
 // subposes is n-1 as we consider the first camera as the main camera and the
@@ -630,18 +672,14 @@ bool CCTagLocalizer::localizeRig_naive(const std::vector<feature::MapRegionsPerD
 
     vec_localizationResults.resize(numCams);
 
-    // this is basic, just localize each camera alone
-    //@todo parallelize?
+    // localize each camera alone: the queries are independent and the database is
+    // read-only, so they are processed in parallel
+    localizeBatch(vec_queryRegions, imageSize, param, randomNumberGenerator, true /*useInputIntrinsics*/, vec_queryIntrinsics, vec_localizationResults);
+
     std::vector<bool> isLocalized(numCams, false);
     for (size_t i = 0; i < numCams; ++i)
     {
-        isLocalized[i] = localize(vec_queryRegions[i],
-                                  imageSize[i],
-                                  param,
-                                  randomNumberGenerator,
-                                  true /*useInputIntrinsics*/,
-                                  vec_queryIntrinsics[i],
-                                  vec_localizationResults[i]);
+        isLocalized[i] = vec_localizationResults[i].isValid();
         if (!isLocalized[i])
         {
             ALICEVISION_CERR("Could not localize camera " << i);
@@ -928,7 +966,7 @@ float viewSimilarity(const feature::CCTAG_Regions& regionsA, const feature::CCTA
     return (descriptorViewA & descriptorViewB).count();
 }
 
-std::bitset<128> constructCCTagViewDescriptor(const std::vector<feature::CCTAG_Regions::DescriptorT>& vCCTagDescriptors)
+std::bitset<128> constructCCTagViewDescriptor(const feature::CCTAG_Regions::DescsT& vCCTagDescriptors)
 {
     std::bitset<128> descriptorView;
     for (const auto& cctagDescriptor : vCCTagDescriptors)
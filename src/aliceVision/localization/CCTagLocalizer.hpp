@@ -72,6 +72,29 @@ class CCTagLocalizer : public ILocalizer
                   LocalizationResult& localizationResult,
                   const std::string& imagePath = std::string()) override;
 
+    /**
+     * @brief Localize a batch of independent queries in parallel, e.g. the synchronized
+     * frames of a multi-camera rig. The localization database is only read, so the
+     * queries are processed concurrently, each one with its own scratch data and its own
+     * random generator deterministically seeded from \p randomNumberGenerator.
+     *
+     * @param[in] vec_queryRegions The input features of each query image.
+     * @param[in] vec_imageSize The size of each input image.
+     * @param[in] parameters The parameters for the localization.
+     * @param[in,out] randomNumberGenerator Generator used to seed the per-query generators.
+     * @param[in] useInputIntrinsics Uses the \p vec_queryIntrinsics as known calibrations.
+     * @param[in,out] vec_queryIntrinsics Intrinsic parameters of each camera.
+     * @param[out] vec_localizationResults The localization result of each query.
+     * @return the number of successfully localized queries.
+     */
+    std::size_t localizeBatch(const std::vector<feature::MapRegionsPerDesc>& vec_queryRegions,
+                              const std::vector<std::pair<std::size_t, std::size_t>>& vec_imageSize,
+                              const LocalizerParameters* parameters,
+                              std::mt19937& randomNumberGenerator,
+                              bool useInputIntrinsics,
+                              std::vector<camera::Pinhole>& vec_queryIntrinsics,
+                              std::vector<LocalizationResult>& vec_localizationResults);
+
     /**
      * @brief Naive implementation of the localizer using the rig. Each image from
      * the rig is localized and then a bundle adjustment is run for optimizing the
@@ -199,7 +222,7 @@ void kNearestKeyFrames(const feature::CCTAG_Regions& queryRegions,
  * @return The view descriptor as a set of bit representing the visibility of
  * each possible marker for that view.
  */
-std::bitset<128> constructCCTagViewDescriptor(const std::vector<feature::CCTAG_Regions::DescriptorT>& vCCTagDescriptors);
+std::bitset<128> constructCCTagViewDescriptor(const feature::CCTAG_Regions::DescsT& vCCTagDescriptors);
 
 float viewSimilarity(const feature::CCTAG_Regions& regionsA, const feature::CCTAG_Regions& regionsB);
 
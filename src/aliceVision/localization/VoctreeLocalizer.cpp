@@ -116,7 +116,8 @@ VoctreeLocalizer::VoctreeLocalizer(const sfmData::SfMData& sfmData,
                                    const std::string& descriptorsFolder,
                                    const std::string& vocTreeFilepath,
                                    const std::string& weightsFilepath,
-                                   const std::vector<feature::EImageDescriberType>& matchingDescTypes)
+                                   const std::vector<feature::EImageDescriberType>& matchingDescTypes,
+                                   const std::string& databaseSnapshotFilepath)
   : ILocalizer(),
     _frameBuffer(5)
 {
@@ -136,7 +137,7 @@ VoctreeLocalizer::VoctreeLocalizer(const sfmData::SfMData& sfmData,
     // then we can store only those associated to 3D points
     //? can we use Feature_Provider to load the features and filter them later?
 
-    _isInit = initDatabase(vocTreeFilepath, weightsFilepath, descriptorsFolder);
+    _isInit = initDatabase(vocTreeFilepath, weightsFilepath, descriptorsFolder, databaseSnapshotFilepath);
 }
 
 bool VoctreeLocalizer::localize(const feature::MapRegionsPerDesc& queryRegions,
@@ -246,8 +247,13 @@ bool VoctreeLocalizer::loadReconstructionDescriptors(const sfmData::SfMData& sfm
  * @brief Initialize the database: load features & descriptors for reconstructed landmarks,
  *        and create voctree image desc.
  */
-bool VoctreeLocalizer::initDatabase(const std::string& vocTreeFilepath, const std::string& weightsFilepath, const std::string& featFolder)
+bool VoctreeLocalizer::initDatabase(const std::string& vocTreeFilepath,
+                                    const std::string& weightsFilepath,
+                                    const std::string& featFolder,
+                                    const std::string& databaseSnapshotFilepath)
 {
+    namespace fs = std::filesystem;
+
     bool withWeights = !weightsFilepath.empty();
 
     // Load vocabulary tree
@@ -270,6 +276,26 @@ bool VoctreeLocalizer::initDatabase(const std::string& vocTreeFilepath, const st
         ALICEVISION_LOG_DEBUG("No weights specified, skipping...");
     }
 
+    // Reload the visual word database from a snapshot of a previous run against the
+    // same map, so the per-view quantization below can be skipped entirely
+    bool databaseLoadedFromSnapshot = false;
+    if (!databaseSnapshotFilepath.empty() && fs::exists(databaseSnapshotFilepath))
+    {
+        ALICEVISION_LOG_INFO("Loading database snapshot: " << databaseSnapshotFilepath);
+        try
+        {
+            _database.load(databaseSnapshotFilepath);
+            databaseLoadedFromSnapshot = true;
+        }
+        catch (const std::exception& e)
+        {
+            ALICEVISION_LOG_WARNING("Failed to load the database snapshot, rebuilding the database: " << e.what());
+            _database = voctree::Database(_voctree->words());
+            if (withWeights)
+                _database.loadWeights(weightsFilepath);
+        }
+    }
+
     // Load the descriptors and the features related to the images
     // for every image, pass the descriptors through the vocabulary tree and
     // add its visual words to the database.
@@ -338,7 +364,7 @@ bool VoctreeLocalizer::initDatabase(const std::string& vocTreeFilepath, const st
             // Load from files
             std::unique_ptr<feature::Regions> currRegions = sfm::loadRegions(featuresFolders, id_view, *imageDescriber);
 
-            if (descType == _voctreeDescType)
+            if (descType == _voctreeDescType && !databaseLoadedFromSnapshot)
             {
                 voctree::SparseHistogram histo = _voctree->quantizeToSparse(currRegions->blindDescriptors());
 #pragma omp critical
@@ -357,6 +383,14 @@ bool VoctreeLocalizer::initDatabase(const std::string& vocTreeFilepath, const st
         }
         ++progressDisplay;
     }
+
+    // Save the built database for the next runs against the same map
+    if (!databaseSnapshotFilepath.empty() && !databaseLoadedFromSnapshot)
+    {
+        ALICEVISION_LOG_INFO("Saving database snapshot: " << databaseSnapshotFilepath);
+        _database.save(databaseSnapshotFilepath);
+    }
+
     return true;
 }
 
@@ -730,6 +764,27 @@ void VoctreeLocalizer::getAllAssociations(const feature::MapRegionsPerDesc& quer
 {
     assert(out_descTypes.empty());
 
+    // A0. frame-to-frame tracking: when enabled, first try to recover the associations
+    // only from the last localized frames, which is much cheaper than the full voctree
+    // retrieval; fall back to the full retrieval when too few associations are found
+    if (param._useFrameTracking && param._nbFrameBufferMatching > 0 && !_frameBuffer.empty())
+    {
+        matching::RegionsDatabaseMatcherPerDesc trackingMatchers(randomNumberGenerator, _matcherType, queryRegions);
+        getAssociationsFromBuffer(trackingMatchers, imageSize, param, useInputIntrinsics, queryIntrinsics, out_occurences, randomNumberGenerator);
+
+        if (out_occurences.size() >= param._minNbTrackingAssociations)
+        {
+            ALICEVISION_LOG_DEBUG("[matching]\tFrame tracking collected " << out_occurences.size()
+                                                                          << " associations, skipping the voctree retrieval");
+            fillAssociations(queryRegions, out_occurences, out_pt2D, out_pt3D, out_descTypes);
+            return;
+        }
+
+        ALICEVISION_LOG_DEBUG("[matching]\tFrame tracking collected only " << out_occurences.size()
+                                                                           << " associations, falling back to the voctree retrieval");
+        out_occurences.clear();
+    }
+
     // A. Find the (visually) similar images in the database
     // pass the descriptors through the vocabulary tree to get the visual words
     // associated to each feature
@@ -907,7 +962,16 @@ void VoctreeLocalizer::getAllAssociations(const feature::MapRegionsPerDesc& quer
         getAssociationsFromBuffer(matchers, imageSize, param, useInputIntrinsics, queryIntrinsics, out_occurences, randomNumberGenerator);
     }
 
-    const std::size_t numCollectedPts = out_occurences.size();
+    fillAssociations(queryRegions, out_occurences, out_pt2D, out_pt3D, out_descTypes);
+}
+
+void VoctreeLocalizer::fillAssociations(const feature::MapRegionsPerDesc& queryRegions,
+                                        const OccurenceMap& occurences,
+                                        Mat& out_pt2D,
+                                        Mat& out_pt3D,
+                                        std::vector<feature::EImageDescriberType>& out_descTypes) const
+{
+    const std::size_t numCollectedPts = occurences.size();
 
     {
         // just debugging statistics, this block can be safely removed
@@ -915,7 +979,7 @@ void VoctreeLocalizer::getAllAssociations(const feature::MapRegionsPerDesc& quer
         for (std::size_t value = 1; value < numCollectedPts; ++value)
         {
             std::size_t counter = 0;
-            for (const auto& idx : out_occurences)
+            for (const auto& idx : occurences)
             {
                 if (idx.second == value)
                 {
@@ -933,10 +997,10 @@ void VoctreeLocalizer::getAllAssociations(const feature::MapRegionsPerDesc& quer
     out_pt2D = Mat2X(2, numCollectedPts);
     out_pt3D = Mat3X(3, numCollectedPts);
 
-    out_descTypes.resize(out_occurences.size());
+    out_descTypes.resize(occurences.size());
 
     std::size_t index = 0;
-    for (const auto& idx : out_occurences)
+    for (const auto& idx : occurences)
     {
         // recopy all the points in the matching structure
         const IndexT pt2D_id = idx.first.featId;
@@ -56,7 +56,9 @@ class VoctreeLocalizer : public ILocalizer
             _numCommonViews(3),
             _ccTagUseCuda(true),
             _matchingError(std::numeric_limits<double>::infinity()),
-            _nbFrameBufferMatching(10)
+            _nbFrameBufferMatching(10),
+            _useFrameTracking(false),
+            _minNbTrackingAssociations(100)
         {}
 
         /// Enable/disable guided matching when matching images
@@ -77,6 +79,12 @@ class VoctreeLocalizer : public ILocalizer
         double _matchingError;
         /// maximum capacity of the frame buffer
         std::size_t _nbFrameBufferMatching;
+        /// seed each frame from the last localized frames and only run the full voctree
+        /// retrieval when the tracking does not collect enough associations
+        bool _useFrameTracking;
+        /// minimum number of 2D-3D associations the frame tracking must collect, below
+        /// this the localization falls back to the full voctree retrieval
+        std::size_t _minNbTrackingAssociations;
     };
 
   public:
@@ -92,6 +100,9 @@ class VoctreeLocalizer : public ILocalizer
      * tree (usually a .weights file), if not provided the weights will be recomputed
      * when all the documents are added.
      * @param[in] matchingDescTypes List of descriptor types to use for feature matching.
+     * @param[in] databaseSnapshotFilepath Optional path to a binary snapshot of the visual
+     * word database: if the file exists the database is reloaded from it instead of
+     * quantizing every view, otherwise the built database is saved there for the next runs.
      * @param[in] voctreeDescType Descriptor type used for image matching with voctree.
      *
      * It enable the use of combined SIFT and CCTAG features.
@@ -100,7 +111,8 @@ class VoctreeLocalizer : public ILocalizer
                      const std::string& descriptorsFolder,
                      const std::string& vocTreeFilepath,
                      const std::string& weightsFilepath,
-                     const std::vector<feature::EImageDescriberType>& matchingDescTypes);
+                     const std::vector<feature::EImageDescriberType>& matchingDescTypes,
+                     const std::string& databaseSnapshotFilepath = std::string());
 
     void setCudaPipe(int i) override { _cudaPipe = i; }
 
@@ -281,9 +293,14 @@ class VoctreeLocalizer : public ILocalizer
      * when all the documents are added.
      * @param[in] feat_directory The path to the directory containing the features
      * of the scene (.desc and .feat files).
+     * @param[in] databaseSnapshotFilepath Optional path to the binary database snapshot
+     * used to skip the per-view quantization on repeated runs against the same map.
      * @return true if everything went ok
      */
-    bool initDatabase(const std::string& vocTreeFilepath, const std::string& weightsFilepath, const std::string& featFolder);
+    bool initDatabase(const std::string& vocTreeFilepath,
+                      const std::string& weightsFilepath,
+                      const std::string& featFolder,
+                      const std::string& databaseSnapshotFilepath);
 
     /**
      * @brief robustMatching
@@ -316,6 +333,21 @@ class VoctreeLocalizer : public ILocalizer
                         matching::MatchesPerDescType& out_featureMatches,
                         robustEstimation::ERobustEstimator estimator = robustEstimation::ERobustEstimator::ACRANSAC) const;
 
+    /**
+     * @brief Copy the collected 2D-3D associations into the output matching structures.
+     *
+     * @param[in] queryRegions The input features of the query image
+     * @param[in] occurences The collected associations
+     * @param[out] out_pt2D output matrix of 2D points
+     * @param[out] out_pt3D output matrix of 3D points
+     * @param[out] out_descTypes output vector of describerType
+     */
+    void fillAssociations(const feature::MapRegionsPerDesc& queryRegions,
+                          const OccurenceMap& occurences,
+                          Mat& out_pt2D,
+                          Mat& out_pt3D,
+                          std::vector<feature::EImageDescriberType>& out_descTypes) const;
+
     void getAssociationsFromBuffer(matching::RegionsDatabaseMatcherPerDesc& matchers,
                                    const std::pair<std::size_t, std::size_t>& imageSize,
                                    const Parameters& param,
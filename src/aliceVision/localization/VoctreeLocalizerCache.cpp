@@ -0,0 +1,68 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "VoctreeLocalizerCache.hpp"
+
+#include <aliceVision/sfmDataIO/sfmDataIO.hpp>
+#include <aliceVision/system/Logger.hpp>
+#include <aliceVision/system/Timer.hpp>
+
+#include <stdexcept>
+
+namespace aliceVision {
+namespace localization {
+
+VoctreeLocalizerCache& VoctreeLocalizerCache::getInstance()
+{
+    static VoctreeLocalizerCache instance;
+    return instance;
+}
+
+std::shared_ptr<VoctreeLocalizer> VoctreeLocalizerCache::get(const std::string& sfmFilePath,
+                                                             const std::string& descriptorsFolder,
+                                                             const std::string& vocTreeFilepath,
+                                                             const std::string& weightsFilepath,
+                                                             const std::vector<feature::EImageDescriberType>& matchingDescTypes)
+{
+    // the key identifies the database inputs, one cache entry per database
+    std::string key = sfmFilePath + "|" + descriptorsFolder + "|" + vocTreeFilepath + "|" + weightsFilepath;
+    for (feature::EImageDescriberType descType : matchingDescTypes)
+        key += "|" + feature::EImageDescriberType_enumToString(descType);
+
+    const std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _localizers.find(key);
+    if (it != _localizers.end())
+        return it->second;
+
+    ALICEVISION_LOG_INFO("VoctreeLocalizerCache: loading localization database of " << sfmFilePath);
+    system::Timer timer;
+
+    sfmData::SfMData sfmData;
+    if (!sfmDataIO::load(sfmData, sfmFilePath, sfmDataIO::ESfMData::ALL))
+    {
+        throw std::invalid_argument("The input SfMData file '" + sfmFilePath + "' cannot be read.");
+    }
+
+    auto localizer = std::make_shared<VoctreeLocalizer>(sfmData, descriptorsFolder, vocTreeFilepath, weightsFilepath, matchingDescTypes);
+
+    ALICEVISION_LOG_INFO("VoctreeLocalizerCache: database loaded in " << timer.elapsedMs() << " ms");
+
+    // keep only successfully initialized localizers, so that a failed load can be retried
+    if (localizer->isInit())
+        _localizers[key] = localizer;
+
+    return localizer;
+}
+
+void VoctreeLocalizerCache::clear()
+{
+    const std::lock_guard<std::mutex> lock(_mutex);
+    _localizers.clear();
+}
+
+}  // namespace localization
+}  // namespace aliceVision
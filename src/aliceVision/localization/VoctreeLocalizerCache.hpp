@@ -0,0 +1,70 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <aliceVision/localization/VoctreeLocalizer.hpp>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace aliceVision {
+namespace localization {
+
+/**
+ * @brief Process-wide cache of fully initialized VoctreeLocalizer instances.
+ *
+ * Loading a localization database (SfM data, vocabulary tree and all the
+ * reconstruction descriptors) takes minutes while a single localization query
+ * takes milliseconds. A long-lived host process, e.g. an AR session that
+ * relocalizes against one or several maps, can attach to a preloaded localizer
+ * through this cache so that each database is loaded only once and shared by
+ * all its clients instead of being reloaded at every localizer construction.
+ *
+ * The cached localizer instance is shared: clients that call localize()
+ * concurrently from several threads must synchronize their calls, as the
+ * localizer keeps a small mutable state (the frame buffer used for
+ * frame-to-frame matching).
+ */
+class VoctreeLocalizerCache
+{
+  public:
+    static VoctreeLocalizerCache& getInstance();
+
+    /**
+     * @brief Get a localizer attached to the given database, loading the database on first use.
+     *
+     * @param[in] sfmFilePath The path to the SfMData file containing the scene reconstruction.
+     * @param[in] descriptorsFolder The path to the directory containing the features of the scene.
+     * @param[in] vocTreeFilepath The path to the vocabulary tree.
+     * @param[in] weightsFilepath Optional path to the weights of the vocabulary tree.
+     * @param[in] matchingDescTypes List of descriptor types to use for feature matching.
+     * @return a shared, fully initialized localizer (check isInit() for the loading status).
+     */
+    std::shared_ptr<VoctreeLocalizer> get(const std::string& sfmFilePath,
+                                          const std::string& descriptorsFolder,
+                                          const std::string& vocTreeFilepath,
+                                          const std::string& weightsFilepath,
+                                          const std::vector<feature::EImageDescriberType>& matchingDescTypes);
+
+    /// Release all the cached localizers.
+    void clear();
+
+    VoctreeLocalizerCache(const VoctreeLocalizerCache&) = delete;
+    void operator=(const VoctreeLocalizerCache&) = delete;
+
+  private:
+    VoctreeLocalizerCache() = default;
+
+    std::map<std::string, std::shared_ptr<VoctreeLocalizer>> _localizers;
+    std::mutex _mutex;
+};
+
+}  // namespace localization
+}  // namespace aliceVision
@@ -14,8 +14,12 @@
 
 #include <aliceVision/config.hpp>
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <iostream>
+#include <type_traits>
+#include <utility>
 
 namespace aliceVision {
 namespace matching {
@@ -117,25 +121,59 @@ class ArrayMatcher_bruteForce : public ArrayMatcher<Scalar, Metric>
 #pragma omp parallel for schedule(dynamic)
         for (int queryIndex = 0; queryIndex < nbQuery; ++queryIndex)
         {
-            std::vector<DistanceType> vec_distance((*memMapping).rows(), 0.0);
             const Scalar* queryPtr = mat_query.row(queryIndex).data();
             const Scalar* rowPtr = (*memMapping).data();
-            for (int i = 0; i < (*memMapping).rows(); ++i)
+
+            if constexpr (std::is_same<Metric, feature::Hamming<Scalar>>::value)
             {
-                vec_distance[i] = metric(queryPtr, rowPtr, (*memMapping).cols());
-                rowPtr += (*memMapping).cols();
+                // binary descriptors: keep the N best candidates on the fly and let the
+                // metric abort a candidate as soon as it exceeds the worst of them
+                std::vector<std::pair<DistanceType, int>> bestCandidates;
+                bestCandidates.reserve(NN + 1);
+                DistanceType worstKeptDistance = std::numeric_limits<DistanceType>::max();
+
+                for (int i = 0; i < (*memMapping).rows(); ++i)
+                {
+                    const DistanceType dist = metric(queryPtr, rowPtr, (*memMapping).cols(), worstKeptDistance);
+                    rowPtr += (*memMapping).cols();
+
+                    if (bestCandidates.size() < NN || dist < bestCandidates.back().first)
+                    {
+                        const std::pair<DistanceType, int> candidate(dist, i);
+                        bestCandidates.insert(std::upper_bound(bestCandidates.begin(), bestCandidates.end(), candidate), candidate);
+                        if (bestCandidates.size() > NN)
+                            bestCandidates.pop_back();
+                        if (bestCandidates.size() == NN)
+                            worstKeptDistance = bestCandidates.back().first;
+                    }
+                }
+
+                for (std::size_t i = 0; i < bestCandidates.size(); ++i)
+                {
+                    (*pvec_distances)[queryIndex * NN + i] = bestCandidates[i].first;
+                    (*pvec_indices)[queryIndex * NN + i] = IndMatch(queryIndex, bestCandidates[i].second);
+                }
             }
-
-            // Find the N minimum distances:
-            const int maxMinFound = (int)std::min(size_t(NN), vec_distance.size());
-            using namespace stl::indexed_sort;
-            std::vector<sort_index_packet_ascend<DistanceType, int>> packet_vec(vec_distance.size());
-            sort_index_helper(packet_vec, &vec_distance[0], maxMinFound);
-
-            for (int i = 0; i < maxMinFound; ++i)
+            else
             {
-                (*pvec_distances)[queryIndex * NN + i] = packet_vec[i].val;
-                (*pvec_indices)[queryIndex * NN + i] = IndMatch(queryIndex, packet_vec[i].index);
+                std::vector<DistanceType> vec_distance((*memMapping).rows(), 0.0);
+                for (int i = 0; i < (*memMapping).rows(); ++i)
+                {
+                    vec_distance[i] = metric(queryPtr, rowPtr, (*memMapping).cols());
+                    rowPtr += (*memMapping).cols();
+                }
+
+                // Find the N minimum distances:
+                const int maxMinFound = (int)std::min(size_t(NN), vec_distance.size());
+                using namespace stl::indexed_sort;
+                std::vector<sort_index_packet_ascend<DistanceType, int>> packet_vec(vec_distance.size());
+                sort_index_helper(packet_vec, &vec_distance[0], maxMinFound);
+
+                for (int i = 0; i < maxMinFound; ++i)
+                {
+                    (*pvec_distances)[queryIndex * NN + i] = packet_vec[i].val;
+                    (*pvec_indices)[queryIndex * NN + i] = IndMatch(queryIndex, packet_vec[i].index);
+                }
             }
         }
         return true;
@@ -0,0 +1,147 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <aliceVision/numeric/numeric.hpp>
+#include <aliceVision/matching/ArrayMatcher.hpp>
+#include <aliceVision/matching/cuda/deviceBruteForceMatching.hpp>
+#include <aliceVision/feature/metric.hpp>
+
+#include <aliceVision/config.hpp>
+
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
+namespace aliceVision {
+namespace matching {
+
+/**
+ * @brief GPU exhaustive matcher (squared L2 distance).
+ *        Descriptors are uploaded once per view in Build() and stay resident on the
+ *        device, so the many query batches of an image-pair list are matched without
+ *        re-uploading the database. Distances are computed on GPU with a tiled kernel.
+ */
+template<typename Scalar = float, typename Metric = feature::L2_Simple<Scalar>>
+class ArrayMatcher_cudaBruteForce : public ArrayMatcher<Scalar, Metric>
+{
+  public:
+    typedef typename Metric::ResultType DistanceType;
+
+    ArrayMatcher_cudaBruteForce() {}
+    virtual ~ArrayMatcher_cudaBruteForce() { bruteForceMatchingDestroyContext(_context); }
+
+    /**
+     * Build the matching structure: upload the dataset on the current CUDA device.
+     *
+     * \param[in] dataset   Input data.
+     * \param[in] nbRows    The number of component.
+     * \param[in] dimension Length of the data contained in the dataset.
+     *
+     * \return True if success.
+     */
+    bool Build(std::mt19937& randomNumberGenerator, const Scalar* dataset, int nbRows, int dimension)
+    {
+        bruteForceMatchingDestroyContext(_context);
+        _context = nullptr;
+
+        if (nbRows < 1)
+            return false;
+
+        const float* floatDataset = toFloat(dataset, size_t(nbRows) * dimension, _floatDataset);
+        _context = bruteForceMatchingCreateContext(floatDataset, nbRows, dimension);
+        _floatDataset.clear();
+        _floatDataset.shrink_to_fit();
+        _dimension = dimension;
+        return _context != nullptr;
+    }
+
+    /**
+     * Search the nearest Neighbor of the scalar array query.
+     *
+     * \param[in]   query     The query array
+     * \param[out]  indice    The indice of array in the dataset that
+     *  have been computed as the nearest array.
+     * \param[out]  distance  The distance between the two arrays.
+     *
+     * \return True if success.
+     */
+    bool SearchNeighbour(const Scalar* query, int* indice, DistanceType* distance)
+    {
+        if (_context == nullptr)
+            return false;
+
+        float floatDistance = 0.0f;
+        std::vector<float> floatQueryStorage;
+        const float* floatQuery = toFloat(query, size_t(_dimension), floatQueryStorage);
+        if (!bruteForceMatchingSearchNeighbours(_context, floatQuery, 1, 1, indice, &floatDistance))
+            return false;
+        *distance = static_cast<DistanceType>(floatDistance);
+        return true;
+    }
+
+    /**
+     * Search the N nearest Neighbor of the scalar array query.
+     *
+     * \param[in]   query     The query array
+     * \param[in]   nbQuery   The number of query rows
+     * \param[out]  indices   The corresponding (query, neighbor) indices
+     * \param[out]  distances The distances between the matched arrays.
+     * \param[out]  NN        The number of maximal neighbor that will be searched.
+     *
+     * \return True if success.
+     */
+    bool SearchNeighbours(const Scalar* query, int nbQuery, IndMatches* pvec_indices, std::vector<DistanceType>* pvec_distances, size_t NN)
+    {
+        if (_context == nullptr || nbQuery < 1)
+            return false;
+        if (NN > size_t(kCudaBruteForceMaxNearestNeighbors))
+            return false;
+
+        std::vector<float> floatQueryStorage;
+        const float* floatQuery = toFloat(query, size_t(nbQuery) * _dimension, floatQueryStorage);
+
+        std::vector<int> neighborIndices(size_t(nbQuery) * NN);
+        std::vector<float> neighborDistances(size_t(nbQuery) * NN);
+        if (!bruteForceMatchingSearchNeighbours(_context, floatQuery, nbQuery, int(NN), neighborIndices.data(), neighborDistances.data()))
+            return false;
+
+        pvec_indices->reserve(neighborIndices.size());
+        pvec_distances->reserve(neighborDistances.size());
+        pvec_indices->clear();
+        pvec_distances->clear();
+        for (int queryIndex = 0; queryIndex < nbQuery; ++queryIndex)
+        {
+            for (size_t i = 0; i < NN; ++i)
+            {
+                pvec_indices->emplace_back(queryIndex, neighborIndices[queryIndex * NN + i]);
+                pvec_distances->emplace_back(static_cast<DistanceType>(neighborDistances[queryIndex * NN + i]));
+            }
+        }
+        return true;
+    };
+
+  private:
+    /// Return the data as a float array, converting into the given storage when Scalar is not float.
+    static const float* toFloat(const Scalar* data, size_t count, std::vector<float>& storage)
+    {
+        if (std::is_same<Scalar, float>::value)
+            return reinterpret_cast<const float*>(data);
+        storage.resize(count);
+        std::copy(data, data + count, storage.begin());
+        return storage.data();
+    }
+
+    /// Device-resident copy of the dataset
+    BruteForceMatchingDeviceContext* _context = nullptr;
+    /// Temporary host storage used when converting non-float datasets
+    std::vector<float> _floatDataset;
+    int _dimension = 0;
+};
+
+}  // namespace matching
+}  // namespace aliceVision
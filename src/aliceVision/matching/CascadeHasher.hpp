@@ -113,6 +113,34 @@ class CascadeHasher
         return true;
     }
 
+    // Bucket layout accessors, used to rebuild the buckets of deserialized hashed descriptions
+    int getNbBucketGroups() const { return nb_bucket_groups_; }
+    int getNbBucketsPerGroup() const { return nb_buckets_per_group_; }
+
+    /**
+     * @brief Checksum of the random hashing projections (FNV-1a over the projection matrices).
+     *
+     * Hashed descriptions cached on disk are only valid for the projections which generated
+     * them: the checksum is part of the cache entry key, so entries computed with an other
+     * random seed are never reused.
+     */
+    std::size_t getProjectionsChecksum() const
+    {
+        std::size_t checksum = 14695981039346656037ULL;
+        const auto hashBytes = [&checksum](const unsigned char* data, std::size_t size) {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                checksum ^= data[i];
+                checksum *= 1099511628211ULL;
+            }
+        };
+        hashBytes(reinterpret_cast<const unsigned char*>(primary_hash_projection_.data()),
+                  primary_hash_projection_.size() * sizeof(float));
+        for (const Eigen::MatrixXf& projection : secondary_hash_projection_)
+            hashBytes(reinterpret_cast<const unsigned char*>(projection.data()), projection.size() * sizeof(float));
+        return checksum;
+    }
+
     template<typename MatrixT>
     static Eigen::VectorXf GetZeroMeanDescriptor(const MatrixT& descriptions)
     {
@@ -9,6 +9,7 @@
 
 #include <aliceVision/types.hpp>
 #include <aliceVision/feature/imageDescriberCommon.hpp>
+#include <aliceVision/stl/FlatMap.hpp>
 
 #include <iostream>
 #include <vector>
@@ -91,9 +92,13 @@ struct MatchesPerDescType : public std::map<feature::EImageDescriberType, IndMat
 };
 
 /// Pairwise matches (indexed matches for a pair <I,J>)
-/// The structure used to store corresponding point indexes per images pairs
+/// The structure used to store corresponding point indexes per images pairs.
+/// The container is read-mostly: it is filled once (matching or load from disk) and then
+/// iterated many times (track building, geometric filtering, statistics), so a sorted
+/// vector is used instead of a node-based map to get contiguous iteration and O(1)
+/// random access. Insertion invalidates iterators and references into the container.
 
-typedef std::map<Pair, MatchesPerDescType> PairwiseMatches;
+typedef stl::flat_map<Pair, MatchesPerDescType> PairwiseMatches;
 
 typedef std::map<Pair, IndMatches> PairwiseSimpleMatches;
 
@@ -11,6 +11,11 @@
 #include "aliceVision/matching/ArrayMatcher_kdtreeFlann.hpp"
 #include "aliceVision/matching/ArrayMatcher_cascadeHashing.hpp"
 
+#include <aliceVision/config.hpp>
+#if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_CUDA)
+    #include "aliceVision/matching/ArrayMatcher_cudaBruteForce.hpp"
+#endif
+
 #include <aliceVision/system/Logger.hpp>
 
 namespace aliceVision {
@@ -57,6 +62,14 @@ std::unique_ptr<IRegionsMatcher> createRegionsMatcher(std::mt19937& randomNumber
 {
     std::unique_ptr<IRegionsMatcher> out;
 
+#if !ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_CUDA)
+    if (matcherType == BRUTE_FORCE_CUDA_L2)
+    {
+        ALICEVISION_LOG_WARNING("AliceVision is built without CUDA support, falling back to BRUTE_FORCE_L2 matching.");
+        matcherType = BRUTE_FORCE_L2;
+    }
+#endif
+
     // Handle invalid request
     if (regions.IsScalar() && matcherType == BRUTE_FORCE_HAMMING)
         return out;
@@ -91,6 +104,15 @@ std::unique_ptr<IRegionsMatcher> createRegionsMatcher(std::mt19937& randomNumber
                     out.reset(new matching::RegionsMatcher<MatcherT>(randomNumberGenerator, regions, true));
                 }
                 break;
+#if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_CUDA)
+                case BRUTE_FORCE_CUDA_L2:
+                {
+                    typedef feature::L2_Vectorized<unsigned char> MetricT;
+                    typedef ArrayMatcher_cudaBruteForce<unsigned char, MetricT> MatcherT;
+                    out.reset(new matching::RegionsMatcher<MatcherT>(randomNumberGenerator, regions, true));
+                }
+                break;
+#endif
                 default:
                     ALICEVISION_LOG_WARNING("Using unknown matcher type");
             }
@@ -120,6 +142,15 @@ std::unique_ptr<IRegionsMatcher> createRegionsMatcher(std::mt19937& randomNumber
                     out.reset(new matching::RegionsMatcher<MatcherT>(randomNumberGenerator, regions, true));
                 }
                 break;
+#if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_CUDA)
+                case BRUTE_FORCE_CUDA_L2:
+                {
+                    typedef feature::L2_Vectorized<float> MetricT;
+                    typedef ArrayMatcher_cudaBruteForce<float, MetricT> MatcherT;
+                    out.reset(new matching::RegionsMatcher<MatcherT>(randomNumberGenerator, regions, true));
+                }
+                break;
+#endif
                 default:
                     ALICEVISION_LOG_WARNING("Using unknown matcher type");
             }
@@ -0,0 +1,192 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "deviceBruteForceMatching.hpp"
+
+#include <aliceVision/system/Logger.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cfloat>
+#include <algorithm>
+
+namespace aliceVision {
+namespace matching {
+
+struct BruteForceMatchingDeviceContext
+{
+    float* database = nullptr;
+    int nbRows = 0;
+    int dimension = 0;
+};
+
+namespace {
+
+/// Number of threads per block, i.e. queries processed per block.
+static const int kBlockSize = 128;
+
+/**
+ * @brief Exhaustive kNN kernel: one thread per query descriptor.
+ *        The database is streamed through shared memory by tiles of tileRows descriptors,
+ *        so each database element is read once from global memory per block instead of
+ *        once per query.
+ */
+__global__ void bruteForceKnnL2_kernel(const float* database,
+                                       int nbDatabaseRows,
+                                       const float* queries,
+                                       int nbQueryRows,
+                                       int dimension,
+                                       int tileRows,
+                                       int nn,
+                                       int* outIndices,
+                                       float* outDistances)
+{
+    extern __shared__ float tile[];
+
+    const int queryIndex = blockIdx.x * blockDim.x + threadIdx.x;
+    const float* query = queries + size_t(queryIndex) * dimension;
+
+    float bestDistance[kCudaBruteForceMaxNearestNeighbors];
+    int bestIndex[kCudaBruteForceMaxNearestNeighbors];
+    for (int i = 0; i < nn; ++i)
+    {
+        bestDistance[i] = FLT_MAX;
+        bestIndex[i] = -1;
+    }
+
+    for (int tileStart = 0; tileStart < nbDatabaseRows; tileStart += tileRows)
+    {
+        const int nbTileRows = min(tileRows, nbDatabaseRows - tileStart);
+
+        // cooperative tile load
+        for (int i = threadIdx.x; i < nbTileRows * dimension; i += blockDim.x)
+            tile[i] = database[size_t(tileStart) * dimension + i];
+        __syncthreads();
+
+        if (queryIndex < nbQueryRows)
+        {
+            for (int row = 0; row < nbTileRows; ++row)
+            {
+                const float* databaseRow = tile + size_t(row) * dimension;
+                float distance = 0.0f;
+                for (int d = 0; d < dimension; ++d)
+                {
+                    const float diff = query[d] - databaseRow[d];
+                    distance += diff * diff;
+                }
+                if (distance < bestDistance[nn - 1])
+                {
+                    // keep the per-thread nearest-neighbor list sorted
+                    int insertPos = nn - 1;
+                    while (insertPos > 0 && distance < bestDistance[insertPos - 1])
+                    {
+                        bestDistance[insertPos] = bestDistance[insertPos - 1];
+                        bestIndex[insertPos] = bestIndex[insertPos - 1];
+                        --insertPos;
+                    }
+                    bestDistance[insertPos] = distance;
+                    bestIndex[insertPos] = tileStart + row;
+                }
+            }
+        }
+        __syncthreads();
+    }
+
+    if (queryIndex < nbQueryRows)
+    {
+        for (int i = 0; i < nn; ++i)
+        {
+            outIndices[size_t(queryIndex) * nn + i] = bestIndex[i];
+            outDistances[size_t(queryIndex) * nn + i] = bestDistance[i];
+        }
+    }
+}
+
+}  // namespace
+
+BruteForceMatchingDeviceContext* bruteForceMatchingCreateContext(const float* dataset, int nbRows, int dimension)
+{
+    if (dataset == nullptr || nbRows < 1 || dimension < 1)
+        return nullptr;
+
+    float* deviceDataset = nullptr;
+    const size_t datasetSize = size_t(nbRows) * dimension * sizeof(float);
+    if (cudaMalloc(&deviceDataset, datasetSize) != cudaSuccess)
+    {
+        ALICEVISION_LOG_WARNING("CUDA brute-force matching: cannot allocate " << datasetSize << " bytes of device memory.");
+        return nullptr;
+    }
+    if (cudaMemcpy(deviceDataset, dataset, datasetSize, cudaMemcpyHostToDevice) != cudaSuccess)
+    {
+        ALICEVISION_LOG_WARNING("CUDA brute-force matching: dataset upload failed.");
+        cudaFree(deviceDataset);
+        return nullptr;
+    }
+
+    BruteForceMatchingDeviceContext* context = new BruteForceMatchingDeviceContext;
+    context->database = deviceDataset;
+    context->nbRows = nbRows;
+    context->dimension = dimension;
+    return context;
+}
+
+void bruteForceMatchingDestroyContext(BruteForceMatchingDeviceContext* context)
+{
+    if (context == nullptr)
+        return;
+    cudaFree(context->database);
+    delete context;
+}
+
+bool bruteForceMatchingSearchNeighbours(const BruteForceMatchingDeviceContext* context,
+                                        const float* queries,
+                                        int nbQueryRows,
+                                        int nn,
+                                        int* outIndices,
+                                        float* outDistances)
+{
+    if (context == nullptr || queries == nullptr || nbQueryRows < 1)
+        return false;
+    if (nn < 1 || nn > kCudaBruteForceMaxNearestNeighbors || nn > context->nbRows)
+        return false;
+
+    const int dimension = context->dimension;
+
+    float* deviceQueries = nullptr;
+    int* deviceIndices = nullptr;
+    float* deviceDistances = nullptr;
+
+    bool success = (cudaMalloc(&deviceQueries, size_t(nbQueryRows) * dimension * sizeof(float)) == cudaSuccess) &&
+                   (cudaMalloc(&deviceIndices, size_t(nbQueryRows) * nn * sizeof(int)) == cudaSuccess) &&
+                   (cudaMalloc(&deviceDistances, size_t(nbQueryRows) * nn * sizeof(float)) == cudaSuccess) &&
+                   (cudaMemcpy(deviceQueries, queries, size_t(nbQueryRows) * dimension * sizeof(float), cudaMemcpyHostToDevice) == cudaSuccess);
+
+    if (success)
+    {
+        // choose the database tile height so that a tile fits in 48 KB of shared memory
+        const int tileRows = std::max(1, std::min(64, int(48 * 1024 / sizeof(float)) / dimension));
+        const size_t sharedMemorySize = size_t(tileRows) * dimension * sizeof(float);
+        const int gridSize = (nbQueryRows + kBlockSize - 1) / kBlockSize;
+
+        bruteForceKnnL2_kernel<<<gridSize, kBlockSize, sharedMemorySize>>>(
+          context->database, context->nbRows, deviceQueries, nbQueryRows, dimension, tileRows, nn, deviceIndices, deviceDistances);
+
+        success = (cudaGetLastError() == cudaSuccess) && (cudaDeviceSynchronize() == cudaSuccess) &&
+                  (cudaMemcpy(outIndices, deviceIndices, size_t(nbQueryRows) * nn * sizeof(int), cudaMemcpyDeviceToHost) == cudaSuccess) &&
+                  (cudaMemcpy(outDistances, deviceDistances, size_t(nbQueryRows) * nn * sizeof(float), cudaMemcpyDeviceToHost) == cudaSuccess);
+    }
+
+    if (!success)
+        ALICEVISION_LOG_WARNING("CUDA brute-force matching: kNN search failed on device.");
+
+    cudaFree(deviceQueries);
+    cudaFree(deviceIndices);
+    cudaFree(deviceDistances);
+    return success;
+}
+
+}  // namespace matching
+}  // namespace aliceVision
@@ -0,0 +1,56 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+
+namespace aliceVision {
+namespace matching {
+
+/// Maximum number of nearest neighbors per query supported by the CUDA brute-force kernels.
+static const int kCudaBruteForceMaxNearestNeighbors = 16;
+
+/**
+ * @brief Opaque handle on a descriptor dataset uploaded once on the current CUDA device.
+ *        The dataset stays resident so that many query batches (one per image pair)
+ *        can be matched against it without re-uploading descriptors.
+ */
+struct BruteForceMatchingDeviceContext;
+
+/**
+ * @brief Upload a row-major float descriptor dataset on the current CUDA device.
+ * @param[in] dataset row-major matrix of nbRows descriptors of size dimension
+ * @param[in] nbRows the number of descriptors
+ * @param[in] dimension the descriptor dimension
+ * @return a device context to destroy with bruteForceMatchingDestroyContext, nullptr on failure
+ */
+BruteForceMatchingDeviceContext* bruteForceMatchingCreateContext(const float* dataset, int nbRows, int dimension);
+
+/**
+ * @brief Release the device memory held by a context created with bruteForceMatchingCreateContext.
+ */
+void bruteForceMatchingDestroyContext(BruteForceMatchingDeviceContext* context);
+
+/**
+ * @brief Exhaustive kNN search (squared L2) of a query batch against the uploaded dataset.
+ * @param[in] context the device-resident dataset
+ * @param[in] queries row-major matrix of nbQueryRows descriptors (same dimension as the dataset)
+ * @param[in] nbQueryRows the number of query descriptors
+ * @param[in] nn the number of nearest neighbors per query (<= kCudaBruteForceMaxNearestNeighbors)
+ * @param[out] outIndices nbQueryRows * nn dataset row indices, sorted by increasing distance
+ * @param[out] outDistances nbQueryRows * nn squared L2 distances
+ * @return true on success
+ */
+bool bruteForceMatchingSearchNeighbours(const BruteForceMatchingDeviceContext* context,
+                                        const float* queries,
+                                        int nbQueryRows,
+                                        int nn,
+                                        int* outIndices,
+                                        float* outDistances);
+
+}  // namespace matching
+}  // namespace aliceVision
@@ -7,9 +7,157 @@
 
 #include "guidedMatching.hpp"
 
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
 namespace aliceVision {
 namespace matching {
 
+std::size_t FeaturePositionsGrid::cellIndex(const Vec2& p) const
+{
+    const int cx = std::clamp(int(p(0)) / _cellSize, 0, _gridWidth - 1);
+    const int cy = std::clamp(int(p(1)) / _cellSize, 0, _gridHeight - 1);
+    return std::size_t(cy) * _gridWidth + cx;
+}
+
+void FeaturePositionsGrid::appendCell(std::size_t cell, std::vector<IndexT>& out_indices) const
+{
+    out_indices.insert(out_indices.end(), _indices.begin() + _cellOffsets[cell], _indices.begin() + _cellOffsets[cell + 1]);
+}
+
+void FeaturePositionsGrid::build(const std::vector<Vec2>& positions, int width, int height, int cellSize)
+{
+    assert(cellSize > 0);
+    _cellSize = cellSize;
+    _gridWidth = std::max(1, (width + cellSize - 1) / cellSize);
+    _gridHeight = std::max(1, (height + cellSize - 1) / cellSize);
+
+    const std::size_t nbCells = std::size_t(_gridWidth) * _gridHeight;
+    _cellOffsets.assign(nbCells + 1, 0);
+    _indices.resize(positions.size());
+
+    // first pass: histogram of the cell populations
+    for (const Vec2& p : positions)
+        ++_cellOffsets[cellIndex(p) + 1];
+
+    // prefix sum to get the cell begin offsets
+    for (std::size_t c = 1; c <= nbCells; ++c)
+        _cellOffsets[c] += _cellOffsets[c - 1];
+
+    // second pass: scatter the feature indices into their cell
+    std::vector<std::uint32_t> cellNext(_cellOffsets.begin(), _cellOffsets.end() - 1);
+    for (std::size_t i = 0; i < positions.size(); ++i)
+        _indices[cellNext[cellIndex(positions[i])]++] = IndexT(i);
+}
+
+void FeaturePositionsGrid::queryEpipolarBand(const Vec3& line, double margin, std::vector<IndexT>& out_indices) const
+{
+    out_indices.clear();
+
+    const double norm = line.head<2>().norm();
+    if (norm == 0.0)
+        return;
+
+    // normalize so that a*x + b*y + c is a point/line distance
+    const double a = line(0) / norm;
+    const double b = line(1) / norm;
+    const double c = line(2) / norm;
+
+    if (std::abs(b) >= std::abs(a))
+    {
+        // the line is closer to horizontal: walk the grid columns and bound the band rows
+        const double slack = margin / std::abs(b);
+        for (int cx = 0; cx < _gridWidth; ++cx)
+        {
+            const double x0 = double(cx) * _cellSize;
+            const double x1 = x0 + _cellSize;
+            const double y0 = -(a * x0 + c) / b;
+            const double y1 = -(a * x1 + c) / b;
+            const double yMin = std::min(y0, y1) - slack;
+            const double yMax = std::max(y0, y1) + slack;
+
+            if (yMax < 0.0 || yMin >= double(_gridHeight) * _cellSize)
+                continue;
+
+            const int cyBegin = std::clamp(int(std::floor(yMin)) / _cellSize, 0, _gridHeight - 1);
+            const int cyEnd = std::clamp(int(std::floor(yMax)) / _cellSize, 0, _gridHeight - 1);
+            for (int cy = cyBegin; cy <= cyEnd; ++cy)
+                appendCell(std::size_t(cy) * _gridWidth + cx, out_indices);
+        }
+    }
+    else
+    {
+        // the line is closer to vertical: walk the grid rows and bound the band columns
+        const double slack = margin / std::abs(a);
+        for (int cy = 0; cy < _gridHeight; ++cy)
+        {
+            const double y0 = double(cy) * _cellSize;
+            const double y1 = y0 + _cellSize;
+            const double x0 = -(b * y0 + c) / a;
+            const double x1 = -(b * y1 + c) / a;
+            const double xMin = std::min(x0, x1) - slack;
+            const double xMax = std::max(x0, x1) + slack;
+
+            if (xMax < 0.0 || xMin >= double(_gridWidth) * _cellSize)
+                continue;
+
+            const int cxBegin = std::clamp(int(std::floor(xMin)) / _cellSize, 0, _gridWidth - 1);
+            const int cxEnd = std::clamp(int(std::floor(xMax)) / _cellSize, 0, _gridWidth - 1);
+            for (int cx = cxBegin; cx <= cxEnd; ++cx)
+                appendCell(std::size_t(cy) * _gridWidth + cx, out_indices);
+        }
+    }
+}
+
+void guidedMatchingFundamentalGrid(const Mat3& FMat,
+                                   const feature::Regions& lRegions,
+                                   const std::vector<Vec2>& lPositions,
+                                   const feature::Regions& rRegions,
+                                   const std::vector<Vec2>& rPositions,
+                                   const FeaturePositionsGrid& rGrid,
+                                   double errorTh,
+                                   double distRatio,
+                                   matching::IndMatches& out_matches)
+{
+    assert(lPositions.size() == lRegions.RegionCount());
+    assert(rPositions.size() == rRegions.RegionCount());
+
+    const double bandHalfWidth = std::sqrt(errorTh);
+
+    // candidate buffer reused across the queries
+    std::vector<IndexT> candidates;
+    candidates.reserve(256);
+
+    for (std::size_t i = 0; i < lPositions.size(); ++i)
+    {
+        // compute the epipolar line of the left feature in the right image
+        const Vec3 line = FMat * Vec3(lPositions[i](0), lPositions[i](1), 1.0);
+
+        rGrid.queryEpipolarBand(line, bandHalfWidth, candidates);
+        if (candidates.empty())
+            continue;
+
+        distanceRatio<double> dR;
+        for (const IndexT j : candidates)
+        {
+            // transfer error in image 2
+            // @see page 287 equation (11.9) of HZ.
+            const Vec3 y(rPositions[j](0), rPositions[j](1), 1.0);
+            const double geomErr = Square(line.dot(y)) / line.head<2>().squaredNorm();
+
+            if (geomErr < errorTh)
+                dR.update(j, lRegions.SquaredDescriptorDistance(i, &rRegions, j));
+        }
+        // add correspondence only iff the distance ratio is valid
+        if (dR.isValid(distRatio))
+            out_matches.emplace_back(i, dR.idx);
+    }
+
+    // remove duplicates (when multiple points at same position exist)
+    matching::IndMatch::getDeduplicated(out_matches);
+}
+
 unsigned int pix_to_bucket(const Vec2i& x, int W, int H)
 {
     if (x(1) == 0)
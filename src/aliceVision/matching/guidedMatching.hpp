@@ -13,6 +13,7 @@
 #include <aliceVision/feature/Regions.hpp>
 #include <aliceVision/camera/IntrinsicBase.hpp>
 
+#include <cstdint>
 #include <vector>
 
 namespace aliceVision {
@@ -312,6 +313,95 @@ void guidedMatching(const ModelT& mod,
     }
 }
 
+/**
+ * @brief Reusable uniform-grid index over 2D feature positions.
+ *
+ * The cells are stored in a compressed layout (one offset array plus one flat
+ * index array), so building performs two passes over the positions and queries
+ * never allocate. An instance indexes the features of a single view and can be
+ * reused across every image pair involving that view.
+ */
+class FeaturePositionsGrid
+{
+  public:
+    FeaturePositionsGrid() = default;
+
+    /**
+     * @brief Build the grid over a set of feature positions.
+     *
+     * Positions outside the image domain (e.g. after undistortion) are clamped
+     * into the border cells.
+     *
+     * @param[in] positions The feature positions, one per feature index
+     * @param[in] width Image width in pixels
+     * @param[in] height Image height in pixels
+     * @param[in] cellSize Grid cell size in pixels
+     */
+    void build(const std::vector<Vec2>& positions, int width, int height, int cellSize = 64);
+
+    /**
+     * @brief Collect the features lying in the cells crossed by the band of
+     *        half-width \p margin around a line.
+     *
+     * The candidates of all the crossed cells are gathered in one batch; the
+     * output buffer is cleared first and can be reused across queries to avoid
+     * any allocation in steady state.
+     *
+     * @param[in] line The line (a, b, c) in pixel coordinates, with a*x + b*y + c = 0
+     * @param[in] margin The band half-width in pixels
+     * @param[out] out_indices The indices of the candidate features
+     */
+    void queryEpipolarBand(const Vec3& line, double margin, std::vector<IndexT>& out_indices) const;
+
+    bool empty() const { return _indices.empty(); }
+
+  private:
+    /// Clamped cell index of a position
+    std::size_t cellIndex(const Vec2& p) const;
+
+    /// Append the content of a cell to the output buffer
+    void appendCell(std::size_t cell, std::vector<IndexT>& out_indices) const;
+
+    int _cellSize = 64;
+    int _gridWidth = 0;
+    int _gridHeight = 0;
+    /// per-cell begin offsets into _indices (compressed layout, nbCells + 1 entries)
+    std::vector<std::uint32_t> _cellOffsets;
+    /// feature indices grouped by cell
+    std::vector<IndexT> _indices;
+};
+
+/**
+ * @brief Guided Matching (features + descriptors with distance ratio):
+ *        Prune the candidate pairs with a prebuilt uniform grid over the right
+ *        features: each left feature only tests the features lying in the cells
+ *        crossed by its epipolar band, then the survivors are checked against
+ *        the exact epipolar transfer error.
+ *
+ * The undistorted positions and the grid only depend on one view, so the caller
+ * builds them once per view and reuses them for every pair sharing that view,
+ * instead of rebuilding a per-pair structure as guidedMatchingFundamentalFast does.
+ *
+ * @param[in] FMat The fundamental matrix
+ * @param[in] lRegions Left regions (point features & corresponding descriptors)
+ * @param[in] lPositions Left feature positions (undistorted when applicable)
+ * @param[in] rRegions Right regions (point features & corresponding descriptors)
+ * @param[in] rPositions Right feature positions (undistorted when applicable)
+ * @param[in] rGrid Grid index built over \p rPositions
+ * @param[in] errorTh Maximal authorized error threshold (consider it's a square threshold)
+ * @param[in] distRatio Maximal authorized distance ratio
+ * @param[out] out_matches Ouput corresponding index
+ */
+void guidedMatchingFundamentalGrid(const Mat3& FMat,
+                                   const feature::Regions& lRegions,
+                                   const std::vector<Vec2>& lPositions,
+                                   const feature::Regions& rRegions,
+                                   const std::vector<Vec2>& rPositions,
+                                   const FeaturePositionsGrid& rGrid,
+                                   double errorTh,
+                                   double distRatio,
+                                   matching::IndMatches& out_matches);
+
 /**
  * @brief Compute a bucket index from an epipolar point
  *        (the one that is closer to image border intersection)
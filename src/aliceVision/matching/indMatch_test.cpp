@@ -107,6 +107,47 @@ BOOST_AUTO_TEST_CASE(IndMatch_IO)
     fs::remove_all(testFolder);
 }
 
+BOOST_AUTO_TEST_CASE(IndMatch_IO_bin)
+{
+    const std::string testFolder = "matchingTestBin";
+    fs::remove_all(testFolder);
+    fs::create_directory(testFolder);
+    {
+        std::set<IndexT> viewsKeys = {0, 1, 2};
+        PairwiseMatches matches;
+        matches[std::make_pair(0, 1)][EImageDescriberType::UNKNOWN] = {{0, 0}, {1, 1}};
+        matches[std::make_pair(1, 2)][EImageDescriberType::UNKNOWN] = {{0, 0}, {1, 1}, {2, 2}};
+        matches[std::make_pair(1, 2)][EImageDescriberType::SIFT] = {{5, 6}};
+
+        // Test binary save + load round trip
+        BOOST_CHECK(Save(matches, testFolder, "bin", false));
+        matches.clear();
+        BOOST_CHECK(Load(matches, viewsKeys, {testFolder}, {}));
+        BOOST_CHECK_EQUAL(2, matches.size());
+        BOOST_CHECK_EQUAL(2, matches.at(std::make_pair(0, 1)).at(EImageDescriberType::UNKNOWN).size());
+        BOOST_CHECK_EQUAL(3, matches.at(std::make_pair(1, 2)).at(EImageDescriberType::UNKNOWN).size());
+        BOOST_CHECK_EQUAL(1, matches.at(std::make_pair(1, 2)).at(EImageDescriberType::SIFT).size());
+        BOOST_CHECK_EQUAL(IndMatch(5, 6), matches.at(std::make_pair(1, 2)).at(EImageDescriberType::SIFT)[0]);
+    }
+    fs::remove_all(testFolder);
+    fs::create_directory(testFolder);
+    {
+        std::set<IndexT> viewsKeys = {0, 1, 2};
+        PairwiseMatches matches;
+        matches[std::make_pair(0, 1)][EImageDescriberType::UNKNOWN] = {{0, 0}, {1, 1}};
+        matches[std::make_pair(1, 2)][EImageDescriberType::UNKNOWN] = {{0, 0}, {1, 1}, {2, 2}};
+
+        // Test binary save + load round trip with one match file per image
+        BOOST_CHECK(Save(matches, testFolder, "bin", true));
+        matches.clear();
+        BOOST_CHECK(Load(matches, viewsKeys, {testFolder}, {EImageDescriberType::UNKNOWN}));
+        BOOST_CHECK_EQUAL(2, matches.size());
+        BOOST_CHECK_EQUAL(2, matches.at(std::make_pair(0, 1)).at(EImageDescriberType::UNKNOWN).size());
+        BOOST_CHECK_EQUAL(3, matches.at(std::make_pair(1, 2)).at(EImageDescriberType::UNKNOWN).size());
+    }
+    fs::remove_all(testFolder);
+}
+
 BOOST_AUTO_TEST_CASE(IndMatch_DuplicateRemoval_NoRemoval)
 {
     std::vector<IndMatch> vec_indMatch;
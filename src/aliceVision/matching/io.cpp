@@ -13,6 +13,7 @@
 
 #include <boost/range/iterator_range.hpp>
 
+#include <cstdint>
 #include <map>
 #include <filesystem>
 #include <fstream>
@@ -25,6 +26,86 @@ namespace fs = std::filesystem;
 namespace aliceVision {
 namespace matching {
 
+namespace {
+
+// Binary matches file layout (all fields little-endian, native layout):
+// - header: magic (8 chars), version (uint32), number of pairs (uint32)
+// - index table: one entry per pair {I (uint32), J (uint32), nbDescTypes (uint32), offset (uint64)}
+//   where offset points to the pair data block from the beginning of the file
+// - pair data blocks: per descType {descType (uint8), nbMatches (uint32), nbMatches * {i (uint32), j (uint32)}}
+// The index table allows to seek directly to the pairs of a given view without parsing the whole file.
+const char MATCHES_BIN_MAGIC[8] = {'A', 'V', 'M', 'A', 'T', 'C', 'H', 'B'};
+const std::uint32_t MATCHES_BIN_VERSION = 1;
+
+struct MatchesBinPairIndex
+{
+    std::uint32_t I;
+    std::uint32_t J;
+    std::uint32_t nbDescTypes;
+    std::uint64_t offset;
+};
+
+bool loadMatchesBin(PairwiseMatches& matches, const std::string& filepath)
+{
+    std::ifstream stream(filepath, std::ios::in | std::ios::binary);
+    if (!stream.is_open())
+        return false;
+
+    char magic[8];
+    std::uint32_t version = 0;
+    std::uint32_t nbPairs = 0;
+    stream.read(magic, sizeof(magic));
+    stream.read(reinterpret_cast<char*>(&version), sizeof(version));
+    stream.read(reinterpret_cast<char*>(&nbPairs), sizeof(nbPairs));
+
+    if (!stream || !std::equal(magic, magic + sizeof(magic), MATCHES_BIN_MAGIC))
+    {
+        ALICEVISION_LOG_WARNING("Invalid binary matches file: " << filepath);
+        return false;
+    }
+    if (version != MATCHES_BIN_VERSION)
+    {
+        ALICEVISION_LOG_WARNING("Unsupported binary matches file version " << version << ": " << filepath);
+        return false;
+    }
+
+    std::vector<MatchesBinPairIndex> index(nbPairs);
+    stream.read(reinterpret_cast<char*>(index.data()), nbPairs * sizeof(MatchesBinPairIndex));
+
+    // the pair data blocks are stored in the index order, read them sequentially
+    for (const MatchesBinPairIndex& pairIndex : index)
+    {
+        MatchesPerDescType& matchesPerDesc = matches[std::make_pair(pairIndex.I, pairIndex.J)];
+        for (std::uint32_t d = 0; d < pairIndex.nbDescTypes; ++d)
+        {
+            std::uint8_t descType = 0;
+            std::uint32_t nbMatches = 0;
+            stream.read(reinterpret_cast<char*>(&descType), sizeof(descType));
+            stream.read(reinterpret_cast<char*>(&nbMatches), sizeof(nbMatches));
+
+            std::vector<std::uint32_t> indexes(2 * std::size_t(nbMatches));
+            stream.read(reinterpret_cast<char*>(indexes.data()), indexes.size() * sizeof(std::uint32_t));
+
+            IndMatches& matchesPerType = matchesPerDesc[feature::EImageDescriberType(descType)];
+            matchesPerType.resize(nbMatches);
+            for (std::uint32_t i = 0; i < nbMatches; ++i)
+            {
+                matchesPerType[i]._i = indexes[2 * i];
+                matchesPerType[i]._j = indexes[2 * i + 1];
+            }
+        }
+    }
+
+    if (!stream)
+    {
+        ALICEVISION_LOG_WARNING("Truncated binary matches file: " << filepath);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
 bool LoadMatchFile(PairwiseMatches& matches, const std::string& filepath)
 {
     const std::string ext = fs::path(filepath).extension().string();
@@ -32,7 +113,11 @@ bool LoadMatchFile(PairwiseMatches& matches, const std::string& filepath)
     if (!fs::exists(filepath))
         return false;
 
-    if (ext == ".txt")
+    if (ext == ".bin")
+    {
+        return loadMatchesBin(matches, filepath);
+    }
+    else if (ext == ".txt")
     {
         std::ifstream stream(filepath);
         if (!stream.is_open())
@@ -213,8 +298,6 @@ std::size_t loadMatchesFromFolder(PairwiseMatches& matches, const std::string& f
             ++nbLoadedMatchFiles;
         }
     }
-    if (!nbLoadedMatchFiles)
-        ALICEVISION_LOG_WARNING("No matches file loaded in: " << folder);
     return nbLoadedMatchFiles;
 }
 
@@ -226,7 +309,8 @@ bool Load(PairwiseMatches& matches,
           int minNbMatches)
 {
     std::size_t nbLoadedMatchFiles = 0;
-    const std::string pattern = "matches.txt";
+    // newer folders contain binary matches files, older ones text files
+    const std::vector<std::string> patterns = {"matches.bin", "matches.txt"};
 
     // build up a set with normalized paths to remove duplicates
     std::set<std::string> foldersSet;
@@ -240,7 +324,14 @@ bool Load(PairwiseMatches& matches,
 
     for (const auto& folder : foldersSet)
     {
-        nbLoadedMatchFiles += loadMatchesFromFolder(matches, folder, pattern);
+        std::size_t nbLoadedInFolder = 0;
+        for (const std::string& pattern : patterns)
+        {
+            nbLoadedInFolder += loadMatchesFromFolder(matches, folder, pattern);
+        }
+        if (!nbLoadedInFolder)
+            ALICEVISION_LOG_WARNING("No matches file loaded in: " << folder);
+        nbLoadedMatchFiles += nbLoadedInFolder;
     }
 
     if (!nbLoadedMatchFiles)
@@ -304,6 +395,62 @@ class MatchExporter
         fs::rename(tmpPath, filepath);
     }
 
+    void saveBin(const std::string& filepath, const PairwiseMatches::const_iterator& matchBegin, const PairwiseMatches::const_iterator& matchEnd)
+    {
+        const fs::path bPath = fs::path(filepath);
+        const std::string tmpPath =
+          (bPath.parent_path() / bPath.stem()).string() + "." + utils::generateUniqueFilename() + bPath.extension().string();
+
+        const std::uint32_t nbPairs = std::distance(matchBegin, matchEnd);
+
+        // build the index table, the data blocks are stored in the same order
+        std::vector<MatchesBinPairIndex> index;
+        index.reserve(nbPairs);
+        std::uint64_t offset = sizeof(MATCHES_BIN_MAGIC) + sizeof(std::uint32_t) + sizeof(std::uint32_t) + nbPairs * sizeof(MatchesBinPairIndex);
+        for (PairwiseMatches::const_iterator match = matchBegin; match != matchEnd; ++match)
+        {
+            const MatchesPerDescType& matchesPerDesc = match->second;
+            index.push_back({std::uint32_t(match->first.first), std::uint32_t(match->first.second), std::uint32_t(matchesPerDesc.size()), offset});
+            for (const auto& m : matchesPerDesc)
+                offset += sizeof(std::uint8_t) + sizeof(std::uint32_t) + m.second.size() * 2 * sizeof(std::uint32_t);
+        }
+
+        // write temporary file
+        {
+            std::ofstream stream(tmpPath, std::ios::out | std::ios::binary);
+            stream.write(MATCHES_BIN_MAGIC, sizeof(MATCHES_BIN_MAGIC));
+            stream.write(reinterpret_cast<const char*>(&MATCHES_BIN_VERSION), sizeof(MATCHES_BIN_VERSION));
+            stream.write(reinterpret_cast<const char*>(&nbPairs), sizeof(nbPairs));
+            stream.write(reinterpret_cast<const char*>(index.data()), index.size() * sizeof(MatchesBinPairIndex));
+
+            std::vector<std::uint32_t> indexes;
+            for (PairwiseMatches::const_iterator match = matchBegin; match != matchEnd; ++match)
+            {
+                for (const auto& m : match->second)
+                {
+                    const std::uint8_t descType = std::uint8_t(m.first);
+                    const std::uint32_t nbMatches = m.second.size();
+                    stream.write(reinterpret_cast<const char*>(&descType), sizeof(descType));
+                    stream.write(reinterpret_cast<const char*>(&nbMatches), sizeof(nbMatches));
+
+                    indexes.clear();
+                    indexes.reserve(2 * std::size_t(nbMatches));
+                    for (const IndMatch& indMatch : m.second)
+                    {
+                        indexes.push_back(indMatch._i);
+                        indexes.push_back(indMatch._j);
+                    }
+                    stream.write(reinterpret_cast<const char*>(indexes.data()), indexes.size() * sizeof(std::uint32_t));
+                }
+            }
+            if (!stream)
+                throw std::runtime_error("Unable to write the matches file: " + filepath);
+        }
+
+        // rename temporary file
+        fs::rename(tmpPath, filepath);
+    }
+
   public:
     MatchExporter(const PairwiseMatches& matches, const std::string& folder, const std::string& filename)
       : m_matches(matches),
@@ -318,7 +465,9 @@ class MatchExporter
     {
         const std::string filepath = (fs::path(m_directory) / m_filename).string();
 
-        if (m_ext == ".txt")
+        if (m_ext == ".bin")
+            saveBin(filepath, m_matches.begin(), m_matches.end());
+        else if (m_ext == ".txt")
             saveTxt(filepath, m_matches.begin(), m_matches.end());
         else
             throw std::runtime_error(std::string("Unknown matching file format: ") + m_ext);
@@ -341,7 +490,9 @@ class MatchExporter
             const std::string filepath = (fs::path(m_directory) / (std::to_string(key) + "." + m_filename)).string();
             ALICEVISION_LOG_DEBUG("Export Matches in: " << filepath);
 
-            if (m_ext == ".txt")
+            if (m_ext == ".bin")
+                saveBin(filepath, matchBegin, match);
+            else if (m_ext == ".txt")
                 saveTxt(filepath, matchBegin, match);
             else
                 throw std::runtime_error(std::string("Unknown matching file format: ") + m_ext);
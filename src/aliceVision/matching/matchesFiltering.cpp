@@ -6,6 +6,8 @@
 
 #include "matchesFiltering.hpp"
 
+#include <cstdint>
+
 namespace aliceVision {
 namespace matching {
 
@@ -76,15 +78,15 @@ void matchesGridFiltering(const aliceVision::feature::Regions& lRegions,
     const size_t rightCellWidth = divideRoundUp(rImgSize.first, gridSize);
     const size_t rightCellHeight = divideRoundUp(rImgSize.second, gridSize);
 
-    std::vector<aliceVision::matching::IndMatches> completeGrid(gridSize * gridSize * 2);
-    // Reserve all cells
-    for (aliceVision::matching::IndMatches& cell : completeGrid)
-    {
-        cell.reserve(outMatches.size() / completeGrid.size());
-    }
-    // Split matches in grid cells
-    for (const auto& match : outMatches)
+    const std::size_t nbCells = gridSize * gridSize * 2;
+
+    // Split matches in grid cells in a single pass, only tracking per-cell counters:
+    // each match goes to the less filled of its left/right cell
+    std::vector<std::uint32_t> cellOfMatch(outMatches.size());
+    std::vector<std::uint32_t> cellCounts(nbCells, 0);
+    for (std::size_t i = 0; i < outMatches.size(); ++i)
     {
+        const aliceVision::matching::IndMatch& match = outMatches[i];
         const aliceVision::feature::PointFeature& leftPoint = lRegions.Features()[match._i];
         const aliceVision::feature::PointFeature& rightPoint = rRegions.Features()[match._j];
 
@@ -93,44 +95,49 @@ void matchesGridFiltering(const aliceVision::feature::Regions& lRegions,
           std::floor(rightPoint.x() / (float)rightCellWidth) + std::floor(rightPoint.y() / (float)rightCellHeight) * gridSize;
         // clamp the values if we have feature/marker centers outside the image size.
         const std::size_t leftGridIndex = clamp(leftGridIndex_f, 0.f, float(gridSize - 1));
-        const std::size_t rightGridIndex = clamp(rightGridIndex_f, 0.f, float(gridSize - 1));
+        const std::size_t rightGridIndex = clamp(rightGridIndex_f, 0.f, float(gridSize - 1)) + gridSize * gridSize;
 
-        aliceVision::matching::IndMatches& currentCaseL = completeGrid[leftGridIndex];
-        aliceVision::matching::IndMatches& currentCaseR = completeGrid[rightGridIndex + gridSize * gridSize];
-
-        if (currentCaseL.size() <= currentCaseR.size())
-        {
-            currentCaseL.push_back(match);
-        }
-        else
-        {
-            currentCaseR.push_back(match);
-        }
+        const std::uint32_t cell = (cellCounts[leftGridIndex] <= cellCounts[rightGridIndex]) ? leftGridIndex : rightGridIndex;
+        cellOfMatch[i] = cell;
+        ++cellCounts[cell];
     }
 
-    // max Size of the cells:
-    int maxSize = 0;
-    for (const auto& cell : completeGrid)
+    // bucket the match indices per cell with a counting sort,
+    // keeping the input (scale-sorted) order inside each cell
+    std::vector<std::uint32_t> cellStarts(nbCells + 1, 0);
+    for (std::size_t c = 0; c < nbCells; ++c)
+        cellStarts[c + 1] = cellStarts[c] + cellCounts[c];
+
+    std::vector<std::uint32_t> bucketedMatches(outMatches.size());
     {
-        if (cell.size() > maxSize)
-        {
-            maxSize = cell.size();
-        }
+        std::vector<std::uint32_t> cellFill(cellStarts.begin(), cellStarts.end() - 1);
+        for (std::size_t i = 0; i < outMatches.size(); ++i)
+            bucketedMatches[cellFill[cellOfMatch[i]]++] = i;
     }
 
     aliceVision::matching::IndMatches finalMatches;
     finalMatches.reserve(outMatches.size());
 
-    // Combine all cells into a global ordered vector
-    for (int cmpt = 0; cmpt < maxSize; ++cmpt)
+    // Combine all cells into a global ordered vector, one rank at a time: the k first
+    // output matches are always spread over the cells, so a later top-k cut keeps the
+    // spatial distribution. Exhausted cells are compacted out of the active list, which
+    // keeps the total interleaving work linear in the number of matches.
+    std::vector<std::uint32_t> activeCells;
+    activeCells.reserve(nbCells);
+    for (std::uint32_t c = 0; c < nbCells; ++c)
+        if (cellCounts[c] > 0)
+            activeCells.push_back(c);
+
+    for (std::uint32_t rank = 0; !activeCells.empty(); ++rank)
     {
-        for (const auto& cell : completeGrid)
+        std::size_t nbStillActive = 0;
+        for (const std::uint32_t c : activeCells)
         {
-            if (cmpt < cell.size())
-            {
-                finalMatches.push_back(cell[cmpt]);
-            }
+            finalMatches.push_back(outMatches[bucketedMatches[cellStarts[c] + rank]]);
+            if (rank + 1 < cellCounts[c])
+                activeCells[nbStillActive++] = c;
         }
+        activeCells.resize(nbStillActive);
     }
     outMatches.swap(finalMatches);
 }
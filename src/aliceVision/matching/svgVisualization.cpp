@@ -29,6 +29,10 @@ std::string describerTypeColor(feature::EImageDescriberType descType)
             return "yellow";
         case feature::EImageDescriberType::DSPSIFT:
             return "yellow";
+#if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_POPSIFT)
+        case feature::EImageDescriberType::SIFT_GPU:
+            return "yellow";
+#endif
 
         case feature::EImageDescriberType::AKAZE:
             return "purple";
@@ -14,6 +14,7 @@
 #include <aliceVision/matchingImageCollection/GeometricFilterMatrix.hpp>
 #include <aliceVision/system/ProgressDisplay.hpp>
 
+#include <algorithm>
 #include <map>
 #include <random>
 #include <vector>
@@ -51,11 +52,21 @@ void robustModelEstimation(PairwiseMatches& out_geometricMatches,
 
     auto progressDisplay = system::createConsoleProgressDisplay(putativeMatches.size(), std::cout, "Robust Model Estimation\n");
 
+    // Order the pairs by decreasing number of putative matches: estimation cost grows with
+    // the match count, and with a dynamic schedule the expensive pairs must start first so
+    // that one of them does not begin near the end and dominate the tail latency.
+    std::vector<PairwiseMatches::const_iterator> orderedPairs;
+    orderedPairs.reserve(putativeMatches.size());
+    for (auto iter = putativeMatches.begin(); iter != putativeMatches.end(); ++iter)
+        orderedPairs.push_back(iter);
+    std::sort(orderedPairs.begin(), orderedPairs.end(), [](const PairwiseMatches::const_iterator& a, const PairwiseMatches::const_iterator& b) {
+        return a->second.getNbAllMatches() > b->second.getNbAllMatches();
+    });
+
 #pragma omp parallel for schedule(dynamic)
-    for (int i = 0; i < (int)putativeMatches.size(); ++i)
+    for (int i = 0; i < (int)orderedPairs.size(); ++i)
     {
-        PairwiseMatches::const_iterator iter = putativeMatches.begin();
-        std::advance(iter, i);
+        PairwiseMatches::const_iterator iter = orderedPairs[i];
 
         const Pair currentPair = iter->first;
         const MatchesPerDescType& putativeMatchesPerType = iter->second;
@@ -9,9 +9,17 @@
 #include <aliceVision/matching/ArrayMatcher_cascadeHashing.hpp>
 #include <aliceVision/matching/IndMatchDecorator.hpp>
 #include <aliceVision/matching/filters.hpp>
+#include <aliceVision/system/Logger.hpp>
 #include <aliceVision/system/ProgressDisplay.hpp>
+#include <aliceVision/utils/filesIO.hpp>
 #include <aliceVision/config.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
 namespace aliceVision {
 namespace matchingImageCollection {
 
@@ -24,12 +32,113 @@ ImageCollectionMatcher_cascadeHashing ::ImageCollectionMatcher_cascadeHashing(fl
 {}
 
 namespace impl {
+
+// on-disk hashed descriptions cache entry identifier
+const char hashedDescriptionsCacheMagic[8] = {'A', 'V', 'H', 'D', 'E', 'S', 'C', '1'};
+
+/**
+ * @brief Try to load the hashed descriptions of a view from a cache entry.
+ * @return false if the entry is missing or does not match the expected layout
+ */
+bool loadHashedDescriptions(const std::string& entryPath, std::size_t expectedNbDescriptors, int nbBucketGroups, int nbBucketsPerGroup,
+                            HashedDescriptions& out_hashed)
+{
+    std::ifstream file(entryPath, std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    char magic[8];
+    std::uint64_t nbDescriptors = 0;
+    std::uint64_t nbBitsPerHashCode = 0;
+    std::uint64_t nbGroups = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&nbDescriptors), sizeof(nbDescriptors));
+    file.read(reinterpret_cast<char*>(&nbBitsPerHashCode), sizeof(nbBitsPerHashCode));
+    file.read(reinterpret_cast<char*>(&nbGroups), sizeof(nbGroups));
+
+    if (!file || !std::equal(magic, magic + sizeof(magic), hashedDescriptionsCacheMagic) || nbDescriptors != expectedNbDescriptors ||
+        nbBitsPerHashCode > 4096 || nbGroups != std::uint64_t(nbBucketGroups))
+        return false;
+
+    out_hashed.hashed_desc.resize(nbDescriptors);
+    for (HashedDescription& desc : out_hashed.hashed_desc)
+    {
+        desc.hash_code = stl::dynamic_bitset(nbBitsPerHashCode);
+        file.read(reinterpret_cast<char*>(desc.hash_code.data()), desc.hash_code.num_blocks() * sizeof(stl::dynamic_bitset::BlockType));
+        desc.bucket_ids.resize(nbBucketGroups);
+        file.read(reinterpret_cast<char*>(desc.bucket_ids.data()), nbBucketGroups * sizeof(uint16_t));
+    }
+    if (!file)
+        return false;
+
+    // the buckets are cheaper to rebuild from the bucket ids than to store
+    out_hashed.buckets.resize(nbBucketGroups);
+    for (int i = 0; i < nbBucketGroups; ++i)
+    {
+        out_hashed.buckets[i].resize(nbBucketsPerGroup);
+        for (std::size_t j = 0; j < out_hashed.hashed_desc.size(); ++j)
+        {
+            const uint16_t bucket_id = out_hashed.hashed_desc[j].bucket_ids[i];
+            out_hashed.buckets[i][bucket_id].push_back(j);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Publish the hashed descriptions of a view as a cache entry (atomic rename, failures are non-fatal).
+ */
+void writeHashedDescriptions(const std::string& entryPath, const HashedDescriptions& hashed)
+{
+    // write to a process-unique temporary file first and rename it afterwards,
+    // so a concurrent matching process can never read a partially written entry
+    const std::string tmpPath = entryPath + "." + utils::generateUniqueFilename() + ".tmp";
+
+    {
+        std::ofstream file(tmpPath, std::ios::binary);
+        if (!file.is_open())
+        {
+            ALICEVISION_LOG_WARNING("Cannot create hashed descriptions cache entry (path: " << entryPath << ").");
+            return;
+        }
+
+        const std::uint64_t nbDescriptors = hashed.hashed_desc.size();
+        const std::uint64_t nbBitsPerHashCode = nbDescriptors ? hashed.hashed_desc.front().hash_code.size() : 0;
+        const std::uint64_t nbGroups = hashed.buckets.size();
+        file.write(hashedDescriptionsCacheMagic, sizeof(hashedDescriptionsCacheMagic));
+        file.write(reinterpret_cast<const char*>(&nbDescriptors), sizeof(nbDescriptors));
+        file.write(reinterpret_cast<const char*>(&nbBitsPerHashCode), sizeof(nbBitsPerHashCode));
+        file.write(reinterpret_cast<const char*>(&nbGroups), sizeof(nbGroups));
+
+        for (const HashedDescription& desc : hashed.hashed_desc)
+        {
+            file.write(reinterpret_cast<const char*>(desc.hash_code.data()), desc.hash_code.num_blocks() * sizeof(stl::dynamic_bitset::BlockType));
+            file.write(reinterpret_cast<const char*>(desc.bucket_ids.data()), desc.bucket_ids.size() * sizeof(uint16_t));
+        }
+
+        if (!file)
+        {
+            ALICEVISION_LOG_WARNING("Cannot write hashed descriptions cache entry (path: " << entryPath << ").");
+            file.close();
+            std::error_code ec;
+            std::filesystem::remove(tmpPath, ec);
+            return;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, entryPath, ec);
+    if (ec)
+        std::filesystem::remove(tmpPath, ec);
+}
+
 template<typename ScalarT>
 void Match(std::mt19937& gen,
            const feature::RegionsPerView& regionsPerView,
            const PairSet& pairs,
            EImageDescriberType descType,
            float fDistRatio,
+           const std::string& cacheFolder,
            PairwiseMatches& map_PutativesMatches  // the pairwise photometric corresponding points
 )
 {
@@ -87,6 +196,29 @@ void Match(std::mt19937& gen,
         zero_mean_descriptor = CascadeHasher::GetZeroMeanDescriptor(matForZeroMean);
     }
 
+    // Cache entry key: the hashed descriptions only depend on the descriptors, the random
+    // projections and the zero mean descriptor, so the key identifies the last two and the
+    // view identifies the first. Entries from previous runs are reused only when they
+    // would hash to the very same result.
+    std::string cacheKeyHex;
+    if (!cacheFolder.empty())
+    {
+        std::size_t cacheKey = cascade_hasher.getProjectionsChecksum();
+        const unsigned char* zeroMeanBytes = reinterpret_cast<const unsigned char*>(zero_mean_descriptor.data());
+        for (std::size_t i = 0; i < zero_mean_descriptor.size() * sizeof(float); ++i)
+        {
+            cacheKey ^= zeroMeanBytes[i];
+            cacheKey *= 1099511628211ULL;
+        }
+        std::stringstream ss;
+        ss << std::hex << cacheKey;
+        cacheKeyHex = ss.str();
+    }
+
+    const auto getCacheEntryPath = [&](IndexT viewId) {
+        return cacheFolder + "/" + std::to_string(viewId) + "." + EImageDescriberType_enumToString(descType) + "." + cacheKeyHex + ".hashDesc";
+    };
+
 // Index the input regions
 #pragma omp parallel for schedule(dynamic)
     for (int i = 0; i < used_index.size(); ++i)
@@ -99,7 +231,18 @@ void Match(std::mt19937& gen,
         const size_t dimension = regionsI.DescriptorLength();
 
         Eigen::Map<BaseMat> mat_I((ScalarT*)tabI, regionsI.RegionCount(), dimension);
-        HashedDescriptions hashed_description = cascade_hasher.CreateHashedDescriptions(mat_I, zero_mean_descriptor);
+
+        HashedDescriptions hashed_description;
+        if (cacheFolder.empty() || !loadHashedDescriptions(getCacheEntryPath(I),
+                                                           regionsI.RegionCount(),
+                                                           cascade_hasher.getNbBucketGroups(),
+                                                           cascade_hasher.getNbBucketsPerGroup(),
+                                                           hashed_description))
+        {
+            hashed_description = cascade_hasher.CreateHashedDescriptions(mat_I, zero_mean_descriptor);
+            if (!cacheFolder.empty())
+                writeHashedDescriptions(getCacheEntryPath(I), hashed_description);
+        }
 #pragma omp critical
         {
             hashed_base_[I] = std::move(hashed_description);
@@ -211,11 +354,11 @@ void ImageCollectionMatcher_cascadeHashing::Match(std::mt19937& gen,
 
     if (regions.Type_id() == typeid(unsigned char).name())
     {
-        impl::Match<unsigned char>(gen, regionsPerView, pairs, descType, f_dist_ratio_, map_PutativesMatches);
+        impl::Match<unsigned char>(gen, regionsPerView, pairs, descType, f_dist_ratio_, _cacheFolder, map_PutativesMatches);
     }
     else if (regions.Type_id() == typeid(float).name())
     {
-        impl::Match<float>(gen, regionsPerView, pairs, descType, f_dist_ratio_, map_PutativesMatches);
+        impl::Match<float>(gen, regionsPerView, pairs, descType, f_dist_ratio_, _cacheFolder, map_PutativesMatches);
     }
     else
     {
@@ -26,6 +26,18 @@ class ImageCollectionMatcher_cascadeHashing : public IImageCollectionMatcher
   public:
     ImageCollectionMatcher_cascadeHashing(float dist_ratio);
 
+    /**
+     * @brief Cache the hashed descriptions as files in the given folder.
+     *
+     * Descriptors are immutable after the feature extraction, so their hashed descriptions
+     * are reusable across runs: entries are keyed by the hashing inputs (random projections
+     * and zero mean descriptor) and reloaded instead of recomputed when they match, which
+     * skips the hashing pass when re-running the matching with an other pair list.
+     *
+     * @param[in] folder the cache folder (typically a features folder, next to the .desc files)
+     */
+    void setCacheFolder(const std::string& folder) { _cacheFolder = folder; }
+
     /// Find corresponding points between some pair of view Ids
     void Match(std::mt19937& randomNumberGenerator,
                const feature::RegionsPerView& regionsPerView,
@@ -37,6 +49,8 @@ class ImageCollectionMatcher_cascadeHashing : public IImageCollectionMatcher
   private:
     // Distance ratio used to discard spurious correspondence
     float f_dist_ratio_;
+    // Folder caching the hashed descriptions on disk (empty: no cache)
+    std::string _cacheFolder;
 };
 
 }  // namespace matchingImageCollection
@@ -39,7 +39,7 @@ void ImageCollectionMatcher_generic::Match(std::mt19937& randomNumberGenerator,
     const bool b_multithreaded_pair_search = (_matcherType == CASCADE_HASHING_L2);
     // -> set to true for CASCADE_HASHING_L2, since OpenMP instructions are not used in this matcher
 
-    auto progressDisplay = system::createConsoleProgressDisplay(pairs.size(), std::cout);
+    auto progressDisplay = system::createRateProgressDisplay(pairs.size(), "Pairwise matching");
 
     // Sort pairs according the first index to minimize the MatcherT build operations
     typedef std::map<size_t, std::vector<size_t>> Map_vectorT;
@@ -78,38 +78,75 @@ void ImageCollectionMatcher_generic::Match(std::mt19937& randomNumberGenerator,
             }
 
             IndMatches vec_putatives_matches;
-            matcher.Match(_f_dist_ratio, regionsJ, vec_putatives_matches);
+            matchPair(randomNumberGenerator, matcher, regionsI, regionsJ, vec_putatives_matches);
 
-            if (_useCrossMatching)
+#pragma omp critical
             {
-                // Initialize the matching interface
-                matching::RegionsDatabaseMatcher matcherCross(randomNumberGenerator, _matcherType, regionsJ);
-
-                IndMatches vec_putatives_matches_cross;
-                matcherCross.Match(_f_dist_ratio, regionsI, vec_putatives_matches_cross);
-
-                // Create a dictionnary of matches indexed by their pair of indexes
-                std::map<std::pair<int, int>, IndMatch> check_matches;
-                for (IndMatch& m : vec_putatives_matches_cross)
+                ++progressDisplay;
+                if (!vec_putatives_matches.empty())
                 {
-                    std::pair<int, int> key = std::make_pair(m._i, m._j);
-                    check_matches[key] = m;
+                    map_PutativesMatches[std::make_pair(I, J)].emplace(descType, std::move(vec_putatives_matches));
                 }
+            }
+        }
+    }
+}
 
-                IndMatches vec_putatives_matches_checked;
-                for (IndMatch& m : vec_putatives_matches)
-                {
-                    // Check with reversed key (images are swapped)
-                    std::pair<int, int> key = std::make_pair(m._j, m._i);
-                    if (check_matches.find(key) != check_matches.end())
-                    {
-                        vec_putatives_matches_checked.push_back(m);
-                    }
-                }
+void ImageCollectionMatcher_generic::Match(std::mt19937& randomNumberGenerator,
+                                           feature::RegionsPerViewCache& regionsCache,
+                                           const PairSet& pairs,
+                                           feature::EImageDescriberType descType,
+                                           matching::PairwiseMatches& map_PutativesMatches) const  // the pairwise photometric corresponding points
+{
+#if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_OPENMP)
+    ALICEVISION_LOG_DEBUG("Using the OPENMP thread interface");
+#endif
+    const bool b_multithreaded_pair_search = (_matcherType == CASCADE_HASHING_L2);
+    // -> set to true for CASCADE_HASHING_L2, since OpenMP instructions are not used in this matcher
+
+    auto progressDisplay = system::createRateProgressDisplay(pairs.size(), "Pairwise matching");
+
+    // Sort pairs according the first index to minimize the MatcherT build operations
+    typedef std::map<size_t, std::vector<size_t>> Map_vectorT;
+    Map_vectorT map_Pairs;
+    for (PairSet::const_iterator iter = pairs.begin(); iter != pairs.end(); ++iter)
+    {
+        map_Pairs[iter->first].push_back(iter->second);
+    }
 
-                std::swap(vec_putatives_matches, vec_putatives_matches_checked);
+    // Perform matching between all the pairs
+    for (Map_vectorT::const_iterator iter = map_Pairs.begin(); iter != map_Pairs.end(); ++iter)
+    {
+        const size_t I = iter->first;
+        const std::vector<size_t>& indexToCompare = iter->second;
+
+        // Hold the pointer for the whole group, so that the regions indexed by the matcher
+        // cannot be evicted while the group is being matched.
+        const std::shared_ptr<const feature::Regions> regionsI = regionsCache.getRegions(I, descType);
+        if (regionsI->RegionCount() == 0)
+        {
+            progressDisplay += indexToCompare.size();
+            continue;
+        }
+
+        // Initialize the matching interface
+        matching::RegionsDatabaseMatcher matcher(randomNumberGenerator, _matcherType, *regionsI);
+
+#pragma omp parallel for schedule(dynamic) if (b_multithreaded_pair_search)
+        for (int j = 0; j < (int)indexToCompare.size(); ++j)
+        {
+            const size_t J = indexToCompare[j];
+
+            const std::shared_ptr<const feature::Regions> regionsJ = regionsCache.getRegions(J, descType);
+            if (regionsJ->RegionCount() == 0 || regionsI->Type_id() != regionsJ->Type_id())
+            {
+                ++progressDisplay;
+                continue;
             }
 
+            IndMatches vec_putatives_matches;
+            matchPair(randomNumberGenerator, matcher, *regionsI, *regionsJ, vec_putatives_matches);
+
 #pragma omp critical
             {
                 ++progressDisplay;
@@ -122,5 +159,44 @@ void ImageCollectionMatcher_generic::Match(std::mt19937& randomNumberGenerator,
     }
 }
 
+void ImageCollectionMatcher_generic::matchPair(std::mt19937& randomNumberGenerator,
+                                               matching::RegionsDatabaseMatcher& matcher,
+                                               const feature::Regions& regionsI,
+                                               const feature::Regions& regionsJ,
+                                               matching::IndMatches& out_putativeMatches) const
+{
+    matcher.Match(_f_dist_ratio, regionsJ, out_putativeMatches);
+
+    if (_useCrossMatching)
+    {
+        // Initialize the matching interface
+        matching::RegionsDatabaseMatcher matcherCross(randomNumberGenerator, _matcherType, regionsJ);
+
+        IndMatches vec_putatives_matches_cross;
+        matcherCross.Match(_f_dist_ratio, regionsI, vec_putatives_matches_cross);
+
+        // Create a dictionnary of matches indexed by their pair of indexes
+        std::map<std::pair<int, int>, IndMatch> check_matches;
+        for (IndMatch& m : vec_putatives_matches_cross)
+        {
+            std::pair<int, int> key = std::make_pair(m._i, m._j);
+            check_matches[key] = m;
+        }
+
+        IndMatches vec_putatives_matches_checked;
+        for (IndMatch& m : out_putativeMatches)
+        {
+            // Check with reversed key (images are swapped)
+            std::pair<int, int> key = std::make_pair(m._j, m._i);
+            if (check_matches.find(key) != check_matches.end())
+            {
+                vec_putatives_matches_checked.push_back(m);
+            }
+        }
+
+        std::swap(out_putativeMatches, vec_putatives_matches_checked);
+    }
+}
+
 }  // namespace matchingImageCollection
 }  // namespace aliceVision
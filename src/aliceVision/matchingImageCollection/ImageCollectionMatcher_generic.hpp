@@ -8,8 +8,14 @@
 #pragma once
 
 #include "aliceVision/matchingImageCollection/IImageCollectionMatcher.hpp"
+#include "aliceVision/feature/RegionsPerViewCache.hpp"
 
 namespace aliceVision {
+
+namespace matching {
+class RegionsDatabaseMatcher;
+}
+
 namespace matchingImageCollection {
 
 /**
@@ -33,7 +39,26 @@ class ImageCollectionMatcher_generic : public IImageCollectionMatcher
                matching::PairwiseMatches& map_PutativesMatches  // the pairwise photometric corresponding points
     ) const;
 
+    /**
+     * @brief Find corresponding points between some pair of view Ids, pulling the regions
+     *        lazily from a RegionsPerViewCache instead of a fully resident RegionsPerView,
+     *        so matching can run within a fixed memory budget.
+     */
+    void Match(std::mt19937& randomNumberGenerator,
+               feature::RegionsPerViewCache& regionsCache,
+               const PairSet& pairs,
+               feature::EImageDescriberType descType,
+               matching::PairwiseMatches& map_PutativesMatches  // the pairwise photometric corresponding points
+    ) const;
+
   private:
+    /// Match one pair of regions, with the optional cross matching check
+    void matchPair(std::mt19937& randomNumberGenerator,
+                   matching::RegionsDatabaseMatcher& matcher,
+                   const feature::Regions& regionsI,
+                   const feature::Regions& regionsJ,
+                   matching::IndMatches& out_putativeMatches) const;
+
     // Distance ratio used to discard spurious correspondence
     float _f_dist_ratio;
     // Do we use cross matching (Symmetric matching test) ?
@@ -13,6 +13,10 @@
 #include <aliceVision/sfmData/SfMData.hpp>
 #include <aliceVision/feature/RegionsPerView.hpp>
 
+#include <map>
+#include <mutex>
+#include <utility>
+
 namespace aliceVision {
 namespace matchingImageCollection {
 
@@ -21,6 +25,74 @@ inline Vec2 getFeaturePosition(const std::unique_ptr<feature::Regions>& regions,
 
 inline Vec2 getFeaturePosition(const feature::PointFeatures& features, std::size_t i) { return features[i].coords().cast<double>(); }
 
+inline std::size_t getNbFeaturePositions(const std::unique_ptr<feature::Regions>& regions) { return regions->RegionCount(); }
+
+inline std::size_t getNbFeaturePositions(const feature::PointFeatures& features) { return features.size(); }
+
+/**
+ * @brief Cache of undistorted feature positions, shared by all the image pairs touching a view
+ * during geometric filtering: with N neighbours per view, the undistortion of a view's features
+ * would otherwise be recomputed N times.
+ *
+ * Entries are keyed by the feature container and the intrinsic applied to it, so using an
+ * updated intrinsic naturally leaves the stale positions behind.
+ */
+class UndistortedFeaturesCache
+{
+  public:
+    static UndistortedFeaturesCache& getInstance()
+    {
+        static UndistortedFeaturesCache instance;
+        return instance;
+    }
+
+    /**
+     * @brief Get the undistorted positions of all the features of a view for one describer type,
+     * computing and caching them on first access.
+     * @note This method is thread-safe.
+     * @param[in] cam the intrinsic of the view
+     * @param[in] features the view's feature container for one describer type
+     * @return a 2xN matrix with the undistorted position of each feature
+     */
+    template<class FeatOrRegions>
+    const Mat2X& getUndistortedPositions(const camera::IntrinsicBase* cam, const FeatOrRegions& features)
+    {
+        const auto key = std::make_pair(static_cast<const void*>(&features), static_cast<const void*>(cam));
+
+        {
+            const std::lock_guard<std::mutex> lock(_mutex);
+            const auto it = _entries.find(key);
+            if (it != _entries.end())
+                return it->second;
+        }
+
+        // computed outside the lock, concurrent first accesses may compute it twice
+        // but only one result is kept
+        const std::size_t count = getNbFeaturePositions(features);
+        Mat2X positions(2, count);
+        for (std::size_t i = 0; i < count; ++i)
+            positions.col(i) = cam->get_ud_pixel(getFeaturePosition(features, i));
+
+        const std::lock_guard<std::mutex> lock(_mutex);
+        return _entries.emplace(key, std::move(positions)).first->second;
+    }
+
+    /**
+     * @brief Remove all the cached positions.
+     */
+    void clear()
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        _entries.clear();
+    }
+
+  private:
+    UndistortedFeaturesCache() = default;
+
+    std::map<std::pair<const void*, const void*>, Mat2X> _entries;
+    std::mutex _mutex;
+};
+
 /**
  * @brief Fill matrices with un-distorted feature positions
  *
@@ -46,22 +118,29 @@ void fillMatricesWithUndistortFeaturesMatches(const matching::IndMatches& putati
     const bool I_hasValidIntrinsics = cam_I && cam_I->isValid() && cam_I->hasDistortion();
     const bool J_hasValidIntrinsics = cam_J && cam_J->isValid() && cam_J->hasDistortion();
 
-    for (size_t i = 0; i < putativeMatches.size(); ++i)
+    if (I_hasValidIntrinsics)
+    {
+        // the undistorted positions of the view's features are computed once and shared across pairs
+        const Mat2X& undistorted_I = UndistortedFeaturesCache::getInstance().getUndistortedPositions(cam_I, feature_I);
+        for (size_t i = 0; i < putativeMatches.size(); ++i)
+            x_I.col(i) = undistorted_I.col(putativeMatches[i]._i);
+    }
+    else
     {
-        const Vec2 pt_I = getFeaturePosition(feature_I, putativeMatches[i]._i);
-        if (I_hasValidIntrinsics)
-            x_I.col(i) = cam_I->get_ud_pixel(pt_I);
-        else
-            x_I.col(i) = pt_I;
+        for (size_t i = 0; i < putativeMatches.size(); ++i)
+            x_I.col(i) = getFeaturePosition(feature_I, putativeMatches[i]._i);
     }
 
-    for (size_t i = 0; i < putativeMatches.size(); ++i)
+    if (J_hasValidIntrinsics)
+    {
+        const Mat2X& undistorted_J = UndistortedFeaturesCache::getInstance().getUndistortedPositions(cam_J, feature_J);
+        for (size_t i = 0; i < putativeMatches.size(); ++i)
+            x_J.col(i) = undistorted_J.col(putativeMatches[i]._j);
+    }
+    else
     {
-        const Vec2 pt_J = getFeaturePosition(feature_J, putativeMatches[i]._j);
-        if (J_hasValidIntrinsics)
-            x_J.col(i) = cam_J->get_ud_pixel(pt_J);
-        else
-            x_J.col(i) = pt_J;
+        for (size_t i = 0; i < putativeMatches.size(); ++i)
+            x_J.col(i) = getFeaturePosition(feature_J, putativeMatches[i]._j);
     }
 }
 
@@ -22,6 +22,9 @@
 #include <assimp/scene.h>
 #include <Eigen/Dense>
 
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <list>
@@ -47,6 +50,8 @@ std::string EFileType_enumToString(const EFileType meshFileType)
             return "stl";
         case EFileType::GLTF:
             return "gltf";
+        case EFileType::AVMESH:
+            return "avmesh";
     }
     throw std::out_of_range("Unrecognized EMeshFileType");
 }
@@ -64,6 +69,8 @@ EFileType EFileType_stringToEnum(const std::string& meshFileType)
         return EFileType::STL;
     if (m == "gltf")
         return EFileType::GLTF;
+    if (m == "avmesh")
+        return EFileType::AVMESH;
     throw std::out_of_range("Invalid mesh file type " + meshFileType);
 }
 
@@ -80,6 +87,18 @@ void Mesh::save(const std::string& filepath)
     const std::string fileTypeStr = std::filesystem::path(filepath).extension().string().substr(1);
     const EFileType fileType = mesh::EFileType_stringToEnum(fileTypeStr);
 
+    // dedicated fast paths, not going through assimp
+    if (fileType == EFileType::OBJ)
+    {
+        saveToObj(filepath);
+        return;
+    }
+    if (fileType == EFileType::AVMESH)
+    {
+        saveToAvmesh(filepath);
+        return;
+    }
+
     ALICEVISION_LOG_INFO("Save " << fileTypeStr << " mesh file");
 
     aiScene scene;
@@ -154,6 +173,193 @@ void Mesh::save(const std::string& filepath)
     ALICEVISION_LOG_DEBUG("Normals: " << normals.size());
 }
 
+void Mesh::saveToObj(const std::string& objFilepath) const
+{
+    long t = std::clock();
+    ALICEVISION_LOG_INFO("Save obj mesh file: " << objFilepath);
+
+    FILE* f = fopen(objFilepath.c_str(), "wb");
+    if (f == nullptr)
+        ALICEVISION_THROW_ERROR("Mesh::saveToObj: cannot open file for writing: " << objFilepath);
+
+    fprintf(f, "# %i vertices, %i faces\n", pts.size(), tris.size());
+
+    // format blocks of lines in parallel, then write them out in order
+    const int linesPerBlock = 1 << 18;
+    {
+        const int nbBlocks = (pts.size() + linesPerBlock - 1) / linesPerBlock;
+        std::vector<std::string> blocks(nbBlocks);
+#pragma omp parallel for
+        for (int b = 0; b < nbBlocks; ++b)
+        {
+            const int begin = b * linesPerBlock;
+            const int end = std::min(pts.size(), begin + linesPerBlock);
+            std::string& block = blocks[b];
+            block.reserve(std::size_t(end - begin) * 48);
+            char line[128];
+            for (int i = begin; i < end; ++i)
+            {
+                const Point3d& p = pts[i];
+                const int len = snprintf(line, sizeof(line), "v %.9g %.9g %.9g\n", p.x, -p.y, -p.z);
+                block.append(line, len);
+            }
+        }
+        for (const std::string& block : blocks)
+            fwrite(block.data(), 1, block.size(), f);
+    }
+    {
+        const int nbBlocks = (tris.size() + linesPerBlock - 1) / linesPerBlock;
+        std::vector<std::string> blocks(nbBlocks);
+#pragma omp parallel for
+        for (int b = 0; b < nbBlocks; ++b)
+        {
+            const int begin = b * linesPerBlock;
+            const int end = std::min(tris.size(), begin + linesPerBlock);
+            std::string& block = blocks[b];
+            block.reserve(std::size_t(end - begin) * 24);
+            char line[128];
+            for (int i = begin; i < end; ++i)
+            {
+                // obj indices are 1-based
+                const Mesh::triangle& tri = tris[i];
+                const int len = snprintf(line, sizeof(line), "f %i %i %i\n", tri.v[0] + 1, tri.v[1] + 1, tri.v[2] + 1);
+                block.append(line, len);
+            }
+        }
+        for (const std::string& block : blocks)
+            fwrite(block.data(), 1, block.size(), f);
+    }
+    fclose(f);
+
+    ALICEVISION_LOG_DEBUG("Vertices: " << pts.size());
+    ALICEVISION_LOG_DEBUG("Triangles: " << tris.size());
+    mvsUtils::printfElapsedTime(t, "Save mesh to obj ");
+}
+
+namespace {
+
+/// .avmesh layout: fixed header followed by the raw mesh arrays, written back-to-back.
+/// The arrays holding doubles come first so that each of them stays 8-byte aligned,
+/// allowing a reader to memory-map the file and use the arrays in place.
+struct AvmeshHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t nmtls;
+    uint64_t nbPts;
+    uint64_t nbNormals;
+    uint64_t nbUvCoords;
+    uint64_t nbTris;
+    uint64_t nbTrisUvIds;
+    uint64_t nbTrisNormalsIds;
+    uint64_t nbTrisMtlIds;
+    uint64_t nbColors;
+};
+
+constexpr char AVMESH_MAGIC[8] = {'A', 'V', 'M', 'E', 'S', 'H', '\0', '\0'};
+constexpr uint32_t AVMESH_VERSION = 1;
+
+}  // namespace
+
+void Mesh::saveToAvmesh(const std::string& avmeshFilepath) const
+{
+    long t = std::clock();
+    ALICEVISION_LOG_INFO("Save avmesh mesh file: " << avmeshFilepath);
+
+    FILE* f = fopen(avmeshFilepath.c_str(), "wb");
+    if (f == nullptr)
+        ALICEVISION_THROW_ERROR("Mesh::saveToAvmesh: cannot open file for writing: " << avmeshFilepath);
+
+    AvmeshHeader header;
+    std::memcpy(header.magic, AVMESH_MAGIC, sizeof(header.magic));
+    header.version = AVMESH_VERSION;
+    header.nmtls = nmtls;
+    header.nbPts = pts.size();
+    header.nbNormals = normals.size();
+    header.nbUvCoords = uvCoords.size();
+    header.nbTris = tris.size();
+    header.nbTrisUvIds = trisUvIds.size();
+    header.nbTrisNormalsIds = trisNormalsIds.size();
+    header.nbTrisMtlIds = _trisMtlIds.size();
+    header.nbColors = _colors.size();
+    fwrite(&header, sizeof(AvmeshHeader), 1, f);
+
+    if (!pts.empty())
+        fwrite(&pts[0], sizeof(Point3d), pts.size(), f);
+    if (!normals.empty())
+        fwrite(&normals[0], sizeof(Point3d), normals.size(), f);
+    if (!uvCoords.empty())
+        fwrite(&uvCoords[0], sizeof(Point2d), uvCoords.size(), f);
+    if (!tris.empty())
+        fwrite(&tris[0], sizeof(Mesh::triangle), tris.size(), f);
+    if (!trisUvIds.empty())
+        fwrite(&trisUvIds[0], sizeof(Voxel), trisUvIds.size(), f);
+    if (!trisNormalsIds.empty())
+        fwrite(&trisNormalsIds[0], sizeof(Voxel), trisNormalsIds.size(), f);
+    if (!_trisMtlIds.empty())
+        fwrite(_trisMtlIds.data(), sizeof(int), _trisMtlIds.size(), f);
+    if (!_colors.empty())
+        fwrite(_colors.data(), sizeof(rgb), _colors.size(), f);
+
+    fclose(f);
+    mvsUtils::printfElapsedTime(t, "Save mesh to avmesh ");
+}
+
+void Mesh::loadFromAvmesh(const std::string& avmeshFilepath)
+{
+    long t = std::clock();
+    ALICEVISION_LOG_INFO("Load avmesh mesh file: " << avmeshFilepath);
+
+    FILE* f = fopen(avmeshFilepath.c_str(), "rb");
+    if (f == nullptr)
+        ALICEVISION_THROW_ERROR("Mesh::loadFromAvmesh: no such file: " << avmeshFilepath);
+
+    AvmeshHeader header;
+    if (fread(&header, sizeof(AvmeshHeader), 1, f) != 1 || std::memcmp(header.magic, AVMESH_MAGIC, sizeof(header.magic)) != 0)
+    {
+        fclose(f);
+        ALICEVISION_THROW_ERROR("Mesh::loadFromAvmesh: invalid avmesh file: " << avmeshFilepath);
+    }
+    if (header.version != AVMESH_VERSION)
+    {
+        fclose(f);
+        ALICEVISION_THROW_ERROR("Mesh::loadFromAvmesh: unsupported avmesh version " << header.version << ": " << avmeshFilepath);
+    }
+
+    nmtls = header.nmtls;
+    pts.resize(header.nbPts);
+    if (!pts.empty())
+        fread(&pts[0], sizeof(Point3d), pts.size(), f);
+    normals.resize(header.nbNormals);
+    if (!normals.empty())
+        fread(&normals[0], sizeof(Point3d), normals.size(), f);
+    uvCoords.resize(header.nbUvCoords);
+    if (!uvCoords.empty())
+        fread(&uvCoords[0], sizeof(Point2d), uvCoords.size(), f);
+    tris.resize(header.nbTris);
+    if (!tris.empty())
+        fread(&tris[0], sizeof(Mesh::triangle), tris.size(), f);
+    trisUvIds.resize(header.nbTrisUvIds);
+    if (!trisUvIds.empty())
+        fread(&trisUvIds[0], sizeof(Voxel), trisUvIds.size(), f);
+    trisNormalsIds.resize(header.nbTrisNormalsIds);
+    if (!trisNormalsIds.empty())
+        fread(&trisNormalsIds[0], sizeof(Voxel), trisNormalsIds.size(), f);
+    _trisMtlIds.resize(header.nbTrisMtlIds);
+    if (!_trisMtlIds.empty())
+        fread(_trisMtlIds.data(), sizeof(int), _trisMtlIds.size(), f);
+    _colors.resize(header.nbColors);
+    if (!_colors.empty())
+        fread(_colors.data(), sizeof(rgb), _colors.size(), f);
+
+    fclose(f);
+    invalidateAdjacencyCache();
+
+    ALICEVISION_LOG_DEBUG("Vertices: " << pts.size());
+    ALICEVISION_LOG_DEBUG("Triangles: " << tris.size());
+    mvsUtils::printfElapsedTime(t, "Load mesh from avmesh ");
+}
+
 bool Mesh::loadFromBin(const std::string& binFilepath)
 {
     FILE* f = fopen(binFilepath.c_str(), "rb");
@@ -174,6 +380,7 @@ bool Mesh::loadFromBin(const std::string& binFilepath)
     fread(&tris[0], sizeof(Mesh::triangle), ntris, f);
 
     fclose(f);
+    invalidateAdjacencyCache();
     return true;
 }
 
@@ -240,6 +447,8 @@ void Mesh::addMesh(const Mesh& mesh)
         trisUvIds.reserve(mesh.trisUvIds.size());
         std::copy(mesh.trisUvIds.begin(), mesh.trisUvIds.end(), std::back_inserter(trisUvIds.getDataWritable()));
     }
+
+    invalidateAdjacencyCache();
 }
 
 Mesh::triangle_proj Mesh::getTriangleProjection(int triid, const mvsUtils::MultiViewParams& mp, int rc, int w, int h) const
@@ -589,6 +798,87 @@ void Mesh::getPtsNeighborTriangles(StaticVector<StaticVector<int>>& out_ptsNeigh
     }
 }
 
+void Mesh::getPtsNeighborTriangles(ArrayOfArrays<int>& out_ptsNeighTris) const
+{
+    // array of tuples <x: vertexIndex, y: triangleIndex, z: numberOfNeighbors>
+    StaticVector<Voxel> vertexNeighborhoodPairs;
+    vertexNeighborhoodPairs.reserve(tris.size() * 3);
+    for (int i = 0; i < tris.size(); ++i)
+    {
+        vertexNeighborhoodPairs.push_back(Voxel(tris[i].v[0], i, 0));
+        vertexNeighborhoodPairs.push_back(Voxel(tris[i].v[1], i, 0));
+        vertexNeighborhoodPairs.push_back(Voxel(tris[i].v[2], i, 0));
+    }
+    qsort(&vertexNeighborhoodPairs[0], vertexNeighborhoodPairs.size(), sizeof(Voxel), qSortCompareVoxelByXAsc);
+
+    int i = 0;  // index of the unique pair of <vertex, neighborhood>
+    int j = 0;  // index of the vertex
+    int k = 0;  // number of neighbors
+    int firstid = 0;
+    while (i < vertexNeighborhoodPairs.size())
+    {
+        ++k;
+        if ((i == vertexNeighborhoodPairs.size() - 1) || (vertexNeighborhoodPairs[i].x != vertexNeighborhoodPairs[i + 1].x))
+        {
+            vertexNeighborhoodPairs[firstid].z = k;  // store the number of neighbors
+            ++j;
+            firstid = i + 1;
+            k = 0;
+        }
+        ++i;
+    }
+    int npts = j;
+
+    // the pairs are sorted by vertex index, so the per-vertex lists can be appended
+    // in ascending order into the shared slab (with empty lists for the vertices
+    // that do not belong to any triangle)
+    out_ptsNeighTris.clear();
+    out_ptsNeighTris.reserve(pts.size(), vertexNeighborhoodPairs.size());
+
+    std::vector<int> triIds;  // reused, the retained capacity amortizes allocations
+
+    int nextPtId = 0;
+    i = 0;
+    for (j = 0; j < npts; ++j)
+    {
+        int middlePtId = vertexNeighborhoodPairs[i].x;
+        int nbNeighbors = vertexNeighborhoodPairs[i].z;
+        int i0 = i;
+        int i1 = i + nbNeighbors;
+        i = i1;
+
+        for (; nextPtId < middlePtId; ++nextPtId)
+            out_ptsNeighTris.addEmptyArray();
+
+        triIds.clear();
+        for (int l = i0; l < i1; ++l)
+        {
+            triIds.push_back(vertexNeighborhoodPairs[l].y);  // index of triangle
+        }
+        out_ptsNeighTris.addArray(triIds.begin(), triIds.end());
+        ++nextPtId;
+    }
+
+    for (; nextPtId < pts.size(); ++nextPtId)
+        out_ptsNeighTris.addEmptyArray();
+}
+
+const ArrayOfArrays<int>& Mesh::getPtsNeighborTrianglesCached() const
+{
+    if (_ptsNeighTrisCachedDirty)
+    {
+        getPtsNeighborTriangles(_ptsNeighTrisCached);
+        _ptsNeighTrisCachedDirty = false;
+    }
+    return _ptsNeighTrisCached;
+}
+
+void Mesh::invalidateAdjacencyCache()
+{
+    _ptsNeighTrisCached.clear();
+    _ptsNeighTrisCachedDirty = true;
+}
+
 void Mesh::getPtsNeighbors(std::vector<std::vector<int>>& out_ptsNeigh) const
 {
     out_ptsNeigh.resize(pts.size());
@@ -609,18 +899,23 @@ void Mesh::getPtsNeighbors(std::vector<std::vector<int>>& out_ptsNeigh) const
 
 void Mesh::getPtsNeighPtsOrdered(StaticVector<StaticVector<int>>& out_ptsNeighPts) const
 {
-    StaticVector<StaticVector<int>> ptsNeighborTriangles;
-    getPtsNeighborTriangles(ptsNeighborTriangles);
+    const ArrayOfArrays<int>& ptsNeighborTriangles = getPtsNeighborTrianglesCached();
 
     out_ptsNeighPts.resize(pts.size());
 
+    // reused across points, the retained capacity amortizes allocations
+    StaticVector<int> neighborTriangles;
+    StaticVector<int> vhid;
+
     for (int middlePtId = 0; middlePtId < pts.size(); ++middlePtId)
     {
-        StaticVector<int>& neighborTriangles = ptsNeighborTriangles[middlePtId];
-        if (neighborTriangles.empty())
+        if (ptsNeighborTriangles.sizeAt(middlePtId) == 0)
             continue;
 
-        StaticVector<int> vhid;
+        // local copy, the fan walk below removes the visited triangles
+        neighborTriangles.getDataWritable().assign(ptsNeighborTriangles.begin(middlePtId), ptsNeighborTriangles.end(middlePtId));
+
+        vhid.clear();
         vhid.reserve(neighborTriangles.size() * 2);
         int currentTriPtId = tris[neighborTriangles[0]].v[0];
         int firstTriPtId = currentTriPtId;
@@ -1209,8 +1504,10 @@ void Mesh::getNotOrientedEdges(StaticVector<StaticVector<int>>& edgesNeighTris,
 
 void Mesh::getLaplacianSmoothingVectors(StaticVector<StaticVector<int>>& ptsNeighPts, StaticVector<Point3d>& out_nms, double maximalNeighDist)
 {
-    out_nms.reserve(pts.size());
+    out_nms.resize_with(pts.size(), Point3d(0.0, 0.0, 0.0));
 
+// each vertex only reads the positions of its neighbors
+#pragma omp parallel for
     for (int i = 0; i < pts.size(); ++i)
     {
         Point3d& p = pts[i];
@@ -1221,11 +1518,7 @@ void Mesh::getLaplacianSmoothingVectors(StaticVector<StaticVector<int>>& ptsNeig
             nneighs = nei.size();
         }
 
-        if (nneighs == 0)
-        {
-            out_nms.push_back(Point3d(0.0, 0.0, 0.0));
-        }
-        else
+        if (nneighs > 0)
         {
             double maxNeighDist = 0.0f;
             // laplacian smoothing vector
@@ -1259,7 +1552,7 @@ void Mesh::getLaplacianSmoothingVectors(StaticVector<StaticVector<int>>& ptsNeig
                 n = Point3d(0.0, 0.0, 0.0);
             }
 
-            out_nms.push_back(n);
+            out_nms[i] = n;
         }
     }
 }
@@ -1307,56 +1600,86 @@ double Mesh::computeTriangleMinEdgeLength(int idTri) const
     return std::min({(pts[t.v[0]] - pts[t.v[1]]).size(), (pts[t.v[1]] - pts[t.v[2]]).size(), (pts[t.v[2]] - pts[t.v[0]]).size()});
 }
 
-void Mesh::computeNormalsForPts(StaticVector<Point3d>& out_nms) const
+void Mesh::computeNormalsForPts(StaticVector<Point3d>& out_nms) const { computeNormalsForPts(getPtsNeighborTrianglesCached(), out_nms); }
+
+namespace {
+
+/**
+ * @brief Average the (valid) normals of the given triangles.
+ */
+template<class Iterator>
+Point3d averageTrianglesNormal(const Mesh& mesh, Iterator first, Iterator last)
 {
-    StaticVector<StaticVector<int>> ptsNeighTris;
-    getPtsNeighborTriangles(ptsNeighTris);
-    computeNormalsForPts(ptsNeighTris, out_nms);
+    Point3d n = Point3d(0.0f, 0.0f, 0.0f);
+    float nn = 0.0f;
+    for (Iterator it = first; it != last; ++it)
+    {
+        Point3d n1 = mesh.computeTriangleNormal(*it);
+        n1 = n1.normalize();
+        if (!std::isnan(n1.x) && !std::isnan(n1.y) && !std::isnan(n1.z))  // check if is not NaN
+        {
+            n = n + n1;
+            nn += 1.0f;
+        }
+    }
+    n = n / nn;
+
+    n = n.normalize();
+    if (std::isnan(n.x) || std::isnan(n.y) || std::isnan(n.z))  // check if is not NaN
+    {
+        n = Point3d(0.0f, 0.0f, 0.0f);
+    }
+    return n;
 }
 
+}  // namespace
+
 void Mesh::computeNormalsForPts(StaticVector<StaticVector<int>>& ptsNeighTris, StaticVector<Point3d>& out_nms) const
 {
-    out_nms.reserve(pts.size());
     out_nms.resize_with(pts.size(), Point3d(0.0f, 0.0f, 0.0f));
 
+// each vertex only reads its own neighborhood
+#pragma omp parallel for
     for (int i = 0; i < pts.size(); ++i)
     {
-        StaticVector<int>& triTmp = ptsNeighTris[i];
+        const StaticVector<int>& triTmp = ptsNeighTris[i];
         if (!triTmp.empty())
         {
-            Point3d n = Point3d(0.0f, 0.0f, 0.0f);
-            float nn = 0.0f;
-            for (int j = 0; j < triTmp.size(); ++j)
-            {
-                Point3d n1 = computeTriangleNormal(triTmp[j]);
-                n1 = n1.normalize();
-                if (!std::isnan(n1.x) && !std::isnan(n1.y) && !std::isnan(n1.z))  // check if is not NaN
-                {
-                    n = n + computeTriangleNormal(triTmp[j]);
-                    nn += 1.0f;
-                }
-            }
-            n = n / nn;
+            out_nms[i] = averageTrianglesNormal(*this, triTmp.begin(), triTmp.end());
+        }
+    }
+}
 
-            n = n.normalize();
-            if (std::isnan(n.x) || std::isnan(n.y) || std::isnan(n.z))  // check if is not NaN
-            {
-                n = Point3d(0.0f, 0.0f, 0.0f);
-            }
+void Mesh::computeNormalsForPts(const ArrayOfArrays<int>& ptsNeighTris, StaticVector<Point3d>& out_nms) const
+{
+    out_nms.resize_with(pts.size(), Point3d(0.0f, 0.0f, 0.0f));
 
-            out_nms[i] = n;
+#pragma omp parallel for
+    for (int i = 0; i < pts.size(); ++i)
+    {
+        if (ptsNeighTris.sizeAt(i) > 0)
+        {
+            out_nms[i] = averageTrianglesNormal(*this, ptsNeighTris.begin(i), ptsNeighTris.end(i));
         }
     }
 }
 
 void Mesh::smoothNormals(StaticVector<Point3d>& nms, StaticVector<StaticVector<int>>& ptsNeighPts)
 {
+    // smooth from a snapshot of the input normals, so every vertex averages the
+    // normals of the same iteration (and the loop can run in parallel) instead of
+    // mixing already-smoothed values in vertex index order
+    StaticVector<Point3d> inputNms;
+    inputNms.swap(nms);
+    nms.resize_with(pts.size(), Point3d(0.0f, 0.0f, 0.0f));
+
+#pragma omp parallel for
     for (int i = 0; i < pts.size(); ++i)
     {
-        Point3d& n = nms[i];
+        Point3d n = inputNms[i];
         for (int j = 0; j < sizeOfStaticVector<int>(ptsNeighPts[i]); ++j)
         {
-            n = n + nms[ptsNeighPts[i][j]];
+            n = n + inputNms[ptsNeighPts[i][j]];
         }
         if (sizeOfStaticVector<int>(ptsNeighPts[i]) > 0)
         {
@@ -1367,6 +1690,7 @@ void Mesh::smoothNormals(StaticVector<Point3d>& nms, StaticVector<StaticVector<i
         {
             n = Point3d(0.0f, 0.0f, 0.0f);
         }
+        nms[i] = n;
     }
 }
 
@@ -1388,6 +1712,8 @@ void Mesh::removeFreePointsFromMesh(StaticVector<int>& out_ptIdToNewPtId)
     std::swap(cleanedMesh.pts, pts);
     std::swap(cleanedMesh.tris, tris);
     std::swap(cleanedMesh._colors, _colors);
+
+    invalidateAdjacencyCache();
 }
 
 double Mesh::computeTriangleProjectionArea(const triangle_proj& tp) const
@@ -1844,6 +2170,8 @@ int Mesh::subdivideMeshOnce(const Mesh& refMesh, const GEO::AdaptiveKdTree& refM
     trisUvIds.swap(new_trisUvIds);
     _trisMtlIds.swap(new_trisMtlIds);
 
+    invalidateAdjacencyCache();
+
     return trianglesToSubdivide.size();
 }
 
@@ -1895,6 +2223,8 @@ void Mesh::letJustTringlesIdsInMesh(StaticVector<int>& trisIdsToStay)
         trisTmp.push_back(tris[trisIdsToStay[i]]);
     }
     tris.swap(trisTmp);
+
+    invalidateAdjacencyCache();
 }
 
 void Mesh::letJustTringlesIdsInMesh(const StaticVectorBool& trisToStay)
@@ -1912,6 +2242,8 @@ void Mesh::letJustTringlesIdsInMesh(const StaticVectorBool& trisToStay)
             trisTmp.push_back(tris[i]);
 
     tris.swap(trisTmp);
+
+    invalidateAdjacencyCache();
 }
 
 void Mesh::computeTrisCams(StaticVector<StaticVector<int>>& trisCams, const mvsUtils::MultiViewParams& mp, const std::string tmpDir)
@@ -1919,29 +2251,28 @@ void Mesh::computeTrisCams(StaticVector<StaticVector<int>>& trisCams, const mvsU
     if (mp.verbose)
         ALICEVISION_LOG_DEBUG("Computing tris cams.");
 
+    // load each per-camera visibility file only once: the lists are kept in memory
+    // for the fill pass below, so the files are not read twice
+    std::vector<StaticVector<int>> visTrisPerCam(mp.ncams);
+
     StaticVector<int> ntrisCams;
-    ntrisCams.reserve(tris.size());
     ntrisCams.resize_with(tris.size(), 0);
 
     long t1 = mvsUtils::initEstimate();
     for (int rc = 0; rc < mp.ncams; ++rc)
     {
         std::string visTrisFilepath = tmpDir + "visTris" + std::to_string(mp.getViewId(rc)) + ".bin";
-        StaticVector<int> visTris;
+        StaticVector<int>& visTris = visTrisPerCam[rc];
         loadArrayFromFile<int>(visTris, visTrisFilepath);
-        if (!visTris.empty())
+        for (int i = 0; i < visTris.size(); ++i)
         {
-            for (int i = 0; i < visTris.size(); ++i)
-            {
-                int idTri = visTris[i];
-                ++ntrisCams[idTri];
-            }
+            ++ntrisCams[visTris[i]];
         }
         mvsUtils::printfEstimate(rc, mp.ncams, t1);
     }
     mvsUtils::finishEstimate();
 
-    trisCams.reserve(tris.size());
+    trisCams.resize(tris.size());
 
     for (int i = 0; i < tris.size(); ++i)
     {
@@ -1951,34 +2282,29 @@ void Mesh::computeTrisCams(StaticVector<StaticVector<int>>& trisCams, const mvsU
         }
     }
 
-    t1 = mvsUtils::initEstimate();
+    // every triangle is listed at most once per camera, so within one camera the
+    // inner scatter touches distinct per-triangle lists
     for (int rc = 0; rc < mp.ncams; ++rc)
     {
-        std::string visTrisFilepath = tmpDir + "visTris" + std::to_string(mp.getViewId(rc)) + ".bin";
-        StaticVector<int> visTris;
-        loadArrayFromFile<int>(visTris, visTrisFilepath);
-        if (!visTris.empty())
+        const StaticVector<int>& visTris = visTrisPerCam[rc];
+#pragma omp parallel for
+        for (int i = 0; i < visTris.size(); ++i)
         {
-            for (int i = 0; i < visTris.size(); ++i)
-            {
-                int idTri = visTris[i];
-                trisCams[idTri].push_back(rc);
-            }
+            trisCams[visTris[i]].push_back(rc);
         }
-        mvsUtils::printfEstimate(rc, mp.ncams, t1);
     }
-    mvsUtils::finishEstimate();
 }
 
 void Mesh::computeTrisCamsFromPtsCams(StaticVector<StaticVector<int>>& trisCams) const
 {
     // TODO: try intersection
-    trisCams.reserve(tris.size());
+    trisCams.resize(tris.size());
 
+#pragma omp parallel for
     for (int idTri = 0; idTri < tris.size(); ++idTri)
     {
         const Mesh::triangle& t = tris[idTri];
-        StaticVector<int> cams;
+        StaticVector<int>& cams = trisCams[idTri];
 
         int maxcams = sizeOfStaticVector<int>(pointsVisibilities[t.v[0]]) + sizeOfStaticVector<int>(pointsVisibilities[t.v[1]]) +
                       sizeOfStaticVector<int>(pointsVisibilities[t.v[2]]);
@@ -1990,7 +2316,6 @@ void Mesh::computeTrisCamsFromPtsCams(StaticVector<StaticVector<int>>& trisCams)
                 cams.push_back_distinct(pointsVisibilities[t.v[k]][i]);
             }
         }
-        trisCams.push_back(cams);
     }
 }
 
@@ -2206,6 +2531,7 @@ void Mesh::changeTriPtId(int triId, int oldPtId, int newPtId)
             tris[triId].v[k] = newPtId;
         }
     }
+    invalidateAdjacencyCache();
 }
 
 int Mesh::getTriPtIndex(int triId, int ptId, bool failIfDoesNotExists) const
@@ -2363,6 +2689,13 @@ void Mesh::load(const std::string& filepath, bool mergeCoincidentVerts, Material
         ALICEVISION_THROW_ERROR("Mesh::load: no such file: " << filepath);
     }
 
+    // compact binary intermediate format, not going through assimp
+    if (std::filesystem::path(filepath).extension() == ".avmesh")
+    {
+        loadFromAvmesh(filepath);
+        return;
+    }
+
     // see https://github.com/assimp/assimp/blob/master/include/assimp/postprocess.h#L85
     const unsigned int pFlags =
       // If this flag is not specified, no vertices are referenced by more than one face
@@ -2594,6 +2927,8 @@ void Mesh::load(const std::string& filepath, bool mergeCoincidentVerts, Material
         }
     }
 
+    invalidateAdjacencyCache();
+
     ALICEVISION_LOG_DEBUG("Vertices: " << pts.size());
     ALICEVISION_LOG_DEBUG("Triangles: " << tris.size());
     ALICEVISION_LOG_DEBUG("UVs: " << uvCoords.size());
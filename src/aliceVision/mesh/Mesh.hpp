@@ -8,6 +8,7 @@
 
 #include <aliceVision/image/Rgb.hpp>
 #include <aliceVision/mesh/Material.hpp>
+#include <aliceVision/mvsData/ArrayOfArrays.hpp>
 #include <aliceVision/mvsData/Matrix3x3.hpp>
 #include <aliceVision/mvsData/Point2d.hpp>
 #include <aliceVision/mvsData/Point3d.hpp>
@@ -50,7 +51,8 @@ enum class EFileType
     OBJ = 0,
     FBX,
     GLTF,
-    STL
+    STL,
+    AVMESH  //< compact binary intermediate format for inter-stage hand-off
 };
 
 EFileType EFileType_stringToEnum(const std::string& filetype);
@@ -148,6 +150,10 @@ class Mesh
     std::vector<rgb> _colors;
     /// Per triangle material id
     std::vector<int> _trisMtlIds;
+    /// Lazily built vertex-to-triangle adjacency (CSR), see getPtsNeighborTrianglesCached()
+    mutable ArrayOfArrays<int> _ptsNeighTrisCached;
+    /// Tell if the cached adjacency has to be rebuilt
+    mutable bool _ptsNeighTrisCachedDirty = true;
 
   public:
     StaticVector<Point3d> pts;
@@ -167,6 +173,11 @@ class Mesh
 
     bool loadFromBin(const std::string& binFilepath);
     void saveToBin(const std::string& binFilepath);
+    /// Fast OBJ export (vertices and faces only): lines are formatted by blocks in parallel
+    void saveToObj(const std::string& objFilepath) const;
+    /// Compact binary intermediate format: fixed header followed by the raw mesh arrays
+    void loadFromAvmesh(const std::string& avmeshFilepath);
+    void saveToAvmesh(const std::string& avmeshFilepath) const;
     void load(const std::string& filepath, bool mergeCoincidentVerts = false, Material* material = nullptr);
 
     void addMesh(const Mesh& mesh);
@@ -199,8 +210,18 @@ class Mesh
 
     void getPtsNeighbors(std::vector<std::vector<int>>& out_ptsNeighTris) const;
     void getPtsNeighborTriangles(StaticVector<StaticVector<int>>& out_ptsNeighTris) const;
+    void getPtsNeighborTriangles(ArrayOfArrays<int>& out_ptsNeighTris) const;
     void getPtsNeighPtsOrdered(StaticVector<StaticVector<int>>& out_ptsNeighTris) const;
 
+    /**
+     * @brief Get the vertex-to-triangle adjacency (CSR layout), built on first use and
+     * shared by all the callers until the topology changes.
+     * Every method changing pts or tris has to call invalidateAdjacencyCache().
+     */
+    const ArrayOfArrays<int>& getPtsNeighborTrianglesCached() const;
+    /// Drop the cached vertex-to-triangle adjacency, to call after any topology change
+    void invalidateAdjacencyCache();
+
     void getVisibleTrianglesIndexes(StaticVector<int>& out_visTri,
                                     const std::string& tmpDir,
                                     const mvsUtils::MultiViewParams& mp,
@@ -238,6 +259,7 @@ class Mesh
     void laplacianSmoothPts(StaticVector<StaticVector<int>>& ptsNeighPts, double maximalNeighDist = -1.0f);
     void computeNormalsForPts(StaticVector<Point3d>& out_nms) const;
     void computeNormalsForPts(StaticVector<StaticVector<int>>& ptsNeighTris, StaticVector<Point3d>& out_nms) const;
+    void computeNormalsForPts(const ArrayOfArrays<int>& ptsNeighTris, StaticVector<Point3d>& out_nms) const;
     void smoothNormals(StaticVector<Point3d>& nms, StaticVector<StaticVector<int>>& ptsNeighPts);
     Point3d computeTriangleNormal(int idTri) const;
     Point3d computeTriangleCenterOfGravity(int idTri) const;
@@ -5,6 +5,7 @@
 // You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include "MeshClean.hpp"
+#include <aliceVision/alicevision_omp.hpp>
 #include <aliceVision/system/Logger.hpp>
 
 namespace aliceVision {
@@ -633,10 +634,14 @@ void MeshClean::init()
 {
     deallocateCleaningAttributes();
 
-    getPtsNeighborTriangles(ptsNeighTrisSortedAsc);
+    // reuse the shared CSR adjacency of the mesh, per-point copies are needed as the
+    // lists below are updated incrementally while cleaning
+    const ArrayOfArrays<int>& ptsNeighTris = getPtsNeighborTrianglesCached();
+    ptsNeighTrisSortedAsc.resize(pts.size());
     for (int i = 0; i < pts.size(); i++)
     {
         StaticVector<int>& ptNeigTris = ptsNeighTrisSortedAsc[i];
+        ptNeigTris.getDataWritable().assign(ptsNeighTris.begin(i), ptsNeighTris.end(i));
         if (sizeOfStaticVector<int>(ptNeigTris) > 1)
         {
             qsort(&ptNeigTris[0], ptNeigTris.size(), sizeof(int), qSortCompareIntAsc);
@@ -844,10 +849,42 @@ void MeshClean::testPtsNeighPtsOrdered()
 
 int MeshClean::cleanMesh()
 {
-    int nWrongPts = 0;
     int nv = pts.size();
+
+    // analysis pass: flag the points whose triangle fan is non-manifold
+    // (read-only on the shared cleaning structures, so it runs in parallel)
+    StaticVectorBool wrongPts;
+    wrongPts.resize_with(nv, false);
+
+#pragma omp parallel for
+    for (int i = 0; i < nv; i++)
+    {
+        path pth(this, i);
+        wrongPts[i] = pth.isWrongPt();
+    }
+
+    // repair pass, regular points first:
+    // deploying a regular point only rewrites its own neighborhood lists and boundary flag,
+    // the shared triangle and edge tables are untouched, so these points are processed concurrently
+#pragma omp parallel for
     for (int i = 0; i < nv; i++)
     {
+        if (wrongPts[i])
+            continue;
+
+        path pth(this, i);
+        pth.deployAll();
+    }
+
+    // repair pass, non-manifold points:
+    // deploying a wrong point duplicates it and updates the triangles, the edge tables and the
+    // neighborhood lists of the surrounding points, so these regions are resolved in a serial sweep
+    int nWrongPts = 0;
+    for (int i = 0; i < nv; i++)
+    {
+        if (!wrongPts[i])
+            continue;
+
         path pth(this, i);
         nWrongPts += static_cast<int>(pth.deployAll() > 0);
     }
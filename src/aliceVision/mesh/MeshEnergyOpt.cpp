@@ -5,6 +5,7 @@
 // You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include "MeshEnergyOpt.hpp"
+#include "spatialSort.hpp"
 #include <aliceVision/system/Logger.hpp>
 
 namespace aliceVision {
@@ -19,37 +20,36 @@ MeshEnergyOpt::MeshEnergyOpt(mvsUtils::MultiViewParams* _mp)
 
 MeshEnergyOpt::~MeshEnergyOpt() = default;
 
-void MeshEnergyOpt::computeLaplacianPtsParallel(StaticVector<Point3d>& out_lapPts)
+void MeshEnergyOpt::computeLaplacianPtsParallel(const std::vector<int>& ptsOrder, StaticVector<Point3d>& out_lapPts)
 {
     out_lapPts.reserve(pts.size());
     out_lapPts.resize_with(pts.size(), Point3d(0.0f, 0.0f, 0.f));
-    int nlabpts = 0;
 
 #pragma omp parallel for
-    for (int i = 0; i < pts.size(); i++)
+    for (int oi = 0; oi < pts.size(); oi++)
     {
+        const int i = ptsOrder[oi];
         Point3d lapPt;
         if (getLaplacianSmoothingVector(i, lapPt))
         {
             out_lapPts[i] = lapPt;
-            nlabpts++;
         }
     }
 }
 
-void MeshEnergyOpt::updateGradientParallel(float lambda, const Point3d& LU, const Point3d& RD, StaticVectorBool& ptsCanMove)
+void MeshEnergyOpt::updateGradientParallel(const std::vector<int>& ptsOrder, float lambda, const Point3d& LU, const Point3d& RD, StaticVectorBool& ptsCanMove)
 {
-    // printf("nlabpts %i of %i\n",nlabpts,pts->size());
     StaticVector<Point3d> lapPts;
-    computeLaplacianPtsParallel(lapPts);
+    computeLaplacianPtsParallel(ptsOrder, lapPts);
 
     StaticVector<Point3d> newPts;
     newPts.reserve(pts.size());
     newPts.push_back_arr(&pts);
 
 #pragma omp parallel for
-    for (int i = 0; i < pts.size(); ++i)
+    for (int oi = 0; oi < pts.size(); ++oi)
     {
+        const int i = ptsOrder[oi];
         if (ptsCanMove.empty() || ptsCanMove[i])
         {
             Point3d n;
@@ -93,10 +93,16 @@ bool MeshEnergyOpt::optimizeSmooth(float lambda, int niter, StaticVectorBool& pt
 
     ALICEVISION_LOG_INFO("Optimizing mesh smooth: " << std::endl << "\t- lamda: " << lambda << std::endl << "\t- niters: " << niter << std::endl);
 
+    // process the vertices along a space-filling curve: neighboring vertices are
+    // visited close in time, so the neighborhood gathers of the Laplacian and
+    // gradient updates hit cached data instead of scattered memory
+    std::vector<int> ptsOrder;
+    computeSpatialOrder(pts, ptsOrder);
+
     for (int i = 0; i < niter; i++)
     {
         ALICEVISION_LOG_INFO("Optimizing mesh smooth: iteration " << i);
-        updateGradientParallel(lambda, LU, RD, ptsCanMove);
+        updateGradientParallel(ptsOrder, lambda, LU, RD, ptsCanMove);
         // if(saveDebug)
         //     save(folder + "mesh_smoothed_" + std::to_string(i));
     }
@@ -10,6 +10,8 @@
 #include <aliceVision/mvsData/StaticVector.hpp>
 #include <aliceVision/mesh/MeshAnalyze.hpp>
 
+#include <vector>
+
 namespace aliceVision {
 namespace mesh {
 
@@ -22,8 +24,8 @@ class MeshEnergyOpt : public MeshAnalyze
     bool optimizeSmooth(float lambda, int niter, StaticVectorBool& ptsCanMove);
 
   private:
-    void computeLaplacianPtsParallel(StaticVector<Point3d>& out_lapPts);
-    void updateGradientParallel(float lambda, const Point3d& LU, const Point3d& RD, StaticVectorBool& ptsCanMove);
+    void computeLaplacianPtsParallel(const std::vector<int>& ptsOrder, StaticVector<Point3d>& out_lapPts);
+    void updateGradientParallel(const std::vector<int>& ptsOrder, float lambda, const Point3d& LU, const Point3d& RD, StaticVectorBool& ptsCanMove);
 };
 
 }  // namespace mesh
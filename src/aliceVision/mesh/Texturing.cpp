@@ -10,6 +10,7 @@
 
 #include <aliceVision/utils/filesIO.hpp>
 #include <aliceVision/system/Logger.hpp>
+#include <aliceVision/system/ProgressDisplay.hpp>
 #include <aliceVision/image/io.hpp>
 #include <aliceVision/image/pixelTypes.hpp>
 #include <aliceVision/numeric/numeric.hpp>
@@ -324,6 +325,19 @@ void Texturing::generateTextures(const mvsUtils::MultiViewParams& mp,
     int nbAtlasMax = std::floor(availableMem / double(memoryPerAtlas));  // maximum number of textures laplacian pyramid in RAM
     nbAtlasMax = std::min(nbAtlas, nbAtlasMax);                          // if enough memory, do it with all atlases
 
+    // when even a single atlas pyramid does not fit in memory, process the atlases one by
+    // one and accumulate each of them by tiles of rows to bound memory (out-of-core mode)
+    int nbTiles = 1;
+    if (nbAtlasMax < 1)
+    {
+        // memory left for the tiled accumulation pyramid, once the streamed input images
+        // and the full-size output atlas are accounted for
+        const int availableMemForTiles = std::max(1, availableMem - int(imageMaxMemSize + imagePyramidMaxMemSize + atlasContribMemSize));
+        nbTiles = std::min(int(texParams.textureSide), divideRoundUp(int(atlasPyramidMaxMemSize), availableMemForTiles));
+        nbAtlasMax = 1;
+        ALICEVISION_LOG_INFO("Not enough memory for a whole atlas pyramid: processing each atlas in " << nbTiles << " tiles of rows.");
+    }
+
     ALICEVISION_LOG_INFO("nbAtlas: " << nbAtlas);
     ALICEVISION_LOG_INFO("availableRam: " << availableRam);
     ALICEVISION_LOG_INFO("availableMem: " << availableMem);
@@ -363,7 +377,7 @@ void Texturing::generateTextures(const mvsUtils::MultiViewParams& mp,
             atlasIDs.push_back(atlasID);
         }
         ALICEVISION_LOG_INFO("Generating texture for atlases " << n * nbAtlasMax + 1 << " to " << n * nbAtlasMax + imax);
-        generateTexturesSubSet(mp, atlasIDs, imageCache, outPath, textureFileType);
+        generateTexturesSubSet(mp, atlasIDs, imageCache, outPath, textureFileType, nbTiles);
     }
 }
 
@@ -371,13 +385,12 @@ void Texturing::generateTexturesSubSet(const mvsUtils::MultiViewParams& mp,
                                        const std::vector<size_t>& atlasIDs,
                                        mvsUtils::ImagesCache<image::Image<image::RGBfColor>>& imageCache,
                                        const fs::path& outPath,
-                                       image::EImageFileType textureFileType)
+                                       image::EImageFileType textureFileType,
+                                       int nbTiles)
 {
     if (atlasIDs.size() > _atlases.size())
         throw std::runtime_error("Invalid atlas IDs ");
 
-    unsigned int textureSize = texParams.textureSide * texParams.textureSide;
-
     // We select the best cameras for each triangle and store it per camera for each output texture files.
     // Triangles contributions are stored per frequency bands for multi-band blending.
     using AtlasIndex = size_t;
@@ -390,8 +403,13 @@ void Texturing::generateTexturesSubSet(const mvsUtils::MultiViewParams& mp,
         ALICEVISION_LOG_INFO("Generating texture for atlas " << atlasID + 1 << "/" << _atlases.size() << " (" << _atlases[atlasID].size()
                                                              << " triangles).");
 
+        // per-triangle contributions <camId, band, score>, scored in parallel and merged
+        // sequentially afterwards to keep the per-camera triangle lists in ascending order
+        std::vector<std::vector<std::tuple<int, int, float>>> contribsPerTriangle(_atlases[atlasID].size());
+
         // iterate over atlas' triangles
-        for (size_t i = 0; i < _atlases[atlasID].size(); ++i)
+#pragma omp parallel for
+        for (int i = 0; i < static_cast<int>(_atlases[atlasID].size()); ++i)
         {
             int triangleID = _atlases[atlasID][i];
 
@@ -498,10 +516,7 @@ void Texturing::generateTexturesSubSet(const mvsUtils::MultiViewParams& mp,
                 // for the camera camId : add triangle score to the corresponding texture, at the right frequency band
                 const int camId = std::get<2>(scorePerCamId[contrib]);
                 const int triangleScore = std::get<1>(scorePerCamId[contrib]);
-                auto& camContribution = contributionsPerCamera[camId];
-                if (camContribution.find(atlasID) == camContribution.end())
-                    camContribution[atlasID].resize(texParams.nbBand);
-                camContribution.at(atlasID)[band].emplace_back(triangleID, triangleScore);
+                contribsPerTriangle[i].emplace_back(camId, band, float(triangleScore));
 
                 if (contrib + 1 == texParams.multiBandNbContrib[band])
                 {
@@ -509,238 +524,270 @@ void Texturing::generateTexturesSubSet(const mvsUtils::MultiViewParams& mp,
                 }
             }
         }
+
+        // merge the per-triangle contributions, in triangle order
+        for (size_t i = 0; i < _atlases[atlasID].size(); ++i)
+        {
+            const unsigned int triangleID = _atlases[atlasID][i];
+            for (const auto& triContrib : contribsPerTriangle[i])
+            {
+                const int camId = std::get<0>(triContrib);
+                const int band = std::get<1>(triContrib);
+                auto& camContribution = contributionsPerCamera[camId];
+                if (camContribution.find(atlasID) == camContribution.end())
+                    camContribution[atlasID].resize(texParams.nbBand);
+                camContribution.at(atlasID)[band].emplace_back(triangleID, std::get<2>(triContrib));
+            }
+        }
     }
 
     ALICEVISION_LOG_INFO("Reading pixel color.");
 
-    // pyramid of atlases frequency bands
-    std::map<AtlasIndex, AccuPyramid> accuPyramids;
+    const int texSide = static_cast<int>(texParams.textureSide);
+    nbTiles = clamp(nbTiles, 1, texSide);
+    const int nbTileRows = divideRoundUp(texSide, nbTiles);
+    if (nbTiles > 1)
+        ALICEVISION_LOG_INFO("Out-of-core accumulation: " << nbTiles << " tiles of " << nbTileRows << " rows per atlas.");
+
+    // downscale coefficient of each frequency band, hoisted out of the per-pixel loop
+    std::vector<int> bandDownscales(texParams.nbBand);
+    for (int band = 0; band < texParams.nbBand; ++band)
+        bandDownscales[band] = std::pow(texParams.multiBandDownscale, band);
+
+    // output atlas textures: averaged colors with the frequency bands fused, filled tile by tile
+    std::map<AtlasIndex, AccuImage> atlasTextures;
     for (std::size_t atlasID : atlasIDs)
-        accuPyramids[atlasID].init(texParams.nbBand, texParams.textureSide, texParams.textureSide);
+        atlasTextures[atlasID].resize(texParams.textureSide, texParams.textureSide);
 
-    // for each camera, for each texture, iterate over triangles and fill the accuPyramids map
-    for (int camId = 0; camId < contributionsPerCamera.size(); ++camId)
-    {
-        const std::map<AtlasIndex, std::vector<ScorePerTriangle>>& cameraContributions = contributionsPerCamera[camId];
+    // periodically report the camera accumulation rate (the MB/s throughput of the streamed
+    // images reveals a degraded storage backend) and the estimated time of completion
+    auto progressDisplay = system::createRateProgressDisplay(std::size_t(nbTiles) * contributionsPerCamera.size(), "Texture fusion");
 
-        if (cameraContributions.empty())
+    for (int tile = 0; tile < nbTiles; ++tile)
+    {
+        // tile of rows [tileRowBegin, tileRowEnd) of the output textures
+        const int tileRowBegin = tile * nbTileRows;
+        const int tileRowEnd = std::min(texSide, tileRowBegin + nbTileRows);
+
+        // pyramid of atlases frequency bands, the accumulation buffers cover the current tile only
+        std::map<AtlasIndex, AccuPyramid> accuPyramids;
+        for (std::size_t atlasID : atlasIDs)
+            accuPyramids[atlasID].init(texParams.nbBand, texParams.textureSide, tileRowEnd - tileRowBegin);
+
+        // for each camera, for each texture, iterate over triangles and fill the accuPyramids map
+        // (in the tiled mode the contributing images are streamed through the cache once per tile)
+        for (int camId = 0; camId < contributionsPerCamera.size(); ++camId)
         {
-            ALICEVISION_LOG_INFO("- camera " << mp.getViewId(camId) << " (" << camId + 1 << "/" << mp.ncams << ") unused.");
-            continue;
-        }
-        ALICEVISION_LOG_INFO("- camera " << mp.getViewId(camId) << " (" << camId + 1 << "/" << mp.ncams << ") with contributions to "
-                                         << cameraContributions.size() << " texture files:");
+            const std::map<AtlasIndex, std::vector<ScorePerTriangle>>& cameraContributions = contributionsPerCamera[camId];
 
-        // Load camera image from cache
-        auto imgPtr = imageCache.getImg_sync(camId);
-        const image::Image<image::RGBfColor>& camImg = *imgPtr;
+            if (cameraContributions.empty())
+            {
+                ALICEVISION_LOG_INFO("- camera " << mp.getViewId(camId) << " (" << camId + 1 << "/" << mp.ncams << ") unused.");
+                ++progressDisplay;
+                continue;
+            }
+            ALICEVISION_LOG_INFO("- camera " << mp.getViewId(camId) << " (" << camId + 1 << "/" << mp.ncams << ") with contributions to "
+                                             << cameraContributions.size() << " texture files:");
 
-        // Calculate laplacianPyramid
-        std::vector<image::Image<image::RGBfColor>> pyramidL;  // laplacian pyramid
-        imageAlgo::laplacianPyramid(pyramidL, camImg, texParams.nbBand, texParams.multiBandDownscale);
+            // Load camera image from cache
+            auto imgPtr = imageCache.getImg_sync(camId);
+            const image::Image<image::RGBfColor>& camImg = *imgPtr;
+            progressDisplay.incrementBytes(std::size_t(camImg.width()) * camImg.height() * sizeof(image::RGBfColor));
 
-        // for each output texture file
-        for (const auto& c : cameraContributions)
-        {
-            AtlasIndex atlasID = c.first;
-            ALICEVISION_LOG_INFO("  - Texture file: " << atlasID + 1);
-            // for each frequency band
-            for (int band = 0; band < c.second.size(); ++band)
+            // Calculate laplacianPyramid
+            std::vector<image::Image<image::RGBfColor>> pyramidL;  // laplacian pyramid
+            imageAlgo::laplacianPyramid(pyramidL, camImg, texParams.nbBand, texParams.multiBandDownscale);
+
+            // for each output texture file
+            for (const auto& c : cameraContributions)
             {
-                const ScorePerTriangle& trianglesId = c.second[band];
-                ALICEVISION_LOG_INFO("      - band " << band + 1 << ": " << trianglesId.size() << " triangles.");
+                AtlasIndex atlasID = c.first;
+                AccuPyramid& accuPyramid = accuPyramids.at(atlasID);
+                ALICEVISION_LOG_INFO("  - Texture file: " << atlasID + 1);
+                // for each frequency band
+                for (int band = 0; band < c.second.size(); ++band)
+                {
+                    const ScorePerTriangle& trianglesId = c.second[band];
+                    ALICEVISION_LOG_INFO("      - band " << band + 1 << ": " << trianglesId.size() << " triangles.");
 
 // for each triangle
 #pragma omp parallel for
-                for (int ti = 0; ti < trianglesId.size(); ++ti)
-                {
-                    const unsigned int triangleId = std::get<0>(trianglesId[ti]);
-                    const float triangleScore = texParams.useScore ? std::get<1>(trianglesId[ti]) : 1.0f;
-                    // retrieve triangle 3D and UV coordinates
-                    Point2d triPixs[3];
-                    Point3d triPts[3];
-                    auto& triangleUvIds = mesh->trisUvIds[triangleId];
-                    // compute the Bottom-Left minima of the current UDIM for [0,1] range remapping
-                    Point2d udimBL;
-                    StaticVector<Point2d>& uvCoords = mesh->uvCoords;
-                    udimBL.x = std::floor(std::min({uvCoords[triangleUvIds[0]].x, uvCoords[triangleUvIds[1]].x, uvCoords[triangleUvIds[2]].x}));
-                    udimBL.y = std::floor(std::min({uvCoords[triangleUvIds[0]].y, uvCoords[triangleUvIds[1]].y, uvCoords[triangleUvIds[2]].y}));
-
-                    for (int k = 0; k < 3; ++k)
-                    {
-                        const int pointIndex = mesh->tris[triangleId].v[k];
-                        triPts[k] = mesh->pts[pointIndex];  // 3D coordinates
-                        const int uvPointIndex = triangleUvIds.m[k];
-                        Point2d uv = uvCoords[uvPointIndex];
-                        // UDIM: remap coordinates between [0,1]
-                        uv = uv - udimBL;
-
-                        triPixs[k] = uv * texParams.textureSide;  // UV coordinates
-                    }
-
-                    // compute triangle bounding box in pixel indexes
-                    // min values: floor(value)
-                    // max values: ceil(value)
-                    Pixel LU, RD;
-                    LU.x = static_cast<int>(std::floor(std::min({triPixs[0].x, triPixs[1].x, triPixs[2].x})));
-                    LU.y = static_cast<int>(std::floor(std::min({triPixs[0].y, triPixs[1].y, triPixs[2].y})));
-                    RD.x = static_cast<int>(std::ceil(std::max({triPixs[0].x, triPixs[1].x, triPixs[2].x})));
-                    RD.y = static_cast<int>(std::ceil(std::max({triPixs[0].y, triPixs[1].y, triPixs[2].y})));
-
-                    // sanity check: clamp values to [0; textureSide]
-                    int texSide = static_cast<int>(texParams.textureSide);
-                    LU.x = clamp(LU.x, 0, texSide);
-                    LU.y = clamp(LU.y, 0, texSide);
-                    RD.x = clamp(RD.x, 0, texSide);
-                    RD.y = clamp(RD.y, 0, texSide);
-
-                    // iterate over pixels of the triangle's bounding box
-                    for (int y = LU.y; y < RD.y; ++y)
+                    for (int ti = 0; ti < trianglesId.size(); ++ti)
                     {
-                        for (int x = LU.x; x < RD.x; ++x)
+                        const unsigned int triangleId = std::get<0>(trianglesId[ti]);
+                        const float triangleScore = texParams.useScore ? std::get<1>(trianglesId[ti]) : 1.0f;
+                        // retrieve triangle 3D and UV coordinates
+                        Point2d triPixs[3];
+                        Point3d triPts[3];
+                        auto& triangleUvIds = mesh->trisUvIds[triangleId];
+                        // compute the Bottom-Left minima of the current UDIM for [0,1] range remapping
+                        Point2d udimBL;
+                        StaticVector<Point2d>& uvCoords = mesh->uvCoords;
+                        udimBL.x = std::floor(std::min({uvCoords[triangleUvIds[0]].x, uvCoords[triangleUvIds[1]].x, uvCoords[triangleUvIds[2]].x}));
+                        udimBL.y = std::floor(std::min({uvCoords[triangleUvIds[0]].y, uvCoords[triangleUvIds[1]].y, uvCoords[triangleUvIds[2]].y}));
+
+                        for (int k = 0; k < 3; ++k)
                         {
-                            Pixel pix(x, y);  // top-left corner of the pixel
-                            Point2d barycCoords;
-
-                            // test if the pixel is inside triangle
-                            // and retrieve its barycentric coordinates
-                            if (!isPixelInTriangle(triPixs, pix, barycCoords))
-                            {
-                                continue;
-                            }
+                            const int pointIndex = mesh->tris[triangleId].v[k];
+                            triPts[k] = mesh->pts[pointIndex];  // 3D coordinates
+                            const int uvPointIndex = triangleUvIds.m[k];
+                            Point2d uv = uvCoords[uvPointIndex];
+                            // UDIM: remap coordinates between [0,1]
+                            uv = uv - udimBL;
+
+                            triPixs[k] = uv * texParams.textureSide;  // UV coordinates
+                        }
 
-                            // remap 'y' to image coordinates system (inverted Y axis)
-                            const unsigned int y_ = (texParams.textureSide - 1) - y;
-                            // 1D pixel index
-                            unsigned int xyoffset = y_ * texParams.textureSide + x;
-                            // get 3D coordinates
-                            Point3d pt3d = barycentricToCartesian(triPts, barycCoords);
-                            // get 2D coordinates in source image
-                            Point2d pixRC;
-                            mp.getPixelFor3DPoint(&pixRC, pt3d, camId);
-                            // exclude out of bounds pixels
-                            if (!mp.isPixelInImage(pixRC, camId))
-                                continue;
-
-                            // If the color is pure zero (ie. no contributions), we consider it as an invalid pixel.
-                            if (getInterpolateColor(camImg, pixRC.y, pixRC.x) == image::RGBfColor(0.f, 0.f, 0.f))
-                                continue;
-
-                            // Fill the accumulated pyramid for this pixel
-                            // each frequency band also contributes to lower frequencies (higher band indexes)
-                            AccuPyramid& accuPyramid = accuPyramids.at(atlasID);
-                            for (std::size_t bandContrib = band; bandContrib < pyramidL.size(); ++bandContrib)
+                        // compute triangle bounding box in pixel indexes
+                        // min values: floor(value)
+                        // max values: ceil(value)
+                        Pixel LU, RD;
+                        LU.x = static_cast<int>(std::floor(std::min({triPixs[0].x, triPixs[1].x, triPixs[2].x})));
+                        LU.y = static_cast<int>(std::floor(std::min({triPixs[0].y, triPixs[1].y, triPixs[2].y})));
+                        RD.x = static_cast<int>(std::ceil(std::max({triPixs[0].x, triPixs[1].x, triPixs[2].x})));
+                        RD.y = static_cast<int>(std::ceil(std::max({triPixs[0].y, triPixs[1].y, triPixs[2].y})));
+
+                        // sanity check: clamp values to [0; textureSide],
+                        // and restrict the y range to the current tile of rows
+                        LU.x = clamp(LU.x, 0, texSide);
+                        LU.y = clamp(LU.y, texSide - tileRowEnd, texSide - tileRowBegin);
+                        RD.x = clamp(RD.x, 0, texSide);
+                        RD.y = clamp(RD.y, texSide - tileRowEnd, texSide - tileRowBegin);
+
+                        // iterate over pixels of the triangle's bounding box
+                        for (int y = LU.y; y < RD.y; ++y)
+                        {
+                            for (int x = LU.x; x < RD.x; ++x)
                             {
-                                int downscaleCoef = std::pow(texParams.multiBandDownscale, bandContrib);
-                                AccuImage& accuImage = accuPyramid.pyramid[bandContrib];
-
-                                // fill the accumulated color map for this pixel
-                                const auto pixDownscaled = pixRC / downscaleCoef;
-                                accuImage.img(xyoffset) +=
-                                  getInterpolateColor(pyramidL[bandContrib], pixDownscaled.y, pixDownscaled.x) * triangleScore;
-                                accuImage.imgCount[xyoffset] += triangleScore;
+                                Pixel pix(x, y);  // top-left corner of the pixel
+                                Point2d barycCoords;
+
+                                // test if the pixel is inside triangle
+                                // and retrieve its barycentric coordinates
+                                if (!isPixelInTriangle(triPixs, pix, barycCoords))
+                                {
+                                    continue;
+                                }
+
+                                // remap 'y' to image coordinates system (inverted Y axis)
+                                const unsigned int y_ = (texParams.textureSide - 1) - y;
+                                // 1D pixel index in the current tile
+                                unsigned int xyoffset = (y_ - tileRowBegin) * texParams.textureSide + x;
+                                // get 3D coordinates
+                                Point3d pt3d = barycentricToCartesian(triPts, barycCoords);
+                                // get 2D coordinates in source image
+                                Point2d pixRC;
+                                mp.getPixelFor3DPoint(&pixRC, pt3d, camId);
+                                // exclude out of bounds pixels
+                                if (!mp.isPixelInImage(pixRC, camId))
+                                    continue;
+
+                                // If the color is pure zero (ie. no contributions), we consider it as an invalid pixel.
+                                if (getInterpolateColor(camImg, pixRC.y, pixRC.x) == image::RGBfColor(0.f, 0.f, 0.f))
+                                    continue;
+
+                                // Fill the accumulated pyramid for this pixel
+                                // each frequency band also contributes to lower frequencies (higher band indexes)
+                                for (std::size_t bandContrib = band; bandContrib < pyramidL.size(); ++bandContrib)
+                                {
+                                    const int downscaleCoef = bandDownscales[bandContrib];
+                                    AccuImage& accuImage = accuPyramid.pyramid[bandContrib];
+
+                                    // fill the accumulated color map for this pixel
+                                    const auto pixDownscaled = pixRC / downscaleCoef;
+                                    accuImage.img(xyoffset) +=
+                                      getInterpolateColor(pyramidL[bandContrib], pixDownscaled.y, pixDownscaled.x) * triangleScore;
+                                    accuImage.imgCount[xyoffset] += triangleScore;
+                                }
                             }
                         }
                     }
                 }
             }
+
+            ++progressDisplay;
         }
-    }
 
-    // calculate atlas texture in the first level of the pyramid (avoid creating a new buffer)
-    // debug mode : write all the frequencies levels for each texture
-    for (std::size_t atlasID : atlasIDs)
-    {
-        AccuPyramid& accuPyramid = accuPyramids.at(atlasID);
-        AccuImage& atlasTexture = accuPyramid.pyramid[0];
-        ALICEVISION_LOG_INFO("Create texture " << atlasID + 1);
+        // average the accumulated contributions and fuse the frequency bands of the tile
+        // into the output textures
+        for (std::size_t atlasID : atlasIDs)
+        {
+            AccuPyramid& accuPyramid = accuPyramids.at(atlasID);
+            AccuImage& atlasTexture = atlasTextures.at(atlasID);
 
 #if TEXTURING_MBB_DEBUG
-        {
-            // write the number of contribution per atlas frequency bands
-            if (!texParams.useScore)
             {
-                for (std::size_t level = 0; level < accuPyramid.pyramid.size(); ++level)
+                // write the number of contribution per atlas frequency bands
+                if (!texParams.useScore)
                 {
-                    AccuImage& atlasLevelTexture = accuPyramid.pyramid[level];
+                    const int tileRows = tileRowEnd - tileRowBegin;
+                    for (std::size_t level = 0; level < accuPyramid.pyramid.size(); ++level)
+                    {
+                        AccuImage& atlasLevelTexture = accuPyramid.pyramid[level];
 
-                    // write the number of contributions for each texture
-                    std::vector<float> imgContrib(textureSize);
+                        // write the number of contributions for each texture
+                        std::vector<float> imgContrib(texParams.textureSide * tileRows);
 
-                    for (unsigned int yp = 0; yp < texParams.textureSide; ++yp)
-                    {
-                        unsigned int yoffset = yp * texParams.textureSide;
-                        for (unsigned int xp = 0; xp < texParams.textureSide; ++xp)
+                        for (int yp = 0; yp < tileRows; ++yp)
                         {
-                            unsigned int xyoffset = yoffset + xp;
-                            imgContrib[xyoffset] = atlasLevelTexture.imgCount[xyoffset];
+                            unsigned int yoffset = yp * texParams.textureSide;
+                            for (unsigned int xp = 0; xp < texParams.textureSide; ++xp)
+                            {
+                                unsigned int xyoffset = yoffset + xp;
+                                imgContrib[xyoffset] = atlasLevelTexture.imgCount[xyoffset];
+                            }
                         }
-                    }
 
-                    const std::string textureName = "contrib_" + std::to_string(1001 + atlasID) + std::string("_") + std::to_string(level) +
-                                                    std::string(".") +
-                                                    EImageFileType_enumToString(textureFileType);  // starts at '1001' for UDIM compatibility
-                    fs::path texturePath = outPath / textureName;
+                        const std::string textureName = "contrib_" + std::to_string(1001 + atlasID) + std::string("_") + std::to_string(level) +
+                                                        (nbTiles > 1 ? "_tile" + std::to_string(tile) : std::string()) + std::string(".") +
+                                                        EImageFileType_enumToString(textureFileType);  // starts at '1001' for UDIM compatibility
+                        fs::path texturePath = outPath / textureName;
 
-                    using namespace imageIO;
-                    OutputFileColorSpace colorspace(EImageColorSpace::SRGB, EImageColorSpace::AUTO);
-                    if (texParams.convertLAB)
-                        colorspace.from = EImageColorSpace::LAB;
-                    writeImage(texturePath.string(), texParams.textureSide, texParams.textureSide, imgContrib, EImageQuality::OPTIMIZED, colorspace);
+                        using namespace imageIO;
+                        OutputFileColorSpace colorspace(EImageColorSpace::SRGB, EImageColorSpace::AUTO);
+                        if (texParams.convertLAB)
+                            colorspace.from = EImageColorSpace::LAB;
+                        writeImage(texturePath.string(), texParams.textureSide, tileRows, imgContrib, EImageQuality::OPTIMIZED, colorspace);
+                    }
                 }
             }
-        }
 #endif
 
-        ALICEVISION_LOG_INFO("  - Computing final (average) color.");
-        for (unsigned int yp = 0; yp < texParams.textureSide; ++yp)
-        {
-            unsigned int yoffset = yp * texParams.textureSide;
-            for (unsigned int xp = 0; xp < texParams.textureSide; ++xp)
+            ALICEVISION_LOG_INFO("  - Computing final (average) color of texture " << atlasID + 1 << ".");
+// every pixel is fused independently
+#pragma omp parallel for
+            for (int yp = tileRowBegin; yp < tileRowEnd; ++yp)
             {
-                unsigned int xyoffset = yoffset + xp;
-
-                // If the imgCount is valid on the first band, it will be valid on all the other bands
-                if (atlasTexture.imgCount[xyoffset] == 0)
-                    continue;
+                const unsigned int tileYoffset = (yp - tileRowBegin) * texParams.textureSide;
+                const unsigned int yoffset = yp * texParams.textureSide;
+                for (int xp = 0; xp < texSide; ++xp)
+                {
+                    const unsigned int tileXyoffset = tileYoffset + xp;
 
-                atlasTexture.img(xyoffset) /= atlasTexture.imgCount[xyoffset];
-                atlasTexture.imgCount[xyoffset] = 1;
+                    // If the imgCount is valid on the first band, it will be valid on all the other bands
+                    if (accuPyramid.pyramid[0].imgCount[tileXyoffset] == 0)
+                        continue;
 
-                for (std::size_t level = 1; level < accuPyramid.pyramid.size(); ++level)
-                {
-                    AccuImage& atlasLevelTexture = accuPyramid.pyramid[level];
-                    atlasLevelTexture.img(xyoffset) /= atlasLevelTexture.imgCount[xyoffset];
-                }
-            }
-        }
+                    image::RGBfColor color = accuPyramid.pyramid[0].img(tileXyoffset) / accuPyramid.pyramid[0].imgCount[tileXyoffset];
 
-#if TEXTURING_MBB_DEBUG
-        {
-            // write each frequency band, for each texture
-            for (std::size_t level = 0; level < accuPyramid.pyramid.size(); ++level)
-            {
-                AccuImage& atlasLevelTexture = accuPyramid.pyramid[level];
-                writeTexture(atlasLevelTexture, atlasID, outPath, textureFileType, level);
-            }
-        }
-#endif
+                    // each lower frequency band is averaged and fused into the final color
+                    for (std::size_t level = 1; level < accuPyramid.pyramid.size(); ++level)
+                    {
+                        AccuImage& atlasLevelTexture = accuPyramid.pyramid[level];
+                        color = color + atlasLevelTexture.img(tileXyoffset) / atlasLevelTexture.imgCount[tileXyoffset];
+                    }
 
-        // Fuse frequency bands into the first buffer, calculate final texture
-        for (unsigned int yp = 0; yp < texParams.textureSide; ++yp)
-        {
-            unsigned int yoffset = yp * texParams.textureSide;
-            for (unsigned int xp = 0; xp < texParams.textureSide; ++xp)
-            {
-                unsigned int xyoffset = yoffset + xp;
-                for (std::size_t level = 1; level < accuPyramid.pyramid.size(); ++level)
-                {
-                    AccuImage& atlasLevelTexture = accuPyramid.pyramid[level];
-                    atlasTexture.img(xyoffset) += atlasLevelTexture.img(xyoffset);
+                    atlasTexture.img(yoffset + xp) = color;
+                    atlasTexture.imgCount[yoffset + xp] = 1;
                 }
             }
         }
-        writeTexture(atlasTexture, atlasID, outPath, textureFileType, -1);
+    }
+
+    for (std::size_t atlasID : atlasIDs)
+    {
+        ALICEVISION_LOG_INFO("Create texture " << atlasID + 1);
+        writeTexture(atlasTextures.at(atlasID), atlasID, outPath, textureFileType, -1);
     }
 }
 
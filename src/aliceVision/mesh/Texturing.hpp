@@ -198,12 +198,16 @@ struct Texturing
                           size_t memoryAvailable,
                           image::EImageFileType textureFileType = image::EImageFileType::PNG);
 
-    /// Generate texture files for the given sub-set of texture atlases
+    /// Generate texture files for the given sub-set of texture atlases.
+    /// With nbTiles > 1 each atlas is accumulated by tiles of rows (out-of-core mode):
+    /// memory is bounded by the tile size and the contributing images are streamed
+    /// through the image cache once per tile.
     void generateTexturesSubSet(const mvsUtils::MultiViewParams& mp,
                                 const std::vector<size_t>& atlasIDs,
                                 mvsUtils::ImagesCache<image::Image<image::RGBfColor>>& imageCache,
                                 const fs::path& outPath,
-                                image::EImageFileType textureFileType = image::EImageFileType::PNG);
+                                image::EImageFileType textureFileType = image::EImageFileType::PNG,
+                                int nbTiles = 1);
 
     void generateNormalAndHeightMaps(const mvsUtils::MultiViewParams& mp,
                                      const Mesh& denseMesh,
@@ -139,6 +139,37 @@ void UVAtlas::packCharts(std::vector<Chart>& charts, mvsUtils::MultiViewParams&
     }
     alledges.clear();
 
+    // hierarchical merge, coarse level:
+    // neighboring triangles usually share the exact same visibility list, so they are grouped
+    // first with a plain union (no camera intersection to compute, no triangle list to copy).
+    // the intersection-based merge below then runs on this much smaller patch graph.
+    for (auto& e : edges)
+    {
+        if (e.triangleIDs.size() != 2)
+            continue;
+        const int chartIDA = findChart(e.triangleIDs[0]);
+        const int chartIDB = findChart(e.triangleIDs[1]);
+        if (chartIDA == chartIDB)
+            continue;
+        Chart& a = charts[chartIDA];
+        Chart& b = charts[chartIDB];
+        if (a.commonCameraIDs != b.commonCameraIDs)
+            continue;
+        if (chartIDA < chartIDB)
+            b.mergedWith = chartIDA;
+        else
+            a.mergedWith = chartIDB;
+    }
+
+    // gather the triangles of the coarse patches on their root chart
+    // (each chart still holds its single initial triangle at this point)
+    for (int i = 0; i < charts.size(); ++i)
+    {
+        const int rootID = findChart(i);
+        if (rootID != i)
+            charts[rootID].triangleIDs.emplace_back(i);
+    }
+
     // merge charts
     for (auto& e : edges)
     {
@@ -261,6 +292,7 @@ void UVAtlas::createTextureAtlases(std::vector<Chart>& charts, mvsUtils::MultiVi
         root->LU.y = 0;
         root->RD.x = _textureSide - 1;
         root->RD.y = _textureSide - 1;
+        root->updateFreeSpace();
 
         const auto insertChart = [&](size_t idx) -> bool {
             Chart& chart = charts[idx];
@@ -310,30 +342,49 @@ void UVAtlas::ChartRect::clear()
     delete child[1];
 }
 
+void UVAtlas::ChartRect::updateFreeSpace()
+{
+    if (!c && !child[0] && !child[1])
+    {
+        // free leaf: the whole rectangle is available
+        maxFreeWidth = RD.x - LU.x;
+        maxFreeHeight = RD.y - LU.y;
+        return;
+    }
+    maxFreeWidth = 0;
+    maxFreeHeight = 0;
+    for (ChartRect* ch : child)
+    {
+        if (!ch)
+            continue;
+        maxFreeWidth = std::max(maxFreeWidth, ch->maxFreeWidth);
+        maxFreeHeight = std::max(maxFreeHeight, ch->maxFreeHeight);
+    }
+}
+
 UVAtlas::ChartRect* UVAtlas::ChartRect::insert(Chart& chart, size_t gutter)
 {
+    const size_t chartWidth = chart.targetWidth() + gutter * 2;
+    const size_t chartHeight = chart.targetHeight() + gutter * 2;
+    // no free rectangle of this subtree is large enough: prune the whole descent
+    if (chartWidth > maxFreeWidth || chartHeight > maxFreeHeight)
+        return nullptr;
     if (child[0] || child[1])  // not a leaf
     {
+        ChartRect* rect = nullptr;
         if (child[0])
-            if (ChartRect* rect = child[0]->insert(chart, gutter))
-                return rect;
-        if (child[1])
-            if (ChartRect* rect = child[1]->insert(chart, gutter))
-                return rect;
-        return nullptr;
+            rect = child[0]->insert(chart, gutter);
+        if (!rect && child[1])
+            rect = child[1]->insert(chart, gutter);
+        if (rect)
+            updateFreeSpace();
+        return rect;
     }
     else
     {
-        size_t chartWidth = chart.targetWidth() + gutter * 2;
-        size_t chartHeight = chart.targetHeight() + gutter * 2;
         // if there is already a chart here
         if (c)
             return nullptr;
-        // not enough space
-        if (chartWidth > (RD.x - LU.x))
-            return nullptr;
-        if (chartHeight > (RD.y - LU.y))
-            return nullptr;
         // split & create children
         if (chartWidth >= chartHeight)
         {
@@ -344,6 +395,7 @@ UVAtlas::ChartRect* UVAtlas::ChartRect::insert(Chart& chart, size_t gutter)
                 child[0]->LU.y = LU.y;
                 child[0]->RD.x = RD.x;
                 child[0]->RD.y = LU.y + chartHeight;
+                child[0]->updateFreeSpace();
             }
             if (chartHeight < (RD.y - LU.y))
             {
@@ -352,6 +404,7 @@ UVAtlas::ChartRect* UVAtlas::ChartRect::insert(Chart& chart, size_t gutter)
                 child[1]->LU.y = LU.y + chartHeight;
                 child[1]->RD.x = RD.x;
                 child[1]->RD.y = RD.y;
+                child[1]->updateFreeSpace();
             }
         }
         else
@@ -363,6 +416,7 @@ UVAtlas::ChartRect* UVAtlas::ChartRect::insert(Chart& chart, size_t gutter)
                 child[0]->LU.y = LU.y + chartHeight;
                 child[0]->RD.x = LU.x + chartWidth;
                 child[0]->RD.y = RD.y;
+                child[0]->updateFreeSpace();
             }
             if (chartWidth < (RD.x - LU.x))
             {
@@ -371,10 +425,12 @@ UVAtlas::ChartRect* UVAtlas::ChartRect::insert(Chart& chart, size_t gutter)
                 child[1]->LU.y = LU.y;
                 child[1]->RD.x = RD.x;
                 child[1]->RD.y = RD.y;
+                child[1]->updateFreeSpace();
             }
         }
         // insert chart
         c = &chart;
+        updateFreeSpace();
         return this;
     }
 }
@@ -52,7 +52,11 @@ class UVAtlas
         ChartRect* child[2]{nullptr, nullptr};
         Pixel LU;
         Pixel RD;
+        size_t maxFreeWidth = 0;   // largest chart width that can still fit somewhere in this subtree
+        size_t maxFreeHeight = 0;  // largest chart height that can still fit somewhere in this subtree
         void clear();
+        /// Recompute the subtree free-space bounds from the children
+        void updateFreeSpace();
         ChartRect* insert(Chart& chart, size_t gutter);
     };
 
@@ -6,6 +6,7 @@
 
 #include "meshVisibility.hpp"
 #include "geoMesh.hpp"
+#include "spatialSort.hpp"
 
 #include <aliceVision/system/Logger.hpp>
 #include <aliceVision/mvsData/geometry.hpp>
@@ -16,6 +17,8 @@
 #include <geogram/mesh/mesh_AABB.h>
 #include <geogram/mesh/mesh_reorder.h>
 
+#include <vector>
+
 namespace aliceVision {
 namespace mesh {
 
@@ -27,9 +30,14 @@ void getNearestVertices(const Mesh& refMesh, const Mesh& mesh, StaticVector<int>
     GEO::AdaptiveKdTree refMesh_kdTree(3);
     refMesh_kdTree.set_points(refMesh.pts.size(), refMesh.pts.front().m);
 
+    // query the tree in spatial order to keep its upper levels in cache
+    std::vector<int> queryOrder;
+    computeSpatialOrder(mesh.pts, queryOrder);
+
 #pragma omp parallel for
-    for (int i = 0; i < mesh.pts.size(); ++i)
+    for (int oi = 0; oi < mesh.pts.size(); ++oi)
     {
+        const int i = queryOrder[oi];
         out_nearestVertex[i] = refMesh_kdTree.get_nearest_neighbor(mesh.pts[i].m);
     }
     ALICEVISION_LOG_DEBUG("getNearestVertices done.");
@@ -47,9 +55,14 @@ void remapMeshVisibilities_pullVerticesVisibility(const Mesh& refMesh, Mesh& mes
 
     out_ptsVisibilities.resize(mesh.pts.size());
 
+    // query the tree in spatial order to keep its upper levels in cache
+    std::vector<int> queryOrder;
+    computeSpatialOrder(mesh.pts, queryOrder);
+
 #pragma omp parallel for
-    for (int i = 0; i < mesh.pts.size(); ++i)
+    for (int oi = 0; oi < mesh.pts.size(); ++oi)
     {
+        const int i = queryOrder[oi];
         PointVisibility& pOut = out_ptsVisibilities[i];
 
         int iRef = refMesh_kdTree.get_nearest_neighbor(mesh.pts[i].m);
@@ -98,9 +111,14 @@ void remapMeshVisibilities_pushVerticesVisibilityToTriangles(const Mesh& refMesh
         out_ptsVisibilities.resize(mesh.pts.size());
     }
 
+    // query the AABB tree in spatial order to keep its upper levels in cache
+    std::vector<int> queryOrder;
+    computeSpatialOrder(refMesh.pts, queryOrder);
+
 #pragma omp parallel for
-    for (int rvi = 0; rvi < refMesh.pts.size(); ++rvi)
+    for (int oi = 0; oi < refMesh.pts.size(); ++oi)
     {
+        const int rvi = queryOrder[oi];
         const PointVisibility& rpVis = refPtsVisibilities[rvi];
         if (rpVis.empty())
             continue;
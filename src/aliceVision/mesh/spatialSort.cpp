@@ -0,0 +1,82 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2025 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "spatialSort.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+namespace aliceVision {
+namespace mesh {
+
+namespace {
+
+/// Spread the lower 21 bits of the input over every 3rd bit of the result.
+uint64_t expandBits3(uint64_t v)
+{
+    v &= 0x1fffff;
+    v = (v | v << 32) & 0x1f00000000ffff;
+    v = (v | v << 16) & 0x1f0000ff0000ff;
+    v = (v | v << 8) & 0x100f00f00f00f00f;
+    v = (v | v << 4) & 0x10c30c30c30c30c3;
+    v = (v | v << 2) & 0x1249249249249249;
+    return v;
+}
+
+/// Shared implementation over a contiguous point buffer.
+void computeSpatialOrderImpl(const Point3d* pts, const int size, std::vector<int>& out_order)
+{
+    out_order.resize(size);
+    std::iota(out_order.begin(), out_order.end(), 0);
+    if (size < 2)
+        return;
+
+    Point3d bbMin = pts[0];
+    Point3d bbMax = pts[0];
+    for (int i = 1; i < size; ++i)
+    {
+        const Point3d& p = pts[i];
+        bbMin.x = std::min(bbMin.x, p.x);
+        bbMin.y = std::min(bbMin.y, p.y);
+        bbMin.z = std::min(bbMin.z, p.z);
+        bbMax.x = std::max(bbMax.x, p.x);
+        bbMax.y = std::max(bbMax.y, p.y);
+        bbMax.z = std::max(bbMax.z, p.z);
+    }
+    const Point3d extent = bbMax - bbMin;
+    const double maxCoord = 2097151.0;  // 21 bits per axis
+    const double sx = (extent.x > 0.0) ? maxCoord / extent.x : 0.0;
+    const double sy = (extent.y > 0.0) ? maxCoord / extent.y : 0.0;
+    const double sz = (extent.z > 0.0) ? maxCoord / extent.z : 0.0;
+
+    std::vector<uint64_t> codes(size);
+#pragma omp parallel for
+    for (int i = 0; i < size; ++i)
+    {
+        const Point3d& p = pts[i];
+        const uint64_t cx = static_cast<uint64_t>((p.x - bbMin.x) * sx);
+        const uint64_t cy = static_cast<uint64_t>((p.y - bbMin.y) * sy);
+        const uint64_t cz = static_cast<uint64_t>((p.z - bbMin.z) * sz);
+        codes[i] = expandBits3(cx) | (expandBits3(cy) << 1) | (expandBits3(cz) << 2);
+    }
+    std::sort(out_order.begin(), out_order.end(), [&codes](int a, int b) { return codes[a] < codes[b]; });
+}
+
+}  // namespace
+
+void computeSpatialOrder(const StaticVector<Point3d>& pts, std::vector<int>& out_order)
+{
+    computeSpatialOrderImpl(pts.empty() ? nullptr : &pts[0], pts.size(), out_order);
+}
+
+void computeSpatialOrder(const std::vector<Point3d>& pts, std::vector<int>& out_order)
+{
+    computeSpatialOrderImpl(pts.data(), static_cast<int>(pts.size()), out_order);
+}
+
+}  // namespace mesh
+}  // namespace aliceVision
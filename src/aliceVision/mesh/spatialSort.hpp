@@ -0,0 +1,34 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2025 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <aliceVision/mvsData/Point3d.hpp>
+#include <aliceVision/mvsData/StaticVector.hpp>
+
+#include <vector>
+
+namespace aliceVision {
+namespace mesh {
+
+/**
+ * @brief Order of the given points along a Morton space-filling curve.
+ *
+ * Processing points in this order makes consecutive iterations touch
+ * spatially close data: tree descents traverse mostly the same nodes and
+ * neighborhood gathers hit recently accessed vertices, so the working set
+ * stays in cache instead of being re-fetched for every point.
+ *
+ * @param[in] pts the points to order
+ * @param[out] out_order point indices sorted by Morton code
+ */
+void computeSpatialOrder(const StaticVector<Point3d>& pts, std::vector<int>& out_order);
+
+/// @overload
+void computeSpatialOrder(const std::vector<Point3d>& pts, std::vector<int>& out_order);
+
+}  // namespace mesh
+}  // namespace aliceVision
@@ -31,6 +31,24 @@ struct FundamentalSampsonError : public ISolverErrorRelativePose<robustEstimatio
 
         return Square(y.dot(F_x)) / (F_x.head<2>().squaredNorm() + Ft_y.head<2>().squaredNorm());
     }
+
+    /// Batched evaluation over all the correspondences at once, picked up by the kernels' errors()
+    void errors(const robustEstimation::Mat3Model& F, const Mat& x1, const Mat& x2, std::vector<double>& out) const
+    {
+        const Mat3& Fm = F.getMatrix();
+        const Mat::Index n = x1.cols();
+        out.resize(n);
+
+        // F * [x; 1] and F^T * [y; 1] for all the correspondences in one pass
+        const Mat3X F_x = (Fm.leftCols<2>() * x1).colwise() + Fm.col(2);
+        const Mat3X Ft_y = (Fm.topRows<2>().transpose() * x2).colwise() + Fm.row(2).transpose();
+
+        const Eigen::ArrayXd yFx = (F_x.topRows<2>().cwiseProduct(x2)).colwise().sum().transpose().array() + F_x.row(2).transpose().array();
+        const Eigen::ArrayXd dF_x = F_x.topRows<2>().colwise().squaredNorm().transpose().array();
+        const Eigen::ArrayXd dFt_y = Ft_y.topRows<2>().colwise().squaredNorm().transpose().array();
+
+        Eigen::Map<Eigen::ArrayXd>(out.data(), n) = yFx.square() / (dF_x + dFt_y);
+    }
 };
 
 struct FundamentalSymmetricEpipolarDistanceError : public ISolverErrorRelativePose<robustEstimation::Mat3Model>
@@ -47,6 +65,23 @@ struct FundamentalSymmetricEpipolarDistanceError : public ISolverErrorRelativePo
         // @note the divide by 4 is to make this match the Sampson distance.
         return Square(y.dot(F_x)) * (1.0 / F_x.head<2>().squaredNorm() + 1.0 / Ft_y.head<2>().squaredNorm()) / 4.0;
     }
+
+    /// Batched evaluation over all the correspondences at once, picked up by the kernels' errors()
+    void errors(const robustEstimation::Mat3Model& F, const Mat& x1, const Mat& x2, std::vector<double>& out) const
+    {
+        const Mat3& Fm = F.getMatrix();
+        const Mat::Index n = x1.cols();
+        out.resize(n);
+
+        const Mat3X F_x = (Fm.leftCols<2>() * x1).colwise() + Fm.col(2);
+        const Mat3X Ft_y = (Fm.topRows<2>().transpose() * x2).colwise() + Fm.row(2).transpose();
+
+        const Eigen::ArrayXd yFx = (F_x.topRows<2>().cwiseProduct(x2)).colwise().sum().transpose().array() + F_x.row(2).transpose().array();
+        const Eigen::ArrayXd dF_x = F_x.topRows<2>().colwise().squaredNorm().transpose().array();
+        const Eigen::ArrayXd dFt_y = Ft_y.topRows<2>().colwise().squaredNorm().transpose().array();
+
+        Eigen::Map<Eigen::ArrayXd>(out.data(), n) = yFx.square() * (dF_x.inverse() + dFt_y.inverse()) / 4.0;
+    }
 };
 
 struct FundamentalEpipolarDistanceError : public ISolverErrorRelativePose<robustEstimation::Mat3Model>
@@ -61,6 +96,21 @@ struct FundamentalEpipolarDistanceError : public ISolverErrorRelativePose<robust
 
         return Square(F_x.dot(y)) / F_x.head<2>().squaredNorm();
     }
+
+    /// Batched evaluation over all the correspondences at once, picked up by the kernels' errors()
+    void errors(const robustEstimation::Mat3Model& F, const Mat& x1, const Mat& x2, std::vector<double>& out) const
+    {
+        const Mat3& Fm = F.getMatrix();
+        const Mat::Index n = x1.cols();
+        out.resize(n);
+
+        const Mat3X F_x = (Fm.leftCols<2>() * x1).colwise() + Fm.col(2);
+
+        const Eigen::ArrayXd yFx = (F_x.topRows<2>().cwiseProduct(x2)).colwise().sum().transpose().array() + F_x.row(2).transpose().array();
+        const Eigen::ArrayXd dF_x = F_x.topRows<2>().colwise().squaredNorm().transpose().array();
+
+        Eigen::Map<Eigen::ArrayXd>(out.data(), n) = yFx.square() / dF_x;
+    }
 };
 
 struct EpipolarSphericalDistanceError
@@ -19,7 +19,7 @@ namespace resection {
  */
 struct P4PfModel
 {
-    P4PfModel(Mat R, Vec3 t, double f)
+    P4PfModel(const Mat3& R, const Vec3& t, double f)
       : _R(R),
         _t(t),
         _f(f)
@@ -28,7 +28,7 @@ struct P4PfModel
     Mat34 getP() const
     {
         Mat34 P;
-        Mat K = Mat(3, 3);
+        Mat3 K;
 
         K << _f, 0, 0, 0, _f, 0, 0, 0, 1;
 
@@ -39,7 +39,7 @@ struct P4PfModel
     }
 
     /// rotation matrix
-    Mat _R;
+    Mat3 _R;
     /// translation vector
     Vec3 _t;
     /// focal length
@@ -8,6 +8,8 @@
 #include "l1.hpp"
 #include <aliceVision/system/Logger.hpp>
 
+#include <Eigen/SparseCholesky>
+
 #ifdef ALICEVISION_ROTATION_AVERAGING_WITH_BOOST
     #include <boost/graph/adjacency_list.hpp>
     #include <boost/graph/kruskal_min_spanning_tree.hpp>
@@ -43,6 +45,55 @@ namespace aliceVision {
 namespace rotationAveraging {
 namespace l1 {
 
+// Weighted normal equations solver shared by the robust regressions below:
+// it factorizes At * diag(w) * A and solves it against arbitrary right-hand sides.
+// The generic version runs a dense Cholesky; the sparse specialization keeps the
+// normal matrix sparse and reuses the symbolic analysis between factorizations,
+// as the weights change at every iteration but the sparsity pattern does not.
+// This is what makes the L1RA/IRLS stages tractable on large view graphs: the
+// dense factorization is cubic in the number of unknowns (3 per camera), while
+// the sparse one only depends on the connectivity of the view graph.
+template<typename MATRIX_TYPE>
+class TWeightedNormalEquationSolver
+{
+  public:
+    bool factorize(const MATRIX_TYPE& A, const MATRIX_TYPE& At, const Eigen::Matrix<REAL, Eigen::Dynamic, 1>& w)
+    {
+        _solver.compute(At * (w.asDiagonal() * A));
+        return _solver.info() == Eigen::Success;
+    }
+
+    Eigen::Matrix<REAL, Eigen::Dynamic, 1> solve(const Eigen::Matrix<REAL, Eigen::Dynamic, 1>& rhs) const { return _solver.solve(rhs); }
+
+  private:
+    Eigen::LDLT<Eigen::Matrix<REAL, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> _solver;
+};
+
+template<>
+class TWeightedNormalEquationSolver<Eigen::SparseMatrix<REAL, Eigen::ColMajor>>
+{
+  public:
+    bool factorize(const Eigen::SparseMatrix<REAL, Eigen::ColMajor>& A,
+                   const Eigen::SparseMatrix<REAL, Eigen::ColMajor>& At,
+                   const Eigen::Matrix<REAL, Eigen::Dynamic, 1>& w)
+    {
+        const Eigen::SparseMatrix<REAL, Eigen::ColMajor> AtWA(At * (w.asDiagonal() * A));
+        if (!_patternAnalyzed)
+        {
+            _solver.analyzePattern(AtWA);
+            _patternAnalyzed = true;
+        }
+        _solver.factorize(AtWA);
+        return _solver.info() == Eigen::Success;
+    }
+
+    Eigen::Matrix<REAL, Eigen::Dynamic, 1> solve(const Eigen::Matrix<REAL, Eigen::Dynamic, 1>& rhs) const { return _solver.solve(rhs); }
+
+  private:
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<REAL, Eigen::ColMajor>> _solver;
+    bool _patternAnalyzed = false;
+};
+
 // Minimum l1 error approximation:
 //
 // Let A be a M x N matrix with full rank. Given y of R^M, the problem
@@ -66,7 +117,6 @@ inline bool TRobustRegressionL1PD(const MATRIX_TYPE& A,
                                   REAL pdtol,
                                   unsigned pdmaxiter)
 {
-    typedef Eigen::Matrix<REAL, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> Matrix;
     typedef Eigen::Matrix<REAL, Eigen::Dynamic, 1> Vector;
     const unsigned M = (unsigned)y.size();
     const unsigned N = (unsigned)xp.size();
@@ -100,7 +150,7 @@ inline bool TRobustRegressionL1PD(const MATRIX_TYPE& A,
     Vector w2(M), sig1(M), sig2(M), sigx(M), dx(N), up(N), Atdv(N);
     Vector Axp(M), Atvp(M);
     Vector &Adx(sigx), &du(w2), &w1p(dx);
-    Matrix H11p(N, N);
+    TWeightedNormalEquationSolver<MATRIX_TYPE> normalSolver;
     Vector &dlamu1(tmpM3), &dlamu2(tmpM4);
     for (unsigned pditer = 0; pditer < pdmaxiter; ++pditer)
     {
@@ -129,11 +179,16 @@ inline bool TRobustRegressionL1PD(const MATRIX_TYPE& A,
         sig2 = tmpM1 - tmpM2;
         sigx = sig1 - sig2.cwiseAbs2().cwiseQuotient(sig1);
 
-        H11p = At * (Eigen::DiagonalMatrix<REAL, Eigen::Dynamic>(sigx) * A);
         w1p = At * (tmpM4 - tmpM3 - (sig2.cwiseQuotient(sig1).cwiseProduct(w2)));
 
-        // optimized solver as A is positive definite and symmetric
-        dx = H11p.ldlt().solve(w1p);
+        // optimized solver as the normal matrix At * diag(sigx) * A is positive definite and symmetric
+        if (!normalSolver.factorize(A, At, sigx))
+        {
+            ALICEVISION_LOG_WARNING("error: decomposing linear system failed");
+            xp.swap(x);
+            return false;
+        }
+        dx = normalSolver.solve(w1p);
 
         Adx = A * dx;
 
@@ -248,12 +303,14 @@ inline bool TIterativelyReweightedLeastSquares(const MATRIX_TYPE& A,
                                                REAL sigma,
                                                REAL eps)
 {
-    typedef Eigen::Matrix<REAL, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> Matrix;
     typedef Eigen::Matrix<REAL, Eigen::Dynamic, 1> Vector;
     const unsigned m = (unsigned)b.size();
     const unsigned n = (unsigned)x.size();
     assert(A.rows() == m && A.cols() == n);
 
+    const MATRIX_TYPE At(A.transpose());
+    TWeightedNormalEquationSolver<MATRIX_TYPE> solver;
+
     // iterate optimization till the desired precision is reached
     Vector xp(n), e(m);
     const REAL sigmaSq(Square(sigma));
@@ -264,27 +321,20 @@ inline bool TIterativelyReweightedLeastSquares(const MATRIX_TYPE& A,
         xp = x;
         // compute error vector
         e = A * x - b;
-        // compute robust errors using the Huber-like loss function
+        // compute robust weights using the Huber-like loss function
         for (unsigned i = 0; i < m; ++i)
         {
             REAL& err = e(i);
             const REAL errSq(Square(err));
             err = sigmaSq / (errSq + sigmaSq);
         }
-        // solve the linear system using l2 norm
-        const MATRIX_TYPE AtF(A.transpose() * e.asDiagonal());
-        const Eigen::LDLT<Matrix> solver(AtF * A);  // compute the Cholesky decomposition
-        if (solver.info() != Eigen::Success)
+        // solve the weighted linear system (At * diag(e) * A) x = At * diag(e) * b using l2 norm
+        if (!solver.factorize(A, At, e))
         {
             ALICEVISION_LOG_WARNING("error: decomposing linear system failed");
             return false;
         }
-        x = solver.solve(AtF * b);
-        if (solver.info() != Eigen::Success)
-        {
-            ALICEVISION_LOG_WARNING("error: solving linear system failed");
-            return false;
-        }
+        x = solver.solve(At * e.cwiseProduct(b));
         if (++iter > 32)
             break;
         deltap = delta;
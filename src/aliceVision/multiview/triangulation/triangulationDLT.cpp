@@ -34,6 +34,88 @@ void TriangulateDLT(const Mat34& P1, const Vec2& x1, const Mat34& P2, const Vec2
     homogeneousToEuclidean(X_homogeneous, X_euclidean);
 }
 
+void TriangulateDLTBatch(const Mat34& P1, const Mat& x1, const Mat34& P2, const Mat& x2, std::vector<Vec3>& X)
+{
+    assert(x1.cols() == x2.cols());
+    X.resize(x1.cols());
+
+    // fixed-size stack matrices, reused for every point
+    Mat4 design;
+    Vec4 X_homogeneous;
+
+    for (Mat::Index k = 0; k < x1.cols(); ++k)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            design(0, i) = x1(0, k) * P1(2, i) - P1(0, i);
+            design(1, i) = x1(1, k) * P1(2, i) - P1(1, i);
+            design(2, i) = x2(0, k) * P2(2, i) - P2(0, i);
+            design(3, i) = x2(1, k) * P2(2, i) - P2(1, i);
+        }
+        Nullspace(design, X_homogeneous);
+        homogeneousToEuclidean(X_homogeneous, X[k]);
+    }
+}
+
+void TriangulateMidpointBatch(const Mat3& K1,
+                              const Mat3& R1,
+                              const Vec3& t1,
+                              const Mat3& K2,
+                              const Mat3& R2,
+                              const Vec3& t2,
+                              const Mat& x1,
+                              const Mat& x2,
+                              std::vector<Vec3>& X)
+{
+    assert(x1.cols() == x2.cols());
+    X.resize(x1.cols());
+
+    // shared pose data, computed once for the whole batch
+    const Mat3 rayMat1 = R1.transpose() * K1.inverse();
+    const Mat3 rayMat2 = R2.transpose() * K2.inverse();
+    const Vec3 C1 = -R1.transpose() * t1;  // first camera center
+    const Vec3 C2 = -R2.transpose() * t2;  // second camera center
+    const Vec3 baseline = C1 - C2;
+
+    // projection matrices, only needed on the degenerate fallback path
+    Mat34 P1, P2;
+    bool projectionsComputed = false;
+
+    for (Mat::Index k = 0; k < x1.cols(); ++k)
+    {
+        // back-projected ray directions in world coordinates
+        const Vec3 d1 = rayMat1 * Vec3(x1(0, k), x1(1, k), 1.0);
+        const Vec3 d2 = rayMat2 * Vec3(x2(0, k), x2(1, k), 1.0);
+
+        // closest point between the two rays: solve the 2x2 normal equations
+        // of min |(C1 + s1 d1) - (C2 + s2 d2)|^2
+        const double a = d1.dot(d1);
+        const double b = d1.dot(d2);
+        const double c = d2.dot(d2);
+        const double d = d1.dot(baseline);
+        const double e = d2.dot(baseline);
+        const double denominator = a * c - b * b;
+
+        if (denominator > 1e-12 * a * c)
+        {
+            const double s1 = (b * e - c * d) / denominator;
+            const double s2 = (a * e - b * d) / denominator;
+            X[k] = 0.5 * ((C1 + s1 * d1) + (C2 + s2 * d2));
+        }
+        else
+        {
+            // (near-)parallel rays, the normal equations are ill-conditioned
+            if (!projectionsComputed)
+            {
+                P_from_KRt(K1, R1, t1, P1);
+                P_from_KRt(K2, R2, t2, P2);
+                projectionsComputed = true;
+            }
+            TriangulateDLT(P1, Vec2(x1(0, k), x1(1, k)), P2, Vec2(x2(0, k), x2(1, k)), X[k]);
+        }
+    }
+}
+
 // Solve:
 // [cross(x0,P0) X = 0]
 // [cross(x1,P1) X = 0]
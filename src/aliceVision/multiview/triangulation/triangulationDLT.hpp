@@ -10,6 +10,8 @@
 
 #include <aliceVision/numeric/numeric.hpp>
 
+#include <vector>
+
 namespace aliceVision {
 namespace multiview {
 
@@ -35,6 +37,44 @@ void TriangulateDLT(const Mat34& P1, const Vec2& x1, const Mat34& P2, const Vec2
  */
 void TriangulateDLT(const Mat34& P1, const Vec2& x1, const Mat34& P2, const Vec2& x2, Vec3& X_euclidean);
 
+/**
+ * Triangulate a batch of correspondences sharing the same pair of projection matrices.
+ * Equivalent to calling TriangulateDLT on every column of x1/x2, but reuses the
+ * fixed-size design matrix instead of paying the per-call setup for each point.
+ * @param P1 a projection matrix K (R | t)
+ * @param x1 the 2d observations in the first view (one column per point)
+ * @param P2 a projection matrix K (R | t)
+ * @param x2 the 2d observations in the second view (one column per point)
+ * @param X the triangulated 3d points (resized to the number of columns)
+ */
+void TriangulateDLTBatch(const Mat34& P1, const Mat& x1, const Mat34& P2, const Mat& x2, std::vector<Vec3>& X);
+
+/**
+ * Triangulate a batch of correspondences sharing the same pair of poses with the
+ * midpoint method (closest point between the two back-projected rays).
+ * SVD-free: each point costs a few dot products, which makes it well suited to
+ * cheirality votes and scoring passes that do not need a refined 3d point.
+ * Falls back to TriangulateDLT for (near-)parallel rays.
+ * @param K1 calibration of the first view
+ * @param R1 rotation of the first view (x = K (R X + t))
+ * @param t1 translation of the first view
+ * @param K2 calibration of the second view
+ * @param R2 rotation of the second view
+ * @param t2 translation of the second view
+ * @param x1 the 2d observations in the first view (one column per point)
+ * @param x2 the 2d observations in the second view (one column per point)
+ * @param X the triangulated 3d points (resized to the number of columns)
+ */
+void TriangulateMidpointBatch(const Mat3& K1,
+                              const Mat3& R1,
+                              const Vec3& t1,
+                              const Mat3& K2,
+                              const Mat3& R2,
+                              const Vec3& t2,
+                              const Mat& x1,
+                              const Mat& x2,
+                              std::vector<Vec3>& X);
+
 /**
  * Triangulate a point given a set of bearing vectors
  * and associated projection matrices (in meters)
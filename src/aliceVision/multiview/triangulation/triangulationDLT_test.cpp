@@ -32,3 +32,33 @@ BOOST_AUTO_TEST_CASE(Triangulation_TriangulateDLT)
         BOOST_CHECK_SMALL(DistanceLInfinity(X_estimated, X_gt), 1e-8);
     }
 }
+
+BOOST_AUTO_TEST_CASE(Triangulation_TriangulateDLTBatch)
+{
+    NViewDataSet d = NRealisticCamerasRing(2, 12);
+
+    std::vector<Vec3> X_estimated;
+    multiview::TriangulateDLTBatch(d.P(0), d._x[0], d.P(1), d._x[1], X_estimated);
+
+    BOOST_CHECK_EQUAL(X_estimated.size(), d._X.cols());
+    for (int i = 0; i < d._X.cols(); ++i)
+    {
+        Vec3 X_gt = d._X.col(i);
+        BOOST_CHECK_SMALL(DistanceLInfinity(X_estimated[i], X_gt), 1e-8);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Triangulation_TriangulateMidpointBatch)
+{
+    NViewDataSet d = NRealisticCamerasRing(2, 12);
+
+    std::vector<Vec3> X_estimated;
+    multiview::TriangulateMidpointBatch(d._K[0], d._R[0], d._t[0], d._K[1], d._R[1], d._t[1], d._x[0], d._x[1], X_estimated);
+
+    BOOST_CHECK_EQUAL(X_estimated.size(), d._X.cols());
+    for (int i = 0; i < d._X.cols(); ++i)
+    {
+        Vec3 X_gt = d._X.col(i);
+        BOOST_CHECK_SMALL(DistanceLInfinity(X_estimated[i], X_gt), 1e-8);
+    }
+}
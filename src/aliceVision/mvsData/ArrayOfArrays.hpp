@@ -0,0 +1,117 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace aliceVision {
+
+/**
+ * @brief Arena-backed array of variable-length arrays.
+ *
+ * Alternative to StaticVector<StaticVector<T>> for very large collections of small lists
+ * (per-pixel or per-vertex lists in meshing): all inner arrays share a single slab of
+ * memory addressed through an offset table, so building N lists costs two allocations
+ * instead of N and does not fragment the heap.
+ *
+ * The container is append-only: inner arrays are added in order with addArray() and
+ * cannot grow afterwards.
+ */
+template<class T>
+class ArrayOfArrays
+{
+    /// single slab shared by all inner arrays
+    std::vector<T> _data;
+    /// inner array i spans [_offsets[i], _offsets[i + 1]) in the slab
+    std::vector<std::size_t> _offsets;
+
+  public:
+    ArrayOfArrays() { _offsets.push_back(0); }
+
+    /**
+     * @brief Pre-allocate the offset table and the slab.
+     * @param[in] nbArrays the planned number of inner arrays
+     * @param[in] nbTotalElements the planned total number of elements over all inner arrays
+     */
+    void reserve(std::size_t nbArrays, std::size_t nbTotalElements)
+    {
+        _offsets.reserve(nbArrays + 1);
+        _data.reserve(nbTotalElements);
+    }
+
+    /**
+     * @brief Append an inner array with the given elements.
+     */
+    template<class Iterator>
+    void addArray(Iterator first, Iterator last)
+    {
+        _data.insert(_data.end(), first, last);
+        _offsets.push_back(_data.size());
+    }
+
+    /**
+     * @brief Append an empty inner array.
+     */
+    void addEmptyArray() { _offsets.push_back(_data.size()); }
+
+    /// number of inner arrays
+    std::size_t size() const { return _offsets.size() - 1; }
+
+    bool empty() const { return size() == 0; }
+
+    /// total number of elements over all inner arrays
+    std::size_t totalSize() const { return _data.size(); }
+
+    /// number of elements of the inner array with the given index
+    std::size_t sizeAt(std::size_t index) const
+    {
+        assert(index < size());
+        return _offsets[index + 1] - _offsets[index];
+    }
+
+    const T* begin(std::size_t index) const
+    {
+        assert(index < size());
+        return _data.data() + _offsets[index];
+    }
+
+    const T* end(std::size_t index) const
+    {
+        assert(index < size());
+        return _data.data() + _offsets[index + 1];
+    }
+
+    /// element access: j-th element of the inner array with index i
+    const T& operator()(std::size_t i, std::size_t j) const
+    {
+        assert(j < sizeAt(i));
+        return _data[_offsets[i] + j];
+    }
+
+    T& operator()(std::size_t i, std::size_t j)
+    {
+        assert(j < sizeAt(i));
+        return _data[_offsets[i] + j];
+    }
+
+    void clear()
+    {
+        _data.clear();
+        _offsets.clear();
+        _offsets.push_back(0);
+    }
+
+    void swap(ArrayOfArrays& other)
+    {
+        _data.swap(other._data);
+        _offsets.swap(other._offsets);
+    }
+};
+
+}  // namespace aliceVision
@@ -7,8 +7,17 @@
 #include "ImagesCache.hpp"
 #include <aliceVision/mvsUtils/common.hpp>
 #include <aliceVision/mvsUtils/fileIO.hpp>
+#include <aliceVision/system/MemoryInfo.hpp>
+#include <aliceVision/system/MemoryMappedFile.hpp>
+#include <aliceVision/utils/filesIO.hpp>
 
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
 #include <future>
+#include <sstream>
 
 namespace aliceVision {
 namespace mvsUtils {
@@ -57,6 +66,17 @@ void ImagesCache<Image>::initIC(std::vector<std::string>& imagesNames)
 {
     float oneimagemb = (sizeof(Color) * _mp.getMaxImageWidth() * _mp.getMaxImageHeight()) / 1024.f / 1024.f;
     float maxmbCPU = (float)_mp.userParams.get<int>("images_cache.maxmbCPU", 5000);
+
+    // do not let the fixed budget exceed half of the memory actually available right now,
+    // so the cache adapts when other jobs share the node instead of pushing it into swap
+    const float availablemb = system::getMemoryInfo().availableRam / 1024.f / 1024.f;
+    if (availablemb > 0.f && maxmbCPU > 0.5f * availablemb)
+    {
+        ALICEVISION_LOG_INFO("Images cache budget reduced from " << maxmbCPU << " MB to " << 0.5f * availablemb
+                                                                 << " MB regarding the available memory.");
+        maxmbCPU = 0.5f * availablemb;
+    }
+
     int npreload = std::max((int)(maxmbCPU / oneimagemb), 5);  // image cache has a minimum size of 5
     npreload = std::min(_mp.ncams, npreload);
 
@@ -68,6 +88,10 @@ void ImagesCache<Image>::initIC(std::vector<std::string>& imagesNames)
     _camIdMapId.resize(_mp.ncams, -1);
     setCacheSize(npreload);
 
+    const std::string sharedCacheFolder = _mp.userParams.get<std::string>("images_cache.sharedCacheFolder", "");
+    if (!sharedCacheFolder.empty())
+        setSharedCacheFolder(sharedCacheFolder);
+
     {
         // Cannot resize the vector<mutex> directly, as mutex class is not move-constructible.
         // imagesMutexes.resize(mp->ncams); // cannot compile
@@ -115,7 +139,23 @@ void ImagesCache<Image>::refreshData(int camId)
         }
 
         const std::string imagePath = _imagesNames.at(camId);
-        loadImage(imagePath, _mp, camId, *(_imgs[mapId]), _colorspace, _correctEV);
+
+        if (_sharedCacheFolder.empty())
+        {
+            loadImage(imagePath, _mp, camId, *(_imgs[mapId]), _colorspace, _correctEV);
+        }
+        else
+        {
+            // shared cache mode: decoded pixel data is exchanged with concurrent processes
+            // through memory-mapped files in the shared folder (backed by the OS page cache)
+            const std::string entryPath = getSharedCacheEntryPath(camId);
+
+            if (!readImageFromSharedCache(entryPath, *(_imgs[mapId])))
+            {
+                loadImage(imagePath, _mp, camId, *(_imgs[mapId]), _colorspace, _correctEV);
+                writeImageToSharedCache(entryPath, *(_imgs[mapId]));
+            }
+        }
 
         ALICEVISION_LOG_DEBUG("Add " << imagePath << " to image cache. " << formatElapsedTime(t1));
     }
@@ -151,6 +191,88 @@ void ImagesCache<Image>::refreshImages_async(const std::vector<int>& camIds)
     _asyncObjects.emplace_back(std::async(std::launch::async, &ImagesCache<Image>::refreshImages_sync, this, camIds));
 }
 
+template<typename Image>
+std::string ImagesCache<Image>::getSharedCacheEntryPath(int camId) const
+{
+    const std::string& imagePath = _imagesNames.at(camId);
+
+    // the key identifies the decoded pixel data:
+    // source image (path and modification time), process downscale, colorspace, exposure correction and pixel type
+    std::stringstream key;
+    key << imagePath << "#" << utils::getLastWriteTime(imagePath) << "#" << _mp.getProcessDownscale() << "#" << int(_colorspace) << "#"
+        << int(_correctEV) << "#" << sizeof(Color);
+
+    std::stringstream entryPath;
+    entryPath << _sharedCacheFolder << "/" << std::hex << std::hash<std::string>{}(key.str()) << ".avpix";
+    return entryPath.str();
+}
+
+template<typename Image>
+bool ImagesCache<Image>::readImageFromSharedCache(const std::string& entryPath, Image& img) const
+{
+    system::MemoryMappedFile file;
+    if (!file.open(entryPath))
+        return false;
+
+    // entry header: width and height of the decoded image
+    std::uint32_t header[2];
+    if (file.size() < sizeof(header))
+        return false;
+    std::memcpy(header, file.data(), sizeof(header));
+
+    const std::size_t width = header[0];
+    const std::size_t height = header[1];
+    const std::size_t pixelsBytes = width * height * sizeof(Color);
+
+    if (width == 0 || height == 0 || file.size() != sizeof(header) + pixelsBytes)
+        return false;  // invalid entry
+
+    img.resize(int(width), int(height), false);
+    std::memcpy(img.data(), file.data() + sizeof(header), pixelsBytes);
+
+    ALICEVISION_LOG_DEBUG("Read decoded image from shared cache entry: " << entryPath);
+    return true;
+}
+
+template<typename Image>
+void ImagesCache<Image>::writeImageToSharedCache(const std::string& entryPath, const Image& img) const
+{
+    std::error_code ec;
+    std::filesystem::create_directories(_sharedCacheFolder, ec);
+
+    // write to a process-unique temporary file first and rename it afterwards,
+    // so a concurrent process can never map a partially written entry
+    const std::string tmpPath = entryPath + "." + utils::generateUniqueFilename() + ".tmp";
+
+    {
+        std::ofstream file(tmpPath, std::ios::binary);
+        if (!file.is_open())
+        {
+            // the shared cache is an optimization, failures are non-fatal
+            ALICEVISION_LOG_WARNING("Cannot create shared cache entry (path: " << entryPath << ").");
+            return;
+        }
+
+        const std::uint32_t header[2] = {std::uint32_t(img.width()), std::uint32_t(img.height())};
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(img.data()), img.width() * img.height() * sizeof(Color));
+
+        if (!file)
+        {
+            ALICEVISION_LOG_WARNING("Cannot write shared cache entry (path: " << entryPath << ").");
+            file.close();
+            std::filesystem::remove(tmpPath, ec);
+            return;
+        }
+    }
+
+    std::filesystem::rename(tmpPath, entryPath, ec);
+    if (ec)
+        std::filesystem::remove(tmpPath, ec);
+    else
+        ALICEVISION_LOG_DEBUG("Published decoded image to shared cache entry: " << entryPath);
+}
+
 template class ImagesCache<image::Image<image::RGBfColor>>;
 template class ImagesCache<image::Image<image::RGBAfColor>>;
 
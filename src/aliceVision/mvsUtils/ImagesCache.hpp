@@ -55,6 +55,16 @@ class ImagesCache
 
     image::EImageColorSpace _colorspace{image::EImageColorSpace::AUTO};
     ECorrectEV _correctEV{ECorrectEV::NO_CORRECTION};
+    std::string _sharedCacheFolder;
+
+    /// shared cache entry path for the given camera, keyed by the decoded pixel data parameters
+    std::string getSharedCacheEntryPath(int camId) const;
+
+    /// try to fill the image from a memory-mapped shared cache entry, returns false if the entry is missing or invalid
+    bool readImageFromSharedCache(const std::string& entryPath, Image& img) const;
+
+    /// publish the decoded image as a shared cache entry (atomic rename, failures are non-fatal)
+    void writeImageToSharedCache(const std::string& entryPath, const Image& img) const;
 
   public:
     ImagesCache(const MultiViewParams& mp, image::EImageColorSpace colorspace, ECorrectEV correctEV = ECorrectEV::NO_CORRECTION);
@@ -67,6 +77,19 @@ class ImagesCache
     void initIC(std::vector<std::string>& imagesNames);
     void setCacheSize(int nbPreload);
     void setCorrectEV(const ECorrectEV correctEV) { _correctEV = correctEV; }
+
+    /**
+     * @brief Back cache entries with memory-mapped files in the given shared folder.
+     *
+     * Decoded pixel data is published as files keyed by (image, modification time, downscale,
+     * colorspace, exposure correction, pixel type), so concurrent AliceVision processes working
+     * on the same images share the decoding cost through the OS page cache instead of each
+     * decoding the same files. Can also be enabled with the 'images_cache.sharedCacheFolder'
+     * user parameter.
+     *
+     * @param[in] folder the shared cache folder (common to all processes)
+     */
+    void setSharedCacheFolder(const std::string& folder) { _sharedCacheFolder = folder; }
     ~ImagesCache() = default;
 
     inline ImgSharedPtr getImg_sync(int camId)
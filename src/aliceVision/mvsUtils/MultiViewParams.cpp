@@ -512,6 +512,53 @@ void MultiViewParams::decomposeProjectionMatrix(Point3d& Co,
     iPo = iRo * iKo;
 }
 
+const std::vector<MultiViewParams::LandmarkVisibility>& MultiViewParams::getVisibleLandmarks(int rc) const
+{
+    std::lock_guard<std::mutex> lock(_visibleLandmarksMutex);
+
+    if (_visibleLandmarksPerCam.empty())
+    {
+        _visibleLandmarksPerCam.resize(getNbCameras());
+
+        // flat landmark list for parallel iteration
+        std::vector<const sfmData::Landmark*> landmarks;
+        landmarks.reserve(_sfmData.getLandmarks().size());
+        for (const auto& landmarkPair : _sfmData.getLandmarks())
+            landmarks.push_back(&landmarkPair.second);
+
+#pragma omp parallel
+        {
+            // per-thread per-camera buffers, merged under a critical section
+            std::vector<std::vector<LandmarkVisibility>> threadVisibleLandmarksPerCam(getNbCameras());
+
+#pragma omp for nowait
+            for (int i = 0; i < static_cast<int>(landmarks.size()); ++i)
+            {
+                const sfmData::Landmark* landmark = landmarks[i];
+
+                for (const auto& observationPair : landmark->getObservations())
+                {
+                    const auto camIdIt = _imageIdsPerViewId.find(observationPair.first);
+                    if (camIdIt == _imageIdsPerViewId.end())
+                        continue;
+
+                    threadVisibleLandmarksPerCam[camIdIt->second].push_back({landmark, &observationPair.second});
+                }
+            }
+
+#pragma omp critical
+            for (int camId = 0; camId < getNbCameras(); ++camId)
+            {
+                auto& visibleLandmarks = _visibleLandmarksPerCam[camId];
+                visibleLandmarks.insert(
+                  visibleLandmarks.end(), threadVisibleLandmarksPerCam[camId].begin(), threadVisibleLandmarksPerCam[camId].end());
+            }
+        }
+    }
+
+    return _visibleLandmarksPerCam.at(rc);
+}
+
 StaticVector<int> MultiViewParams::findNearestCamsFromLandmarks(int rc, int nbNearestCams) const
 {
     StaticVector<int> out;
@@ -526,13 +573,10 @@ StaticVector<int> MultiViewParams::findNearestCamsFromLandmarks(int rc, int nbNe
     const geometry::Pose3 pose = _sfmData.getPose(view).getTransform();
     const camera::IntrinsicBase* intrinsicPtr = _sfmData.getIntrinsicPtr(view.getIntrinsicId());
 
-    for (const auto& landmarkPair : _sfmData.getLandmarks())
+    for (const LandmarkVisibility& visibility : getVisibleLandmarks(rc))
     {
-        const auto& observations = landmarkPair.second.getObservations();
-
-        auto viewObsIt = observations.find(viewId);
-        if (viewObsIt == observations.end())
-            continue;
+        const auto& observations = visibility.landmark->getObservations();
+        const sfmData::Observation& rcObservation = *(visibility.observation);
 
         for (const auto& observationPair : observations)
         {
@@ -546,7 +590,7 @@ StaticVector<int> MultiViewParams::findNearestCamsFromLandmarks(int rc, int nbNe
             const camera::IntrinsicBase* otherIntrinsicPtr = _sfmData.getIntrinsicPtr(otherView.getIntrinsicId());
 
             const double angle = camera::angleBetweenRays(
-              pose, intrinsicPtr, otherPose, otherIntrinsicPtr, viewObsIt->second.getCoordinates(), observationPair.second.getCoordinates());
+              pose, intrinsicPtr, otherPose, otherIntrinsicPtr, rcObservation.getCoordinates(), observationPair.second.getCoordinates());
 
             if (angle < _minViewAngle || angle > _maxViewAngle)
                 continue;
@@ -602,18 +646,13 @@ std::vector<int> MultiViewParams::findTileNearestCams(int rc, int nbNearestCams,
 
     const ROI fullsizeRoi = upscaleROI(roi, getProcessDownscale());  // landmark observations are in the full-size image coordinate system
 
-    for (const auto& landmarkPair : sfmData.getLandmarks())
+    for (const LandmarkVisibility& visibility : getVisibleLandmarks(rc))
     {
-        const auto& observations = landmarkPair.second.getObservations();
-
-        auto viewObsIt = observations.find(viewId);
-
-        // has landmark observation for the R camera
-        if (viewObsIt == observations.end())
-            continue;
+        const auto& observations = visibility.landmark->getObservations();
+        const sfmData::Observation& rcObservation = *(visibility.observation);
 
         // landmark R camera observation is in the image full-size ROI
-        if (!fullsizeRoi.contains(viewObsIt->second.getX(), viewObsIt->second.getY()))
+        if (!fullsizeRoi.contains(rcObservation.getX(), rcObservation.getY()))
             continue;
 
         for (const auto& observationPair : observations)
@@ -635,7 +674,7 @@ std::vector<int> MultiViewParams::findTileNearestCams(int rc, int nbNearestCams,
             const camera::IntrinsicBase* otherIntrinsicPtr = sfmData.getIntrinsicPtr(otherView.getIntrinsicId());
 
             const double angle = camera::angleBetweenRays(
-              pose, intrinsicPtr, otherPose, otherIntrinsicPtr, viewObsIt->second.getCoordinates(), observationPair.second.getCoordinates());
+              pose, intrinsicPtr, otherPose, otherIntrinsicPtr, rcObservation.getCoordinates(), observationPair.second.getCoordinates());
 
             tcScore[tc] += plateauFunction(1, 10, 50, 150, angle);
         }
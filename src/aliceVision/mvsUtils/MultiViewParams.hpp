@@ -16,6 +16,7 @@
 
 #include <boost/property_tree/ptree.hpp>
 
+#include <mutex>
 #include <string>
 #include <vector>
 #include <map>
@@ -26,6 +27,8 @@ namespace bpt = boost::property_tree;
 
 namespace sfmData {
 class SfMData;
+class Landmark;
+class Observation;
 }  // namespace sfmData
 
 namespace mvsUtils {
@@ -80,11 +83,23 @@ enum class EFileType
     volumeTopographicCut = 50,
     stats9p = 51,
     tilePattern = 52,
+    volumeCompressed = 53,
 };
 
 class MultiViewParams
 {
   public:
+    /**
+     * @brief A landmark observed by a camera, inverted from the per-landmark observation maps.
+     */
+    struct LandmarkVisibility
+    {
+        /// observed landmark
+        const sfmData::Landmark* landmark;
+        /// observation of the landmark in this camera
+        const sfmData::Observation* observation;
+    };
+
     /// prepareDenseScene data
     std::string _imagesFolder;
     /// camera projection matrix P
@@ -225,6 +240,16 @@ class MultiViewParams
      */
     StaticVector<int> findCamsWhichIntersectsHexahedron(const Point3d hexah[8]) const;
 
+    /**
+     * @brief Get the landmarks observed by a given camera, with the corresponding observations.
+     * The inverted visibility index is built once on first use (in parallel over the landmarks)
+     * and then shared by all nearest cameras searches, instead of scanning every landmark for
+     * every R camera.
+     * @param[in] rc R camera id
+     * @return visible landmarks list for the given camera
+     */
+    const std::vector<LandmarkVisibility>& getVisibleLandmarks(int rc) const;
+
     /**
      * @brief findNearestCamsFromLandmarks
      * @param rc
@@ -272,6 +297,10 @@ class MultiViewParams
     float _maxViewAngle = 70.0f;  // WARNING: may be too low, especially when using seeds from SfM
     /// input sfmData
     const sfmData::SfMData& _sfmData;
+    /// per-camera list of visible landmarks, inverted once from the landmark observations (lazy)
+    mutable std::vector<std::vector<LandmarkVisibility>> _visibleLandmarksPerCam;
+    /// protects the lazy construction of _visibleLandmarksPerCam
+    mutable std::mutex _visibleLandmarksMutex;
 
     void loadMatricesFromTxtFile(int index, const std::string& fileNameP, const std::string& fileNameD);
     void loadMatricesFromRawProjectionMatrix(int index, const double* rawProjMatix);
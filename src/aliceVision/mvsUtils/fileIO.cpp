@@ -315,6 +315,13 @@ std::string getFileNameFromViewId(const MultiViewParams& mp,
             ext = "abc";
             break;
         }
+        case EFileType::volumeCompressed:
+        {
+            folder = mp.getDepthMapsFolder();
+            suffix = "_volume";
+            ext = "avv";
+            break;
+        }
         case EFileType::volumeTopographicCut:
         {
             folder = mp.getDepthMapsFolder();
@@ -14,12 +14,61 @@
 #include <boost/regex.hpp>
 
 #include <filesystem>
+#include <map>
+#include <mutex>
 
 namespace fs = std::filesystem;
 
 namespace aliceVision {
 namespace mvsUtils {
 
+namespace {
+
+// cached map directory filename listings:
+// the tile merge loops probe the same directory for every (camera, map type) pair and the
+// repeated enumerations dominate the metadata traffic on network filesystems
+std::map<std::string, std::vector<std::string>> directoryListingCache;
+std::mutex directoryListingCacheMutex;
+
+/**
+ * @brief Get the filename listing of the given map directory.
+ * The directory is enumerated once per run, then the listing is served from an in-memory cache.
+ * @param[in] directory the map directory path
+ * @return the map directory filename listing
+ */
+std::vector<std::string> getDirectoryFilenameListing(const std::string& directory)
+{
+    const std::lock_guard<std::mutex> lock(directoryListingCacheMutex);
+
+    auto it = directoryListingCache.find(directory);
+
+    if (it == directoryListingCache.end())
+    {
+        std::vector<std::string> filenames;
+
+        for (const auto& entry : fs::directory_iterator{directory})
+            filenames.push_back(entry.path().filename().string());
+
+        it = directoryListingCache.emplace(directory, std::move(filenames)).first;
+    }
+
+    return it->second;
+}
+
+/**
+ * @brief Drop the cached listing of the given map directory.
+ * Called after a map file has been produced or deleted in the directory by this process.
+ * @param[in] directory the map directory path
+ */
+void invalidateDirectoryFilenameListing(const std::string& directory)
+{
+    const std::lock_guard<std::mutex> lock(directoryListingCacheMutex);
+
+    directoryListingCache.erase(directory);
+}
+
+}  // namespace
+
 /**
  * @brief Get the map name from the given fileType enum
  * @param[in] fileType the map fileType enum
@@ -61,13 +110,12 @@ std::string getMapNameFromFileType(EFileType fileType)
 
 /**
  * @brief Get tile map ROI from file metadata.
- * @param[in] mapTilePath the tile map file path
+ * @param[in] mapTilePath the tile map file path (for error messages)
+ * @param[in] metadata the tile map file metadata
  * @param[in,out] out_roi the corresponding region-of-interest read from file metadata
  */
-void getRoiFromMetadata(const std::string& mapTilePath, ROI& out_roi)
+void getRoiFromMetadata(const std::string& mapTilePath, const oiio::ParamValueList& metadata, ROI& out_roi)
 {
-    const oiio::ParamValueList metadata = image::readImageMetadata(mapTilePath);
-
     const auto roiBeginXIt = metadata.find("AliceVision:roiBeginX");
     const auto roiBeginYIt = metadata.find("AliceVision:roiBeginY");
     const auto roiEndXIt = metadata.find("AliceVision:roiEndX");
@@ -94,13 +142,12 @@ void getRoiFromMetadata(const std::string& mapTilePath, ROI& out_roi)
 
 /**
  * @brief Get tile map TileParams from file metadata.
- * @param[in] mapTilePath the tile map file path
+ * @param[in] mapTilePath the tile map file path (for error messages)
+ * @param[in] metadata the tile map file metadata
  * @param[in,out] out_tileParams the corresponding TileParams read from file metadata
  */
-void getTileParamsFromMetadata(const std::string& mapTilePath, TileParams& out_tileParams)
+void getTileParamsFromMetadata(const std::string& mapTilePath, const oiio::ParamValueList& metadata, TileParams& out_tileParams)
 {
-    const oiio::ParamValueList metadata = image::readImageMetadata(mapTilePath);
-
     const auto tileWidthIt = metadata.find("AliceVision:tileBufferWidth");
     const auto tileHeightIt = metadata.find("AliceVision:tileBufferHeight");
     const auto tilePaddingIt = metadata.find("AliceVision:tilePadding");
@@ -143,10 +190,10 @@ void getTilePathList(int rc,
 
     const boost::regex mapPattern(mapPath.stem().string() + "_\\d+_\\d+" + mapPath.extension().string());
 
-    for (auto& entry : fs::directory_iterator{mapDirectory})
+    for (const std::string& filename : getDirectoryFilenameListing(mapDirectory.string()))
     {
-        if (boost::regex_match(entry.path().filename().string(), mapPattern))
-            out_mapTilePathList.push_back(entry.path().string());
+        if (boost::regex_match(filename, mapPattern))
+            out_mapTilePathList.push_back((mapDirectory / filename).string());
     }
 }
 
@@ -361,41 +408,54 @@ void readMapFromFileOrTiles(int rc,
                                                      << ", step: " << step);
     }
 
-    // get tileParams from first tile file metadata
+    // get tileParams and tile roi list from file metadata, a single metadata read per tile
     TileParams tileParams;
-    getTileParamsFromMetadata(mapTilePathList.front(), tileParams);
-
-    // get tile roi list from each file metadata
     std::vector<ROI> tileRoiList;
     tileRoiList.resize(mapTilePathList.size());
     for (size_t i = 0; i < mapTilePathList.size(); ++i)
     {
-        getRoiFromMetadata(mapTilePathList.at(i), tileRoiList.at(i));
+        const oiio::ParamValueList metadata = image::readImageMetadata(mapTilePathList.at(i));
+
+        getRoiFromMetadata(mapTilePathList.at(i), metadata, tileRoiList.at(i));
+
+        if (i == 0)
+            getTileParamsFromMetadata(mapTilePathList.front(), metadata, tileParams);
     }
 
-    // read and add each tile to the full map
-    for (size_t i = 0; i < tileRoiList.size(); ++i)
+    // decode the tiles in parallel
+    std::vector<image::Image<T>> tileMapList(tileRoiList.size());
+
+#pragma omp parallel for
+    for (int i = 0; i < static_cast<int>(tileRoiList.size()); ++i)
     {
         const ROI roi = intersect(tileRoiList.at(i), imageRoi);
-        const std::string mapTilePath = getFileNameFromIndex(mp, rc, fileType, customSuffix, roi.x.begin, roi.y.begin);
 
         if (roi.isEmpty())
             continue;
 
+        const std::string mapTilePath = getFileNameFromIndex(mp, rc, fileType, customSuffix, roi.x.begin, roi.y.begin);
+
         try
         {
             // read tile
-            image::Image<T> tileMap;
-            image::readImage(mapTilePath, tileMap, image::EImageColorSpace::NO_CONVERSION);
-
-            // add tile to the full map
-            addSingleTileMapWeighted(rc, mp, tileParams, roi, scaleStep, tileMap, out_map);
+            image::readImage(mapTilePath, tileMapList.at(i), image::EImageColorSpace::NO_CONVERSION);
         }
         catch (const std::exception& e)
         {
             ALICEVISION_LOG_WARNING("Cannot find map (rc: " << rc << "): " << fs::path(mapTilePath).filename().string());
         }
     }
+
+    // add each tile to the full map, sequentially as tile borders overlap in the padding areas
+    for (size_t i = 0; i < tileRoiList.size(); ++i)
+    {
+        const ROI roi = intersect(tileRoiList.at(i), imageRoi);
+
+        if (roi.isEmpty() || (tileMapList.at(i).size() == 0))
+            continue;
+
+        addSingleTileMapWeighted(rc, mp, tileParams, roi, scaleStep, tileMapList.at(i), out_map);
+    }
 }
 
 template<typename T>
@@ -536,6 +596,9 @@ void writeMapToFileOrTile(int rc,
 
     // write map
     image::writeImage(mapPath, in_map, mapWriteOptions, metadata, displayRoi, pixelRoi);
+
+    // a new map file exists, drop the cached listing of its directory
+    invalidateDirectoryFilenameListing(fs::path(mapPath).parent_path().string());
 }
 
 void addTileMapWeighted(int rc,
@@ -680,6 +743,10 @@ void deleteMapTiles(int rc, const MultiViewParams& mp, const EFileType fileType,
             ALICEVISION_LOG_WARNING("Cannot delete map tile file (rc: " << rc << "): " << fs::path(mapTilePath).filename().string());
         }
     }
+
+    // map files have been removed, drop the cached listing of their directory
+    if (!mapTilePathList.empty())
+        invalidateDirectoryFilenameListing(fs::path(mapTilePathList.front()).parent_path().string());
 }
 
 }  // namespace mvsUtils
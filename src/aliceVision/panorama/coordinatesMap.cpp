@@ -6,8 +6,6 @@
 
 #include "coordinatesMap.hpp"
 
-#include "sphericalMapping.hpp"
-
 namespace aliceVision {
 
 bool CoordinatesMap::build(const std::pair<int, int>& panoramaSize,
@@ -24,6 +22,31 @@ bool CoordinatesMap::build(const std::pair<int, int>& panoramaSize,
     int min_x = std::numeric_limits<int>::max();
     int min_y = std::numeric_limits<int>::max();
 
+    /* The pose matrix is constant over the map, build it once instead of once per pixel */
+    const Eigen::Matrix4d poseMatrix = pose.getHomogeneous();
+
+    /*
+    The latitude only depends on the row and the longitude only on the column,
+    so the trigonometry is evaluated once per row and once per column instead of once per pixel.
+    */
+    std::vector<double> cosLatitudes(coarseBbox.height);
+    std::vector<double> sinLatitudes(coarseBbox.height);
+    for (int y = 0; y < coarseBbox.height; y++)
+    {
+        const double latitude = (double(y + coarseBbox.top) / double(panoramaSize.second)) * M_PI - M_PI_2;
+        cosLatitudes[y] = cos(latitude);
+        sinLatitudes[y] = sin(latitude);
+    }
+
+    std::vector<double> cosLongitudes(coarseBbox.width);
+    std::vector<double> sinLongitudes(coarseBbox.width);
+    for (int x = 0; x < coarseBbox.width; x++)
+    {
+        const double longitude = ((double(x + coarseBbox.left) / double(panoramaSize.first)) * 2.0 * M_PI) - M_PI;
+        cosLongitudes[x] = cos(longitude);
+        sinLongitudes[x] = sin(longitude);
+    }
+
     for (int y = 0; y < coarseBbox.height; y++)
     {
         int cy = y + coarseBbox.top;
@@ -36,7 +59,7 @@ bool CoordinatesMap::build(const std::pair<int, int>& panoramaSize,
         {
             int cx = x + coarseBbox.left;
 
-            Vec3 ray = SphericalMapping::fromEquirectangular(Vec2(cx, cy), panoramaSize.first, panoramaSize.second);
+            const Vec3 ray(cosLatitudes[y] * sinLongitudes[x], sinLatitudes[y], cosLatitudes[y] * cosLongitudes[x]);
 
             /**
              * Check that this ray should be visible.
@@ -51,7 +74,7 @@ bool CoordinatesMap::build(const std::pair<int, int>& panoramaSize,
             /**
              * Project this ray to camera pixel coordinates
              */
-            const Vec2 pix_disto_d = intrinsics.project(pose, ray.homogeneous(), true);
+            const Vec2 pix_disto_d = intrinsics.project(poseMatrix, ray.homogeneous(), true);
             const Vec2f pix_disto = pix_disto_d.cast<float>();
 
             /**
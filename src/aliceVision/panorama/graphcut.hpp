@@ -571,6 +571,29 @@ class GraphcutSeams
         return true;
     }
 
+    bool conflicts(const InputData& first, const InputData& second) const
+    {
+        // Conservative margin covering the bounding box dilation done in processInput
+        BoundingBox firstRect = first.rect;
+        BoundingBox secondRect = second.rect;
+        const BoundingBox firstBbox = firstRect.dilate(4);
+        const BoundingBox secondBbox = secondRect.dilate(4);
+
+        // Test the intersection through the horizontal loop too
+        for (int shift = -1; shift <= 1; shift++)
+        {
+            BoundingBox shifted = secondBbox;
+            shifted.left = secondBbox.left + shift * int(_outputWidth);
+
+            if (!firstBbox.intersectionWith(shifted).isEmpty())
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     bool process()
     {
         std::map<IndexT, double> costs;
@@ -579,29 +602,87 @@ class GraphcutSeams
             costs[info.first] = std::numeric_limits<double>::max();
         }
 
+        // Group the inputs into batches of non-overlapping regions.
+        // processInput only reads and writes the labels inside its own dilated
+        // bounding box, so the inputs of a batch can be processed concurrently.
+        std::vector<std::vector<IndexT>> batches;
+        {
+            std::vector<IndexT> remaining;
+            for (auto& info : _inputs)
+            {
+                remaining.push_back(info.first);
+            }
+
+            while (!remaining.empty())
+            {
+                std::vector<IndexT> batch;
+                std::vector<IndexT> next;
+
+                for (const IndexT id : remaining)
+                {
+                    bool compatible = true;
+                    for (const IndexT other : batch)
+                    {
+                        if (conflicts(_inputs.at(id), _inputs.at(other)))
+                        {
+                            compatible = false;
+                            break;
+                        }
+                    }
+
+                    if (compatible)
+                    {
+                        batch.push_back(id);
+                    }
+                    else
+                    {
+                        next.push_back(id);
+                    }
+                }
+
+                batches.push_back(batch);
+                remaining.swap(next);
+            }
+        }
+
         for (int i = 0; i < 10; i++)
         {
             ALICEVISION_LOG_INFO("GraphCut processing iteration #" << i);
 
             // For each possible label, try to extends its domination on the label's world
             bool hasChange = false;
+            bool failed = false;
 
-            int pos = 0;
-            for (auto& info : _inputs)
+            for (const std::vector<IndexT>& batch : batches)
             {
-                double cost;
-                if (!processInput(cost, info.second))
+#pragma omp parallel for
+                for (int pos = 0; pos < int(batch.size()); pos++)
                 {
-                    return false;
-                }
+                    const IndexT id = batch[pos];
 
-                if (costs[info.first] != cost)
-                {
-                    costs[info.first] = cost;
-                    hasChange = true;
+                    double cost;
+                    if (!processInput(cost, _inputs.at(id)))
+                    {
+                        failed = true;
+                        continue;
+                    }
+
+#pragma omp critical
+                    {
+                        if (costs[id] != cost)
+                        {
+                            costs[id] = cost;
+                            hasChange = true;
+                        }
+                    }
                 }
             }
 
+            if (failed)
+            {
+                return false;
+            }
+
             if (!hasChange)
             {
                 break;
@@ -131,6 +131,33 @@ bool substract(aliceVision::image::Image<T>& AminusB, const aliceVision::image::
     return true;
 }
 
+template<class T>
+bool substractScaled(aliceVision::image::Image<T>& AminusB, const aliceVision::image::Image<T>& A, const aliceVision::image::Image<T>& B, float scale)
+{
+    size_t width = AminusB.width();
+    size_t height = AminusB.height();
+
+    if (AminusB.size() != A.size())
+    {
+        return false;
+    }
+
+    if (AminusB.size() != B.size())
+    {
+        return false;
+    }
+
+    for (int i = 0; i < height; i++)
+    {
+        for (int j = 0; j < width; j++)
+        {
+            AminusB(i, j) = A(i, j) - B(i, j) * scale;
+        }
+    }
+
+    return true;
+}
+
 template<class T>
 bool addition(aliceVision::image::Image<T>& AplusB, const aliceVision::image::Image<T>& A, const aliceVision::image::Image<T>& B)
 {
@@ -158,6 +185,33 @@ bool addition(aliceVision::image::Image<T>& AplusB, const aliceVision::image::Im
     return true;
 }
 
+template<class T>
+bool additionScaled(aliceVision::image::Image<T>& AplusB, const aliceVision::image::Image<T>& A, const aliceVision::image::Image<T>& B, float scale)
+{
+    size_t width = AplusB.width();
+    size_t height = AplusB.height();
+
+    if (AplusB.size() != A.size())
+    {
+        return false;
+    }
+
+    if (AplusB.size() != B.size())
+    {
+        return false;
+    }
+
+    for (int i = 0; i < height; i++)
+    {
+        for (int j = 0; j < width; j++)
+        {
+            AplusB(i, j) = A(i, j) + B(i, j) * scale;
+        }
+    }
+
+    return true;
+}
+
 void removeNegativeValues(image::Image<image::RGBfColor>& img);
 
 template<class T>
@@ -79,6 +79,11 @@ bool LaplacianPyramid::apply(aliceVision::image::Image<image::RGBfColor>& source
     mask = aliceVision::image::Image<float>();
     weights = aliceVision::image::Image<float>();
 
+    // Scratch buffers reused by all the pyramid levels, sized for the first one
+    image::Image<image::RGBfColor> buf(width, height);
+    image::Image<image::RGBfColor> buf2(width, height);
+    image::Image<float> bufFloat(width, height);
+
     for (int l = 0; l < _levels.size() - 1; l++)
     {
         BoundingBox inputBbox;
@@ -87,31 +92,31 @@ bool LaplacianPyramid::apply(aliceVision::image::Image<image::RGBfColor>& source
         inputBbox.width = width;
         inputBbox.height = height;
 
-        image::Image<image::RGBfColor> bufMasked(width, height);
-        image::Image<image::RGBfColor> buf(width, height);
-        image::Image<image::RGBfColor> buf2(width, height);
-        image::Image<float> bufFloat(width, height);
+        // Shrink the scratch buffers to the current level size
+        if (buf.width() != width || buf.height() != height)
+        {
+            buf = image::Image<image::RGBfColor>(width, height);
+            buf2 = image::Image<image::RGBfColor>(width, height);
+            bufFloat = image::Image<float>(width, height);
+        }
 
-        // Apply mask to content before convolution
+        // Apply mask to content before convolution, in place: the masked pixels never
+        // contribute to the merged panorama since their weight is also set to zero
         for (int i = 0; i < height; i++)
         {
             for (int j = 0; j < width; j++)
             {
-                if (std::abs(currentMask(i, j)) > 1e-6)
-                {
-                    bufMasked(i, j) = currentColor(i, j);
-                }
-                else
+                if (std::abs(currentMask(i, j)) <= 1e-6)
                 {
-                    bufMasked(i, j).r() = 0.0f;
-                    bufMasked(i, j).g() = 0.0f;
-                    bufMasked(i, j).b() = 0.0f;
+                    currentColor(i, j).r() = 0.0f;
+                    currentColor(i, j).g() = 0.0f;
+                    currentColor(i, j).b() = 0.0f;
                     currentWeights(i, j) = 0.0f;
                 }
             }
         }
 
-        if (!convolveGaussian5x5<image::RGBfColor>(buf, bufMasked))
+        if (!convolveGaussian5x5<image::RGBfColor>(buf, currentColor))
         {
             return false;
         }
@@ -149,9 +154,12 @@ bool LaplacianPyramid::apply(aliceVision::image::Image<image::RGBfColor>& source
         int nextWidth = width / 2;
         int nextHeight = int(floor(float(height) / 2.0f));
 
-        nextColor = aliceVision::image::Image<image::RGBfColor>(nextWidth, nextHeight);
-        nextWeights = aliceVision::image::Image<float>(nextWidth, nextHeight);
-        nextMask = aliceVision::image::Image<float>(nextWidth, nextHeight);
+        if (nextColor.width() != nextWidth || nextColor.height() != nextHeight)
+        {
+            nextColor = aliceVision::image::Image<image::RGBfColor>(nextWidth, nextHeight);
+            nextWeights = aliceVision::image::Image<float>(nextWidth, nextHeight);
+            nextMask = aliceVision::image::Image<float>(nextWidth, nextHeight);
+        }
 
         if (!downscale(nextColor, buf))
         {
@@ -174,18 +182,9 @@ bool LaplacianPyramid::apply(aliceVision::image::Image<image::RGBfColor>& source
             return false;
         }
 
-        // Values must be multiplied by 4 as our upscale was using
-        // filling of 0 values
-        for (int i = 0; i < buf2.height(); i++)
-        {
-            for (int j = 0; j < buf2.width(); j++)
-            {
-                buf2(i, j) *= 4.0f;
-            }
-        }
-
         // Only keep the difference (Band pass)
-        if (!substract(currentColor, currentColor, buf2))
+        // Values are multiplied by 4 as our upscale was using filling of 0 values
+        if (!substractScaled(currentColor, currentColor, buf2, 4.0f))
         {
             return false;
         }
@@ -211,10 +210,10 @@ bool LaplacianPyramid::apply(aliceVision::image::Image<image::RGBfColor>& source
             return false;
         }
 
-        // Swap buffers
-        currentColor = nextColor;
-        currentWeights = nextWeights;
-        currentMask = nextMask;
+        // Swap buffers, no need to copy the next level content
+        currentColor.swap(nextColor);
+        currentWeights.swap(nextWeights);
+        currentMask.swap(nextMask);
         width = nextWidth;
         height = nextHeight;
 
@@ -227,12 +226,12 @@ bool LaplacianPyramid::apply(aliceVision::image::Image<image::RGBfColor>& source
     InputInfo iinfo;
     iinfo.offsetX = offsetX;
     iinfo.offsetY = offsetY;
-    iinfo.color = currentColor;
-    iinfo.mask = currentMask;
-    iinfo.weights = currentWeights;
+    iinfo.color.swap(currentColor);
+    iinfo.mask.swap(currentMask);
+    iinfo.weights.swap(currentWeights);
 
     omp_set_lock(&_merge_lock);
-    _inputInfos.push_back(iinfo);
+    _inputInfos.push_back(std::move(iinfo));
     omp_unset_lock(&_merge_lock);
 
     return true;
@@ -279,6 +278,9 @@ bool LaplacianPyramid::rebuild(image::Image<image::RGBAfColor>& output, const Bo
         }
     }
 
+    // The input buffers are not needed anymore, free them before the collapse
+    _inputInfos.clear();
+
     // We first want to compute the final pixels mean
     for (int l = 0; l < _levels.size(); l++)
     {
@@ -329,15 +331,8 @@ bool LaplacianPyramid::rebuild(image::Image<image::RGBAfColor>& output, const Bo
             return false;
         }
 
-        for (int y = 0; y < buf2.height(); y++)
-        {
-            for (int x = 0; x < buf2.width(); x++)
-            {
-                buf2(y, x) *= 4.0f;
-            }
-        }
-
-        if (!addition(_levels[currentLevel], _levels[currentLevel], buf2))
+        // Values are multiplied by 4 as our upscale was using filling of 0 values
+        if (!additionScaled(_levels[currentLevel], _levels[currentLevel], buf2, 4.0f))
         {
             return false;
         }
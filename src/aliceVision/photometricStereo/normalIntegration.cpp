@@ -26,13 +26,254 @@
 #include <opencv2/imgproc/imgproc.hpp>
 #include <opencv2/core/eigen.hpp>
 
+#include <boost/algorithm/string.hpp>
+
+#include <stdexcept>
+
 #include "photometricDataIO.hpp"
 #include "normalIntegration.hpp"
 
 namespace aliceVision {
 namespace photometricStereo {
 
-void normalIntegration(const std::string& inputPath, const bool& perspective, const int& downscale, const std::string& outputFolder)
+namespace {
+
+// The cosine-transform path diagonalizes the graph Laplacian of the pixel grid with
+// Neumann boundaries: (Az)(i, j) is the sum, over the existing neighbours of (i, j),
+// of z(i, j) - z(neighbour). The multigrid path below solves the same system with
+// damped-Jacobi V-cycles, so both integration methods share the right hand side
+// built by getDivergenceField and setBoundaryConditions.
+
+void smoothDampedJacobi(const Eigen::MatrixXf& f, Eigen::MatrixXf& z, Eigen::MatrixXf& buffer, int nbSweeps)
+{
+    const int nbRows = z.rows();
+    const int nbCols = z.cols();
+    const float omega = 0.8;
+
+    for (int sweep = 0; sweep < nbSweeps; ++sweep)
+    {
+#pragma omp parallel for
+        for (int j = 0; j < nbCols; ++j)
+        {
+            for (int i = 0; i < nbRows; ++i)
+            {
+                float neighbourSum = 0.0;
+                int degree = 0;
+
+                if (i > 0)
+                {
+                    neighbourSum += z(i - 1, j);
+                    ++degree;
+                }
+                if (i < nbRows - 1)
+                {
+                    neighbourSum += z(i + 1, j);
+                    ++degree;
+                }
+                if (j > 0)
+                {
+                    neighbourSum += z(i, j - 1);
+                    ++degree;
+                }
+                if (j < nbCols - 1)
+                {
+                    neighbourSum += z(i, j + 1);
+                    ++degree;
+                }
+
+                buffer(i, j) = (1.0 - omega) * z(i, j) + omega * (f(i, j) + neighbourSum) / degree;
+            }
+        }
+        z.swap(buffer);
+    }
+}
+
+void computeResidual(const Eigen::MatrixXf& f, const Eigen::MatrixXf& z, Eigen::MatrixXf& residual)
+{
+    const int nbRows = z.rows();
+    const int nbCols = z.cols();
+
+#pragma omp parallel for
+    for (int j = 0; j < nbCols; ++j)
+    {
+        for (int i = 0; i < nbRows; ++i)
+        {
+            float neighbourSum = 0.0;
+            int degree = 0;
+
+            if (i > 0)
+            {
+                neighbourSum += z(i - 1, j);
+                ++degree;
+            }
+            if (i < nbRows - 1)
+            {
+                neighbourSum += z(i + 1, j);
+                ++degree;
+            }
+            if (j > 0)
+            {
+                neighbourSum += z(i, j - 1);
+                ++degree;
+            }
+            if (j < nbCols - 1)
+            {
+                neighbourSum += z(i, j + 1);
+                ++degree;
+            }
+
+            residual(i, j) = f(i, j) - (degree * z(i, j) - neighbourSum);
+        }
+    }
+}
+
+void restrictResidual(const Eigen::MatrixXf& fine, Eigen::MatrixXf& coarse)
+{
+    const int nbFineRows = fine.rows();
+    const int nbFineCols = fine.cols();
+    const int nbCoarseRows = (nbFineRows + 1) / 2;
+    const int nbCoarseCols = (nbFineCols + 1) / 2;
+
+    coarse.resize(nbCoarseRows, nbCoarseCols);
+
+#pragma omp parallel for
+    for (int J = 0; J < nbCoarseCols; ++J)
+    {
+        for (int I = 0; I < nbCoarseRows; ++I)
+        {
+            // Cell-centered coarsening: each coarse cell sums its (up to) 2x2 children,
+            // which is the exact transpose of the piecewise-constant prolongation and
+            // accounts for the doubled grid spacing in the unscaled stencil
+            float sum = 0.0;
+            for (int dj = 0; dj <= 1; ++dj)
+            {
+                const int j = 2 * J + dj;
+                if (j >= nbFineCols)
+                    continue;
+                for (int di = 0; di <= 1; ++di)
+                {
+                    const int i = 2 * I + di;
+                    if (i >= nbFineRows)
+                        continue;
+                    sum += fine(i, j);
+                }
+            }
+            coarse(I, J) = sum;
+        }
+    }
+}
+
+void prolongateAndCorrect(const Eigen::MatrixXf& coarse, Eigen::MatrixXf& fine)
+{
+    const int nbFineRows = fine.rows();
+    const int nbFineCols = fine.cols();
+
+#pragma omp parallel for
+    for (int j = 0; j < nbFineCols; ++j)
+    {
+        for (int i = 0; i < nbFineRows; ++i)
+        {
+            fine(i, j) += coarse(i / 2, j / 2);
+        }
+    }
+}
+
+void vCycle(const Eigen::MatrixXf& f, Eigen::MatrixXf& z, Eigen::MatrixXf& buffer)
+{
+    const int nbRows = z.rows();
+    const int nbCols = z.cols();
+
+    if (nbRows <= 32 && nbCols <= 32)
+    {
+        // Coarsest level: relax until the small system is solved
+        smoothDampedJacobi(f, z, buffer, 200);
+        return;
+    }
+
+    smoothDampedJacobi(f, z, buffer, 3);
+
+    Eigen::MatrixXf residual(nbRows, nbCols);
+    computeResidual(f, z, residual);
+
+    Eigen::MatrixXf coarseF;
+    restrictResidual(residual, coarseF);
+    // Keep the restricted residual compatible with the singular Neumann system
+    coarseF.array() -= coarseF.mean();
+
+    Eigen::MatrixXf coarseZ = Eigen::MatrixXf::Zero(coarseF.rows(), coarseF.cols());
+    Eigen::MatrixXf coarseBuffer(coarseF.rows(), coarseF.cols());
+    vCycle(coarseF, coarseZ, coarseBuffer);
+
+    prolongateAndCorrect(coarseZ, z);
+
+    smoothDampedJacobi(f, z, buffer, 3);
+}
+
+void solvePoissonMultigrid(const Eigen::MatrixXf& f, Eigen::MatrixXf& z)
+{
+    z = Eigen::MatrixXf::Zero(f.rows(), f.cols());
+
+    const float fNorm = f.norm();
+    if (fNorm == 0.0)
+        return;
+
+    Eigen::MatrixXf buffer(f.rows(), f.cols());
+    Eigen::MatrixXf residual(f.rows(), f.cols());
+
+    const int maxCycles = 100;
+    const float tolerance = 1e-4;
+
+    float previousResidualNorm = fNorm;
+
+    for (int cycle = 0; cycle < maxCycles; ++cycle)
+    {
+        vCycle(f, z, buffer);
+
+        // The Neumann system is only defined up to a constant: keep the solution centered
+        z.array() -= z.mean();
+
+        computeResidual(f, z, residual);
+        const float residualNorm = residual.norm();
+
+        // Stop on convergence, or once single precision prevents further progress
+        if (residualNorm < tolerance * fNorm || (cycle > 0 && residualNorm > 0.9 * previousResidualNorm))
+            break;
+
+        previousResidualNorm = residualNorm;
+    }
+}
+
+}  // namespace
+
+EIntegrationMethod EIntegrationMethod_stringToEnum(const std::string& method)
+{
+    const std::string m = boost::to_lower_copy(method);
+
+    if (m == "dct")
+        return EIntegrationMethod::DCT;
+    if (m == "multigrid")
+        return EIntegrationMethod::MULTIGRID;
+
+    throw std::out_of_range("Invalid integration method: " + method);
+}
+
+std::string EIntegrationMethod_enumToString(EIntegrationMethod method)
+{
+    switch (method)
+    {
+        case EIntegrationMethod::DCT:
+            return "dct";
+        case EIntegrationMethod::MULTIGRID:
+            return "multigrid";
+    }
+    throw std::out_of_range("Invalid integration method enum");
+}
+
+void normalIntegration(const std::string& inputPath,
+                       const bool& perspective,
+                       const int& downscale,
+                       const std::string& outputFolder,
+                       EIntegrationMethod integrationMethod)
 {
     std::string normalMapPath = inputPath + "/normals.png";
     std::string pathToK = inputPath + "/K.txt";
@@ -67,7 +308,14 @@ void normalIntegration(const std::string& inputPath, const bool& perspective, co
 
     image::Image<float> depthMap(nbCols, nbRows);
     image::Image<float> distanceMap(nbCols, nbRows);
-    DCTIntegration(normalsImPNG2, depthMap, perspective, K, normalsMask);
+    if (integrationMethod == EIntegrationMethod::MULTIGRID)
+    {
+        MultigridIntegration(normalsImPNG2, depthMap, perspective, K, normalsMask);
+    }
+    else
+    {
+        DCTIntegration(normalsImPNG2, depthMap, perspective, K, normalsMask);
+    }
 
     // AliceVision uses distance-to-origin convention
     convertZtoDistance(depthMap, distanceMap, K);
@@ -84,7 +332,8 @@ void normalIntegration(const sfmData::SfMData& sfmData,
                        const std::string& inputPath,
                        const bool& perspective,
                        const int& downscale,
-                       const std::string& outputFolder)
+                       const std::string& outputFolder,
+                       EIntegrationMethod integrationMethod)
 {
     image::Image<image::RGBColor> normalsImPNG;
 
@@ -176,7 +425,14 @@ void normalIntegration(const sfmData::SfMData& sfmData,
             image::Image<float> depthMap;
 
             aliceVision::image::Image<float> distanceMap;
-            DCTIntegration(normalsImPNG2, depthMap, perspective, K, normalsMask);
+            if (integrationMethod == EIntegrationMethod::MULTIGRID)
+            {
+                MultigridIntegration(normalsImPNG2, depthMap, perspective, K, normalsMask);
+            }
+            else
+            {
+                DCTIntegration(normalsImPNG2, depthMap, perspective, K, normalsMask);
+            }
             image::Image<float> z0(nbCols, nbRows);
             image::Image<float> maskZ0(nbCols, nbRows);
             getZ0FromLandmarks(sfmData, z0, maskZ0, viewId, normalsMask);
@@ -262,7 +518,14 @@ void normalIntegration(const sfmData::SfMData& sfmData,
 
         // Main fonction
         image::Image<float> depthMap(nbCols, nbRows);
-        DCTIntegration(normalsImPNG2, depthMap, perspective, K, normalsMask);
+        if (integrationMethod == EIntegrationMethod::MULTIGRID)
+        {
+            MultigridIntegration(normalsImPNG2, depthMap, perspective, K, normalsMask);
+        }
+        else
+        {
+            DCTIntegration(normalsImPNG2, depthMap, perspective, K, normalsMask);
+        }
 
         // AliceVision uses distance-to-origin convention
         image::Image<float> distanceMap(nbCols, nbRows);
@@ -396,6 +659,74 @@ void DCTIntegration(const image::Image<image::RGBfColor>& normals,
     }
 }
 
+void MultigridIntegration(const image::Image<image::RGBfColor>& normals,
+                          image::Image<float>& depth,
+                          bool perspective,
+                          const Eigen::Matrix3f& K,
+                          const image::Image<float>& normalsMask)
+{
+    int nbCols = normals.cols();
+    int nbRows = normals.rows();
+
+    Eigen::MatrixXf p(nbRows, nbCols);
+    Eigen::MatrixXf q(nbRows, nbCols);
+
+    Eigen::MatrixXf f(nbRows, nbCols);
+
+    // Prepare normal integration
+    normal2PQ(normals, p, q, perspective, K, normalsMask);
+    getDivergenceField(p, q, f);
+    setBoundaryConditions(p, q, f);
+
+    // The pure Neumann system only admits a solution for a zero-mean right hand side;
+    // the constant mode of the solution is fixed by the recentering below anyway
+    f.array() -= f.mean();
+
+    Eigen::MatrixXf z;
+    solvePoissonMultigrid(f, z);
+
+    depth.resize(nbCols, nbRows);
+
+    for (int j = 0; j < nbCols; ++j)
+    {
+        for (int i = 0; i < nbRows; ++i)
+        {
+            if (normalsMask(i, j) > 0.7)
+            {
+                if (perspective)
+                {
+                    depth(i, j) = -std::exp(z(i, j));
+                }
+                else
+                {
+                    depth(i, j) = z(i, j);
+                }
+            }
+            else
+            {
+                depth(i, j) = nanf("1");
+            }
+        }
+    }
+
+    // Since we are not in a MV context, we can change the position of our depthmap
+    // We can then get away from negative values
+    for (int j = 0; j < nbCols; ++j)
+    {
+        for (int i = 0; i < nbRows; ++i)
+        {
+            if (normalsMask(i, j) > 0.7)
+            {
+                depth(i, j) = depth(i, j) - depth(floor(nbRows / 2), floor(nbCols / 2)) + 10 * K(0, 0);
+            }
+            else
+            {
+                depth(i, j) = -1.0;
+            }
+        }
+    }
+}
+
 void normal2PQ(const image::Image<image::RGBfColor>& normals,
                Eigen::MatrixXf& p,
                Eigen::MatrixXf& q,
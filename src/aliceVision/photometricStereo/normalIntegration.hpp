@@ -17,13 +17,41 @@
 namespace aliceVision {
 namespace photometricStereo {
 
-void normalIntegration(const std::string& inputPath, const bool& perspective, const int& downscale, const std::string& outputFolder);
+/**
+ * @brief Method used to solve the Poisson equation when integrating the normal map
+ */
+enum class EIntegrationMethod
+{
+    DCT,       //< direct solve through a full-grid cosine transform
+    MULTIGRID  //< geometric multigrid V-cycles, faster on high-resolution normal maps
+};
+
+/**
+ * @brief Get the integration method from its name ("dct" or "multigrid")
+ * @param[in] method Name of the integration method
+ * @return The corresponding EIntegrationMethod
+ */
+EIntegrationMethod EIntegrationMethod_stringToEnum(const std::string& method);
+
+/**
+ * @brief Get the name of an integration method
+ * @param[in] method The integration method
+ * @return The name of the given method
+ */
+std::string EIntegrationMethod_enumToString(EIntegrationMethod method);
+
+void normalIntegration(const std::string& inputPath,
+                       const bool& perspective,
+                       const int& downscale,
+                       const std::string& outputFolder,
+                       EIntegrationMethod integrationMethod = EIntegrationMethod::DCT);
 
 void normalIntegration(const sfmData::SfMData& sfmData,
                        const std::string& inputPath,
                        const bool& perspective,
                        const int& downscale,
-                       const std::string& outputFolder);
+                       const std::string& outputFolder,
+                       EIntegrationMethod integrationMethod = EIntegrationMethod::DCT);
 
 void DCTIntegration(const image::Image<image::RGBfColor>& normals,
                     image::Image<float>& depth,
@@ -31,6 +59,25 @@ void DCTIntegration(const image::Image<image::RGBfColor>& normals,
                     const Eigen::Matrix3f& K,
                     const image::Image<float>& normalsMask);
 
+/**
+ * @brief Integrate a normal map with a geometric multigrid Poisson solver.
+ *
+ * Solves the same discrete Neumann Poisson system as DCTIntegration, but with
+ * damped-Jacobi V-cycles instead of a full-grid cosine transform, which scales
+ * linearly with the number of pixels and parallelizes over rows.
+ *
+ * @param[in] normals Normal map to integrate
+ * @param[out] depth Integrated depth map
+ * @param[in] perspective True if a perspective camera model is used
+ * @param[in] K Camera intrinsics
+ * @param[in] normalsMask Mask of the pixels to integrate
+ */
+void MultigridIntegration(const image::Image<image::RGBfColor>& normals,
+                          image::Image<float>& depth,
+                          bool perspective,
+                          const Eigen::Matrix3f& K,
+                          const image::Image<float>& normalsMask);
+
 void normal2PQ(const image::Image<image::RGBfColor>& normals,
                Eigen::MatrixXf& p,
                Eigen::MatrixXf& q,
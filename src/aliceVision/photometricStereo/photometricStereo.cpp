@@ -20,12 +20,46 @@
 #include <filesystem>
 #include <fstream>
 #include <algorithm>
+#include <cstdint>
 
 namespace fs = std::filesystem;
 
 namespace aliceVision {
 namespace photometricStereo {
 
+namespace {
+
+/**
+ * @brief Solve the per-pixel least squares systems for a block of pixel columns at a time.
+ *
+ * Every pixel of a mask shares the same light matrix, so the per-pixel systems reduce to
+ * a single product of its pseudo-inverse with the pixel columns. The columns are processed
+ * by blocks of a few thousand pixels in parallel, which turns the estimation into a handful
+ * of large matrix products instead of one SVD solve over the whole image.
+ *
+ * @param[in] lightMatPinv Pseudo-inverse of the light matrix, shared by all pixels
+ * @param[in] rhs Per-pixel observations, one column per pixel
+ * @param[out] solution Per-pixel solutions, one column per pixel
+ */
+void solveLeastSquaresBlocked(const Eigen::MatrixXf& lightMatPinv, const Eigen::MatrixXf& rhs, Eigen::MatrixXf& solution)
+{
+    const Eigen::Index blockSize = 16384;
+    const Eigen::Index nbColumns = rhs.cols();
+    const Eigen::Index nbBlocks = (nbColumns + blockSize - 1) / blockSize;
+
+    solution.resize(lightMatPinv.rows(), nbColumns);
+
+#pragma omp parallel for
+    for (int64_t blockIndex = 0; blockIndex < static_cast<int64_t>(nbBlocks); ++blockIndex)
+    {
+        const Eigen::Index firstColumn = blockIndex * blockSize;
+        const Eigen::Index columnCount = std::min(blockSize, nbColumns - firstColumn);
+        solution.middleCols(firstColumn, columnCount).noalias() = lightMatPinv * rhs.middleCols(firstColumn, columnCount);
+    }
+}
+
+}  // namespace
+
 void photometricStereo(const std::string& inputPath,
                        const std::string& lightData,
                        const std::string& outputPath,
@@ -335,6 +369,11 @@ void photometricStereo(const std::vector<std::string>& imageList,
         numberOfPixels = auxMaskSize * imageList.size() * 3;
     }
 
+    // The light matrix is shared by every pixel: factorize it once up front and apply its
+    // pseudo-inverse to blocks of pixel columns, instead of re-running an SVD solve over
+    // the whole image for each estimation (and for each iteration of the robust scheme).
+    const Eigen::MatrixXf lightMatPinv = lightMat.completeOrthogonalDecomposition().pseudoInverse();
+
     Eigen::MatrixXf normalsVect = Eigen::MatrixXf::Zero(lightMat.cols(), pictRows * pictCols);
     Eigen::MatrixXf albedoVect = Eigen::MatrixXf::Zero(3, pictRows * pictCols);
 
@@ -422,7 +461,7 @@ void photometricStereo(const std::vector<std::string>& imageList,
 
                 // M update
                 newImMat = imMat_gray + E - W / mu;
-                M_channel = lightMat.bdcSvd(Eigen::ComputeThinU | Eigen::ComputeThinV).solve(newImMat);
+                solveLeastSquaresBlocked(lightMatPinv, newImMat, M_channel);
 
                 // E update
                 Eigen::MatrixXf E_before = E;
@@ -486,7 +525,7 @@ void photometricStereo(const std::vector<std::string>& imageList,
         else
         {
             // Normal estimation
-            M_channel = lightMat.bdcSvd(Eigen::ComputeThinU | Eigen::ComputeThinV).solve(imMat_gray);
+            solveLeastSquaresBlocked(lightMatPinv, imMat_gray, M_channel);
 
             for (size_t i = 0; i < currentMaskSize; ++i)
             {
@@ -511,7 +550,7 @@ void photometricStereo(const std::vector<std::string>& imageList,
                     pixelValues_channel.block(i, 0, 1, maskSize) = imMat.block(ch + 3 * i, 0, 1, maskSize);
                 }
 
-                M_channel = lightMat.bdcSvd(Eigen::ComputeThinU | Eigen::ComputeThinV).solve(pixelValues_channel);
+                solveLeastSquaresBlocked(lightMatPinv, pixelValues_channel, M_channel);
 
                 for (size_t i = 0; i < currentMaskSize; ++i)
                 {
@@ -14,10 +14,33 @@
 
 #include <vector>
 #include <cassert>
+#include <type_traits>
+#include <utility>
 
 namespace aliceVision {
 namespace robustEstimation {
 
+namespace detail {
+
+/**
+ * @brief Detect whether an error estimator provides a batched evaluation
+ * errors(model, x1, x2, out) over all the correspondences at once.
+ */
+template<typename ErrorT, typename ModelT, typename = void>
+struct hasBatchedErrors : std::false_type
+{};
+
+template<typename ErrorT, typename ModelT>
+struct hasBatchedErrors<ErrorT,
+                        ModelT,
+                        std::void_t<decltype(std::declval<const ErrorT&>().errors(std::declval<const ModelT&>(),
+                                                                                  std::declval<const Mat&>(),
+                                                                                  std::declval<const Mat&>(),
+                                                                                  std::declval<std::vector<double>&>()))>> : std::true_type
+{};
+
+}  // namespace detail
+
 /**
  * @brief This is one example (targeted at solvers that operate on correspondences
  * between two views) that shows the "kernel" part of a robust fitting
@@ -99,9 +122,18 @@ class PointFittingKernel
      */
     inline virtual void errors(const ModelT& model, std::vector<double>& errors) const
     {
-        errors.resize(_x1.cols());
-        for (std::size_t sample = 0; sample < _x1.cols(); ++sample)
-            errors.at(sample) = error(sample, model);
+        // Prefer the batched evaluation when the error estimator provides one,
+        // it computes all the residuals in one pass over the data
+        if constexpr (detail::hasBatchedErrors<ErrorT, ModelT>::value)
+        {
+            _errorEstimator.errors(model, _x1, _x2, errors);
+        }
+        else
+        {
+            errors.resize(_x1.cols());
+            for (std::size_t sample = 0; sample < _x1.cols(); ++sample)
+                errors.at(sample) = error(sample, model);
+        }
     }
 
     /**
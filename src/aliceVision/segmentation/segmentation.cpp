@@ -14,6 +14,8 @@
 #include <aliceVision/image/imageAlgo.hpp>
 #include <aliceVision/numeric/numeric.hpp>
 
+#include <cstring>
+
 namespace aliceVision {
 namespace segmentation {
 
@@ -50,6 +52,11 @@ bool Segmentation::initialize()
 
     Ort::SessionOptions ortSessionOptions;
 
+    _batchSize = std::max(1, _parameters.maxBatchSize);
+
+    const std::size_t inputSize = 3 * _parameters.modelHeight * _parameters.modelWidth;
+    const std::size_t outputSize = _parameters.classes.size() * _parameters.modelHeight * _parameters.modelWidth;
+
     // this is false if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_ONNX_GPU) is false
     if (_parameters.useGpu)
     {
@@ -67,12 +74,29 @@ bool Segmentation::initialize()
         _ortSession = std::make_unique<Ort::Session>(*_ortEnvironment, _parameters.modelWeights.c_str(), ortSessionOptions);
     #endif
 
+    #if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_CUDA)
+        // Reduce the batch size until the IO buffers fit in a fraction of the free device
+        // memory, the execution provider needs the remainder for the activations.
+        std::size_t freeBytes = 0;
+        std::size_t totalBytes = 0;
+        if (cudaMemGetInfo(&freeBytes, &totalBytes) == cudaSuccess)
+        {
+            const std::size_t perSampleBytes = (inputSize + outputSize) * sizeof(float);
+            const int fittingSamples = static_cast<int>((freeBytes / 4) / perSampleBytes);
+            _batchSize = std::max(1, std::min(_batchSize, fittingSamples));
+        }
+        ALICEVISION_LOG_INFO("Segmentation inference batch size: " << _batchSize);
+
         Ort::MemoryInfo memInfoCuda("Cuda", OrtAllocatorType::OrtArenaAllocator, 0, OrtMemType::OrtMemTypeDefault);
         Ort::Allocator cudaAllocator(*_ortSession, memInfoCuda);
 
-        _output.resize(_parameters.classes.size() * _parameters.modelHeight * _parameters.modelWidth);
-        _cudaInput = cudaAllocator.Alloc(_output.size() * sizeof(float));
-        _cudaOutput = cudaAllocator.Alloc(_output.size() * sizeof(float));
+        _output.resize(_batchSize * outputSize);
+        _cudaInput = cudaAllocator.Alloc(_batchSize * inputSize * sizeof(float));
+        _cudaOutput = cudaAllocator.Alloc(_batchSize * outputSize * sizeof(float));
+
+        cudaMallocHost(reinterpret_cast<void**>(&_pinnedInput), _batchSize * inputSize * sizeof(float));
+        cudaMallocHost(reinterpret_cast<void**>(&_pinnedOutput), _batchSize * outputSize * sizeof(float));
+    #endif
 #endif
     }
     else
@@ -90,25 +114,98 @@ bool Segmentation::initialize()
 
 bool Segmentation::terminate()
 {
-#if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_ONNX_GPU)
-    Ort::MemoryInfo mem_info_cuda("Cuda", OrtAllocatorType::OrtArenaAllocator, 0, OrtMemType::OrtMemTypeDefault);
-    Ort::Allocator cudaAllocator(*_ortSession, mem_info_cuda);
-    cudaAllocator.Free(_cudaInput);
-    cudaAllocator.Free(_cudaOutput);
+#if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_ONNX_GPU) && ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_CUDA)
+    if (_cudaInput != nullptr || _cudaOutput != nullptr)
+    {
+        Ort::MemoryInfo mem_info_cuda("Cuda", OrtAllocatorType::OrtArenaAllocator, 0, OrtMemType::OrtMemTypeDefault);
+        Ort::Allocator cudaAllocator(*_ortSession, mem_info_cuda);
+        cudaAllocator.Free(_cudaInput);
+        cudaAllocator.Free(_cudaOutput);
+    }
+
+    if (_pinnedInput != nullptr)
+    {
+        cudaFreeHost(_pinnedInput);
+    }
+
+    if (_pinnedOutput != nullptr)
+    {
+        cudaFreeHost(_pinnedOutput);
+    }
 #endif
 
     return true;
 }
 
 bool Segmentation::processImage(image::Image<IndexT>& labels, const image::Image<image::RGBfColor>& source)
+{
+    std::vector<image::Image<IndexT>> allLabels;
+    if (!processImageBatch(allLabels, {&source}))
+    {
+        return false;
+    }
+
+    labels.swap(allLabels[0]);
+
+    return true;
+}
+
+bool Segmentation::processImageBatch(std::vector<image::Image<IndexT>>& labels, const std::vector<const image::Image<image::RGBfColor>*>& sources)
 {
     // Todo : handle orientation and small images smaller than model input
 
+    labels.resize(sources.size());
+
+    std::vector<image::Image<ScoredLabel>> scoredLabels(sources.size());
+    std::vector<TileTask> tiles;
+
+    for (std::size_t imageIndex = 0; imageIndex < sources.size(); imageIndex++)
+    {
+        const image::Image<image::RGBfColor>& source = *sources[imageIndex];
+
+        int resizedHeight = 0;
+        int resizedWidth = 0;
+        computeResizedDimensions(resizedWidth, resizedHeight, source);
+
+        // Resize image
+        image::Image<image::RGBfColor> resized;
+        imageAlgo::resizeImage(resizedWidth, resizedHeight, source, resized);
+
+        // Normalize image to fit model statistics
+        for (int i = 0; i < resizedHeight; i++)
+        {
+            for (int j = 0; j < resizedWidth; j++)
+            {
+                image::RGBfColor value = resized(i, j);
+                resized(i, j) = (value - _parameters.center) * _parameters.scale;
+            }
+        }
+
+        scoredLabels[imageIndex] = image::Image<ScoredLabel>(resizedWidth, resizedHeight, true, {0, 0.0f});
+
+        gatherTiles(tiles, imageIndex, resized);
+    }
+
+    // Run inference on the gathered tiles and merge the results into the per-image labelings
+    if (!processTiles(scoredLabels, tiles))
+    {
+        return false;
+    }
+
+    for (std::size_t imageIndex = 0; imageIndex < sources.size(); imageIndex++)
+    {
+        const image::Image<IndexT> resizedLabels = scoredLabels[imageIndex].cast<IndexT>();
+        imageAlgo::resampleImage(sources[imageIndex]->width(), sources[imageIndex]->height(), resizedLabels, labels[imageIndex], false);
+    }
+
+    return true;
+}
+
+void Segmentation::computeResizedDimensions(int& resizedWidth, int& resizedHeight, const image::Image<image::RGBfColor>& source) const
+{
     // Compute the optimal resized size such that:
     // - at last one dimension fit the model
     // - both dimensions are larger or equal than the model dimensions
-    int resizedHeight = 0;
-    int resizedWidth = 0;
     if (source.height() < source.width())
     {
         resizedWidth =
@@ -139,40 +236,14 @@ bool Segmentation::processImage(image::Image<IndexT>& labels, const image::Image
             resizedWidth = _parameters.modelWidth;
         }
     }
-
-    // Resize image
-    image::Image<image::RGBfColor> resized;
-    imageAlgo::resizeImage(resizedWidth, resizedHeight, source, resized);
-
-    // Normalize image to fit model statistics
-    for (int i = 0; i < resizedHeight; i++)
-    {
-        for (int j = 0; j < resizedWidth; j++)
-        {
-            image::RGBfColor value = resized(i, j);
-            resized(i, j) = (value - _parameters.center) * _parameters.scale;
-        }
-    }
-
-    image::Image<IndexT> resizedLabels;
-    if (!tiledProcess(resizedLabels, resized))
-    {
-        return false;
-    }
-
-    imageAlgo::resampleImage(source.width(), source.height(), resizedLabels, labels, false);
-
-    return true;
 }
 
-bool Segmentation::tiledProcess(image::Image<IndexT>& labels, const image::Image<image::RGBfColor>& source)
+void Segmentation::gatherTiles(std::vector<TileTask>& tiles, std::size_t imageIndex, const image::Image<image::RGBfColor>& source) const
 {
     // Compute the theorical tiles count
     int cwidth = divideRoundUp(source.width(), _parameters.modelWidth);
     int cheight = divideRoundUp(source.height(), _parameters.modelHeight);
 
-    image::Image<ScoredLabel> scoredLabels(source.width(), source.height(), true, {0, 0.0f});
-
     // Loop over tiles
     for (int i = 0; i < cheight; i++)
     {
@@ -201,26 +272,41 @@ bool Segmentation::tiledProcess(image::Image<IndexT>& labels, const image::Image
             }
 
             // x and y contains the position of the tile in the input image
-            auto& block = source.block(y, x, _parameters.modelHeight, _parameters.modelWidth);
+            TileTask task;
+            task.imageIndex = imageIndex;
+            task.x = x;
+            task.y = y;
+            imageToPlanes(task.input, source.block(y, x, _parameters.modelHeight, _parameters.modelWidth));
 
-            // Compute tile
-            image::Image<ScoredLabel> tileLabels(_parameters.modelWidth, _parameters.modelHeight, true, {0, 0.0f});
+            tiles.push_back(std::move(task));
+        }
+    }
+}
 
-            if (_parameters.useGpu)
-            {
-                processTileGPU(tileLabels, block);
-            }
-            else
-            {
-                processTile(tileLabels, block);
-            }
+bool Segmentation::processTiles(std::vector<image::Image<ScoredLabel>>& scoredLabels, std::vector<TileTask>& tiles)
+{
+    std::size_t first = 0;
+    while (first < tiles.size())
+    {
+        const std::size_t count = std::min<std::size_t>(_batchSize, tiles.size() - first);
 
-            // Update the global labeling
-            mergeLabels(scoredLabels, tileLabels, x, y);
+        bool succeeded = false;
+        if (_parameters.useGpu)
+        {
+            succeeded = processTileBatchGPU(scoredLabels, tiles, first, count);
+        }
+        else
+        {
+            succeeded = processTileBatch(scoredLabels, tiles, first, count);
+        }
+
+        if (!succeeded)
+        {
+            return false;
         }
-    }
 
-    labels = scoredLabels.cast<IndexT>();
+        first += count;
+    }
 
     return true;
 }
@@ -244,7 +330,7 @@ bool Segmentation::mergeLabels(image::Image<ScoredLabel>& labels, image::Image<S
     return true;
 }
 
-bool Segmentation::labelsFromModelOutput(image::Image<ScoredLabel>& labels, const std::vector<float>& modelOutput)
+bool Segmentation::labelsFromModelOutput(image::Image<ScoredLabel>& labels, const float* modelOutput)
 {
     for (int outputY = 0; outputY < _parameters.modelHeight; outputY++)
     {
@@ -273,25 +359,32 @@ bool Segmentation::labelsFromModelOutput(image::Image<ScoredLabel>& labels, cons
     return true;
 }
 
-bool Segmentation::processTile(image::Image<ScoredLabel>& labels, const image::Image<image::RGBfColor>::Base& source)
+bool Segmentation::processTileBatch(std::vector<image::Image<ScoredLabel>>& scoredLabels, std::vector<TileTask>& tiles, std::size_t first, std::size_t count)
 {
-    ALICEVISION_LOG_TRACE("Process tile using cpu");
+    ALICEVISION_LOG_TRACE("Process batch of " << count << " tile(s) using cpu");
     Ort::MemoryInfo memInfo = Ort::MemoryInfo::CreateCpu(OrtAllocatorType::OrtArenaAllocator, OrtMemType::OrtMemTypeDefault);
 
+    const std::size_t inputSize = 3 * _parameters.modelHeight * _parameters.modelWidth;
+    const std::size_t outputSize = _parameters.classes.size() * _parameters.modelHeight * _parameters.modelWidth;
+
     std::vector<const char*> inputNames{"input"};
     std::vector<const char*> outputNames{"output"};
-    std::vector<int64_t> inputDimensions = {1, 3, _parameters.modelHeight, _parameters.modelWidth};
-    std::vector<int64_t> outputDimensions = {1, static_cast<int64_t>(_parameters.classes.size()), _parameters.modelHeight, _parameters.modelWidth};
+    std::vector<int64_t> inputDimensions = {static_cast<int64_t>(count), 3, _parameters.modelHeight, _parameters.modelWidth};
+    std::vector<int64_t> outputDimensions = {
+      static_cast<int64_t>(count), static_cast<int64_t>(_parameters.classes.size()), _parameters.modelHeight, _parameters.modelWidth};
 
-    std::vector<float> output(_parameters.classes.size() * _parameters.modelHeight * _parameters.modelWidth);
+    std::vector<float> input(count * inputSize);
+    for (std::size_t tileIndex = 0; tileIndex < count; tileIndex++)
+    {
+        std::memcpy(input.data() + tileIndex * inputSize, tiles[first + tileIndex].input.data(), inputSize * sizeof(float));
+    }
+
+    std::vector<float> output(count * outputSize);
     Ort::Value outputTensors =
       Ort::Value::CreateTensor<float>(memInfo, output.data(), output.size(), outputDimensions.data(), outputDimensions.size());
 
-    std::vector<float> transformedInput;
-    imageToPlanes(transformedInput, source);
-
     Ort::Value inputTensors =
-      Ort::Value::CreateTensor<float>(memInfo, transformedInput.data(), transformedInput.size(), inputDimensions.data(), inputDimensions.size());
+      Ort::Value::CreateTensor<float>(memInfo, input.data(), input.size(), inputDimensions.data(), inputDimensions.size());
 
     try
     {
@@ -299,40 +392,76 @@ bool Segmentation::processTile(image::Image<ScoredLabel>& labels, const image::I
     }
     catch (const Ort::Exception& exception)
     {
+        if (count > 1)
+        {
+            // the model may only accept a fixed batch size of one
+            ALICEVISION_LOG_WARNING("Batched inference failed (" << exception.what() << "), falling back to single tile inference.");
+            _batchSize = 1;
+
+            for (std::size_t tileIndex = 0; tileIndex < count; tileIndex++)
+            {
+                if (!processTileBatch(scoredLabels, tiles, first + tileIndex, 1))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
         ALICEVISION_LOG_ERROR("ERROR running model inference: " << exception.what());
         return false;
     }
 
-    if (!labelsFromModelOutput(labels, output))
+    for (std::size_t tileIndex = 0; tileIndex < count; tileIndex++)
     {
-        return false;
+        const TileTask& task = tiles[first + tileIndex];
+
+        image::Image<ScoredLabel> tileLabels(_parameters.modelWidth, _parameters.modelHeight, true, {0, 0.0f});
+        if (!labelsFromModelOutput(tileLabels, output.data() + tileIndex * outputSize))
+        {
+            return false;
+        }
+
+        // Update the global labeling
+        mergeLabels(scoredLabels[task.imageIndex], tileLabels, task.x, task.y);
     }
 
     return true;
 }
 
-bool Segmentation::processTileGPU(image::Image<ScoredLabel>& labels, const image::Image<image::RGBfColor>::Base& source)
+bool Segmentation::processTileBatchGPU(std::vector<image::Image<ScoredLabel>>& scoredLabels,
+                                       std::vector<TileTask>& tiles,
+                                       std::size_t first,
+                                       std::size_t count)
 {
-    ALICEVISION_LOG_TRACE("Process tile using gpu");
+    ALICEVISION_LOG_TRACE("Process batch of " << count << " tile(s) using gpu");
 #if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_CUDA)
     Ort::MemoryInfo mem_info_cuda("Cuda", OrtAllocatorType::OrtArenaAllocator, 0, OrtMemType::OrtMemTypeDefault);
-    Ort::Allocator cudaAllocator(*_ortSession, mem_info_cuda);
+
+    const std::size_t inputSize = 3 * _parameters.modelHeight * _parameters.modelWidth;
+    const std::size_t outputSize = _parameters.classes.size() * _parameters.modelHeight * _parameters.modelWidth;
 
     std::vector<const char*> inputNames{"input"};
     std::vector<const char*> outputNames{"output"};
-    std::vector<int64_t> inputDimensions = {1, 3, _parameters.modelHeight, _parameters.modelWidth};
-    std::vector<int64_t> outputDimensions = {1, static_cast<int64_t>(_parameters.classes.size()), _parameters.modelHeight, _parameters.modelWidth};
+    std::vector<int64_t> inputDimensions = {static_cast<int64_t>(count), 3, _parameters.modelHeight, _parameters.modelWidth};
+    std::vector<int64_t> outputDimensions = {
+      static_cast<int64_t>(count), static_cast<int64_t>(_parameters.classes.size()), _parameters.modelHeight, _parameters.modelWidth};
 
-    Ort::Value outputTensors = Ort::Value::CreateTensor<float>(
-      mem_info_cuda, reinterpret_cast<float*>(_cudaOutput), _output.size(), outputDimensions.data(), outputDimensions.size());
+    // Assemble the batch in the pinned staging buffer and upload it as one DMA transfer,
+    // the inference then runs on device resident tensors.
+    for (std::size_t tileIndex = 0; tileIndex < count; tileIndex++)
+    {
+        std::memcpy(_pinnedInput + tileIndex * inputSize, tiles[first + tileIndex].input.data(), inputSize * sizeof(float));
+    }
 
-    std::vector<float> transformedInput;
-    imageToPlanes(transformedInput, source);
+    cudaMemcpy(_cudaInput, _pinnedInput, sizeof(float) * count * inputSize, cudaMemcpyHostToDevice);
 
-    cudaMemcpy(_cudaInput, transformedInput.data(), sizeof(float) * transformedInput.size(), cudaMemcpyHostToDevice);
+    Ort::Value outputTensors = Ort::Value::CreateTensor<float>(
+      mem_info_cuda, reinterpret_cast<float*>(_cudaOutput), count * outputSize, outputDimensions.data(), outputDimensions.size());
 
     Ort::Value inputTensors = Ort::Value::CreateTensor<float>(
-      mem_info_cuda, reinterpret_cast<float*>(_cudaInput), transformedInput.size(), inputDimensions.data(), inputDimensions.size());
+      mem_info_cuda, reinterpret_cast<float*>(_cudaInput), count * inputSize, inputDimensions.data(), inputDimensions.size());
 
     try
     {
@@ -340,15 +469,41 @@ bool Segmentation::processTileGPU(image::Image<ScoredLabel>& labels, const image
     }
     catch (const Ort::Exception& exception)
     {
+        if (count > 1)
+        {
+            // the model may only accept a fixed batch size of one
+            ALICEVISION_LOG_WARNING("Batched inference failed (" << exception.what() << "), falling back to single tile inference.");
+            _batchSize = 1;
+
+            for (std::size_t tileIndex = 0; tileIndex < count; tileIndex++)
+            {
+                if (!processTileBatchGPU(scoredLabels, tiles, first + tileIndex, 1))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
         ALICEVISION_LOG_ERROR("ERROR running model inference: " << exception.what());
         return false;
     }
 
-    cudaMemcpy(_output.data(), _cudaOutput, sizeof(float) * _output.size(), cudaMemcpyDeviceToHost);
+    cudaMemcpy(_pinnedOutput, _cudaOutput, sizeof(float) * count * outputSize, cudaMemcpyDeviceToHost);
 
-    if (!labelsFromModelOutput(labels, _output))
+    for (std::size_t tileIndex = 0; tileIndex < count; tileIndex++)
     {
-        return false;
+        const TileTask& task = tiles[first + tileIndex];
+
+        image::Image<ScoredLabel> tileLabels(_parameters.modelWidth, _parameters.modelHeight, true, {0, 0.0f});
+        if (!labelsFromModelOutput(tileLabels, _pinnedOutput + tileIndex * outputSize))
+        {
+            return false;
+        }
+
+        // Update the global labeling
+        mergeLabels(scoredLabels[task.imageIndex], tileLabels, task.x, task.y);
     }
 
 #endif
@@ -357,4 +512,4 @@ bool Segmentation::processTileGPU(image::Image<ScoredLabel>& labels, const image
 }
 
 }  // namespace segmentation
-}  // namespace aliceVision
\ No newline at end of file
+}  // namespace aliceVision
@@ -40,6 +40,9 @@ class Segmentation
         int modelHeight;
         double overlapRatio;
         bool useGpu = true;
+        /// maximal number of tiles per inference batch, the effective batch size is
+        /// reduced to what fits in the device memory
+        int maxBatchSize = 8;
     };
 
   public:
@@ -66,7 +69,30 @@ class Segmentation
      */
     bool processImage(image::Image<IndexT>& labels, const image::Image<image::RGBfColor>& source);
 
+    /**
+     * Process a group of input images to estimate their segmentations.
+     * The tiles of all the images are gathered into shared inference batches, so small images
+     * do not leave the model underutilized.
+     * @param labels the labels images resulting from the process, one per source image
+     * @param sources the input images to process
+     */
+    bool processImageBatch(std::vector<image::Image<IndexT>>& labels, const std::vector<const image::Image<image::RGBfColor>*>& sources);
+
   private:
+    /**
+     * One tile of an image of the batch, waiting for inference
+     */
+    struct TileTask
+    {
+        /// index of the source image in the batch
+        std::size_t imageIndex;
+        /// position of the tile in the resized image
+        int x;
+        int y;
+        /// tile content as r, g, b planes of the model input size
+        std::vector<float> input;
+    };
+
     /**
      * Onnx creation code
      */
@@ -78,32 +104,55 @@ class Segmentation
     bool terminate();
 
     /**
-     * Assume the source image is the correct size
-     * @param labels the output label image
+     * Compute the optimal resized size such that:
+     * - at least one dimension fits the model
+     * - both dimensions are larger or equal than the model dimensions
+     * @param resizedWidth the computed resized width
+     * @param resizedHeight the computed resized height
      * @param source the input image to process
      */
-    bool tiledProcess(image::Image<IndexT>& labels, const image::Image<image::RGBfColor>& source);
+    void computeResizedDimensions(int& resizedWidth, int& resizedHeight, const image::Image<image::RGBfColor>& source) const;
 
     /**
-     * Transform model output to a label image
-     * @param labels the output labels imaage
-     * @param modeloutput the model output vector
+     * Cut a resized image into overlapping tiles of the model input size
+     * @param tiles the tile list to append to
+     * @param imageIndex the index of the source image in the batch
+     * @param source the resized and normalized image
      */
-    bool labelsFromModelOutput(image::Image<ScoredLabel>& labels, const std::vector<float>& modelOutput);
+    void gatherTiles(std::vector<TileTask>& tiles, std::size_t imageIndex, const image::Image<image::RGBfColor>& source) const;
 
     /**
-     * Process effectively a buffer of the model input size
-     * param labels the output labels
-     * @param source the source tile
+     * Run inference on all the gathered tiles, batch by batch, and merge each tile labeling
+     * into the labels image of its source image
+     * @param scoredLabels the labels images, one per source image
+     * @param tiles the gathered tiles
      */
-    bool processTile(image::Image<ScoredLabel>& labels, const image::Image<image::RGBfColor>::Base& source);
+    bool processTiles(std::vector<image::Image<ScoredLabel>>& scoredLabels, std::vector<TileTask>& tiles);
 
     /**
-     * Process effectively a buffer of the model input size
-     * param labels the output labels
-     * @param source the source tile
+     * Transform one sample of the model output to a label image
+     * @param labels the output labels image
+     * @param modelOutput the model output for this sample (classes * height * width floats)
      */
-    bool processTileGPU(image::Image<ScoredLabel>& labels, const image::Image<image::RGBfColor>::Base& source);
+    bool labelsFromModelOutput(image::Image<ScoredLabel>& labels, const float* modelOutput);
+
+    /**
+     * Process effectively a batch of tiles of the model input size
+     * @param scoredLabels the labels images to merge the batch results into
+     * @param tiles the gathered tiles
+     * @param first the index of the first tile of the batch
+     * @param count the number of tiles of the batch
+     */
+    bool processTileBatch(std::vector<image::Image<ScoredLabel>>& scoredLabels, std::vector<TileTask>& tiles, std::size_t first, std::size_t count);
+
+    /**
+     * Process effectively a batch of tiles of the model input size
+     * @param scoredLabels the labels images to merge the batch results into
+     * @param tiles the gathered tiles
+     * @param first the index of the first tile of the batch
+     * @param count the number of tiles of the batch
+     */
+    bool processTileBatchGPU(std::vector<image::Image<ScoredLabel>>& scoredLabels, std::vector<TileTask>& tiles, std::size_t first, std::size_t count);
 
     /**
      * Merge tile labels with global labels image
@@ -119,13 +168,19 @@ class Segmentation
     std::unique_ptr<Ort::Env> _ortEnvironment;
     std::unique_ptr<Ort::Session> _ortSession;
 
+    /// effective batch size, at most maxBatchSize and reduced to fit the device memory
+    int _batchSize = 1;
+
     std::vector<float> _output;
 
 #if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_CUDA)
-    void* _cudaOutput;
-    void* _cudaInput;
+    void* _cudaOutput = nullptr;
+    void* _cudaInput = nullptr;
+    /// pinned host staging buffers, so the host/device copies are DMA transfers
+    float* _pinnedInput = nullptr;
+    float* _pinnedOutput = nullptr;
 #endif
 };
 
 }  // namespace segmentation
-}  // namespace aliceVision
\ No newline at end of file
+}  // namespace aliceVision
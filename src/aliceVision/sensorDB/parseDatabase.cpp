@@ -17,18 +17,128 @@
 #include <algorithm>
 #include <fstream>
 #include <iterator>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
 
 namespace fs = std::filesystem;
 
 namespace aliceVision {
 namespace sensorDB {
 
+namespace {
+
+/// magic tag and version of the binary sensor database cache
+const char databaseCacheMagic[8] = {'A', 'V', 'S', 'D', 'B', 'C', '0', '1'};
+
+/// last write time of the given file as a raw tick count, used to validate the cache
+std::int64_t databaseWriteTime(const std::string& filePath) { return static_cast<std::int64_t>(fs::last_write_time(filePath).time_since_epoch().count()); }
+
+bool loadDatabaseCache(const std::string& cacheFilePath,
+                       std::int64_t sourceWriteTime,
+                       std::uint64_t sourceSize,
+                       std::vector<Datasheet>& databaseStructure)
+{
+    std::ifstream fileIn(cacheFilePath, std::ios::binary);
+    if (!fileIn)
+        return false;
+
+    char magic[sizeof(databaseCacheMagic)];
+    fileIn.read(magic, sizeof(magic));
+    if (!fileIn || !std::equal(std::begin(magic), std::end(magic), std::begin(databaseCacheMagic)))
+        return false;
+
+    std::int64_t writeTime = 0;
+    std::uint64_t size = 0;
+    fileIn.read(reinterpret_cast<char*>(&writeTime), sizeof(writeTime));
+    fileIn.read(reinterpret_cast<char*>(&size), sizeof(size));
+    if (!fileIn || writeTime != sourceWriteTime || size != sourceSize)
+        return false;
+
+    std::uint64_t nbDatasheets = 0;
+    fileIn.read(reinterpret_cast<char*>(&nbDatasheets), sizeof(nbDatasheets));
+    // every datasheet comes from at least one byte of the source file
+    if (!fileIn || nbDatasheets > sourceSize)
+        return false;
+
+    const auto readString = [&fileIn](std::string& out) -> bool {
+        std::uint32_t length = 0;
+        fileIn.read(reinterpret_cast<char*>(&length), sizeof(length));
+        if (!fileIn)
+            return false;
+        out.resize(length);
+        fileIn.read(&out[0], length);
+        return !fileIn.fail();
+    };
+
+    std::vector<Datasheet> datasheets;
+    datasheets.reserve(nbDatasheets);
+    for (std::uint64_t i = 0; i < nbDatasheets; ++i)
+    {
+        std::string brand;
+        std::string model;
+        double sensorWidth = 0.0;
+        if (!readString(brand) || !readString(model))
+            return false;
+        fileIn.read(reinterpret_cast<char*>(&sensorWidth), sizeof(sensorWidth));
+        if (fileIn.fail())
+            return false;
+        datasheets.emplace_back(brand, model, sensorWidth);
+    }
+
+    databaseStructure.insert(databaseStructure.end(), datasheets.begin(), datasheets.end());
+    return true;
+}
+
+void saveDatabaseCache(const std::string& cacheFilePath,
+                       std::int64_t sourceWriteTime,
+                       std::uint64_t sourceSize,
+                       const std::vector<Datasheet>& databaseStructure)
+{
+    std::ofstream fileOut(cacheFilePath, std::ios::binary | std::ios::trunc);
+    // the database often lives in a read-only install folder, the cache is only best effort
+    if (!fileOut)
+        return;
+
+    fileOut.write(databaseCacheMagic, sizeof(databaseCacheMagic));
+    fileOut.write(reinterpret_cast<const char*>(&sourceWriteTime), sizeof(sourceWriteTime));
+    fileOut.write(reinterpret_cast<const char*>(&sourceSize), sizeof(sourceSize));
+
+    const std::uint64_t nbDatasheets = databaseStructure.size();
+    fileOut.write(reinterpret_cast<const char*>(&nbDatasheets), sizeof(nbDatasheets));
+
+    const auto writeString = [&fileOut](const std::string& in) {
+        const std::uint32_t length = static_cast<std::uint32_t>(in.size());
+        fileOut.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        fileOut.write(in.data(), length);
+    };
+
+    for (const Datasheet& datasheet : databaseStructure)
+    {
+        writeString(datasheet._brand);
+        writeString(datasheet._model);
+        fileOut.write(reinterpret_cast<const char*>(&datasheet._sensorWidth), sizeof(datasheet._sensorWidth));
+    }
+}
+
+}  // namespace
+
 bool parseDatabase(const std::string& databaseFilePath, std::vector<Datasheet>& databaseStructure)
 {
     std::ifstream fileIn(databaseFilePath);
     if (!fileIn || !fs::exists(databaseFilePath) || !fs::is_regular_file(databaseFilePath))
         return false;
 
+    // reload the binary cache of a previous run when it still matches the text database,
+    // so that the whole file is not tokenized again on every process start
+    const std::string cacheFilePath = databaseFilePath + ".bin";
+    const std::int64_t sourceWriteTime = databaseWriteTime(databaseFilePath);
+    const std::uint64_t sourceSize = static_cast<std::uint64_t>(fs::file_size(databaseFilePath));
+
+    if (fs::exists(cacheFilePath) && loadDatabaseCache(cacheFilePath, sourceWriteTime, sourceSize, databaseStructure))
+        return true;
+
     std::string line;
     while (fileIn.good())
     {
@@ -50,19 +160,47 @@ bool parseDatabase(const std::string& databaseFilePath, std::vector<Datasheet>&
             }
         }
     }
+
+    saveDatabaseCache(cacheFilePath, sourceWriteTime, sourceSize, databaseStructure);
     return true;
 }
 
 bool getInfo(const std::string& brand, const std::string& model, const std::vector<Datasheet>& databaseStructure, Datasheet& datasheetContent)
 {
-    Datasheet refDatasheet(brand, model, -1.);
-    auto datasheet = std::find(databaseStructure.begin(), databaseStructure.end(), refDatasheet);
+    // The comparison is fuzzy (see Datasheet::operator==) and scans the whole database, while a
+    // large ingest repeats the same few brand/model queries for every view: memoize the result of
+    // each distinct query so that only its first occurrence pays for the scan.
+    static std::mutex queryCacheMutex;
+    static std::unordered_map<std::string, std::pair<bool, Datasheet>> queryCache;
 
-    if (datasheet == databaseStructure.end())
-        return false;
+    const std::string queryKey = std::to_string(reinterpret_cast<std::uintptr_t>(databaseStructure.data())) + ';' +
+                                 std::to_string(databaseStructure.size()) + ';' + brand + ';' + model;
 
-    datasheetContent = *datasheet;
-    return true;
+    {
+        std::lock_guard<std::mutex> lock(queryCacheMutex);
+        const auto it = queryCache.find(queryKey);
+        if (it != queryCache.end())
+        {
+            if (!it->second.first)
+                return false;
+            datasheetContent = it->second.second;
+            return true;
+        }
+    }
+
+    const Datasheet refDatasheet(brand, model, -1.);
+    const auto datasheet = std::find(databaseStructure.begin(), databaseStructure.end(), refDatasheet);
+    const bool found = (datasheet != databaseStructure.end());
+
+    if (found)
+        datasheetContent = *datasheet;
+
+    {
+        std::lock_guard<std::mutex> lock(queryCacheMutex);
+        queryCache.emplace(queryKey, std::make_pair(found, found ? *datasheet : Datasheet()));
+    }
+
+    return found;
 }
 
 }  // namespace sensorDB
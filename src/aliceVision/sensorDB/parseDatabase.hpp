@@ -16,7 +16,9 @@ namespace aliceVision {
 namespace sensorDB {
 
 /**
- * @brief Parse the given sensor database
+ * @brief Parse the given sensor database.
+ * A binary cache of the parsed file is maintained next to it (".bin" suffix) and reloaded
+ * on the next runs as long as the text database has not been modified since.
  * @param[in] databaseFilePath The file path of the given database
  * @param[out] databaseStructure The database in memory
  * @return True if ok
@@ -24,7 +26,9 @@ namespace sensorDB {
 bool parseDatabase(const std::string& databaseFilePath, std::vector<Datasheet>& databaseStructure);
 
 /**
- * @brief Get information for the given camera brand / model
+ * @brief Get information for the given camera brand / model.
+ * The result of each distinct query is memoized in a hashed index, so repeating the same
+ * query over many views only scans the database once.
  * @param[in] brand The camera brand
  * @param[in] model The camera model
  * @param[in] databaseStructure The database in memory
@@ -7,6 +7,7 @@
 
 #include <aliceVision/sensorDB/parseDatabase.hpp>
 
+#include <algorithm>
 #include <filesystem>
 #include <string>
 
@@ -99,6 +100,30 @@ BOOST_AUTO_TEST_CASE(ParseDatabaseCanon_EOS_5D_Mark_II)
     BOOST_CHECK_EQUAL(36, datasheet._sensorWidth);
 }
 
+BOOST_AUTO_TEST_CASE(ParseDatabaseBinaryCache)
+{
+    // parse a writable copy of the database twice: the first run writes the binary cache,
+    // the second run reloads it and must yield the very same datasheets
+    const fs::path tmpDatabase = fs::temp_directory_path() / "cameraSensors_cacheTest.db";
+    fs::copy_file(sDatabase, tmpDatabase, fs::copy_options::overwrite_existing);
+    const fs::path tmpCache = fs::path(tmpDatabase.string() + ".bin");
+    fs::remove(tmpCache);
+
+    std::vector<Datasheet> parsedDatabase;
+    BOOST_CHECK(parseDatabase(tmpDatabase.string(), parsedDatabase));
+    BOOST_CHECK(fs::exists(tmpCache));
+
+    std::vector<Datasheet> cachedDatabase;
+    BOOST_CHECK(parseDatabase(tmpDatabase.string(), cachedDatabase));
+    BOOST_CHECK_EQUAL(parsedDatabase.size(), cachedDatabase.size());
+    BOOST_CHECK(std::equal(parsedDatabase.begin(), parsedDatabase.end(), cachedDatabase.begin(), [](const Datasheet& a, const Datasheet& b) {
+        return a._brand == b._brand && a._model == b._model && a._sensorWidth == b._sensorWidth;
+    }));
+
+    fs::remove(tmpCache);
+    fs::remove(tmpDatabase);
+}
+
 BOOST_AUTO_TEST_CASE(ParseDatabaseCanon_EOS_1100D)
 {
     std::vector<Datasheet> vec_database;
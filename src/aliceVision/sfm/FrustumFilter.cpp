@@ -14,7 +14,9 @@
 #include <aliceVision/geometry/HalfPlane.hpp>
 #include <aliceVision/config.hpp>
 
+#include <algorithm>
 #include <fstream>
+#include <limits>
 
 namespace aliceVision {
 namespace sfm {
@@ -58,6 +60,12 @@ void FrustumFilter::initFrustum(const sfmData::SfMData& sfmData)
 
 PairSet FrustumFilter::getFrustumIntersectionPairs() const
 {
+    // Truncated frusta are bounded by their support points, so a sweep and prune broad
+    // phase over their axis aligned bounding boxes can discard most of the N^2 pairs
+    // before running the exact (and much more expensive) half-plane intersection test.
+    if (_bTruncated)
+        return getFrustumIntersectionPairsSweep();
+
     PairSet pairs;
     // List active view Id
     std::vector<IndexT> viewIds;
@@ -86,6 +94,77 @@ PairSet FrustumFilter::getFrustumIntersectionPairs() const
     return pairs;
 }
 
+PairSet FrustumFilter::getFrustumIntersectionPairsSweep() const
+{
+    struct BoundingBox
+    {
+        Vec3 min;
+        Vec3 max;
+        IndexT viewId;
+
+        bool overlap(const BoundingBox& other) const
+        {
+            return (min.x() <= other.max.x() && other.min.x() <= max.x()) && (min.y() <= other.max.y() && other.min.y() <= max.y()) &&
+                   (min.z() <= other.max.z() && other.min.z() <= max.z());
+        }
+    };
+
+    // Compute the axis aligned bounding box of each frustum from its support points
+    std::vector<BoundingBox> boxes;
+    boxes.reserve(frustum_perView.size());
+    for (FrustumsT::const_iterator it = frustum_perView.begin(); it != frustum_perView.end(); ++it)
+    {
+        BoundingBox box;
+        box.min = Vec3::Constant(std::numeric_limits<double>::max());
+        box.max = Vec3::Constant(std::numeric_limits<double>::lowest());
+        for (const Vec3& point : it->second.points)
+        {
+            box.min = box.min.cwiseMin(point);
+            box.max = box.max.cwiseMax(point);
+        }
+        box.viewId = it->first;
+        boxes.push_back(box);
+    }
+
+    // Sort along the X axis, so the inner sweep can stop at the first box starting
+    // past the end of the current one
+    std::sort(boxes.begin(), boxes.end(), [](const BoundingBox& a, const BoundingBox& b) { return a.min.x() < b.min.x(); });
+
+    auto progressDisplay = system::createConsoleProgressDisplay(boxes.size(), std::cout, "\nCompute frustum intersection\n");
+
+    PairSet pairs;
+
+#pragma omp parallel
+    {
+        PairSet pairsPerThread;
+
+#pragma omp for nowait
+        for (int i = 0; i < (int)boxes.size(); ++i)
+        {
+            const Frustum& frustum = frustum_perView.at(boxes[i].viewId);
+            for (size_t j = i + 1; j < boxes.size(); ++j)
+            {
+                if (boxes[j].min.x() > boxes[i].max.x())
+                    break;
+
+                if (!boxes[i].overlap(boxes[j]))
+                    continue;
+
+                if (frustum.intersect(frustum_perView.at(boxes[j].viewId)))
+                {
+                    pairsPerThread.insert(std::make_pair(std::min(boxes[i].viewId, boxes[j].viewId), std::max(boxes[i].viewId, boxes[j].viewId)));
+                }
+            }
+            ++progressDisplay;
+        }
+
+#pragma omp critical
+        pairs.insert(pairsPerThread.begin(), pairsPerThread.end());
+    }
+
+    return pairs;
+}
+
 // Export defined frustum in PLY file for viewing
 bool FrustumFilter::exportPly(const std::string& filename) const
 {
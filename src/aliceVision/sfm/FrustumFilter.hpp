@@ -39,6 +39,10 @@ class FrustumFilter
     /// Init near and far plane depth from SfMData structure or defined value
     void init_z_near_z_far_depth(const sfmData::SfMData& sfmData, const double zNear = -1., const double zFar = -1.);
 
+    /// return intersecting View frustum pairs using a sweep and prune broad phase
+    /// over the frustum bounding boxes (truncated frusta only)
+    PairSet getFrustumIntersectionPairsSweep() const;
+
     // Data
 
     /// tell if we use truncated or infinite frustum
@@ -196,23 +196,22 @@ bool LocalBundleAdjustmentGraph::removeViews(const sfmData::SfMData& sfmData, co
 
 int LocalBundleAdjustmentGraph::getPoseDistance(const IndexT poseId) const
 {
-    if (_distancePerPoseId.find(poseId) == _distancePerPoseId.end())
-    {
-        ALICEVISION_LOG_DEBUG("The pose #" << poseId << " does not exist in the '_mapDistancePerPoseId' (map size: " << _distancePerPoseId.size()
-                                           << ") \n");
+    const auto it = _distancePerPoseId.find(poseId);
+    // the distance maps only contain the poses reached within the active region,
+    // a missing pose is simply beyond it (or not connected to the new views).
+    if (it == _distancePerPoseId.end())
         return -1;
-    }
-    return _distancePerPoseId.at(poseId);
+    return it->second;
 }
 
 int LocalBundleAdjustmentGraph::getViewDistance(const IndexT viewId) const
 {
-    if (_distancePerViewId.find(viewId) == _distancePerViewId.end())
-    {
-        ALICEVISION_LOG_DEBUG("Cannot get the graph-distance of the view #" << viewId << ": does not exist in the '_mapDistancePerViewId':\n");
+    const auto it = _distancePerViewId.find(viewId);
+    // the distance maps only contain the views reached within the active region,
+    // a missing view is simply beyond it (or not connected to the new views).
+    if (it == _distancePerViewId.end())
         return -1;
-    }
-    return _distancePerViewId.at(viewId);
+    return it->second;
 }
 
 EEstimatorParameterState LocalBundleAdjustmentGraph::getStateFromDistance(int distance) const
@@ -321,23 +320,29 @@ void LocalBundleAdjustmentGraph::computeGraphDistances(const sfmData::SfMData& s
         else
             bfs.addSource(it->second);
     }
-    bfs.start();
 
-    // handle bfs results (distances)
-    for (const auto& x : _nodePerViewId)  // each node in the graph
-    {
-        auto& node = x.second;
-        int d = -1;
+    // only the distances in [0; D+1] discriminate the parameter states (anything farther is
+    // Ignored, like an unreached node), so the visit stops at the boundary of the active region
+    // instead of traversing the whole pose graph: the cost stays proportional to the size of
+    // the neighborhood of the new views, not to the size of the reconstruction.
+    const int maxDistance = static_cast<int>(_graphDistanceLimit) + 1;
+    std::vector<lemon::ListGraph::Node> reachedNodes;
 
-        if (bfs.reached(node))
-        {
-            d = bfs.dist(node);
-            // dist(): "If node v is not reached from the root(s), then the return value of this function is undefined."
-            // this is why the distance is previously set to -1.
-        }
-        _distancePerViewId[x.first] = d;
+    while (!bfs.emptyQueue())
+    {
+        const lemon::ListGraph::Node node = bfs.nextNode();
+        if (bfs.dist(node) > maxDistance)
+            break;  // nodes are processed by increasing distance, all the remaining ones are farther
+        bfs.processNextNode();
+        reachedNodes.push_back(node);
     }
 
+    // handle bfs results (distances)
+    // views that are not reached within the active region are left out of the map:
+    // getViewDistance() returns -1 for them, which maps to the Ignored state.
+    for (const lemon::ListGraph::Node& node : reachedNodes)
+        _distancePerViewId[_viewIdPerNode[node]] = bfs.dist(node);
+
     // re-mapping from <ViewId, distance> to <PoseId, distance>:
     for (auto x : _distancePerViewId)
     {
@@ -622,7 +627,7 @@ void LocalBundleAdjustmentGraph::drawGraph(const sfmData::SfMData& sfmData, cons
     for (lemon::ListGraph::NodeIt n(_graph); n != lemon::INVALID; ++n)
     {
         const IndexT viewId = _viewIdPerNode[n];
-        const int viewDist = _distancePerViewId[viewId];
+        const int viewDist = getViewDistance(viewId);
 
         std::string color = ", color=";
         if (viewDist == 0)
@@ -151,8 +151,11 @@ class LocalBundleAdjustmentGraph
                                  const std::size_t kMinNbOfMatches = 50);
 
     /**
-     * @brief Compute the intragraph-distance between all the nodes of the graph (posed views) and the newly resected views.
+     * @brief Compute the intragraph-distance between the nodes of the graph (posed views) and the newly resected views.
      * @details The graph-distances are computed using a Breadth-first Search (BFS) method.
+     *          The visit stops at the boundary of the active region (distance limit + 1), as any
+     *          farther view maps to the Ignored state anyway: the cost is proportional to the
+     *          neighborhood of the new views instead of the whole pose graph.
      * @param[in] sfmData contains all the information about the reconstruction, notably the posed views
      * @param[in] newReconstructedViews The list of the newly resected views used (used as source in the BFS algorithm)
      */
@@ -204,14 +207,16 @@ class LocalBundleAdjustmentGraph
     /**
      * @brief Return the distance between a specific pose and the new posed views.
      * @param[in] poseId is the index of the poseId
-     * @return Return \c -1 if the pose is not connected to any new posed view.
+     * @return Return \c -1 if the pose is not connected to any new posed view
+     *         or is beyond the active region tracked by computeGraphDistances().
      */
     int getPoseDistance(const IndexT poseId) const;
 
     /**
      * @brief Return the distance between a specific view and the new posed views.
      * @param[in] viewId is the index of the view
-     * @return Return \c -1 if the view is not connected to any new posed view.
+     * @return Return \c -1 if the view is not connected to any new posed view
+     *         or is beyond the active region tracked by computeGraphDistances().
      */
     int getViewDistance(const IndexT viewId) const;
 
@@ -303,9 +308,11 @@ class LocalBundleAdjustmentGraph
     std::map<IndexT, lemon::ListGraph::Node> _nodePerViewId;
     /// Associates each node (in the graph) to its corresponding view.
     std::map<lemon::ListGraph::Node, IndexT> _viewIdPerNode;
-    /// Store the graph-distances from the new views (0: is a new view, -1: is not connected to the new views)
+    /// Store the graph-distances from the new views (0: is a new view), limited to the views
+    /// reached within the active region; a missing view reads as -1 (Ignored).
     std::map<IndexT, int> _distancePerViewId;
-    /// Store the graph-distances from the new poses (0: is a new pose, -1: is not connected to the new poses)
+    /// Store the graph-distances from the new poses (0: is a new pose), limited to the poses
+    /// reached within the active region; a missing pose reads as -1 (Ignored).
     std::map<IndexT, int> _distancePerPoseId;
     /// Store the \c EEstimatorParameterState of each pose in the scene.
     std::map<IndexT, EEstimatorParameterState> _statePerPoseId;
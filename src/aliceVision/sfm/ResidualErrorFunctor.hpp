@@ -34,7 +34,8 @@ struct ResidualErrorFunctor_Pinhole
 {
     explicit ResidualErrorFunctor_Pinhole(int w, int h, const sfmData::Observation& obs)
       : _center(double(w) * 0.5, double(h) * 0.5),
-        _obs(obs)
+        _obs(obs.getX(), obs.getY()),
+        _invScale(obs.getScale() > 0.0 ? 1.0 / obs.getScale() : 1.0)
     {}
 
     // Enum to map intrinsics parameters between aliceVision & ceres camera data parameter block.
@@ -59,10 +60,9 @@ struct ResidualErrorFunctor_Pinhole
         const T projected_y = principal_point_y + focalY * y_u;
 
         // Compute and return the error is the difference between the predicted
-        //  and observed position
-        const T scale(_obs.getScale() > 0.0 ? _obs.getScale() : 1.0);
-        out_residuals[0] = (projected_x - T(_obs.getX())) / scale;
-        out_residuals[1] = (projected_y - T(_obs.getY())) / scale;
+        //  and observed position, scaled by the observation confidence
+        out_residuals[0] = (projected_x - T(_obs(0))) * T(_invScale);
+        out_residuals[1] = (projected_y - T(_obs(1))) * T(_invScale);
     }
 
     template<typename T>
@@ -156,7 +156,8 @@ struct ResidualErrorFunctor_Pinhole
         return true;
     }
 
-    const sfmData::Observation _obs;  // The 2D observation
+    const Vec2 _obs;         // The 2D observation
+    const double _invScale;  // Inverse of the observation scale (1 when the feature has no scale)
     const Vec2 _center;
 };
 
@@ -175,7 +176,8 @@ struct ResidualErrorFunctor_PinholeRadialK1
 {
     explicit ResidualErrorFunctor_PinholeRadialK1(int w, int h, const sfmData::Observation& obs)
       : _center(double(w) * 0.5, double(h) * 0.5),
-        _obs(obs)
+        _obs(obs.getX(), obs.getY()),
+        _invScale(obs.getScale() > 0.0 ? 1.0 / obs.getScale() : 1.0)
     {}
 
     // Enum to map intrinsics parameters between aliceVision & ceres camera data parameter block.
@@ -208,10 +210,9 @@ struct ResidualErrorFunctor_PinholeRadialK1
         const T projected_y = principal_point_y + focalY * y_d;
 
         // Compute and return the error is the difference between the predicted
-        //  and observed position
-        const T scale(_obs.getScale() > 0.0 ? _obs.getScale() : 1.0);
-        out_residuals[0] = (projected_x - T(_obs.getX())) / scale;
-        out_residuals[1] = (projected_y - T(_obs.getY())) / scale;
+        //  and observed position, scaled by the observation confidence
+        out_residuals[0] = (projected_x - T(_obs(0))) * T(_invScale);
+        out_residuals[1] = (projected_y - T(_obs(1))) * T(_invScale);
     }
 
     template<typename T>
@@ -302,7 +303,8 @@ struct ResidualErrorFunctor_PinholeRadialK1
         return true;
     }
 
-    const sfmData::Observation _obs;  // The 2D observation
+    const Vec2 _obs;         // The 2D observation
+    const double _invScale;  // Inverse of the observation scale (1 when the feature has no scale)
     const Vec2 _center;
 };
 
@@ -321,7 +323,8 @@ struct ResidualErrorFunctor_PinholeRadialK3
 {
     explicit ResidualErrorFunctor_PinholeRadialK3(int w, int h, const sfmData::Observation& obs)
       : _center(double(w) * 0.5, double(h) * 0.5),
-        _obs(obs)
+        _obs(obs.getX(), obs.getY()),
+        _invScale(obs.getScale() > 0.0 ? 1.0 / obs.getScale() : 1.0)
     {}
 
     // Enum to map intrinsics parameters between aliceVision & ceres camera data parameter block.
@@ -360,10 +363,9 @@ struct ResidualErrorFunctor_PinholeRadialK3
         const T projected_y = principal_point_y + focalY * y_d;
 
         // Compute and return the error is the difference between the predicted
-        //  and observed position
-        const T scale(_obs.getScale() > 0.0 ? _obs.getScale() : 1.0);
-        out_residuals[0] = (projected_x - T(_obs.getX())) / scale;
-        out_residuals[1] = (projected_y - T(_obs.getY())) / scale;
+        //  and observed position, scaled by the observation confidence
+        out_residuals[0] = (projected_x - T(_obs(0))) * T(_invScale);
+        out_residuals[1] = (projected_y - T(_obs(1))) * T(_invScale);
     }
 
     template<typename T>
@@ -448,7 +450,8 @@ struct ResidualErrorFunctor_PinholeRadialK3
         return true;
     }
 
-    const sfmData::Observation _obs;  // The 2D observation
+    const Vec2 _obs;         // The 2D observation
+    const double _invScale;  // Inverse of the observation scale (1 when the feature has no scale)
     const Vec2 _center;
 };
 
@@ -467,7 +470,8 @@ struct ResidualErrorFunctor_PinholeBrownT2
 {
     explicit ResidualErrorFunctor_PinholeBrownT2(int w, int h, const sfmData::Observation& obs)
       : _center(double(w) * 0.5, double(h) * 0.5),
-        _obs(obs)
+        _obs(obs.getX(), obs.getY()),
+        _invScale(obs.getScale() > 0.0 ? 1.0 / obs.getScale() : 1.0)
     {}
 
     // Enum to map intrinsics parameters between aliceVision & ceres camera data parameter block.
@@ -512,10 +516,9 @@ struct ResidualErrorFunctor_PinholeBrownT2
         const T projected_y = principal_point_y + focalY * y_d;
 
         // Compute and return the error is the difference between the predicted
-        //  and observed position
-        const T scale(_obs.getScale() > 0.0 ? _obs.getScale() : 1.0);
-        out_residuals[0] = (projected_x - T(_obs.getX())) / scale;
-        out_residuals[1] = (projected_y - T(_obs.getY())) / scale;
+        //  and observed position, scaled by the observation confidence
+        out_residuals[0] = (projected_x - T(_obs(0))) * T(_invScale);
+        out_residuals[1] = (projected_y - T(_obs(1))) * T(_invScale);
     }
 
     template<typename T>
@@ -606,7 +609,8 @@ struct ResidualErrorFunctor_PinholeBrownT2
         return true;
     }
 
-    const sfmData::Observation _obs;  // The 2D observation
+    const Vec2 _obs;         // The 2D observation
+    const double _invScale;  // Inverse of the observation scale (1 when the feature has no scale)
     const Vec2 _center;
 };
 
@@ -625,7 +629,8 @@ struct ResidualErrorFunctor_PinholeFisheye
 {
     explicit ResidualErrorFunctor_PinholeFisheye(int w, int h, const sfmData::Observation& obs)
       : _center(double(w) * 0.5, double(h) * 0.5),
-        _obs(obs)
+        _obs(obs.getX(), obs.getY()),
+        _invScale(obs.getScale() > 0.0 ? 1.0 / obs.getScale() : 1.0)
     {}
 
     // Enum to map intrinsics parameters between aliceVision & ceres camera data parameter block.
@@ -671,10 +676,9 @@ struct ResidualErrorFunctor_PinholeFisheye
         const T projected_y = principal_point_y + focalY * y_d;
 
         // Compute and return the error is the difference between the predicted
-        //  and observed position
-        const T scale(_obs.getScale() > 0.0 ? _obs.getScale() : 1.0);
-        out_residuals[0] = (projected_x - T(_obs.getX())) / scale;
-        out_residuals[1] = (projected_y - T(_obs.getY())) / scale;
+        //  and observed position, scaled by the observation confidence
+        out_residuals[0] = (projected_x - T(_obs(0))) * T(_invScale);
+        out_residuals[1] = (projected_y - T(_obs(1))) * T(_invScale);
     }
 
     template<typename T>
@@ -765,7 +769,8 @@ struct ResidualErrorFunctor_PinholeFisheye
         return true;
     }
 
-    const sfmData::Observation _obs;  // The 2D observation
+    const Vec2 _obs;         // The 2D observation
+    const double _invScale;  // Inverse of the observation scale (1 when the feature has no scale)
     const Vec2 _center;
 };
 
@@ -784,7 +789,8 @@ struct ResidualErrorFunctor_PinholeFisheye1
 {
     explicit ResidualErrorFunctor_PinholeFisheye1(int w, int h, const sfmData::Observation& obs)
       : _center(double(w) * 0.5, double(h) * 0.5),
-        _obs(obs)
+        _obs(obs.getX(), obs.getY()),
+        _invScale(obs.getScale() > 0.0 ? 1.0 / obs.getScale() : 1.0)
     {}
 
     // Enum to map intrinsics parameters between aliceVision & ceres camera data parameter block.
@@ -818,10 +824,9 @@ struct ResidualErrorFunctor_PinholeFisheye1
         const T projected_y = principal_point_y + focalY * y_d;
 
         // Compute and return the error is the difference between the predicted
-        //  and observed position
-        const T scale(_obs.getScale() > 0.0 ? _obs.getScale() : 1.0);
-        out_residuals[0] = (projected_x - T(_obs.getX())) / scale;
-        out_residuals[1] = (projected_y - T(_obs.getY())) / scale;
+        //  and observed position, scaled by the observation confidence
+        out_residuals[0] = (projected_x - T(_obs(0))) * T(_invScale);
+        out_residuals[1] = (projected_y - T(_obs(1))) * T(_invScale);
     }
 
     template<typename T>
@@ -912,7 +917,8 @@ struct ResidualErrorFunctor_PinholeFisheye1
         return true;
     }
 
-    const sfmData::Observation _obs;  // The 2D observation
+    const Vec2 _obs;         // The 2D observation
+    const double _invScale;  // Inverse of the observation scale (1 when the feature has no scale)
     const Vec2 _center;
 };
 
@@ -931,7 +937,8 @@ struct ResidualErrorFunctor_Pinhole3DEClassicLD
 {
     explicit ResidualErrorFunctor_Pinhole3DEClassicLD(int w, int h, const sfmData::Observation& obs)
       : _center(double(w) * 0.5, double(h) * 0.5),
-        _obs(obs)
+        _obs(obs.getX(), obs.getY()),
+        _invScale(obs.getScale() > 0.0 ? 1.0 / obs.getScale() : 1.0)
     {}
 
     // Enum to map intrinsics parameters between aliceVision & ceres camera data parameter block.
@@ -992,10 +999,9 @@ struct ResidualErrorFunctor_Pinhole3DEClassicLD
         const T projected_y = principal_point_y + focalY * y_d;
 
         // Compute and return the error is the difference between the predicted
-        //  and observed position
-        const T scale(_obs.getScale() > 0.0 ? _obs.getScale() : 1.0);
-        out_residuals[0] = (projected_x - T(_obs.getX())) / scale;
-        out_residuals[1] = (projected_y - T(_obs.getY())) / scale;
+        //  and observed position, scaled by the observation confidence
+        out_residuals[0] = (projected_x - T(_obs(0))) * T(_invScale);
+        out_residuals[1] = (projected_y - T(_obs(1))) * T(_invScale);
     }
 
     template<typename T>
@@ -1080,7 +1086,8 @@ struct ResidualErrorFunctor_Pinhole3DEClassicLD
         return true;
     }
 
-    const sfmData::Observation _obs;  // The 2D observation
+    const Vec2 _obs;         // The 2D observation
+    const double _invScale;  // Inverse of the observation scale (1 when the feature has no scale)
     const Vec2 _center;
 };
 
@@ -1099,7 +1106,8 @@ struct ResidualErrorFunctor_Pinhole3DERadial4
 {
     explicit ResidualErrorFunctor_Pinhole3DERadial4(int w, int h, const sfmData::Observation& obs)
       : _center(double(w) * 0.5, double(h) * 0.5),
-        _obs(obs)
+        _obs(obs.getX(), obs.getY()),
+        _invScale(obs.getScale() > 0.0 ? 1.0 / obs.getScale() : 1.0)
     {}
 
     // Enum to map intrinsics parameters between aliceVision & ceres camera data parameter block.
@@ -1156,10 +1164,9 @@ struct ResidualErrorFunctor_Pinhole3DERadial4
         const T projected_y = principal_point_y + focalY * y_d;
 
         // Compute and return the error is the difference between the predicted
-        //  and observed position
-        const T scale(_obs.getScale() > 0.0 ? _obs.getScale() : 1.0);
-        out_residuals[0] = (projected_x - T(_obs.getX())) / scale;
-        out_residuals[1] = (projected_y - T(_obs.getY())) / scale;
+        //  and observed position, scaled by the observation confidence
+        out_residuals[0] = (projected_x - T(_obs(0))) * T(_invScale);
+        out_residuals[1] = (projected_y - T(_obs(1))) * T(_invScale);
     }
 
     template<typename T>
@@ -1244,7 +1251,8 @@ struct ResidualErrorFunctor_Pinhole3DERadial4
         return true;
     }
 
-    const sfmData::Observation _obs;  // The 2D observation
+    const Vec2 _obs;         // The 2D observation
+    const double _invScale;  // Inverse of the observation scale (1 when the feature has no scale)
     const Vec2 _center;
 };
 
@@ -1263,7 +1271,8 @@ struct ResidualErrorFunctor_Pinhole3DEAnamorphic4
 {
     explicit ResidualErrorFunctor_Pinhole3DEAnamorphic4(int w, int h, const sfmData::Observation& obs)
       : _center(double(w) * 0.5, double(h) * 0.5),
-        _obs(obs)
+        _obs(obs.getX(), obs.getY()),
+        _invScale(obs.getScale() > 0.0 ? 1.0 / obs.getScale() : 1.0)
     {}
 
     // Enum to map intrinsics parameters between aliceVision & ceres camera data parameter block.
@@ -1353,10 +1362,9 @@ struct ResidualErrorFunctor_Pinhole3DEAnamorphic4
         const T projected_y = principal_point_y + focalY * np_y;
 
         // Compute and return the error is the difference between the predicted
-        //  and observed position
-        const T scale(_obs.getScale() > 0.0 ? _obs.getScale() : 1.0);
-        out_residuals[0] = (projected_x - T(_obs.getX())) / scale;
-        out_residuals[1] = (projected_y - T(_obs.getY())) / scale;
+        //  and observed position, scaled by the observation confidence
+        out_residuals[0] = (projected_x - T(_obs(0))) * T(_invScale);
+        out_residuals[1] = (projected_y - T(_obs(1))) * T(_invScale);
     }
 
     template<typename T>
@@ -1447,7 +1455,8 @@ struct ResidualErrorFunctor_Pinhole3DEAnamorphic4
         return true;
     }
 
-    const sfmData::Observation _obs;  // The 2D observation
+    const Vec2 _obs;         // The 2D observation
+    const double _invScale;  // Inverse of the observation scale (1 when the feature has no scale)
     const Vec2 _center;
 };
 
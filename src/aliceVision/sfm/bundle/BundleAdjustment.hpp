@@ -72,6 +72,59 @@ inline std::istream& operator>>(std::istream& in, EFeatureConstraint& m)
     return in;
 }
 
+/**
+ * @brief Defines the hardware backend used by the bundle adjustment linear solver.
+ */
+enum class EBASolverBackend
+{
+    CPU = 0,
+    GPU = 1
+};
+
+/**
+ * @brief convert an enum EBASolverBackend to its corresponding string
+ * @param EBASolverBackend
+ * @return String
+ */
+inline std::string EBASolverBackend_enumToString(EBASolverBackend m)
+{
+    switch (m)
+    {
+        case EBASolverBackend::CPU:
+            return "cpu";
+        case EBASolverBackend::GPU:
+            return "gpu";
+    }
+    throw std::out_of_range("Invalid EBASolverBackend enum: " + std::to_string(int(m)));
+}
+
+/**
+ * @brief convert a string solverBackend to its corresponding enum EBASolverBackend
+ * @param String
+ * @return EBASolverBackend
+ */
+inline EBASolverBackend EBASolverBackend_stringToEnum(const std::string& m)
+{
+    std::string solverBackend = m;
+    std::transform(solverBackend.begin(), solverBackend.end(), solverBackend.begin(), ::tolower);
+
+    if (solverBackend == "cpu")
+        return EBASolverBackend::CPU;
+    if (solverBackend == "gpu")
+        return EBASolverBackend::GPU;
+
+    throw std::out_of_range("Invalid EBASolverBackend: " + m);
+}
+
+inline std::ostream& operator<<(std::ostream& os, EBASolverBackend m) { return os << EBASolverBackend_enumToString(m); }
+
+inline std::istream& operator>>(std::istream& in, EBASolverBackend& m)
+{
+    std::string token(std::istreambuf_iterator<char>(in), {});
+    m = EBASolverBackend_stringToEnum(token);
+    return in;
+}
+
 class BundleAdjustment
 {
   public:
@@ -20,6 +20,9 @@
 #include <fstream>
 #include <memory>
 
+// Ceres provides a CUDA dense linear algebra backend since 2.1
+#define ALICEVISION_CERES_HAS_CUDA (CERES_VERSION_MAJOR > 2 || (CERES_VERSION_MAJOR == 2 && CERES_VERSION_MINOR >= 1))
+
 namespace fs = std::filesystem;
 
 namespace aliceVision {
@@ -352,6 +355,7 @@ void BundleAdjustmentCeres::CeresOptions::setDenseBA()
     preconditionerType = ceres::JACOBI;
     linearSolverType = ceres::DENSE_SCHUR;
     sparseLinearAlgebraLibraryType = ceres::SUITE_SPARSE;  // not used but just to avoid a warning in ceres
+    denseLinearAlgebraLibraryType = ceres::EIGEN;
     ALICEVISION_LOG_DEBUG("BundleAdjustment[Ceres]: DENSE_SCHUR");
 }
 
@@ -387,6 +391,23 @@ void BundleAdjustmentCeres::CeresOptions::setSparseBA()
     }
 }
 
+void BundleAdjustmentCeres::CeresOptions::setGpuBA()
+{
+#if ALICEVISION_CERES_HAS_CUDA
+    if (ceres::IsDenseLinearAlgebraLibraryTypeAvailable(ceres::CUDA))
+    {
+        preconditionerType = ceres::JACOBI;
+        linearSolverType = ceres::DENSE_SCHUR;
+        sparseLinearAlgebraLibraryType = ceres::SUITE_SPARSE;  // not used but just to avoid a warning in ceres
+        denseLinearAlgebraLibraryType = ceres::CUDA;
+        ALICEVISION_LOG_DEBUG("BundleAdjustment[Ceres]: DENSE_SCHUR, CUDA");
+        return;
+    }
+#endif
+    ALICEVISION_LOG_WARNING("BundleAdjustment[Ceres]: no CUDA support in Ceres, fallback to CPU sparse BA.");
+    setSparseBA();
+}
+
 bool BundleAdjustmentCeres::Statistics::exportToFile(const std::string& folder, const std::string& filename) const
 {
     std::ofstream os;
@@ -504,6 +525,7 @@ void BundleAdjustmentCeres::setSolverOptions(ceres::Solver::Options& solverOptio
     solverOptions.preconditioner_type = _ceresOptions.preconditionerType;
     solverOptions.linear_solver_type = _ceresOptions.linearSolverType;
     solverOptions.sparse_linear_algebra_library_type = _ceresOptions.sparseLinearAlgebraLibraryType;
+    solverOptions.dense_linear_algebra_library_type = _ceresOptions.denseLinearAlgebraLibraryType;
     solverOptions.minimizer_progress_to_stdout = _ceresOptions.verbose;
     solverOptions.logging_type = ceres::SILENT;
     solverOptions.num_threads = _ceresOptions.nbThreads;
@@ -781,28 +803,50 @@ void BundleAdjustmentCeres::addLandmarksToProblem(const sfmData::SfMData& sfmDat
     // note: set it to NULL if you don't want use a lossFunction.
     ceres::LossFunction* lossFunction = _ceresOptions.lossFunction.get();
 
-    // build the residual blocks corresponding to the track observations
+    // allocate the landmark parameter blocks sequentially, the map insertions are not thread-safe
+    std::vector<const sfmData::Landmarks::value_type*> landmarkRefs;
+    landmarkRefs.reserve(sfmData.getLandmarks().size());
     for (const auto& landmarkPair : sfmData.getLandmarks())
     {
-        const IndexT landmarkId = landmarkPair.first;
-        const sfmData::Landmark& landmark = landmarkPair.second;
-
         // do not create a residual block if the landmark
         // have been set as Ignored by the Local BA strategy
-        if (landmark.state == EEstimatorParameterState::IGNORED)
+        if (landmarkPair.second.state == EEstimatorParameterState::IGNORED)
         {
             _statistics.addState(EParameter::LANDMARK, EEstimatorParameterState::IGNORED);
             continue;
         }
 
-        std::array<double, 3>& landmarkBlock = _landmarksBlocks[landmarkId];
+        std::array<double, 3>& landmarkBlock = _landmarksBlocks[landmarkPair.first];
         for (std::size_t i = 0; i < 3; ++i)
-            landmarkBlock.at(i) = landmark.X(Eigen::Index(i));
-
-        double* landmarkBlockPtr = landmarkBlock.data();
+            landmarkBlock.at(i) = landmarkPair.second.X(Eigen::Index(i));
 
         // add landmark parameter to the all parameters blocks pointers list
-        _allParametersBlocks.push_back(landmarkBlockPtr);
+        _allParametersBlocks.push_back(landmarkBlock.data());
+
+        landmarkRefs.push_back(&landmarkPair);
+    }
+
+    // instantiating the cost functions dominates the problem setup time on large scenes:
+    // build them in parallel, one slot per landmark to keep the insertion order deterministic
+    struct PendingResidualBlock
+    {
+        ceres::CostFunction* costFunction = nullptr;
+        double* intrinsicBlockPtr = nullptr;
+        double* poseBlockPtr = nullptr;
+        double* rigBlockPtr = nullptr;  // only set for rig views without an independant pose
+        double* landmarkBlockPtr = nullptr;
+    };
+
+    std::vector<std::vector<PendingResidualBlock>> pendingBlocksPerLandmark(landmarkRefs.size());
+
+#pragma omp parallel for if (_ceresOptions.nbThreads > 1)
+    for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(landmarkRefs.size()); ++i)
+    {
+        const sfmData::Landmark& landmark = landmarkRefs[i]->second;
+        double* landmarkBlockPtr = _landmarksBlocks.at(landmarkRefs[i]->first).data();
+
+        std::vector<PendingResidualBlock>& pendingBlocks = pendingBlocksPerLandmark[i];
+        pendingBlocks.reserve(landmark.getObservations().size());
 
         // iterate over 2D observation associated to the 3D landmark
         for (const auto& observationPair : landmark.getObservations())
@@ -820,47 +864,90 @@ void BundleAdjustmentCeres::addLandmarksToProblem(const sfmData::SfMData& sfmDat
             assert(intrinsic->getState() != EEstimatorParameterState::IGNORED);
 
             // needed parameters to create a residual block (K, pose)
-            double* poseBlockPtr = _posesBlocks.at(view.getPoseId()).data();
-            double* intrinsicBlockPtr = _intrinsicsBlocks.at(view.getIntrinsicId()).data();
+            PendingResidualBlock pending;
+            pending.landmarkBlockPtr = landmarkBlockPtr;
+            pending.poseBlockPtr = _posesBlocks.at(view.getPoseId()).data();
+            pending.intrinsicBlockPtr = _intrinsicsBlocks.at(view.getIntrinsicId()).data();
+
+            if (view.isPartOfRig() && !view.isPoseIndependant())
+            {
+                pending.costFunction = createRigCostFunctionFromIntrinsics(sfmData.getIntrinsicPtr(view.getIntrinsicId()), observation);
+                pending.rigBlockPtr = _rigBlocks.at(view.getRigId()).at(view.getSubPoseId()).data();
+            }
+            else
+            {
+                pending.costFunction = createCostFunctionFromIntrinsics(sfmData.getIntrinsicPtr(view.getIntrinsicId()), observation);
+            }
+
+            pendingBlocks.push_back(pending);
+        }
+    }
+
+    // bulk insertion, AddResidualBlock and the solver ordering are not thread-safe
+    for (std::size_t i = 0; i < landmarkRefs.size(); ++i)
+    {
+        const sfmData::Landmark& landmark = landmarkRefs[i]->second;
+
+        std::vector<LandmarkResidual>* landmarkResiduals = nullptr;
+        if (_ceresOptions.computeLandmarkCovariances)
+            landmarkResiduals = &_landmarkResiduals[landmarkRefs[i]->first];
+
+        for (const PendingResidualBlock& pending : pendingBlocksPerLandmark[i])
+        {
+            // keep a descriptor of the residual block for the covariance pass
+            if (landmarkResiduals != nullptr)
+            {
+                LandmarkResidual residual;
+                residual.costFunction = pending.costFunction;
+                residual.parameterBlocks[0] = pending.intrinsicBlockPtr;
+                residual.parameterBlocks[1] = pending.poseBlockPtr;
+                if (pending.rigBlockPtr != nullptr)
+                {
+                    residual.parameterBlocks[2] = pending.rigBlockPtr;
+                    residual.parameterBlocks[3] = pending.landmarkBlockPtr;
+                    residual.nbParameterBlocks = 4;
+                }
+                else
+                {
+                    residual.parameterBlocks[2] = pending.landmarkBlockPtr;
+                    residual.nbParameterBlocks = 3;
+                }
+                landmarkResiduals->push_back(residual);
+            }
 
             // apply a specific parameter ordering:
             if (_ceresOptions.useParametersOrdering)
             {
-                _linearSolverOrdering.AddElementToGroup(landmarkBlockPtr, 0);
-                _linearSolverOrdering.AddElementToGroup(poseBlockPtr, 1);
-                _linearSolverOrdering.AddElementToGroup(intrinsicBlockPtr, 2);
+                _linearSolverOrdering.AddElementToGroup(pending.landmarkBlockPtr, 0);
+                _linearSolverOrdering.AddElementToGroup(pending.poseBlockPtr, 1);
+                _linearSolverOrdering.AddElementToGroup(pending.intrinsicBlockPtr, 2);
             }
 
-            if (view.isPartOfRig() && !view.isPoseIndependant())
+            if (pending.rigBlockPtr != nullptr)
             {
-                ceres::CostFunction* costFunction = createRigCostFunctionFromIntrinsics(sfmData.getIntrinsicPtr(view.getIntrinsicId()), observation);
-
-                double* rigBlockPtr = _rigBlocks.at(view.getRigId()).at(view.getSubPoseId()).data();
-                _linearSolverOrdering.AddElementToGroup(rigBlockPtr, 1);
+                _linearSolverOrdering.AddElementToGroup(pending.rigBlockPtr, 1);
 
-                problem.AddResidualBlock(costFunction,
+                problem.AddResidualBlock(pending.costFunction,
                                          lossFunction,
-                                         intrinsicBlockPtr,
-                                         poseBlockPtr,
-                                         rigBlockPtr,        // subpose of the cameras rig
-                                         landmarkBlockPtr);  // do we need to copy 3D point to avoid false motion, if failure ?
+                                         pending.intrinsicBlockPtr,
+                                         pending.poseBlockPtr,
+                                         pending.rigBlockPtr,        // subpose of the cameras rig
+                                         pending.landmarkBlockPtr);  // do we need to copy 3D point to avoid false motion, if failure ?
             }
             else
             {
-                ceres::CostFunction* costFunction = createCostFunctionFromIntrinsics(sfmData.getIntrinsicPtr(view.getIntrinsicId()), observation);
-
-                problem.AddResidualBlock(costFunction,
+                problem.AddResidualBlock(pending.costFunction,
                                          lossFunction,
-                                         intrinsicBlockPtr,
-                                         poseBlockPtr,
-                                         landmarkBlockPtr);  // do we need to copy 3D point to avoid false motion, if failure ?
+                                         pending.intrinsicBlockPtr,
+                                         pending.poseBlockPtr,
+                                         pending.landmarkBlockPtr);  // do we need to copy 3D point to avoid false motion, if failure ?
             }
 
             if (!refineStructure || landmark.state == EEstimatorParameterState::CONSTANT)
             {
                 // set the whole landmark parameter block as constant.
                 _statistics.addState(EParameter::LANDMARK, EEstimatorParameterState::CONSTANT);
-                problem.SetParameterBlockConstant(landmarkBlockPtr);
+                problem.SetParameterBlockConstant(pending.landmarkBlockPtr);
             }
             else
             {
@@ -967,6 +1054,7 @@ void BundleAdjustmentCeres::resetProblem()
     _intrinsicsBlocks.clear();
     _landmarksBlocks.clear();
     _rigBlocks.clear();
+    _landmarkResiduals.clear();
 
     _linearSolverOrdering.Clear();
 }
@@ -1063,6 +1151,52 @@ void BundleAdjustmentCeres::updateFromSolution(sfmData::SfMData& sfmData, ERefin
     }
 }
 
+void BundleAdjustmentCeres::computeLandmarkCovariances(sfmData::SfMData& sfmData, const ceres::Solver::Summary& summary) const
+{
+    // estimate of the measurement variance from the final cost (the ceres cost is 1/2 sum r^2)
+    const double dof = double(summary.num_residuals_reduced) - double(summary.num_effective_parameters_reduced);
+    const double residualVariance = (dof > 0.0) ? 2.0 * summary.final_cost / dof : 1.0;
+
+    // pack the landmark entries so the extraction can run parallel per landmark
+    std::vector<const std::map<IndexT, std::vector<LandmarkResidual>>::value_type*> landmarkRefs;
+    landmarkRefs.reserve(_landmarkResiduals.size());
+    for (const auto& landmarkResidualsPair : _landmarkResiduals)
+        landmarkRefs.push_back(&landmarkResidualsPair);
+
+#pragma omp parallel for if (_ceresOptions.nbThreads > 1)
+    for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(landmarkRefs.size()); ++i)
+    {
+        sfmData::Landmark& landmark = sfmData.getLandmarks().at(landmarkRefs[i]->first);
+
+        // accumulate the Gauss-Newton hessian block of the landmark:
+        // with the cameras held at the solution this is the landmark diagonal block
+        // of the Schur complement, so every landmark can be inverted on its own
+        Mat3 hessian = Mat3::Zero();
+
+        double residuals[2];
+        double pointJacobianData[2 * 3];
+
+        for (const LandmarkResidual& residual : landmarkRefs[i]->second)
+        {
+            // only request the jacobian with respect to the 3D point
+            std::array<double*, 4> jacobians = {nullptr, nullptr, nullptr, nullptr};
+            jacobians[residual.nbParameterBlocks - 1] = pointJacobianData;
+
+            if (!residual.costFunction->Evaluate(residual.parameterBlocks.data(), residuals, jacobians.data()))
+                continue;
+
+            const Eigen::Map<const Eigen::Matrix<double, 2, 3, Eigen::RowMajor>> pointJacobian(pointJacobianData);
+            hessian += pointJacobian.transpose() * pointJacobian;
+        }
+
+        Mat3 information;
+        bool invertible = false;
+        hessian.computeInverseWithCheck(information, invertible);
+        if (invertible)
+            landmark.covariance = residualVariance * information;
+    }
+}
+
 void BundleAdjustmentCeres::createJacobian(const sfmData::SfMData& sfmData, ERefineOptions refineOptions, ceres::CRSMatrix& jacobian)
 {
     // create problem
@@ -1113,6 +1247,11 @@ bool BundleAdjustmentCeres::adjust(sfmData::SfMData& sfmData, ERefineOptions ref
     // update input sfmData with the solution
     updateFromSolution(sfmData, refineOptions);
 
+    // optional per-landmark covariance extraction at the solution,
+    // while the problem still owns the cost functions
+    if (_ceresOptions.computeLandmarkCovariances)
+        computeLandmarkCovariances(sfmData, summary);
+
     // store some statitics from the summary
     _statistics.time = summary.total_time_in_seconds;
     _statistics.nbSuccessfullIterations = summary.num_successful_steps;
@@ -45,16 +45,20 @@ class BundleAdjustmentCeres : public BundleAdjustment
 
         void setDenseBA();
         void setSparseBA();
+        void setGpuBA();
 
         ceres::LinearSolverType linearSolverType;
         ceres::PreconditionerType preconditionerType;
         ceres::SparseLinearAlgebraLibraryType sparseLinearAlgebraLibraryType;
+        ceres::DenseLinearAlgebraLibraryType denseLinearAlgebraLibraryType = ceres::EIGEN;
         std::shared_ptr<ceres::LossFunction> lossFunction;
         unsigned int nbThreads;
         unsigned int maxNumIterations;
         bool useParametersOrdering = true;
         bool summary = false;
         bool verbose = true;
+        /// compute a 3x3 covariance for each landmark at the solution and store it in the SfMData
+        bool computeLandmarkCovariances = false;
     };
 
     /**
@@ -209,6 +213,16 @@ class BundleAdjustmentCeres : public BundleAdjustment
      */
     void updateFromSolution(sfmData::SfMData& sfmData, ERefineOptions refineOptions) const;
 
+    /**
+     * @brief Compute a 3x3 covariance for each landmark and store it in the SfMData.
+     * The covariance is the inverse of the landmark diagonal block of the Schur complement with the
+     * cameras held at the solution, scaled by the residual variance. Each landmark block is
+     * independent, so the extraction runs in parallel without factorizing the full problem.
+     * @param[in,out] sfmData The scene to update with the per-landmark covariances
+     * @param[in] summary The solver summary of the adjustment, used for the residual variance
+     */
+    void computeLandmarkCovariances(sfmData::SfMData& sfmData, const ceres::Solver::Summary& summary) const;
+
     // private members
 
     /// user Ceres options to use in the solver
@@ -238,6 +252,16 @@ class BundleAdjustmentCeres : public BundleAdjustment
     /// block: ceres angleAxis(3) + translation(3)
     std::map<IndexT, std::map<IndexT, std::array<double, 6>>> _rigBlocks;
 
+    /// residual block descriptor kept per landmark for the optional covariance pass
+    struct LandmarkResidual
+    {
+        const ceres::CostFunction* costFunction = nullptr;
+        std::array<const double*, 4> parameterBlocks{};  // cost function argument order, unused slots stay null
+        int nbParameterBlocks = 0;
+    };
+    /// residuals of each landmark, only filled when computeLandmarkCovariances is enabled
+    std::map<IndexT, std::vector<LandmarkResidual>> _landmarkResiduals;
+
     /// hinted order for ceres to eliminate blocks when solving.
     /// note: this ceres parameter is built internally and must be reset on each call to the solver.
     ceres::ParameterBlockOrdering _linearSolverOrdering;
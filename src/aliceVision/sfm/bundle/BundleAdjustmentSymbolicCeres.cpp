@@ -27,6 +27,9 @@
 #include <filesystem>
 #include <fstream>
 
+// Ceres provides a CUDA dense linear algebra backend since 2.1
+#define ALICEVISION_CERES_HAS_CUDA (CERES_VERSION_MAJOR > 2 || (CERES_VERSION_MAJOR == 2 && CERES_VERSION_MINOR >= 1))
+
 namespace fs = std::filesystem;
 
 namespace aliceVision {
@@ -82,6 +85,7 @@ void BundleAdjustmentSymbolicCeres::CeresOptions::setDenseBA()
     preconditionerType = ceres::JACOBI;
     linearSolverType = ceres::DENSE_SCHUR;
     sparseLinearAlgebraLibraryType = ceres::SUITE_SPARSE;  // not used but just to avoid a warning in ceres
+    denseLinearAlgebraLibraryType = ceres::EIGEN;
     ALICEVISION_LOG_DEBUG("BundleAdjustmentSymbolic[Ceres]: DENSE_SCHUR");
 }
 
@@ -117,6 +121,23 @@ void BundleAdjustmentSymbolicCeres::CeresOptions::setSparseBA()
     }
 }
 
+void BundleAdjustmentSymbolicCeres::CeresOptions::setGpuBA()
+{
+#if ALICEVISION_CERES_HAS_CUDA
+    if (ceres::IsDenseLinearAlgebraLibraryTypeAvailable(ceres::CUDA))
+    {
+        preconditionerType = ceres::JACOBI;
+        linearSolverType = ceres::DENSE_SCHUR;
+        sparseLinearAlgebraLibraryType = ceres::SUITE_SPARSE;  // not used but just to avoid a warning in ceres
+        denseLinearAlgebraLibraryType = ceres::CUDA;
+        ALICEVISION_LOG_DEBUG("BundleAdjustmentSymbolic[Ceres]: DENSE_SCHUR, CUDA");
+        return;
+    }
+#endif
+    ALICEVISION_LOG_WARNING("BundleAdjustmentSymbolic[Ceres]: no CUDA support in Ceres, fallback to CPU sparse BA.");
+    setSparseBA();
+}
+
 bool BundleAdjustmentSymbolicCeres::Statistics::exportToFile(const std::string& folder, const std::string& filename) const
 {
     std::ofstream os;
@@ -238,6 +259,7 @@ void BundleAdjustmentSymbolicCeres::setSolverOptions(ceres::Solver::Options& sol
     solverOptions.preconditioner_type = _ceresOptions.preconditionerType;
     solverOptions.linear_solver_type = _ceresOptions.linearSolverType;
     solverOptions.sparse_linear_algebra_library_type = _ceresOptions.sparseLinearAlgebraLibraryType;
+    solverOptions.dense_linear_algebra_library_type = _ceresOptions.denseLinearAlgebraLibraryType;
     solverOptions.minimizer_progress_to_stdout = _ceresOptions.verbose;
     solverOptions.logging_type = ceres::SILENT;
     solverOptions.num_threads = _ceresOptions.nbThreads;
@@ -670,6 +692,128 @@ void BundleAdjustmentSymbolicCeres::createProblem(const sfmData::SfMData& sfmDat
     addRotationPriorsToProblem(sfmData, refineOptions, problem);
 }
 
+void BundleAdjustmentSymbolicCeres::applyRefineOptionsMasking(const sfmData::SfMData& sfmData,
+                                                              ERefineOptions refineOptions,
+                                                              ceres::Problem& problem)
+{
+    const bool refineTranslation = refineOptions & BundleAdjustment::REFINE_TRANSLATION;
+    const bool refineRotation = refineOptions & BundleAdjustment::REFINE_ROTATION;
+
+    // mask the poses blocks
+    for (auto& posePair : _posesBlocks)
+    {
+        const sfmData::CameraPose& pose = sfmData.getPoses().at(posePair.first);
+        double* poseBlockPtr = posePair.second.data();
+
+        if (pose.isLocked() || (pose.getState() == EEstimatorParameterState::CONSTANT) || (!refineTranslation && !refineRotation))
+        {
+            problem.SetParameterBlockConstant(poseBlockPtr);
+            continue;
+        }
+
+        problem.SetParameterBlockVariable(poseBlockPtr);
+        problem.SetManifold(poseBlockPtr, new SE3ManifoldLeft(refineRotation, refineTranslation));
+    }
+
+    // mask the rig sub-poses blocks
+    for (auto& rigPair : _rigBlocks)
+    {
+        const sfmData::Rig& rig = sfmData.getRigs().at(rigPair.first);
+
+        for (auto& subPosePair : rigPair.second)
+        {
+            const sfmData::RigSubPose& rigSubPose = rig.getSubPose(subPosePair.first);
+            double* subPoseBlockPtr = subPosePair.second.data();
+
+            if ((rigSubPose.status == sfmData::ERigSubPoseStatus::CONSTANT) || (!refineTranslation && !refineRotation))
+            {
+                problem.SetParameterBlockConstant(subPoseBlockPtr);
+                continue;
+            }
+
+            problem.SetParameterBlockVariable(subPoseBlockPtr);
+            problem.SetManifold(subPoseBlockPtr, new SE3ManifoldLeft(refineRotation, refineTranslation));
+        }
+    }
+
+    const bool refineIntrinsicsOpticalCenter =
+      (refineOptions & REFINE_INTRINSICS_OPTICALOFFSET_ALWAYS) || (refineOptions & REFINE_INTRINSICS_OPTICALOFFSET_IF_ENOUGH_DATA);
+    const bool refineIntrinsicsFocalLength = refineOptions & REFINE_INTRINSICS_FOCAL;
+    const bool refineIntrinsicsDistortion = refineOptions & REFINE_INTRINSICS_DISTORTION;
+    const bool refineIntrinsics = refineIntrinsicsDistortion || refineIntrinsicsFocalLength || refineIntrinsicsOpticalCenter;
+
+    // count the number of reconstructed views per intrinsic
+    std::map<IndexT, std::size_t> intrinsicsUsage;
+    for (const auto& viewPair : sfmData.getViews())
+    {
+        const sfmData::View& view = *(viewPair.second);
+
+        if (intrinsicsUsage.find(view.getIntrinsicId()) == intrinsicsUsage.end())
+            intrinsicsUsage[view.getIntrinsicId()] = 0;
+
+        if (sfmData.isPoseAndIntrinsicDefined(&view))
+            ++intrinsicsUsage.at(view.getIntrinsicId());
+    }
+
+    // mask the intrinsics blocks
+    for (auto& intrinsicPair : _intrinsicsBlocks)
+    {
+        const IndexT intrinsicId = intrinsicPair.first;
+        const auto& intrinsicPtr = sfmData.getIntrinsics().at(intrinsicId);
+        std::vector<double>& intrinsicBlock = intrinsicPair.second;
+        double* intrinsicBlockPtr = intrinsicBlock.data();
+
+        // keep the camera intrinsic constant
+        if (intrinsicPtr->isLocked() || !refineIntrinsics || intrinsicPtr->getState() == EEstimatorParameterState::CONSTANT)
+        {
+            problem.SetParameterBlockConstant(intrinsicBlockPtr);
+            continue;
+        }
+
+        problem.SetParameterBlockVariable(intrinsicBlockPtr);
+
+        // constant parameters
+        bool lockCenter = false;
+        bool lockFocal = false;
+        bool lockRatio = true;
+        bool lockDistortion = false;
+        double focalRatio = 1.0;
+
+        if (refineIntrinsicsFocalLength)
+        {
+            focalRatio = intrinsicBlockPtr[1] / intrinsicBlockPtr[0];
+
+            std::shared_ptr<camera::IntrinsicScaleOffset> castedcam_iso = std::dynamic_pointer_cast<camera::IntrinsicScaleOffset>(intrinsicPtr);
+            if (castedcam_iso)
+            {
+                lockRatio = castedcam_iso->isRatioLocked();
+            }
+        }
+        else
+        {
+            lockFocal = true;
+        }
+
+        const std::size_t usageCount = intrinsicsUsage.at(intrinsicId);
+        const bool optional_center =
+          ((refineOptions & REFINE_INTRINSICS_OPTICALOFFSET_IF_ENOUGH_DATA) && (usageCount > _minNbImagesToRefineOpticalCenter));
+        if (!((refineOptions & REFINE_INTRINSICS_OPTICALOFFSET_ALWAYS) || optional_center))
+        {
+            lockCenter = true;
+        }
+
+        if (!refineIntrinsicsDistortion)
+        {
+            lockDistortion = true;
+        }
+
+        // the parameter bounds are kept from the problem creation, only the manifold changes
+        IntrinsicsManifoldSymbolic* subsetManifold =
+          new IntrinsicsManifoldSymbolic(intrinsicBlock.size(), focalRatio, lockFocal, lockRatio, lockCenter, lockDistortion);
+        problem.SetManifold(intrinsicBlockPtr, subsetManifold);
+    }
+}
+
 void BundleAdjustmentSymbolicCeres::updateFromSolution(sfmData::SfMData& sfmData, ERefineOptions refineOptions) const
 {
     const bool refinePoses = (refineOptions & REFINE_ROTATION) || (refineOptions & REFINE_TRANSLATION);
@@ -785,6 +929,44 @@ bool BundleAdjustmentSymbolicCeres::adjust(sfmData::SfMData& sfmData, ERefineOpt
     ceres::Problem problem(problemOptions);
     createProblem(sfmData, refineOptions, problem);
 
+    return solveAndUpdate(sfmData, refineOptions, problem);
+}
+
+bool BundleAdjustmentSymbolicCeres::adjustStages(sfmData::SfMData& sfmData, const std::vector<ERefineOptions>& refineOptionsPerStage)
+{
+    if (refineOptionsPerStage.empty())
+        return true;
+
+    // union of the refine options of all stages:
+    // the problem is built once with every parameter block, residual block and
+    // parameter bound that any stage needs
+    ERefineOptions allRefineOptions = REFINE_NONE;
+    for (ERefineOptions refineOptions : refineOptionsPerStage)
+        allRefineOptions |= refineOptions;
+
+    // create problem
+    ceres::Problem::Options problemOptions;
+    problemOptions.loss_function_ownership = ceres::DO_NOT_TAKE_OWNERSHIP;
+    problemOptions.evaluation_callback = this;
+
+    ceres::Problem problem(problemOptions);
+    createProblem(sfmData, allRefineOptions, problem);
+
+    for (ERefineOptions refineOptions : refineOptionsPerStage)
+    {
+        // the parameter blocks hold the solution of the previous stage,
+        // only their constant/variable masking changes in between
+        applyRefineOptionsMasking(sfmData, refineOptions, problem);
+
+        if (!solveAndUpdate(sfmData, refineOptions, problem))
+            return false;
+    }
+
+    return true;
+}
+
+bool BundleAdjustmentSymbolicCeres::solveAndUpdate(sfmData::SfMData& sfmData, ERefineOptions refineOptions, ceres::Problem& problem)
+{
     // configure a Bundle Adjustment engine and run it
     // make Ceres automatically detect the bundle structure.
     ceres::Solver::Options options;
@@ -51,10 +51,12 @@ class BundleAdjustmentSymbolicCeres : public BundleAdjustment, ceres::Evaluation
 
         void setDenseBA();
         void setSparseBA();
+        void setGpuBA();
 
         ceres::LinearSolverType linearSolverType;
         ceres::PreconditionerType preconditionerType;
         ceres::SparseLinearAlgebraLibraryType sparseLinearAlgebraLibraryType;
+        ceres::DenseLinearAlgebraLibraryType denseLinearAlgebraLibraryType = ceres::EIGEN;
         std::shared_ptr<ceres::LossFunction> lossFunction;
         unsigned int nbThreads;
         unsigned int maxNumIterations;
@@ -141,6 +143,19 @@ class BundleAdjustmentSymbolicCeres : public BundleAdjustment, ceres::Evaluation
      */
     bool adjust(sfmData::SfMData& sfmData, ERefineOptions refineOptions = REFINE_ALL);
 
+    /**
+     * @brief Perform several bundle adjustment stages on a single Ceres problem.
+     *
+     * The problem is built once with the union of all the stage refine options;
+     * between stages only the parameter block masking changes (constant/variable
+     * flags and manifolds). This avoids rebuilding the full problem for every
+     * stage of a staged refinement.
+     * @param[in,out] sfmData The input SfMData contains all the information about the reconstruction
+     * @param[in] refineOptionsPerStage The refine options of each stage, in order
+     * @return false if a bundle adjustment stage failed else true
+     */
+    bool adjustStages(sfmData::SfMData& sfmData, const std::vector<ERefineOptions>& refineOptionsPerStage);
+
     /**
      * @brief Get bundle adjustment statistics structure
      * @return statistics structure const ptr
@@ -228,6 +243,24 @@ class BundleAdjustmentSymbolicCeres : public BundleAdjustment, ceres::Evaluation
      */
     void createProblem(const sfmData::SfMData& sfmData, ERefineOptions refineOptions, ceres::Problem& problem);
 
+    /**
+     * @brief Re-apply the constant/variable flags and the manifolds of the existing
+     * parameter blocks for the given refine options, without rebuilding the problem.
+     * @param[in] sfmData The input SfMData contains all the information about the reconstruction
+     * @param[in] refineOptions The chosen refine flag
+     * @param[in,out] problem The Ceres bundle adjustement problem
+     */
+    void applyRefineOptionsMasking(const sfmData::SfMData& sfmData, ERefineOptions refineOptions, ceres::Problem& problem);
+
+    /**
+     * @brief Run the solver on the given problem and update the SfMData with the solution
+     * @param[in,out] sfmData The input SfMData contains all the information about the reconstruction
+     * @param[in] refineOptions The chosen refine flag
+     * @param[in,out] problem The Ceres bundle adjustement problem
+     * @return false if the bundle adjustment failed else true
+     */
+    bool solveAndUpdate(sfmData::SfMData& sfmData, ERefineOptions refineOptions, ceres::Problem& problem);
+
     /**
      * @brief Update The given SfMData with the solver solution
      * @param[in,out] sfmData The input SfMData contains all the information about the reconstruction, notably the poses and sub-poses
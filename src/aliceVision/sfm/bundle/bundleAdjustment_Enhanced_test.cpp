@@ -160,11 +160,11 @@ std::vector<cameraPair> buildIntrinsics()
     cameras.push_back(std::make_pair(camera::createPinhole(camera::PINHOLE_CAMERA_FISHEYE1, 1920, 1080, 900, 900, 80, 50, {0.5}),
                                      camera::createPinhole(camera::PINHOLE_CAMERA_FISHEYE1, 1920, 1080, 1200, 1200, 0, 0, {1.2})));
 
-    /*cameras.push_back(std::make_pair(
-        camera::createPinhole(camera::PINHOLE_CAMERA_3DEANAMORPHIC4, 1920, 1080, 900, 900, 80, 50, {0.1, 0.1, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
-    0.0, 1.0, 1.0, 1.0}), camera::createPinhole(camera::PINHOLE_CAMERA_3DEANAMORPHIC4, 1920, 1080, 1200, 1200, 0, 0, {0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
-    0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0})
-    ));*/
+    cameras.push_back(std::make_pair(
+      camera::createPinhole(
+        camera::PINHOLE_CAMERA_3DEANAMORPHIC4, 1920, 1080, 900, 900, 80, 50, {0.1, 0.1, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0}),
+      camera::createPinhole(
+        camera::PINHOLE_CAMERA_3DEANAMORPHIC4, 1920, 1080, 1200, 1200, 0, 0, {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0})));
 
     cameras.push_back(
       std::make_pair(camera::createPinhole(camera::PINHOLE_CAMERA_3DERADIAL4, 1920, 1080, 900, 900, 80, 50, {0.2, 0.0, 0.0, 0.0, 0.0, 0.0}),
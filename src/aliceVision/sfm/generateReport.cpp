@@ -7,6 +7,7 @@
 
 #include "generateReport.hpp"
 #include <aliceVision/sfmData/SfMData.hpp>
+#include <aliceVision/sfm/residualEvaluation.hpp>
 
 #include <aliceVision/utils/Histogram.hpp>
 #include <dependencies/htmlDoc/htmlDoc.hpp>
@@ -22,20 +23,18 @@ namespace sfm {
 bool generateSfMReport(const sfmData::SfMData& sfmData, const std::string& htmlFilename)
 {
     // Compute mean,max,median residual values per View
+    // (batched per view, parallel over landmarks)
     IndexT residualCount = 0;
     std::map<IndexT, std::vector<double>> residuals_per_view;
-    for (sfmData::Landmarks::const_iterator iterTracks = sfmData.getLandmarks().begin(); iterTracks != sfmData.getLandmarks().end(); ++iterTracks)
+    for (const auto& viewResiduals : computeObservationResidualsPerView(sfmData))
     {
-        const sfmData::Observations& observations = iterTracks->second.getObservations();
-        for (sfmData::Observations::const_iterator itObs = observations.begin(); itObs != observations.end(); ++itObs)
+        std::vector<double>& values = residuals_per_view[viewResiduals.first];
+        values.reserve(2 * viewResiduals.second.size());
+        for (const Vec2& residual : viewResiduals.second)
         {
-            const sfmData::View* view = sfmData.getViews().at(itObs->first).get();
-            const geometry::Pose3 pose = sfmData.getPose(*view).getTransform();
-            const camera::IntrinsicBase* intrinsic = sfmData.getIntrinsics().at(view->getIntrinsicId()).get();
             // Use absolute values
-            const Vec2 residual = intrinsic->residual(pose, iterTracks->second.X.homogeneous(), itObs->second.getCoordinates()).array().abs();
-            residuals_per_view[itObs->first].push_back(residual(0));
-            residuals_per_view[itObs->first].push_back(residual(1));
+            values.push_back(std::abs(residual(0)));
+            values.push_back(std::abs(residual(1)));
             ++residualCount;
         }
     }
@@ -40,22 +40,31 @@ bool estimate_Rt_fromE(const Mat3& K1,
     assert(Rs.size() == 4);
     assert(ts.size() == 4);
 
-    Mat34 P1, P2;
     Mat3 R1 = Mat3::Identity();
     Vec3 t1 = Vec3::Zero();
-    P_from_KRt(K1, R1, t1, P1);
 
+    // Pack the inlier observations in contiguous arrays once,
+    // the four candidate solutions are voted on the same correspondences.
+    Mat x1_inliers(2, vec_inliers.size());
+    Mat x2_inliers(2, vec_inliers.size());
+    for (size_t k = 0; k < vec_inliers.size(); ++k)
+    {
+        x1_inliers.col(k) = x1.col(vec_inliers[k]);
+        x2_inliers.col(k) = x2.col(vec_inliers[k]);
+    }
+
+    std::vector<Vec3> Xs;
     for (unsigned int i = 0; i < 4; ++i)
     {
         const Mat3& R2 = Rs[i];
         const Vec3& t2 = ts[i];
-        P_from_KRt(K2, R2, t2, P2);
-        Vec3 X;
 
-        for (size_t k = 0; k < vec_inliers.size(); ++k)
+        // Batched SVD-free midpoint triangulation: the cheirality vote only
+        // needs the sign of the depths, not a refined 3d point.
+        multiview::TriangulateMidpointBatch(K1, R1, t1, K2, R2, t2, x1_inliers, x2_inliers, Xs);
+
+        for (const Vec3& X : Xs)
         {
-            const Vec2 &x1_ = x1.col(vec_inliers[k]), &x2_ = x2.col(vec_inliers[k]);
-            multiview::TriangulateDLT(P1, x1_, P2, x2_, X);
             // Test if point is front to the two cameras.
             if (Depth(R1, t1, X) > 0 && Depth(R2, t2, X) > 0)
             {
@@ -38,6 +38,29 @@ using namespace aliceVision::camera;
 using namespace aliceVision::geometry;
 using namespace aliceVision::sfmData;
 
+namespace {
+
+// gather the matches supported by the three pose edges of a triplet from the pose edge index
+void listTripletMatches(const GlobalSfMTranslationAveragingSolver::MatchesPerPoseEdge& matchesPerPoseEdge,
+                        const graph::Triplet& triplet,
+                        matching::PairwiseMatches& outTripletMatches)
+{
+    const Pair tripletPoseEdges[3] = {{std::min(triplet.i, triplet.j), std::max(triplet.i, triplet.j)},
+                                      {std::min(triplet.i, triplet.k), std::max(triplet.i, triplet.k)},
+                                      {std::min(triplet.j, triplet.k), std::max(triplet.j, triplet.k)}};
+
+    for (const Pair& poseEdge : tripletPoseEdges)
+    {
+        const auto matchesIt = matchesPerPoseEdge.find(poseEdge);
+        if (matchesIt == matchesPerPoseEdge.end())
+            continue;
+        for (const matching::PairwiseMatches::value_type* match : matchesIt->second)
+            outTripletMatches.insert(*match);
+    }
+}
+
+}  // namespace
+
 /// Use features in normalized camera frames
 bool GlobalSfMTranslationAveragingSolver::run(ETranslationAveragingMethod eTranslationAveragingMethod,
                                               SfMData& sfmData,
@@ -310,6 +333,10 @@ void GlobalSfMTranslationAveragingSolver::computePutativeTranslationEdgesCoverag
     PairSet rotationPoseIdGraph;
     std::set<IndexT> setPoseIds;
     std::transform(mapGlobalR.begin(), mapGlobalR.end(), std::inserter(setPoseIds, setPoseIds.begin()), stl::RetrieveKey());
+
+    // match pairs indexed by their (ordered) pose id edge, shared read-only by the triplet loops below
+    MatchesPerPoseEdge matchesPerPoseEdge;
+
     // List shared correspondences (pairs) between poses
     for (const auto& matchIterator : pairwiseMatches)
     {
@@ -321,6 +348,9 @@ void GlobalSfMTranslationAveragingSolver::computePutativeTranslationEdgesCoverag
           (v1->getPoseId() != v2->getPoseId()) && setPoseIds.count(v1->getPoseId()) && setPoseIds.count(v2->getPoseId()))
         {
             rotationPoseIdGraph.insert(std::make_pair(v1->getPoseId(), v2->getPoseId()));
+
+            const Pair poseEdge(std::min(v1->getPoseId(), v2->getPoseId()), std::max(v1->getPoseId(), v2->getPoseId()));
+            matchesPerPoseEdge[poseEdge].push_back(&matchIterator);
         }
     }
     // List putative triplets (from global rotations Ids)
@@ -341,19 +371,7 @@ void GlobalSfMTranslationAveragingSolver::computePutativeTranslationEdgesCoverag
             // List matches that belong to the triplet of poses
             const graph::Triplet& triplet = vecTriplets[i];
             matching::PairwiseMatches mapTripletMatches;
-            const std::set<IndexT> setTripletPoseIds = {triplet.i, triplet.j, triplet.k};
-            // List shared correspondences (pairs) between the triplet poses
-            for (const auto& matchIterator : pairwiseMatches)
-            {
-                const Pair pair = matchIterator.first;
-                const View* v1 = sfmData.getViews().at(pair.first).get();
-                const View* v2 = sfmData.getViews().at(pair.second).get();
-                if (  // Consider the pair iff it is supported by the triplet graph & 2 different pose id
-                  (v1->getPoseId() != v2->getPoseId()) && setTripletPoseIds.count(v1->getPoseId()) && setTripletPoseIds.count(v2->getPoseId()))
-                {
-                    mapTripletMatches.insert(matchIterator);
-                }
-            }
+            listTripletMatches(matchesPerPoseEdge, triplet, mapTripletMatches);
             // Compute tracks:
             {
                 aliceVision::track::TracksBuilder tracksBuilder;
@@ -388,6 +406,7 @@ void GlobalSfMTranslationAveragingSolver::computePutativeTranslationEdgesCoverag
 
         // set number of threads, 1 if openMP is not enabled
         std::vector<translationAveraging::RelativeInfoVec> initialEstimates(omp_get_max_threads());
+        std::vector<matching::PairwiseMatches> newPairMatchesPerThread(omp_get_max_threads());
         const bool bVerbose = false;
 
 #pragma omp parallel for schedule(dynamic)
@@ -442,7 +461,7 @@ void GlobalSfMTranslationAveragingSolver::computePutativeTranslationEdgesCoverag
                     const bool bTripletEstimation = estimateTTriplet(sfmData,
                                                                      mapGlobalR,
                                                                      normalizedFeaturesPerView,
-                                                                     pairwiseMatches,
+                                                                     matchesPerPoseEdge,
                                                                      triplet,
                                                                      randomNumberGenerator,
                                                                      vecTis,
@@ -482,40 +501,37 @@ void GlobalSfMTranslationAveragingSolver::computePutativeTranslationEdgesCoverag
                             initialEstimates[threadId].emplace_back(std::make_pair(triplet.j, triplet.k), std::make_pair(Rjk, tjk));
                             initialEstimates[threadId].emplace_back(std::make_pair(triplet.i, triplet.k), std::make_pair(Rik, tik));
 
-//--- ATOMIC
-#pragma omp critical
+                            // Add inliers as valid pairwise matches (thread-local sink, merged below)
+                            matching::PairwiseMatches& threadNewPairMatches = newPairMatchesPerThread[threadId];
+                            for (std::vector<size_t>::const_iterator iterInliers = vecInliers.begin(); iterInliers != vecInliers.end();
+                                 ++iterInliers)
                             {
-                                // Add inliers as valid pairwise matches
-                                for (std::vector<size_t>::const_iterator iterInliers = vecInliers.begin(); iterInliers != vecInliers.end();
-                                     ++iterInliers)
+                                using namespace aliceVision::track;
+                                TracksMap::iterator itTracks = poseTripletTracks.begin();
+                                std::advance(itTracks, *iterInliers);
+                                const Track& track = itTracks->second;
+
+                                // create pairwise matches from inlier track
+                                for (size_t indexI = 0; indexI < track.featPerView.size(); ++indexI)
                                 {
-                                    using namespace aliceVision::track;
-                                    TracksMap::iterator itTracks = poseTripletTracks.begin();
-                                    std::advance(itTracks, *iterInliers);
-                                    const Track& track = itTracks->second;
+                                    Track::FeatureIdPerView::const_iterator iterI = track.featPerView.begin();
+                                    std::advance(iterI, indexI);
+
+                                    // extract camera indexes
+                                    const size_t idViewI = iterI->first;
+                                    const size_t idFeatI = iterI->second.featureId;
 
-                                    // create pairwise matches from inlier track
-                                    for (size_t indexI = 0; indexI < track.featPerView.size(); ++indexI)
+                                    // loop on subtracks
+                                    for (size_t indexJ = indexI + 1; indexJ < track.featPerView.size(); ++indexJ)
                                     {
-                                        Track::FeatureIdPerView::const_iterator iterI = track.featPerView.begin();
-                                        std::advance(iterI, indexI);
+                                        Track::FeatureIdPerView::const_iterator iterJ = track.featPerView.begin();
+                                        std::advance(iterJ, indexJ);
 
                                         // extract camera indexes
-                                        const size_t idViewI = iterI->first;
-                                        const size_t idFeatI = iterI->second.featureId;
+                                        const size_t idViewJ = iterJ->first;
+                                        const size_t idFeatJ = iterJ->second.featureId;
 
-                                        // loop on subtracks
-                                        for (size_t indexJ = indexI + 1; indexJ < track.featPerView.size(); ++indexJ)
-                                        {
-                                            Track::FeatureIdPerView::const_iterator iterJ = track.featPerView.begin();
-                                            std::advance(iterJ, indexJ);
-
-                                            // extract camera indexes
-                                            const size_t idViewJ = iterJ->first;
-                                            const size_t idFeatJ = iterJ->second.featureId;
-
-                                            newpairMatches[std::make_pair(idViewI, idViewJ)][track.descType].emplace_back(idFeatI, idFeatJ);
-                                        }
+                                        threadNewPairMatches[std::make_pair(idViewI, idViewJ)][track.descType].emplace_back(idFeatI, idFeatJ);
                                     }
                                 }
                             }
@@ -535,6 +551,19 @@ void GlobalSfMTranslationAveragingSolver::computePutativeTranslationEdgesCoverag
                 vecInitialEstimates.emplace_back(val);
             }
         }
+
+        // Merge the per-thread pairwise matches sinks
+        for (const matching::PairwiseMatches& threadNewPairMatches : newPairMatchesPerThread)
+        {
+            for (const auto& pairMatches : threadNewPairMatches)
+            {
+                for (const auto& descMatches : pairMatches.second)
+                {
+                    matching::IndMatches& outMatches = newpairMatches[pairMatches.first][descMatches.first];
+                    outMatches.insert(outMatches.end(), descMatches.second.begin(), descMatches.second.end());
+                }
+            }
+        }
     }
 
     const double timeLPTriplet = timerLPTriplet.elapsed();
@@ -557,7 +586,7 @@ void GlobalSfMTranslationAveragingSolver::computePutativeTranslationEdgesCoverag
 bool GlobalSfMTranslationAveragingSolver::estimateTTriplet(const SfMData& sfmData,
                                                            const std::map<IndexT, Mat3>& mapGlobalR,
                                                            const feature::FeaturesPerView& normalizedFeaturesPerView,
-                                                           const matching::PairwiseMatches& pairwiseMatches,
+                                                           const MatchesPerPoseEdge& matchesPerPoseEdge,
                                                            const graph::Triplet& posesId,
                                                            std::mt19937& randomNumberGenerator,
                                                            std::vector<Vec3>& vecTis,
@@ -568,19 +597,7 @@ bool GlobalSfMTranslationAveragingSolver::estimateTTriplet(const SfMData& sfmDat
 {
     // List matches that belong to the triplet of poses
     matching::PairwiseMatches mapTripletMatches;
-    const std::set<IndexT> setPoseIds = {posesId.i, posesId.j, posesId.k};
-    // List shared correspondences (pairs) between poses
-    for (const auto& matchIterator : pairwiseMatches)
-    {
-        const Pair& pair = matchIterator.first;
-        const View* v1 = sfmData.getViews().at(pair.first).get();
-        const View* v2 = sfmData.getViews().at(pair.second).get();
-        if (  // Consider the pair iff it is supported by the triplet graph & 2 different pose id
-          (v1->getPoseId() != v2->getPoseId()) && setPoseIds.count(v1->getPoseId()) && setPoseIds.count(v2->getPoseId()))
-        {
-            mapTripletMatches.insert(matchIterator);
-        }
-    }
+    listTripletMatches(matchesPerPoseEdge, posesId, mapTripletMatches);
 
     aliceVision::track::TracksBuilder tracksBuilder;
     tracksBuilder.build(mapTripletMatches);
@@ -64,6 +64,11 @@ class GlobalSfMTranslationAveragingSolver
     translationAveraging::RelativeInfoVec m_vec_initialRijTijEstimates;
 
   public:
+    /// Match pairs indexed by their (ordered) pose id edge.
+    /// Built once per run, so the triplet estimations only gather the three short
+    /// lists of their edges instead of re-scanning the whole match set.
+    using MatchesPerPoseEdge = std::map<Pair, std::vector<const matching::PairwiseMatches::value_type*>>;
+
     /**
      * @brief Use features in normalized camera frames
      */
@@ -107,7 +112,7 @@ class GlobalSfMTranslationAveragingSolver
     bool estimateTTriplet(const sfmData::SfMData& sfmData,
                           const std::map<IndexT, Mat3>& mapGlobalR,
                           const feature::FeaturesPerView& normalizedFeaturesPerView,
-                          const matching::PairwiseMatches& pairwiseMatches,
+                          const MatchesPerPoseEdge& matchesPerPoseEdge,
                           const graph::Triplet& posesId,
                           std::mt19937& randomNumberGenerator,
                           std::vector<Vec3>& vecTis,
@@ -394,69 +394,54 @@ bool ReconstructionEngine_panorama::adjust()
     options.useFocalPrior = false;
     options.useParametersOrdering = false;
 
-    // Start bundle with rotation only
+    if (_params.solverBackend == EBASolverBackend::GPU)
+        options.setGpuBA();
+
     BundleAdjustmentSymbolicCeres BA(options);
-    bool success = BA.adjust(_sfmData, BundleAdjustmentSymbolicCeres::REFINE_ROTATION);
-    if (success)
-    {
-        ALICEVISION_LOG_INFO("Rotations successfully refined.");
-    }
-    else
-    {
-        ALICEVISION_LOG_WARNING("Failed to refine the rotations only.");
-        return false;
-    }
 
-    if (_params.lockAllIntrinsics)
-    {
-        // Do not modify intrinsic camera parameters
-        return true;
-    }
+    // All the refinement stages run on a single Ceres problem:
+    // only the parameter block masking changes from one stage to the next,
+    // so the problem construction cost is paid once instead of per stage.
+    std::vector<BundleAdjustmentSymbolicCeres::ERefineOptions> refinementStages;
 
-    if (_params.intermediateRefineWithFocal)
-    {
-        success = BA.adjust(_sfmData, BundleAdjustmentSymbolicCeres::REFINE_ROTATION | BundleAdjustmentSymbolicCeres::REFINE_INTRINSICS_FOCAL);
-        if (success)
-        {
-            ALICEVISION_LOG_INFO("Bundle successfully refined: Rotation + Focal");
-        }
-        else
-        {
-            ALICEVISION_LOG_WARNING("Failed to refine: Rotation + Focal");
-            return false;
-        }
-    }
-    if (_params.intermediateRefineWithFocalDist)
+    // Start bundle with rotation only
+    refinementStages.push_back(BundleAdjustmentSymbolicCeres::REFINE_ROTATION);
+
+    if (!_params.lockAllIntrinsics)
     {
-        success = BA.adjust(_sfmData,
-                            BundleAdjustmentSymbolicCeres::REFINE_ROTATION | BundleAdjustmentSymbolicCeres::REFINE_INTRINSICS_FOCAL |
-                              BundleAdjustmentSymbolicCeres::REFINE_INTRINSICS_DISTORTION);
-        if (success)
+        if (_params.intermediateRefineWithFocal)
         {
-            ALICEVISION_LOG_INFO("Bundle successfully refined: Rotation + Focal + Distortion");
+            refinementStages.push_back(BundleAdjustmentSymbolicCeres::REFINE_ROTATION | BundleAdjustmentSymbolicCeres::REFINE_INTRINSICS_FOCAL);
         }
-        else
+        if (_params.intermediateRefineWithFocalDist)
         {
-            ALICEVISION_LOG_WARNING("Failed to refine: Rotation + Focal + Distortion");
-            return false;
+            refinementStages.push_back(BundleAdjustmentSymbolicCeres::REFINE_ROTATION | BundleAdjustmentSymbolicCeres::REFINE_INTRINSICS_FOCAL |
+                                       BundleAdjustmentSymbolicCeres::REFINE_INTRINSICS_DISTORTION);
         }
+
+        // Minimize All
+        refinementStages.push_back(BundleAdjustmentSymbolicCeres::REFINE_ROTATION | BundleAdjustmentSymbolicCeres::REFINE_INTRINSICS_FOCAL |
+                                   BundleAdjustmentSymbolicCeres::REFINE_INTRINSICS_DISTORTION |
+                                   BundleAdjustmentSymbolicCeres::REFINE_INTRINSICS_OPTICALOFFSET_ALWAYS);
     }
 
-    // Minimize All
-    success = BA.adjust(_sfmData,
-                        BundleAdjustmentSymbolicCeres::REFINE_ROTATION | BundleAdjustmentSymbolicCeres::REFINE_INTRINSICS_FOCAL |
-                          BundleAdjustmentSymbolicCeres::REFINE_INTRINSICS_DISTORTION |
-                          BundleAdjustmentSymbolicCeres::REFINE_INTRINSICS_OPTICALOFFSET_ALWAYS);
+    bool success = BA.adjustStages(_sfmData, refinementStages);
     if (success)
     {
-        ALICEVISION_LOG_INFO("Bundle successfully refined: Rotation + Focal + Optical Center + Distortion");
+        ALICEVISION_LOG_INFO("Bundle successfully refined in " << refinementStages.size() << " stage(s).");
     }
     else
     {
-        ALICEVISION_LOG_WARNING("Failed to refine: Rotation + Focal + Distortion + Optical Center");
+        ALICEVISION_LOG_WARNING("Failed to refine the bundle (" << refinementStages.size() << " stage(s)).");
         return false;
     }
 
+    if (_params.lockAllIntrinsics)
+    {
+        // Do not modify intrinsic camera parameters
+        return true;
+    }
+
     // If we have priors
     if (_rotationPriors.size() == _sfmData.getViews().size())
     {
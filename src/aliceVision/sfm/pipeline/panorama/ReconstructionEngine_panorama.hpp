@@ -8,6 +8,7 @@
 #pragma once
 
 #include <aliceVision/sfm/pipeline/ReconstructionEngine.hpp>
+#include <aliceVision/sfm/bundle/BundleAdjustment.hpp>
 #include <aliceVision/sfm/pipeline/global/GlobalSfMRotationAveragingSolver.hpp>
 #include <aliceVision/sfm/pipeline/global/GlobalSfMTranslationAveragingSolver.hpp>
 
@@ -166,6 +167,7 @@ class ReconstructionEngine_panorama : public ReconstructionEngine
         double maxAngularError = 100.0;                //< max angular error in degree (in global rotation averaging)
         bool intermediateRefineWithFocal = false;      //< intermediate refine with rotation+focal
         bool intermediateRefineWithFocalDist = false;  //< intermediate refine with rotation+focal+distortion
+        EBASolverBackend solverBackend = EBASolverBackend::CPU;  //< hardware backend of the bundle adjustment linear solver
     };
     ReconstructionEngine_panorama(const sfmData::SfMData& sfmData,
                                   const Params& params,
@@ -12,6 +12,7 @@
 #include <atomic>
 #include <cassert>
 #include <filesystem>
+#include <mutex>
 
 namespace fs = std::filesystem;
 
@@ -20,6 +21,64 @@ namespace sfm {
 
 using namespace sfmData;
 
+namespace {
+
+/// Feature/descriptor files found in a set of folders: "viewId.describerType.ext" -> full path
+using FeatureFilesIndex = std::map<std::string, std::string>;
+
+FeatureFilesIndex buildFeatureFilesIndex(const std::vector<std::string>& folders)
+{
+    std::vector<FeatureFilesIndex> perFolder(folders.size());
+
+#pragma omp parallel for
+    for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(folders.size()); ++i)
+    {
+        if (!fs::is_directory(folders[i]))
+            continue;
+        for (const auto& entry : fs::directory_iterator(folders[i]))
+        {
+            if (!entry.is_regular_file())
+                continue;
+            const fs::path& path = entry.path();
+            const std::string ext = path.extension().string();
+            if (ext == ".feat" || ext == ".desc")
+                perFolder[i][path.filename().string()] = path.string();
+        }
+    }
+
+    // later folders override earlier ones, matching the probing order of the loaders
+    FeatureFilesIndex index;
+    for (const FeatureFilesIndex& folderIndex : perFolder)
+    {
+        for (const auto& file : folderIndex)
+            index[file.first] = file.second;
+    }
+    return index;
+}
+
+/**
+ * @brief Get the file index of a set of feature folders, enumerating them on first use.
+ * Each folder is listed once instead of being probed with one stat per view per describer
+ * type, which on network filesystems turns minutes of metadata latency into a single pass.
+ */
+const FeatureFilesIndex& getFeatureFilesIndex(const std::vector<std::string>& folders)
+{
+    static std::map<std::string, FeatureFilesIndex> cache;
+    static std::mutex cacheMutex;
+
+    std::string key;
+    for (const std::string& folder : folders)
+        key += folder + "\n";
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto it = cache.find(key);
+    if (it == cache.end())
+        it = cache.emplace(key, buildFeatureFilesIndex(folders)).first;
+    return it->second;
+}
+
+}  // namespace
+
 std::unique_ptr<feature::Regions> loadRegions(const std::vector<std::string>& folders, IndexT viewId, const feature::ImageDescriber& imageDescriber)
 {
     assert(!folders.empty());
@@ -30,16 +89,13 @@ std::unique_ptr<feature::Regions> loadRegions(const std::vector<std::string>& fo
     std::string featFilename;
     std::string descFilename;
 
-    for (const std::string& folder : folders)
+    const FeatureFilesIndex& index = getFeatureFilesIndex(folders);
+    const auto featIt = index.find(basename + "." + imageDescriberTypeName + ".feat");
+    const auto descIt = index.find(basename + "." + imageDescriberTypeName + ".desc");
+    if (featIt != index.end() && descIt != index.end())
     {
-        const fs::path featPath = fs::path(folder) / std::string(basename + "." + imageDescriberTypeName + ".feat");
-        const fs::path descPath = fs::path(folder) / std::string(basename + "." + imageDescriberTypeName + ".desc");
-
-        if (fs::exists(featPath) && fs::exists(descPath))
-        {
-            featFilename = featPath.string();
-            descFilename = descPath.string();
-        }
+        featFilename = featIt->second;
+        descFilename = descIt->second;
     }
 
     if (featFilename.empty() || descFilename.empty())
@@ -71,6 +127,25 @@ std::unique_ptr<feature::Regions> loadRegions(const std::vector<std::string>& fo
     return regionsPtr;
 }
 
+feature::RegionsPerViewCache::Loader createRegionsCacheLoader(const std::vector<std::string>& folders)
+{
+    // the describers are shared between the loads, create them lazily under a lock
+    auto imageDescribers = std::make_shared<std::map<feature::EImageDescriberType, std::unique_ptr<feature::ImageDescriber>>>();
+    auto mutex = std::make_shared<std::mutex>();
+
+    return [folders, imageDescribers, mutex](IndexT viewId, feature::EImageDescriberType descType) -> std::unique_ptr<feature::Regions> {
+        const feature::ImageDescriber* imageDescriber = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(*mutex);
+            std::unique_ptr<feature::ImageDescriber>& describerPtr = (*imageDescribers)[descType];
+            if (describerPtr == nullptr)
+                describerPtr = feature::createImageDescriber(descType);
+            imageDescriber = describerPtr.get();
+        }
+        return loadRegions(folders, viewId, *imageDescriber);
+    };
+}
+
 std::unique_ptr<feature::Regions> loadFeatures(const std::vector<std::string>& folders, IndexT viewId, const feature::ImageDescriber& imageDescriber)
 {
     assert(!folders.empty());
@@ -80,22 +155,10 @@ std::unique_ptr<feature::Regions> loadFeatures(const std::vector<std::string>& f
 
     std::string featFilename;
 
-    // build up a set with normalized paths to remove duplicates
-    std::set<std::string> foldersSet;
-    for (const auto& folder : folders)
-    {
-        if (fs::exists(folder))
-        {
-            foldersSet.insert(fs::canonical(folder).string());
-        }
-    }
-
-    for (const auto& folder : foldersSet)
-    {
-        const fs::path featPath = fs::path(folder) / std::string(basename + "." + imageDescriberTypeName + ".feat");
-        if (fs::exists(featPath))
-            featFilename = featPath.string();
-    }
+    const FeatureFilesIndex& index = getFeatureFilesIndex(folders);
+    const auto featIt = index.find(basename + "." + imageDescriberTypeName + ".feat");
+    if (featIt != index.end())
+        featFilename = featIt->second;
 
     if (featFilename.empty())
         throw std::runtime_error("Can't find view " + basename + " features file");
@@ -12,6 +12,7 @@
 #include <aliceVision/feature/ImageDescriber.hpp>
 #include <aliceVision/feature/imageDescriberCommon.hpp>
 #include <aliceVision/feature/RegionsPerView.hpp>
+#include <aliceVision/feature/RegionsPerViewCache.hpp>
 #include <aliceVision/feature/FeaturesPerView.hpp>
 
 #include <memory>
@@ -28,6 +29,17 @@ namespace sfm {
  */
 std::unique_ptr<feature::Regions> loadRegions(const std::vector<std::string>& folders, IndexT viewId, const feature::ImageDescriber& imageDescriber);
 
+/**
+ * @brief Build a loader for a RegionsPerViewCache from a list of featureFolders.
+ *
+ * The returned loader resolves the regions files in the given folders and creates
+ * one ImageDescriber per describer type on demand.
+ *
+ * @param[in] folders The list of featureFolders
+ * @return a loader usable to create a feature::RegionsPerViewCache
+ */
+feature::RegionsPerViewCache::Loader createRegionsCacheLoader(const std::vector<std::string>& folders);
+
 /**
  * @brief Load Features for one view.
  * @param[in] folders The list of featureFolders
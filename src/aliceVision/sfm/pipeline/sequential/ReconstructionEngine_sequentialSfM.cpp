@@ -40,6 +40,8 @@
 #include <tuple>
 #include <iostream>
 #include <algorithm>
+#include <cstdint>
+#include <fstream>
 
 #ifdef _MSC_VER
     #pragma warning(once : 4267)  // warning C4267: 'argument' : conversion from 'size_t' to 'const int', possible loss of data
@@ -594,6 +596,10 @@ double ReconstructionEngine_sequentialSfM::incrementalReconstruction()
             }
 
             ++_resectionId;
+
+            // periodic resume checkpoint
+            if (_params.checkpointSteps > 0 && (_resectionId % _params.checkpointSteps) == 0)
+                saveCheckpoint(_outputFolder);
         }
 
         if (_params.rig.useRigConstraint && !_sfmData.getRigs().empty())
@@ -792,6 +798,10 @@ bool ReconstructionEngine_sequentialSfM::bundleAdjustment(std::set<IndexT>& newR
         }
     }
 
+    // override the linear solver backend if requested
+    if (_params.bundleSolverBackend == EBASolverBackend::GPU)
+        options.setGpuBA();
+
     BundleAdjustmentCeres BA(options, _params.minNbCamerasToRefinePrincipalPoint);
 
     // give the local strategy graph is local strategy is enable
@@ -852,6 +862,111 @@ bool ReconstructionEngine_sequentialSfM::bundleAdjustment(std::set<IndexT>& newR
     return true;
 }
 
+namespace {
+// resume checkpoint sidecar layout: magic, version, resection id, per-camera a contrario thresholds
+constexpr std::uint64_t checkpointMagic = 0x74706b6356416673;  // "sfAVckpt"
+constexpr std::uint32_t checkpointVersion = 1;
+}  // namespace
+
+void ReconstructionEngine_sequentialSfM::saveCheckpoint(const std::string& folder) const
+{
+    const auto chronoStart = std::chrono::steady_clock::now();
+
+    // write into temporary files first, so an interrupted save never replaces a complete checkpoint
+    const fs::path sfmTmpPath = fs::path(folder) / "checkpoint_tmp.sfm";
+    const fs::path stateTmpPath = fs::path(folder) / "checkpoint_tmp.bin";
+
+    sfmDataIO::save(_sfmData, sfmTmpPath.string(), sfmDataIO::ESfMData::ALL);
+
+    {
+        std::ofstream stateFile(stateTmpPath.string(), std::ios::binary);
+        if (!stateFile)
+            throw std::runtime_error("Can't write checkpoint state file: " + stateTmpPath.string());
+
+        stateFile.write(reinterpret_cast<const char*>(&checkpointMagic), sizeof(checkpointMagic));
+        stateFile.write(reinterpret_cast<const char*>(&checkpointVersion), sizeof(checkpointVersion));
+        const std::uint64_t resectionId = _resectionId;
+        stateFile.write(reinterpret_cast<const char*>(&resectionId), sizeof(resectionId));
+        const std::uint64_t nbThresholds = _map_ACThreshold.size();
+        stateFile.write(reinterpret_cast<const char*>(&nbThresholds), sizeof(nbThresholds));
+        for (const auto& threshold : _map_ACThreshold)
+        {
+            stateFile.write(reinterpret_cast<const char*>(&threshold.first), sizeof(threshold.first));
+            stateFile.write(reinterpret_cast<const char*>(&threshold.second), sizeof(threshold.second));
+        }
+    }
+
+    fs::rename(sfmTmpPath, fs::path(folder) / "checkpoint.sfm");
+    fs::rename(stateTmpPath, fs::path(folder) / "checkpoint.bin");
+
+    ALICEVISION_LOG_INFO("Resume checkpoint saved (resection id: "
+                         << _resectionId << ") in "
+                         << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - chronoStart).count()
+                         << " msec.");
+}
+
+bool ReconstructionEngine_sequentialSfM::loadCheckpoint(const std::string& folder)
+{
+    const fs::path sfmPath = fs::path(folder) / "checkpoint.sfm";
+    const fs::path statePath = fs::path(folder) / "checkpoint.bin";
+
+    if (!fs::exists(sfmPath) || !fs::exists(statePath))
+    {
+        ALICEVISION_LOG_WARNING("No resume checkpoint found in folder: " << folder);
+        return false;
+    }
+
+    sfmData::SfMData checkpointData;
+    if (!sfmDataIO::load(checkpointData, sfmPath.string(), sfmDataIO::ESfMData::ALL))
+    {
+        ALICEVISION_LOG_WARNING("Unable to load the checkpoint scene: " << sfmPath.string());
+        return false;
+    }
+
+    std::ifstream stateFile(statePath.string(), std::ios::binary);
+    std::uint64_t magic = 0;
+    std::uint32_t version = 0;
+    std::uint64_t resectionId = 0;
+    std::uint64_t nbThresholds = 0;
+    stateFile.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    stateFile.read(reinterpret_cast<char*>(&version), sizeof(version));
+    stateFile.read(reinterpret_cast<char*>(&resectionId), sizeof(resectionId));
+    stateFile.read(reinterpret_cast<char*>(&nbThresholds), sizeof(nbThresholds));
+
+    if (!stateFile || magic != checkpointMagic || version != checkpointVersion)
+    {
+        ALICEVISION_LOG_WARNING("Invalid checkpoint state file: " << statePath.string());
+        return false;
+    }
+
+    std::map<IndexT, double> acThresholds;
+    for (std::uint64_t i = 0; i < nbThresholds; ++i)
+    {
+        IndexT viewId = UndefinedIndexT;
+        double threshold = 0.0;
+        stateFile.read(reinterpret_cast<char*>(&viewId), sizeof(viewId));
+        stateFile.read(reinterpret_cast<char*>(&threshold), sizeof(threshold));
+        acThresholds[viewId] = threshold;
+    }
+
+    if (!stateFile)
+    {
+        ALICEVISION_LOG_WARNING("Truncated checkpoint state file: " << statePath.string());
+        return false;
+    }
+
+    // the data providers (features, matches) relate to the same views and stay valid
+    _sfmData = std::move(checkpointData);
+    _map_ACThreshold = std::move(acThresholds);
+    _resectionId = static_cast<IndexT>(resectionId);
+
+    ALICEVISION_LOG_INFO("Resume checkpoint loaded from " << folder << std::endl
+                                                          << "\t- # poses: " << _sfmData.getPoses().size() << std::endl
+                                                          << "\t- # landmarks: " << _sfmData.getLandmarks().size() << std::endl
+                                                          << "\t- resection id: " << _resectionId);
+    return true;
+}
+
 void ReconstructionEngine_sequentialSfM::exportStatistics(double reconstructionTime)
 {
     const double residual = RMSE(_sfmData);
@@ -996,10 +1111,13 @@ bool ReconstructionEngine_sequentialSfM::findConnectedViews(std::vector<ViewConn
         return false;
 
     // Collect tracksIds
-    std::set<size_t> reconstructed_trackId;
+    // packed in a sorted contiguous array: the per-view set_intersection below streams
+    // through it instead of chasing the nodes of a std::set at every iteration
+    std::vector<std::size_t> reconstructed_trackId;
+    reconstructed_trackId.reserve(_sfmData.getLandmarks().size());
     std::transform(_sfmData.getLandmarks().begin(),
                    _sfmData.getLandmarks().end(),
-                   std::inserter(reconstructed_trackId, reconstructed_trackId.begin()),
+                   std::back_inserter(reconstructed_trackId),
                    stl::RetrieveKey());
 
     const std::set<IndexT> reconstructedIntrinsics = _sfmData.getReconstructedIntrinsics();
@@ -1122,12 +1240,19 @@ bool ReconstructionEngine_sequentialSfM::findNextBestViews(std::vector<IndexT>&
     const std::size_t scoreThreshold = _pyramidThreshold;
 #endif
 
+    // Batch mode: once the reconstruction is past the unstable beginning, resect all the
+    // resectionable candidate views of the iteration in one parallel group instead of several
+    // score-bounded groups, so the pose estimations of an iteration scale with the cores.
+    // The group is always followed by a bundle adjustment, which refines the new poses and
+    // intrinsics before the next candidate scoring.
+    const bool batchResection = _params.useBatchResection && (_sfmData.getPoses().size() >= _params.nbFirstUnstableCameras);
+
     for (std::size_t i = 1; i < vec_viewsScore.size() && std::get<1>(vec_viewsScore[i]) > minPointsThreshold &&  // ensure min number of points
-                            std::get<2>(vec_viewsScore[i]) > scoreThreshold;                                     // ensure score level
+                            (batchResection || std::get<2>(vec_viewsScore[i]) > scoreThreshold);                 // ensure score level
          ++i)
     {
         out_selectedViewIds.push_back(std::get<0>(vec_viewsScore[i]));
-        if (!std::get<3>(vec_viewsScore[i]))
+        if (!std::get<3>(vec_viewsScore[i]) && !batchResection)
         {
             // If we add a new intrinsic, it is a sensitive stage in the process,
             // so it is better to perform a Bundle Adjustment just after.
@@ -1151,7 +1276,7 @@ bool ReconstructionEngine_sequentialSfM::findNextBestViews(std::vector<IndexT>&
 
     // No more than maxImagesPerGroup cameras should be added at once without performing the bundle adjustment (if set to
     // 0, then there is no limit on the number of views that can be added at once)
-    if (_params.maxImagesPerGroup > 0 && out_selectedViewIds.size() > _params.maxImagesPerGroup)
+    if (!batchResection && _params.maxImagesPerGroup > 0 && out_selectedViewIds.size() > _params.maxImagesPerGroup)
         out_selectedViewIds.resize(_params.maxImagesPerGroup);
 
     ALICEVISION_LOG_DEBUG("Find next best views took: "
@@ -1443,13 +1568,9 @@ bool ReconstructionEngine_sequentialSfM::getBestInitialImagePairs(std::vector<Pa
             std::vector<std::size_t> validCommonTracksIds(relativePose_info.vec_inliers.size());
             const Pose3 pose_I = Pose3(Mat3::Identity(), Vec3::Zero());
             const Pose3 pose_J = relativePose_info.relativePose;
-            const Mat34 PI = camI->getProjectiveEquivalent(pose_I);
-            const Mat34 PJ = camJ->getProjectiveEquivalent(pose_J);
             std::size_t i = 0;
             for (const size_t inlier_idx : relativePose_info.vec_inliers)
             {
-                Vec3 X;
-                multiview::TriangulateDLT(PI, xI.col(inlier_idx), PJ, xJ.col(inlier_idx), X);
                 IndexT trackId = commonTracksIds[inlier_idx];
                 auto iter = map_tracksCommon[trackId].featPerView.begin();
                 const Vec2 featI =
@@ -1513,15 +1634,20 @@ std::size_t ReconstructionEngine_sequentialSfM::computeCandidateImageScore(Index
     // The number of cells of the pyramid grid represent the score
     // and ensure a proper repartition of features in images.
     const auto& featsPyramid = _map_featsPyramidPerView.at(viewId);
+    std::vector<std::size_t> featIndexes;  // grid cell indexes in the pyramid, deduplicated per level
+    featIndexes.reserve(trackIds.size());
     for (std::size_t level = 0; level < _params.pyramidDepth; ++level)
     {
-        std::set<std::size_t> featIndexes;  // Set of grid cell indexes in the pyramid
+        featIndexes.clear();
         for (IndexT trackId : trackIds)
         {
-            std::size_t pyramidIndex = featsPyramid.at(trackId * _params.pyramidDepth + level);
-            featIndexes.insert(pyramidIndex);
+            featIndexes.push_back(featsPyramid.at(trackId * _params.pyramidDepth + level));
         }
-        score += featIndexes.size() * _pyramidWeights[level];
+        // count the distinct cells with a sort/unique on the packed array,
+        // cheaper than filling a node-based std::set for every candidate view
+        std::sort(featIndexes.begin(), featIndexes.end());
+        const std::size_t nbOccupiedCells = std::distance(featIndexes.begin(), std::unique(featIndexes.begin(), featIndexes.end()));
+        score += nbOccupiedCells * _pyramidWeights[level];
     }
     return score;
 #endif
@@ -1714,9 +1840,15 @@ void ReconstructionEngine_sequentialSfM::getTracksToTriangulate(const std::set<I
                                                                 const std::set<IndexT>& newReconstructedViews,
                                                                 std::map<IndexT, std::set<IndexT>>& mapTracksToTriangulate) const
 {
-    std::set<IndexT> allReconstructedViews;
-    allReconstructedViews.insert(previousReconstructedViews.begin(), previousReconstructedViews.end());
-    allReconstructedViews.insert(newReconstructedViews.begin(), newReconstructedViews.end());
+    // packed in a sorted contiguous array: every track of the new views
+    // intersects its observations with this list below
+    std::vector<IndexT> allReconstructedViews;
+    allReconstructedViews.reserve(previousReconstructedViews.size() + newReconstructedViews.size());
+    std::set_union(previousReconstructedViews.begin(),
+                   previousReconstructedViews.end(),
+                   newReconstructedViews.begin(),
+                   newReconstructedViews.end(),
+                   std::back_inserter(allReconstructedViews));
 
     std::set<IndexT> allTracksInNewViews;
     track::getTracksInImagesFast(newReconstructedViews, _map_tracksPerView, allTracksInNewViews);
@@ -1732,18 +1864,21 @@ void ReconstructionEngine_sequentialSfM::getTracksToTriangulate(const std::set<I
 
                 const track::Track& track = _map_tracks.at(trackId);
 
-                std::set<IndexT> allViewsSharingTheTrack;
-                std::transform(track.featPerView.begin(),
-                               track.featPerView.end(),
-                               std::inserter(allViewsSharingTheTrack, allViewsSharingTheTrack.begin()),
-                               stl::RetrieveKey());
-
+                // the view ids of track.featPerView are already sorted (flat_map):
+                // intersect them with the reconstructed views in a single merge pass,
+                // without materializing an intermediate std::set per track
                 std::set<IndexT> allReconstructedViewsSharingTheTrack;
-                std::set_intersection(allViewsSharingTheTrack.begin(),
-                                      allViewsSharingTheTrack.end(),
-                                      allReconstructedViews.begin(),
-                                      allReconstructedViews.end(),
-                                      std::inserter(allReconstructedViewsSharingTheTrack, allReconstructedViewsSharingTheTrack.begin()));
+                auto reconstructedViewIt = allReconstructedViews.begin();
+                for (const auto& featPerViewIt : track.featPerView)
+                {
+                    const IndexT viewId = featPerViewIt.first;
+                    while (reconstructedViewIt != allReconstructedViews.end() && *reconstructedViewIt < viewId)
+                        ++reconstructedViewIt;
+                    if (reconstructedViewIt == allReconstructedViews.end())
+                        break;
+                    if (*reconstructedViewIt == viewId)
+                        allReconstructedViewsSharingTheTrack.insert(allReconstructedViewsSharingTheTrack.end(), viewId);
+                }
 
                 if (allReconstructedViewsSharingTheTrack.size() >= _params.minNbObservationsForTriangulation)
                 {
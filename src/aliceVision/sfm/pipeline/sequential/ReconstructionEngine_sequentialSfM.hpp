@@ -50,6 +50,9 @@ class ReconstructionEngine_sequentialSfM : public ReconstructionEngine
         /// Dump current status of the scene every 3 resections
         bool logIntermediateSteps = false;
 
+        /// Write a resume checkpoint in the output folder every N resection groups (0: disabled)
+        std::size_t checkpointSteps = 0;
+
         RigParams rig;
 
         /// Has fixed Intrinsics
@@ -90,11 +93,21 @@ class ReconstructionEngine_sequentialSfM : public ReconstructionEngine
         /// we don't add too much data in one step without bundle adjustment.
         std::size_t maxImagesPerGroup = 30;
 
+        /// Resect all the resectionable candidate views of an iteration in a single
+        /// parallel group instead of several small score-bounded groups, so the pose
+        /// estimation phase scales with the number of cores on large datasets.
+        /// A bundle adjustment is always performed right after each batch and the
+        /// first 'nbFirstUnstableCameras' cameras are still added one by one.
+        bool useBatchResection = false;
+
         /// Threshold for the maximum number of outliers allowed at the end of a BA iteration.
         /// If the limit is not met, another BA iteration is performed.
         /// Using a negative value for this threshold will disable BA iterations.
         int bundleAdjustmentMaxOutliers = 50;
 
+        /// Hardware backend of the bundle adjustment linear solver.
+        EBASolverBackend bundleSolverBackend = EBASolverBackend::CPU;
+
         // Local Bundle Adjustment data
 
         /// The minimum number of shared matches to create an edge between two views (nodes)
@@ -189,6 +202,23 @@ class ReconstructionEngine_sequentialSfM : public ReconstructionEngine
      */
     void exportStatistics(double reconstructionTime);
 
+    /**
+     * @brief Save a resume checkpoint of the engine state: the current scene
+     *        (views with resection ids, poses, intrinsics, landmarks) and the per-camera
+     *        a contrario thresholds. Tracks are not saved as they are deterministically
+     *        rebuilt from the input matches.
+     * @param[in] folder The folder in which the checkpoint files are written
+     */
+    void saveCheckpoint(const std::string& folder) const;
+
+    /**
+     * @brief Restore the engine state from a checkpoint written by saveCheckpoint(),
+     *        so an interrupted reconstruction restarts from the last saved resection group.
+     * @param[in] folder The folder containing the checkpoint files
+     * @return false if no valid checkpoint is found in the given folder
+     */
+    bool loadCheckpoint(const std::string& folder);
+
     /**
      * @brief calibrateRigs
      * @param[in,out] updatedViews add the updated view ids to the list
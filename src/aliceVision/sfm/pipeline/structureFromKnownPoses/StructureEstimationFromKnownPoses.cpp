@@ -25,15 +25,6 @@ using namespace aliceVision::feature;
 using namespace aliceVision::geometry;
 using namespace aliceVision::sfmData;
 
-/// Camera pair epipole (Projection of camera center 2 in the image plane 1)
-inline Vec3 epipole_from_P(const Mat34& P1, const Pose3& P2)
-{
-    const Vec3 c = P2.center();
-    Vec4 center;
-    center << c(0), c(1), c(2), 1.0;
-    return P1 * center;
-}
-
 /// Export point feature based vector to a matrix [(x,y)'T, (x,y)'T]
 /// Use the camera intrinsics in order to get undistorted pixel coordinates
 template<typename MatT>
@@ -76,6 +67,43 @@ void StructureEstimationFromKnownPoses::match(const SfMData& sfmData,
 {
     auto progressDisplay = system::createConsoleProgressDisplay(pairs.size(), std::cout, "Compute pairwise fundamental guided matching:\n");
 
+    // Build once per view and describer type the undistorted feature positions and
+    // a uniform-grid index over them: every pair sharing a view queries the same
+    // index instead of rebuilding a per-pair structure.
+    struct IndexedRegions
+    {
+        std::vector<Vec2> positions;
+        matching::FeaturePositionsGrid grid;
+    };
+    std::map<std::pair<IndexT, feature::EImageDescriberType>, IndexedRegions> indexedRegionsPerView;
+    for (const Pair& pair : pairs)
+    {
+        for (const IndexT viewId : {pair.first, pair.second})
+        {
+            const View* view = sfmData.getViews().at(viewId).get();
+            const Intrinsics::const_iterator iterIntrinsic = sfmData.getIntrinsics().find(view->getIntrinsicId());
+            const IntrinsicBase* cam = (iterIntrinsic != sfmData.getIntrinsics().end()) ? iterIntrinsic->second.get() : nullptr;
+
+            for (feature::EImageDescriberType descType : regionsPerView.getCommonDescTypes(pair))
+            {
+                const auto key = std::make_pair(viewId, descType);
+                if (indexedRegionsPerView.count(key) != 0)
+                    continue;
+
+                const feature::Regions& regions = regionsPerView.getRegions(viewId, descType);
+                IndexedRegions& indexed = indexedRegionsPerView[key];
+                indexed.positions.resize(regions.RegionCount());
+                for (std::size_t i = 0; i < regions.RegionCount(); ++i)
+                    indexed.positions[i] =
+                      (cam && cam->isValid()) ? cam->get_ud_pixel(regions.GetRegionPosition(i)) : regions.GetRegionPosition(i);
+
+                const int width = cam ? int(cam->w()) : int(view->getImage().getWidth());
+                const int height = cam ? int(cam->h()) : int(view->getImage().getHeight());
+                indexed.grid.build(indexed.positions, width, height);
+            }
+        }
+    }
+
 #pragma omp parallel
     for (PairSet::const_iterator it = pairs.begin(); it != pairs.end(); ++it)
     {
@@ -132,22 +160,18 @@ void StructureEstimationFromKnownPoses::match(const SfMData& sfmData,
                       Square(0.8),
                       matches);
 #else
-                    const Vec3 epipole2 = epipole_from_P(P_R, poseL);
-
-                    // const feature::Regions& regions = regionsPerView.getRegions(it->first);
-                    matching::guidedMatchingFundamentalFast<multiview::relativePose::FundamentalEpipolarDistanceError>(
-                      F_lr,
-                      epipole2,
-                      iterIntrinsicL->second.get(),
-                      regionsPerView.getRegions(it->first, descType),
-                      iterIntrinsicR->second.get(),
-                      regionsPerView.getRegions(it->second, descType),
-                      iterIntrinsicR->second->w(),
-                      iterIntrinsicR->second->h(),
-                      // descType,
-                      Square(geometricErrorMax),
-                      Square(0.8),
-                      matches);
+                    const IndexedRegions& lIndexed = indexedRegionsPerView.at({it->first, descType});
+                    const IndexedRegions& rIndexed = indexedRegionsPerView.at({it->second, descType});
+
+                    matching::guidedMatchingFundamentalGrid(F_lr,
+                                                            regionsPerView.getRegions(it->first, descType),
+                                                            lIndexed.positions,
+                                                            regionsPerView.getRegions(it->second, descType),
+                                                            rIndexed.positions,
+                                                            rIndexed.grid,
+                                                            Square(geometricErrorMax),
+                                                            Square(0.8),
+                                                            matches);
 #endif
                     allImagePairMatches[descType] = matches;
                 }
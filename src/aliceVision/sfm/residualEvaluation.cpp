@@ -0,0 +1,80 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2025 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "residualEvaluation.hpp"
+
+#include <iterator>
+
+namespace aliceVision {
+namespace sfm {
+
+ViewReprojectionCache::ViewReprojectionCache(const sfmData::SfMData& sfmData)
+{
+    _entries.reserve(sfmData.getViews().size());
+
+    for (const auto& viewPair : sfmData.getViews())
+    {
+        const sfmData::View& view = *viewPair.second;
+
+        if (!sfmData.isPoseAndIntrinsicDefined(&view))
+            continue;
+
+        Entry entry;
+        entry.pose = sfmData.getPose(view).getTransform();
+        entry.intrinsic = sfmData.getIntrinsics().at(view.getIntrinsicId()).get();
+        _entries.emplace(viewPair.first, entry);
+    }
+}
+
+std::map<IndexT, std::vector<Vec2>> computeObservationResidualsPerView(const sfmData::SfMData& sfmData, const std::set<IndexT>& specificViews)
+{
+    std::map<IndexT, std::vector<Vec2>> residualsPerView;
+
+    if (sfmData.getLandmarks().empty())
+        return residualsPerView;
+
+    const ViewReprojectionCache cache(sfmData);
+
+    // pack the landmarks into an indexable array for the parallel loop
+    std::vector<const sfmData::Landmark*> landmarks;
+    landmarks.reserve(sfmData.getLandmarks().size());
+    for (const auto& landmarkPair : sfmData.getLandmarks())
+        landmarks.push_back(&landmarkPair.second);
+
+#pragma omp parallel
+    {
+        std::map<IndexT, std::vector<Vec2>> shard;
+
+#pragma omp for nowait
+        for (int i = 0; i < static_cast<int>(landmarks.size()); ++i)
+        {
+            const sfmData::Landmark& landmark = *landmarks[i];
+            for (const auto& obs : landmark.getObservations())
+            {
+                if (!specificViews.empty() && specificViews.count(obs.first) == 0)
+                    continue;
+                if (!cache.isValid(obs.first))
+                    continue;
+
+                shard[obs.first].push_back(cache.residual(obs.first, landmark.X, obs.second.getCoordinates()));
+            }
+        }
+
+#pragma omp critical
+        {
+            for (auto& viewResiduals : shard)
+            {
+                std::vector<Vec2>& dst = residualsPerView[viewResiduals.first];
+                dst.insert(dst.end(), std::make_move_iterator(viewResiduals.second.begin()), std::make_move_iterator(viewResiduals.second.end()));
+            }
+        }
+    }
+
+    return residualsPerView;
+}
+
+}  // namespace sfm
+}  // namespace aliceVision
@@ -0,0 +1,78 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2025 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <aliceVision/numeric/numeric.hpp>
+#include <aliceVision/sfmData/SfMData.hpp>
+#include <aliceVision/stl/FlatMap.hpp>
+
+#include <map>
+#include <set>
+#include <vector>
+
+namespace aliceVision {
+namespace sfm {
+
+/**
+ * @brief Per-view cache of the data needed to evaluate observation residuals.
+ *
+ * The statistics, report and filtering loops all evaluate the reprojection residual of
+ * every observation of the scene; resolving the pose and the intrinsic through the scene
+ * maps for each observation (two map lookups, a Pose3 copy and a shared_ptr copy) costs
+ * more than the residual itself on large scenes. This cache resolves them once per view.
+ */
+class ViewReprojectionCache
+{
+  public:
+    explicit ViewReprojectionCache(const sfmData::SfMData& sfmData);
+
+    /// @return true if the view has a defined pose and intrinsic
+    bool isValid(IndexT viewId) const { return _entries.find(viewId) != _entries.end(); }
+
+    const geometry::Pose3& getPose(IndexT viewId) const { return _entries.at(viewId).pose; }
+
+    const camera::IntrinsicBase& getIntrinsic(IndexT viewId) const { return *_entries.at(viewId).intrinsic; }
+
+    /**
+     * @brief Evaluate the reprojection residual of one observation.
+     * @param[in] viewId The view of the observation, must be valid in the cache
+     * @param[in] X The landmark position
+     * @param[in] obsCoords The observed 2D coordinates
+     * @return the residual (x, y) in pixels
+     */
+    Vec2 residual(IndexT viewId, const Vec3& X, const Vec2& obsCoords) const
+    {
+        const Entry& entry = _entries.at(viewId);
+        return entry.intrinsic->residual(entry.pose, X.homogeneous(), obsCoords);
+    }
+
+  private:
+    struct Entry
+    {
+        geometry::Pose3 pose;
+        const camera::IntrinsicBase* intrinsic;
+    };
+
+    stl::flat_map<IndexT, Entry> _entries;
+};
+
+/**
+ * @brief Compute the reprojection residuals of all the observations of the scene, grouped by view.
+ *
+ * The evaluation runs in parallel over the landmarks with the per-view poses and intrinsics
+ * resolved once, so the consumers (statistics, report) only pay for the projections.
+ * The order of the residuals inside a view is unspecified.
+ *
+ * @param[in] sfmData The input SfMData
+ * @param[in] specificViews Restrict the evaluation to these views (empty = all views)
+ * @return the residual vectors (x, y) of each observation, indexed by viewId
+ */
+std::map<IndexT, std::vector<Vec2>> computeObservationResidualsPerView(const sfmData::SfMData& sfmData,
+                                                                       const std::set<IndexT>& specificViews = std::set<IndexT>());
+
+}  // namespace sfm
+}  // namespace aliceVision
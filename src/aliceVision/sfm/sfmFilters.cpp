@@ -7,10 +7,12 @@
 
 #include "sfmFilters.hpp"
 #include <aliceVision/sfmData/SfMData.hpp>
+#include <aliceVision/sfm/residualEvaluation.hpp>
 #include <aliceVision/stl/stl.hpp>
 #include <aliceVision/system/Logger.hpp>
 #include <aliceVision/sfm/bundle/BundleAdjustment.hpp>
 
+#include <algorithm>
 #include <iterator>
 
 namespace aliceVision {
@@ -21,21 +23,31 @@ IndexT removeOutliersWithPixelResidualError(sfmData::SfMData& sfmData,
                                             const double dThresholdPixel,
                                             const unsigned int minTrackLength)
 {
+    // resolve the per-view poses and intrinsics once: this filter runs after every bundle
+    // adjustment iteration and evaluates every observation of the scene.
+    const ViewReprojectionCache cache(sfmData);
+
+    using LandmarksKeysVec = std::vector<sfmData::Landmarks::key_type>;
+    LandmarksKeysVec vKeys;
+    vKeys.reserve(sfmData.getLandmarks().size());
+    std::transform(sfmData.getLandmarks().cbegin(), sfmData.getLandmarks().cend(), std::back_inserter(vKeys), stl::RetrieveKey());
+
+    LandmarksKeysVec toErase;
     IndexT outlierCount = 0;
-    sfmData::Landmarks::iterator iterTracks = sfmData.getLandmarks().begin();
 
-    while (iterTracks != sfmData.getLandmarks().end())
+    // each landmark is only touched by one thread, so its observations can be erased in place
+#pragma omp parallel for reduction(+ : outlierCount)
+    for (int landmarkIndex = 0; landmarkIndex < vKeys.size(); ++landmarkIndex)
     {
-        sfmData::Observations& observations = iterTracks->second.getObservations();
+        sfmData::Landmark& landmark = sfmData.getLandmarks().at(vKeys[landmarkIndex]);
+        sfmData::Observations& observations = landmark.getObservations();
         sfmData::Observations::iterator itObs = observations.begin();
 
         while (itObs != observations.end())
         {
-            const sfmData::View* view = sfmData.getViews().at(itObs->first).get();
-            const geometry::Pose3 pose = sfmData.getPose(*view).getTransform();
-            const camera::IntrinsicBase* intrinsic = sfmData.getIntrinsics().at(view->getIntrinsicId()).get();
+            const geometry::Pose3& pose = cache.getPose(itObs->first);
 
-            Vec2 residual = intrinsic->residual(pose, iterTracks->second.X.homogeneous(), itObs->second.getCoordinates());
+            Vec2 residual = cache.residual(itObs->first, landmark.X, itObs->second.getCoordinates());
             if (featureConstraint == EFeatureConstraint::SCALE && itObs->second.getScale() > 0.0)
             {
                 // Apply the scale of the feature to get a residual value
@@ -43,7 +55,7 @@ IndexT removeOutliersWithPixelResidualError(sfmData::SfMData& sfmData,
                 residual /= itObs->second.getScale();
             }
 
-            if ((pose.depth(iterTracks->second.X) < 0) || (residual.norm() > dThresholdPixel))
+            if ((pose.depth(landmark.X) < 0) || (residual.norm() > dThresholdPixel))
             {
                 ++outlierCount;
                 itObs = observations.erase(itObs);
@@ -53,10 +65,23 @@ IndexT removeOutliersWithPixelResidualError(sfmData::SfMData& sfmData,
         }
 
         if (observations.empty() || observations.size() < minTrackLength)
-            iterTracks = sfmData.getLandmarks().erase(iterTracks);
-        else
-            ++iterTracks;
+        {
+#pragma omp critical
+            toErase.push_back(vKeys[landmarkIndex]);
+        }
     }
+
+    // deferred compaction: the marked landmarks are sorted and erased in a single
+    // forward sweep of the map instead of one full lookup per key
+    std::sort(toErase.begin(), toErase.end());
+    auto itLandmark = sfmData.getLandmarks().begin();
+    for (const auto& landmarkId : toErase)
+    {
+        while (itLandmark->first != landmarkId)
+            ++itLandmark;
+        itLandmark = sfmData.getLandmarks().erase(itLandmark);
+    }
+
     return outlierCount;
 }
 
@@ -144,9 +169,14 @@ IndexT removeOutliersWithAngleError(sfmData::SfMData& sfmData, const double dMin
         }
     }
 
+    // deferred compaction, same single ordered sweep as the pixel residual filter
+    std::sort(toErase.begin(), toErase.end());
+    auto itLandmark = sfmData.getLandmarks().begin();
     for (IndexT key : toErase)
     {
-        sfmData.getLandmarks().erase(key);
+        while (itLandmark->first != key)
+            ++itLandmark;
+        itLandmark = sfmData.getLandmarks().erase(itLandmark);
     }
 
     return toErase.size();
@@ -6,6 +6,7 @@
 
 #include "sfmStatistics.hpp"
 
+#include <aliceVision/sfm/residualEvaluation.hpp>
 #include <aliceVision/sfm/pipeline/localization/SfMLocalizer.hpp>
 
 #include <aliceVision/sfm/pipeline/regionsIO.hpp>
@@ -31,31 +32,15 @@ void computeResidualsHistogram(const sfmData::SfMData& sfmData,
     if (sfmData.getLandmarks().empty())
         return;
 
-    // Collect residuals for each observation
+    // Collect residuals for each observation (batched per view, parallel over landmarks)
+    const std::map<IndexT, std::vector<Vec2>> residualsPerView = computeObservationResidualsPerView(sfmData, specificViews);
+
     std::vector<double> vecResiduals;
     vecResiduals.reserve(sfmData.getLandmarks().size());
 
-    for (const auto& track : sfmData.getLandmarks())
-    {
-        const aliceVision::sfmData::Observations& observations = track.second.getObservations();
-        for (const auto& obs : observations)
-        {
-            if (!specificViews.empty())
-            {
-                if (specificViews.count(obs.first) == 0)
-                    continue;
-            }
-            const sfmData::View& view = sfmData.getView(obs.first);
-            const aliceVision::geometry::Pose3 pose = sfmData.getPose(view).getTransform();
-            const std::shared_ptr<aliceVision::camera::IntrinsicBase> intrinsic = sfmData.getIntrinsics().find(view.getIntrinsicId())->second;
-            const Vec2 residual = intrinsic->residual(pose, track.second.X.homogeneous(), obs.second.getCoordinates());
+    for (const auto& viewResiduals : residualsPerView)
+        for (const Vec2& residual : viewResiduals.second)
             vecResiduals.push_back(residual.norm());
-            // ALICEVISION_LOG_INFO("[AliceVision] sfmtstatistics::computeResidualsHistogram track: " << track.first << ", residual: " <<
-            // residual.norm());
-        }
-    }
-
-    // ALICEVISION_LOG_INFO("[AliceVision] sfmtstatistics::computeResidualsHistogram vecResiduals.size(): " << vec_residuals.size());
 
     if (vecResiduals.empty())
         return;
@@ -330,19 +315,15 @@ void computeResidualsPerView(const sfmData::SfMData& sfmData,
     nbResidualsPerViewThirdQuartile.resize(nbViews);
 
     // Collect residuals (number of residuals per 3D points) of all landmarks visible in each view
+    // (batched per view, parallel over landmarks)
     std::map<IndexT, std::vector<double>> residualsPerView;
 
-    for (const auto& landmark : sfmData.getLandmarks())
+    for (const auto& viewResiduals : computeObservationResidualsPerView(sfmData))
     {
-        const aliceVision::sfmData::Observations& observations = landmark.second.getObservations();
-        for (const auto& obs : observations)
-        {
-            const sfmData::View& view = sfmData.getView(obs.first);
-            const aliceVision::geometry::Pose3 pose = sfmData.getPose(view).getTransform();
-            const std::shared_ptr<aliceVision::camera::IntrinsicBase> intrinsic = sfmData.getIntrinsics().find(view.getIntrinsicId())->second;
-            const Vec2 residual = intrinsic->residual(pose, landmark.second.X.homogeneous(), obs.second.getCoordinates());
-            residualsPerView[obs.first].push_back(residual.norm());
-        }
+        std::vector<double>& norms = residualsPerView[viewResiduals.first];
+        norms.reserve(viewResiduals.second.size());
+        for (const Vec2& residual : viewResiduals.second)
+            norms.push_back(residual.norm());
     }
 
     std::vector<IndexT> viewKeys;
@@ -8,10 +8,14 @@
 #include "sfmTriangulation.hpp"
 #include <aliceVision/multiview/triangulation/Triangulation.hpp>
 #include <aliceVision/robustEstimation/randSampling.hpp>
+#include <aliceVision/stl/FlatMap.hpp>
+#include <aliceVision/stl/stl.hpp>
 #include <aliceVision/system/ProgressDisplay.hpp>
 #include <aliceVision/config.hpp>
 
+#include <algorithm>
 #include <deque>
+#include <iterator>
 #include <memory>
 
 namespace aliceVision {
@@ -30,69 +34,101 @@ StructureComputationBlind::StructureComputationBlind(bool verbose)
 
 void StructureComputationBlind::triangulate(sfmData::SfMData& sfmData, std::mt19937& randomNumberGenerator) const
 {
-    std::deque<IndexT> rejectedId;
     system::ProgressDisplay progressDisplay;
     if (_bConsoleVerbose)
         progressDisplay = system::createConsoleProgressDisplay(sfmData.getLandmarks().size(), std::cout, "Blind triangulation progress:\n");
 
+    // Pack the per-view projection data once: the projective matrix and the undistortion
+    // are shared by every observation of a view, there is no need to rebuild them per track.
+    struct ViewData
+    {
+        Mat34 P;
+        const IntrinsicBase* intrinsic;
+    };
+
+    stl::flat_map<IndexT, ViewData> dataPerView;
+    dataPerView.reserve(sfmData.getViews().size());
+
+    for (const auto& viewPair : sfmData.getViews())
+    {
+        const sfmData::View& view = *viewPair.second;
+
+        if (!sfmData.isPoseAndIntrinsicDefined(&view))
+            continue;
+
+        std::shared_ptr<IntrinsicBase> cam = sfmData.getIntrinsics().at(view.getIntrinsicId());
+        std::shared_ptr<camera::Pinhole> pinHoleCam = std::dynamic_pointer_cast<camera::Pinhole>(cam);
+        if (!pinHoleCam)
+        {
+            ALICEVISION_LOG_ERROR("Camera is not pinhole in triangulate");
+            continue;
+        }
+
+        ViewData data;
+        data.P = pinHoleCam->getProjectiveEquivalent(sfmData.getPose(view).getTransform());
+        data.intrinsic = cam.get();
+        dataPerView.emplace(viewPair.first, data);
+    }
+
+    using LandmarksKeysVec = std::vector<sfmData::Landmarks::key_type>;
+    LandmarksKeysVec vKeys;
+    vKeys.reserve(sfmData.getLandmarks().size());
+    std::transform(sfmData.getLandmarks().cbegin(), sfmData.getLandmarks().cend(), std::back_inserter(vKeys), stl::RetrieveKey());
+
+    LandmarksKeysVec rejectedIds;
+
 #pragma omp parallel
-    for (sfmData::Landmarks::iterator iterTracks = sfmData.getLandmarks().begin(); iterTracks != sfmData.getLandmarks().end(); ++iterTracks)
     {
-#pragma omp single nowait
+        // buffer the rejected tracks per thread, a single merge avoids
+        // serializing the whole loop on a shared container lock
+        LandmarksKeysVec rejectedPerThread;
+
+#pragma omp for nowait
+        for (int i = 0; i < static_cast<int>(vKeys.size()); ++i)
         {
             if (_bConsoleVerbose)
             {
                 ++(progressDisplay);
             }
+
             // Triangulate each landmark
+            sfmData::Landmark& landmark = sfmData.getLandmarks().at(vKeys[i]);
             multiview::Triangulation trianObj;
-            const sfmData::Observations& observations = iterTracks->second.getObservations();
-            for (const auto& itObs : observations)
+            for (const auto& itObs : landmark.getObservations())
             {
-                const sfmData::View* view = sfmData.getViews().at(itObs.first).get();
-                if (sfmData.isPoseAndIntrinsicDefined(view))
-                {
-                    std::shared_ptr<IntrinsicBase> cam = sfmData.getIntrinsics().at(view->getIntrinsicId());
-                    std::shared_ptr<camera::Pinhole> pinHoleCam = std::dynamic_pointer_cast<camera::Pinhole>(cam);
-                    if (!pinHoleCam)
-                    {
-                        ALICEVISION_LOG_ERROR("Camera is not pinhole in triangulate");
-                        continue;
-                    }
-
-                    const Pose3 pose = sfmData.getPose(*view).getTransform();
-                    trianObj.add(pinHoleCam->getProjectiveEquivalent(pose), cam->get_ud_pixel(itObs.second.getCoordinates()));
-                }
+                const auto itViewData = dataPerView.find(itObs.first);
+                if (itViewData == dataPerView.end())
+                    continue;
+
+                trianObj.add(itViewData->second.P, itViewData->second.intrinsic->get_ud_pixel(itObs.second.getCoordinates()));
             }
+
             if (trianObj.size() < 2)
             {
-#pragma omp critical
-                {
-                    rejectedId.push_front(iterTracks->first);
-                }
+                rejectedPerThread.push_back(vKeys[i]);
+                continue;
+            }
+
+            // Compute the 3D point
+            const Vec3 X = trianObj.compute();
+            if (trianObj.minDepth() > 0)  // Keep the point only if it have a positive depth
+            {
+                landmark.X = X;
             }
             else
             {
-                // Compute the 3D point
-                const Vec3 X = trianObj.compute();
-                if (trianObj.minDepth() > 0)  // Keep the point only if it have a positive depth
-                {
-                    iterTracks->second.X = X;
-                }
-                else
-                {
-#pragma omp critical
-                    {
-                        rejectedId.push_front(iterTracks->first);
-                    }
-                }
+                rejectedPerThread.push_back(vKeys[i]);
             }
         }
+
+#pragma omp critical
+        rejectedIds.insert(rejectedIds.end(), rejectedPerThread.begin(), rejectedPerThread.end());
     }
+
     // Erase the unsuccessful triangulated tracks
-    for (auto& it : rejectedId)
+    for (const auto& id : rejectedIds)
     {
-        sfmData.getLandmarks().erase(it);
+        sfmData.getLandmarks().erase(id);
     }
 }
 
@@ -41,6 +41,7 @@ class Landmark
     feature::EImageDescriberType descType = feature::EImageDescriberType::UNINITIALIZED;
     image::RGBColor rgb = image::WHITE;  //!> the color associated to the point
     EEstimatorParameterState state = EEstimatorParameterState::REFINED;
+    Mat3 covariance = Mat3::Zero();  //!> the 3x3 covariance of X, only filled when requested in the bundle adjustment
 
     bool operator==(const Landmark& other) const
     {
@@ -16,6 +16,8 @@
 #include <aliceVision/camera/camera.hpp>
 #include <aliceVision/types.hpp>
 
+#include <boost/pool/pool_alloc.hpp>
+
 #include <stdexcept>
 #include <cassert>
 #include <random>
@@ -35,8 +37,12 @@ using Poses = std::map<IndexT, CameraPose>;
 /// Define a collection of IntrinsicParameter (indexed by view.getIntrinsicId())
 using Intrinsics = std::map<IndexT, std::shared_ptr<aliceVision::camera::IntrinsicBase>>;
 
-/// Define a collection of landmarks are indexed by their TrackId
-using Landmarks = std::map<IndexT, Landmark>;
+/// Define a collection of landmarks are indexed by their TrackId.
+/// The map nodes are allocated from a contiguous memory pool instead of one heap allocation
+/// per landmark: iterating over millions of landmarks (bundle setup, transforms, I/O) then
+/// walks a packed arena in key order instead of pointer-chasing scattered nodes, while keeping
+/// the std::map semantics (stable references, logarithmic insertion) the pipelines rely on.
+using Landmarks = std::map<IndexT, Landmark, std::less<IndexT>, boost::fast_pool_allocator<std::pair<const IndexT, Landmark>>>;
 
 /// Define a collection of Rig
 using Rigs = std::map<IndexT, Rig>;
@@ -13,6 +13,7 @@
 #include <aliceVision/image/io.hpp>
 #include <aliceVision/system/ProgressDisplay.hpp>
 
+#include <limits>
 #include <map>
 #include <random>
 #include <vector>
@@ -24,12 +25,6 @@ void colorizeTracks(SfMData& sfmData)
 {
     auto progressDisplay = system::createConsoleProgressDisplay(sfmData.getLandmarks().size(), std::cout, "\nCompute scene structure color\n");
 
-    std::vector<std::reference_wrapper<Landmark>> remainingLandmarksToColor;
-    remainingLandmarksToColor.reserve(sfmData.getLandmarks().size());
-
-    for (auto& landmarkPair : sfmData.getLandmarks())
-        remainingLandmarksToColor.push_back(landmarkPair.second);
-
     struct ViewInfo
     {
         ViewInfo(IndexT viewId, std::size_t cardinal)
@@ -63,29 +58,21 @@ void colorizeTracks(SfMData& sfmData)
           sortedViewsCardinal.begin(), sortedViewsCardinal.end(), [](const ViewInfo& l, const ViewInfo& r) { return l.cardinal > r.cardinal; });
     }
 
-    // assign each landmark to a view
-    for (ViewInfo& viewCardinal : sortedViewsCardinal)
-    {
-        std::vector<std::reference_wrapper<Landmark>> toKeep;
-        const IndexT viewId = viewCardinal.viewId;
+    // rank of each view in the cardinal ordering
+    std::map<IndexT, std::size_t> viewRanks;  // <ViewId, rank>
+    for (std::size_t rank = 0; rank < sortedViewsCardinal.size(); ++rank)
+        viewRanks[sortedViewsCardinal[rank].viewId] = rank;
 
-        for (int i = 0; i < remainingLandmarksToColor.size(); ++i)
-        {
-            Landmark& landmark = remainingLandmarksToColor.at(i);
-            auto it = landmark.getObservations().find(viewId);
-            if (it != landmark.getObservations().end())
-            {
-                viewCardinal.landmarks.push_back(landmark);
-            }
-            else
-            {
-                toKeep.push_back(landmark);
-            }
-        }
-        std::swap(toKeep, remainingLandmarksToColor);
+    // assign each landmark to the first view of the cardinal ordering that observes it,
+    // in a single pass over the landmarks instead of one sweep of the remaining landmarks per view
+    for (auto& landmarkPair : sfmData.getLandmarks())
+    {
+        std::size_t bestRank = std::numeric_limits<std::size_t>::max();
+        for (const auto& observationPair : landmarkPair.second.getObservations())
+            bestRank = std::min(bestRank, viewRanks.at(observationPair.first));
 
-        if (remainingLandmarksToColor.empty())
-            break;
+        if (bestRank != std::numeric_limits<std::size_t>::max())
+            sortedViewsCardinal[bestRank].landmarks.push_back(landmarkPair.second);
     }
 
     std::random_device randomDevice;
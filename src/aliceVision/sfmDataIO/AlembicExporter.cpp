@@ -471,22 +471,31 @@ void AlembicExporter::addLandmarks(const sfmData::Landmarks& landmarks,
     if (landmarks.empty())
         return;
 
+    // snapshot the landmark map once, so the encoding loops below can work on index ranges
+    // in parallel; the Alembic property writes themselves stay single-threaded
+    std::vector<const sfmData::Landmark*> landmarkPtrs;
+    landmarkPtrs.reserve(landmarks.size());
+    for (const auto& landmark : landmarks)
+        landmarkPtrs.push_back(&landmark.second);
+
+    const std::ptrdiff_t nbLandmarks = static_cast<std::ptrdiff_t>(landmarkPtrs.size());
+
     // Fill vector with the values taken from AliceVision
-    std::vector<V3f> positions;
-    std::vector<Imath::C3f> colors;
-    std::vector<Alembic::Util::uint32_t> descTypes;
-    positions.reserve(landmarks.size());
-    descTypes.reserve(landmarks.size());
+    std::vector<V3f> positions(nbLandmarks);
+    std::vector<Imath::C3f> colors(nbLandmarks);
+    std::vector<Alembic::Util::uint32_t> descTypes(nbLandmarks);
 
     // For all the 3d points in the hash_map
-    for (const auto& landmark : landmarks)
+#pragma omp parallel for
+    for (std::ptrdiff_t i = 0; i < nbLandmarks; ++i)
     {
-        const Vec3& pt = landmark.second.X;
-        const image::RGBColor& color = landmark.second.rgb;
+        const sfmData::Landmark& landmark = *landmarkPtrs[i];
+        const Vec3& pt = landmark.X;
+        const image::RGBColor& color = landmark.rgb;
         // convert position from computer vision convention to computer graphics (opengl-like)
-        positions.emplace_back(pt[0], -pt[1], -pt[2]);
-        colors.emplace_back(color.r() / 255.f, color.g() / 255.f, color.b() / 255.f);
-        descTypes.emplace_back(static_cast<Alembic::Util::uint8_t>(landmark.second.descType));
+        positions[i] = V3f(pt[0], -pt[1], -pt[2]);
+        colors[i] = Imath::C3f(color.r() / 255.f, color.g() / 255.f, color.b() / 255.f);
+        descTypes[i] = static_cast<Alembic::Util::uint8_t>(landmark.descType);
     }
 
     std::vector<Alembic::Util::uint64_t> ids(positions.size());
@@ -512,50 +521,60 @@ void AlembicExporter::addLandmarks(const sfmData::Landmarks& landmarks,
 
     if (withVisibility)
     {
-        std::vector<::uint32_t> visibilitySize;
-        visibilitySize.reserve(positions.size());
-        for (const auto& landmark : landmarks)
+        std::vector<::uint32_t> visibilitySize(nbLandmarks);
+#pragma omp parallel for
+        for (std::ptrdiff_t i = 0; i < nbLandmarks; ++i)
         {
-            visibilitySize.emplace_back(landmark.second.getObservations().size());
+            visibilitySize[i] = landmarkPtrs[i]->getObservations().size();
         }
-        std::size_t nbObservations = std::accumulate(visibilitySize.begin(), visibilitySize.end(), 0);
+
+        // exclusive prefix sum: offset of each landmark's observations in the flat arrays,
+        // so the sharded encoding below can write directly at the final positions
+        std::vector<std::size_t> obsOffsets(nbLandmarks + 1, 0);
+        for (std::ptrdiff_t i = 0; i < nbLandmarks; ++i)
+            obsOffsets[i + 1] = obsOffsets[i] + visibilitySize[i];
+        const std::size_t nbObservations = obsOffsets[nbLandmarks];
 
         // Use std::vector<::uint32_t> and std::vector<float> instead of std::vector<V2i> and std::vector<V2f>
         // Because Maya don't import them correctly
-        std::vector<::uint32_t> visibilityViewId;
+        std::vector<::uint32_t> visibilityViewId(nbObservations);
         std::vector<::uint32_t> visibilityFeatId;
-        visibilityViewId.reserve(nbObservations);
 
         std::vector<float> featPos2d;
         std::vector<float> featScale;
         if (withFeatures)
         {
-            featPos2d.reserve(nbObservations * 2);
-            visibilityFeatId.reserve(nbObservations);
-            featScale.reserve(nbObservations);
+            featPos2d.resize(nbObservations * 2);
+            visibilityFeatId.resize(nbObservations);
+            featScale.resize(nbObservations);
         }
 
-        for (const auto& landmark : landmarks)
+#pragma omp parallel for schedule(dynamic, 1024)
+        for (std::ptrdiff_t i = 0; i < nbLandmarks; ++i)
         {
-            const sfmData::Observations& observations = landmark.second.getObservations();
+            const sfmData::Observations& observations = landmarkPtrs[i]->getObservations();
+            std::size_t offset = obsOffsets[i];
+
             for (const auto& vObs : observations)
             {
                 const sfmData::Observation& obs = vObs.second;
 
                 // viewId
-                visibilityViewId.emplace_back(vObs.first);
+                visibilityViewId[offset] = vObs.first;
 
                 if (withFeatures)
                 {
                     // featureId
-                    visibilityFeatId.emplace_back(obs.getFeatureId());
+                    visibilityFeatId[offset] = obs.getFeatureId();
 
                     // feature 2D position (x, y))
-                    featPos2d.emplace_back(obs.getX());
-                    featPos2d.emplace_back(obs.getY());
+                    featPos2d[2 * offset] = obs.getX();
+                    featPos2d[2 * offset + 1] = obs.getY();
 
-                    featScale.emplace_back(obs.getScale());
+                    featScale[offset] = obs.getScale();
                 }
+
+                ++offset;
             }
         }
 
@@ -891,7 +891,25 @@ bool readXform(const Version& abcVersion, IXform& xform, M44d& mat, sfmData::SfM
 void visitObject(const Version& abcVersion, IObject iObj, M44d mat, sfmData::SfMData& sfmdata, ESfMData flagsPart, bool isReconstructed = true)
 {
     // ALICEVISION_LOG_DEBUG("ABC visit: " << iObj.getFullName());
-    if (iObj.getName() == "mvgCamerasUndefined")
+
+    // Subtree selection: prune whole branches of the hierarchy that the requested flags
+    // cannot use, so that e.g. a views-only import never descends into the point samples.
+    const std::string& objName = iObj.getName();
+    if ((objName == "mvgCloud" || objName == "mvgPointCloud") && !(flagsPart & ESfMData::STRUCTURE))
+    {
+        return;
+    }
+    if ((objName == "mvgCameras" || objName == "mvgCamerasUndefined") &&
+        !(flagsPart & (ESfMData::VIEWS | ESfMData::INTRINSICS | ESfMData::EXTRINSICS)))
+    {
+        return;
+    }
+    if (objName == "mvgAncestors" && !(flagsPart & ESfMData::ANCESTORS))
+    {
+        return;
+    }
+
+    if (objName == "mvgCamerasUndefined")
         isReconstructed = false;
 
     const MetaData& md = iObj.getMetaData();
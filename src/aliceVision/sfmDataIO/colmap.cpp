@@ -8,6 +8,7 @@
 #include <aliceVision/geometry/Pose3.hpp>
 #include <aliceVision/camera/cameraCommon.hpp>
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <sstream>
@@ -286,16 +287,22 @@ void generateColmapImagesTxtFile(const sfmData::SfMData& sfmData, const Compatib
     // visibility list
     const auto perViewVisibility = computePerViewVisibility(sfmData, viewSelections);
 
-    // for each view to export add a line with the pose and the intrinsics ID and another with point visibility
+    // snapshot the views to export, keeping the view map order
+    std::vector<const sfmData::View*> viewPtrs;
+    viewPtrs.reserve(viewSelections.size());
     for (const auto& iter : sfmData.getViews())
     {
-        const auto view = iter.second.get();
-        const auto viewID = view->getViewId();
+        if (viewSelections.find(iter.second->getViewId()) != viewSelections.end())
+            viewPtrs.push_back(iter.second.get());
+    }
 
-        if (viewSelections.find(viewID) == viewSelections.end())
-        {
-            continue;
-        }
+    // for each view to export add a line with the pose and the intrinsics ID and another with point visibility
+    // the per-view lines are formatted in parallel and written in order as soon as they are ready
+#pragma omp parallel for ordered schedule(static, 1)
+    for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(viewPtrs.size()); ++i)
+    {
+        const sfmData::View* view = viewPtrs[i];
+        const auto viewID = view->getViewId();
 
         // this is necessary if we copy the images in the image folder because the image path is absolute in AV
         const std::string imageFilename = fs::path(view->getImage().getImagePath()).filename().string();
@@ -306,18 +313,24 @@ void generateColmapImagesTxtFile(const sfmData::SfMData& sfmData, const Compatib
         const Vec3 tra = pose.translation();
         Eigen::Quaterniond quat(rot);
 
+        std::ostringstream viewLines;
+        viewLines.precision(17);
+
         //"#   IMAGE_ID, QW, QX, QY, QZ, TX, TY, TZ, CAMERA_ID, NAME\n"
         //"#   POINTS2D[] as (X, Y, POINT3D_ID)\n"
-        outfile << viewID << " " << quat.w() << " " << quat.x() << " " << quat.y() << " " << quat.z() << " " << tra[0] << " " << tra[1] << " "
-                << tra[2] << " " << intrID << " " << imageFilename << "\n";
+        viewLines << viewID << " " << quat.w() << " " << quat.x() << " " << quat.y() << " " << quat.z() << " " << tra[0] << " " << tra[1] << " "
+                  << tra[2] << " " << intrID << " " << imageFilename << "\n";
 
         for (const auto& obs : perViewVisibility.at(viewID))
         {
             const auto& id = obs.first;
             const auto& pts = obs.second;
-            outfile << pts.x() << " " << pts.y() << " " << id << " ";
+            viewLines << pts.x() << " " << pts.y() << " " << id << " ";
         }
-        outfile << "\n";
+        viewLines << "\n";
+
+#pragma omp ordered
+        outfile << viewLines.str();
     }
 }
 
@@ -351,27 +364,50 @@ void generateColmapPoints3DTxtFile(const sfmData::SfMData& sfmData, const Compat
     // default reprojection error (not used)
     const double defaultError{-1.0};
 
+    // snapshot the landmark map once, so index ranges of it can be encoded independently
+    std::vector<const sfmData::Landmarks::value_type*> landmarkPtrs;
+    landmarkPtrs.reserve(sfmData.getLandmarks().size());
     for (const auto& iter : sfmData.getLandmarks())
+        landmarkPtrs.push_back(&iter);
+
+    // sharded encoding: every shard of landmarks is formatted in parallel, the single writer
+    // below appends a shard as soon as it is ready while the later shards are still encoding
+    const std::ptrdiff_t shardSize = 100000;
+    const std::ptrdiff_t nbShards = (landmarkPtrs.size() + shardSize - 1) / shardSize;
+
+#pragma omp parallel for ordered schedule(static, 1)
+    for (std::ptrdiff_t shardIndex = 0; shardIndex < nbShards; ++shardIndex)
     {
-        const IndexT id = iter.first;
-        const Vec3 exportPoint = iter.second.X;
-        const auto pointColor = iter.second.rgb;
-        outfile << id << " " << exportPoint.x() << " " << exportPoint.y() << " " << exportPoint.z() << " " << static_cast<int>(pointColor.r()) << " "
-                << static_cast<int>(pointColor.g()) << " " << static_cast<int>(pointColor.b()) << " ";
+        const std::ptrdiff_t shardBegin = shardIndex * shardSize;
+        const std::ptrdiff_t shardEnd = std::min<std::ptrdiff_t>(shardBegin + shardSize, landmarkPtrs.size());
 
-        outfile << defaultError;
+        std::ostringstream shard;
 
-        for (const auto& itObs : iter.second.getObservations())
+        for (std::ptrdiff_t i = shardBegin; i < shardEnd; ++i)
         {
-            const IndexT viewId = itObs.first;
-            const IndexT featId = itObs.second.getFeatureId();
+            const IndexT id = landmarkPtrs[i]->first;
+            const Vec3 exportPoint = landmarkPtrs[i]->second.X;
+            const auto pointColor = landmarkPtrs[i]->second.rgb;
+            shard << id << " " << exportPoint.x() << " " << exportPoint.y() << " " << exportPoint.z() << " " << static_cast<int>(pointColor.r())
+                  << " " << static_cast<int>(pointColor.g()) << " " << static_cast<int>(pointColor.b()) << " ";
+
+            shard << defaultError;
 
-            if (viewSelections.find(viewId) != viewSelections.end())
+            for (const auto& itObs : landmarkPtrs[i]->second.getObservations())
             {
-                outfile << " " << viewId << " " << featId;
+                const IndexT viewId = itObs.first;
+                const IndexT featId = itObs.second.getFeatureId();
+
+                if (viewSelections.find(viewId) != viewSelections.end())
+                {
+                    shard << " " << viewId << " " << featId;
+                }
             }
+            shard << "\n";
         }
-        outfile << "\n";
+
+#pragma omp ordered
+        outfile << shard.str();
     }
 }
 
@@ -0,0 +1,171 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "gzipIO.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+namespace aliceVision {
+namespace sfmDataIO {
+
+namespace {
+
+/// Size of the chunks compressed in parallel as independent gzip members.
+constexpr std::size_t GZIP_CHUNK_SIZE = 8 * 1024 * 1024;
+
+/// windowBits value asking zlib for the gzip framing instead of the raw zlib one
+constexpr int GZIP_WINDOW_BITS = 15 + 16;
+
+/// Compress one chunk into a standalone gzip member.
+std::string compressChunk(const unsigned char* data, std::size_t size)
+{
+    z_stream strm;
+    std::memset(&strm, 0, sizeof(strm));
+    if (deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, GZIP_WINDOW_BITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        throw std::runtime_error("gzip compression initialization failed.");
+
+    std::string out;
+    out.resize(deflateBound(&strm, uLong(size)));
+
+    strm.next_in = const_cast<Bytef*>(data);
+    strm.avail_in = uInt(size);
+    strm.next_out = reinterpret_cast<Bytef*>(&out[0]);
+    strm.avail_out = uInt(out.size());
+
+    const int status = deflate(&strm, Z_FINISH);
+    deflateEnd(&strm);
+    if (status != Z_STREAM_END)
+        throw std::runtime_error("gzip compression failed.");
+
+    out.resize(out.size() - strm.avail_out);
+    return out;
+}
+
+}  // namespace
+
+bool isGzipBuffer(const unsigned char* data, std::size_t size) { return size >= 2 && data[0] == 0x1f && data[1] == 0x8b; }
+
+std::string gzipCompress(const std::string& text)
+{
+    const std::size_t nbChunks = std::max<std::size_t>(1, (text.size() + GZIP_CHUNK_SIZE - 1) / GZIP_CHUNK_SIZE);
+    std::vector<std::string> members(nbChunks);
+
+#pragma omp parallel for
+    for (std::int64_t i = 0; i < std::int64_t(nbChunks); ++i)
+    {
+        const std::size_t begin = std::size_t(i) * GZIP_CHUNK_SIZE;
+        const std::size_t size = std::min(GZIP_CHUNK_SIZE, text.size() - begin);
+        members[i] = compressChunk(reinterpret_cast<const unsigned char*>(text.data()) + begin, size);
+    }
+
+    std::size_t outSize = 0;
+    for (const std::string& member : members)
+        outSize += member.size();
+
+    std::string out;
+    out.reserve(outSize);
+    for (const std::string& member : members)
+        out += member;
+    return out;
+}
+
+std::string gzipDecompress(const unsigned char* data, std::size_t size)
+{
+    z_stream strm;
+    std::memset(&strm, 0, sizeof(strm));
+    if (inflateInit2(&strm, GZIP_WINDOW_BITS) != Z_OK)
+        throw std::runtime_error("gzip decompression initialization failed.");
+
+    std::string out;
+    std::vector<char> buffer(4 * 1024 * 1024);
+
+    strm.next_in = const_cast<Bytef*>(data);
+    strm.avail_in = uInt(size);
+
+    // inflate stops at the end of each gzip member, reset and continue while input remains
+    // (the compressor emits one member per chunk)
+    int status = Z_OK;
+    do
+    {
+        strm.next_out = reinterpret_cast<Bytef*>(buffer.data());
+        strm.avail_out = uInt(buffer.size());
+
+        status = inflate(&strm, Z_NO_FLUSH);
+        if (status != Z_OK && status != Z_STREAM_END)
+        {
+            inflateEnd(&strm);
+            throw std::runtime_error("gzip decompression failed.");
+        }
+
+        out.append(buffer.data(), buffer.size() - strm.avail_out);
+
+        if (status == Z_STREAM_END && strm.avail_in > 0)
+        {
+            if (inflateReset(&strm) != Z_OK)
+            {
+                inflateEnd(&strm);
+                throw std::runtime_error("gzip decompression failed.");
+            }
+            status = Z_OK;
+        }
+    } while (status != Z_STREAM_END);
+
+    inflateEnd(&strm);
+    return out;
+}
+
+std::string readPossiblyCompressedFile(const std::string& filename)
+{
+    std::ifstream stream(filename, std::ios::in | std::ios::binary);
+    if (!stream)
+        throw std::runtime_error("Unable to open the file: '" + filename + "'.");
+
+    const std::string raw(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>{});
+    if (isGzipBuffer(reinterpret_cast<const unsigned char*>(raw.data()), raw.size()))
+        return gzipDecompress(reinterpret_cast<const unsigned char*>(raw.data()), raw.size());
+    return raw;
+}
+
+void writePossiblyCompressedFile(const std::string& filename, const std::string& text, bool compress)
+{
+    std::ofstream stream(filename, std::ios::out | std::ios::binary);
+    if (!stream)
+        throw std::runtime_error("Unable to create the file: '" + filename + "'.");
+
+    if (compress)
+    {
+        const std::string compressed = gzipCompress(text);
+        stream.write(compressed.data(), compressed.size());
+    }
+    else
+    {
+        stream.write(text.data(), text.size());
+    }
+
+    if (!stream)
+        throw std::runtime_error("Unable to write the file: '" + filename + "'.");
+}
+
+bool compressionRequestedFromEnv()
+{
+    const char* value = std::getenv("ALICEVISION_SFMDATA_COMPRESSION");
+    if (value == nullptr)
+        return false;
+    const std::string v(value);
+    return v == "1" || v == "on" || v == "ON" || v == "true" || v == "TRUE";
+}
+
+}  // namespace sfmDataIO
+}  // namespace aliceVision
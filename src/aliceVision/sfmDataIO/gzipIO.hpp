@@ -0,0 +1,64 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace aliceVision {
+namespace sfmDataIO {
+
+/**
+ * @brief Check whether a buffer starts with the gzip magic bytes.
+ * @param[in] data The buffer
+ * @param[in] size The buffer size
+ * @return true if the buffer holds a gzip stream
+ */
+bool isGzipBuffer(const unsigned char* data, std::size_t size);
+
+/**
+ * @brief Compress text into a gzip stream.
+ * The text is split into chunks compressed in parallel as independent gzip members, so the
+ * output is a standard multi-member gzip stream (readable by any gzip tool).
+ * @param[in] text The text to compress
+ * @return the gzip stream
+ */
+std::string gzipCompress(const std::string& text);
+
+/**
+ * @brief Decompress a (possibly multi-member) gzip stream.
+ * @param[in] data The gzip stream
+ * @param[in] size The gzip stream size
+ * @return the decompressed text
+ */
+std::string gzipDecompress(const unsigned char* data, std::size_t size);
+
+/**
+ * @brief Read a whole text file, decompressing it transparently when it is gzip-compressed.
+ * @param[in] filename The filename
+ * @return the file content
+ */
+std::string readPossiblyCompressedFile(const std::string& filename);
+
+/**
+ * @brief Write a whole text file, gzip-compressed or raw.
+ * @param[in] filename The filename
+ * @param[in] text The file content
+ * @param[in] compress Write a gzip stream instead of the raw text
+ */
+void writePossiblyCompressedFile(const std::string& filename, const std::string& text, bool compress);
+
+/**
+ * @brief Check whether the ALICEVISION_SFMDATA_COMPRESSION environment variable requests
+ * compressed SfMData files ("1", "on" or "true"), so that a whole pipeline can switch to
+ * compressed storage without touching every call site.
+ * @return true if compression is requested
+ */
+bool compressionRequestedFromEnv();
+
+}  // namespace sfmDataIO
+}  // namespace aliceVision
@@ -6,16 +6,290 @@
 
 #include "jsonIO.hpp"
 #include <aliceVision/camera/camera.hpp>
+#include <aliceVision/sfmDataIO/gzipIO.hpp>
 #include <aliceVision/sfmDataIO/viewIO.hpp>
+#include <aliceVision/system/Logger.hpp>
 
 #include <boost/property_tree/json_parser.hpp>
 
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
 #include <memory>
+#include <sstream>
 #include <cassert>
 
+namespace fs = std::filesystem;
+
 namespace aliceVision {
 namespace sfmDataIO {
 
+namespace {
+
+/**
+ * @brief Skip one JSON value of a raw JSON document.
+ * @param[in] text The raw JSON document
+ * @param[in] pos The position of the first character of the value
+ * @return the position just after the value
+ */
+std::size_t skipJsonValue(const std::string& text, std::size_t pos)
+{
+    const auto skipString = [&text](std::size_t p) -> std::size_t {
+        ++p;  // opening quote
+        while (p < text.size())
+        {
+            if (text[p] == '\\')
+                p += 2;
+            else if (text[p] == '"')
+                return p + 1;
+            else
+                ++p;
+        }
+        return p;
+    };
+
+    if (text[pos] == '"')
+        return skipString(pos);
+
+    if (text[pos] == '{' || text[pos] == '[')
+    {
+        int depth = 0;
+        while (pos < text.size())
+        {
+            const char c = text[pos];
+            if (c == '"')
+            {
+                pos = skipString(pos);
+                continue;
+            }
+            if (c == '{' || c == '[')
+                ++depth;
+            else if (c == '}' || c == ']')
+            {
+                --depth;
+                if (depth == 0)
+                    return pos + 1;
+            }
+            ++pos;
+        }
+        return pos;
+    }
+
+    // scalar value
+    while (pos < text.size() && text[pos] != ',' && text[pos] != '}' && text[pos] != ']')
+        ++pos;
+    return pos;
+}
+
+/**
+ * @brief Remove the given top-level sections from a raw JSON document.
+ *
+ * The document is scanned, not parsed: the byte ranges of the dropped sections are never
+ * handed to the property tree parser, so loading a subpart of a large file does not pay
+ * for the sections it does not need.
+ *
+ * @param[in] text The raw JSON document
+ * @param[in] sections The names of the top-level sections to remove
+ * @return the filtered JSON document
+ */
+std::string removeJsonTopLevelSections(const std::string& text, const std::vector<std::string>& sections)
+{
+    std::string out;
+    out.reserve(text.size());
+
+    std::size_t pos = text.find('{');
+    if (pos == std::string::npos)
+        return text;
+    ++pos;
+    out.append(text, 0, pos);
+
+    bool firstKeptMember = true;
+    while (pos < text.size())
+    {
+        // skip whitespace and member separators
+        while (pos < text.size() && (std::isspace(static_cast<unsigned char>(text[pos])) || text[pos] == ','))
+            ++pos;
+        if (pos >= text.size() || text[pos] == '}')
+            break;
+
+        // member key
+        const std::size_t memberBegin = pos;
+        const std::size_t keyEnd = skipJsonValue(text, pos);
+        const std::string key = text.substr(memberBegin + 1, keyEnd - memberBegin - 2);
+
+        // member value
+        pos = keyEnd;
+        while (pos < text.size() && text[pos] != ':')
+            ++pos;
+        ++pos;
+        while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos])))
+            ++pos;
+        const std::size_t memberEnd = skipJsonValue(text, pos);
+
+        if (std::find(sections.begin(), sections.end(), key) == sections.end())
+        {
+            if (!firstKeptMember)
+                out += ',';
+            out += '\n';
+            out.append(text, memberBegin, memberEnd - memberBegin);
+            firstKeptMember = false;
+        }
+        pos = memberEnd;
+    }
+
+    out += "\n}\n";
+    return out;
+}
+
+// Binary structure sidecar layout (all fields little-endian, native layout):
+// - header: magic (8 chars), version (uint32), hasObservations (uint8), hasFeatures (uint8),
+//   number of landmarks (uint64)
+// - landmark records: {landmarkId (uint32), descType (uint8), rgb (3 * uint8), X (3 * double),
+//   nbObservations (uint32)} followed by the observation records
+//   {viewId (uint32), featureId (uint32), x (2 * double), scale (double)}
+const char STRUCTURE_BLOB_MAGIC[8] = {'A', 'V', 'S', 'T', 'R', 'U', 'C', 'T'};
+const std::uint32_t STRUCTURE_BLOB_VERSION = 1;
+
+void saveStructureBlob(const sfmData::Landmarks& landmarks, const std::string& filename, bool saveObservations, bool saveFeatures)
+{
+    std::ofstream stream(filename, std::ios::out | std::ios::binary);
+
+    const std::uint8_t hasObservations = saveObservations ? 1 : 0;
+    const std::uint8_t hasFeatures = (saveObservations && saveFeatures) ? 1 : 0;
+    const std::uint64_t nbLandmarks = landmarks.size();
+
+    stream.write(STRUCTURE_BLOB_MAGIC, sizeof(STRUCTURE_BLOB_MAGIC));
+    stream.write(reinterpret_cast<const char*>(&STRUCTURE_BLOB_VERSION), sizeof(STRUCTURE_BLOB_VERSION));
+    stream.write(reinterpret_cast<const char*>(&hasObservations), sizeof(hasObservations));
+    stream.write(reinterpret_cast<const char*>(&hasFeatures), sizeof(hasFeatures));
+    stream.write(reinterpret_cast<const char*>(&nbLandmarks), sizeof(nbLandmarks));
+
+    for (const auto& landmarkPair : landmarks)
+    {
+        const sfmData::Landmark& landmark = landmarkPair.second;
+
+        const std::uint32_t landmarkId = landmarkPair.first;
+        const std::uint8_t descType = std::uint8_t(landmark.descType);
+        const std::uint32_t nbObservations = hasObservations ? landmark.getObservations().size() : 0;
+
+        stream.write(reinterpret_cast<const char*>(&landmarkId), sizeof(landmarkId));
+        stream.write(reinterpret_cast<const char*>(&descType), sizeof(descType));
+        stream.write(reinterpret_cast<const char*>(landmark.rgb.data()), 3 * sizeof(std::uint8_t));
+        stream.write(reinterpret_cast<const char*>(landmark.X.data()), 3 * sizeof(double));
+        stream.write(reinterpret_cast<const char*>(&nbObservations), sizeof(nbObservations));
+
+        if (!hasObservations)
+            continue;
+
+        for (const auto& obsPair : landmark.getObservations())
+        {
+            const std::uint32_t viewId = obsPair.first;
+            const std::uint32_t featureId = hasFeatures ? obsPair.second.getFeatureId() : UndefinedIndexT;
+            const Vec2 x = hasFeatures ? obsPair.second.getCoordinates() : Vec2(0.0, 0.0);
+            const double scale = hasFeatures ? obsPair.second.getScale() : 0.0;
+
+            stream.write(reinterpret_cast<const char*>(&viewId), sizeof(viewId));
+            stream.write(reinterpret_cast<const char*>(&featureId), sizeof(featureId));
+            stream.write(reinterpret_cast<const char*>(x.data()), 2 * sizeof(double));
+            stream.write(reinterpret_cast<const char*>(&scale), sizeof(scale));
+        }
+    }
+
+    if (!stream)
+        throw std::runtime_error("Unable to write the structure file: " + filename);
+}
+
+bool loadStructureBlob(sfmData::Landmarks& landmarks, const std::string& filename, bool loadObservations, bool loadFeatures)
+{
+    std::ifstream stream(filename, std::ios::in | std::ios::binary);
+    if (!stream.is_open())
+    {
+        ALICEVISION_LOG_ERROR("Unable to open the structure file: " << filename);
+        return false;
+    }
+
+    char magic[8];
+    std::uint32_t version = 0;
+    std::uint8_t hasObservations = 0;
+    std::uint8_t hasFeatures = 0;
+    std::uint64_t nbLandmarks = 0;
+
+    stream.read(magic, sizeof(magic));
+    stream.read(reinterpret_cast<char*>(&version), sizeof(version));
+    stream.read(reinterpret_cast<char*>(&hasObservations), sizeof(hasObservations));
+    stream.read(reinterpret_cast<char*>(&hasFeatures), sizeof(hasFeatures));
+    stream.read(reinterpret_cast<char*>(&nbLandmarks), sizeof(nbLandmarks));
+
+    if (!stream || !std::equal(magic, magic + sizeof(magic), STRUCTURE_BLOB_MAGIC))
+    {
+        ALICEVISION_LOG_ERROR("Invalid structure file: " << filename);
+        return false;
+    }
+    if (version != STRUCTURE_BLOB_VERSION)
+    {
+        ALICEVISION_LOG_ERROR("Unsupported structure file version " << version << ": " << filename);
+        return false;
+    }
+
+    for (std::uint64_t i = 0; i < nbLandmarks; ++i)
+    {
+        std::uint32_t landmarkId = 0;
+        std::uint8_t descType = 0;
+        std::uint32_t nbObservations = 0;
+        sfmData::Landmark landmark;
+
+        stream.read(reinterpret_cast<char*>(&landmarkId), sizeof(landmarkId));
+        stream.read(reinterpret_cast<char*>(&descType), sizeof(descType));
+        stream.read(reinterpret_cast<char*>(landmark.rgb.data()), 3 * sizeof(std::uint8_t));
+        stream.read(reinterpret_cast<char*>(landmark.X.data()), 3 * sizeof(double));
+        stream.read(reinterpret_cast<char*>(&nbObservations), sizeof(nbObservations));
+
+        landmark.descType = feature::EImageDescriberType(descType);
+        landmark.getObservations().reserve(nbObservations);
+
+        for (std::uint32_t o = 0; o < nbObservations; ++o)
+        {
+            std::uint32_t viewId = 0;
+            std::uint32_t featureId = 0;
+            Vec2 x(0.0, 0.0);
+            double scale = 0.0;
+
+            stream.read(reinterpret_cast<char*>(&viewId), sizeof(viewId));
+            stream.read(reinterpret_cast<char*>(&featureId), sizeof(featureId));
+            stream.read(reinterpret_cast<char*>(x.data()), 2 * sizeof(double));
+            stream.read(reinterpret_cast<char*>(&scale), sizeof(scale));
+
+            if (!loadObservations)
+                continue;
+
+            sfmData::Observation observation;
+            if (loadFeatures)
+            {
+                observation.setFeatureId(featureId);
+                observation.setCoordinates(x);
+                observation.setScale(scale);
+            }
+            landmark.getObservations().emplace_hint(landmark.getObservations().end(), viewId, observation);
+        }
+
+        landmarks.emplace_hint(landmarks.end(), landmarkId, std::move(landmark));
+    }
+
+    if (!stream)
+    {
+        ALICEVISION_LOG_ERROR("Truncated structure file: " << filename);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+std::string getStructureBlobFilename(const std::string& jsonFilename) { return fs::path(jsonFilename).replace_extension(".structure.bin").string(); }
+
 void saveView(const std::string& name, const sfmData::View& view, bpt::ptree& parentTree)
 {
     bpt::ptree viewTree;
@@ -622,17 +896,32 @@ bool saveJSON(const sfmData::SfMData& sfmData, const std::string& filename, ESfM
     // structure
     if (saveStructure && !sfmData.getLandmarks().empty())
     {
-        bpt::ptree structureTree;
+        if ((partFlag & STRUCTURE_AS_BINARY) == STRUCTURE_AS_BINARY)
+        {
+            // store the landmarks in a binary sidecar file, the json only keeps a marker
+            // (the sidecar filename is always derived from the json filename)
+            saveStructureBlob(sfmData.getLandmarks(), getStructureBlobFilename(filename), saveObservations, saveFeatures);
+            fileTree.put("structureBlob", true);
+        }
+        else
+        {
+            bpt::ptree structureTree;
 
-        for (const auto& structurePair : sfmData.getLandmarks())
-            saveLandmark("", structurePair.first, structurePair.second, structureTree, saveObservations, saveFeatures);
+            for (const auto& structurePair : sfmData.getLandmarks())
+                saveLandmark("", structurePair.first, structurePair.second, structureTree, saveObservations, saveFeatures);
 
-        fileTree.add_child("structure", structureTree);
+            fileTree.add_child("structure", structureTree);
+        }
     }
 
-    // write the json file with the tree
+    // write the json file with the tree, gzip-compressed on request
+    // (loading detects the compression from the magic bytes)
 
-    bpt::write_json(filename, fileTree);
+    const bool compress = ((partFlag & COMPRESSED) == COMPRESSED) || compressionRequestedFromEnv();
+
+    std::ostringstream jsonStream;
+    bpt::write_json(jsonStream, fileTree);
+    writePossiblyCompressedFile(filename, jsonStream.str(), compress);
 
     return true;
 }
@@ -658,8 +947,38 @@ bool loadJSON(sfmData::SfMData& sfmData,
     // main tree
     bpt::ptree fileTree;
 
-    // read the json file and initialize the tree
-    bpt::read_json(filename, fileTree);
+    // top-level sections that are not requested by the part flags are stripped from the raw
+    // text before parsing, so that a partial load does not pay for the skipped sections
+    // (the structure section alone usually dominates the file size).
+    std::vector<std::string> skippedSections;
+    if (!loadViews)
+        skippedSections.push_back("views");
+    if (!loadAncestors)
+        skippedSections.push_back("ancestors");
+    if (!loadIntrinsics)
+        skippedSections.push_back("intrinsics");
+    if (!loadExtrinsics)
+    {
+        skippedSections.push_back("poses");
+        skippedSections.push_back("rigs");
+    }
+    if (!loadStructure)
+        skippedSections.push_back("structure");
+
+    // read the json file (decompressed transparently when gzip-compressed) and initialize the tree
+    {
+        const std::string text = readPossiblyCompressedFile(filename);
+        if (skippedSections.empty())
+        {
+            std::istringstream stream(text);
+            bpt::read_json(stream, fileTree);
+        }
+        else
+        {
+            std::istringstream filteredStream(removeJsonTopLevelSections(text, skippedSections));
+            bpt::read_json(filteredStream, fileTree);
+        }
+    }
 
     // version
     {
@@ -717,16 +1036,20 @@ bool loadJSON(sfmData::SfMData& sfmData,
 
         if (incompleteViews)
         {
-            auto children = fileTree.get_child("views");
+            // gather the view nodes upfront: copying the subtree and advancing the list
+            // iterator inside the loop would be quadratic in the number of views
+            bpt::ptree& children = fileTree.get_child("views");
+            std::vector<bpt::ptree*> viewNodes;
+            viewNodes.reserve(children.size());
+            for (bpt::ptree::value_type& viewNode : children)
+                viewNodes.push_back(&viewNode.second);
+
             // update incomplete views
-#pragma omp parallel for
-            for (int index = 0; index < children.size(); index++)
+#pragma omp parallel for schedule(dynamic)
+            for (int index = 0; index < viewNodes.size(); index++)
             {
-                auto it = children.begin();
-                std::advance(it, index);
-
                 auto view = std::make_shared<sfmData::View>();
-                loadView(*view, it->second);
+                loadView(*view, *viewNodes.at(index));
 
                 // if we have the intrinsics and the view has an valid associated intrinsics
                 // update the width and height field of View (they are mirrored)
@@ -802,18 +1125,42 @@ bool loadJSON(sfmData::SfMData& sfmData,
     }
 
     // structure
-    if (loadStructure && fileTree.count("structure"))
+    if (loadStructure)
     {
         sfmData::Landmarks& structure = sfmData.getLandmarks();
 
-        for (bpt::ptree::value_type& landmarkNode : fileTree.get_child("structure"))
+        if (fileTree.get<bool>("structureBlob", false))
+        {
+            if (!loadStructureBlob(structure, getStructureBlobFilename(filename), loadObservations, loadFeatures))
+                return false;
+        }
+        else if (fileTree.count("structure"))
         {
-            IndexT landmarkId;
-            sfmData::Landmark landmark;
+            // deserialize the landmark nodes in parallel, each thread fills its own shard
+            std::vector<bpt::ptree*> landmarkNodes;
+            for (bpt::ptree::value_type& landmarkNode : fileTree.get_child("structure"))
+                landmarkNodes.push_back(&landmarkNode.second);
+
+#pragma omp parallel
+            {
+                sfmData::Landmarks shard;
+
+#pragma omp for nowait
+                for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(landmarkNodes.size()); ++i)
+                {
+                    IndexT landmarkId;
+                    sfmData::Landmark landmark;
 
-            loadLandmark(landmarkId, landmark, landmarkNode.second, loadObservations, loadFeatures);
+                    loadLandmark(landmarkId, landmark, *landmarkNodes[i], loadObservations, loadFeatures);
 
-            structure.emplace(landmarkId, landmark);
+                    shard.emplace_hint(shard.end(), landmarkId, std::move(landmark));
+                }
+
+#pragma omp critical
+                {
+                    structure.insert(std::make_move_iterator(shard.begin()), std::make_move_iterator(shard.end()));
+                }
+            }
         }
     }
 
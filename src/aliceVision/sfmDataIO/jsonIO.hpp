@@ -211,6 +211,18 @@ void saveLandmark(const std::string& name,
  */
 void loadLandmark(IndexT& landmarkId, sfmData::Landmark& landmark, bpt::ptree& landmarkTree, bool loadObservations = true, bool loadFeatures = true);
 
+/**
+ * @brief Return the filename of the binary structure sidecar file of a JSON SfMData file.
+ *
+ * The sidecar is used when saving with the STRUCTURE_AS_BINARY flag: the landmarks are
+ * then stored as packed binary records next to the JSON file instead of the "structure"
+ * JSON node, which keeps multi-million-landmark scenes fast to read and write.
+ *
+ * @param[in] jsonFilename The JSON SfMData filename
+ * @return the sidecar filename
+ */
+std::string getStructureBlobFilename(const std::string& jsonFilename);
+
 /**
  * @brief Save an SfMData in a JSON file with a boost property tree.
  * @param[in] sfmData The input SfMData
@@ -7,12 +7,172 @@
 
 #include "plyIO.hpp"
 
+#include <aliceVision/system/Logger.hpp>
+#include <aliceVision/system/MemoryMappedFile.hpp>
+
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <sstream>
+#include <vector>
 
 namespace aliceVision {
 namespace sfmDataIO {
 
+namespace {
+
+/// Size of the write buffer of the binary PLY encoder.
+constexpr std::size_t PLY_WRITE_BUFFER_SIZE = 16 * 1024 * 1024;
+
+/// Append a packed vertex record (3 float coordinates, 3 uchar colors) to the write buffer,
+/// flushing the buffer to the stream when it is full.
+inline void appendPLYVertex(std::vector<char>& buffer, std::ostream& stream, const Vec3f& point, const image::RGBColor& color)
+{
+    if (buffer.size() + sizeof(float) * 3 + sizeof(uint8_t) * 3 > PLY_WRITE_BUFFER_SIZE)
+    {
+        stream.write(buffer.data(), buffer.size());
+        buffer.clear();
+    }
+    const char* pointData = reinterpret_cast<const char*>(point.data());
+    buffer.insert(buffer.end(), pointData, pointData + sizeof(float) * 3);
+    const char* colorData = reinterpret_cast<const char*>(&color);
+    buffer.insert(buffer.end(), colorData, colorData + sizeof(uint8_t) * 3);
+}
+
+/// Byte size of a scalar PLY property type, 0 if unknown.
+std::size_t plyPropertySize(const std::string& type)
+{
+    if (type == "char" || type == "uchar" || type == "int8" || type == "uint8")
+        return 1;
+    if (type == "short" || type == "ushort" || type == "int16" || type == "uint16")
+        return 2;
+    if (type == "int" || type == "uint" || type == "float" || type == "int32" || type == "uint32" || type == "float32")
+        return 4;
+    if (type == "double" || type == "int64" || type == "uint64" || type == "float64")
+        return 8;
+    return 0;
+}
+
+/// Layout of the vertex element of a PLY file, filled while parsing the header.
+struct PLYVertexLayout
+{
+    std::size_t nbVertices = 0;
+    std::size_t stride = 0;
+    /// byte offsets of the x, y, z coordinates, npos if absent
+    std::size_t position[3] = {std::string::npos, std::string::npos, std::string::npos};
+    /// the coordinates are double instead of float
+    bool doublePosition = false;
+    /// byte offsets of the red, green, blue colors, npos if absent
+    std::size_t color[3] = {std::string::npos, std::string::npos, std::string::npos};
+    /// property names in declaration order, for the ASCII reader
+    std::vector<std::string> propertyNames;
+
+    bool hasPosition() const
+    {
+        return position[0] != std::string::npos && position[1] != std::string::npos && position[2] != std::string::npos;
+    }
+
+    bool hasColor() const { return color[0] != std::string::npos && color[1] != std::string::npos && color[2] != std::string::npos; }
+};
+
+/**
+ * @brief Parse a PLY header from a stream opened in binary mode.
+ * @param[in,out] stream The input stream, positioned on the first byte of the vertex data on success
+ * @param[out] isBinary True for a binary little endian file, false for ASCII
+ * @param[out] layout The vertex element layout
+ * @return true if the header describes a file the reader supports
+ */
+bool parsePLYHeader(std::istream& stream, bool& isBinary, PLYVertexLayout& layout)
+{
+    std::string line;
+    if (!std::getline(stream, line) || line.substr(0, 3) != "ply")
+        return false;
+
+    bool formatRead = false;
+    bool inVertexElement = false;
+
+    while (std::getline(stream, line))
+    {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+
+        std::istringstream lineStream(line);
+        std::string keyword;
+        lineStream >> keyword;
+
+        if (keyword == "comment" || keyword == "obj_info" || keyword.empty())
+            continue;
+
+        if (keyword == "format")
+        {
+            std::string format;
+            lineStream >> format;
+            if (format == "ascii")
+                isBinary = false;
+            else if (format == "binary_little_endian")
+                isBinary = true;
+            else
+            {
+                ALICEVISION_LOG_WARNING("Unsupported PLY format '" << format << "'.");
+                return false;
+            }
+            formatRead = true;
+        }
+        else if (keyword == "element")
+        {
+            std::string name;
+            std::size_t count = 0;
+            lineStream >> name >> count;
+            inVertexElement = (name == "vertex");
+            if (inVertexElement)
+                layout.nbVertices = count;
+            else if (count > 0 && layout.stride == 0)
+            {
+                // an element with data declared before the vertices, the vertex offset is unknown
+                ALICEVISION_LOG_WARNING("Unsupported PLY layout: element '" << name << "' declared before the vertices.");
+                return false;
+            }
+        }
+        else if (keyword == "property" && inVertexElement)
+        {
+            std::string type;
+            std::string name;
+            lineStream >> type >> name;
+            if (type == "list")
+            {
+                ALICEVISION_LOG_WARNING("Unsupported PLY layout: list property in the vertex element.");
+                return false;
+            }
+            const std::size_t size = plyPropertySize(type);
+            if (size == 0)
+            {
+                ALICEVISION_LOG_WARNING("Unsupported PLY property type '" << type << "'.");
+                return false;
+            }
+            if (name == "x" || name == "y" || name == "z")
+            {
+                layout.position[name[0] - 'x'] = layout.stride;
+                layout.doublePosition = (size == 8);
+            }
+            else if (name == "red")
+                layout.color[0] = layout.stride;
+            else if (name == "green")
+                layout.color[1] = layout.stride;
+            else if (name == "blue")
+                layout.color[2] = layout.stride;
+            layout.propertyNames.push_back(name);
+            layout.stride += size;
+        }
+        else if (keyword == "end_header")
+        {
+            return formatRead && layout.hasPosition();
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
 bool savePLY(const sfmData::SfMData& sfmData, const std::string& filename, ESfMData partFlag)
 {
     const bool b_structure = (partFlag & STRUCTURE) == STRUCTURE;
@@ -53,6 +213,12 @@ bool savePLY(const sfmData::SfMData& sfmData, const std::string& filename, ESfMD
                << "property uchar blue" << '\n'
                << "end_header" << std::endl;
 
+        // Encode the binary records in memory and write them in large chunks, instead of issuing
+        // two small stream writes per point.
+        std::vector<char> buffer;
+        if (b_binary)
+            buffer.reserve(PLY_WRITE_BUFFER_SIZE);
+
         if (b_extrinsics)
         {
             for (const auto& view : sfmData.getViews())
@@ -63,9 +229,7 @@ bool savePLY(const sfmData::SfMData& sfmData, const std::string& filename, ESfMD
 
                     if (b_binary)
                     {
-                        Vec3f point = pose.center().cast<float>();
-                        stream.write(reinterpret_cast<const char*>(&point), sizeof(float) * 3);
-                        stream.write(reinterpret_cast<const char*>(&image::GREEN), sizeof(uint8_t) * 3);
+                        appendPLYVertex(buffer, stream, pose.center().cast<float>(), image::GREEN);
                     }
                     else
                     {
@@ -86,9 +250,7 @@ bool savePLY(const sfmData::SfMData& sfmData, const std::string& filename, ESfMD
                 const auto& landmark = iterLandmarks->second;
                 if (b_binary)
                 {
-                    Vec3f point = landmark.X.cast<float>();
-                    stream.write(reinterpret_cast<const char*>(&point), sizeof(float) * 3);
-                    stream.write(reinterpret_cast<const char*>(&landmark.rgb), sizeof(uint8_t) * 3);
+                    appendPLYVertex(buffer, stream, landmark.X.cast<float>(), landmark.rgb);
                 }
                 else
                 {
@@ -97,6 +259,8 @@ bool savePLY(const sfmData::SfMData& sfmData, const std::string& filename, ESfMD
                 }
             }
         }
+        if (!buffer.empty())
+            stream.write(buffer.data(), buffer.size());
         stream.flush();
         bOk = stream.good();
         stream.close();
@@ -104,5 +268,108 @@ bool savePLY(const sfmData::SfMData& sfmData, const std::string& filename, ESfMD
     return bOk;
 }
 
+bool loadPLY(sfmData::SfMData& sfmData, const std::string& filename)
+{
+    // The header is parsed through a stream opened in binary mode, so that the stream position
+    // after "end_header" is the byte offset of the vertex data.
+    std::ifstream stream(filename, std::ios::in | std::ios::binary);
+    if (!stream.is_open())
+    {
+        ALICEVISION_LOG_WARNING("Unable to open the PLY file '" << filename << "'.");
+        return false;
+    }
+
+    bool isBinary = false;
+    PLYVertexLayout layout;
+    if (!parsePLYHeader(stream, isBinary, layout))
+    {
+        ALICEVISION_LOG_WARNING("Unable to parse the PLY header of '" << filename << "'.");
+        return false;
+    }
+
+    sfmData::Landmarks& landmarks = sfmData.getLandmarks();
+
+    if (isBinary)
+    {
+        const std::size_t vertexDataOffset = static_cast<std::size_t>(stream.tellg());
+        stream.close();
+
+        // Map the file instead of streaming it: the vertices are read straight from the page
+        // cache, without a copy through a stream buffer.
+        system::MemoryMappedFile file;
+        if (!file.open(filename))
+        {
+            ALICEVISION_LOG_WARNING("Unable to map the PLY file '" << filename << "'.");
+            return false;
+        }
+        if (vertexDataOffset + layout.nbVertices * layout.stride > file.size())
+        {
+            ALICEVISION_LOG_WARNING("Corrupted PLY file '" << filename << "': truncated vertex data.");
+            return false;
+        }
+
+        const unsigned char* vertexData = file.data() + vertexDataOffset;
+        for (std::size_t i = 0; i < layout.nbVertices; ++i)
+        {
+            const unsigned char* vertex = vertexData + i * layout.stride;
+
+            Vec3 position;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                if (layout.doublePosition)
+                {
+                    double value;
+                    std::memcpy(&value, vertex + layout.position[axis], sizeof(double));
+                    position[axis] = value;
+                }
+                else
+                {
+                    float value;
+                    std::memcpy(&value, vertex + layout.position[axis], sizeof(float));
+                    position[axis] = value;
+                }
+            }
+
+            image::RGBColor color = image::WHITE;
+            if (layout.hasColor())
+            {
+                color = image::RGBColor(vertex[layout.color[0]], vertex[layout.color[1]], vertex[layout.color[2]]);
+            }
+
+            landmarks.emplace_hint(landmarks.end(), IndexT(i), sfmData::Landmark(position, feature::EImageDescriberType::UNINITIALIZED, color));
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i < layout.nbVertices; ++i)
+        {
+            Vec3 position = Vec3::Zero();
+            image::RGBColor color = image::WHITE;
+
+            for (const std::string& name : layout.propertyNames)
+            {
+                double value;
+                if (!(stream >> value))
+                {
+                    ALICEVISION_LOG_WARNING("Corrupted PLY file '" << filename << "': truncated vertex data.");
+                    return false;
+                }
+                if (name == "x" || name == "y" || name == "z")
+                    position[name[0] - 'x'] = value;
+                else if (name == "red")
+                    color.r() = static_cast<unsigned char>(value);
+                else if (name == "green")
+                    color.g() = static_cast<unsigned char>(value);
+                else if (name == "blue")
+                    color.b() = static_cast<unsigned char>(value);
+            }
+
+            landmarks.emplace_hint(landmarks.end(), IndexT(i), sfmData::Landmark(position, feature::EImageDescriberType::UNINITIALIZED, color));
+        }
+    }
+
+    return true;
+}
+
 }  // namespace sfmDataIO
 }  // namespace aliceVision
@@ -15,7 +15,9 @@ namespace aliceVision {
 namespace sfmDataIO {
 
 /**
- * @brief Save the structure and camera positions of a SfMData container as 3D points in a PLY ASCII file.
+ * @brief Save the structure and camera positions of a SfMData container as 3D points in a PLY file.
+ * The file is binary little endian when the filename contains ".bin.", ASCII otherwise;
+ * the binary path encodes the vertices in memory and writes them in large chunks.
  * @param[in] sfmData The input SfMData
  * @param[in] filename The filename
  * @param[in] partFlag The ESfMData save flag
@@ -23,5 +25,16 @@ namespace sfmDataIO {
  */
 bool savePLY(const sfmData::SfMData& sfmData, const std::string& filename, ESfMData partFlag);
 
+/**
+ * @brief Load the vertices of a PLY file as landmarks of a SfMData container.
+ * Binary little endian files are consumed through a read-only memory mapping backed by the
+ * OS page cache, so large lidar point clouds are ingested at disk bandwidth; ASCII files are
+ * parsed through a stream. Only the vertex positions and optional colors are read.
+ * @param[out] sfmData The output SfMData
+ * @param[in] filename The filename
+ * @return true if completed
+ */
+bool loadPLY(sfmData::SfMData& sfmData, const std::string& filename);
+
 }  // namespace sfmDataIO
 }  // namespace aliceVision
@@ -0,0 +1,74 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <aliceVision/sfmData/SfMData.hpp>
+#include <aliceVision/sfmDataIO/plyIO.hpp>
+
+#include <filesystem>
+
+#define BOOST_TEST_MODULE plyIO
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/tools/floating_point_comparison.hpp>
+
+using namespace aliceVision;
+using namespace aliceVision::sfmDataIO;
+
+namespace fs = std::filesystem;
+
+// Create a SfMData with landmarks only, on a deterministic grid with distinct colors
+sfmData::SfMData createPointCloud(std::size_t landmarksCount)
+{
+    sfmData::SfMData sfmData;
+    for (IndexT i = 0; i < landmarksCount; ++i)
+    {
+        const Vec3 position(0.5 * i, -0.25 * i, 10.0 + i);
+        const image::RGBColor color(i % 256, (i * 7) % 256, (i * 13) % 256);
+        sfmData.getLandmarks().emplace(i, sfmData::Landmark(position, feature::EImageDescriberType::UNINITIALIZED, color));
+    }
+    return sfmData;
+}
+
+void checkRoundTrip(const sfmData::SfMData& saved, const std::string& filename)
+{
+    BOOST_REQUIRE(savePLY(saved, filename, ESfMData::STRUCTURE));
+
+    sfmData::SfMData loaded;
+    BOOST_REQUIRE(loadPLY(loaded, filename));
+    BOOST_REQUIRE_EQUAL(loaded.getLandmarks().size(), saved.getLandmarks().size());
+
+    auto loadedIt = loaded.getLandmarks().begin();
+    for (const auto& landmarkPair : saved.getLandmarks())
+    {
+        const sfmData::Landmark& savedLandmark = landmarkPair.second;
+        const sfmData::Landmark& loadedLandmark = loadedIt->second;
+        // positions are stored as float in the file
+        BOOST_CHECK_SMALL((loadedLandmark.X - savedLandmark.X).norm(), 1e-4);
+        BOOST_CHECK(loadedLandmark.rgb == savedLandmark.rgb);
+        ++loadedIt;
+    }
+
+    fs::remove(filename);
+}
+
+BOOST_AUTO_TEST_CASE(plyIO_BinaryRoundTrip)
+{
+    const sfmData::SfMData sfmData = createPointCloud(100);
+    checkRoundTrip(sfmData, (fs::temp_directory_path() / "plyIO_test.bin.ply").string());
+}
+
+BOOST_AUTO_TEST_CASE(plyIO_AsciiRoundTrip)
+{
+    const sfmData::SfMData sfmData = createPointCloud(100);
+    checkRoundTrip(sfmData, (fs::temp_directory_path() / "plyIO_test.ply").string());
+}
+
+BOOST_AUTO_TEST_CASE(plyIO_BinaryBulkWrite)
+{
+    // enough landmarks to force several flushes of the binary write buffer
+    const sfmData::SfMData sfmData = createPointCloud(2000000);
+    checkRoundTrip(sfmData, (fs::temp_directory_path() / "plyIO_test_bulk.bin.ply").string());
+}
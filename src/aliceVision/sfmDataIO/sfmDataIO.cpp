@@ -124,6 +124,10 @@ bool load(aliceVision::sfmData::SfMData& sfmData, const std::string& filename, E
         ALICEVISION_THROW_ERROR("Cannot load the ABC file: \"" << filename << "\", AliceVision is built without Alembic support.");
 #endif
     }
+    else if (extension == ".ply")  // Polygon File
+    {
+        status = loadPLY(sfmData, filename);
+    }
     else if (fs::is_directory(filename))
     {
         status = readGt(filename, sfmData);
@@ -180,8 +184,22 @@ bool save(const aliceVision::sfmData::SfMData& sfmData, const std::string& filen
 
     // rename temporary filename
     if (status)
+    {
         fs::rename(tmpPath, filename);
 
+        // the json writer may have stored the structure in a binary sidecar file
+        if (extension == ".sfm" || extension == ".json")
+        {
+            const std::string tmpBlobPath = getStructureBlobFilename(tmpPath);
+            const std::string blobPath = getStructureBlobFilename(filename);
+
+            if (fs::exists(tmpBlobPath))
+                fs::rename(tmpBlobPath, blobPath);
+            else if (fs::exists(blobPath))
+                fs::remove(blobPath);  // remove the sidecar of a previous save
+        }
+    }
+
     return status;
 }
 
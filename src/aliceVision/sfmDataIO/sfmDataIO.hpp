@@ -34,6 +34,13 @@ enum ESfMData
     POSES_UNCERTAINTY = 128,
     CONSTRAINTS2D = 256,
     ANCESTORS = 512,
+    /// JSON only: store the structure in a binary sidecar file next to the JSON file
+    /// instead of the "structure" JSON node, to keep large scenes fast to read and write.
+    STRUCTURE_AS_BINARY = 1024,
+    /// JSON only: write the file as a gzip stream (also enabled by the
+    /// ALICEVISION_SFMDATA_COMPRESSION environment variable); loading detects the
+    /// compression from the magic bytes, so both forms share the same extension.
+    COMPRESSED = 2048,
 
     UNCERTAINTY = LANDMARKS_UNCERTAINTY | POSES_UNCERTAINTY,
     ALL_DENSE = VIEWS | EXTRINSICS | INTRINSICS | STRUCTURE | OBSERVATIONS | CONSTRAINTS2D | ANCESTORS,
@@ -8,9 +8,11 @@
 #include <aliceVision/system/Timer.hpp>
 #include <aliceVision/sfmData/SfMData.hpp>
 #include <aliceVision/sfmDataIO/sfmDataIO.hpp>
+#include <aliceVision/sfmDataIO/jsonIO.hpp>
 #include <aliceVision/config.hpp>
 
 #include <filesystem>
+#include <fstream>
 #include <sstream>
 
 #define BOOST_TEST_MODULE sfmDataIO
@@ -172,6 +174,88 @@ BOOST_AUTO_TEST_CASE(SfMData_IO_SAVE_LOAD)
     }
 }
 
+BOOST_AUTO_TEST_CASE(SfMData_IO_SAVE_LOAD_STRUCTURE_AS_BINARY)
+{
+    std::vector<std::string> ext_Type = {"sfm", "json"};
+
+    for (int i = 0; i < ext_Type.size(); ++i)
+    {
+        std::ostringstream os;
+        os << "SAVE_LOAD_BLOB"
+           << "." << ext_Type[i];
+        const std::string filename = os.str();
+
+        BOOST_TEST_CONTEXT("SAVE | LOAD with binary structure sidecar, file format: " << ext_Type[i])
+        {
+            const sfmData::SfMData sfmData = createTestScene(2, 2, true);
+            BOOST_CHECK(save(sfmData, filename, ESfMData(ESfMData::ALL | ESfMData::STRUCTURE_AS_BINARY)));
+
+            sfmData::SfMData sfmDataLoad;
+            BOOST_CHECK(load(sfmDataLoad, filename, ESfMData::ALL));
+            BOOST_CHECK_EQUAL(sfmDataLoad.getViews().size(), sfmData.getViews().size());
+            BOOST_CHECK_EQUAL(sfmDataLoad.getLandmarks().size(), sfmData.getLandmarks().size());
+
+            BOOST_CHECK(sfmData == sfmDataLoad);
+        }
+
+        BOOST_TEST_CONTEXT("LOAD without structure from binary sidecar, file format: " << ext_Type[i])
+        {
+            sfmData::SfMData sfmDataLoad;
+            BOOST_CHECK(load(sfmDataLoad, filename, ESfMData::VIEWS));
+            BOOST_CHECK_EQUAL(sfmDataLoad.getLandmarks().size(), 0);
+        }
+
+        BOOST_TEST_CONTEXT("Overwriting without sidecar removes the stale sidecar, file format: " << ext_Type[i])
+        {
+            const sfmData::SfMData sfmData = createTestScene(2, 2, true);
+            BOOST_CHECK(save(sfmData, filename, ESfMData::ALL));
+            BOOST_CHECK(!fs::exists(getStructureBlobFilename(filename)));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(SfMData_IO_SAVE_LOAD_COMPRESSED)
+{
+    std::vector<std::string> ext_Type = {"sfm", "json"};
+
+    for (int i = 0; i < ext_Type.size(); ++i)
+    {
+        std::ostringstream os;
+        os << "SAVE_LOAD_GZIP"
+           << "." << ext_Type[i];
+        const std::string filename = os.str();
+
+        BOOST_TEST_CONTEXT("SAVE | LOAD compressed, file format: " << ext_Type[i])
+        {
+            const sfmData::SfMData sfmData = createTestScene(2, 2, true);
+            BOOST_CHECK(save(sfmData, filename, ESfMData(ESfMData::ALL | ESfMData::COMPRESSED)));
+
+            // the file on disk is a gzip stream
+            {
+                std::ifstream stream(filename, std::ios::binary);
+                unsigned char magic[2] = {0, 0};
+                stream.read(reinterpret_cast<char*>(magic), sizeof(magic));
+                BOOST_CHECK(magic[0] == 0x1f && magic[1] == 0x8b);
+            }
+
+            sfmData::SfMData sfmDataLoad;
+            BOOST_CHECK(load(sfmDataLoad, filename, ESfMData::ALL));
+            BOOST_CHECK_EQUAL(sfmDataLoad.getViews().size(), sfmData.getViews().size());
+            BOOST_CHECK_EQUAL(sfmDataLoad.getLandmarks().size(), sfmData.getLandmarks().size());
+
+            BOOST_CHECK(sfmData == sfmDataLoad);
+        }
+
+        BOOST_TEST_CONTEXT("LOAD a subpart of a compressed file, file format: " << ext_Type[i])
+        {
+            sfmData::SfMData sfmDataLoad;
+            BOOST_CHECK(load(sfmDataLoad, filename, ESfMData::VIEWS));
+            BOOST_CHECK_EQUAL(sfmDataLoad.getViews().size(), 2);
+            BOOST_CHECK_EQUAL(sfmDataLoad.getLandmarks().size(), 0);
+        }
+    }
+}
+
 /*
 BOOST_AUTO_TEST_CASE(SfMData_IO_BigFile) {
   const int nbViews = 1000;
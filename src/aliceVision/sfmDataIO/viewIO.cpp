@@ -329,11 +329,12 @@ bool extractNumberFromFileStem(const std::string& imagePathStem, IndexT& number,
 {
     // check if the image stem contains a number
     // regexFrame: ^(.*\D)?([0-9]+)([\-_\.].*[[:alpha:]].*)?$
-    std::regex regexFrame("^(.*\\D)?"        // the optional prefix which ends with a non digit character
-                          "([0-9]+)"         // the number
-                          "([\\-_\\.]"       // the suffix starts with a separator
-                          ".*[[:alpha:]].*"  // at least one letter in the suffix
-                          ")?$"              // suffix is optional
+    // built once, the function is called for every view of the dataset
+    static const std::regex regexFrame("^(.*\\D)?"        // the optional prefix which ends with a non digit character
+                                       "([0-9]+)"         // the number
+                                       "([\\-_\\.]"       // the suffix starts with a separator
+                                       ".*[[:alpha:]].*"  // at least one letter in the suffix
+                                       ")?$"              // suffix is optional
     );
 
     std::smatch matches;
@@ -7,8 +7,14 @@
 #include <aliceVision/sphereDetection/sphereDetection.hpp>
 
 // Standard libs
+#include <cstdint>
+#include <future>
 #include <iostream>
 #include <numeric>
+#include <utility>
+
+// OpenMP
+#include <aliceVision/alicevision_omp.hpp>
 
 // AliceVision image library
 #include <aliceVision/image/all.hpp>
@@ -99,8 +105,22 @@ void modelExplore(Ort::Session& session)
     }
 }
 
-Prediction predict(Ort::Session& session, const fs::path imagePath, const float minScore)
+namespace {
+
+/**
+ * @brief Image decoded and converted to a network input tensor, ready for inference
+ */
+struct PreparedInput
 {
+    cv::Size size;
+    std::vector<float> tensor;
+    std::vector<int64_t> shape;
+};
+
+PreparedInput prepareInput(const fs::path& imagePath)
+{
+    PreparedInput prepared;
+
     // Read image
     image::Image<image::RGBColor> imageAlice;
     image::readImage(imagePath.string(), imageAlice, image::EImageColorSpace::SRGB);
@@ -108,7 +128,7 @@ Prediction predict(Ort::Session& session, const fs::path imagePath, const float
     // Eigen -> OpenCV
     cv::Mat imageOpencv;
     cv::eigen2cv(imageAlice.getMat(), imageOpencv);
-    cv::Size imageOpencvShape = imageOpencv.size();
+    prepared.size = imageOpencv.size();
 
     // uint8 -> float32
     imageOpencv.convertTo(imageOpencv, CV_32FC3, 1 / 255.0);
@@ -116,19 +136,22 @@ Prediction predict(Ort::Session& session, const fs::path imagePath, const float
     // HWC to CHW
     cv::dnn::blobFromImage(imageOpencv, imageOpencv);
 
+    prepared.shape = {1, 3, imageAlice.height(), imageAlice.width()};
+    prepared.tensor.assign(imageOpencv.begin<float>(), imageOpencv.end<float>());
+
+    return prepared;
+}
+
+Prediction predictPrepared(Ort::Session& session, PreparedInput& prepared, const float minScore)
+{
     // Inference on CPU
     // TODO: use GPU
     Ort::MemoryInfo memoryInfo = Ort::MemoryInfo::CreateCpu(OrtAllocatorType::OrtArenaAllocator, OrtMemType::OrtMemTypeDefault);
 
-    // Initialize input tensor
-    std::vector<int64_t> inputShape = {1, 3, imageAlice.height(), imageAlice.width()};
-    const size_t inputSize = std::accumulate(begin(inputShape), end(inputShape), 1, std::multiplies<size_t>());
-    std::vector<float> inputTensor(inputSize);
-    inputTensor.assign(imageOpencv.begin<float>(), imageOpencv.end<float>());
-
     // Create input data
     std::vector<Ort::Value> inputData;
-    inputData.push_back(Ort::Value::CreateTensor<float>(memoryInfo, inputTensor.data(), inputSize, inputShape.data(), inputShape.size()));
+    inputData.push_back(
+      Ort::Value::CreateTensor<float>(memoryInfo, prepared.tensor.data(), prepared.tensor.size(), prepared.shape.data(), prepared.shape.size()));
 
     // Select inputs and outputs
     std::vector<const char*> inputNames{"input"};
@@ -168,7 +191,15 @@ Prediction predict(Ort::Session& session, const fs::path imagePath, const float
         }
     }
 
-    return Prediction{bboxes, scores, imageOpencvShape};
+    return Prediction{bboxes, scores, prepared.size};
+}
+
+}  // namespace
+
+Prediction predict(Ort::Session& session, const fs::path imagePath, const float minScore)
+{
+    PreparedInput prepared = prepareInput(imagePath);
+    return predictPrepared(session, prepared, minScore);
 }
 
 void sphereDetection(const sfmData::SfMData& sfmData, Ort::Session& session, fs::path outputPath, const float minScore)
@@ -176,6 +207,8 @@ void sphereDetection(const sfmData::SfMData& sfmData, Ort::Session& session, fs:
     // Main tree
     bpt::ptree fileTree;
 
+    // Collect the images to process, in view order
+    std::vector<std::pair<std::string, fs::path>> entries;
     for (auto& viewID : sfmData.getViews())
     {
         ALICEVISION_LOG_DEBUG("View Id: " << viewID);
@@ -186,37 +219,77 @@ void sphereDetection(const sfmData::SfMData& sfmData, Ort::Session& session, fs:
         if (boost::algorithm::icontains(imagePath.stem().string(), "ambiant"))
             continue;
 
-        const auto pred = predict(session, imagePath, minScore);
+        entries.emplace_back(sphereName, imagePath);
+    }
+
+    // Decode and convert the images by groups, each group prefetched asynchronously
+    // while the previous one runs through the network, so that image loading never
+    // stalls the inference
+    const std::size_t groupSize = std::max(1, omp_get_max_threads());
 
-        // If there is no bounding box, then no sphere has been detected
-        if (pred.bboxes.size() > 0)
+    const auto prepareGroup = [&entries, groupSize](std::size_t first) {
+        const std::size_t count = std::min(groupSize, entries.size() - first);
+        std::vector<PreparedInput> group(count);
+#pragma omp parallel for
+        for (int64_t i = 0; i < static_cast<int64_t>(count); ++i)
         {
-            bpt::ptree spheresNode;
-
-            // We only take the best sphere in the picture
-            const int i = 0;
-            // Compute sphere coords from bbox coords
-            const auto bbox = pred.bboxes.at(i);
-            const float r = std::min(bbox.at(3) - bbox.at(1), bbox.at(2) - bbox.at(0)) / 2;
-            const float x = bbox.at(0) + r - pred.size.width / 2;
-            const float y = bbox.at(1) + r - pred.size.height / 2;
-
-            // Create an unnamed node containing the sphere
-            bpt::ptree sphereNode;
-            sphereNode.put("x", x);
-            sphereNode.put("y", y);
-            sphereNode.put("r", r);
-            sphereNode.put("score", pred.scores.at(i));
-            sphereNode.put("type", "matte");
-
-            // Add sphere to array
-            spheresNode.push_back(std::make_pair("", sphereNode));
-
-            fileTree.add_child(sphereName, spheresNode);
+            group[i] = prepareInput(entries[first + i].second);
         }
-        else
+        return group;
+    };
+
+    std::future<std::vector<PreparedInput>> pendingGroup;
+    if (!entries.empty())
+    {
+        pendingGroup = std::async(std::launch::async, prepareGroup, 0);
+    }
+
+    for (std::size_t first = 0; first < entries.size(); first += groupSize)
+    {
+        std::vector<PreparedInput> group = pendingGroup.get();
+
+        if (first + group.size() < entries.size())
+        {
+            pendingGroup = std::async(std::launch::async, prepareGroup, first + group.size());
+        }
+
+        for (std::size_t item = 0; item < group.size(); ++item)
         {
-            ALICEVISION_LOG_WARNING("No sphere detected for '" << imagePath << "'.");
+            const std::string& sphereName = entries[first + item].first;
+            const fs::path& imagePath = entries[first + item].second;
+
+            const auto pred = predictPrepared(session, group[item], minScore);
+
+            // If there is no bounding box, then no sphere has been detected
+            if (pred.bboxes.size() > 0)
+            {
+                bpt::ptree spheresNode;
+
+                // We only take the best sphere in the picture
+                const int i = 0;
+                // Compute sphere coords from bbox coords
+                const auto bbox = pred.bboxes.at(i);
+                const float r = std::min(bbox.at(3) - bbox.at(1), bbox.at(2) - bbox.at(0)) / 2;
+                const float x = bbox.at(0) + r - pred.size.width / 2;
+                const float y = bbox.at(1) + r - pred.size.height / 2;
+
+                // Create an unnamed node containing the sphere
+                bpt::ptree sphereNode;
+                sphereNode.put("x", x);
+                sphereNode.put("y", y);
+                sphereNode.put("r", r);
+                sphereNode.put("score", pred.scores.at(i));
+                sphereNode.put("type", "matte");
+
+                // Add sphere to array
+                spheresNode.push_back(std::make_pair("", sphereNode));
+
+                fileTree.add_child(sphereName, spheresNode);
+            }
+            else
+            {
+                ALICEVISION_LOG_WARNING("No sphere detected for '" << imagePath << "'.");
+            }
         }
     }
     bpt::write_json(outputPath.append("detection.json").string(), fileTree);
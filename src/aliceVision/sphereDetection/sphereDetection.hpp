@@ -38,7 +38,10 @@ struct Prediction
 void modelExplore(Ort::Session& session);
 
 /**
- * @brief Detect a sphere using ONNXRuntime to make a prediction
+ * @brief Detect a sphere in every view using ONNXRuntime to make predictions
+ *
+ * Images are decoded and converted to input tensors by groups, each group being
+ * prefetched asynchronously while the previous one runs through the network.
  *
  * @param sfmData The input SfMData file
  * @param session The ONNXRuntime session
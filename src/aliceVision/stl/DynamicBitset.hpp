@@ -78,6 +78,8 @@ struct dynamic_bitset
 
     const BlockType* data() const { return &vec_bits[0]; }
 
+    BlockType* data() { return &vec_bits[0]; }
+
   private:
     inline size_t calc_num_blocks(size_t num_bits) { return num_bits / bits_per_block + static_cast<size_t>(num_bits % bits_per_block != 0); }
 
@@ -87,6 +87,8 @@ std::istream& operator>>(std::istream& in, EVerboseLevel& verboseLevel)
 
 std::shared_ptr<Logger> Logger::_instance = nullptr;
 
+std::atomic<int> Logger::_filterLevel{static_cast<int>(Logger::getDefaultVerboseLevel())};
+
 Logger::Logger()
 {
     namespace expr = boost::log::expressions;
@@ -146,6 +148,10 @@ EVerboseLevel Logger::getDefaultVerboseLevel() { return EVerboseLevel::Info; }
 
 void Logger::setLogLevel(const EVerboseLevel level)
 {
+    // keep the lock-free mirror used by the macros fast path in sync,
+    // the default case below overrides it when the level is not recognized
+    _filterLevel.store(static_cast<int>(level), std::memory_order_relaxed);
+
     switch (level)
     {
         case EVerboseLevel::Fatal:
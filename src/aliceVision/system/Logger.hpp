@@ -11,6 +11,7 @@
 
 #include <boost/log/trivial.hpp>
 
+#include <atomic>
 #include <memory>
 #include <iostream>
 
@@ -26,14 +27,56 @@
 #define ALICEVISION_LOG_WARNING_OBJ BOOST_LOG_TRIVIAL(warning)
 #define ALICEVISION_LOG_ERROR_OBJ BOOST_LOG_TRIVIAL(error)
 #define ALICEVISION_LOG_FATAL_OBJ BOOST_LOG_TRIVIAL(fatal)
-#define ALICEVISION_LOG(MODE, a) MODE << a
 
-#define ALICEVISION_LOG_TRACE(a) ALICEVISION_LOG(ALICEVISION_LOG_TRACE_OBJ, a)
-#define ALICEVISION_LOG_DEBUG(a) ALICEVISION_LOG(ALICEVISION_LOG_DEBUG_OBJ, a)
-#define ALICEVISION_LOG_INFO(a) ALICEVISION_LOG(ALICEVISION_LOG_INFO_OBJ, a)
-#define ALICEVISION_LOG_WARNING(a) ALICEVISION_LOG(ALICEVISION_LOG_WARNING_OBJ, a)
-#define ALICEVISION_LOG_ERROR(a) ALICEVISION_LOG(ALICEVISION_LOG_ERROR_OBJ, a)
-#define ALICEVISION_LOG_FATAL(a) ALICEVISION_LOG(ALICEVISION_LOG_FATAL_OBJ, a)
+// numeric log levels for the compile-time filter, matching the order of system::EVerboseLevel
+#define ALICEVISION_LOG_LEVEL_FATAL 0
+#define ALICEVISION_LOG_LEVEL_ERROR 1
+#define ALICEVISION_LOG_LEVEL_WARNING 2
+#define ALICEVISION_LOG_LEVEL_INFO 3
+#define ALICEVISION_LOG_LEVEL_DEBUG 4
+#define ALICEVISION_LOG_LEVEL_TRACE 5
+
+// Log statements above ALICEVISION_LOG_MAX_LEVEL are compiled out entirely: their arguments
+// are never evaluated, so trace statements can stay in hot loops at no cost.
+// By default trace is removed from release builds; define ALICEVISION_LOG_MAX_LEVEL to override.
+#ifndef ALICEVISION_LOG_MAX_LEVEL
+    #ifdef NDEBUG
+        #define ALICEVISION_LOG_MAX_LEVEL ALICEVISION_LOG_LEVEL_DEBUG
+    #else
+        #define ALICEVISION_LOG_MAX_LEVEL ALICEVISION_LOG_LEVEL_TRACE
+    #endif
+#endif
+
+// The runtime level is checked first on a lock-free fast path: when the statement is filtered
+// out, neither its arguments nor the boost::log record machinery are evaluated.
+#define ALICEVISION_LOG(MODE, LEVEL, a)                                                                                                              \
+    do                                                                                                                                               \
+    {                                                                                                                                                \
+        if (aliceVision::system::Logger::mayLog(aliceVision::system::EVerboseLevel(LEVEL)))                                                          \
+        {                                                                                                                                            \
+            MODE << a;                                                                                                                               \
+        }                                                                                                                                            \
+    } while (false)
+
+#define ALICEVISION_LOG_NOOP                                                                                                                         \
+    do                                                                                                                                               \
+    {                                                                                                                                                \
+    } while (false)
+
+#if ALICEVISION_LOG_MAX_LEVEL >= ALICEVISION_LOG_LEVEL_TRACE
+    #define ALICEVISION_LOG_TRACE(a) ALICEVISION_LOG(ALICEVISION_LOG_TRACE_OBJ, ALICEVISION_LOG_LEVEL_TRACE, a)
+#else
+    #define ALICEVISION_LOG_TRACE(a) ALICEVISION_LOG_NOOP
+#endif
+#if ALICEVISION_LOG_MAX_LEVEL >= ALICEVISION_LOG_LEVEL_DEBUG
+    #define ALICEVISION_LOG_DEBUG(a) ALICEVISION_LOG(ALICEVISION_LOG_DEBUG_OBJ, ALICEVISION_LOG_LEVEL_DEBUG, a)
+#else
+    #define ALICEVISION_LOG_DEBUG(a) ALICEVISION_LOG_NOOP
+#endif
+#define ALICEVISION_LOG_INFO(a) ALICEVISION_LOG(ALICEVISION_LOG_INFO_OBJ, ALICEVISION_LOG_LEVEL_INFO, a)
+#define ALICEVISION_LOG_WARNING(a) ALICEVISION_LOG(ALICEVISION_LOG_WARNING_OBJ, ALICEVISION_LOG_LEVEL_WARNING, a)
+#define ALICEVISION_LOG_ERROR(a) ALICEVISION_LOG(ALICEVISION_LOG_ERROR_OBJ, ALICEVISION_LOG_LEVEL_ERROR, a)
+#define ALICEVISION_LOG_FATAL(a) ALICEVISION_LOG(ALICEVISION_LOG_FATAL_OBJ, ALICEVISION_LOG_LEVEL_FATAL, a)
 
 #define ALICEVISION_THROW(EXCEPTION, x)                                                                                                              \
     {                                                                                                                                                \
@@ -101,6 +144,17 @@ class Logger
      */
     void setLogLevel(const std::string& level);
 
+    /**
+     * @brief check whether a statement of the given level passes the current runtime filter
+     *
+     * This is the fast path used by the logging macros: a single relaxed atomic load,
+     * without allocating a log record or formatting any argument.
+     *
+     * @param level verbose level of the statement
+     * @return true if the statement should be emitted
+     */
+    static bool mayLog(EVerboseLevel level) { return static_cast<int>(level) <= _filterLevel.load(std::memory_order_relaxed); }
+
   private:
     /**
      * @brief Logger private constructor
@@ -114,6 +168,9 @@ class Logger
     void setLogLevel(const boost::log::trivial::severity_level level);
 
     static std::shared_ptr<Logger> _instance;
+
+    /// mirror of the current runtime level, read lock-free by mayLog()
+    static std::atomic<int> _filterLevel;
 };
 
 }  // namespace system
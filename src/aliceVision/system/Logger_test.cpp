@@ -31,3 +31,25 @@ BOOST_AUTO_TEST_CASE(Logger_Enums)
 
     BOOST_CHECK_THROW(EVerboseLevel_stringToEnum("not a level"), std::out_of_range);
 }
+
+BOOST_AUTO_TEST_CASE(Logger_LazyArgumentEvaluation)
+{
+    using namespace aliceVision::system;
+    Logger::get()->setLogLevel(EVerboseLevel::Warning);
+
+    int evaluations = 0;
+    const auto expensiveArgument = [&]() {
+        ++evaluations;
+        return std::string("expensive");
+    };
+
+    // statements below the runtime level must not evaluate their arguments
+    ALICEVISION_LOG_DEBUG("debug: " << expensiveArgument());
+    ALICEVISION_LOG_TRACE("trace: " << expensiveArgument());
+    BOOST_CHECK_EQUAL(evaluations, 0);
+
+    ALICEVISION_LOG_WARNING("warning: " << expensiveArgument());
+    BOOST_CHECK_EQUAL(evaluations, 1);
+
+    Logger::get()->setLogLevel(Logger::getDefaultVerboseLevel());
+}
@@ -0,0 +1,56 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "MemoryGovernor.hpp"
+
+namespace aliceVision {
+namespace system {
+
+MemoryGovernor::MemoryGovernor(std::size_t reservedBytes, double samplingPeriodMs)
+  : _reservedBytes(reservedBytes),
+    _samplingPeriodMs(samplingPeriodMs)
+{
+    _lastSample = getMemoryInfo();
+    _lastSampleTime = std::chrono::steady_clock::now();
+}
+
+void MemoryGovernor::sample()
+{
+    const auto now = std::chrono::steady_clock::now();
+    const double elapsedMs = std::chrono::duration<double, std::milli>(now - _lastSampleTime).count();
+
+    if (elapsedMs < _samplingPeriodMs)
+        return;
+
+    _lastSample = getMemoryInfo();
+    _lastSampleTime = now;
+}
+
+std::size_t MemoryGovernor::availableBytes()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    sample();
+
+    if (_lastSample.availableRam <= _reservedBytes)
+        return 0;
+
+    return _lastSample.availableRam - _reservedBytes;
+}
+
+bool MemoryGovernor::underPressure()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    sample();
+
+    // when the memory information is not accessible, assume no pressure
+    if (_lastSample.totalRam == 0)
+        return false;
+
+    return _lastSample.availableRam < std::size_t(_pressureRatio * _lastSample.totalRam);
+}
+
+}  // namespace system
+}  // namespace aliceVision
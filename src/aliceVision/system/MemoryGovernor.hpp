@@ -0,0 +1,57 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "MemoryInfo.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+
+namespace aliceVision {
+namespace system {
+
+/**
+ * @brief Rate-limited view of the memory available on the host, used by the job
+ * schedulers to adapt their admission while they run instead of trusting the snapshot
+ * taken at startup. When other jobs fill up the node, the schedulers throttle and
+ * degrade gracefully instead of getting killed.
+ */
+class MemoryGovernor
+{
+  public:
+    /**
+     * @param[in] reservedBytes memory already accounted for by the caller's own running jobs,
+     * subtracted from the sampled available memory
+     * @param[in] samplingPeriodMs minimum delay between two system memory samplings
+     */
+    explicit MemoryGovernor(std::size_t reservedBytes = 0, double samplingPeriodMs = 1000.0);
+
+    /// the memory currently available for new jobs, sampled at most every samplingPeriodMs
+    std::size_t availableBytes();
+
+    /// true when the host is critically short on memory and no new job should be admitted
+    bool underPressure();
+
+    void setReservedBytes(std::size_t reservedBytes) { _reservedBytes = reservedBytes; }
+
+  private:
+    /// refresh the cached memory information when the sampling period has elapsed
+    void sample();
+
+    std::size_t _reservedBytes;
+    double _samplingPeriodMs;
+    /// fraction of the total RAM under which the host is considered under memory pressure
+    double _pressureRatio = 0.05;
+
+    MemoryInfo _lastSample;
+    std::chrono::steady_clock::time_point _lastSampleTime;
+    std::mutex _mutex;
+};
+
+}  // namespace system
+}  // namespace aliceVision
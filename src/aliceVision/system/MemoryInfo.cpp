@@ -13,6 +13,7 @@
 
 #if defined(__WINDOWS__)
     #include <windows.h>
+    #include <psapi.h>
 #elif defined(__LINUX__)
     #include <sys/sysinfo.h>
     #include <fstream>
@@ -20,6 +21,7 @@
 #elif defined(__APPLE__)
     #include <sys/types.h>
     #include <sys/sysctl.h>
+    #include <mach/mach.h>
     #include <mach/vm_statistics.h>
     #include <mach/mach_types.h>
     #include <mach/mach_init.h>
@@ -133,6 +135,48 @@ MemoryInfo getMemoryInfo()
     return infos;
 }
 
+ProcessMemoryUsage getProcessMemoryUsage()
+{
+    ProcessMemoryUsage usage;
+
+#if defined(__WINDOWS__)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        usage.residentMemory = counters.WorkingSetSize;
+        usage.peakResidentMemory = counters.PeakWorkingSetSize;
+    }
+#elif defined(__LINUX__)
+    std::string token;
+    std::ifstream file("/proc/self/status");
+    while (file >> token)
+    {
+        unsigned long mem;
+        if (token == "VmRSS:" && file >> mem)
+        {
+            // read in kB and convert to bytes
+            usage.residentMemory = mem * 1024;
+        }
+        else if (token == "VmHWM:" && file >> mem)
+        {
+            usage.peakResidentMemory = mem * 1024;
+        }
+        // ignore rest of the line
+        file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+#elif defined(__APPLE__)
+    struct mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count) == KERN_SUCCESS)
+    {
+        usage.residentMemory = info.resident_size;
+        usage.peakResidentMemory = info.resident_size_max;
+    }
+#endif
+
+    return usage;
+}
+
 std::ostream& operator<<(std::ostream& os, const MemoryInfo& infos)
 {
     const double convertionGb = std::pow(2, 30);
@@ -25,6 +25,19 @@ struct MemoryInfo
 
 MemoryInfo getMemoryInfo();
 
+/**
+ * @brief Memory usage of the calling process.
+ */
+struct ProcessMemoryUsage
+{
+    /// current resident set size in bytes
+    std::size_t residentMemory{0};
+    /// peak resident set size in bytes since the process started
+    std::size_t peakResidentMemory{0};
+};
+
+ProcessMemoryUsage getProcessMemoryUsage();
+
 std::ostream& operator<<(std::ostream& os, const MemoryInfo& infos);
 
 }  // namespace system
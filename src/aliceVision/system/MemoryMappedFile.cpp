@@ -0,0 +1,118 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "MemoryMappedFile.hpp"
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace aliceVision {
+namespace system {
+
+MemoryMappedFile::~MemoryMappedFile() { close(); }
+
+#ifdef _WIN32
+
+bool MemoryMappedFile::open(const std::string& path)
+{
+    close();
+
+    HANDLE fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+    {
+        CloseHandle(fileHandle);
+        return false;
+    }
+
+    HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mappingHandle == nullptr)
+    {
+        CloseHandle(fileHandle);
+        return false;
+    }
+
+    const void* view = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr)
+    {
+        CloseHandle(mappingHandle);
+        CloseHandle(fileHandle);
+        return false;
+    }
+
+    _data = static_cast<const unsigned char*>(view);
+    _size = static_cast<std::size_t>(fileSize.QuadPart);
+    _fileHandle = fileHandle;
+    _mappingHandle = mappingHandle;
+    return true;
+}
+
+void MemoryMappedFile::close()
+{
+    if (_data != nullptr)
+        UnmapViewOfFile(_data);
+    if (_mappingHandle != nullptr)
+        CloseHandle(_mappingHandle);
+    if (_fileHandle != nullptr)
+        CloseHandle(_fileHandle);
+    _data = nullptr;
+    _size = 0;
+    _fileHandle = nullptr;
+    _mappingHandle = nullptr;
+}
+
+#else
+
+bool MemoryMappedFile::open(const std::string& path)
+{
+    close();
+
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    void* view = mmap(nullptr, static_cast<std::size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping keeps its own reference on the file
+    ::close(fd);
+    if (view == MAP_FAILED)
+        return false;
+
+    // the file will be read once from start to end
+    madvise(view, static_cast<std::size_t>(fileStat.st_size), MADV_SEQUENTIAL);
+
+    _data = static_cast<const unsigned char*>(view);
+    _size = static_cast<std::size_t>(fileStat.st_size);
+    return true;
+}
+
+void MemoryMappedFile::close()
+{
+    if (_data != nullptr)
+        munmap(const_cast<unsigned char*>(_data), _size);
+    _data = nullptr;
+    _size = 0;
+}
+
+#endif
+
+}  // namespace system
+}  // namespace aliceVision
@@ -0,0 +1,61 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace aliceVision {
+namespace system {
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * The file content is exposed as a plain byte range backed by the OS page cache,
+ * so large binary files (e.g. descriptor files) can be consumed without stream I/O.
+ * The mapping is released when the object is destroyed or close() is called.
+ */
+class MemoryMappedFile
+{
+  public:
+    MemoryMappedFile() = default;
+    ~MemoryMappedFile();
+
+    // Non-copyable: the mapping is an OS resource with a single owner.
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+    /**
+     * @brief Map the given file read-only.
+     * @param[in] path path of the file to map
+     * @return true on success, false if the file cannot be opened or mapped
+     */
+    bool open(const std::string& path);
+
+    /// Release the mapping, if any.
+    void close();
+
+    /// @return pointer on the first byte of the mapped file, nullptr when not open
+    const unsigned char* data() const { return _data; }
+
+    /// @return size of the mapped file in bytes
+    std::size_t size() const { return _size; }
+
+    /// @return true if a file is currently mapped
+    bool isOpen() const { return _data != nullptr; }
+
+  private:
+    const unsigned char* _data = nullptr;
+    std::size_t _size = 0;
+#ifdef _WIN32
+    void* _fileHandle = nullptr;
+    void* _mappingHandle = nullptr;
+#endif
+};
+
+}  // namespace system
+}  // namespace aliceVision
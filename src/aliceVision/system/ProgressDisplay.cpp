@@ -5,8 +5,12 @@
 // You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include "ProgressDisplay.hpp"
+#include "Logger.hpp"
+#include "Timer.hpp"
 #include <boost/timer/progress_display.hpp>
+#include <iomanip>
 #include <mutex>
+#include <sstream>
 
 namespace aliceVision {
 namespace system {
@@ -60,6 +64,92 @@ class ProgressDisplayImplBoostProgress : public ProgressDisplayImpl
     boost::timer::progress_display _display;
 };
 
+class ProgressDisplayImplRateLog : public ProgressDisplayImpl
+{
+  public:
+    ProgressDisplayImplRateLog(unsigned long expectedCount, const std::string& name, double reportPeriodSeconds)
+      : _name(name),
+        _reportPeriodSeconds(reportPeriodSeconds),
+        _expectedCount(expectedCount)
+    {}
+
+    ~ProgressDisplayImplRateLog() override = default;
+
+    void restart(unsigned long expectedCount) override
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _expectedCount = expectedCount;
+        _count = 0;
+        _bytes = 0;
+        _timer.reset();
+        _lastReportElapsed = 0.0;
+    }
+
+    void increment(unsigned long count) override
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _count += count;
+        report();
+    }
+
+    void incrementBytes(unsigned long long bytes) override
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _bytes += bytes;
+    }
+
+    unsigned long count() override
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        return _count;
+    }
+
+    unsigned long expectedCount() override
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        return _expectedCount;
+    }
+
+  private:
+    /// log a report when the period has elapsed or the expected count is reached, _mutex must be held
+    void report()
+    {
+        const double elapsed = _timer.elapsed();
+        const bool finished = (_expectedCount > 0) && (_count >= _expectedCount);
+
+        if (!finished && (elapsed - _lastReportElapsed) < _reportPeriodSeconds)
+            return;
+        _lastReportElapsed = elapsed;
+
+        if (elapsed <= 0.0)
+            return;
+
+        const double itemsPerSecond = double(_count) / elapsed;
+
+        std::ostringstream os;
+        os << _name << ": " << _count;
+        if (_expectedCount > 0)
+            os << "/" << _expectedCount << " (" << int(100.0 * double(_count) / double(_expectedCount)) << "%)";
+        os << " - " << std::fixed << std::setprecision(2) << itemsPerSecond << " items/s";
+        if (_bytes > 0)
+            os << " - " << std::setprecision(1) << (double(_bytes) / elapsed) / (1024.0 * 1024.0) << " MB/s";
+        if (!finished && itemsPerSecond > 0.0 && _expectedCount > _count)
+            os << " - ETA " << prettyTime(1000.0 * double(_expectedCount - _count) / itemsPerSecond);
+
+        ALICEVISION_LOG_INFO(os.str());
+    }
+
+    std::mutex _mutex;
+    std::string _name;
+    double _reportPeriodSeconds;
+    unsigned long _expectedCount;
+    unsigned long _count = 0;
+    unsigned long long _bytes = 0;
+    /// elapsed time at the last report, in seconds since restart
+    double _lastReportElapsed = 0.0;
+    Timer _timer;
+};
+
 ProgressDisplay createConsoleProgressDisplay(unsigned long expectedCount,
                                              std::ostream& os,
                                              const std::string& s1,
@@ -70,5 +160,11 @@ ProgressDisplay createConsoleProgressDisplay(unsigned long expectedCount,
     return ProgressDisplay(impl);
 }
 
+ProgressDisplay createRateProgressDisplay(unsigned long expectedCount, const std::string& name, double reportPeriodSeconds)
+{
+    auto impl = std::make_shared<ProgressDisplayImplRateLog>(expectedCount, name, reportPeriodSeconds);
+    return ProgressDisplay(impl);
+}
+
 }  // namespace system
 }  // namespace aliceVision
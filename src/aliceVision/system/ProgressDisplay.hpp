@@ -19,6 +19,8 @@ class ProgressDisplayImpl
     virtual ~ProgressDisplayImpl();
     virtual void restart(unsigned long expectedCount) = 0;
     virtual void increment(unsigned long count) = 0;
+    /// account processed bytes, ignored by implementations that do not report throughput
+    virtual void incrementBytes(unsigned long long bytes) {}
     virtual unsigned long count() = 0;
     virtual unsigned long expectedCount() = 0;
 };
@@ -47,6 +49,10 @@ class ProgressDisplay
     // Thread safe with respect to other calls to operator++ and to calls to count()
     void operator+=(unsigned long increment) { _impl->increment(increment); }
 
+    // Thread safe. Accounts the given amount of processed bytes, so that implementations
+    // reporting throughput can additionally display bytes/s.
+    void incrementBytes(unsigned long long bytes) { _impl->incrementBytes(bytes); }
+
     // Thread safe with respect to calls to operator++
     unsigned long count() { return _impl->count(); }
 
@@ -64,5 +70,18 @@ ProgressDisplay createConsoleProgressDisplay(unsigned long expectedCount,
                                              const std::string& s2 = "",
                                              const std::string& s3 = "");
 
+/**
+ * Creates a log-based progress display that periodically reports the processing rate
+ * (items/s and, when bytes are accounted through incrementBytes(), MB/s) and the estimated
+ * time of completion. Unlike the console progress bar it goes through the logger, so
+ * stalled or abnormally slow stages (e.g. a degraded network filesystem) can be spotted
+ * from the logs of an unattended run within minutes.
+ *
+ * @param[in] expectedCount the total number of items to process
+ * @param[in] name name of the processed stage, used to prefix the reports
+ * @param[in] reportPeriodSeconds minimum delay between two reports
+ */
+ProgressDisplay createRateProgressDisplay(unsigned long expectedCount, const std::string& name, double reportPeriodSeconds = 10.0);
+
 }  // namespace system
 }  // namespace aliceVision
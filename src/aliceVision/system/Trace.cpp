@@ -0,0 +1,118 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Trace.hpp"
+
+#include <fstream>
+#include <iostream>
+
+namespace aliceVision {
+namespace system {
+
+namespace {
+
+/// escape the characters that would break the JSON string literal
+std::string escapeJson(const std::string& in)
+{
+    std::string out;
+    out.reserve(in.size());
+    for (const char c : in)
+    {
+        if (c == '"' || c == '\\')
+            out.push_back('\\');
+        if (static_cast<unsigned char>(c) < 0x20)
+            continue;
+        out.push_back(c);
+    }
+    return out;
+}
+
+}  // namespace
+
+TraceSession& TraceSession::get()
+{
+    static TraceSession session;
+    return session;
+}
+
+void TraceSession::setOutputFilepath(const std::string& filepath)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _outputFilepath = filepath;
+    _sessionStart = std::chrono::steady_clock::now();
+    _enabled = !filepath.empty();
+}
+
+std::int64_t TraceSession::nowUs() const
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _sessionStart).count();
+}
+
+void TraceSession::record(const std::string& name, const std::string& category, std::int64_t startUs, std::int64_t durationUs)
+{
+    if (!_enabled)
+        return;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto threadIndexIt = _threadIndices.emplace(std::this_thread::get_id(), _threadIndices.size()).first;
+    _events.push_back({name, category, startUs, durationUs, threadIndexIt->second});
+}
+
+void TraceSession::save()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_enabled || _events.empty())
+        return;
+
+    // save() also runs at static destruction time, so report through iostream instead of the logger
+    std::ofstream fileOut(_outputFilepath);
+    if (!fileOut)
+    {
+        std::cerr << "Unable to write the trace file '" << _outputFilepath << "'." << std::endl;
+        return;
+    }
+
+    // chrome trace event format: one complete ("ph":"X") event per span
+    fileOut << "{\"traceEvents\":[\n";
+    for (std::size_t i = 0; i < _events.size(); ++i)
+    {
+        const TraceEvent& event = _events[i];
+        fileOut << "{\"name\":\"" << escapeJson(event.name) << "\",\"cat\":\"" << escapeJson(event.category) << "\",\"ph\":\"X\",\"ts\":"
+                << event.startUs << ",\"dur\":" << event.durationUs << ",\"pid\":0,\"tid\":" << event.threadIndex << "}"
+                << ((i + 1 < _events.size()) ? ",\n" : "\n");
+    }
+    fileOut << "]}\n";
+
+    std::cout << "Trace with " << _events.size() << " span(s) written to '" << _outputFilepath << "'." << std::endl;
+
+    // do not export the same spans again from the destructor
+    _events.clear();
+}
+
+TraceSession::~TraceSession() { save(); }
+
+TraceSpan::TraceSpan(const std::string& name, const std::string& category)
+{
+    TraceSession& session = TraceSession::get();
+    if (!session.isEnabled())
+        return;
+
+    _name = name;
+    _category = category;
+    _startUs = session.nowUs();
+}
+
+TraceSpan::~TraceSpan()
+{
+    if (_startUs < 0)
+        return;
+
+    TraceSession& session = TraceSession::get();
+    session.record(_name, _category, _startUs, session.nowUs() - _startUs);
+}
+
+}  // namespace system
+}  // namespace aliceVision
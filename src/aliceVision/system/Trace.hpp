@@ -0,0 +1,102 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace aliceVision {
+namespace system {
+
+/**
+ * @brief Collect named spans of wall time and export them in the chrome trace event
+ * format, so that the CPU / GPU / I/O phases of a whole pipeline run can be inspected
+ * on a single timeline in chrome://tracing or Perfetto.
+ *
+ * The session is disabled, and the spans only cost a branch, until an output file is
+ * set, which the common command line does with --traceFile. The collected spans are
+ * written when the process exits.
+ */
+class TraceSession
+{
+  public:
+    static TraceSession& get();
+
+    /// enable the session and set the path of the exported JSON trace
+    void setOutputFilepath(const std::string& filepath);
+
+    bool isEnabled() const { return _enabled; }
+
+    /// time in microseconds since the session start, to timestamp the spans
+    std::int64_t nowUs() const;
+
+    /**
+     * @brief Record a complete span.
+     * @param[in] name The name displayed on the timeline.
+     * @param[in] category The category grouping the spans, e.g. "cpu", "gpu" or "io".
+     * @param[in] startUs The span start, in microseconds since the session start.
+     * @param[in] durationUs The span duration in microseconds.
+     */
+    void record(const std::string& name, const std::string& category, std::int64_t startUs, std::int64_t durationUs);
+
+    /// write the collected spans to the output file
+    void save();
+
+    ~TraceSession();
+
+    TraceSession(const TraceSession&) = delete;
+    TraceSession& operator=(const TraceSession&) = delete;
+
+  private:
+    TraceSession() = default;
+
+    struct TraceEvent
+    {
+        std::string name;
+        std::string category;
+        std::int64_t startUs;
+        std::int64_t durationUs;
+        std::size_t threadIndex;
+    };
+
+    bool _enabled = false;
+    std::string _outputFilepath;
+    std::chrono::steady_clock::time_point _sessionStart;
+    std::vector<TraceEvent> _events;
+    /// stable small ids for the encountered threads, used as "tid" in the trace
+    std::map<std::thread::id, std::size_t> _threadIndices;
+    mutable std::mutex _mutex;
+};
+
+/**
+ * @brief Scoped span: records in the trace session the wall time spent between
+ * construction and destruction, on the thread that created it.
+ */
+class TraceSpan
+{
+  public:
+    TraceSpan(const std::string& name, const std::string& category = "cpu");
+
+    ~TraceSpan();
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+  private:
+    std::string _name;
+    std::string _category;
+    /// span start in microseconds since the session start, -1 when the session is disabled
+    std::int64_t _startUs = -1;
+};
+
+}  // namespace system
+}  // namespace aliceVision
@@ -2,8 +2,17 @@
 
 #include "cpu.hpp"
 #include "MemoryInfo.hpp"
+#include "system.hpp"
 #include <aliceVision/alicevision_omp.hpp>
 
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#if defined(__LINUX__)
+    #include <sched.h>
+#endif
+
 namespace aliceVision {
 
 void HardwareContext::displayHardware()
@@ -19,6 +28,17 @@ void HardwareContext::displayHardware()
 
     std::cout << "\tOpenMP will use " << omp_get_max_threads() << " cores" << std::endl;
 
+    const auto numaTopology = getNumaTopology();
+    if (numaTopology.size() > 1)
+    {
+        std::cout << "\tDetected NUMA node count : " << numaTopology.size() << std::endl;
+
+        if (_userNumaNode >= 0)
+        {
+            std::cout << "\tProcess bound to NUMA node : " << _userNumaNode << std::endl;
+        }
+    }
+
     auto meminfo = system::getMemoryInfo();
 
     std::cout << "\tDetected available memory : " << meminfo.availableRam / (1024 * 1024) << " Mo" << std::endl;
@@ -48,6 +68,16 @@ unsigned int HardwareContext::getMaxThreads() const
         count = _limitUserCores;
     }
 
+    // When bound to a NUMA node, do not create more threads than the node has cpus
+    if (_userNumaNode >= 0)
+    {
+        const auto topology = getNumaTopology();
+        if (_userNumaNode < static_cast<int>(topology.size()))
+        {
+            count = std::min(count, static_cast<unsigned int>(topology[_userNumaNode].size()));
+        }
+    }
+
     return count;
 }
 
@@ -61,4 +91,97 @@ size_t HardwareContext::getMaxMemory() const
     return ret;
 }
 
+std::vector<std::vector<unsigned int>> HardwareContext::getNumaTopology()
+{
+    std::vector<std::vector<unsigned int>> nodes;
+
+#if defined(__LINUX__)
+    // the kernel exposes the topology as one cpu list per node
+    for (unsigned int nodeId = 0;; ++nodeId)
+    {
+        std::ifstream cpuListFile("/sys/devices/system/node/node" + std::to_string(nodeId) + "/cpulist");
+        if (!cpuListFile)
+        {
+            break;
+        }
+
+        std::string cpuList;
+        std::getline(cpuListFile, cpuList);
+
+        // the list is a comma separated set of single ids or "first-last" ranges
+        std::vector<unsigned int> cpus;
+        std::stringstream ss(cpuList);
+        std::string token;
+        while (std::getline(ss, token, ','))
+        {
+            const std::size_t dash = token.find('-');
+            const unsigned int first = static_cast<unsigned int>(std::stoul(token.substr(0, dash)));
+            const unsigned int last = (dash == std::string::npos) ? first : static_cast<unsigned int>(std::stoul(token.substr(dash + 1)));
+            for (unsigned int cpu = first; cpu <= last; ++cpu)
+            {
+                cpus.push_back(cpu);
+            }
+        }
+
+        // memory-only nodes have an empty cpu list
+        if (!cpus.empty())
+        {
+            nodes.push_back(cpus);
+        }
+    }
+#endif
+
+    if (nodes.empty())
+    {
+        // no NUMA information available, expose a single node holding all the cpus
+        std::vector<unsigned int> cpus(system::get_total_cpus());
+        for (unsigned int cpu = 0; cpu < cpus.size(); ++cpu)
+        {
+            cpus[cpu] = cpu;
+        }
+        nodes.push_back(cpus);
+    }
+
+    return nodes;
+}
+
+bool HardwareContext::bindToUserNumaNode()
+{
+    if (_userNumaNode < 0)
+    {
+        return false;
+    }
+
+    const auto topology = getNumaTopology();
+    if (_userNumaNode >= static_cast<int>(topology.size()))
+    {
+        ALICEVISION_LOG_WARNING("Requested NUMA node " << _userNumaNode << " but only " << topology.size()
+                                                       << " node(s) detected, the binding is ignored.");
+        _userNumaNode = -1;
+        return false;
+    }
+
+#if defined(__LINUX__)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (const unsigned int cpu : topology[_userNumaNode])
+    {
+        CPU_SET(cpu, &cpuSet);
+    }
+
+    if (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0)
+    {
+        ALICEVISION_LOG_WARNING("Unable to bind the process to NUMA node " << _userNumaNode << ".");
+        _userNumaNode = -1;
+        return false;
+    }
+
+    return true;
+#else
+    ALICEVISION_LOG_WARNING("NUMA binding is only supported on Linux, the binding is ignored.");
+    _userNumaNode = -1;
+    return false;
+#endif
+}
+
 }  // namespace aliceVision
\ No newline at end of file
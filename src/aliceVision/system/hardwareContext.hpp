@@ -9,6 +9,8 @@
 #include "Logger.hpp"
 #include "Timer.hpp"
 
+#include <vector>
+
 namespace aliceVision {
 
 class HardwareContext
@@ -34,6 +36,26 @@ class HardwareContext
      */
     size_t getMaxMemory() const;
 
+    /**
+     * @brief Get the NUMA topology of the host as the list of logical cpu ids of each node
+     * On systems without NUMA information, a single node holding all the cpus is returned
+     * @return the list of cpu ids per NUMA node
+     */
+    static std::vector<std::vector<unsigned int>> getNumaTopology();
+
+    int getUserNumaNode() const { return _userNumaNode; }
+
+    void setUserNumaNode(int node) { _userNumaNode = node; }
+
+    /**
+     * @brief Bind the process to the cpus of the requested NUMA node (see setUserNumaNode)
+     * The OpenMP regions created afterwards inherit the affinity, and as pages are allocated
+     * on the node of the first touching thread, the memory-bound stages then work on
+     * node-local memory instead of paying cross-socket traffic
+     * @return true if the binding has been applied
+     */
+    bool bindToUserNumaNode();
+
   private:
     /**
      * @brief This is the maximum memory available
@@ -54,6 +76,13 @@ class HardwareContext
      * The value will only be used if less than the _maxUserCoresAvailable value
      */
     unsigned int _limitUserCores = std::numeric_limits<unsigned int>::max();
+
+    /**
+     * @brief The NUMA node the process should be bound to, -1 for no binding
+     * This information is passed to the application through command line parameters
+     * on multi-socket nodes where several jobs share the machine
+     */
+    int _userNumaNode = -1;
 };
 
 }  // namespace aliceVision
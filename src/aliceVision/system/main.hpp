@@ -14,6 +14,10 @@
  * To use this wrapper you need to change your source file containing \c main() as such:
  * 1. Include this header
  * 2. Rename \c main() to \c aliceVision_main()
+ *
+ * A translation unit may define \c ALICEVISION_NO_MAIN (together with a macro renaming
+ * \c aliceVision_main) before this header is included, to build several tool entry points
+ * into a single executable, as done by the aliceVision_worker stages.
  */
 
 #include "Logger.hpp"
@@ -25,6 +29,8 @@
  */
 int aliceVision_main(int argc, char* argv[]);
 
+#if !defined(ALICEVISION_NO_MAIN)
+
 /* Implementation of the unique main() entry point.
  * This method will call aliceVision_main() and, in case of any exception not
  * handled there, catch those and log the error message.
@@ -46,3 +52,5 @@ int main(int argc, char* argv[])
     }
     return EXIT_FAILURE;
 }
+
+#endif  // !defined(ALICEVISION_NO_MAIN)
@@ -7,111 +7,151 @@
 
 #include "TracksBuilder.hpp"
 
-#include <lemon/list_graph.h>
-#include <lemon/unionfind.h>
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
 
 namespace aliceVision {
 namespace track {
 
 using namespace aliceVision::matching;
-using namespace lemon;
 
-/// IndexedFeaturePair is: map<viewId, keypointId>
+/// IndexedFeaturePair is: pair<viewId, keypointId>
 using IndexedFeaturePair = std::pair<std::size_t, KeypointId>;
-using IndexMap = lemon::ListDigraph::NodeMap<std::size_t>;
-using UnionFindObject = lemon::UnionFindEnum<IndexMap>;
-
-using MapNodeToIndex = stl::flat_map<lemon::ListDigraph::Node, IndexedFeaturePair>;
-using MapIndexToNode = stl::flat_map<IndexedFeaturePair, lemon::ListDigraph::Node>;
 
 struct TracksBuilderData
 {
-    /// graph container to create the node
-    lemon::ListDigraph graph;
-    /// node to index map
-    MapNodeToIndex map_nodeToIndex;
-    std::unique_ptr<IndexMap> index;
-    std::unique_ptr<UnionFindObject> tracksUF;
+    /// all features referenced by the matches, sorted by (viewId, keypointId):
+    /// the position in this vector is the feature node id
+    std::vector<IndexedFeaturePair> features;
+    /// union-find parent per feature node, fully compressed after build()
+    std::vector<std::size_t> parent;
+    /// classes (roots) removed by filter()
+    std::vector<bool> erasedClasses;
+
+    /// @return the node id of the given feature
+    std::size_t getNodeIndex(const IndexedFeaturePair& featPair) const
+    {
+        return std::distance(features.begin(), std::lower_bound(features.begin(), features.end(), featPair));
+    }
+
+    /// find with path halving
+    std::size_t findRoot(std::size_t node)
+    {
+        while (parent[node] != node)
+        {
+            parent[node] = parent[parent[node]];
+            node = parent[node];
+        }
+        return node;
+    }
+
+    /// union by attaching the higher root to the lower one (deterministic)
+    void join(std::size_t nodeA, std::size_t nodeB)
+    {
+        const std::size_t rootA = findRoot(nodeA);
+        const std::size_t rootB = findRoot(nodeB);
+        if (rootA == rootB)
+            return;
+        if (rootA < rootB)
+            parent[rootB] = rootA;
+        else
+            parent[rootA] = rootB;
+    }
+
+    /// make every node point directly on its root, so parent[] can be read concurrently
+    void compress()
+    {
+        for (std::size_t node = 0; node < parent.size(); ++node)
+            parent[node] = findRoot(node);
+    }
+
+    /// @return the (root, node) list sorted by root, i.e. the nodes grouped by class;
+    ///         within a class the nodes keep the (viewId, keypointId) order
+    std::vector<std::pair<std::size_t, std::size_t>> getNodesPerClass(bool multithreaded) const
+    {
+        std::vector<std::pair<std::size_t, std::size_t>> nodesPerClass(parent.size());
 
-    const UnionFindObject& getUnionFindEnum() const { return *tracksUF; }
+#pragma omp parallel for if (multithreaded)
+        for (std::ptrdiff_t node = 0; node < static_cast<std::ptrdiff_t>(parent.size()); ++node)
+            nodesPerClass[node] = std::make_pair(parent[node], std::size_t(node));
 
-    const MapNodeToIndex& getReverseMap() const { return map_nodeToIndex; }
+        std::sort(nodesPerClass.begin(), nodesPerClass.end());
+        return nodesPerClass;
+    }
 };
 
 TracksBuilder::TracksBuilder() { _d.reset(new TracksBuilderData()); }
 
 TracksBuilder::~TracksBuilder() = default;
 
-void TracksBuilder::build(const PairwiseMatches& pairwiseMatches)
+void TracksBuilder::build(const PairwiseMatches& pairwiseMatches, bool multithreaded)
 {
-    typedef std::set<IndexedFeaturePair> SetIndexedPair;
+    // flatten the pair list so the feature collection can be distributed across threads
+    std::vector<const PairwiseMatches::value_type*> pairs;
+    pairs.reserve(pairwiseMatches.size());
+    for (const auto& matchesPerDescIt : pairwiseMatches)
+        pairs.push_back(&matchesPerDescIt);
 
-    // set of all features of all images: (imageIndex, featureIndex)
-    SetIndexedPair allFeatures;
+    // collect the set of all features of all images: (imageIndex, featureIndex)
+    std::vector<IndexedFeaturePair> allFeatures;
 
-    // for each couple of images make the union according the pair matches
-    for (const auto& matchesPerDescIt : pairwiseMatches)
+#pragma omp parallel if (multithreaded)
     {
-        const std::size_t& I = matchesPerDescIt.first.first;
-        const std::size_t& J = matchesPerDescIt.first.second;
-        const MatchesPerDescType& matchesPerDesc = matchesPerDescIt.second;
+        std::vector<IndexedFeaturePair> threadFeatures;
 
-        for (const auto& matchesIt : matchesPerDesc)
+#pragma omp for nowait
+        for (std::ptrdiff_t p = 0; p < static_cast<std::ptrdiff_t>(pairs.size()); ++p)
         {
-            const feature::EImageDescriberType descType = matchesIt.first;
-            const IndMatches& matches = matchesIt.second;
-            // we have correspondences between I and J image index.
-            for (const IndMatch& m : matches)
+            const std::size_t I = pairs[p]->first.first;
+            const std::size_t J = pairs[p]->first.second;
+
+            for (const auto& matchesIt : pairs[p]->second)
             {
-                IndexedFeaturePair pairI(I, KeypointId(descType, m._i));
-                IndexedFeaturePair pairJ(J, KeypointId(descType, m._j));
-                allFeatures.insert(pairI);
-                allFeatures.insert(pairJ);
+                const feature::EImageDescriberType descType = matchesIt.first;
+                for (const IndMatch& m : matchesIt.second)
+                {
+                    threadFeatures.emplace_back(I, KeypointId(descType, m._i));
+                    threadFeatures.emplace_back(J, KeypointId(descType, m._j));
+                }
             }
         }
-    }
 
-    // build the node indirection for each referenced feature
-    MapIndexToNode map_indexToNode;
-    map_indexToNode.reserve(allFeatures.size());
-    _d->map_nodeToIndex.reserve(allFeatures.size());
-
-    for (const IndexedFeaturePair& featPair : allFeatures)
-    {
-        lemon::ListDigraph::Node node = _d->graph.addNode();
-        map_indexToNode.insert(std::make_pair(featPair, node));
-        _d->map_nodeToIndex.insert(std::make_pair(node, featPair));
+#pragma omp critical
+        allFeatures.insert(allFeatures.end(), threadFeatures.begin(), threadFeatures.end());
     }
 
-    // add the element of myset to the UnionFind insert method.
-    _d->index.reset(new IndexMap(_d->graph));
-    _d->tracksUF.reset(new UnionFindObject(*_d->index));
+    std::sort(allFeatures.begin(), allFeatures.end());
+    allFeatures.erase(std::unique(allFeatures.begin(), allFeatures.end()), allFeatures.end());
+    allFeatures.shrink_to_fit();
 
-    for (ListDigraph::NodeIt it(_d->graph); it != INVALID; ++it)
-    {
-        _d->tracksUF->insert(it);
-    }
+    _d->features = std::move(allFeatures);
+    _d->parent.resize(_d->features.size());
+    std::iota(_d->parent.begin(), _d->parent.end(), std::size_t(0));
+    _d->erasedClasses.assign(_d->features.size(), false);
 
-    // make the union according the pair matches
+    // make the union according to the pair matches
     for (const auto& matchesPerDescIt : pairwiseMatches)
     {
-        const std::size_t& I = matchesPerDescIt.first.first;
-        const std::size_t& J = matchesPerDescIt.first.second;
-        const MatchesPerDescType& matchesPerDesc = matchesPerDescIt.second;
+        const std::size_t I = matchesPerDescIt.first.first;
+        const std::size_t J = matchesPerDescIt.first.second;
 
-        for (const auto& matchesIt : matchesPerDesc)
+        for (const auto& matchesIt : matchesPerDescIt.second)
         {
             const feature::EImageDescriberType descType = matchesIt.first;
-            const IndMatches& matches = matchesIt.second;
-            // we have correspondences between I and J image index.
-            for (const IndMatch& m : matches)
+            for (const IndMatch& m : matchesIt.second)
             {
-                IndexedFeaturePair pairI(I, KeypointId(descType, m._i));
-                IndexedFeaturePair pairJ(J, KeypointId(descType, m._j));
-                _d->tracksUF->join(map_indexToNode[pairI], map_indexToNode[pairJ]);
+                const IndexedFeaturePair pairI(I, KeypointId(descType, m._i));
+                const IndexedFeaturePair pairJ(J, KeypointId(descType, m._j));
+                _d->join(_d->getNodeIndex(pairI), _d->getNodeIndex(pairJ));
             }
         }
     }
+
+    // freeze the structure: parent[] becomes a direct node-to-class lookup
+    _d->compress();
 }
 
 void TracksBuilder::filter(bool clearForks, std::size_t minTrackLength, bool multithreaded)
@@ -122,49 +162,58 @@ void TracksBuilder::filter(bool clearForks, std::size_t minTrackLength, bool mul
     if (!clearForks && minTrackLength == 0)
         return;
 
-    std::set<int> set_classToErase;
+    const std::vector<std::pair<std::size_t, std::size_t>> nodesPerClass = _d->getNodesPerClass(multithreaded);
 
-#pragma omp parallel if (multithreaded)
-    for (lemon::UnionFindEnum<IndexMap>::ClassIt cit(*_d->tracksUF); cit != INVALID; ++cit)
+    for (std::size_t begin = 0; begin < nodesPerClass.size();)
     {
-#pragma omp single nowait
+        const std::size_t classId = nodesPerClass[begin].first;
+        std::size_t end = begin;
+        // nodes of a class are sorted by (viewId, keypointId), so view duplicates are adjacent
+        std::size_t nbViews = 0;
+        std::size_t previousViewId = std::numeric_limits<std::size_t>::max();
+        bool viewConflict = false;
+        for (; end < nodesPerClass.size() && nodesPerClass[end].first == classId; ++end)
         {
-            std::size_t cpt = 0;
-            std::set<std::size_t> myset;
-            for (lemon::UnionFindEnum<IndexMap>::ItemIt iit(*_d->tracksUF, cit); iit != INVALID; ++iit)
-            {
-                myset.insert(_d->map_nodeToIndex[iit].first);
-                ++cpt;
-            }
-            if ((clearForks && myset.size() != cpt) || myset.size() < minTrackLength)
-            {
-#pragma omp critical
-                set_classToErase.insert(cit.operator int());
-            }
+            const std::size_t viewId = _d->features[nodesPerClass[end].second].first;
+            if (viewId == previousViewId)
+                viewConflict = true;
+            else
+                ++nbViews;
+            previousViewId = viewId;
         }
-    }
 
-    std::for_each(set_classToErase.begin(), set_classToErase.end(), [&](int toErase) { _d->tracksUF->eraseClass(toErase); });
+        if ((clearForks && viewConflict) || nbViews < minTrackLength)
+            _d->erasedClasses[classId] = true;
+
+        begin = end;
+    }
 }
 
 bool TracksBuilder::exportToStream(std::ostream& os)
 {
+    const std::vector<std::pair<std::size_t, std::size_t>> nodesPerClass = _d->getNodesPerClass(true);
+
     std::size_t cpt = 0;
-    for (lemon::UnionFindEnum<IndexMap>::ClassIt cit(*_d->tracksUF); cit != INVALID; ++cit)
+    for (std::size_t begin = 0; begin < nodesPerClass.size();)
     {
-        os << "Class: " << cpt++ << std::endl;
-        std::size_t cptTrackLength = 0;
-        for (lemon::UnionFindEnum<IndexMap>::ItemIt iit(*_d->tracksUF, cit); iit != INVALID; ++iit)
-        {
-            ++cptTrackLength;
-        }
-        os << "\t"
-           << "track length: " << cptTrackLength << std::endl;
+        const std::size_t classId = nodesPerClass[begin].first;
+        std::size_t end = begin;
+        while (end < nodesPerClass.size() && nodesPerClass[end].first == classId)
+            ++end;
 
-        for (lemon::UnionFindEnum<IndexMap>::ItemIt iit(*_d->tracksUF, cit); iit != INVALID; ++iit)
+        if (!_d->erasedClasses[classId])
         {
-            os << _d->map_nodeToIndex[iit].first << "  " << _d->map_nodeToIndex[iit].second << std::endl;
+            os << "Class: " << cpt++ << std::endl;
+            os << "\t"
+               << "track length: " << (end - begin) << std::endl;
+
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                const IndexedFeaturePair& currentPair = _d->features[nodesPerClass[i].second];
+                os << currentPair.first << "  " << currentPair.second << std::endl;
+            }
         }
+        begin = end;
     }
     return os.good();
 }
@@ -173,29 +222,45 @@ void TracksBuilder::exportToSTL(TracksMap& allTracks) const
 {
     allTracks.clear();
 
+    const std::vector<std::pair<std::size_t, std::size_t>> nodesPerClass = _d->getNodesPerClass(true);
+
     std::size_t trackIndex = 0;
-    for (lemon::UnionFindEnum<IndexMap>::ClassIt cit(*_d->tracksUF); cit != INVALID; ++cit, ++trackIndex)
+    for (std::size_t begin = 0; begin < nodesPerClass.size();)
     {
-        // create the output track
-        std::pair<TracksMap::iterator, bool> ret = allTracks.insert(std::make_pair(trackIndex, Track()));
-
-        Track& outTrack = ret.first->second;
+        const std::size_t classId = nodesPerClass[begin].first;
+        std::size_t end = begin;
+        while (end < nodesPerClass.size() && nodesPerClass[end].first == classId)
+            ++end;
 
-        for (lemon::UnionFindEnum<IndexMap>::ItemIt iit(*_d->tracksUF, cit); iit != INVALID; ++iit)
+        if (!_d->erasedClasses[classId])
         {
-            const IndexedFeaturePair& currentPair = _d->map_nodeToIndex.at(iit);
-            // all descType inside the track will be the same
-            outTrack.descType = currentPair.second.descType;
-            outTrack.featPerView[currentPair.first].featureId = currentPair.second.featIndex;
+            // create the output track
+            std::pair<TracksMap::iterator, bool> ret = allTracks.insert(std::make_pair(trackIndex, Track()));
+            ++trackIndex;
+
+            Track& outTrack = ret.first->second;
+
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                const IndexedFeaturePair& currentPair = _d->features[nodesPerClass[i].second];
+                // all descType inside the track will be the same
+                outTrack.descType = currentPair.second.descType;
+                outTrack.featPerView[currentPair.first].featureId = currentPair.second.featIndex;
+            }
         }
+        begin = end;
     }
 }
 
 std::size_t TracksBuilder::nbTracks() const
 {
     std::size_t cpt = 0;
-    for (lemon::UnionFindEnum<IndexMap>::ClassIt cit(*_d->tracksUF); cit != lemon::INVALID; ++cit)
-        ++cpt;
+    for (std::size_t node = 0; node < _d->parent.size(); ++node)
+    {
+        // roots are their own parent
+        if (_d->parent[node] == node && !_d->erasedClasses[node])
+            ++cpt;
+    }
     return cpt;
 }
 
@@ -50,8 +50,9 @@ class TracksBuilder
     /**
      * @brief Build tracks for a given series of pairWise matches
      * @param[in] pairwiseMatches PairWise matches
+     * @param[in] multithreaded Distribute the feature collection phase across cores
      */
-    void build(const PairwiseMatches& pairwiseMatches);
+    void build(const PairwiseMatches& pairwiseMatches, bool multithreaded = true);
 
     /**
      * @brief Remove bad tracks (too short or track with ids collision)
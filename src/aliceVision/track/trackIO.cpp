@@ -6,6 +6,17 @@
 
 #include "trackIO.hpp"
 
+#include <aliceVision/system/Logger.hpp>
+#include <aliceVision/system/MemoryMappedFile.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <vector>
+
 namespace aliceVision {
 namespace track {
 
@@ -40,5 +51,262 @@ aliceVision::track::Track tag_invoke(boost::json::value_to_tag<aliceVision::trac
     return ret;
 }
 
+namespace {
+
+// indexed binary track file layout:
+//   header (magic, version, track count, offset table position, view index position)
+//   track records: trackId, descType, observation count, (viewId, featureId) pairs
+//   offset table: file offset of each track record
+//   view index: per view, the ordinals (in the offset table) of the tracks observed in it
+constexpr std::uint64_t kTracksBinaryMagic = 0x534b525456414c41;  // "ALAVTRKS"
+constexpr std::uint32_t kTracksBinaryVersion = 1;
+
+template<typename T>
+void writeValue(std::ostream& os, const T& value)
+{
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/// Bounds-checked cursor over the mapped file
+struct BinaryReader
+{
+    const unsigned char* data = nullptr;
+    std::size_t size = 0;
+    std::size_t pos = 0;
+    bool ok = true;
+
+    template<typename T>
+    T read()
+    {
+        T value{};
+        if (ok && pos + sizeof(T) <= size)
+        {
+            std::memcpy(&value, data + pos, sizeof(T));
+            pos += sizeof(T);
+        }
+        else
+        {
+            ok = false;
+        }
+        return value;
+    }
+
+    void seek(std::size_t newPos)
+    {
+        if (newPos <= size)
+            pos = newPos;
+        else
+            ok = false;
+    }
+};
+
+/// Read one track record at the current cursor position
+std::pair<std::size_t, Track> readTrackRecord(BinaryReader& reader)
+{
+    std::pair<std::size_t, Track> out;
+    out.first = reader.read<std::uint64_t>();
+    out.second.descType = static_cast<feature::EImageDescriberType>(reader.read<std::int32_t>());
+    const std::uint64_t nbObservations = reader.read<std::uint64_t>();
+    for (std::uint64_t i = 0; reader.ok && i < nbObservations; ++i)
+    {
+        const std::uint64_t viewId = reader.read<std::uint64_t>();
+        out.second.featPerView[viewId].featureId = reader.read<std::uint64_t>();
+    }
+    return out;
+}
+
+bool hasBinaryExtension(const std::string& filename)
+{
+    return filename.size() >= 4 && filename.compare(filename.size() - 4, 4, ".bin") == 0;
+}
+
+}  // namespace
+
+bool saveTracksBinary(const std::string& filename, const TracksMap& tracks)
+{
+    std::ofstream os(filename, std::ios::binary);
+    if (!os)
+    {
+        ALICEVISION_LOG_WARNING("Unable to create the tracks file: " << filename);
+        return false;
+    }
+
+    writeValue(os, kTracksBinaryMagic);
+    writeValue(os, kTracksBinaryVersion);
+    writeValue(os, std::uint64_t(tracks.size()));
+
+    // header placeholders, patched once the table positions are known
+    const std::uint64_t headerPatchPosition = os.tellp();
+    writeValue(os, std::uint64_t(0));  // offset table position
+    writeValue(os, std::uint64_t(0));  // view index position
+
+    // track records
+    std::vector<std::uint64_t> trackOffsets;
+    trackOffsets.reserve(tracks.size());
+    std::map<std::uint64_t, std::vector<std::uint64_t>> trackOrdinalsPerView;
+
+    for (const auto& trackIt : tracks)
+    {
+        trackOffsets.push_back(os.tellp());
+        writeValue(os, std::uint64_t(trackIt.first));
+        writeValue(os, std::int32_t(trackIt.second.descType));
+        writeValue(os, std::uint64_t(trackIt.second.featPerView.size()));
+        for (const auto& obsIt : trackIt.second.featPerView)
+        {
+            writeValue(os, std::uint64_t(obsIt.first));
+            writeValue(os, std::uint64_t(obsIt.second.featureId));
+            trackOrdinalsPerView[obsIt.first].push_back(trackOffsets.size() - 1);
+        }
+    }
+
+    // offset table
+    const std::uint64_t offsetTablePosition = os.tellp();
+    for (const std::uint64_t offset : trackOffsets)
+        writeValue(os, offset);
+
+    // view index
+    const std::uint64_t viewIndexPosition = os.tellp();
+    writeValue(os, std::uint64_t(trackOrdinalsPerView.size()));
+    for (const auto& viewIt : trackOrdinalsPerView)
+    {
+        writeValue(os, viewIt.first);
+        writeValue(os, std::uint64_t(viewIt.second.size()));
+        for (const std::uint64_t ordinal : viewIt.second)
+            writeValue(os, ordinal);
+    }
+
+    os.seekp(headerPatchPosition);
+    writeValue(os, offsetTablePosition);
+    writeValue(os, viewIndexPosition);
+
+    return os.good();
+}
+
+bool loadTracksBinary(const std::string& filename, TracksMap& tracks, const std::set<std::size_t>& viewFilter)
+{
+    tracks.clear();
+
+    system::MemoryMappedFile mapping;
+    if (!mapping.open(filename))
+    {
+        ALICEVISION_LOG_WARNING("Unable to open the tracks file: " << filename);
+        return false;
+    }
+
+    BinaryReader reader{mapping.data(), mapping.size()};
+
+    const std::uint64_t magic = reader.read<std::uint64_t>();
+    const std::uint32_t version = reader.read<std::uint32_t>();
+    const std::uint64_t nbTracks = reader.read<std::uint64_t>();
+    const std::uint64_t offsetTablePosition = reader.read<std::uint64_t>();
+    const std::uint64_t viewIndexPosition = reader.read<std::uint64_t>();
+
+    if (!reader.ok || magic != kTracksBinaryMagic || version != kTracksBinaryVersion)
+    {
+        ALICEVISION_LOG_WARNING("Invalid tracks file: " << filename);
+        return false;
+    }
+
+    if (viewFilter.empty())
+    {
+        // sequential load of all the records
+        for (std::uint64_t i = 0; reader.ok && i < nbTracks; ++i)
+            tracks.insert(readTrackRecord(reader));
+    }
+    else
+    {
+        // collect the ordinals of the tracks touching the given views
+        std::set<std::uint64_t> trackOrdinals;
+        reader.seek(viewIndexPosition);
+        const std::uint64_t nbViews = reader.read<std::uint64_t>();
+        for (std::uint64_t v = 0; reader.ok && v < nbViews; ++v)
+        {
+            const std::uint64_t viewId = reader.read<std::uint64_t>();
+            const std::uint64_t nbOrdinals = reader.read<std::uint64_t>();
+            if (viewFilter.count(viewId) != 0)
+            {
+                for (std::uint64_t i = 0; reader.ok && i < nbOrdinals; ++i)
+                    trackOrdinals.insert(reader.read<std::uint64_t>());
+            }
+            else
+            {
+                reader.seek(reader.pos + nbOrdinals * sizeof(std::uint64_t));
+            }
+        }
+
+        // fetch only the selected records
+        for (const std::uint64_t ordinal : trackOrdinals)
+        {
+            reader.seek(offsetTablePosition + ordinal * sizeof(std::uint64_t));
+            const std::uint64_t recordOffset = reader.read<std::uint64_t>();
+            reader.seek(recordOffset);
+            if (reader.ok)
+                tracks.insert(readTrackRecord(reader));
+        }
+    }
+
+    if (!reader.ok)
+    {
+        ALICEVISION_LOG_WARNING("Truncated tracks file: " << filename);
+        tracks.clear();
+        return false;
+    }
+    return true;
+}
+
+bool saveTracks(const std::string& filename, const TracksMap& tracks)
+{
+    if (hasBinaryExtension(filename))
+        return saveTracksBinary(filename, tracks);
+
+    std::ofstream os(filename);
+    if (!os)
+    {
+        ALICEVISION_LOG_WARNING("Unable to create the tracks file: " << filename);
+        return false;
+    }
+    const boost::json::value jv = boost::json::value_from(tracks);
+    os << boost::json::serialize(jv);
+    return os.good();
+}
+
+bool loadTracks(const std::string& filename, TracksMap& tracks, const std::set<std::size_t>& viewFilter)
+{
+    if (hasBinaryExtension(filename))
+        return loadTracksBinary(filename, tracks, viewFilter);
+
+    tracks.clear();
+
+    std::ifstream is(filename);
+    if (!is)
+    {
+        ALICEVISION_LOG_WARNING("Unable to open the tracks file: " << filename);
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << is.rdbuf();
+    boost::json::value jv = boost::json::parse(buffer.str());
+    tracks = flat_map_value_to<track::Track>(jv);
+
+    // the JSON format has no index: filter after the full parse
+    if (!viewFilter.empty())
+    {
+        for (auto it = tracks.begin(); it != tracks.end();)
+        {
+            bool touchesFilter = false;
+            for (const auto& obsIt : it->second.featPerView)
+            {
+                if (viewFilter.count(obsIt.first) != 0)
+                {
+                    touchesFilter = true;
+                    break;
+                }
+            }
+            it = touchesFilter ? std::next(it) : tracks.erase(it);
+        }
+    }
+    return true;
+}
+
 }  // namespace track
 }  // namespace aliceVision
@@ -10,6 +10,9 @@
 
 #include <boost/json.hpp>
 
+#include <set>
+#include <string>
+
 namespace aliceVision {
 namespace track {
 
@@ -39,5 +42,42 @@ void tag_invoke(const boost::json::value_from_tag&, boost::json::value& jv, alic
  */
 aliceVision::track::Track tag_invoke(boost::json::value_to_tag<aliceVision::track::Track>, boost::json::value const& jv);
 
+/**
+ * @brief Save all tracks to an indexed binary file.
+ *
+ * The file stores fixed-width track records followed by a per-track offset table
+ * and a per-view index, so a reader can fetch only the tracks touching a given
+ * view set without parsing the whole file (see loadTracksBinary).
+ *
+ * @param[in] filename output file path
+ * @param[in] tracks the tracks to save
+ * @return true on success
+ */
+bool saveTracksBinary(const std::string& filename, const TracksMap& tracks);
+
+/**
+ * @brief Load tracks from an indexed binary file written by saveTracksBinary.
+ * @param[in] filename input file path
+ * @param[out] tracks the loaded tracks
+ * @param[in] viewFilter if not empty, only the tracks observed in at least one
+ *            of the given views are loaded, using the per-view index
+ * @return true on success
+ */
+bool loadTracksBinary(const std::string& filename, TracksMap& tracks, const std::set<std::size_t>& viewFilter = {});
+
+/**
+ * @brief Save tracks to JSON or indexed binary, based on the file extension
+ *        ('.bin': binary, anything else: JSON).
+ */
+bool saveTracks(const std::string& filename, const TracksMap& tracks);
+
+/**
+ * @brief Load tracks from JSON or indexed binary, based on the file extension
+ *        ('.bin': binary, anything else: JSON).
+ * @param[in] viewFilter if not empty, only keep the tracks observed in at least
+ *            one of the given views (I/O level filtering with the binary format)
+ */
+bool loadTracks(const std::string& filename, TracksMap& tracks, const std::set<std::size_t>& viewFilter = {});
+
 }  // namespace track
 }  // namespace aliceVision
@@ -7,6 +7,7 @@
 
 #include "tracksUtils.hpp"
 
+#include <algorithm>
 #include <iterator>
 
 namespace aliceVision {
@@ -45,40 +46,39 @@ void getCommonTracksInImages(const std::set<std::size_t>& imageIndexes, const Tr
     assert(!imageIndexes.empty());
     visibleTracks.clear();
 
-    // take the first image id
-    std::set<std::size_t>::const_iterator it = imageIndexes.cbegin();
+    // gather the per-view sorted track id lists, smallest list first:
+    // every intersection is then bounded by the sparsest view
+    std::vector<const TrackIdSet*> imageTracksList;
+    imageTracksList.reserve(imageIndexes.size());
+    for (std::size_t imageIndex : imageIndexes)
     {
-        TracksPerView::const_iterator tracksPerViewIt = tracksPerView.find(*it);
-        // if there are no tracks for the first view just return as there will not be
-        // any common track
+        TracksPerView::const_iterator tracksPerViewIt = tracksPerView.find(imageIndex);
         if (tracksPerViewIt == tracksPerView.end())
         {
             // one image is not present in the tracksPerView, so there is no track in common
-            visibleTracks.clear();
             return;
         }
-        const TrackIdSet& imageTracks = tracksPerViewIt->second;
-        // copy all the visible tracks by the first image
-        visibleTracks.insert(imageTracks.cbegin(), imageTracks.cend());
+        imageTracksList.push_back(&tracksPerViewIt->second);
     }
-    ++it;
-    // for each of the remaining view
-    for (; it != imageIndexes.cend(); ++it)
+    std::sort(imageTracksList.begin(), imageTracksList.end(), [](const TrackIdSet* a, const TrackIdSet* b) { return a->size() < b->size(); });
+
+    // intersect the sorted contiguous lists pairwise in reused packed buffers,
+    // the node-based output set is only filled once at the end
+    std::vector<std::size_t> commonTracks(imageTracksList.front()->cbegin(), imageTracksList.front()->cend());
+    std::vector<std::size_t> intersectionBuffer;
+    intersectionBuffer.reserve(commonTracks.size());
+    for (std::size_t i = 1; i < imageTracksList.size() && !commonTracks.empty(); ++i)
     {
-        // if there are no tracks for this view just return
-        TracksPerView::const_iterator tracksPerViewIt = tracksPerView.find(*it);
-        if (tracksPerViewIt == tracksPerView.end())
-        {
-            // one image is not present in the tracksPerView, so there is no track in common
-            visibleTracks.clear();
-            return;
-        }
-        const TrackIdSet& imageTracks = tracksPerViewIt->second;
-        std::set<std::size_t> tmp;
-        std::set_intersection(
-          visibleTracks.cbegin(), visibleTracks.cend(), imageTracks.cbegin(), imageTracks.cend(), std::inserter(tmp, tmp.begin()));
-        visibleTracks.swap(tmp);
+        intersectionBuffer.clear();
+        std::set_intersection(commonTracks.cbegin(),
+                              commonTracks.cend(),
+                              imageTracksList[i]->cbegin(),
+                              imageTracksList[i]->cend(),
+                              std::back_inserter(intersectionBuffer));
+        commonTracks.swap(intersectionBuffer);
     }
+
+    visibleTracks.insert(commonTracks.cbegin(), commonTracks.cend());
 }
 
 bool getCommonTracksInImagesFast(const std::set<std::size_t>& imageIndexes,
@@ -126,12 +126,21 @@ void getTracksInImages(const std::set<std::size_t>& imagesId, const TracksMap& t
 void getTracksInImagesFast(const std::set<IndexT>& imagesId, const TracksPerView& tracksPerView, std::set<IndexT>& tracksIds)
 {
     tracksIds.clear();
+
+    // concatenate the sorted per-view lists and sort/unique the packed array,
+    // much cheaper than growing a node-based set one id at a time
+    std::vector<std::size_t> allTracks;
     for (const std::size_t id : imagesId)
     {
-        std::set<std::size_t> currentImageTracks;
-        getTracksInImageFast(id, tracksPerView, currentImageTracks);
-        tracksIds.insert(currentImageTracks.begin(), currentImageTracks.end());
+        TracksPerView::const_iterator tracksPerViewIt = tracksPerView.find(id);
+        if (tracksPerViewIt == tracksPerView.end())
+            continue;
+        allTracks.insert(allTracks.end(), tracksPerViewIt->second.cbegin(), tracksPerViewIt->second.cend());
     }
+    std::sort(allTracks.begin(), allTracks.end());
+    allTracks.erase(std::unique(allTracks.begin(), allTracks.end()), allTracks.end());
+
+    tracksIds.insert(allTracks.cbegin(), allTracks.cend());
 }
 
 void getTracksInImage(const std::size_t& imageIndex, const TracksMap& tracks, std::set<std::size_t>& tracksIds)
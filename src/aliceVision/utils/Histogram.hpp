@@ -7,6 +7,7 @@
 #pragma once
 
 #include <iomanip>
+#include <iterator>
 #include <numeric>
 #include <sstream>
 #include <string>
@@ -53,12 +54,14 @@ class Histogram
         freq.resize(nBins, 0);
     }
 
-    // Construct a histogram from a sequence of data
+    // Construct a histogram from a sequence of data.
+    // Large random-access ranges are binned in parallel with one set of bins
+    // per thread merged at the end, so reporting over millions of residuals
+    // does not serialize on a single counter array.
     template<typename DataInputIterator>
     void Add(DataInputIterator begin, DataInputIterator end)
     {
-        for (DataInputIterator iter = begin; iter != end; ++iter)
-            Add(static_cast<T>(*iter));
+        Add(begin, end, typename std::iterator_traits<DataInputIterator>::iterator_category());
     }
 
     // Increase the count for the bin that holds a
@@ -118,6 +121,45 @@ class Histogram
     }
 
   private:
+    // Serial fallback for single-pass iterators
+    template<typename DataInputIterator>
+    void Add(DataInputIterator begin, DataInputIterator end, std::input_iterator_tag)
+    {
+        for (DataInputIterator iter = begin; iter != end; ++iter)
+            Add(static_cast<T>(*iter));
+    }
+
+    // Parallel path for random-access ranges: per-thread bins, merged once
+    template<typename DataRandomAccessIterator>
+    void Add(DataRandomAccessIterator begin, DataRandomAccessIterator end, std::random_access_iterator_tag)
+    {
+        const std::ptrdiff_t count = end - begin;
+        // below this size the merge costs more than the binning
+        static const std::ptrdiff_t parallelThreshold = 100000;
+        if (count < parallelThreshold)
+        {
+            Add(begin, end, std::input_iterator_tag());
+            return;
+        }
+
+#pragma omp parallel
+        {
+            Histogram<T> local(static_cast<T>(Start), static_cast<T>(End), nBins);
+
+#pragma omp for nowait
+            for (std::ptrdiff_t i = 0; i < count; ++i)
+                local.Add(static_cast<T>(begin[i]));
+
+#pragma omp critical
+            {
+                for (size_t bin = 0; bin < nBins; ++bin)
+                    freq[bin] += local.freq[bin];
+                overflow += local.overflow;
+                underflow += local.underflow;
+            }
+        }
+    }
+
     double Start, End, nBins_by_interval;
     size_t nBins;                // number of bins
     std::vector<size_t> freq;    // histogram
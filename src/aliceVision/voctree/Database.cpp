@@ -8,6 +8,7 @@
 #include <aliceVision/system/ProgressDisplay.hpp>
 #include <boost/accumulators/accumulators.hpp>
 #include <boost/accumulators/statistics/tail.hpp>
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 #include <stdexcept>
@@ -47,16 +48,23 @@ DocId Database::insert(DocId doc_id, const SparseHistogram& document)
     // Ensure that the new document to insert is not already there.
     assert(database_.find(doc_id) == database_.end());
 
-    // For each word, retrieve its inverted file and increment the count for doc_id.
+    // Assign the next dense document slot, the inverted files refer to it.
+    const uint32_t docSlot = doc_ids_.size();
+    doc_ids_.push_back(doc_id);
+
+    // For each word, retrieve its inverted file and increment the count for the document.
+    uint32_t totalCount = 0;
     for (SparseHistogram::const_iterator it = document.begin(), end = document.end(); it != end; ++it)
     {
         Word word = it->first;
         InvertedFile& file = word_files_[word];
-        if (file.empty() || file.back().id != doc_id)
-            file.push_back(WordFrequency(doc_id, it->second.size()));
+        if (file.empty() || file.back().docSlot != docSlot)
+            file.push_back(WordFrequency(docSlot, it->second.size()));
         else
             file.back().count += it->second.size();
+        totalCount += it->second.size();
     }
+    doc_total_counts_.push_back(totalCount);
 
     database_[doc_id] = document;
 
@@ -123,13 +131,66 @@ void Database::find(const std::vector<Word>& document, std::size_t N, std::vecto
 void Database::find(const SparseHistogram& query, std::size_t N, std::vector<DocMatch>& matches, const std::string& distanceMethod) const
 {
     matches.clear();
-    matches.reserve(database_.size());
-    for (const auto& document : database_)
+    matches.reserve(doc_ids_.size());
+
+    // All the distance methods except "weightedStrongCommonPoints" only score the words
+    // shared by the query and a document, so instead of merging the query histogram with
+    // every document of the database we walk the inverted files of the query words and
+    // accumulate the per-document scores: the cost scales with the postings of the query
+    // words instead of with the size of the database.
+    if (distanceMethod == "classic" || distanceMethod == "commonPoints" || distanceMethod == "strongCommonPoints" ||
+        distanceMethod == "inversedWeightedCommonPoints")
+    {
+        std::vector<float> scores(doc_ids_.size(), 0.f);
+        uint32_t queryTotal = 0;
+        for (const auto& queryWord : query)
+        {
+            const uint32_t queryCount = queryWord.second.size();
+            queryTotal += queryCount;
+            const InvertedFile& file = word_files_[queryWord.first];
+            if (distanceMethod == "strongCommonPoints")
+            {
+                // only words appearing exactly once in both documents count
+                if (queryCount != 1)
+                    continue;
+                for (const WordFrequency& wf : file)
+                    if (wf.count == 1)
+                        scores[wf.docSlot] += 1.f;
+            }
+            else if (distanceMethod == "inversedWeightedCommonPoints")
+            {
+                const float weight = word_weights_[queryWord.first];
+                for (const WordFrequency& wf : file)
+                    scores[wf.docSlot] += weight / std::min(queryCount, wf.count);
+            }
+            else  // "classic" and "commonPoints" both accumulate the common feature count
+            {
+                for (const WordFrequency& wf : file)
+                    scores[wf.docSlot] += std::min(queryCount, wf.count);
+            }
+        }
+
+        if (distanceMethod == "classic")
+        {
+            // symmetric difference of the histograms: |q| + |d| - 2 * common
+            for (std::size_t slot = 0; slot < doc_ids_.size(); ++slot)
+                matches.emplace_back(doc_ids_[slot], float(queryTotal + doc_total_counts_[slot]) - 2.f * scores[slot]);
+        }
+        else
+        {
+            for (std::size_t slot = 0; slot < doc_ids_.size(); ++slot)
+                matches.emplace_back(doc_ids_[slot], -scores[slot]);
+        }
+    }
+    else
     {
-        // for each document/image in the database compute the distance between the
-        // histograms of the query image and the others
-        const float distance = sparseDistance(query, document.second, distanceMethod, word_weights_);
-        matches.emplace_back(document.first, distance);
+        for (const auto& document : database_)
+        {
+            // for each document/image in the database compute the distance between the
+            // histograms of the query image and the others
+            const float distance = sparseDistance(query, document.second, distanceMethod, word_weights_);
+            matches.emplace_back(document.first, distance);
+        }
     }
     const std::size_t nMatches = std::min(N, matches.size());
     std::partial_sort(matches.begin(), matches.begin() + nMatches, matches.end());
@@ -164,6 +225,94 @@ void Database::saveWeights(const std::string& file) const
     out.write((char*)(&word_weights_[0]), num_words * sizeof(float));
 }
 
+namespace {
+// identifies a database snapshot file and its layout version
+const char databaseSnapshotMagic[8] = {'A', 'V', 'V', 'T', 'D', 'B', '0', '1'};
+}  // namespace
+
+void Database::save(const std::string& file) const
+{
+    std::ofstream out(file, std::ios_base::binary);
+    out.write(databaseSnapshotMagic, sizeof(databaseSnapshotMagic));
+
+    const uint32_t num_words = word_weights_.size();
+    out.write((char*)(&num_words), sizeof(uint32_t));
+    out.write((char*)(&word_weights_[0]), num_words * sizeof(float));
+
+    const uint64_t num_docs = database_.size();
+    out.write((char*)(&num_docs), sizeof(uint64_t));
+    for (const auto& doc : database_)
+    {
+        const uint32_t doc_id = doc.first;
+        const uint32_t doc_words = doc.second.size();
+        out.write((char*)(&doc_id), sizeof(uint32_t));
+        out.write((char*)(&doc_words), sizeof(uint32_t));
+        for (const auto& wordFeatures : doc.second)
+        {
+            const uint32_t word = wordFeatures.first;
+            const uint32_t num_features = wordFeatures.second.size();
+            out.write((char*)(&word), sizeof(uint32_t));
+            out.write((char*)(&num_features), sizeof(uint32_t));
+            out.write((char*)(&wordFeatures.second[0]), num_features * sizeof(IndexT));
+        }
+    }
+}
+
+void Database::load(const std::string& file)
+{
+    std::ifstream in;
+    in.exceptions(std::ifstream::eofbit | std::ifstream::failbit | std::ifstream::badbit);
+
+    try
+    {
+        in.open(file, std::ios_base::binary);
+
+        char magic[sizeof(databaseSnapshotMagic)];
+        in.read(magic, sizeof(magic));
+        if (!std::equal(std::begin(magic), std::end(magic), std::begin(databaseSnapshotMagic)))
+            throw std::runtime_error((boost::format("'%s' is not a database snapshot file") % file).str());
+
+        uint32_t num_words = 0;
+        in.read((char*)(&num_words), sizeof(uint32_t));
+        word_files_.clear();
+        word_files_.resize(num_words);
+        word_weights_.resize(num_words);
+        in.read((char*)(&word_weights_[0]), num_words * sizeof(float));
+
+        uint64_t num_docs = 0;
+        in.read((char*)(&num_docs), sizeof(uint64_t));
+        database_.clear();
+        doc_ids_.clear();
+        doc_total_counts_.clear();
+        for (uint64_t d = 0; d < num_docs; ++d)
+        {
+            uint32_t doc_id = 0;
+            uint32_t doc_words = 0;
+            in.read((char*)(&doc_id), sizeof(uint32_t));
+            in.read((char*)(&doc_words), sizeof(uint32_t));
+
+            SparseHistogram document;
+            for (uint32_t w = 0; w < doc_words; ++w)
+            {
+                uint32_t word = 0;
+                uint32_t num_features = 0;
+                in.read((char*)(&word), sizeof(uint32_t));
+                in.read((char*)(&num_features), sizeof(uint32_t));
+                std::vector<IndexT>& features = document[word];
+                features.resize(num_features);
+                if (num_features > 0)
+                    in.read((char*)(&features[0]), num_features * sizeof(IndexT));
+            }
+            // insert() also rebuilds the inverted files from the document vector
+            insert(doc_id, document);
+        }
+    }
+    catch (std::ifstream::failure& e)
+    {
+        throw std::runtime_error((boost::format("Failed to load database snapshot file '%s'") % file).str());
+    }
+}
+
 void Database::loadWeights(const std::string& file)
 {
     std::ifstream in;
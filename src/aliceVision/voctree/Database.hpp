@@ -116,31 +116,46 @@ class Database
      */
     std::size_t size() const;
 
+    /**
+     * @brief Check whether a document is already in the database.
+     * @param doc_id Unique ID of the document.
+     * @return true if a document with this ID has been inserted.
+     */
+    bool contains(DocId doc_id) const { return database_.count(doc_id) != 0; }
+
     /// Save the vocabulary word weights to a file.
     void saveWeights(const std::string& file) const;
     /// Load the vocabulary word weights from a file.
     void loadWeights(const std::string& file);
 
-    // Save weights and documents
-    // void save(const std::string& file) const;
-    // void load(const std::string& file);
+    /**
+     * @brief Save a binary snapshot of the database: the word weights and the document
+     * vectors, from which the inverted index is rebuilt at load time.
+     *
+     * A snapshot allows incremental updates of a survey: reload it, insert only the
+     * documents of the new views (@see contains()) and save it again, instead of
+     * quantizing every view from scratch.
+     */
+    void save(const std::string& file) const;
+    /// Load a binary snapshot of the database saved with save().
+    void load(const std::string& file);
 
     const SparseHistogramPerImage& getSparseHistogramPerImage() const { return database_; }
 
   private:
     struct WordFrequency
     {
-        DocId id;
+        uint32_t docSlot;  ///< dense index of the document, see doc_ids_
         uint32_t count;
 
         WordFrequency() = default;
-        WordFrequency(DocId _id, uint32_t _count)
-          : id(_id),
+        WordFrequency(uint32_t _docSlot, uint32_t _count)
+          : docSlot(_docSlot),
             count(_count)
         {}
     };
 
-    // Stored in increasing order by DocId
+    // Stored in increasing order by document slot
     typedef std::vector<WordFrequency> InvertedFile;
 
     /// @todo Use sorted vector?
@@ -150,6 +165,8 @@ class Database
 
     std::vector<InvertedFile> word_files_;
     std::vector<float> word_weights_;
+    std::vector<DocId> doc_ids_;               // document slot to DocId, in insertion order
+    std::vector<uint32_t> doc_total_counts_;   // total number of features of each document slot
     SparseHistogramPerImage database_;  // Precomputed for inserted documents
 
     /**
@@ -311,6 +311,22 @@ class SimpleKmeans
 
     void setRestarts(std::size_t restarts) { restarts_ = restarts; }
 
+    std::size_t getMiniBatchSize() const { return minibatch_size_; }
+
+    /**
+     * @brief Enable mini-batch k-means on large inputs.
+     *
+     * When set to a non-zero value, inputs notably larger than the batch size are clustered
+     * with mini-batch k-means (Sculley, "Web-scale k-means clustering", WWW 2010): each
+     * iteration only assigns a random batch of the features and updates the centers with
+     * per-center running means. This trades a slightly higher sum squared error for a
+     * runtime independent of the input size, which makes building large vocabulary trees
+     * from hundreds of millions of descriptors practical.
+     *
+     * @param batchSize Number of features per batch, 0 (the default) always runs full Lloyd iterations.
+     */
+    void setMiniBatchSize(std::size_t batchSize) { minibatch_size_ = batchSize; }
+
     int getVerbose() const { return verbose_; }
 
     void setVerbose(const int verboseLevel) { verbose_ = verboseLevel; }
@@ -350,11 +366,17 @@ class SimpleKmeans
                                       std::vector<Feature>& centers,
                                       std::vector<unsigned int>& membership) const;
 
+    squared_distance_type clusterMiniBatch(const std::vector<Feature*>& features,
+                                           std::size_t k,
+                                           std::vector<Feature>& centers,
+                                           std::vector<unsigned int>& membership) const;
+
     Feature zero_;
     Distance distance_;
     Initializer choose_centers_;
     std::size_t max_iterations_;
     std::size_t restarts_;
+    std::size_t minibatch_size_;
     int verbose_;
 };
 
@@ -366,7 +388,8 @@ SimpleKmeans<Feature, Distance>::SimpleKmeans(const Feature& zero, Distance d, c
     choose_centers_(InitKmeanspp()),
     max_iterations_(100),
     verbose_(verbose),
-    restarts_(1)
+    restarts_(1),
+    minibatch_size_(0)
 {}
 
 template<class Feature, class Distance>
@@ -426,6 +449,11 @@ typename SimpleKmeans<Feature, Distance>::squared_distance_type SimpleKmeans<Fea
     typedef typename std::vector<Feature>::value_type centerType;
     typedef typename Distance::value_type feature_value_type;
 
+    // Fall back to mini-batch iterations when enabled and the input is notably larger
+    // than a single batch, full Lloyd iterations would not pay off there.
+    if (minibatch_size_ > 0 && features.size() > 2 * minibatch_size_)
+        return clusterMiniBatch(features, k, centers, membership);
+
     std::vector<std::size_t> new_center_counts(k);
     std::vector<Feature> new_centers(k);
     std::vector<std::mutex> centersLocks(k);
@@ -547,5 +575,102 @@ typename SimpleKmeans<Feature, Distance>::squared_distance_type SimpleKmeans<Fea
     return sse;
 }
 
+template<class Feature, class Distance>
+typename SimpleKmeans<Feature, Distance>::squared_distance_type SimpleKmeans<Feature, Distance>::clusterMiniBatch(
+  const std::vector<Feature*>& features,
+  std::size_t k,
+  std::vector<Feature>& centers,
+  std::vector<unsigned int>& membership) const
+{
+    // Mini-batch k-means, see Sculley, "Web-scale k-means clustering", WWW 2010:
+    // each iteration assigns a random batch of features to the current centers and moves
+    // every center towards the running mean of all the batch features assigned to it so
+    // far, which is the per-center learning rate 1/count of the paper. Only the final
+    // assignment pass touches every feature.
+    std::vector<Feature> center_sums(k, zero_);
+    std::vector<std::size_t> center_counts(k, 0);
+    std::vector<std::size_t> batch(minibatch_size_);
+    std::vector<unsigned int> batch_membership(minibatch_size_);
+
+    if (verbose_ > 0)
+        ALICEVISION_LOG_DEBUG("Mini-batch iterations");
+    for (std::size_t iter = 0; iter < max_iterations_; ++iter)
+    {
+        if (verbose_ > 0)
+            ALICEVISION_LOG_DEBUG("*");
+
+        // Draw a random batch of features
+        for (std::size_t i = 0; i < minibatch_size_; ++i)
+            batch[i] = rand() % features.size();
+
+// Assign the batch to the current centers
+#pragma omp parallel for shared(batch, batch_membership, features, centers)
+        for (ptrdiff_t i = 0; i < static_cast<ptrdiff_t>(minibatch_size_); ++i)
+        {
+            squared_distance_type d_min = std::numeric_limits<squared_distance_type>::max();
+            unsigned int nearest = 0;
+
+            // Find the nearest cluster center to batch feature i
+            for (unsigned int j = 0; j < k; ++j)
+            {
+                const squared_distance_type distance = distance_(*features[batch[i]], centers[j]);
+                if (distance < d_min)
+                {
+                    d_min = distance;
+                    nearest = j;
+                }
+            }
+            batch_membership[i] = nearest;
+        }
+
+        // Accumulate the batch into the per-center running sums and move each center
+        // to the mean of everything it has accumulated. Centers that were never hit
+        // by any batch keep their initial position.
+        for (std::size_t i = 0; i < minibatch_size_; ++i)
+        {
+            const unsigned int nearest = batch_membership[i];
+            center_sums[nearest] += *features[batch[i]];
+            ++center_counts[nearest];
+        }
+
+        squared_distance_type max_center_shift = 0;
+        for (std::size_t j = 0; j < k; ++j)
+        {
+            if (center_counts[j] == 0)
+                continue;
+            const Feature new_center = center_sums[j] / center_counts[j];
+            max_center_shift = std::max(max_center_shift, distance_(new_center, centers[j]));
+            centers[j] = new_center;
+        }
+        if (max_center_shift <= 10e-10)
+            break;
+    }
+    if (verbose_ > 0)
+        ALICEVISION_LOG_DEBUG("");
+
+    // Final assignment of all the features, also accumulating the sum squared error
+    squared_distance_type sse = squared_distance_type(0);
+    assert(features.size() > 0);
+#pragma omp parallel for reduction(+ : sse) shared(features, centers, membership)
+    for (ptrdiff_t i = 0; i < static_cast<ptrdiff_t>(features.size()); ++i)
+    {
+        squared_distance_type d_min = std::numeric_limits<squared_distance_type>::max();
+        unsigned int nearest = 0;
+
+        for (unsigned int j = 0; j < k; ++j)
+        {
+            const squared_distance_type distance = distance_(*features[i], centers[j]);
+            if (distance < d_min)
+            {
+                d_min = distance;
+                nearest = j;
+            }
+        }
+        membership[i] = nearest;
+        sse += d_min;
+    }
+    return sse;
+}
+
 }  // namespace voctree
 }  // namespace aliceVision
@@ -103,58 +103,79 @@ void TreeBuilder<Feature, DistanceT>::build(const FeatureVector& training_featur
             feature_ptrs.push_back(const_cast<Feature*>(&f));
         }
     }
-    FeatureVector centers;  // always size k
     for (uint32_t level = 0; level < levels; ++level)
     {
         if (verbose_)
             printf("# Level %u\n", level);
-        std::vector<unsigned int> membership;
 
-        for (std::size_t i = 0, ie = subset_queue.size(); i < ie; ++i)
+        // Move all the subsets of the current level out of the queue, they are disjoint
+        // and can be clustered independently.
+        std::vector<std::vector<Feature*>> subsets(std::make_move_iterator(subset_queue.begin()), std::make_move_iterator(subset_queue.end()));
+        subset_queue.clear();
+
+        // Per-node outputs: k centers (invalid ones padded with zero_), the number of
+        // valid centers and the k child subsets of each node.
+        std::vector<FeatureVector> node_centers(subsets.size());
+        std::vector<std::size_t> node_valid(subsets.size(), 0);
+        std::vector<std::vector<std::vector<Feature*>>> node_children(subsets.size());
+
+        // Train the nodes of the level in parallel. The first levels have fewer subsets
+        // than cores, there the region is kept inactive so that the parallelism inside
+        // the k-means iterations is preserved.
+#pragma omp parallel for schedule(dynamic) if (subsets.size() > 1)
+        for (ptrdiff_t i = 0; i < static_cast<ptrdiff_t>(subsets.size()); ++i)
         {
-            std::vector<Feature*>& subset = subset_queue.front();
+            std::vector<Feature*>& subset = subsets[i];
             if (verbose_ > 1)
-                printf("#\tClustering subset %lu/%lu of size %lu\n", i + 1, ie, subset.size());
+                printf("#\tClustering subset %lu/%lu of size %lu\n", static_cast<std::size_t>(i + 1), subsets.size(), subset.size());
 
             // If the subset already has k or fewer elements, just use those as the centers.
             if (subset.size() <= k)
             {
                 if (verbose_ > 2)
                     printf("#\tno need to cluster %lu elements\n", subset.size());
+                node_centers[i].reserve(k);
                 for (std::size_t j = 0; j < subset.size(); ++j)
                 {
-                    tree_.centers().push_back(*subset[j]);
-                    tree_.validCenters().push_back(1);
+                    node_centers[i].push_back(*subset[j]);
                 }
                 // Mark non-existent centers as invalid.
-                tree_.centers().insert(tree_.centers().end(), k - subset.size(), zero_);
-                tree_.validCenters().insert(tree_.validCenters().end(), k - subset.size(), 0);
+                node_centers[i].insert(node_centers[i].end(), k - subset.size(), zero_);
+                node_valid[i] = subset.size();
 
-                // Push k empty subsets into the queue so all children get marked invalid.
-                subset_queue.pop_front();
-                subset_queue.insert(subset_queue.end(), k, std::vector<Feature*>());
+                // k empty subsets so all children get marked invalid.
+                node_children[i].assign(k, std::vector<Feature*>());
             }
             else
             {
                 // Cluster the current subset into k centers.
                 if (verbose_ > 2)
                     printf("#\tclustering the current subset of %lu elements into %d centers\n", subset.size(), k);
+                FeatureVector centers;
+                std::vector<unsigned int> membership;
                 kmeans_.clusterPointers(subset, k, centers, membership);
-                // Add the centers and mark them as valid.
-                tree_.centers().insert(tree_.centers().end(), centers.begin(), centers.end());
-                tree_.validCenters().insert(tree_.validCenters().end(), k, 1);
+                node_centers[i] = std::move(centers);
+                node_valid[i] = k;
                 // Partition the current subset into k new subsets based on the cluster assignments.
-                std::vector<std::vector<Feature*>> new_subsets(k);
+                node_children[i].resize(k);
                 assert(membership.size() >= subset.size());
                 for (std::size_t j = 0; j < subset.size(); ++j)
                 {
                     assert(membership[j] < k);
-                    assert(membership[j] < new_subsets.size());
-                    new_subsets[membership[j]].push_back(subset[j]);
+                    node_children[i][membership[j]].push_back(subset[j]);
                 }
-                // Update the queue
-                subset_queue.pop_front();
-                subset_queue.insert(subset_queue.end(), new_subsets.begin(), new_subsets.end());
+            }
+        }
+
+        // Merge the per-node results into the tree in node order.
+        for (std::size_t i = 0; i < subsets.size(); ++i)
+        {
+            tree_.centers().insert(tree_.centers().end(), node_centers[i].begin(), node_centers[i].end());
+            tree_.validCenters().insert(tree_.validCenters().end(), node_valid[i], 1);
+            tree_.validCenters().insert(tree_.validCenters().end(), k - node_valid[i], 0);
+            for (std::vector<Feature*>& child : node_children[i])
+            {
+                subset_queue.push_back(std::move(child));
             }
         }
         if (verbose_)
@@ -19,9 +19,11 @@
 #include <stdint.h>
 #include <vector>
 #include <map>
+#include <algorithm>
 #include <cassert>
 #include <limits>
 #include <fstream>
+#include <numeric>
 #include <stdexcept>
 #include <iostream>
 
@@ -115,16 +117,29 @@ class VocabularyTree : public IVocabularyTree
     Word quantize(const DescriptorT& feature) const;
 
     /// Quantizes a set of features into visual words.
-    template<class DescriptorT>
-    std::vector<Word> quantize(const std::vector<DescriptorT>& features) const;
+    template<class DescriptorT, class AllocatorT>
+    std::vector<Word> quantize(const std::vector<DescriptorT, AllocatorT>& features) const;
+
+    /**
+     * @brief Quantizes a set of features into visual words, level by level over blocks of descriptors.
+     *
+     * All the descriptors descend the tree together: at each level they are grouped by current
+     * node and the distances of a whole group to the children of its node are computed with a
+     * single matrix product against a dense float copy of the centers (one column per center),
+     * which vectorizes much better than walking the descriptors one at a time. Distances are
+     * expanded as |c|^2 - 2 d.c in single precision, so near-equidistant children can rarely
+     * be resolved differently than by the scalar quantize().
+     */
+    template<class DescriptorT, class AllocatorT>
+    std::vector<Word> quantizeBatched(const std::vector<DescriptorT, AllocatorT>& features) const;
 
     /// Quantizes a set of features into sparse histogram of visual words.
-    template<class DescriptorT>
-    SparseHistogram quantizeToSparse(const std::vector<DescriptorT>& features) const;
+    template<class DescriptorT, class AllocatorT>
+    SparseHistogram quantizeToSparse(const std::vector<DescriptorT, AllocatorT>& features) const;
 
     SparseHistogram quantizeToSparse(const void* blindDescriptors) const override
     {
-        const std::vector<Feature>* descriptors = static_cast<const std::vector<Feature>*>(blindDescriptors);
+        const feature::DescriptorVector<Feature>* descriptors = static_cast<const feature::DescriptorVector<Feature>*>(blindDescriptors);
         return quantizeToSparse(*descriptors);
     }
 
@@ -161,6 +176,13 @@ class VocabularyTree : public IVocabularyTree
     bool initialized() const { return num_words_ != 0; }
 
     void setNodeCounts();
+
+    void buildCentersLookup();
+
+    /// dense float copy of the centers (one column per center) and their squared norms,
+    /// built after load() for the batched quantizer
+    Eigen::MatrixXf centersLookup_;
+    Eigen::VectorXf centersSqNorm_;
 };
 
 template<class Feature, template<typename, typename> class Distance>
@@ -216,8 +238,8 @@ Word VocabularyTree<Feature, Distance>::quantize(const DescriptorT& feature) con
 }
 
 template<class Feature, template<typename, typename> class Distance>
-template<class DescriptorT>
-std::vector<Word> VocabularyTree<Feature, Distance>::quantize(const std::vector<DescriptorT>& features) const
+template<class DescriptorT, class AllocatorT>
+std::vector<Word> VocabularyTree<Feature, Distance>::quantize(const std::vector<DescriptorT, AllocatorT>& features) const
 {
     // ALICEVISION_LOG_DEBUG("VocabularyTree quantize: " << features.size());
     std::vector<Word> imgVisualWords(features.size(), 0);
@@ -235,11 +257,111 @@ std::vector<Word> VocabularyTree<Feature, Distance>::quantize(const std::vector<
 }
 
 template<class Feature, template<typename, typename> class Distance>
-template<class DescriptorT>
-SparseHistogram VocabularyTree<Feature, Distance>::quantizeToSparse(const std::vector<DescriptorT>& features) const
+template<class DescriptorT, class AllocatorT>
+std::vector<Word> VocabularyTree<Feature, Distance>::quantizeBatched(const std::vector<DescriptorT, AllocatorT>& features) const
+{
+    assert(initialized());
+
+    const std::size_t nbDescriptors = features.size();
+    std::vector<Word> imgVisualWords(nbDescriptors, 0);
+
+    if (nbDescriptors == 0)
+        return imgVisualWords;
+
+    if (centersLookup_.cols() != Eigen::Index(centers_.size()))
+    {
+        // the tree did not go through load(): keep the descriptor-by-descriptor path
+        return quantize(features);
+    }
+
+    const Eigen::Index dimension = centersLookup_.rows();
+
+    // dense float copy of the descriptors, one column per descriptor
+    Eigen::MatrixXf descriptors(dimension, nbDescriptors);
+    for (std::size_t j = 0; j < nbDescriptors; ++j)
+        for (Eigen::Index d = 0; d < dimension; ++d)
+            descriptors(d, j) = static_cast<float>(features[j][d]);
+
+    std::vector<int32_t> nodeIndices(nbDescriptors, -1);  // virtual "root" index, which has no associated center.
+    std::vector<uint32_t> order(nbDescriptors);
+    std::iota(order.begin(), order.end(), 0);
+
+    for (unsigned level = 0; level < levels_; ++level)
+    {
+        // group the descriptors sitting in the same node into contiguous runs of 'order'
+        std::stable_sort(order.begin(), order.end(), [&nodeIndices](uint32_t a, uint32_t b) { return nodeIndices[a] < nodeIndices[b]; });
+
+        std::vector<std::pair<std::size_t, std::size_t>> groups;
+        for (std::size_t begin = 0; begin < nbDescriptors;)
+        {
+            std::size_t end = begin + 1;
+            while (end < nbDescriptors && nodeIndices[order[end]] == nodeIndices[order[begin]])
+                ++end;
+            groups.emplace_back(begin, end);
+            begin = end;
+        }
+
+#pragma omp parallel for schedule(dynamic)
+        for (ptrdiff_t g = 0; g < static_cast<ptrdiff_t>(groups.size()); ++g)
+        {
+            const std::size_t begin = groups[g].first;
+            const std::size_t end = groups[g].second;
+            const std::size_t groupSize = end - begin;
+
+            // Calculate the offset to the first child of the current node.
+            const int32_t firstChild = (nodeIndices[order[begin]] + 1) * static_cast<int32_t>(splits());
+
+            int32_t nbChildren = 0;
+            while (nbChildren < static_cast<int32_t>(splits()) && valid_centers_[firstChild + nbChildren])
+                ++nbChildren;
+
+            if (nbChildren == 0)
+            {
+                // no valid child: fall through to the first one, as the scalar quantize() does
+                for (std::size_t i = begin; i < end; ++i)
+                    nodeIndices[order[i]] = firstChild;
+                continue;
+            }
+
+            // gather the group descriptors and compute their scores against the children
+            // with a single matrix product; as |d - c|^2 = |d|^2 - 2 d.c + |c|^2 and |d|^2
+            // is constant per descriptor, the closest child minimizes |c|^2 - 2 d.c
+            Eigen::MatrixXf block(dimension, groupSize);
+            for (std::size_t i = 0; i < groupSize; ++i)
+                block.col(i) = descriptors.col(order[begin + i]);
+
+            const Eigen::MatrixXf scores = block.transpose() * centersLookup_.middleCols(firstChild, nbChildren);
+
+            for (std::size_t i = 0; i < groupSize; ++i)
+            {
+                int32_t bestChild = 0;
+                float bestDistance = std::numeric_limits<float>::max();
+                for (int32_t child = 0; child < nbChildren; ++child)
+                {
+                    const float childDistance = centersSqNorm_[firstChild + child] - 2.f * scores(i, child);
+                    if (childDistance < bestDistance)
+                    {
+                        bestChild = child;
+                        bestDistance = childDistance;
+                    }
+                }
+                nodeIndices[order[begin + i]] = firstChild + bestChild;
+            }
+        }
+    }
+
+    for (std::size_t j = 0; j < nbDescriptors; ++j)
+        imgVisualWords[j] = nodeIndices[j] - word_start_;
+
+    return imgVisualWords;
+}
+
+template<class Feature, template<typename, typename> class Distance>
+template<class DescriptorT, class AllocatorT>
+SparseHistogram VocabularyTree<Feature, Distance>::quantizeToSparse(const std::vector<DescriptorT, AllocatorT>& features) const
 {
     SparseHistogram histo;
-    std::vector<Word> doc = quantize(features);
+    std::vector<Word> doc = quantizeBatched(features);
     computeSparseHistogram(doc, histo);
     return histo;
 }
@@ -267,6 +389,8 @@ void VocabularyTree<Feature, Distance>::clear()
 {
     centers_.clear();
     valid_centers_.clear();
+    centersLookup_.resize(0, 0);
+    centersSqNorm_.resize(0);
     k_ = levels_ = num_words_ = word_start_ = 0;
 }
 
@@ -313,6 +437,24 @@ void VocabularyTree<Feature, Distance>::load(const std::string& file)
 
     setNodeCounts();
     assert(size == num_words_ + word_start_);
+
+    buildCentersLookup();
+}
+
+template<class Feature, template<typename, typename> class Distance>
+void VocabularyTree<Feature, Distance>::buildCentersLookup()
+{
+    const std::size_t dimension = centers_.empty() ? 0 : centers_.front().size();
+
+    centersLookup_.resize(dimension, centers_.size());
+    centersSqNorm_.resize(centers_.size());
+
+    for (std::size_t i = 0; i < centers_.size(); ++i)
+    {
+        for (std::size_t d = 0; d < dimension; ++d)
+            centersLookup_(d, i) = static_cast<float>(centers_[i][d]);
+        centersSqNorm_[i] = centersLookup_.col(i).squaredNorm();
+    }
 }
 
 template<class Feature, template<typename, typename> class Distance>
@@ -351,6 +493,11 @@ inline std::unique_ptr<IVocabularyTree> createVoctreeForDescriberType(feature::E
         case EImageDescriberType::SIFT:
             res.reset(new VocabularyTree<SIFT_Regions::DescriptorT>);
             break;
+#if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_POPSIFT)
+        case EImageDescriberType::SIFT_GPU:
+            res.reset(new VocabularyTree<SIFT_Regions::DescriptorT>);
+            break;
+#endif  // ALICEVISION_HAVE_POPSIFT
         case EImageDescriberType::SIFT_FLOAT:
             res.reset(new VocabularyTree<SIFT_Float_Regions::DescriptorT>);
             break;
@@ -27,7 +27,9 @@ struct L2
     result_type operator()(const DescriptorA& a, const DescriptorB& b) const
     {
         result_type result = result_type(0);
-        for (std::size_t i = 0; i < a.size(); ++i)
+        const std::size_t size = a.size();
+#pragma omp simd reduction(+ : result)
+        for (std::size_t i = 0; i < size; ++i)
         {
             result_type diff = (result_type)a[i] - (result_type)b[i];
             result += diff * diff;
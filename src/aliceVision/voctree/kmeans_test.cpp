@@ -215,6 +215,72 @@ BOOST_AUTO_TEST_CASE(kmeanSimple)
     }
 }
 
+BOOST_AUTO_TEST_CASE(kmeanMiniBatch)
+{
+    using namespace aliceVision;
+
+    ALICEVISION_LOG_DEBUG("Testing mini-batch kmeans...");
+
+    makeRandomOperationsReproducible();
+
+    const std::size_t DIMENSION = 8;
+    const std::size_t FEATURENUMBER = 500;
+
+    const std::size_t K = 30;
+
+    const std::size_t STEP = 5 * K;
+
+    typedef Eigen::Matrix<float, 1, DIMENSION> FeatureFloat;
+    typedef std::vector<FeatureFloat> FeatureFloatVector;
+
+    FeatureFloatVector features;
+    FeatureFloatVector centers;
+    FeatureFloatVector centersGT;
+    std::vector<unsigned int> membership;
+
+    voctree::SimpleKmeans<FeatureFloat> kmeans(FeatureFloat::Zero());
+    kmeans.setVerbose(0);
+    kmeans.setRestarts(3);
+    // a batch much smaller than the input so that the mini-batch path is taken
+    kmeans.setMiniBatchSize(1000);
+
+    features.reserve(FEATURENUMBER * K);
+    membership.reserve(features.size());
+    centersGT.reserve(K);
+    centers.reserve(K);
+
+    // generate k clusters well far away from each other
+    for (std::size_t i = 0; i < K; ++i)
+    {
+        // at each i iteration translate the cluster by STEP*i
+        for (std::size_t j = 0; j < FEATURENUMBER; ++j)
+        {
+            features.push_back((FeatureFloat::Random(1, DIMENSION) + Eigen::MatrixXf::Constant(1, DIMENSION, STEP * i) -
+                                Eigen::MatrixXf::Constant(1, DIMENSION, STEP * (K - 1) / 2)) /
+                               ((STEP * (K - 1) / 2) * sqrt(DIMENSION)));
+            BOOST_CHECK(voctree::checkElements(features[j], "init"));
+        }
+        centersGT.push_back((Eigen::MatrixXf::Constant(1, DIMENSION, STEP * i) - Eigen::MatrixXf::Constant(1, DIMENSION, STEP * (K - 1) / 2)) /
+                            ((STEP * (K - 1) / 2) * sqrt(DIMENSION)));
+    }
+
+    kmeans.cluster(features, K, centers, membership);
+
+    BOOST_CHECK(voctree::checkVectorElements(centers, "minibatch"));
+
+    // with well separated clusters the mini-batch iterations must still recover
+    // the exact partition
+    std::vector<unsigned int> h(K, 0);
+    for (std::size_t i = 0; i < membership.size(); ++i)
+    {
+        ++h[membership[i]];
+    }
+    for (std::size_t i = 0; i < h.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(h[i], FEATURENUMBER);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(kmeanVarying)
 {
     using namespace aliceVision;
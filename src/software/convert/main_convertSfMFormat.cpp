@@ -47,6 +47,7 @@ int aliceVision_main(int argc, char** argv)
     bool flagIntrinsics = true;
     bool flagExtrinsics = true;
     bool flagStructure = true;
+    bool flagStructureAsBinary = false;
     bool flagObservations = true;
 
     // clang-format off
@@ -72,6 +73,9 @@ int aliceVision_main(int argc, char** argv)
          "Export extrinsics.")
         ("structure", po::value<bool>(&flagStructure)->default_value(flagStructure),
          "Export structure.")
+        ("structureAsBinary", po::value<bool>(&flagStructureAsBinary)->default_value(flagStructureAsBinary),
+         "Export the structure into a binary sidecar file next to the output file (json/sfm only), "
+         "to keep large scenes fast to read and write.")
         ("observations", po::value<bool>(&flagObservations)->default_value(flagObservations),
          "Export observations.");
     // clang-format on
@@ -91,7 +95,8 @@ int aliceVision_main(int argc, char** argv)
     }
 
     int flags = (flagViews ? sfmDataIO::VIEWS : 0) | (flagIntrinsics ? sfmDataIO::INTRINSICS : 0) | (flagExtrinsics ? sfmDataIO::EXTRINSICS : 0) |
-                (flagObservations ? sfmDataIO::OBSERVATIONS_WITH_FEATURES : 0) | (flagStructure ? sfmDataIO::STRUCTURE : 0);
+                (flagObservations ? sfmDataIO::OBSERVATIONS_WITH_FEATURES : 0) | (flagStructure ? sfmDataIO::STRUCTURE : 0) |
+                (flagStructureAsBinary ? sfmDataIO::STRUCTURE_AS_BINARY : 0);
 
     flags = (flags) ? flags : sfmDataIO::ALL;
 
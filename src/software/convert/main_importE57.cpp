@@ -319,7 +319,7 @@ int aliceVision_main(int argc, char** argv)
     // Now regroup cells as much as we can
     octree.regroup(maxPointsPerBlock);
 
-    std::vector<fuseCut::SimpleNode::ptr> list;
+    std::vector<fuseCut::SimpleNode::NodeIndex> list;
     octree.visit(list);
 
     ALICEVISION_LOG_INFO("Generating " << list.size() << "sub regions");
@@ -328,10 +328,10 @@ int aliceVision_main(int argc, char** argv)
 
     for (int id = 0; id < list.size(); id++)
     {
-        const auto& item = list[id];
+        const fuseCut::SimpleNode::NodeIndex item = list[id];
 
-        Eigen::Vector3d bbmin = item->getBBMin();
-        Eigen::Vector3d bbmax = item->getBBMax();
+        Eigen::Vector3d bbmin = octree.getBBMin(item);
+        Eigen::Vector3d bbmax = octree.getBBMax(item);
 
         // Add borders of 20 cm
         Eigen::Vector3d center = (bbmin + bbmax) * 0.5;
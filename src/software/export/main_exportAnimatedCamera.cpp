@@ -290,66 +290,99 @@ int aliceVision_main(int argc, char** argv)
 
     ALICEVISION_LOG_INFO("Build animated camera(s)...");
 
-    image::Image<image::RGBfColor> image, image_ud;
-    auto progressDisplay = system::createConsoleProgressDisplay(sfmDataExport.getViews().size(), std::cout);
-
-    for (const auto& viewPair : sfmDataExport.getViews())
+    // Undistort camera images
+    if (undistortedImages)
     {
-        const sfmData::View& view = *(viewPair.second);
+        // Precompute the undistortion map of each intrinsic once (over the full RoD if requested),
+        // so that the distortion model is not re-evaluated for every frame sharing the same camera
+        std::map<IndexT, image::Image<Vec2f>> undistortionMapForIntrinsic;
+        for (const auto& intrinsicPair : sfmDataExport.getIntrinsics())
+        {
+            const camera::IntrinsicBase* cam = intrinsicPair.second.get();
 
-        ++progressDisplay;
+            if (!(cam->isValid() && cam->hasDistortion()))
+                continue;
 
-        const std::string imagePathStem = fs::path(viewPair.second->getImage().getImagePath()).stem().string();
+            oiio::ROI rod;
+            if (exportFullROD)
+            {
+                rod = computeRod(cam, correctPrincipalPoint);
+                roiForIntrinsic[intrinsicPair.first] = rod;
+                ALICEVISION_LOG_DEBUG("rod:" + std::to_string(rod.xbegin) + ";" + std::to_string(rod.xend) + ";" + std::to_string(rod.ybegin) + ";" +
+                                      std::to_string(rod.yend));
+            }
+            camera::computeUndistortionMap(cam, undistortionMapForIntrinsic[intrinsicPair.first], correctPrincipalPoint, rod);
+        }
+
+        std::vector<const sfmData::View*> exportViews;
+        exportViews.reserve(sfmDataExport.getViews().size());
+        for (const auto& viewPair : sfmDataExport.getViews())
+            exportViews.push_back(viewPair.second.get());
+
+        auto progressDisplay = system::createConsoleProgressDisplay(exportViews.size(), std::cout);
+        bool undistortFailed = false;
 
-        // Undistort camera images
-        if (undistortedImages)
+// Several frames in flight, so that decode, remapping and encode overlap
+#pragma omp parallel for num_threads(3)
+        for (int i = 0; i < static_cast<int>(exportViews.size()); ++i)
         {
+            const sfmData::View& view = *exportViews[i];
+            const std::string imagePathStem = fs::path(view.getImage().getImagePath()).stem().string();
+
             sfmData::Intrinsics::const_iterator iterIntrinsic = sfmDataExport.getIntrinsics().find(view.getIntrinsicId());
             const std::string dstImage = (undistortedImagesFolderPath / (std::to_string(view.getIntrinsicId()) + "_" + imagePathStem + "." +
                                                                          image::EImageFileType_enumToString(outputFileType)))
                                            .string();
             const camera::IntrinsicBase* cam = iterIntrinsic->second.get();
 
-            image::readImage(view.getImage().getImagePath(), image, image::EImageColorSpace::LINEAR);
-            oiio::ParamValueList metadata = image::readImageMetadata(view.getImage().getImagePath());
-
-            if (cam->isValid() && cam->hasDistortion())
+            try
             {
-                // Undistort the image and save it
-                if (exportFullROD)
+                image::Image<image::RGBfColor> image, image_ud;
+                image::readImage(view.getImage().getImagePath(), image, image::EImageColorSpace::LINEAR);
+                oiio::ParamValueList metadata = image::readImageMetadata(view.getImage().getImagePath());
+
+                if (cam->isValid() && cam->hasDistortion())
                 {
-                    // Build a ROI
-                    const IndexT key = view.getIntrinsicId();
-                    oiio::ROI rod;
-                    const camera::IntrinsicBase& intrinsic = (*cam);
-                    if (roiForIntrinsic.find(key) == roiForIntrinsic.end())
+                    // Undistort the image through the shared map and save it
+                    camera::UndistortImage(image, undistortionMapForIntrinsic.at(view.getIntrinsicId()), image_ud, image::FBLACK);
+
+                    if (exportFullROD)
                     {
-                        rod = computeRod(cam, correctPrincipalPoint);
-                        roiForIntrinsic[key] = rod;
+                        const oiio::ROI roi = convertRodToRoi(cam, roiForIntrinsic.at(view.getIntrinsicId()));
+                        writeImage(dstImage, image_ud, image::ImageWriteOptions(), oiio::ParamValueList(), roi);
                     }
                     else
                     {
-                        rod = roiForIntrinsic[key];
+                        image::writeImage(dstImage, image_ud, image::ImageWriteOptions(), metadata);
                     }
-
-                    ALICEVISION_LOG_DEBUG("rod:" + std::to_string(rod.xbegin) + ";" + std::to_string(rod.xend) + ";" + std::to_string(rod.ybegin) +
-                                          ";" + std::to_string(rod.yend));
-                    camera::UndistortImage(image, cam, image_ud, image::FBLACK, correctPrincipalPoint, rod);
-                    const oiio::ROI roi = convertRodToRoi(cam, rod);
-                    writeImage(dstImage, image_ud, image::ImageWriteOptions(), oiio::ParamValueList(), roi);
                 }
-                else
+                else  // No distortion
                 {
-                    camera::UndistortImage(image, cam, image_ud, image::FBLACK, correctPrincipalPoint);
-                    image::writeImage(dstImage, image_ud, image::ImageWriteOptions(), metadata);
+                    // Copy the image since there is no distortion
+                    image::writeImage(dstImage, image, image::ImageWriteOptions(), metadata);
                 }
             }
-            else  // No distortion
+            catch (const std::exception& e)
             {
-                // Copy the image since there is no distortion
-                image::writeImage(dstImage, image, image::ImageWriteOptions(), metadata);
+                ALICEVISION_LOG_ERROR("Cannot export the undistorted image of the view '" << view.getImage().getImagePath() << "': " << e.what());
+                undistortFailed = true;
             }
+
+            ++progressDisplay;
+        }
+
+        if (undistortFailed)
+        {
+            ALICEVISION_LOG_ERROR("Failed to export the undistorted images.");
+            return EXIT_FAILURE;
         }
+    }
+
+    for (const auto& viewPair : sfmDataExport.getViews())
+    {
+        const sfmData::View& view = *(viewPair.second);
+
+        const std::string imagePathStem = fs::path(viewPair.second->getImage().getImagePath()).stem().string();
 
         // Pose and intrinsic defined
         // Note: we use "sfmData" and not "sfmDataExport" to have access to poses
@@ -0,0 +1,840 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2024 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <aliceVision/image/all.hpp>
+#include <aliceVision/image/io.hpp>
+#include <aliceVision/image/ImageCache.hpp>
+#include <aliceVision/system/Logger.hpp>
+#include <aliceVision/cmdline/cmdline.hpp>
+#include <aliceVision/system/main.hpp>
+#include <OpenImageIO/imageio.h>
+#include <OpenImageIO/imagebufalgo.h>
+
+// SFMData
+#include <aliceVision/sfmData/SfMData.hpp>
+#include <aliceVision/sfmDataIO/sfmDataIO.hpp>
+
+// HDR Related
+#include <aliceVision/hdr/rgbCurve.hpp>
+#include <aliceVision/hdr/hdrMerge.hpp>
+#include <aliceVision/hdr/DebevecCalibrate.hpp>
+#include <aliceVision/hdr/GrossbergCalibrate.hpp>
+#include <aliceVision/hdr/emorCurve.hpp>
+#include <aliceVision/hdr/LaguerreBACalibration.hpp>
+#include <aliceVision/hdr/sampling.hpp>
+#include <aliceVision/hdr/brackets.hpp>
+
+// Command line parameters
+#include <boost/algorithm/string.hpp>
+#include <boost/program_options.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <sstream>
+
+// These constants define the current software version.
+// They must be updated when the command line is changed.
+#define ALICEVISION_SOFTWARE_VERSION_MAJOR 1
+#define ALICEVISION_SOFTWARE_VERSION_MINOR 0
+
+using namespace aliceVision;
+using namespace aliceVision::hdr;
+
+namespace po = boost::program_options;
+namespace fs = std::filesystem;
+
+std::string getHdrImagePath(const std::string& outputPath, std::size_t g, const std::string& rootname = "")
+{
+    // Output image file path
+    std::stringstream sstream;
+    if (rootname == "")
+    {
+        sstream << "hdr_" << std::setfill('0') << std::setw(4) << g << ".exr";
+    }
+    else
+    {
+        sstream << rootname << ".exr";
+    }
+    const std::string hdrImagePath = (fs::path(outputPath) / sstream.str()).string();
+    return hdrImagePath;
+}
+
+std::string getHdrMaskPath(const std::string& outputPath, std::size_t g, const std::string& maskname, const std::string& rootname = "")
+{
+    // Output image file path
+    std::stringstream sstream;
+    if (rootname == "")
+    {
+        sstream << "hdrMask_" << maskname << "_" << std::setfill('0') << std::setw(4) << g << ".exr";
+    }
+    else
+    {
+        sstream << rootname << "_" << maskname << ".exr";
+    }
+    const std::string hdrImagePath = (fs::path(outputPath) / sstream.str()).string();
+    return hdrImagePath;
+}
+
+struct luminanceInfo
+{
+    double exposure = 0.0;
+    double meanLum = 0.0;
+    double minLum = 1e6;
+    double maxLum = 0.0;
+    int itemNb = 0;
+
+    luminanceInfo() = default;
+};
+
+void computeLuminanceStatFromSamples(const std::vector<hdr::ImageSample>& samples, std::map<int, luminanceInfo>& luminanceInfos)
+{
+    luminanceInfo lumaInfo;
+    luminanceInfos.clear();
+
+    for (int i = 0; i < samples.size(); i++)
+    {
+        for (int j = 0; j < samples[i].descriptions.size(); j++)
+        {
+            const IndexT key = samples[i].descriptions[j].srcId;
+
+            const double lum =
+              image::Rgb2GrayLinear(samples[i].descriptions[j].mean[0], samples[i].descriptions[j].mean[1], samples[i].descriptions[j].mean[2]);
+
+            if (luminanceInfos.find(key) == luminanceInfos.end())
+            {
+                luminanceInfos[key] = lumaInfo;
+                luminanceInfos[key].exposure = samples[i].descriptions[j].exposure;
+            }
+
+            luminanceInfos[key].meanLum += lum;
+            luminanceInfos[key].itemNb++;
+            if (lum < luminanceInfos[key].minLum)
+            {
+                luminanceInfos[key].minLum = lum;
+            }
+            if (lum > luminanceInfos[key].maxLum)
+            {
+                luminanceInfos[key].maxLum = lum;
+            }
+        }
+    }
+}
+
+int aliceVision_main(int argc, char** argv)
+{
+    std::string sfmInputDataFilename;
+    std::string sfmOutputDataFilepath;
+    ECalibrationMethod calibrationMethod = ECalibrationMethod::AUTO;
+    std::string calibrationWeightFunction = "default";
+    int nbBrackets = 0;
+    bool byPass = false;
+    bool keepSourceImageName = false;
+    int channelQuantizationPower = 10;
+    image::EImageColorSpace workingColorSpace = image::EImageColorSpace::AUTO;
+    hdr::Sampling::Params samplingParams;
+    std::size_t maxTotalPoints = 1000000;
+    int offsetRefBracketIndex = 1000;  // By default, use the automatic selection
+    double meanTargetedLumaForMerging = 0.4;
+    double minSignificantValue = 0.05;
+    double maxSignificantValue = 0.995;
+    bool computeLightMasks = false;
+    double imageCacheCapacityGB = 16.0;
+
+    hdr::EFunctionType fusionWeightFunction = hdr::EFunctionType::GAUSSIAN;
+    float highlightCorrectionFactor = 0.0f;
+    float highlightTargetLux = 120000.0f;
+
+    image::EStorageDataType storageDataType = image::EStorageDataType::Float;
+
+    // Command line parameters
+    // clang-format off
+    po::options_description requiredParams("Required parameters");
+    requiredParams.add_options()
+        ("input,i", po::value<std::string>(&sfmInputDataFilename)->required(),
+         "SfMData file input.")
+        ("outSfMData,o", po::value<std::string>(&sfmOutputDataFilepath)->required(),
+         "SfMData file output.");
+
+    po::options_description optionalParams("Optional parameters");
+    optionalParams.add_options()
+        ("nbBrackets,b", po::value<int>(&nbBrackets)->default_value(nbBrackets),
+         "Bracket count per HDR image (0 means automatic).")
+        ("byPass", po::value<bool>(&byPass)->default_value(byPass),
+         "Bypass HDR creation and use a single bracket as the input for the next steps.")
+        ("keepSourceImageName", po::value<bool>(&keepSourceImageName)->default_value(keepSourceImageName),
+         "Use the filename of the input image selected as the central image for the output image filename.")
+        ("calibrationMethod,m", po::value<ECalibrationMethod>(&calibrationMethod)->default_value(calibrationMethod),
+         "Name of the method used for the camera calibration: auto, linear, debevec, grossberg, laguerre."
+         "If 'auto' is selected, the linear method will be used if there are RAW images; otherwise, the Debevec method "
+         "will be used.")
+        ("calibrationWeight,w", po::value<std::string>(&calibrationWeightFunction)->default_value(calibrationWeightFunction),
+         "Weight function used to calibrate the camera response (default depends on the calibration method, gaussian, "
+         "triangle, plateau).")
+        ("channelQuantizationPower", po::value<int>(&channelQuantizationPower)->default_value(channelQuantizationPower),
+         "Quantization level like 8 bits or 10 bits.")
+        ("workingColorSpace", po::value<image::EImageColorSpace>(&workingColorSpace)->default_value(workingColorSpace),
+         ("Working color space: " + image::EImageColorSpace_informations()).c_str())
+        ("blockSize", po::value<int>(&samplingParams.blockSize)->default_value(samplingParams.blockSize),
+         "Size of the image tile to extract a sample.")
+        ("radius", po::value<int>(&samplingParams.radius)->default_value(samplingParams.radius),
+         "Radius of the patch used to analyze the sample statistics.")
+        ("maxCountSample", po::value<std::size_t>(&samplingParams.maxCountSample)->default_value(samplingParams.maxCountSample),
+         "Maximum number of samples per image group.")
+        ("maxTotalPoints", po::value<std::size_t>(&maxTotalPoints)->default_value(maxTotalPoints),
+         "Maximum number of points used from the sampling. This ensures that the number of pixels values extracted by "
+         "the sampling can be managed by the calibration step (in terms of computation time and memory usage).")
+        ("fusionWeight,W", po::value<hdr::EFunctionType>(&fusionWeightFunction)->default_value(fusionWeightFunction),
+         "Weight function used to fuse all the LDR images together (gaussian, triangle, plateau).")
+        ("offsetRefBracketIndex", po::value<int>(&offsetRefBracketIndex)->default_value(offsetRefBracketIndex),
+         "Zero to use the center bracket. +N to use a more exposed bracket or -N to use a less exposed bracket.")
+        ("meanTargetedLumaForMerging", po::value<double>(&meanTargetedLumaForMerging)->default_value(meanTargetedLumaForMerging),
+         "Mean expected luminance after merging step when the input LDR images are decoded in the sRGB color space. "
+         "Must be in the range [0, 1].")
+        ("minSignificantValue", po::value<double>(&minSignificantValue)->default_value(minSignificantValue),
+         "Minimum channel input value to be considered in advanced pixelwise merging. "
+         "Used in advanced pixelwise merging.")
+        ("maxSignificantValue", po::value<double>(&maxSignificantValue)->default_value(maxSignificantValue),
+         "Maximum channel input value to be considered in advanced pixelwise merging. "
+         "Used in advanced pixelwise merging.")
+        ("computeLightMasks", po::value<bool>(&computeLightMasks)->default_value(computeLightMasks),
+         "Compute masks of dark and high lights and missing mid lights info.")
+        ("highlightTargetLux", po::value<float>(&highlightTargetLux)->default_value(highlightTargetLux),
+         "Highlights maximum luminance.")
+        ("highlightCorrectionFactor", po::value<float>(&highlightCorrectionFactor)->default_value(highlightCorrectionFactor),
+         "Float value between 0 and 1 to correct clamped highlights in dynamic range: use 0 for no correction, 1 for "
+         "full correction to maxLuminance.")
+        ("storageDataType", po::value<image::EStorageDataType>(&storageDataType)->default_value(storageDataType),
+         ("Storage data type: " + image::EStorageDataType_informations()).c_str())
+        ("imageCacheCapacityGB", po::value<double>(&imageCacheCapacityGB)->default_value(imageCacheCapacityGB),
+         "Capacity of the in-memory image cache shared by the sampling and merging steps (GB). "
+         "When all the brackets fit in the cache, each input image is decoded from disk only once.");
+    // clang-format on
+
+    CmdLine cmdline("This program samples the LDR images, calibrates the camera response and merges the LDR images into HDR images "
+                    "in a single process, so that each input image is decoded once instead of once per step.\n"
+                    "AliceVision LdrToHdr");
+
+    cmdline.add(requiredParams);
+    cmdline.add(optionalParams);
+    if (!cmdline.execute(argc, argv))
+    {
+        return EXIT_FAILURE;
+    }
+
+    // Set maxThreads
+    HardwareContext hwc = cmdline.getHardwareContext();
+    omp_set_num_threads(hwc.getMaxThreads());
+
+    // Analyze path
+    fs::path path(sfmOutputDataFilepath);
+    std::string outputPath = path.parent_path().string();
+
+    // Read SfMData
+    sfmData::SfMData sfmData;
+    if (!sfmDataIO::load(sfmData, sfmInputDataFilename, sfmDataIO::ESfMData::ALL))
+    {
+        ALICEVISION_LOG_ERROR("The input SfMData file '" << sfmInputDataFilename << "' cannot be read.");
+        return EXIT_FAILURE;
+    }
+    // Check input compatibility with brackets
+    const int countImages = sfmData.getViews().size();
+    if (countImages == 0)
+    {
+        ALICEVISION_LOG_ERROR("The input SfMData contains no image.");
+        return EXIT_FAILURE;
+    }
+    if (channelQuantizationPower <= 0)
+    {
+        ALICEVISION_LOG_ERROR("Invalid channelQuantizationPower configuration.");
+        return EXIT_FAILURE;
+    }
+    if (nbBrackets < 0)
+    {
+        ALICEVISION_LOG_ERROR("Invalid nbBrackets config.");
+        return EXIT_FAILURE;
+    }
+    if (nbBrackets == 1 && !byPass)
+    {
+        ALICEVISION_LOG_WARNING("Enable bypass as there is only one input bracket.");
+        byPass = true;
+    }
+
+    const std::size_t channelQuantization = std::pow(2, channelQuantizationPower);
+
+    // Estimate groups
+    std::vector<std::vector<std::shared_ptr<sfmData::View>>> groupedViews;
+    if (!hdr::estimateBracketsFromSfmData(groupedViews, sfmData, nbBrackets))
+    {
+        ALICEVISION_LOG_ERROR("Failure to estimate brackets.");
+        return EXIT_FAILURE;
+    }
+
+    // Check groups
+    std::size_t usedNbBrackets;
+    {
+        std::set<std::size_t> sizeOfGroups;
+        for (auto& group : groupedViews)
+        {
+            sizeOfGroups.insert(group.size());
+        }
+        if (sizeOfGroups.size() == 1)
+        {
+            usedNbBrackets = *sizeOfGroups.begin();
+            if (usedNbBrackets == 1)
+            {
+                ALICEVISION_LOG_INFO("No multi-bracketing.");
+            }
+            ALICEVISION_LOG_INFO("Number of brackets automatically detected: " << usedNbBrackets << ". It will generate " << groupedViews.size()
+                                                                               << " HDR images.");
+        }
+        else
+        {
+            ALICEVISION_LOG_ERROR("Exposure groups do not have a consistent number of brackets.");
+            return EXIT_FAILURE;
+        }
+    }
+    if (usedNbBrackets == 1 && !byPass)
+    {
+        ALICEVISION_LOG_WARNING("Enable bypass as there is only one input bracket.");
+        byPass = true;
+    }
+
+    // Group all groups sharing the same intrinsic
+    std::map<IndexT, std::vector<std::vector<std::shared_ptr<sfmData::View>>>> groupedViewsPerIntrinsics;
+    for (const auto& group : groupedViews)
+    {
+        IndexT intrinsicId = UndefinedIndexT;
+
+        for (const auto& v : group)
+        {
+            IndexT lid = v->getIntrinsicId();
+            if (intrinsicId == UndefinedIndexT)
+            {
+                intrinsicId = lid;
+            }
+
+            if (lid != intrinsicId)
+            {
+                ALICEVISION_LOG_INFO("One group shall not have multiple intrinsics.");
+                return EXIT_FAILURE;
+            }
+        }
+
+        if (intrinsicId == UndefinedIndexT)
+        {
+            ALICEVISION_LOG_INFO("One group has no intrinsics.");
+            return EXIT_FAILURE;
+        }
+
+        groupedViewsPerIntrinsics[intrinsicId].push_back(group);
+    }
+
+    const bool isRAW = image::isRawFormat(groupedViews[0][0]->getImage().getImagePath());
+
+    // Estimate the calibration method if set to AUTO
+    if (calibrationMethod == ECalibrationMethod::AUTO)
+    {
+        calibrationMethod = isRAW ? ECalibrationMethod::LINEAR : ECalibrationMethod::DEBEVEC;
+        ALICEVISION_LOG_INFO("Calibration method automatically set to " << calibrationMethod << ".");
+    }
+
+    // Estimate working color space if set to AUTO
+    if (workingColorSpace == image::EImageColorSpace::AUTO)
+    {
+        workingColorSpace = isRAW ? image::EImageColorSpace::LINEAR : image::EImageColorSpace::SRGB;
+        ALICEVISION_LOG_INFO("Working color space automatically set to " << workingColorSpace << ".");
+    }
+
+    // Fusion always produces linear image. sRGB is the only non linear color space that must be changed to linear (sRGB
+    // linear).
+    image::EImageColorSpace mergedColorSpace =
+      (workingColorSpace == image::EImageColorSpace::SRGB) ? image::EImageColorSpace::LINEAR : workingColorSpace;
+
+    // All the images go through one shared cache, so the reading options are global.
+    // They are taken from the first view, which is the expected case of a single camera setup.
+    image::ImageReadOptions imgReadOptions;
+    imgReadOptions.workingColorSpace = workingColorSpace;
+    imgReadOptions.rawColorInterpretation =
+      image::ERawColorInterpretation_stringToEnum(groupedViews[0][0]->getImage().getRawColorInterpretation());
+    imgReadOptions.colorProfileFileName = groupedViews[0][0]->getImage().getColorProfileFileName();
+
+    // Whatever the raw color interpretation mode, the default read processing for raw images is to apply
+    // white balancing in libRaw, before demosaicing.
+    // The DcpMetadata mode allows to not apply color management after demosaicing.
+    // Because if requested after demosaicing, white balancing is done at color management stage, we can
+    // set this option to true to get real raw data, without any white balancing, when the DcpMetadata mode
+    // is selected.
+    if (imgReadOptions.rawColorInterpretation == image::ERawColorInterpretation::DcpMetadata)
+    {
+        imgReadOptions.doWBAfterDemosaicing = true;
+    }
+
+    for (const auto& group : groupedViews)
+    {
+        for (const auto& v : group)
+        {
+            if (image::ERawColorInterpretation_stringToEnum(v->getImage().getRawColorInterpretation()) != imgReadOptions.rawColorInterpretation ||
+                v->getImage().getColorProfileFileName() != imgReadOptions.colorProfileFileName)
+            {
+                ALICEVISION_LOG_WARNING("The views do not share the same raw decoding options. "
+                                        "The options of the first view are used for all the images.");
+            }
+        }
+    }
+
+    // Shared image cache: the brackets decoded during the sampling step are served from memory
+    // to the merging step as long as they fit in the capacity.
+    const float cacheCapacityMiB = float(imageCacheCapacityGB * 1024.0);
+    image::ImageCache imageCache(cacheCapacityMiB, 2.f * cacheCapacityMiB, imgReadOptions);
+
+    // Sampling and calibration per intrinsic
+    std::map<IndexT, hdr::rgbCurve> responsePerIntrinsic;
+    if (!byPass)
+    {
+        for (const auto& pGroups : groupedViewsPerIntrinsics)
+        {
+            const IndexT intrinsicId = pGroups.first;
+            const auto& groups = pGroups.second;
+
+            const auto& intrinsic = sfmData.getIntrinsics().at(intrinsicId);
+            const std::size_t width = intrinsic->w();
+            const std::size_t height = intrinsic->h();
+
+            std::vector<std::vector<hdr::ImageSample>> samplesPerGroup(groups.size());
+            std::vector<std::vector<double>> groupedExposures;
+            std::vector<std::map<int, luminanceInfo>> v_luminanceInfos;
+
+            // Extract samples from each group, keeping the decoded brackets in the cache
+            for (std::size_t g = 0; g < groups.size(); ++g)
+            {
+                const auto& group = groups[g];
+
+                std::vector<std::string> paths;
+                std::vector<IndexT> viewIds;
+                std::vector<sfmData::ExposureSetting> exposuresSetting;
+
+                for (const auto& v : group)
+                {
+                    paths.push_back(v->getImage().getImagePath());
+                    viewIds.push_back(v->getViewId());
+                    exposuresSetting.push_back(v->getImage().getCameraExposureSetting());
+                }
+                if (!sfmData::hasComparableExposures(exposuresSetting))
+                {
+                    ALICEVISION_THROW_ERROR("Camera exposure settings are inconsistent.");
+                }
+                const std::vector<double> exposures = getExposures(exposuresSetting);
+
+                std::vector<std::shared_ptr<image::Image<image::RGBfColor>>> images;
+                for (const std::string& p : paths)
+                {
+                    ALICEVISION_LOG_INFO("Load " << p);
+                    images.push_back(imageCache.get<image::RGBfColor>(p));
+                }
+
+                const bool simplifiedSampling = (calibrationMethod == ECalibrationMethod::LINEAR);
+                if (!hdr::Sampling::extractSamplesFromImages(
+                      samplesPerGroup[g], images, viewIds, exposures, width, height, channelQuantization, samplingParams, simplifiedSampling))
+                {
+                    ALICEVISION_LOG_ERROR("Error while extracting samples from group.");
+                }
+
+                groupedExposures.push_back(exposures);
+            }
+
+            // Analyze samples
+            hdr::Sampling sampling;
+            for (std::size_t g = 0; g < groups.size(); ++g)
+            {
+                sampling.analyzeSource(samplesPerGroup[g], channelQuantization, g);
+
+                std::map<int, luminanceInfo> luminanceInfos;
+                computeLuminanceStatFromSamples(samplesPerGroup[g], luminanceInfos);
+
+                // Check that all views in the group have an associated luminance stat info
+                for (const auto& v : groups[g])
+                {
+                    if (luminanceInfos.find(v->getViewId()) == luminanceInfos.end())
+                    {
+                        luminanceInfo lumaInfo;
+                        lumaInfo.exposure = -1.0;  // Dummy exposure used later indicating a dummy info
+                        luminanceInfos[v->getViewId()] = lumaInfo;
+                    }
+                }
+
+                v_luminanceInfos.push_back(luminanceInfos);
+            }
+
+            // We need to trim samples list
+            sampling.filter(maxTotalPoints);
+
+            std::vector<std::vector<hdr::ImageSample>> calibrationSamples;
+            for (std::size_t g = 0; g < groups.size(); ++g)
+            {
+                std::vector<hdr::ImageSample> out_samples;
+                sampling.extractUsefulSamples(out_samples, samplesPerGroup[g], g);
+                calibrationSamples.push_back(out_samples);
+            }
+
+            // Define calibration weighting curve from name
+            hdr::rgbCurve calibrationWeight(channelQuantization);
+            std::string weightFunctionName = calibrationWeightFunction;
+            boost::algorithm::to_lower(weightFunctionName);
+            if (weightFunctionName == "default")
+            {
+                switch (calibrationMethod)
+                {
+                    case ECalibrationMethod::DEBEVEC:
+                        weightFunctionName = hdr::EFunctionType_enumToString(hdr::EFunctionType::TRIANGLE);
+                        break;
+                    case ECalibrationMethod::LINEAR:
+                    case ECalibrationMethod::GROSSBERG:
+                    case ECalibrationMethod::LAGUERRE:
+                    default:
+                        weightFunctionName = hdr::EFunctionType_enumToString(hdr::EFunctionType::GAUSSIAN);
+                        break;
+                }
+            }
+            calibrationWeight.setFunction(hdr::EFunctionType_stringToEnum(weightFunctionName));
+
+            ALICEVISION_LOG_INFO("Start calibration.");
+            hdr::rgbCurve response(channelQuantization);
+
+            switch (calibrationMethod)
+            {
+                case ECalibrationMethod::LINEAR:
+                {
+                    // Set the response function to linear
+                    response.setLinear();
+                    break;
+                }
+                case ECalibrationMethod::DEBEVEC:
+                {
+                    hdr::DebevecCalibrate debevec;
+                    const float lambda = channelQuantization;
+                    bool res = debevec.process(calibrationSamples, groupedExposures, channelQuantization, calibrationWeight, lambda, response);
+                    if (!res)
+                    {
+                        ALICEVISION_LOG_ERROR("Calibration failed.");
+                        return EXIT_FAILURE;
+                    }
+
+                    response.exponential();
+                    response.scale();
+                    break;
+                }
+                case ECalibrationMethod::GROSSBERG:
+                {
+                    hdr::GrossbergCalibrate calibration(5);
+                    calibration.process(calibrationSamples, groupedExposures, channelQuantization, response);
+                    break;
+                }
+                case ECalibrationMethod::LAGUERRE:
+                {
+                    hdr::LaguerreBACalibration calibration;
+                    calibration.process(calibrationSamples, groupedExposures, channelQuantization, false, response);
+                    break;
+                }
+                case ECalibrationMethod::AUTO:
+                {
+                    ALICEVISION_LOG_ERROR("The calibration method cannot be automatically selected.");
+                    return EXIT_FAILURE;
+                }
+            }
+
+            const std::string methodName = ECalibrationMethod_enumToString(calibrationMethod);
+
+            const std::string baseName = (fs::path(outputPath) / std::string("response_")).string();
+            const std::string intrinsicName = baseName + std::to_string(intrinsicId);
+            const std::string htmlName = intrinsicName + "_" + methodName + std::string(".html");
+
+            response.write(intrinsicName + ".csv");
+            response.writeHtml(htmlName, "response");
+
+            responsePerIntrinsic.emplace(intrinsicId, response);
+
+            // Store the luminance statistics, they drive the selection of the target views below
+            const std::string lumastatBasename = "luminanceStatistics";
+            const std::string lumastatFilename = (fs::path(outputPath) / (lumastatBasename + "_" + std::to_string(intrinsicId) + ".txt")).string();
+            std::ofstream file(lumastatFilename);
+            if (!file)
+            {
+                ALICEVISION_LOG_ERROR("Unable to create the file '" << lumastatFilename << "' to store luminance statistics.");
+                return EXIT_FAILURE;
+            }
+
+            file << v_luminanceInfos.size() << std::endl;
+            if (!v_luminanceInfos.empty())
+            {
+                file << v_luminanceInfos[0].size() << std::endl;
+                file << "# viewId ; exposure ; sampleNumber ; meanLuminance ; minLuminance ; maxLuminance" << std::endl;
+
+                for (int i = 0; i < v_luminanceInfos.size(); ++i)
+                {
+                    while (!v_luminanceInfos[i].empty())
+                    {
+                        // search min exposure
+                        IndexT srcIdWithMinimalExposure = UndefinedIndexT;
+                        double exposureMin = 1e9;
+                        for (auto it = v_luminanceInfos[i].begin(); it != v_luminanceInfos[i].end(); it++)
+                        {
+                            if ((it->second).exposure < exposureMin)
+                            {
+                                exposureMin = (it->second).exposure;
+                                srcIdWithMinimalExposure = it->first;
+                            }
+                        }
+                        // write in file
+                        file << srcIdWithMinimalExposure << " ";
+                        file << v_luminanceInfos[i][srcIdWithMinimalExposure].exposure << " " << v_luminanceInfos[i][srcIdWithMinimalExposure].itemNb
+                             << " ";
+                        if (v_luminanceInfos[i][srcIdWithMinimalExposure].itemNb > 0)
+                        {
+                            file << v_luminanceInfos[i][srcIdWithMinimalExposure].meanLum / v_luminanceInfos[i][srcIdWithMinimalExposure].itemNb
+                                 << " ";
+                        }
+                        else
+                        {
+                            file << "0.0 ";
+                        }
+                        file << v_luminanceInfos[i][srcIdWithMinimalExposure].minLum << " " << v_luminanceInfos[i][srcIdWithMinimalExposure].maxLum
+                             << std::endl;
+                        // erase from map
+                        v_luminanceInfos[i].erase(srcIdWithMinimalExposure);
+                    }
+                }
+            }
+        }
+    }
+
+    // Estimate target views for each group
+    std::map<IndexT, std::vector<std::shared_ptr<sfmData::View>>> targetViewsPerIntrinsics;
+    std::map<IndexT, int> targetIndexPerIntrinsics;
+    if (!byPass)
+    {
+        // Adjust the targeted luminance level by removing the corresponding gamma if the working color space is not sRGB.
+        if (workingColorSpace != image::EImageColorSpace::SRGB)
+        {
+            meanTargetedLumaForMerging = std::pow((meanTargetedLumaForMerging + 0.055) / 1.055, 2.2);
+        }
+
+        for (auto& intrinsicGroup : groupedViewsPerIntrinsics)
+        {
+            IndexT intrinsicId = intrinsicGroup.first;
+            std::vector<std::vector<std::shared_ptr<sfmData::View>>>& groups = intrinsicGroup.second;
+            std::vector<std::shared_ptr<sfmData::View>> targetViews;
+
+            const fs::path lumaStatFilepath(fs::path(outputPath) /
+                                            (std::string("luminanceStatistics") + "_" + std::to_string(intrinsicId) + ".txt"));
+
+            targetIndexPerIntrinsics[intrinsicId] =
+              hdr::selectTargetViews(targetViews, groups, offsetRefBracketIndex, lumaStatFilepath.string(), meanTargetedLumaForMerging);
+
+            const int middleIndex = usedNbBrackets / 2;
+            const int targetIndex = middleIndex + offsetRefBracketIndex;
+            const bool isOffsetRefBracketIndexValid = (targetIndex >= 0) && (targetIndex < usedNbBrackets);
+
+            if ((targetViews.empty() || targetViews.size() != groups.size()) && !isOffsetRefBracketIndexValid)
+            {
+                ALICEVISION_LOG_ERROR("File '" << lumaStatFilepath.string()
+                                               << "' is not valid. This file is required "
+                                                  "to select the optimal exposure for the creation of HDR images.");
+                return EXIT_FAILURE;
+            }
+
+            targetViewsPerIntrinsics[intrinsicId] = targetViews;
+        }
+    }
+
+    // Export a new sfmData with HDR images as new Views and LDR images as ancestors
+    // ancestorIds are similar to viewIds because viewIds are computed only from image infos
+    {
+        int pos = 0;
+        sfmData::SfMData outputSfm;
+        outputSfm.getIntrinsics() = sfmData.getIntrinsics();
+
+        for (const auto& pGroups : groupedViewsPerIntrinsics)
+        {
+            IndexT intrinsicId = pGroups.first;
+
+            const auto& groups = pGroups.second;
+            const auto& targetViews = targetViewsPerIntrinsics[intrinsicId];
+
+            for (int g = 0; g < groups.size(); g++, pos++)
+            {
+                std::shared_ptr<sfmData::View> hdrView;
+
+                const auto& group = groups[g];
+
+                if (group.size() == 1)
+                {
+                    hdrView.reset(group.at(0)->clone());
+                }
+                else if (targetViews.empty())
+                {
+                    ALICEVISION_LOG_ERROR("Target view for HDR merging has not been computed.");
+                    return EXIT_FAILURE;
+                }
+                else
+                {
+                    hdrView.reset(targetViews.at(g)->clone());
+                }
+                if (!byPass)
+                {
+                    fs::path p(targetViews[g]->getImage().getImagePath());
+                    const std::string hdrImagePath = getHdrImagePath(outputPath, pos, keepSourceImageName ? p.stem().string() : "");
+                    hdrView->getImage().setImagePath(hdrImagePath);
+                }
+                hdrView->getImage().addMetadata("AliceVision:ColorSpace", image::EImageColorSpace_enumToString(mergedColorSpace));
+                outputSfm.getViews().emplace(hdrView->getViewId(), hdrView);
+
+                for (const auto& v : group)
+                {
+                    outputSfm.addAncestor(v->getViewId(), v->getImageInfo());
+                }
+            }
+        }
+
+        // Export output SfMData
+        if (!sfmDataIO::save(outputSfm, sfmOutputDataFilepath, sfmDataIO::ESfMData::ALL))
+        {
+            ALICEVISION_LOG_ERROR("Cannot save output SfMData file at '" << sfmOutputDataFilepath << "'.");
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (byPass)
+    {
+        ALICEVISION_LOG_INFO("Bypass enabled, nothing to compute.");
+        return EXIT_SUCCESS;
+    }
+
+    // Merge the groups, served from the cache for the brackets which are still in memory
+    int pos = 0;
+    for (const auto& pGroupedViews : groupedViewsPerIntrinsics)
+    {
+        IndexT intrinsicId = pGroupedViews.first;
+
+        const auto& groups = pGroupedViews.second;
+        const auto& targetViews = targetViewsPerIntrinsics.at(intrinsicId);
+
+        hdr::rgbCurve fusionWeight(channelQuantization);
+        fusionWeight.setFunction(fusionWeightFunction);
+
+        const hdr::rgbCurve& response = responsePerIntrinsic.at(intrinsicId);
+
+        for (std::size_t g = 0; g < groups.size(); ++g, ++pos)
+        {
+            const std::vector<std::shared_ptr<sfmData::View>>& group = groups[g];
+
+            std::vector<std::shared_ptr<image::Image<image::RGBfColor>>> images(group.size());
+            std::shared_ptr<sfmData::View> targetView = targetViews[g];
+            std::vector<sfmData::ExposureSetting> exposuresSetting(group.size());
+
+            // Get all images of the group, from the cache when they are still in memory
+            for (std::size_t i = 0; i < group.size(); ++i)
+            {
+                const std::string filepath = group[i]->getImage().getImagePath();
+                ALICEVISION_LOG_INFO("Load " << filepath);
+
+                images[i] = imageCache.get<image::RGBfColor>(filepath);
+
+                exposuresSetting[i] = group[i]->getImage().getCameraExposureSetting();
+            }
+
+            if (!sfmData::hasComparableExposures(exposuresSetting))
+            {
+                ALICEVISION_THROW_ERROR("Camera exposure settings are inconsistent.");
+            }
+
+            std::vector<double> exposures = getExposures(exposuresSetting);
+
+            // Merge HDR images
+            image::Image<image::RGBfColor> HDRimage;
+            image::Image<image::RGBfColor> lowLightMask;
+            image::Image<image::RGBfColor> highLightMask;
+            image::Image<image::RGBfColor> noMidLightMask;
+            if (images.size() > 1)
+            {
+                hdr::hdrMerge merge;
+                sfmData::ExposureSetting targetCameraSetting = targetView->getImage().getCameraExposureSetting();
+                hdr::MergingParams mergingParams;
+                mergingParams.targetCameraExposure = targetCameraSetting.getExposure();
+                mergingParams.refImageIndex = targetIndexPerIntrinsics[intrinsicId];
+                mergingParams.minSignificantValue = minSignificantValue;
+                mergingParams.maxSignificantValue = maxSignificantValue;
+                mergingParams.computeLightMasks = computeLightMasks;
+
+                merge.process(images, exposures, fusionWeight, response, HDRimage, lowLightMask, highLightMask, noMidLightMask, mergingParams);
+                if (highlightCorrectionFactor > 0.0f)
+                {
+                    merge.postProcessHighlight(images,
+                                               exposures,
+                                               fusionWeight,
+                                               response,
+                                               HDRimage,
+                                               targetCameraSetting.getExposure(),
+                                               highlightCorrectionFactor,
+                                               highlightTargetLux);
+                }
+            }
+            else if (images.size() == 1)
+            {
+                // Nothing to do
+                HDRimage = *images[0];
+            }
+
+            fs::path p(targetView->getImage().getImagePath());
+            const std::string hdrImagePath = getHdrImagePath(outputPath, pos, keepSourceImageName ? p.stem().string() : "");
+
+            // Write an image with parameters from the target view
+            std::map<std::string, std::string> viewMetadata = targetView->getImage().getMetadata();
+
+            oiio::ParamValueList targetMetadata;
+            for (const auto& meta : viewMetadata)
+            {
+                if (meta.first.compare(0, 3, "raw") == 0)
+                {
+                    targetMetadata.add_or_replace(oiio::ParamValue("AliceVision:" + meta.first, meta.second));
+                }
+                else
+                {
+                    targetMetadata.add_or_replace(oiio::ParamValue(meta.first, meta.second));
+                }
+            }
+
+            targetMetadata.add_or_replace(oiio::ParamValue("AliceVision:ColorSpace", image::EImageColorSpace_enumToString(mergedColorSpace)));
+
+            image::ImageWriteOptions writeOptions;
+            writeOptions.fromColorSpace(mergedColorSpace);
+            writeOptions.toColorSpace(mergedColorSpace);
+            writeOptions.storageDataType(storageDataType);
+
+            image::writeImage(hdrImagePath, HDRimage, writeOptions, targetMetadata);
+
+            if (computeLightMasks)
+            {
+                const std::string hdrMaskLowLightPath = getHdrMaskPath(outputPath, pos, "lowLight", keepSourceImageName ? p.stem().string() : "");
+                const std::string hdrMaskHighLightPath = getHdrMaskPath(outputPath, pos, "highLight", keepSourceImageName ? p.stem().string() : "");
+                const std::string hdrMaskNoMidLightPath = getHdrMaskPath(outputPath, pos, "noMidLight", keepSourceImageName ? p.stem().string() : "");
+
+                image::ImageWriteOptions maskWriteOptions;
+                maskWriteOptions.exrCompressionMethod(image::EImageExrCompression::None);
+
+                image::writeImage(hdrMaskLowLightPath, lowLightMask, maskWriteOptions);
+                image::writeImage(hdrMaskHighLightPath, highLightMask, maskWriteOptions);
+                image::writeImage(hdrMaskNoMidLightPath, noMidLightMask, maskWriteOptions);
+            }
+        }
+    }
+
+    ALICEVISION_LOG_INFO("Image cache usage: " << imageCache.toString());
+
+    return EXIT_SUCCESS;
+}
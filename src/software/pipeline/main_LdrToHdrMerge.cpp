@@ -7,6 +7,7 @@
 #include <aliceVision/image/all.hpp>
 #include <aliceVision/image/io.hpp>
 #include <aliceVision/system/Logger.hpp>
+#include <aliceVision/system/MemoryGovernor.hpp>
 #include <aliceVision/cmdline/cmdline.hpp>
 #include <aliceVision/system/main.hpp>
 #include <OpenImageIO/imageio.h>
@@ -24,9 +25,16 @@
 // Command line parameters
 #include <boost/program_options.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <iomanip>
+#include <thread>
 
 // These constants define the current software version.
 // They must be updated when the command line is changed.
@@ -70,6 +78,35 @@ std::string getHdrMaskPath(const std::string& outputPath, std::size_t g, const s
     return hdrImagePath;
 }
 
+/// One HDR group to merge: its bracket views and the view used as merge target
+struct MergeTask
+{
+    int pos;
+    IndexT intrinsicId;
+    std::vector<std::shared_ptr<sfmData::View>> group;
+    std::shared_ptr<sfmData::View> targetView;
+};
+
+/// A merge task with its brackets decoded, waiting for the merge stage
+struct LoadedTask
+{
+    const MergeTask* task;
+    std::vector<image::Image<image::RGBfColor>> images;
+    std::vector<double> exposures;
+    std::size_t reservedBytes;
+};
+
+/// A merged group waiting for the write stage
+struct MergedTask
+{
+    const MergeTask* task;
+    image::Image<image::RGBfColor> HDRimage;
+    image::Image<image::RGBfColor> lowLightMask;
+    image::Image<image::RGBfColor> highLightMask;
+    image::Image<image::RGBfColor> noMidLightMask;
+    std::size_t reservedBytes;
+};
+
 int aliceVision_main(int argc, char** argv)
 {
     std::string sfmInputDataFilename;
@@ -399,149 +436,367 @@ int aliceVision_main(int argc, char** argv)
 
     int rangeEnd = rangeStart + rangeSize;
 
-    int pos = 0;
+    hdr::rgbCurve fusionWeight(channelQuantization);
+    fusionWeight.setFunction(fusionWeightFunction);
+
+    // Preload the response curve of each intrinsic
+    std::map<IndexT, hdr::rgbCurve> responsePerIntrinsics;
     for (const auto& pGroupedViews : groupedViewsPerIntrinsics)
     {
-        IndexT intrinsicId = pGroupedViews.first;
-
-        const auto& groupedViews = pGroupedViews.second;
-        const auto& targetViews = targetViewsPerIntrinsics.at(intrinsicId);
-
-        hdr::rgbCurve fusionWeight(channelQuantization);
-        fusionWeight.setFunction(fusionWeightFunction);
-        hdr::rgbCurve response(channelQuantization);
-
         const std::string baseName = (fs::path(inputResponsePath).parent_path() / std::string("response_")).string();
-        const std::string intrinsicName = baseName + std::to_string(intrinsicId);
+        const std::string intrinsicName = baseName + std::to_string(pGroupedViews.first);
         const std::string intrinsicInputResponsePath = intrinsicName + ".csv";
 
         ALICEVISION_LOG_DEBUG("inputResponsePath: " << intrinsicInputResponsePath);
+
+        hdr::rgbCurve response(channelQuantization);
         response.read(intrinsicInputResponsePath);
+        responsePerIntrinsics.emplace(pGroupedViews.first, response);
+    }
 
-        for (std::size_t g = 0; g < groupedViews.size(); ++g, ++pos)
+    // Flatten the selected range into a list of merge tasks
+    std::vector<MergeTask> tasks;
+    {
+        int pos = 0;
+        for (const auto& pGroupedViews : groupedViewsPerIntrinsics)
         {
-            if (pos < rangeStart || pos >= rangeEnd)
+            const auto& groupedViews = pGroupedViews.second;
+            const auto& targetViews = targetViewsPerIntrinsics.at(pGroupedViews.first);
+
+            for (std::size_t g = 0; g < groupedViews.size(); ++g, ++pos)
             {
-                continue;
+                if (pos < rangeStart || pos >= rangeEnd)
+                {
+                    continue;
+                }
+
+                MergeTask task;
+                task.pos = pos;
+                task.intrinsicId = pGroupedViews.first;
+                task.group = groupedViews[g];
+                task.targetView = targetViews[g];
+                tasks.push_back(task);
             }
+        }
+    }
 
-            const std::vector<std::shared_ptr<sfmData::View>>& group = groupedViews[g];
+    // Three-stage pipeline: a small pool decodes the brackets of the next groups, the
+    // main thread runs the merges (OpenMP parallel internally) and a writer pool encodes
+    // the EXR outputs, so decode, merge and write overlap instead of alternating.
+    const unsigned int maxThreads = hwc.getMaxThreads();
+    const std::size_t nbLoadThreads = std::max<std::size_t>(1, std::min<std::size_t>(4, maxThreads / 4));
+    const std::size_t nbWriteThreads = std::max<std::size_t>(1, std::min<std::size_t>(2, maxThreads / 8));
+    const std::size_t memoryBudget = std::size_t(0.9 * double(hwc.getMaxMemory()));
+
+    ALICEVISION_LOG_INFO("Merge " << tasks.size() << " groups (" << nbLoadThreads << " decode threads, " << nbWriteThreads
+                                  << " write threads, budget: " << memoryBudget / (1024 * 1024) << " MB)");
+
+    std::deque<std::unique_ptr<LoadedTask>> loadedQueue;
+    std::deque<std::unique_ptr<MergedTask>> writeQueue;
+    std::size_t inFlightBytes = 0;
+    std::size_t nbActiveLoaders = nbLoadThreads;
+    bool mergeDone = false;
+    bool failed = false;
+    std::exception_ptr firstError = nullptr;
+    std::atomic<std::size_t> nextTaskIndex(0);
+    std::mutex mutex;
+    std::condition_variable loaderCond;
+    std::condition_variable mergeCond;
+    std::condition_variable writerCond;
+
+    // Runtime view of the host memory, so the admission adapts when other jobs share the node
+    system::MemoryGovernor memoryGovernor;
+
+    const auto onError = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!firstError)
+        {
+            firstError = std::current_exception();
+        }
+        failed = true;
+        loaderCond.notify_all();
+        mergeCond.notify_all();
+        writerCond.notify_all();
+    };
+
+    const auto loadLoop = [&]() {
+        try
+        {
+            while (true)
+            {
+                const std::size_t idTask = nextTaskIndex++;
+                if (idTask >= tasks.size())
+                {
+                    break;
+                }
+
+                const MergeTask& task = tasks[idTask];
+
+                // Decoded brackets plus the merged output and the optional masks
+                const std::size_t pixelBytes =
+                  std::size_t(task.targetView->getImage().getWidth()) * std::size_t(task.targetView->getImage().getHeight()) *
+                  sizeof(image::RGBfColor);
+                const std::size_t taskBytes = pixelBytes * (task.group.size() + 1 + (computeLightMasks ? 3 : 0));
+
+                {
+                    // Admission under the memory budget; an empty pipeline always admits one
+                    // group, so progress is guaranteed even under memory pressure
+                    std::unique_lock<std::mutex> lock(mutex);
+                    const auto admit = [&]() {
+                        if (failed)
+                            return true;
+                        if (inFlightBytes == 0)
+                            return true;
+                        if (inFlightBytes + taskBytes > memoryBudget)
+                            return false;
+                        return !memoryGovernor.underPressure() && (taskBytes <= memoryGovernor.availableBytes());
+                    };
+                    while (!admit())
+                        loaderCond.wait_for(lock, std::chrono::milliseconds(500));
+                    if (failed)
+                        break;
+                    inFlightBytes += taskBytes;
+                }
+
+                auto loaded = std::make_unique<LoadedTask>();
+                loaded->task = &task;
+                loaded->reservedBytes = taskBytes;
+                loaded->images.resize(task.group.size());
+
+                std::vector<sfmData::ExposureSetting> exposuresSetting(task.group.size());
+
+                // Load all images of the group
+                for (std::size_t i = 0; i < task.group.size(); ++i)
+                {
+                    const std::string filepath = task.group[i]->getImage().getImagePath();
+                    ALICEVISION_LOG_INFO("Load " << filepath);
+
+                    image::ImageReadOptions options;
+                    options.workingColorSpace = workingColorSpace;
+                    options.rawColorInterpretation =
+                      image::ERawColorInterpretation_stringToEnum(task.group[i]->getImage().getRawColorInterpretation());
+                    options.colorProfileFileName = task.group[i]->getImage().getColorProfileFileName();
+
+                    // Whatever the raw color interpretation mode, the default read processing for raw images is to apply
+                    // white balancing in libRaw, before demosaicing.
+                    // The DcpMetadata mode allows to not apply color management after demosaicing.
+                    // Because if requested after demosaicing, white balancing is done at color management stage, we can
+                    // set this option to true to get real raw data, without any white balancing, when the DcpMetadata mode
+                    // is selected.
+                    if (options.rawColorInterpretation == image::ERawColorInterpretation::DcpMetadata)
+                    {
+                        options.doWBAfterDemosaicing = true;
+                    }
+
+                    image::readImage(filepath, loaded->images[i], options);
+
+                    exposuresSetting[i] = task.group[i]->getImage().getCameraExposureSetting();
+                }
+
+                if (!sfmData::hasComparableExposures(exposuresSetting))
+                {
+                    ALICEVISION_THROW_ERROR("Camera exposure settings are inconsistent.");
+                }
+
+                loaded->exposures = getExposures(exposuresSetting);
+
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    loadedQueue.push_back(std::move(loaded));
+                }
+                mergeCond.notify_one();
+            }
+        }
+        catch (...)
+        {
+            onError();
+        }
 
-            std::vector<image::Image<image::RGBfColor>> images(group.size());
-            std::shared_ptr<sfmData::View> targetView = targetViews[g];
-            std::vector<sfmData::ExposureSetting> exposuresSetting(group.size());
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            --nbActiveLoaders;
+        }
+        mergeCond.notify_all();
+    };
 
-            // Load all images of the group
-            for (std::size_t i = 0; i < group.size(); ++i)
+    const auto writeLoop = [&]() {
+        try
+        {
+            while (true)
             {
-                const std::string filepath = group[i]->getImage().getImagePath();
-                ALICEVISION_LOG_INFO("Load " << filepath);
-
-                image::ImageReadOptions options;
-                options.workingColorSpace = workingColorSpace;
-                options.rawColorInterpretation = image::ERawColorInterpretation_stringToEnum(group[i]->getImage().getRawColorInterpretation());
-                options.colorProfileFileName = group[i]->getImage().getColorProfileFileName();
-
-                // Whatever the raw color interpretation mode, the default read processing for raw images is to apply
-                // white balancing in libRaw, before demosaicing.
-                // The DcpMetadata mode allows to not apply color management after demosaicing.
-                // Because if requested after demosaicing, white balancing is done at color management stage, we can
-                // set this option to true to get real raw data, without any white balancing, when the DcpMetadata mode
-                // is selected.
-                if (options.rawColorInterpretation == image::ERawColorInterpretation::DcpMetadata)
+                std::unique_ptr<MergedTask> merged;
+
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    writerCond.wait(lock, [&]() { return !writeQueue.empty() || mergeDone || failed; });
+                    if (failed || writeQueue.empty())
+                        break;
+                    merged = std::move(writeQueue.front());
+                    writeQueue.pop_front();
+                }
+
+                const MergeTask& task = *merged->task;
+
+                fs::path p(task.targetView->getImage().getImagePath());
+                const std::string hdrImagePath = getHdrImagePath(outputPath, task.pos, keepSourceImageName ? p.stem().string() : "");
+
+                // Write an image with parameters from the target view
+                std::map<std::string, std::string> viewMetadata = task.targetView->getImage().getMetadata();
+
+                oiio::ParamValueList targetMetadata;
+                for (const auto& meta : viewMetadata)
+                {
+                    if (meta.first.compare(0, 3, "raw") == 0)
+                    {
+                        targetMetadata.add_or_replace(oiio::ParamValue("AliceVision:" + meta.first, meta.second));
+                    }
+                    else
+                    {
+                        targetMetadata.add_or_replace(oiio::ParamValue(meta.first, meta.second));
+                    }
+                }
+
+                targetMetadata.add_or_replace(oiio::ParamValue("AliceVision:ColorSpace", image::EImageColorSpace_enumToString(mergedColorSpace)));
+
+                image::ImageWriteOptions writeOptions;
+                writeOptions.fromColorSpace(mergedColorSpace);
+                writeOptions.toColorSpace(mergedColorSpace);
+                writeOptions.storageDataType(storageDataType);
+
+                image::writeImage(hdrImagePath, merged->HDRimage, writeOptions, targetMetadata);
+
+                if (computeLightMasks)
                 {
-                    options.doWBAfterDemosaicing = true;
+                    const std::string hdrMaskLowLightPath =
+                      getHdrMaskPath(outputPath, task.pos, "lowLight", keepSourceImageName ? p.stem().string() : "");
+                    const std::string hdrMaskHighLightPath =
+                      getHdrMaskPath(outputPath, task.pos, "highLight", keepSourceImageName ? p.stem().string() : "");
+                    const std::string hdrMaskNoMidLightPath =
+                      getHdrMaskPath(outputPath, task.pos, "noMidLight", keepSourceImageName ? p.stem().string() : "");
+
+                    image::ImageWriteOptions maskWriteOptions;
+                    maskWriteOptions.exrCompressionMethod(image::EImageExrCompression::None);
+
+                    image::writeImage(hdrMaskLowLightPath, merged->lowLightMask, maskWriteOptions);
+                    image::writeImage(hdrMaskHighLightPath, merged->highLightMask, maskWriteOptions);
+                    image::writeImage(hdrMaskNoMidLightPath, merged->noMidLightMask, maskWriteOptions);
                 }
 
-                image::readImage(filepath, images[i], options);
+                const std::size_t releasedBytes = merged->reservedBytes;
+                merged.reset();
 
-                exposuresSetting[i] = group[i]->getImage().getCameraExposureSetting();
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    inFlightBytes -= releasedBytes;
+                }
+                loaderCond.notify_all();
             }
+        }
+        catch (...)
+        {
+            onError();
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(nbLoadThreads + nbWriteThreads);
+    for (std::size_t i = 0; i < nbLoadThreads; ++i)
+        pool.emplace_back(loadLoop);
+    for (std::size_t i = 0; i < nbWriteThreads; ++i)
+        pool.emplace_back(writeLoop);
+
+    // Merge stage, running on the main thread
+    try
+    {
+        while (true)
+        {
+            std::unique_ptr<LoadedTask> loaded;
 
-            if (!sfmData::hasComparableExposures(exposuresSetting))
             {
-                ALICEVISION_THROW_ERROR("Camera exposure settings are inconsistent.");
+                std::unique_lock<std::mutex> lock(mutex);
+                mergeCond.wait(lock, [&]() { return !loadedQueue.empty() || nbActiveLoaders == 0 || failed; });
+                if (failed || loadedQueue.empty())
+                    break;
+                loaded = std::move(loadedQueue.front());
+                loadedQueue.pop_front();
             }
 
-            std::vector<double> exposures = getExposures(exposuresSetting);
+            const MergeTask& task = *loaded->task;
+
+            auto merged = std::make_unique<MergedTask>();
+            merged->task = loaded->task;
+            merged->reservedBytes = loaded->reservedBytes;
 
             // Merge HDR images
-            image::Image<image::RGBfColor> HDRimage;
-            image::Image<image::RGBfColor> lowLightMask;
-            image::Image<image::RGBfColor> highLightMask;
-            image::Image<image::RGBfColor> noMidLightMask;
-            if (images.size() > 1)
+            if (loaded->images.size() > 1)
             {
                 hdr::hdrMerge merge;
-                sfmData::ExposureSetting targetCameraSetting = targetView->getImage().getCameraExposureSetting();
+                sfmData::ExposureSetting targetCameraSetting = task.targetView->getImage().getCameraExposureSetting();
                 hdr::MergingParams mergingParams;
                 mergingParams.targetCameraExposure = targetCameraSetting.getExposure();
-                mergingParams.refImageIndex = targetIndexPerIntrinsics[intrinsicId];
+                mergingParams.refImageIndex = targetIndexPerIntrinsics[task.intrinsicId];
                 mergingParams.minSignificantValue = minSignificantValue;
                 mergingParams.maxSignificantValue = maxSignificantValue;
                 mergingParams.computeLightMasks = computeLightMasks;
 
-                merge.process(images, exposures, fusionWeight, response, HDRimage, lowLightMask, highLightMask, noMidLightMask, mergingParams);
+                const hdr::rgbCurve& response = responsePerIntrinsics.at(task.intrinsicId);
+
+                merge.process(loaded->images,
+                              loaded->exposures,
+                              fusionWeight,
+                              response,
+                              merged->HDRimage,
+                              merged->lowLightMask,
+                              merged->highLightMask,
+                              merged->noMidLightMask,
+                              mergingParams);
                 if (highlightCorrectionFactor > 0.0f)
                 {
-                    merge.postProcessHighlight(images,
-                                               exposures,
+                    merge.postProcessHighlight(loaded->images,
+                                               loaded->exposures,
                                                fusionWeight,
                                                response,
-                                               HDRimage,
+                                               merged->HDRimage,
                                                targetCameraSetting.getExposure(),
                                                highlightCorrectionFactor,
                                                highlightTargetLux);
                 }
             }
-            else if (images.size() == 1)
+            else if (loaded->images.size() == 1)
             {
                 // Nothing to do
-                HDRimage = images[0];
+                merged->HDRimage = loaded->images[0];
             }
 
-            fs::path p(targetView->getImage().getImagePath());
-            const std::string hdrImagePath = getHdrImagePath(outputPath, pos, keepSourceImageName ? p.stem().string() : "");
-
-            // Write an image with parameters from the target view
-            std::map<std::string, std::string> viewMetadata = targetView->getImage().getMetadata();
+            // Release the decoded brackets before queueing the output
+            loaded.reset();
 
-            oiio::ParamValueList targetMetadata;
-            for (const auto& meta : viewMetadata)
             {
-                if (meta.first.compare(0, 3, "raw") == 0)
-                {
-                    targetMetadata.add_or_replace(oiio::ParamValue("AliceVision:" + meta.first, meta.second));
-                }
-                else
-                {
-                    targetMetadata.add_or_replace(oiio::ParamValue(meta.first, meta.second));
-                }
+                std::unique_lock<std::mutex> lock(mutex);
+                writeQueue.push_back(std::move(merged));
             }
+            writerCond.notify_one();
+        }
+    }
+    catch (...)
+    {
+        onError();
+    }
 
-            targetMetadata.add_or_replace(oiio::ParamValue("AliceVision:ColorSpace", image::EImageColorSpace_enumToString(mergedColorSpace)));
-
-            image::ImageWriteOptions writeOptions;
-            writeOptions.fromColorSpace(mergedColorSpace);
-            writeOptions.toColorSpace(mergedColorSpace);
-            writeOptions.storageDataType(storageDataType);
-
-            image::writeImage(hdrImagePath, HDRimage, writeOptions, targetMetadata);
-
-            if (computeLightMasks)
-            {
-                const std::string hdrMaskLowLightPath = getHdrMaskPath(outputPath, pos, "lowLight", keepSourceImageName ? p.stem().string() : "");
-                const std::string hdrMaskHighLightPath = getHdrMaskPath(outputPath, pos, "highLight", keepSourceImageName ? p.stem().string() : "");
-                const std::string hdrMaskNoMidLightPath = getHdrMaskPath(outputPath, pos, "noMidLight", keepSourceImageName ? p.stem().string() : "");
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        mergeDone = true;
+    }
+    writerCond.notify_all();
 
-                image::ImageWriteOptions maskWriteOptions;
-                maskWriteOptions.exrCompressionMethod(image::EImageExrCompression::None);
+    for (std::thread& thread : pool)
+    {
+        thread.join();
+    }
 
-                image::writeImage(hdrMaskLowLightPath, lowLightMask, maskWriteOptions);
-                image::writeImage(hdrMaskHighLightPath, highLightMask, maskWriteOptions);
-                image::writeImage(hdrMaskNoMidLightPath, noMidLightMask, maskWriteOptions);
-            }
-        }
+    if (firstError)
+    {
+        std::rethrow_exception(firstError);
     }
 
     return EXIT_SUCCESS;
@@ -57,6 +57,7 @@ int aliceVision_main(int argc, char** argv)
     image::EImageColorSpace workingColorSpace = image::EImageColorSpace::AUTO;
     hdr::Sampling::Params params;
     bool byPass = false;
+    bool streaming = false;
     bool debug = false;
 
     int rangeStart = -1;
@@ -91,6 +92,9 @@ int aliceVision_main(int argc, char** argv)
          "Radius of the patch used to analyze the sample statistics.")
         ("maxCountSample", po::value<std::size_t>(&params.maxCountSample)->default_value(params.maxCountSample),
          "Maximum number of samples per image group.")
+        ("streaming", po::value<bool>(&streaming)->default_value(streaming),
+         "Decode the brackets stripe by stripe and select the samples with per stratum reservoirs, "
+         "to bound the memory usage on large images.")
         ("debug", po::value<bool>(&debug)->default_value(debug),
          "Export debug files.")
         ("rangeStart", po::value<int>(&rangeStart)->default_value(rangeStart),
@@ -278,8 +282,11 @@ int aliceVision_main(int argc, char** argv)
             const bool simplifiedSampling = byPass || (calibrationMethod == ECalibrationMethod::LINEAR);
 
             std::vector<hdr::ImageSample> out_samples;
-            const bool res = hdr::Sampling::extractSamplesFromImages(
-              out_samples, paths, viewIds, exposures, width, height, channelQuantization, imgReadOptions, params, simplifiedSampling);
+            const bool res =
+              streaming ? hdr::Sampling::extractSamplesFromImagesStreaming(
+                            out_samples, paths, viewIds, exposures, width, height, channelQuantization, imgReadOptions, params, simplifiedSampling)
+                        : hdr::Sampling::extractSamplesFromImages(
+                            out_samples, paths, viewIds, exposures, width, height, channelQuantization, imgReadOptions, params, simplifiedSampling);
             if (!res)
             {
                 ALICEVISION_LOG_ERROR("Error while extracting samples from group.");
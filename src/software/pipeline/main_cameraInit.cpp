@@ -372,7 +372,9 @@ int aliceVision_main(int argc, char** argv)
 
         if (listFiles(imageFolder, image::getSupportedExtensions(), imagePaths))
         {
-#pragma omp parallel for
+            // the metadata reads are I/O bound with a very uneven cost per file,
+            // so distribute them dynamically over the threads
+#pragma omp parallel for schedule(dynamic)
             for (int i = 0; i < imagePaths.size(); ++i)
             {
                 auto view = std::make_shared<sfmData::View>(imagePaths.at(i).string());
@@ -397,7 +399,12 @@ int aliceVision_main(int argc, char** argv)
     }
 
     // create missing intrinsics
-    auto viewPairItBegin = sfmData.getViews().begin();
+    // gather the view pointers upfront: advancing the map iterator inside the parallel loop
+    // below would be quadratic in the number of views
+    std::vector<sfmData::View*> viewPtrs;
+    viewPtrs.reserve(sfmData.getViews().size());
+    for (const auto& viewPair : sfmData.getViews())
+        viewPtrs.push_back(viewPair.second.get());
 
     boost::regex extractComposedNumberRegex("\\d+(?:[\\-\\:\\_\\.]\\d+)*");
     boost::regex extractNumberRegex("\\d+");
@@ -420,10 +427,10 @@ int aliceVision_main(int argc, char** argv)
         ALICEVISION_LOG_INFO(lcpStore.size() << " profile(s) stored in the LCP database.");
     }
 
-#pragma omp parallel for
-    for (int i = 0; i < sfmData.getViews().size(); ++i)
+#pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < viewPtrs.size(); ++i)
     {
-        sfmData::View& view = *(std::next(viewPairItBegin, i)->second);
+        sfmData::View& view = *viewPtrs.at(i);
 
         // try to detect rig structure in the input folder
         const fs::path parentPath = fs::path(view.getImage().getImagePath()).parent_path();
@@ -97,6 +97,8 @@ int aliceVision_main(int argc, char** argv)
     std::string vocTreeFilepath;
     /// the vocabulary tree weights file
     std::string weightsFilepath;
+    /// the database snapshot file, reloaded if it exists and written otherwise
+    std::string databaseSnapshotFilepath;
     /// Number of previous frame of the sequence to use for matching
     std::size_t nbFrameBufferMatching = 10;
     /// enable/disable the robust matching (geometric validation) when matching query image
@@ -143,6 +145,9 @@ int aliceVision_main(int argc, char** argv)
          "The describer types to use for the matching.")
         ("preset", po::value<feature::EImageDescriberPreset>(&featDescPreset.descPreset)->default_value(featDescPreset.descPreset),
          "Preset for the feature extractor when localizing a new image ({LOW,MEDIUM,NORMAL,HIGH,ULTRA}).")
+        ("parallelOctaves", po::value<bool>(&featDescPreset.parallelOctaves)->default_value(featDescPreset.parallelOctaves),
+         "Process the scale-space octaves concurrently when extracting the features of a new image, "
+         "to lower the per-frame latency.")
         ("resectionEstimator", po::value<robustEstimation::ERobustEstimator>(&resectionEstimator)->default_value(resectionEstimator),
          std::string("The type of *sac framework to use for resection (" +str_estimatorChoices + ").").c_str())
         ("matchingEstimator", po::value<robustEstimation::ERobustEstimator>(&matchingEstimator)->default_value(matchingEstimator),
@@ -172,6 +177,10 @@ int aliceVision_main(int argc, char** argv)
          "[voctree] Filename for the vocabulary tree.")
         ("voctreeWeights", po::value<std::string>(&weightsFilepath),
          "[voctree] Filename for the vocabulary tree weights.")
+        ("voctreeDbSnapshot", po::value<std::string>(&databaseSnapshotFilepath),
+         "[voctree] Filename for the database snapshot: if the file exists the database is "
+         "reloaded from it instead of quantizing every view, otherwise the built database "
+         "is saved there for the next runs against the same map.")
         ("algorithm", po::value<std::string>(&algostring)->default_value(algostring),
          "[voctree] Algorithm type: FirstBest, AllResults.")
         ("matchingError", po::value<double>(&matchingErrorMax)->default_value(matchingErrorMax),
@@ -307,7 +316,7 @@ int aliceVision_main(int argc, char** argv)
 #endif
     {
         localization::VoctreeLocalizer* tmpLoc =
-          new localization::VoctreeLocalizer(sfmData, descriptorsFolder, vocTreeFilepath, weightsFilepath, matchDescTypes);
+          new localization::VoctreeLocalizer(sfmData, descriptorsFolder, vocTreeFilepath, weightsFilepath, matchDescTypes, databaseSnapshotFilepath);
 
         localizer.reset(tmpLoc);
 
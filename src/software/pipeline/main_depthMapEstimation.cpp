@@ -5,6 +5,7 @@
 // You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include <aliceVision/system/Logger.hpp>
+#include <aliceVision/system/Trace.hpp>
 #include <aliceVision/cmdline/cmdline.hpp>
 #include <aliceVision/system/main.hpp>
 #include <aliceVision/sfmData/SfMData.hpp>
@@ -82,6 +83,7 @@ int aliceVision_main(int argc, char* argv[])
     bool exportIntermediateDepthSimMaps = false;
     bool exportIntermediateNormalMaps = false;
     bool exportIntermediateVolumes = false;
+    bool exportIntermediateCompressedVolumes = false;
     bool exportIntermediateCrossVolumes = false;
     bool exportIntermediateTopographicCutVolumes = false;
     bool exportIntermediateVolume9pCsv = false;
@@ -195,6 +197,8 @@ int aliceVision_main(int argc, char* argv[])
          "Enable/Disable depth/similarity map refinement process.")
         ("colorOptimizationEnabled", po::value<bool>(&refineParams.useColorOptimization)->default_value(refineParams.useColorOptimization),
          "Enable/Disable depth/similarity map post-process color optimization.")
+        ("computeNormalMaps", po::value<bool>(&refineParams.computeNormalMaps)->default_value(refineParams.computeNormalMaps),
+         "Compute a normal map for each depth map, from the final depth map while it is still in GPU memory.")
         ("autoAdjustSmallImage", po::value<bool>(&depthMapParams.autoAdjustSmallImage)->default_value(depthMapParams.autoAdjustSmallImage),
          "Automatically adjust depth map parameters if images are smaller than one tile (maxTCamsPerTile=maxTCams, adjust step if needed).")
         ("customPatchPatternSubparts", po::value<std::vector<depthMap::CustomPatchPatternParams::SubpartParams>>(&depthMapParams.customPatchPattern.subpartsParams)->multitoken()->default_value(depthMapParams.customPatchPattern.subpartsParams),
@@ -207,6 +211,8 @@ int aliceVision_main(int argc, char* argv[])
          "Export intermediate normal maps from the SGM and Refine steps.")
         ("exportIntermediateVolumes", po::value<bool>(&exportIntermediateVolumes)->default_value(exportIntermediateVolumes),
          "Export intermediate full similarity volumes from the SGM and Refine steps.")
+        ("exportIntermediateCompressedVolumes", po::value<bool>(&exportIntermediateCompressedVolumes)->default_value(exportIntermediateCompressedVolumes),
+         "Export intermediate lossy-quantized compressed similarity volumes from the SGM step.")
         ("exportIntermediateCrossVolumes", po::value<bool>(&exportIntermediateCrossVolumes)->default_value(exportIntermediateCrossVolumes),
          "Export intermediate similarity cross volumes from the SGM and Refine steps.")
         ("exportIntermediateTopographicCutVolumes", po::value<bool>(&exportIntermediateTopographicCutVolumes)->default_value(exportIntermediateTopographicCutVolumes),
@@ -234,6 +240,7 @@ int aliceVision_main(int argc, char* argv[])
     sgmParams.exportIntermediateDepthSimMaps = exportIntermediateDepthSimMaps;
     sgmParams.exportIntermediateNormalMaps = exportIntermediateNormalMaps;
     sgmParams.exportIntermediateVolumes = exportIntermediateVolumes;
+    sgmParams.exportIntermediateCompressedVolumes = exportIntermediateCompressedVolumes;
     sgmParams.exportIntermediateCrossVolumes = exportIntermediateCrossVolumes;
     sgmParams.exportIntermediateTopographicCutVolumes = exportIntermediateTopographicCutVolumes;
     sgmParams.exportIntermediateVolume9pCsv = exportIntermediateVolume9pCsv;
@@ -429,7 +436,10 @@ int aliceVision_main(int argc, char* argv[])
     depthMap::DepthMapEstimator depthMapEstimator(mp, tileParams, depthMapParams, sgmParams, refineParams);
 
     // estimate depth maps
-    depthMap::computeOnMultiGPUs(cams, depthMapEstimator, nbGPUs);
+    {
+        system::TraceSpan span("depthMapEstimation", "gpu");
+        depthMap::computeOnMultiGPUs(cams, depthMapEstimator, nbGPUs);
+    }
 
     ALICEVISION_COMMANDLINE_END
 }
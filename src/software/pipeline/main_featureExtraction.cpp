@@ -16,6 +16,7 @@
     #include <aliceVision/gpu/gpu.hpp>
 #endif
 #include <aliceVision/system/Timer.hpp>
+#include <aliceVision/system/Trace.hpp>
 #include <aliceVision/system/Logger.hpp>
 #include <aliceVision/system/main.hpp>
 #include <aliceVision/cmdline/cmdline.hpp>
@@ -58,6 +59,7 @@ int aliceVision_main(int argc, char** argv)
     image::EImageColorSpace workingColorSpace = image::EImageColorSpace::SRGB;
     std::string maskExtension = "png";
     bool maskInvert = false;
+    std::string memoryCalibrationFile;
 
     // clang-format off
     po::options_description requiredParams("Required parameters");
@@ -84,6 +86,9 @@ int aliceVision_main(int argc, char** argv)
          feature::EFeatureConstrastFiltering_information().c_str())
         ("relativePeakThreshold", po::value<float>(&featDescConfig.relativePeakThreshold)->default_value(featDescConfig.relativePeakThreshold),
          "Peak Threshold relative to median of gradiants.")
+        ("parallelOctaves", po::value<bool>(&featDescConfig.parallelOctaves)->default_value(featDescConfig.parallelOctaves),
+         "Process the scale-space octaves concurrently to lower the per-image extraction latency "
+         "(may marginally change the detections in the upper octaves).")
         ("workingColorSpace", po::value<image::EImageColorSpace>(&workingColorSpace)->default_value(workingColorSpace),
          ("Working color space: " + image::EImageColorSpace_informations()).c_str())
         ("forceCpuExtraction", po::value<bool>(&forceCpuExtraction)->default_value(forceCpuExtraction),
@@ -99,7 +104,10 @@ int aliceVision_main(int argc, char** argv)
         ("rangeSize", po::value<int>(&rangeSize)->default_value(rangeSize),
          "Range size.")
         ("maxThreads", po::value<int>(&maxThreads)->default_value(maxThreads),
-         "Specifies the maximum number of threads to run simultaneously (0 for automatic mode).");
+         "Specifies the maximum number of threads to run simultaneously (0 for automatic mode).")
+        ("memoryCalibrationFile", po::value<std::string>(&memoryCalibrationFile)->default_value(memoryCalibrationFile),
+         "Describer memory calibration file. If the file exists, its measured per-describer memory profiles replace "
+         "the analytical estimates for the scheduling; otherwise a calibration pass measures the first jobs and writes the file.");
     // clang-format on
 
     CmdLine cmdline("AliceVision featureExtraction");
@@ -135,16 +143,21 @@ int aliceVision_main(int argc, char** argv)
     // load input scene
     sfmData::SfMData sfmData;
     std::cout << sfmData.getViews().size() << std::endl;
-    if (!sfmDataIO::load(sfmData, sfmDataFilename, sfmDataIO::ESfMData(sfmDataIO::VIEWS | sfmDataIO::INTRINSICS)))
     {
-        ALICEVISION_LOG_ERROR("The input file '" + sfmDataFilename + "' cannot be read");
-        return EXIT_FAILURE;
+        system::TraceSpan span("loadSfMData", "io");
+        if (!sfmDataIO::load(sfmData, sfmDataFilename, sfmDataIO::ESfMData(sfmDataIO::VIEWS | sfmDataIO::INTRINSICS)))
+        {
+            ALICEVISION_LOG_ERROR("The input file '" + sfmDataFilename + "' cannot be read");
+            return EXIT_FAILURE;
+        }
     }
 
     // create feature extractor
     featureEngine::FeatureExtractor extractor(sfmData);
     extractor.setMasksFolder(masksFolder, maskExtension, maskInvert);
     extractor.setOutputFolder(outputFolder);
+    if (!memoryCalibrationFile.empty())
+        extractor.setMemoryCalibrationFile(memoryCalibrationFile);
 
     // set maxThreads
     HardwareContext hwc = cmdline.getHardwareContext();
@@ -192,6 +205,7 @@ int aliceVision_main(int argc, char** argv)
     // - if no file, compute features
     {
         system::Timer timer;
+        system::TraceSpan span("featureExtraction");
 
         extractor.process(hwc, workingColorSpace);
 
@@ -116,9 +116,10 @@ int aliceVision_main(int argc, char** argv)
     bool useGridSort = true;
     bool exportDebugFiles = false;
     bool matchFromKnownCameraPoses = false;
-    const std::string fileExtension = "txt";
+    const std::string fileExtension = "bin";
     int randomSeed = std::mt19937::default_seed;
     double minRequired2DMotion = -1.0;
+    bool cacheHashedDescriptions = false;
 
     // clang-format off
     po::options_description requiredParams("Required parameters");
@@ -145,8 +146,13 @@ int aliceVision_main(int argc, char** argv)
          "* CASCADE_HASHING_L2: L2 Cascade Hashing matching\n"
          "* FAST_CASCADE_HASHING_L2: L2 Cascade Hashing with precomputed hashed regions\n"
          "(faster than CASCADE_HASHING_L2 but use more memory)\n"
+         "* BRUTE_FORCE_CUDA_L2: L2 BruteForce matching on GPU (requires a CUDA build)\n"
          "For Binary based descriptor:\n"
          "* BRUTE_FORCE_HAMMING: BruteForce Hamming matching")
+        ("cacheHashedDescriptions", po::value<bool>(&cacheHashedDescriptions)->default_value(cacheHashedDescriptions),
+         "Cache the cascade hashing hashed descriptions in the first features folder (alongside the extracted features), "
+         "so re-running the matching with an other pair list skips the descriptor hashing pass. "
+         "Only used with the CASCADE_HASHING_L2 photometric matching method.")
         ("geometricEstimator", po::value<robustEstimation::ERobustEstimator>(&geometricEstimator)->default_value(geometricEstimator),
          "Geometric estimator:\n"
          "* acransac: A-Contrario Ransac\n"
@@ -283,6 +289,15 @@ int aliceVision_main(int argc, char** argv)
     EMatcherType collectionMatcherType = EMatcherType_stringToEnum(nearestMatchingMethod);
     std::unique_ptr<IImageCollectionMatcher> imageCollectionMatcher = createImageCollectionMatcher(collectionMatcherType, distRatio, crossMatching);
 
+    if (cacheHashedDescriptions)
+    {
+        auto* cascadeHashingMatcher = dynamic_cast<ImageCollectionMatcher_cascadeHashing*>(imageCollectionMatcher.get());
+        if (cascadeHashingMatcher != nullptr)
+            cascadeHashingMatcher->setCacheFolder(featuresFolders.front());
+        else
+            ALICEVISION_LOG_WARNING("cacheHashedDescriptions is only used with the CASCADE_HASHING_L2 photometric matching method.");
+    }
+
     const std::vector<feature::EImageDescriberType> describerTypes = feature::EImageDescriberType_stringToEnums(describerTypesName);
 
     ALICEVISION_LOG_INFO("There are " << sfmData.getViews().size() << " views and " << pairs.size() << " image pairs.");
@@ -19,6 +19,7 @@
 #include <boost/program_options.hpp>
 #include <boost/algorithm/string/case_conv.hpp>
 
+#include <atomic>
 #include <filesystem>
 
 // These constants define the current software version.
@@ -256,119 +257,146 @@ int main(int argc, char** argv)
 
     bool useDepthMap = !depthMapExp.empty() || !depthMapFolder.empty();
 
-    // #pragma omp parallel for
+    // Collect the views of the range up front, so that the images can be processed concurrently
+    std::vector<std::pair<IndexT, const sfmData::View*>> viewRange;
+    viewRange.reserve(size);
     for (int i = 0; i < size; ++i)
     {
         const auto& item = std::next(viewPairItBegin, rangeStart + i);
-        const IndexT& index = item->first;
-        const sfmData::View& view = *item->second;
+        viewRange.emplace_back(item->first, item->second.get());
+    }
 
-        std::string imgPath = view.getImage().getImagePath();
-        std::string depthMapPath;
-        if (!depthMapExp.empty())
-        {
-            depthMapPath = depthMapExp;
-            {
-                const auto pos = depthMapPath.find(k_depthMapFolder);
-                if (pos != std::string::npos)
-                    depthMapPath.replace(pos, k_depthMapFolder.size(), depthMapFolder);
-            }
-            {
-                const auto pos = depthMapPath.find(k_inputFolder);
-                if (pos != std::string::npos)
-                    depthMapPath.replace(pos, k_inputFolder.size(), fs::path(imgPath).parent_path().string());
-            }
-            {
-                const auto pos = depthMapPath.find(k_filename);
-                if (pos != std::string::npos)
-                    depthMapPath.replace(pos, k_filename.size(), fs::path(imgPath).filename().string());
-            }
-            {
-                const auto pos = depthMapPath.find(k_stem);
-                if (pos != std::string::npos)
-                    depthMapPath.replace(pos, k_stem.size(), fs::path(imgPath).stem().string());
-            }
-            {
-                const auto pos = depthMapPath.find(k_ext);
-                if (pos != std::string::npos)
-                    depthMapPath.replace(pos, k_stem.size(), fs::path(imgPath).extension().string().substr(1));
-            }
-            if (!fs::exists(depthMapPath))
-            {
-                ALICEVISION_LOG_DEBUG("depthMapPath from expression: \"" << depthMapPath << "\" not found.");
-                depthMapPath.clear();
-            }
-            else
-            {
-                ALICEVISION_LOG_DEBUG("depthMapPath from expression: \"" << depthMapPath << "\" found.");
-            }
-        }
-        else if (!depthMapFolder.empty())
+    std::atomic<bool> hasFailed{false};
+
+#pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < size; ++i)
+    {
+        if (hasFailed)
+            continue;
+
+        try
         {
-            // Look for View UID
-            fs::path p = fs::path(depthMapFolder) / (std::to_string(view.getViewId()) + fs::path(imgPath).extension().string());
-            if (fs::exists(p))
+            const IndexT& index = viewRange[i].first;
+            const sfmData::View& view = *viewRange[i].second;
+
+            std::string imgPath = view.getImage().getImagePath();
+            std::string depthMapPath;
+            if (!depthMapExp.empty())
             {
-                depthMapPath = p.string();
-                ALICEVISION_LOG_DEBUG("depthMapPath found from folder and View UID: \"" << depthMapPath << "\".");
+                depthMapPath = depthMapExp;
+                {
+                    const auto pos = depthMapPath.find(k_depthMapFolder);
+                    if (pos != std::string::npos)
+                        depthMapPath.replace(pos, k_depthMapFolder.size(), depthMapFolder);
+                }
+                {
+                    const auto pos = depthMapPath.find(k_inputFolder);
+                    if (pos != std::string::npos)
+                        depthMapPath.replace(pos, k_inputFolder.size(), fs::path(imgPath).parent_path().string());
+                }
+                {
+                    const auto pos = depthMapPath.find(k_filename);
+                    if (pos != std::string::npos)
+                        depthMapPath.replace(pos, k_filename.size(), fs::path(imgPath).filename().string());
+                }
+                {
+                    const auto pos = depthMapPath.find(k_stem);
+                    if (pos != std::string::npos)
+                        depthMapPath.replace(pos, k_stem.size(), fs::path(imgPath).stem().string());
+                }
+                {
+                    const auto pos = depthMapPath.find(k_ext);
+                    if (pos != std::string::npos)
+                        depthMapPath.replace(pos, k_stem.size(), fs::path(imgPath).extension().string().substr(1));
+                }
+                if (!fs::exists(depthMapPath))
+                {
+                    ALICEVISION_LOG_DEBUG("depthMapPath from expression: \"" << depthMapPath << "\" not found.");
+                    depthMapPath.clear();
+                }
+                else
+                {
+                    ALICEVISION_LOG_DEBUG("depthMapPath from expression: \"" << depthMapPath << "\" found.");
+                }
             }
-            else
+            else if (!depthMapFolder.empty())
             {
-                // Look for an image with the same filename
-                p = fs::path(depthMapFolder) / fs::path(imgPath).filename();
+                // Look for View UID
+                fs::path p = fs::path(depthMapFolder) / (std::to_string(view.getViewId()) + fs::path(imgPath).extension().string());
                 if (fs::exists(p))
                 {
                     depthMapPath = p.string();
-                    ALICEVISION_LOG_DEBUG("depthMapPath found from folder and input filename: \"" << depthMapPath << "\".");
+                    ALICEVISION_LOG_DEBUG("depthMapPath found from folder and View UID: \"" << depthMapPath << "\".");
+                }
+                else
+                {
+                    // Look for an image with the same filename
+                    p = fs::path(depthMapFolder) / fs::path(imgPath).filename();
+                    if (fs::exists(p))
+                    {
+                        depthMapPath = p.string();
+                        ALICEVISION_LOG_DEBUG("depthMapPath found from folder and input filename: \"" << depthMapPath << "\".");
+                    }
                 }
             }
-        }
 
-        const std::string p = useDepthMap ? depthMapPath : imgPath;
-        image::Image<unsigned char> result;
-        process(result, p);
+            const std::string p = useDepthMap ? depthMapPath : imgPath;
+            image::Image<unsigned char> result;
+            process(result, p);
 
-        if (invert)
-        {
-            imageMasking::postprocess_invert(result);
-        }
-        if (growRadius > 0)
-        {
-            imageMasking::postprocess_dilate(result, growRadius);
-        }
-        if (shrinkRadius > 0)
-        {
-            imageMasking::postprocess_erode(result, shrinkRadius);
-        }
-
-        if (useDepthMap)
-        {
-            bool viewHorizontal = view.getImage().getWidth() > view.getImage().getHeight();
-            bool depthMapHorizontal = result.width() > result.height();
-            if (viewHorizontal != depthMapHorizontal)
+            if (invert)
             {
-                ALICEVISION_LOG_ERROR("Image " << imgPath << " : " << view.getImage().getWidth() << "x" << view.getImage().getHeight());
-                ALICEVISION_LOG_ERROR("Depth Map " << depthMapPath << " : " << result.width() << "x" << result.height());
-                throw std::runtime_error("Depth map orientation is not aligned with source image.");
+                imageMasking::postprocess_invert(result);
             }
-            if (view.getImage().getWidth() != result.width())
+            if (growRadius > 0)
             {
-                ALICEVISION_LOG_DEBUG("Rescale depth map \"" << imgPath << "\" from: " << result.width() << "x" << result.height()
-                                                             << ", to: " << view.getImage().getWidth() << "x" << view.getImage().getHeight());
+                imageMasking::postprocess_dilate(result, growRadius);
+            }
+            if (shrinkRadius > 0)
+            {
+                imageMasking::postprocess_erode(result, shrinkRadius);
+            }
+
+            if (useDepthMap)
+            {
+                bool viewHorizontal = view.getImage().getWidth() > view.getImage().getHeight();
+                bool depthMapHorizontal = result.width() > result.height();
+                if (viewHorizontal != depthMapHorizontal)
+                {
+                    ALICEVISION_LOG_ERROR("Image " << imgPath << " : " << view.getImage().getWidth() << "x" << view.getImage().getHeight());
+                    ALICEVISION_LOG_ERROR("Depth Map " << depthMapPath << " : " << result.width() << "x" << result.height());
+                    throw std::runtime_error("Depth map orientation is not aligned with source image.");
+                }
+                if (view.getImage().getWidth() != result.width())
+                {
+                    ALICEVISION_LOG_DEBUG("Rescale depth map \"" << imgPath << "\" from: " << result.width() << "x" << result.height()
+                                                                 << ", to: " << view.getImage().getWidth() << "x" << view.getImage().getHeight());
 
-                image::Image<unsigned char> rescaled(view.getImage().getWidth(), view.getImage().getHeight());
+                    image::Image<unsigned char> rescaled(view.getImage().getWidth(), view.getImage().getHeight());
 
-                const oiio::ImageBuf inBuf(oiio::ImageSpec(result.width(), result.height(), 1, oiio::TypeDesc::UINT8), result.data());
-                oiio::ImageBuf outBuf(oiio::ImageSpec(rescaled.width(), rescaled.height(), 1, oiio::TypeDesc::UINT8), rescaled.data());
+                    const oiio::ImageBuf inBuf(oiio::ImageSpec(result.width(), result.height(), 1, oiio::TypeDesc::UINT8), result.data());
+                    oiio::ImageBuf outBuf(oiio::ImageSpec(rescaled.width(), rescaled.height(), 1, oiio::TypeDesc::UINT8), rescaled.data());
 
-                oiio::ImageBufAlgo::resize(outBuf, inBuf);
+                    oiio::ImageBufAlgo::resize(outBuf, inBuf);
 
-                result.swap(rescaled);
+                    result.swap(rescaled);
+                }
             }
+            const auto resultFilename = fs::path(std::to_string(index)).replace_extension("png");
+            const std::string resultPath = (fs::path(outputFilePath) / resultFilename).string();
+            image::writeImage(resultPath, result, image::ImageWriteOptions().toColorSpace(image::EImageColorSpace::LINEAR));
+        }
+        catch (const std::exception& e)
+        {
+            // exceptions cannot cross the parallel region: log and report the failure
+            ALICEVISION_LOG_ERROR("Failed to compute the mask of view " << viewRange[i].first << ": " << e.what());
+            hasFailed = true;
         }
-        const auto resultFilename = fs::path(std::to_string(index)).replace_extension("png");
-        const std::string resultPath = (fs::path(outputFilePath) / resultFilename).string();
-        image::writeImage(resultPath, result, image::ImageWriteOptions().toColorSpace(image::EImageColorSpace::LINEAR));
+    }
+
+    if (hasFailed)
+    {
+        return EXIT_FAILURE;
     }
 
     ALICEVISION_LOG_INFO("Task done in (s): " + std::to_string(timer.elapsed()));
@@ -59,12 +59,16 @@ int aliceVision_main(int argc, char** argv)
     std::size_t numImageQuery = 50;
     /// the number of neighbors to retrieve for each image in Sequential Mode
     std::size_t numImageQuerySequential = 50;
+    /// the maximum GPS distance between two paired views in Spatial Mode
+    double spatialMaxDistance = 0.0;
     /// the filename of the voctree
     std::string treeFilepath;
     /// the filename for the voctree weights
     std::string weightsFilepath;
     /// flag for the optional weights file
     bool withWeights = false;
+    /// the filename of the database snapshot for incremental updates
+    std::string databaseSnapshotFilepath;
 
     // multiple SfM parameters
 
@@ -94,7 +98,8 @@ int aliceVision_main(int argc, char** argv)
          " * SequentialAndVocabularyTree: combine both previous approaches\n"
          " * Exhaustive: all images combinations\n"
          " * Frustum: images with camera frustum intersection (only for cameras with known poses)\n"
-         " * FrustumOrVocTree: frustum intersection if cameras with known poses else use VocTree.\n")
+         " * FrustumOrVocTree: frustum intersection if cameras with known poses else use VocTree\n"
+         " * Spatial: images that are spatially close, based on the GPS position from the image metadata.\n")
         ("minNbImages", po::value<std::size_t>(&minNbImages)->default_value(minNbImages),
          "Minimal number of images to use the vocabulary tree. "
          "If we have less images than this threshold, we will compute all matching combinations.")
@@ -104,12 +109,17 @@ int aliceVision_main(int argc, char** argv)
          "The number of matches to retrieve for each image (If 0, it will retrieve all the matches).")
         ("nbNeighbors", po::value<std::size_t>(&numImageQuerySequential)->default_value(numImageQuerySequential),
          "The number of neighbors to retrieve for each image (If 0, it will retrieve all the neighbors).")
+        ("spatialMaxDistance", po::value<double>(&spatialMaxDistance)->default_value(spatialMaxDistance),
+         "Spatial method: maximum distance in meters between the GPS positions of two paired views (If 0, no limit).")
         ("tree,t", po::value<std::string>(&treeFilepath)->default_value(treeFilepath),
          "Input file path of the vocabulary tree. This file can be generated by 'createVoctree'. "
          "This software is intended to be used with a generic, pre-trained vocabulary tree.")
         ("weights,w", po::value<std::string>(&weightsFilepath)->default_value(weightsFilepath),
          "Input name for the vocabulary tree weight file. "
-         "If not provided, all the voctree leaves will have the same weight.");
+         "If not provided, all the voctree leaves will have the same weight.")
+        ("databaseSnapshot", po::value<std::string>(&databaseSnapshotFilepath)->default_value(databaseSnapshotFilepath),
+         "File path of the voctree database snapshot. If the file exists, the documents it contains are reloaded and "
+         "only the new views are quantized; the updated database is saved back to it. Useful for incremental surveys.");
 
     po::options_description multiSfMParams("Multiple SfM");
     multiSfMParams.add_options()
@@ -177,7 +187,7 @@ int aliceVision_main(int argc, char** argv)
 
     std::map<IndexT, std::string> descriptorsFilesA, descriptorsFilesB;
 
-    if (method != EImageMatchingMethod::EXHAUSTIVE && method != EImageMatchingMethod::SEQUENTIAL)
+    if (method != EImageMatchingMethod::EXHAUSTIVE && method != EImageMatchingMethod::SEQUENTIAL && method != EImageMatchingMethod::SPATIAL)
     {
         // load descriptor filenames
         aliceVision::voctree::getListOfDescriptorFiles(sfmDataA, featuresFolders, descriptorsFilesA);
@@ -218,7 +228,8 @@ int aliceVision_main(int argc, char** argv)
                              useMultiSfM,
                              descriptorsFilesA,
                              numImageQuery,
-                             selectedPairs);
+                             selectedPairs,
+                             databaseSnapshotFilepath);
             break;
         }
         case EImageMatchingMethod::SEQUENTIAL:
@@ -244,7 +255,8 @@ int aliceVision_main(int argc, char** argv)
                              useMultiSfM,
                              descriptorsFilesA,
                              numImageQuery,
-                             selectedPairs);
+                             selectedPairs,
+                             databaseSnapshotFilepath);
             break;
         }
         case EImageMatchingMethod::FRUSTUM:
@@ -268,6 +280,12 @@ int aliceVision_main(int argc, char** argv)
         {
             throw std::runtime_error("FRUSTUM_OR_VOCABULARYTREE should have been decided before.");
         }
+        case EImageMatchingMethod::SPATIAL:
+        {
+            ALICEVISION_LOG_INFO("Use SPATIAL matching from the GPS metadata.");
+            generateSpatialMatches(sfmDataA, numImageQuerySequential, spatialMaxDistance, selectedPairs);
+            break;
+        }
     }
 
     // check if the output folder exists
@@ -92,6 +92,7 @@ int aliceVision_main(int argc, char** argv)
     int rangeSize = 1;
     bool useGpu = true;
     bool keepFilename = false;
+    int imageBatchSize = 4;
 
     // Description of mandatory parameters
     // clang-format off
@@ -114,6 +115,9 @@ int aliceVision_main(int argc, char** argv)
          "Use GPU if available.")
         ("keepFilename", po::value<bool>(&keepFilename)->default_value(keepFilename),
          "Keep input filename.")
+        ("imageBatchSize", po::value<int>(&imageBatchSize)->default_value(imageBatchSize),
+         "Number of images segmented together. The tiles of all the images of a group are gathered "
+         "into shared inference batches, at the cost of holding the group of images in memory.")
         ("rangeStart", po::value<int>(&rangeStart)->default_value(rangeStart), 
          "Range start for processing views (ordered by image filepath). Set to -1 to process all images.")
         ("rangeSize", po::value<int>(&rangeSize)->default_value(rangeSize), 
@@ -206,70 +210,98 @@ int aliceVision_main(int argc, char** argv)
         }
     }
 
-    for (int itemidx = 0; itemidx < rangeSize; itemidx++)
+    imageBatchSize = std::max(1, imageBatchSize);
+
+    // Process the views by groups, so that the tiles of all the images of a group can be
+    // gathered into shared inference batches
+    for (int groupStart = 0; groupStart < rangeSize; groupStart += imageBatchSize)
     {
-        const auto& view = viewsOrderedByName[rangeStart + itemidx];
+        const int groupSize = std::min(imageBatchSize, rangeSize - groupStart);
 
-        std::string path = view->getImage().getImagePath();
-        ALICEVISION_LOG_INFO("processing " << path);
+        std::vector<image::Image<image::RGBfColor>> images(groupSize);
+        std::vector<double> pixelRatios(groupSize, 1.0);
 
-        const fs::path fsPath = path;
-        const std::string fileName = fsPath.stem().string();
+        for (int itemidx = 0; itemidx < groupSize; itemidx++)
+        {
+            const auto& view = viewsOrderedByName[rangeStart + groupStart + itemidx];
 
-        image::Image<image::RGBfColor> image;
-        image::readImage(path, image, image::EImageColorSpace::SRGB);
+            const std::string path = view->getImage().getImagePath();
+            ALICEVISION_LOG_INFO("processing " << path);
 
-        double pixelRatio = 1.0;
-        view->getImage().getDoubleMetadata({"PixelAspectRatio"}, pixelRatio);
-        if (pixelRatio != 1.0)
-        {
-            // Resample input image in order to work with square pixels
-            const int w = image.width();
-            const int h = image.height();
+            image::Image<image::RGBfColor>& image = images[itemidx];
+            image::readImage(path, image, image::EImageColorSpace::SRGB);
 
-            const int nw = static_cast<int>(static_cast<double>(w) * pixelRatio);
-            const int nh = h;
+            double& pixelRatio = pixelRatios[itemidx];
+            view->getImage().getDoubleMetadata({"PixelAspectRatio"}, pixelRatio);
+            if (pixelRatio != 1.0)
+            {
+                // Resample input image in order to work with square pixels
+                const int w = image.width();
+                const int h = image.height();
 
-            image::Image<image::RGBfColor> resizedInput;
-            imageAlgo::resizeImage(nw, nh, image, resizedInput);
-            image.swap(resizedInput);
+                const int nw = static_cast<int>(static_cast<double>(w) * pixelRatio);
+                const int nh = h;
+
+                image::Image<image::RGBfColor> resizedInput;
+                imageAlgo::resizeImage(nw, nh, image, resizedInput);
+                image.swap(resizedInput);
+            }
         }
 
-        image::Image<IndexT> labels;
-        if (!seg.processImage(labels, image))
+        std::vector<const image::Image<image::RGBfColor>*> sources;
+        for (const auto& image : images)
         {
-            ALICEVISION_LOG_INFO("Failed to segment image " << path);
+            sources.push_back(&image);
         }
 
-        image::Image<unsigned char> mask(labels.width(), labels.height());
-        labelsToMask(mask, labels, validClassesIndices, maskInvert);
+        std::vector<image::Image<IndexT>> labelsGroup;
+        if (!seg.processImageBatch(labelsGroup, sources))
+        {
+            ALICEVISION_LOG_INFO("Failed to segment image group starting at view "
+                                 << viewsOrderedByName[rangeStart + groupStart]->getImage().getImagePath());
+            continue;
+        }
 
-        if (pixelRatio != 1.0)
+        for (int itemidx = 0; itemidx < groupSize; itemidx++)
         {
-            // Resample input image in order to work with square pixels
-            const int w = mask.width();
-            const int h = mask.height();
+            const auto& view = viewsOrderedByName[rangeStart + groupStart + itemidx];
 
-            const int nw = static_cast<int>(static_cast<double>(w) / pixelRatio);
-            const int nh = h;
+            const fs::path fsPath = view->getImage().getImagePath();
+            const std::string fileName = fsPath.stem().string();
 
-            image::Image<unsigned char> resizedMask;
-            imageAlgo::resizeImage(nw, nh, mask, resizedMask);
-            mask.swap(resizedMask);
-        }
+            const image::Image<IndexT>& labels = labelsGroup[itemidx];
+            const double pixelRatio = pixelRatios[itemidx];
 
-        // Store image
-        std::stringstream ss;
-        if (keepFilename)
-        {
-            ss << outputPath << "/" << fileName << ".exr";
-        }
-        else
-        {
-            ss << outputPath << "/" << view->getViewId() << ".exr";
-        }
+            image::Image<unsigned char> mask(labels.width(), labels.height());
+            labelsToMask(mask, labels, validClassesIndices, maskInvert);
 
-        image::writeImage(ss.str(), mask, image::ImageWriteOptions());
+            if (pixelRatio != 1.0)
+            {
+                // Resample input image in order to work with square pixels
+                const int w = mask.width();
+                const int h = mask.height();
+
+                const int nw = static_cast<int>(static_cast<double>(w) / pixelRatio);
+                const int nh = h;
+
+                image::Image<unsigned char> resizedMask;
+                imageAlgo::resizeImage(nw, nh, mask, resizedMask);
+                mask.swap(resizedMask);
+            }
+
+            // Store image
+            std::stringstream ss;
+            if (keepFilename)
+            {
+                ss << outputPath << "/" << fileName << ".exr";
+            }
+            else
+            {
+                ss << outputPath << "/" << view->getViewId() << ".exr";
+            }
+
+            image::writeImage(ss.str(), mask, image::ImageWriteOptions());
+        }
     }
 
     return EXIT_SUCCESS;
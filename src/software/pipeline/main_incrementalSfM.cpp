@@ -91,6 +91,7 @@ int aliceVision_main(int argc, char** argv)
 
     int randomSeed = std::mt19937::default_seed;
     bool logIntermediateSteps = false;
+    std::string resumeFromFolder;
 
     // clang-format off
     po::options_description requiredParams("Required parameters");
@@ -160,9 +161,16 @@ int aliceVision_main(int argc, char** argv)
         ("maxImagesPerGroup", po::value<std::size_t>(&sfmParams.maxImagesPerGroup)->default_value(sfmParams.maxImagesPerGroup),
          "Maximum number of cameras that can be added before the bundle adjustment is performed. "
          "This prevents adding too much data at once without performing the bundle adjustment.")
+        ("useBatchResection", po::value<bool>(&sfmParams.useBatchResection)->default_value(sfmParams.useBatchResection),
+         "Resect all the candidate views of an iteration in a single parallel group instead of several small groups, "
+         "so that the pose estimation phase scales with the number of cores on large datasets. "
+         "A bundle adjustment is always performed after each batch.")
         ("bundleAdjustmentMaxOutliers", po::value<int>(&sfmParams.bundleAdjustmentMaxOutliers)->default_value(sfmParams.bundleAdjustmentMaxOutliers),
          "Threshold for the maximum number of outliers allowed at the end of a bundle adjustment iteration."
          "Using a negative value for this threshold will disable BA iterations.")
+        ("bundleSolver", po::value<sfm::EBASolverBackend>(&sfmParams.bundleSolverBackend)->default_value(sfmParams.bundleSolverBackend),
+         "Hardware backend of the bundle adjustment linear solver (cpu, gpu). "
+         "'gpu' uses the CUDA dense solver of Ceres and falls back to the CPU if CUDA is not available.")
         ("localizerEstimator", po::value<robustEstimation::ERobustEstimator>(&sfmParams.localizerEstimator)->default_value(sfmParams.localizerEstimator),
          "Estimator type used to localize cameras (acransac (default), ransac, lsmeds, loransac, maxconsensus).")
         ("localizerEstimatorError", po::value<double>(&sfmParams.localizerEstimatorError)->default_value(0.0),
@@ -190,7 +198,12 @@ int aliceVision_main(int argc, char** argv)
         ("randomSeed", po::value<int>(&randomSeed)->default_value(randomSeed),
          "This seed value will generate a sequence using a linear random generator. Set -1 to use a random seed.")
         ("logIntermediateSteps", po::value<bool>(&sfmParams.logIntermediateSteps)->default_value(logIntermediateSteps),
-         "If set to true, the current state of the scene will be dumped as an SfMData file every 3 resections.");
+         "If set to true, the current state of the scene will be dumped as an SfMData file every 3 resections.")
+        ("checkpointSteps", po::value<std::size_t>(&sfmParams.checkpointSteps)->default_value(sfmParams.checkpointSteps),
+         "Write a resume checkpoint in the output folder every N resection groups (0: disabled).")
+        ("resumeFrom", po::value<std::string>(&resumeFromFolder)->default_value(resumeFromFolder),
+         "Folder containing a resume checkpoint written by a previous run (see --checkpointSteps). "
+         "The reconstruction restarts from the last checkpointed resection group.");
     // clang-format on
 
     CmdLine cmdline("Sequential/Incremental reconstruction.\n"
@@ -307,6 +320,12 @@ int aliceVision_main(int argc, char** argv)
     sfmEngine.setFeatures(&featuresPerView);
     sfmEngine.setMatches(&pairwiseMatches);
 
+    if (!resumeFromFolder.empty() && !sfmEngine.loadCheckpoint(resumeFromFolder))
+    {
+        ALICEVISION_LOG_ERROR("Unable to resume from checkpoint folder: " << resumeFromFolder);
+        return EXIT_FAILURE;
+    }
+
     if (!sfmEngine.process())
         return EXIT_FAILURE;
 
@@ -22,8 +22,16 @@
 #include <aliceVision/mesh/Mesh.hpp>
 #include <aliceVision/mesh/meshPostProcessing.hpp>
 
+#include <aliceVision/system/MemoryInfo.hpp>
+
 #include <boost/program_options.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
 #include <fstream>
+#include <mutex>
+#include <thread>
 
 
 // These constants define the current software version.
@@ -34,6 +42,7 @@
 using namespace aliceVision;
 
 namespace po = boost::program_options;
+namespace fs = std::filesystem;
 
 bool computeSubMesh(const std::string & pathSfmData, std::string & outputFile, const fuseCut::BoundingBox & boundingBox)
 {
@@ -129,6 +138,9 @@ int aliceVision_main(int argc, char* argv[])
     int rangeStart = -1;
     int rangeSize = 1;
 
+    int nbConcurrentNodes = 1;
+    double minAvailableMemoryGB = 0.0;
+
     std::string jsonFilename = "";
     std::string outputDirectory = "";
     std::string outputJsonFilename = "";
@@ -152,7 +164,13 @@ int aliceVision_main(int argc, char* argv[])
         ("rangeStart", po::value<int>(&rangeStart)->default_value(rangeStart),
          "Range image index start.")
         ("rangeSize", po::value<int>(&rangeSize)->default_value(rangeSize),
-         "Range size.");
+         "Range size.")
+        ("nbConcurrentNodes", po::value<int>(&nbConcurrentNodes)->default_value(nbConcurrentNodes),
+         "Number of decomposition nodes computed concurrently inside this process. "
+         "Each node keeps its own multithreading, so lower OMP_NUM_THREADS accordingly when raising this.")
+        ("minAvailableMemoryGB", po::value<double>(&minAvailableMemoryGB)->default_value(minAvailableMemoryGB),
+         "Delay the start of the next concurrent node while the available system memory is below this amount (0: no check). "
+         "One node is always allowed to run to guarantee progress.");
     // clang-format on
 
     CmdLine cmdline("AliceVision lidarMeshing");
@@ -200,21 +218,97 @@ int aliceVision_main(int argc, char* argv[])
         rangeSize = setSize;
     }
 
-    for (int idSub = rangeStart; idSub < rangeStart + rangeSize; idSub++)
+    std::atomic<int> nextNode(rangeStart);
+    std::atomic<int> nbRunningNodes(0);
+    std::atomic<bool> failed(false);
+    std::mutex outputMutex;
+
+    const auto computeNode = [&](int idSub)
     {
         const fuseCut::Input & input = inputsets[idSub];
         std::string ss = outputDirectory + "/subobj_" + std::to_string(idSub) + ".obj";
+        const std::string marker = outputDirectory + "/subobj_" + std::to_string(idSub) + ".done";
 
-        ALICEVISION_LOG_INFO("Computing sub mesh " << idSub + 1 << " / " << setSize);
-        if (!computeSubMesh(input.sfmPath, ss, boundingBox))
+        // A completion marker is written next to each sub mesh, the sub mesh file alone
+        // could be a partial write from a killed job.
+        if (fs::exists(marker) && fs::exists(ss))
         {
-            ALICEVISION_LOG_ERROR("Error computing sub mesh");
-            return EXIT_FAILURE;
+            ALICEVISION_LOG_INFO("Sub mesh " << idSub + 1 << " / " << setSize << " already computed.");
+        }
+        else
+        {
+            ALICEVISION_LOG_INFO("Computing sub mesh " << idSub + 1 << " / " << setSize);
+            if (!computeSubMesh(input.sfmPath, ss, boundingBox))
+            {
+                ALICEVISION_LOG_ERROR("Error computing sub mesh");
+                failed = true;
+                return;
+            }
+
+            std::ofstream(marker).close();
         }
 
-        inputsets[idSub].subMeshPath = ss;
+        {
+            const std::lock_guard<std::mutex> lock(outputMutex);
+            inputsets[idSub].subMeshPath = ss;
+        }
 
         ALICEVISION_LOG_INFO(ss);
+    };
+
+    const auto worker = [&]()
+    {
+        while (!failed)
+        {
+            const int idSub = nextNode++;
+            if (idSub >= rangeStart + rangeSize)
+            {
+                return;
+            }
+
+            // Wait for memory room before starting another node,
+            // except when no node is running to guarantee progress.
+            if (minAvailableMemoryGB > 0.0)
+            {
+                const std::size_t minAvailableBytes = std::size_t(minAvailableMemoryGB * 1024.0 * 1024.0 * 1024.0);
+                while (nbRunningNodes > 0 && system::getMemoryInfo().availableRam < minAvailableBytes)
+                {
+                    if (failed)
+                    {
+                        return;
+                    }
+
+                    std::this_thread::sleep_for(std::chrono::seconds(10));
+                }
+            }
+
+            ++nbRunningNodes;
+            computeNode(idSub);
+            --nbRunningNodes;
+        }
+    };
+
+    if (nbConcurrentNodes <= 1)
+    {
+        worker();
+    }
+    else
+    {
+        std::vector<std::thread> workers;
+        for (int i = 0; i < nbConcurrentNodes; ++i)
+        {
+            workers.emplace_back(worker);
+        }
+
+        for (std::thread & workerThread : workers)
+        {
+            workerThread.join();
+        }
+    }
+
+    if (failed)
+    {
+        return EXIT_FAILURE;
     }
 
     std::ofstream of(outputJsonFilename);
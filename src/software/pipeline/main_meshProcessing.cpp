@@ -0,0 +1,515 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2025 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <aliceVision/cmdline/cmdline.hpp>
+#include <aliceVision/system/Logger.hpp>
+#include <aliceVision/system/main.hpp>
+#include <aliceVision/system/Timer.hpp>
+#include <aliceVision/mesh/MeshEnergyOpt.hpp>
+#include <aliceVision/mesh/Texturing.hpp>
+#include <aliceVision/mesh/geoMesh.hpp>
+#include <aliceVision/mvsUtils/common.hpp>
+
+#include <OpenMesh/Core/Mesh/TriMesh_ArrayKernelT.hh>
+#include <OpenMesh/Core/Geometry/VectorT.hh>
+#include <OpenMesh/Tools/Decimater/DecimaterT.hh>
+#include <OpenMesh/Tools/Decimater/ModQuadricT.hh>
+
+#include <geogram/mesh/mesh.h>
+#include <geogram/mesh/mesh_remesh.h>
+
+#include <geogram/basic/command_line.h>
+#include <geogram/basic/command_line_args.h>
+
+#include <boost/program_options.hpp>
+
+#include <filesystem>
+
+// These constants define the current software version.
+// They must be updated when the command line is changed.
+#define ALICEVISION_SOFTWARE_VERSION_MAJOR 1
+#define ALICEVISION_SOFTWARE_VERSION_MINOR 0
+
+using namespace aliceVision;
+
+namespace fs = std::filesystem;
+namespace po = boost::program_options;
+
+enum class ESubsetType : unsigned char
+{
+    ALL = 0,
+    SURFACE_BOUNDARIES = 1,
+    SURFACE_INNER_PART = 2
+};
+
+/**
+ * @brief get informations about each subset type
+ * @return String
+ */
+std::string ESubsetType_informations()
+{
+    return "Subset types used:\n"
+           "* all: the entire mesh.\n"
+           "* surface_boundaries: mesh surface boundaries.\n"
+           "* surface_inner_part: mesh surface inner part.\n";
+}
+
+/**
+ * @brief convert an enum ESubsetType to its corresponding string
+ * @param ESubsetType
+ * @return String
+ */
+std::string ESubsetType_enumToString(ESubsetType subsetType)
+{
+    switch (subsetType)
+    {
+        case ESubsetType::ALL:
+            return "all";
+        case ESubsetType::SURFACE_BOUNDARIES:
+            return "surface_boundaries";
+        case ESubsetType::SURFACE_INNER_PART:
+            return "surface_inner_part";
+    }
+    throw std::out_of_range("Invalid SubsetType enum: " + std::to_string(int(subsetType)));
+}
+
+/**
+ * @brief convert a string subsetType to its corresponding enum ESubsetType
+ * @param String
+ * @return ESubsetType
+ */
+ESubsetType ESubsetType_stringToEnum(const std::string& subsetType)
+{
+    std::string type = subsetType;
+    std::transform(type.begin(), type.end(), type.begin(), ::tolower);  // tolower
+
+    if (type == "all")
+        return ESubsetType::ALL;
+    if (type == "surface_boundaries")
+        return ESubsetType::SURFACE_BOUNDARIES;
+    if (type == "surface_inner_part")
+        return ESubsetType::SURFACE_INNER_PART;
+    throw std::out_of_range("Invalid filterType: " + subsetType);
+}
+
+std::ostream& operator<<(std::ostream& os, const ESubsetType subsetType)
+{
+    os << ESubsetType_enumToString(subsetType);
+    return os;
+}
+
+std::istream& operator>>(std::istream& in, ESubsetType& subsetType)
+{
+    std::string token(std::istreambuf_iterator<char>(in), {});
+    subsetType = ESubsetType_stringToEnum(token);
+    return in;
+}
+
+// OpenMesh types used for decimation
+typedef OpenMesh::TriMesh_ArrayKernelT<> OMesh;
+typedef OpenMesh::Decimater::DecimaterT<OMesh> Decimater;
+typedef OpenMesh::Decimater::ModQuadricT<OMesh>::Handle HModQuadric;
+
+/**
+ * @brief Compute the target number of output vertices from the simplification parameters.
+ * @return the target number of vertices, 0 if no parameter is set
+ */
+int computeTargetNbVertices(int nbInputPoints, float simplificationFactor, int fixedNbVertices, int minVertices, int maxVertices)
+{
+    int nbOutputPoints = 0;
+    if (fixedNbVertices != 0)
+    {
+        nbOutputPoints = fixedNbVertices;
+    }
+    else
+    {
+        if (simplificationFactor != 0.0)
+        {
+            nbOutputPoints = simplificationFactor * nbInputPoints;
+        }
+        if (minVertices != 0)
+        {
+            if (nbInputPoints > minVertices && nbOutputPoints < minVertices)
+                nbOutputPoints = minVertices;
+        }
+        if (maxVertices != 0)
+        {
+            if (nbInputPoints > maxVertices && nbOutputPoints > maxVertices)
+                nbOutputPoints = maxVertices;
+        }
+    }
+    return nbOutputPoints;
+}
+
+/**
+ * @brief Create an OpenMesh mesh from an aliceVision::Mesh (vertices and facets only).
+ */
+void toOpenMesh(const mesh::Mesh& src, OMesh& dst)
+{
+    std::vector<OMesh::VertexHandle> vertexHandles(src.pts.size());
+    for (int i = 0; i < src.pts.size(); ++i)
+    {
+        const Point3d& p = src.pts[i];
+        vertexHandles[i] = dst.add_vertex(OMesh::Point(p.x, p.y, p.z));
+    }
+    for (int i = 0; i < src.tris.size(); ++i)
+    {
+        const mesh::Mesh::triangle& t = src.tris[i];
+        dst.add_face(vertexHandles[t.v[0]], vertexHandles[t.v[1]], vertexHandles[t.v[2]]);
+    }
+}
+
+/**
+ * @brief Replace the vertices and facets of an aliceVision::Mesh with the OpenMesh ones.
+ */
+void fromOpenMesh(const OMesh& src, mesh::Mesh& dst)
+{
+    dst.pts.clear();
+    dst.tris.clear();
+    dst.pts.reserve(src.n_vertices());
+    for (const auto vh : src.vertices())
+    {
+        const OMesh::Point& p = src.point(vh);
+        dst.pts.push_back(Point3d(p[0], p[1], p[2]));
+    }
+    dst.tris.reserve(src.n_faces());
+    for (const auto fh : src.faces())
+    {
+        mesh::Mesh::triangle t;
+        int k = 0;
+        for (auto fvIt = src.cfv_iter(fh); fvIt.is_valid(); ++fvIt)
+            t.v[k++] = fvIt->idx();
+        dst.tris.push_back(t);
+    }
+    dst.invalidateAdjacencyCache();
+}
+
+/**
+ * @brief Replace the vertices and facets of an aliceVision::Mesh with the GEO::Mesh ones.
+ */
+void fromGeoMesh(const GEO::Mesh& src, mesh::Mesh& dst)
+{
+    dst.pts.clear();
+    dst.tris.clear();
+    dst.pts.reserve(src.vertices.nb());
+    for (GEO::index_t v = 0; v < src.vertices.nb(); ++v)
+    {
+        const GEO::vec3& p = src.vertices.point(v);
+        dst.pts.push_back(Point3d(p.x, p.y, p.z));
+    }
+    dst.tris.reserve(src.facets.nb());
+    for (GEO::index_t f = 0; f < src.facets.nb(); ++f)
+    {
+        dst.tris.push_back(mesh::Mesh::triangle(src.facets.vertex(f, 0), src.facets.vertex(f, 1), src.facets.vertex(f, 2)));
+    }
+    dst.invalidateAdjacencyCache();
+}
+
+int aliceVision_main(int argc, char* argv[])
+{
+    // timer initialization
+
+    system::Timer timer;
+
+    // command-line required parameters
+    std::string inputMeshPath;
+    std::string outputMeshPath;
+
+    bool keepLargestMeshOnly = false;
+    bool flipNormals = false;
+
+    // command-line smoothing parameters
+
+    std::string smoothingSubsetTypeName = ESubsetType_enumToString(ESubsetType::ALL);
+    int smoothingBoundariesNeighbours = 0;
+    int smoothNIter = 10;
+    float lambda = 1.0f;
+
+    // command-line filtering parameters
+
+    std::string filteringSubsetTypeName = ESubsetType_enumToString(ESubsetType::ALL);
+    int filteringIterations = 1;
+    double filterLargeTrianglesFactor = 60.0;
+    double filterTrianglesRatio = 0.0;
+
+    // command-line decimation parameters
+
+    float decimateFactor = 0;
+    int decimateNbVertices = 0;
+    int decimateMinVertices = 0;
+    int decimateMaxVertices = 0;
+
+    // command-line resampling parameters
+
+    float resampleFactor = 0;
+    int resampleNbVertices = 0;
+    int resampleMinVertices = 0;
+    int resampleMaxVertices = 0;
+    unsigned int nbLloydIter = 40;
+
+    // clang-format off
+    po::options_description requiredParams("Required parameters");
+    requiredParams.add_options()
+        ("inputMesh,i", po::value<std::string>(&inputMeshPath)->required(),
+         "Input mesh.")
+        ("outputMesh,o", po::value<std::string>(&outputMeshPath)->required(),
+         "Output mesh.");
+
+    po::options_description optionalParams("Optional parameters");
+    optionalParams.add_options()
+        ("keepLargestMeshOnly", po::value<bool>(&keepLargestMeshOnly)->default_value(keepLargestMeshOnly),
+         "Keep only the largest connected triangles group.")
+        ("smoothingSubset",po::value<std::string>(&smoothingSubsetTypeName)->default_value(smoothingSubsetTypeName),
+         ESubsetType_informations().c_str())
+        ("smoothingBoundariesNeighbours", po::value<int>(&smoothingBoundariesNeighbours)->default_value(smoothingBoundariesNeighbours),
+         "Neighbours of the boudaries to consider.")
+        ("smoothingIterations", po::value<int>(&smoothNIter)->default_value(smoothNIter),
+         "Number of smoothing iterations.")
+        ("smoothingLambda", po::value<float>(&lambda)->default_value(lambda),
+         "Smoothing size.")
+        ("filteringSubset",po::value<std::string>(&filteringSubsetTypeName)->default_value(filteringSubsetTypeName),
+         ESubsetType_informations().c_str())
+        ("filteringIterations", po::value<int>(&filteringIterations)->default_value(filteringIterations),
+         "Number of mesh filtering iterations.")
+        ("filterLargeTrianglesFactor", po::value<double>(&filterLargeTrianglesFactor)->default_value(filterLargeTrianglesFactor),
+         "Remove all large triangles. We consider a triangle as large if one edge is bigger than N times the average "
+         "edge length. Set to 0 to disable it.")
+        ("filterTrianglesRatio", po::value<double>(&filterTrianglesRatio)->default_value(filterTrianglesRatio),
+         "Remove all triangles by ratio (largest edge /smallest edge). Set to 0 to disable it.")
+        ("decimateFactor", po::value<float>(&decimateFactor)->default_value(decimateFactor),
+         "Decimation simplification factor. Set all the decimate options to 0 to skip the decimation stage.")
+        ("decimateNbVertices", po::value<int>(&decimateNbVertices)->default_value(decimateNbVertices),
+         "Fixed number of output vertices for the decimation stage.")
+        ("decimateMinVertices", po::value<int>(&decimateMinVertices)->default_value(decimateMinVertices),
+         "Min number of output vertices for the decimation stage.")
+        ("decimateMaxVertices", po::value<int>(&decimateMaxVertices)->default_value(decimateMaxVertices),
+         "Max number of output vertices for the decimation stage.")
+        ("resampleFactor", po::value<float>(&resampleFactor)->default_value(resampleFactor),
+         "Resampling simplification factor. Set all the resample options to 0 to skip the resampling stage.")
+        ("resampleNbVertices", po::value<int>(&resampleNbVertices)->default_value(resampleNbVertices),
+         "Fixed number of output vertices for the resampling stage.")
+        ("resampleMinVertices", po::value<int>(&resampleMinVertices)->default_value(resampleMinVertices),
+         "Min number of output vertices for the resampling stage.")
+        ("resampleMaxVertices", po::value<int>(&resampleMaxVertices)->default_value(resampleMaxVertices),
+         "Max number of output vertices for the resampling stage.")
+        ("nbLloydIter", po::value<unsigned int>(&nbLloydIter)->default_value(nbLloydIter),
+         "Number of iterations for Lloyd pre-smoothing in the resampling stage.")
+        ("flipNormals", po::value<bool>(&flipNormals)->default_value(flipNormals),
+         "Option to flip face normals. It can be needed as it depends on the vertices order in triangles and the "
+         "convention changes from one software to another.");
+    // clang-format on
+
+    CmdLine cmdline("AliceVision meshProcessing");
+    cmdline.add(requiredParams);
+    cmdline.add(optionalParams);
+    if (!cmdline.execute(argc, argv))
+    {
+        return EXIT_FAILURE;
+    }
+
+    // check and set smoothing subset type
+    const ESubsetType smoothingSubsetType = ESubsetType_stringToEnum(smoothingSubsetTypeName);
+
+    // check and set filtering subset type
+    const ESubsetType filteringSubsetType = ESubsetType_stringToEnum(filteringSubsetTypeName);
+
+    fs::path outDirectory = fs::path(outputMeshPath).parent_path();
+    if (!fs::is_directory(outDirectory))
+        fs::create_directory(outDirectory);
+
+    mesh::Texturing texturing;
+    texturing.loadWithAtlas(inputMeshPath);
+    mesh::Mesh* mesh = texturing.mesh;
+
+    if (!mesh)
+    {
+        ALICEVISION_LOG_ERROR("Unable to read input mesh from the file: " << inputMeshPath);
+        return EXIT_FAILURE;
+    }
+
+    if (mesh->pts.empty() || mesh->tris.empty())
+    {
+        ALICEVISION_LOG_ERROR("Error: empty mesh from the file " << inputMeshPath);
+        ALICEVISION_LOG_ERROR("Input mesh: " << mesh->pts.size() << " vertices and " << mesh->tris.size() << " facets.");
+        return EXIT_FAILURE;
+    }
+
+    ALICEVISION_LOG_INFO("Mesh file: \"" << inputMeshPath << "\" loaded.");
+    ALICEVISION_LOG_INFO("Input mesh: " << mesh->pts.size() << " vertices and " << mesh->tris.size() << " facets.");
+
+    StaticVectorBool ptsCanMove;  // empty if smoothingSubsetType is ALL
+
+    // lock filter subset vertices
+    switch (smoothingSubsetType)
+    {
+        case ESubsetType::ALL:
+            break;  // nothing to lock
+
+        case ESubsetType::SURFACE_BOUNDARIES:
+            mesh->lockSurfaceBoundaries(smoothingBoundariesNeighbours, ptsCanMove, true);  // invert = true (lock surface inner part)
+            break;
+
+        case ESubsetType::SURFACE_INNER_PART:
+            mesh->lockSurfaceBoundaries(smoothingBoundariesNeighbours, ptsCanMove, false);  // invert = false (lock surface boundaries)
+            break;
+    }
+
+    // filtering
+    if ((filterLargeTrianglesFactor != 0.0) || (filterTrianglesRatio != 0.0))
+    {
+        ALICEVISION_LOG_INFO("Start mesh filtering.");
+
+        for (int i = 0; i < filteringIterations; ++i)
+        {
+            ALICEVISION_LOG_INFO("Mesh filtering: iteration " << i);
+
+            StaticVectorBool trisToStay(mesh->tris.size(), true);
+            StaticVectorBool trisInFilterSubset;  // empty if filteringSubsetType is ALL
+
+            switch (filteringSubsetType)
+            {
+                case ESubsetType::ALL:
+                    break;  // nothing to do
+
+                case ESubsetType::SURFACE_BOUNDARIES:
+                    mesh->getSurfaceBoundaries(trisInFilterSubset);  // invert = false (get surface boundaries)
+                    break;
+
+                case ESubsetType::SURFACE_INNER_PART:
+                    mesh->getSurfaceBoundaries(trisInFilterSubset, true);  // invert = true (get surface inner part)
+                    break;
+            }
+
+            if (filterLargeTrianglesFactor != 0.0)
+                mesh->filterLargeEdgeTriangles(filterLargeTrianglesFactor, trisInFilterSubset, trisToStay);
+
+            if (filterTrianglesRatio != 0.0)
+                mesh->filterTrianglesByRatio(filterTrianglesRatio, trisInFilterSubset, trisToStay);
+
+            mesh->letJustTringlesIdsInMesh(trisToStay);
+        }
+        ALICEVISION_LOG_INFO("Mesh filtering done: " << mesh->pts.size() << " vertices and " << mesh->tris.size() << " facets.");
+    }
+
+    // smoothing
+    mesh::MeshEnergyOpt meOpt(nullptr);
+    {
+        ALICEVISION_LOG_INFO("Start mesh smoothing.");
+        meOpt.addMesh(*mesh);
+        meOpt.init();
+        meOpt.cleanMesh(10);
+        meOpt.optimizeSmooth(lambda, smoothNIter, ptsCanMove);
+        ALICEVISION_LOG_INFO("Mesh smoothing done: " << meOpt.pts.size() << " vertices and " << meOpt.tris.size() << " facets.");
+    }
+
+    if (keepLargestMeshOnly)
+    {
+        StaticVector<int> trisIdsToStay;
+        meOpt.getLargestConnectedComponentTrisIds(trisIdsToStay);
+        meOpt.letJustTringlesIdsInMesh(trisIdsToStay);
+        ALICEVISION_LOG_INFO("Mesh after keepLargestMeshOnly: " << meOpt.pts.size() << " vertices and " << meOpt.tris.size() << " facets.");
+    }
+
+    // clear potential free points created by triangles removal in previous cleaning operations
+    StaticVector<int> ptIdToNewPtId;
+    meOpt.removeFreePointsFromMesh(ptIdToNewPtId);
+    ptIdToNewPtId.clear();
+
+    mesh::Mesh outMesh;
+    outMesh.addMesh(meOpt);
+
+    // decimation, done in memory on the filtered mesh
+    const int decimateTarget =
+      computeTargetNbVertices(outMesh.pts.size(), decimateFactor, decimateNbVertices, decimateMinVertices, decimateMaxVertices);
+    if (decimateTarget > 0 && decimateTarget < outMesh.pts.size())
+    {
+        ALICEVISION_LOG_INFO("Start mesh decimation (target: " << decimateTarget << " vertices).");
+
+        OMesh om;
+        toOpenMesh(outMesh, om);
+
+        // a decimater object, connected to a mesh
+        Decimater decimater(om);
+        // use a quadric module
+        HModQuadric hModQuadric;
+        // register module at the decimater
+        decimater.add(hModQuadric);
+
+        /*
+         * since we need exactly one priority module (non-binary)
+         * we have to call set_binary(false) for our priority module
+         * in the case of HModQuadric, unset_max_err() calls set_binary(false) internally
+         */
+        decimater.module(hModQuadric).unset_max_err();
+        // let the decimater initialize the mesh and the modules
+        decimater.initialize();
+        // do decimation
+        decimater.decimate_to(decimateTarget);
+        decimater.mesh().garbage_collection();
+
+        fromOpenMesh(om, outMesh);
+        ALICEVISION_LOG_INFO("Mesh decimation done: " << outMesh.pts.size() << " vertices and " << outMesh.tris.size() << " facets.");
+    }
+
+    // resampling, done in memory on the decimated mesh
+    const int resampleTarget =
+      computeTargetNbVertices(outMesh.pts.size(), resampleFactor, resampleNbVertices, resampleMinVertices, resampleMaxVertices);
+    if (resampleTarget > 0)
+    {
+        ALICEVISION_LOG_INFO("Start mesh resampling (target: " << resampleTarget << " vertices).");
+
+        GEO::initialize();
+        GEO::CmdLine::import_arg_group("standard");
+        GEO::CmdLine::import_arg_group("remesh");  // needed for remesh_smooth
+        GEO::CmdLine::import_arg_group("algo");
+        GEO::CmdLine::import_arg_group("post");
+        GEO::CmdLine::import_arg_group("opt");
+        GEO::CmdLine::import_arg_group("poly");
+
+        const unsigned int nbNewtonIter = 0;
+        const unsigned int newtonM = 0;
+
+        GEO::Mesh M_in, M_out;
+        mesh::toGeoMesh(outMesh, M_in);
+
+        GEO::remesh_smooth(M_in,
+                           M_out,
+                           resampleTarget,
+                           3,             // 3 dimensions
+                           nbLloydIter,   // Number of iterations for Lloyd pre-smoothing
+                           nbNewtonIter,  // Number of iterations for Newton-CVT
+                           newtonM        // Number of evaluations for Hessian approximation
+        );
+
+        fromGeoMesh(M_out, outMesh);
+        ALICEVISION_LOG_INFO("Mesh resampling done: " << outMesh.pts.size() << " vertices and " << outMesh.tris.size() << " facets.");
+    }
+
+    if (outMesh.pts.empty() || outMesh.tris.empty())
+    {
+        ALICEVISION_LOG_ERROR("Failed: the output mesh is empty.");
+        ALICEVISION_LOG_INFO("Output mesh: " << outMesh.pts.size() << " vertices and " << outMesh.tris.size() << " facets.");
+        return EXIT_FAILURE;
+    }
+
+    if (flipNormals)
+    {
+        for (int i = 0; i < outMesh.tris.size(); ++i)
+            std::swap(outMesh.tris[i].v[1], outMesh.tris[i].v[2]);
+        outMesh.invalidateAdjacencyCache();
+    }
+
+    ALICEVISION_LOG_INFO("Output mesh: " << outMesh.pts.size() << " vertices and " << outMesh.tris.size() << " facets.");
+    ALICEVISION_LOG_INFO("Save mesh.");
+
+    // Save output mesh
+    outMesh.save(outputMeshPath);
+
+    ALICEVISION_LOG_INFO("Mesh file: \"" << outputMeshPath << "\" saved.");
+
+    ALICEVISION_LOG_INFO("Task done in (s): " + std::to_string(timer.elapsed()));
+    return EXIT_SUCCESS;
+}
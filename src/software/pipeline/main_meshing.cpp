@@ -21,6 +21,7 @@
 #include <aliceVision/system/Logger.hpp>
 #include <aliceVision/system/main.hpp>
 #include <aliceVision/system/Timer.hpp>
+#include <aliceVision/system/Trace.hpp>
 #include <aliceVision/fuseCut/GraphFiller.hpp>
 #include <aliceVision/fuseCut/Mesher.hpp>
 
@@ -28,7 +29,9 @@
 
 #include <boost/program_options.hpp>
 
+#include <algorithm>
 #include <filesystem>
+#include <functional>
 #include <cmath>
 
 // These constants define the current software version.
@@ -168,6 +171,10 @@ int aliceVision_main(int argc, char* argv[])
     double fullWeight = 1.0;
     bool exportDebugTetrahedralization = false;
     int maxNbConnectedHelperPoints = 50;
+    int autoPartitioningNbBlocks = 2;
+    double autoPartitioningOverlapRatio = 0.1;
+    int rangeStart = -1;
+    int rangeSize = -1;
 
     // clang-format off
     po::options_description requiredParams("Required parameters");
@@ -265,6 +272,20 @@ int aliceVision_main(int argc, char* argv[])
          "Number of iterations to filter the status cells based on solid angle ratio.")
         ("maxNbConnectedHelperPoints", po::value<int>(&maxNbConnectedHelperPoints)->default_value(maxNbConnectedHelperPoints),
          "Maximum number of connected helper points before we remove them.")
+        ("autoPartitioningNbBlocks", po::value<int>(&autoPartitioningNbBlocks)->default_value(autoPartitioningNbBlocks),
+         "Auto partitioning: number of blocks. The reconstruction space is split into density-balanced blocks from the landmark "
+         "distribution (or into a regular grid along the longest axis when too few landmarks are available). "
+         "Each block is fused, tetrahedralized and graph-cut independently, bounding the peak memory by the block size.")
+        ("autoPartitioningOverlapRatio", po::value<double>(&autoPartitioningOverlapRatio)->default_value(autoPartitioningOverlapRatio),
+         "Auto partitioning: overlap between neighboring blocks as a ratio of the block size. "
+         "The overlap makes the triangulations consistent near the block boundaries before stitching.")
+        ("rangeStart", po::value<int>(&rangeStart)->default_value(rangeStart),
+         "Auto partitioning: compute a sub-range of blocks from index rangeStart to rangeStart+rangeSize. "
+         "Each range run writes its blocks as partial files in a 'blocks' folder next to the output mesh, "
+         "so the blocks can be distributed over several processes. "
+         "A final run without range options stitches the partial files into the output mesh.")
+        ("rangeSize", po::value<int>(&rangeSize)->default_value(rangeSize),
+         "Auto partitioning: number of blocks to compute in the range mode (-1: compute and stitch all blocks in one process).")
         ("exportDebugTetrahedralization", po::value<bool>(&exportDebugTetrahedralization)->default_value(exportDebugTetrahedralization),
          "Export debug cells score as tetrahedral mesh. WARNING: could create huge meshes, only use on very small datasets.")
         ("seed", po::value<unsigned int>(&seed)->default_value(seed),
@@ -344,7 +365,288 @@ int aliceVision_main(int argc, char* argv[])
             {
                 case ePartitioningAuto:
                 {
-                    throw std::invalid_argument("Meshing mode: 'multiResolution', partitioning: 'auto' is not yet implemented.");
+                    ALICEVISION_LOG_INFO("Meshing mode: multi-resolution, partitioning: auto.");
+
+                    // compute the global reconstruction space, as in the single block mode
+                    std::array<Point3d, 8> hexah;
+
+                    float minPixSize;
+                    fuseCut::Fuser fs(mp);
+
+                    if (boundingBox.isInitialized())
+                        boundingBox.toHexahedron(&hexah[0]);
+                    else if (meshingFromDepthMaps && (!estimateSpaceFromSfM || sfmData.getLandmarks().empty()))
+                        fs.divideSpaceFromDepthMaps(&hexah[0], minPixSize);
+                    else
+                        fs.divideSpaceFromSfM(sfmData, &hexah[0], estimateSpaceMinObservations, estimateSpaceMinObservationAngle);
+
+                    // axis-aligned bounding box of the reconstruction space
+                    Point3d bbMin = hexah[0];
+                    Point3d bbMax = hexah[0];
+                    for (int i = 1; i < 8; ++i)
+                    {
+                        bbMin.x = std::min(bbMin.x, hexah[i].x);
+                        bbMin.y = std::min(bbMin.y, hexah[i].y);
+                        bbMin.z = std::min(bbMin.z, hexah[i].z);
+                        bbMax.x = std::max(bbMax.x, hexah[i].x);
+                        bbMax.y = std::max(bbMax.y, hexah[i].y);
+                        bbMax.z = std::max(bbMax.z, hexah[i].z);
+                    }
+
+                    const Point3d bbSize = bbMax - bbMin;
+
+                    // build the list of core (non-overlapped) block boxes:
+                    // each point of the reconstruction space belongs to exactly one core box
+                    std::vector<std::pair<Point3d, Point3d>> coreBoxes;
+
+                    // collect the landmarks inside the reconstruction space for the density-balanced split
+                    std::vector<Point3d> landmarkPts;
+                    landmarkPts.reserve(sfmData.getLandmarks().size());
+                    for (const auto& landmarkPair : sfmData.getLandmarks())
+                    {
+                        const Point3d p(landmarkPair.second.X(0), landmarkPair.second.X(1), landmarkPair.second.X(2));
+                        if ((p.x >= bbMin.x) && (p.x <= bbMax.x) && (p.y >= bbMin.y) && (p.y <= bbMax.y) && (p.z >= bbMin.z) && (p.z <= bbMax.z))
+                            landmarkPts.push_back(p);
+                    }
+
+                    if (int(landmarkPts.size()) >= autoPartitioningNbBlocks * 16)
+                    {
+                        // density-balanced KD split: recursively split the box at the landmark median of its
+                        // longest axis, so each core box holds a comparable amount of geometry
+                        using PtIt = std::vector<Point3d>::iterator;
+                        const std::function<void(const Point3d&, const Point3d&, PtIt, PtIt, int)> kdSplit =
+                          [&](const Point3d& boxMin, const Point3d& boxMax, PtIt first, PtIt last, int nbLeaves) {
+                              if (nbLeaves <= 1)
+                              {
+                                  coreBoxes.emplace_back(boxMin, boxMax);
+                                  return;
+                              }
+
+                              const Point3d boxSize = boxMax - boxMin;
+                              const int axis = ((boxSize.x >= boxSize.y) && (boxSize.x >= boxSize.z)) ? 0 : ((boxSize.y >= boxSize.z) ? 1 : 2);
+
+                              // distribute the landmarks between the two sub-boxes proportionally to their leaf counts
+                              const int nbFrontLeaves = nbLeaves / 2;
+                              const PtIt mid = first + (std::distance(first, last) * nbFrontLeaves) / nbLeaves;
+                              std::nth_element(first, mid, last, [axis](const Point3d& a, const Point3d& b) { return a.m[axis] < b.m[axis]; });
+
+                              // split plane at the landmark median, kept inside the box
+                              const double splitValue = std::min(std::max(mid->m[axis], boxMin.m[axis]), boxMax.m[axis]);
+
+                              Point3d frontMax = boxMax;
+                              frontMax.m[axis] = splitValue;
+                              Point3d backMin = boxMin;
+                              backMin.m[axis] = splitValue;
+
+                              kdSplit(boxMin, frontMax, first, mid, nbFrontLeaves);
+                              kdSplit(backMin, boxMax, mid, last, nbLeaves - nbFrontLeaves);
+                          };
+
+                        kdSplit(bbMin, bbMax, landmarkPts.begin(), landmarkPts.end(), autoPartitioningNbBlocks);
+
+                        ALICEVISION_LOG_INFO("Auto partitioning: " << coreBoxes.size() << " density-balanced blocks from " << landmarkPts.size()
+                                                                   << " landmarks, overlap ratio: " << autoPartitioningOverlapRatio << ".");
+                    }
+                    else
+                    {
+                        // not enough landmarks for a meaningful density estimation:
+                        // split the longest axis into the requested number of blocks, the other axes proportionally
+                        const double maxSide = std::max(bbSize.x, std::max(bbSize.y, bbSize.z));
+                        const int nbBlocksX = std::max(1, int(std::round(autoPartitioningNbBlocks * bbSize.x / maxSide)));
+                        const int nbBlocksY = std::max(1, int(std::round(autoPartitioningNbBlocks * bbSize.y / maxSide)));
+                        const int nbBlocksZ = std::max(1, int(std::round(autoPartitioningNbBlocks * bbSize.z / maxSide)));
+
+                        const Point3d gridBlockSize(bbSize.x / nbBlocksX, bbSize.y / nbBlocksY, bbSize.z / nbBlocksZ);
+
+                        for (int bz = 0; bz < nbBlocksZ; ++bz)
+                        for (int by = 0; by < nbBlocksY; ++by)
+                        for (int bx = 0; bx < nbBlocksX; ++bx)
+                        {
+                            const Point3d gridMin(bbMin.x + bx * gridBlockSize.x, bbMin.y + by * gridBlockSize.y, bbMin.z + bz * gridBlockSize.z);
+                            const Point3d gridMax(gridMin.x + gridBlockSize.x, gridMin.y + gridBlockSize.y, gridMin.z + gridBlockSize.z);
+                            coreBoxes.emplace_back(gridMin, gridMax);
+                        }
+
+                        ALICEVISION_LOG_INFO("Auto partitioning: " << nbBlocksX << "x" << nbBlocksY << "x" << nbBlocksZ
+                                                                   << " regular grid blocks, overlap ratio: " << autoPartitioningOverlapRatio << ".");
+                    }
+
+                    // axis-aligned box to hexahedron, with the corner ordering used everywhere else
+                    const auto boxToHexah = [](const Point3d& boxMin, const Point3d& boxMax, Point3d* out_hexah) {
+                        out_hexah[0] = Point3d(boxMin.x, boxMin.y, boxMin.z);
+                        out_hexah[1] = Point3d(boxMax.x, boxMin.y, boxMin.z);
+                        out_hexah[2] = Point3d(boxMax.x, boxMax.y, boxMin.z);
+                        out_hexah[3] = Point3d(boxMin.x, boxMax.y, boxMin.z);
+                        out_hexah[4] = Point3d(boxMin.x, boxMin.y, boxMax.z);
+                        out_hexah[5] = Point3d(boxMax.x, boxMin.y, boxMax.z);
+                        out_hexah[6] = Point3d(boxMax.x, boxMax.y, boxMax.z);
+                        out_hexah[7] = Point3d(boxMin.x, boxMax.y, boxMax.z);
+                    };
+
+                    mesh = new mesh::Mesh();
+
+                    // per-block partial files for the distributed range mode
+                    const fs::path blocksDirectory = outDirectory / "blocks";
+                    const bool distributedRange = (rangeStart >= 0) && (rangeSize > 0);
+
+                    if (distributedRange)
+                        fs::create_directory(blocksDirectory);
+
+                    for (int blockIndex = 0; blockIndex < int(coreBoxes.size()); ++blockIndex)
+                    {
+                        if (distributedRange && ((blockIndex < rangeStart) || (blockIndex >= rangeStart + rangeSize)))
+                            continue;
+
+                        const fs::path blockMeshPath = blocksDirectory / ("block_" + std::to_string(blockIndex) + ".bin");
+                        const fs::path blockPtsCamsPath = blocksDirectory / ("block_" + std::to_string(blockIndex) + "_ptsCams.bin");
+
+                        ALICEVISION_LOG_INFO("Auto partitioning: compute block " << (blockIndex + 1) << " / " << coreBoxes.size() << ".");
+
+                        // core (non-overlapped) block box of this block
+                        const Point3d& coreMin = coreBoxes[blockIndex].first;
+                        const Point3d& coreMax = coreBoxes[blockIndex].second;
+                        const Point3d blockSize = coreMax - coreMin;
+
+                        // padded block box: overlap with the neighboring blocks, clamped to the reconstruction space
+                        const Point3d paddedMin(std::max(bbMin.x, coreMin.x - autoPartitioningOverlapRatio * blockSize.x),
+                                                std::max(bbMin.y, coreMin.y - autoPartitioningOverlapRatio * blockSize.y),
+                                                std::max(bbMin.z, coreMin.z - autoPartitioningOverlapRatio * blockSize.z));
+                        const Point3d paddedMax(std::min(bbMax.x, coreMax.x + autoPartitioningOverlapRatio * blockSize.x),
+                                                std::min(bbMax.y, coreMax.y + autoPartitioningOverlapRatio * blockSize.y),
+                                                std::min(bbMax.z, coreMax.z + autoPartitioningOverlapRatio * blockSize.z));
+
+                        std::array<Point3d, 8> blockHexah;
+                        boxToHexah(paddedMin, paddedMax, &blockHexah[0]);
+
+                        mesh::Mesh* blockMesh = nullptr;
+                        StaticVector<StaticVector<int>> blockPtsCams;
+
+                        if (!distributedRange && fs::exists(blockMeshPath))
+                        {
+                            // the block has been computed by a distributed range run, load its partial files
+                            ALICEVISION_LOG_INFO("Auto partitioning: load precomputed block file: " << blockMeshPath.string());
+                            blockMesh = new mesh::Mesh();
+                            blockMesh->loadFromBin(blockMeshPath.string());
+
+                            if (!blockMesh->pts.empty())
+                                loadArrayOfArraysFromFile(blockPtsCams, blockPtsCamsPath.string());
+                        }
+                        else
+                        {
+                            StaticVector<int> blockCams;
+                            if (meshingFromDepthMaps)
+                            {
+                                blockCams = mp.findCamsWhichIntersectsHexahedron(&blockHexah[0]);
+                            }
+                            else
+                            {
+                                blockCams.resize(mp.getNbCameras());
+                                for (int i = 0; i < blockCams.size(); ++i)
+                                    blockCams[i] = i;
+                            }
+
+                            if (blockCams.empty())
+                            {
+                                ALICEVISION_LOG_INFO("Auto partitioning: no camera intersects the block, skip it.");
+                                blockMesh = new mesh::Mesh();
+                            }
+                            else
+                            {
+                                // fuse, tetrahedralize and graph-cut the block independently:
+                                // the peak memory is bounded by the block point budget, not by the whole scene
+                                fuseCut::PointCloud pc(mp);
+                                pc.createDensePointCloud(&blockHexah[0],
+                                                         blockCams,
+                                                         addLandmarksToTheDensePointCloud ? &sfmData : nullptr,
+                                                         meshingFromDepthMaps ? &fuseParams : nullptr);
+
+                                if (pc.getVertices().size() < 4)
+                                {
+                                    ALICEVISION_LOG_INFO("Auto partitioning: not enough points in the block, skip it.");
+                                    blockMesh = new mesh::Mesh();
+                                }
+                                else
+                                {
+                                    fuseCut::Tetrahedralization tetrahedralization(pc.getVertices());
+
+                                    fuseCut::GraphFiller gfiller(mp, pc, tetrahedralization);
+                                    gfiller.build(blockCams);
+                                    gfiller.binarize();
+
+                                    fuseCut::Mesher mesher(mp, pc, tetrahedralization, gfiller.getCellsStatus());
+                                    mesher.graphCutPostProcessing(&blockHexah[0]);
+
+                                    blockMesh = mesher.createMesh(maxNbConnectedHelperPoints);
+
+                                    pc.createPtsCams(blockPtsCams);
+                                    mesh::meshPostProcessing(blockMesh, blockPtsCams, mp, outDirectory.string() + "/", nullptr, &blockHexah[0]);
+                                }
+                            }
+                        }
+
+                        if (distributedRange)
+                        {
+                            // emit the block partial files, the final stitching run consumes them
+                            // (an empty mesh marks a skipped block, so the stitching run does not recompute it)
+                            blockMesh->saveToBin(blockMeshPath.string());
+                            saveArrayOfArraysToFile(blockPtsCamsPath.string(), blockPtsCams);
+                            delete blockMesh;
+                            continue;
+                        }
+
+                        if (blockMesh->pts.empty() || blockMesh->tris.empty())
+                        {
+                            delete blockMesh;
+                            continue;
+                        }
+
+                        // stitching: keep only the triangles whose centroid lies in the core box of the block,
+                        // so each triangle of the overlapped regions is kept by exactly one block
+                        // (half-open comparison, the blocks touching the bounding box include its boundary)
+                        const auto isInCoreBox = [&](const Point3d& p) {
+                            return (p.x >= coreMin.x) && ((p.x < coreMax.x) || (coreMax.x >= bbMax.x)) &&
+                                   (p.y >= coreMin.y) && ((p.y < coreMax.y) || (coreMax.y >= bbMax.y)) &&
+                                   (p.z >= coreMin.z) && ((p.z < coreMax.z) || (coreMax.z >= bbMax.z));
+                        };
+
+                        std::vector<int> vertexMap(blockMesh->pts.size(), -1);
+
+                        for (int i = 0; i < blockMesh->tris.size(); ++i)
+                        {
+                            const mesh::Mesh::triangle& tri = blockMesh->tris[i];
+                            const Point3d centroid = (blockMesh->pts[tri.v[0]] + blockMesh->pts[tri.v[1]] + blockMesh->pts[tri.v[2]]) / 3.0;
+
+                            if (!isInCoreBox(centroid))
+                                continue;
+
+                            mesh::Mesh::triangle outTri;
+                            for (int k = 0; k < 3; ++k)
+                            {
+                                int& mappedId = vertexMap[tri.v[k]];
+                                if (mappedId == -1)
+                                {
+                                    mappedId = mesh->pts.size();
+                                    mesh->pts.push_back(blockMesh->pts[tri.v[k]]);
+                                    ptsCams.push_back(blockPtsCams[tri.v[k]]);
+                                }
+                                outTri.v[k] = mappedId;
+                            }
+                            mesh->tris.push_back(outTri);
+                        }
+
+                        delete blockMesh;
+                    }
+
+                    if (distributedRange)
+                    {
+                        // the block partial files are the outputs of this run,
+                        // a final run without range options stitches them into the output mesh
+                        delete mesh;
+                        ALICEVISION_LOG_INFO("Auto partitioning: block range done in (s): " + std::to_string(timer.elapsed()));
+                        return EXIT_SUCCESS;
+                    }
+
+                    break;
                 }
                 case ePartitioningSingleBlock:
                 {
@@ -398,7 +700,11 @@ int aliceVision_main(int argc, char* argv[])
                         throw std::logic_error("No camera to make the reconstruction");
 
                     fuseCut::PointCloud pc(mp);
-                    pc.createDensePointCloud(&hexah[0], cams, addLandmarksToTheDensePointCloud ? &sfmData : nullptr, meshingFromDepthMaps ? &fuseParams : nullptr);
+                    {
+                        system::TraceSpan span("fusePointCloud");
+                        pc.createDensePointCloud(
+                          &hexah[0], cams, addLandmarksToTheDensePointCloud ? &sfmData : nullptr, meshingFromDepthMaps ? &fuseParams : nullptr);
+                    }
 
                     fuseCut::Tetrahedralization tetrahedralization(pc.getVertices());
 
@@ -416,15 +722,21 @@ int aliceVision_main(int argc, char* argv[])
                     }
 
                     fuseCut::GraphFiller gfiller(mp, pc, tetrahedralization);
-                    gfiller.build(cams);
-                    gfiller.binarize();
+                    {
+                        system::TraceSpan span("graphFilling");
+                        gfiller.build(cams);
+                        gfiller.binarize();
+                    }
 
                     fuseCut::Mesher mesher(mp, pc, tetrahedralization, gfiller.getCellsStatus());
-                    mesher.graphCutPostProcessing(&hexah[0]);
+                    {
+                        system::TraceSpan span("graphCutAndMeshing");
+                        mesher.graphCutPostProcessing(&hexah[0]);
 
-                    mesh = mesher.createMesh(maxNbConnectedHelperPoints);
-                    pc.createPtsCams(ptsCams);
-                    mesh::meshPostProcessing(mesh, ptsCams, mp, outDirectory.string() + "/", nullptr, &hexah[0]);
+                        mesh = mesher.createMesh(maxNbConnectedHelperPoints);
+                        pc.createPtsCams(ptsCams);
+                        mesh::meshPostProcessing(mesh, ptsCams, mp, outDirectory.string() + "/", nullptr, &hexah[0]);
+                    }
 
                     break;
                 }
@@ -469,11 +781,17 @@ int aliceVision_main(int argc, char* argv[])
 
     removeLandmarksWithoutObservations(densePointCloud);
     ALICEVISION_LOG_INFO("Save dense point cloud.");
-    sfmDataIO::save(densePointCloud, outputDensePointCloud, sfmDataIO::ESfMData::ALL_DENSE);
+    {
+        system::TraceSpan span("saveDensePointCloud", "io");
+        sfmDataIO::save(densePointCloud, outputDensePointCloud, sfmDataIO::ESfMData::ALL_DENSE);
+    }
 
     ALICEVISION_LOG_INFO("Save obj mesh file.");
     ALICEVISION_LOG_INFO("OUTPUT MESH " << outputMesh);
-    mesh->save(outputMesh);
+    {
+        system::TraceSpan span("saveMesh", "io");
+        mesh->save(outputMesh);
+    }
     delete mesh;
 
     ALICEVISION_LOG_INFO("Task done in (s): " + std::to_string(timer.elapsed()));
@@ -9,6 +9,7 @@
 
 #include <aliceVision/system/Timer.hpp>
 #include <aliceVision/system/Logger.hpp>
+#include <aliceVision/system/MemoryMappedFile.hpp>
 #include <aliceVision/system/main.hpp>
 #include <aliceVision/cmdline/cmdline.hpp>
 
@@ -52,37 +53,48 @@ using namespace aliceVision;
 namespace po = boost::program_options;
 namespace fs = std::filesystem;
 
-std::vector<boost::json::value> readJsons(std::istream& is, boost::json::error_code& ec)
+std::vector<boost::json::value> readJsons(const unsigned char* data, std::size_t size, boost::json::error_code& ec)
 {
     std::vector<boost::json::value> jvs;
     boost::json::stream_parser p;
-    std::string line;
     std::size_t n = 0;
+    std::size_t lastValueEnd = 0;
 
-    while (true)
+    while (n < size)
     {
-        if (n == line.size())
-        {
-            if (!std::getline(is, line))
-            {
-                break;
-            }
+        // Consume at least part of the buffer
+        n += p.write_some(reinterpret_cast<const char*>(data) + n, size - n, ec);
 
-            n = 0;
+        if (ec.failed())
+        {
+            // A corrupted chunk (e.g. interrupted producer) ends the stream:
+            // keep the values parsed so far instead of discarding the whole file.
+            return jvs;
         }
 
-        // Consume at least part of the line
-        n += p.write_some(line.data() + n, line.size() - n, ec);
-
         // If the parser found a value, add it
         if (p.done())
         {
             jvs.push_back(p.release());
             p.reset();
+            lastValueEnd = n;
         }
     }
 
-    if (!p.done())
+    // Check whether real data follows the last complete value,
+    // a well-formed file only has a trailing newline left
+    bool hasPendingValue = false;
+    for (std::size_t i = lastValueEnd; i < size; ++i)
+    {
+        const char c = static_cast<char>(data[i]);
+        if (c != ' ' && c != '\t' && c != '\r' && c != '\n')
+        {
+            hasPendingValue = true;
+            break;
+        }
+    }
+
+    if (hasPendingValue && !p.done())
     {
         // Try to extract the end
         p.finish(ec);
@@ -453,16 +465,12 @@ int aliceVision_main(int argc, char** argv)
 
     // Load tracks
     ALICEVISION_LOG_INFO("Load tracks");
-    std::ifstream tracksFile(tracksFilename);
-    if (tracksFile.is_open() == false)
+    track::TracksMap mapTracks;
+    if (!track::loadTracks(tracksFilename, mapTracks))
     {
         ALICEVISION_LOG_ERROR("The input tracks file '" + tracksFilename + "' cannot be read.");
         return EXIT_FAILURE;
     }
-    std::stringstream buffer;
-    buffer << tracksFile.rdbuf();
-    boost::json::value jv = boost::json::parse(buffer.str());
-    track::TracksMap mapTracks(track::flat_map_value_to<track::Track>(jv));
 
     // We have loaded a list of tracks
     // A track is a list of observations per view of (we think) a same point.
@@ -489,11 +497,24 @@ int aliceVision_main(int argc, char** argv)
             continue;
         }
 
-        // Load the file content
-        // This is a vector of sfm::ReconstructedPair
-        std::ifstream inputfile(file.path().string());
+        // Map the file content read-only: the chunks are parsed directly from the
+        // page cache without an intermediate line buffer.
+        // Each chunk is a vector of sfm::ReconstructedPair
+        system::MemoryMappedFile mappedFile;
+        if (!mappedFile.open(file.path().string()))
+        {
+            ALICEVISION_LOG_WARNING("Unable to map the pairs file: " << file.path().string());
+            continue;
+        }
+
         boost::json::error_code ec;
-        std::vector<boost::json::value> values = readJsons(inputfile, ec);
+        std::vector<boost::json::value> values = readJsons(mappedFile.data(), mappedFile.size(), ec);
+        if (ec.failed())
+        {
+            ALICEVISION_LOG_WARNING("The pairs file ends with an incomplete chunk, keeping " << values.size()
+                                                                                             << " complete chunk(s): " << file.path().string());
+        }
+
         for (const boost::json::value& value : values)
         {
             std::vector<sfm::ReconstructedPair> localVector = boost::json::value_to<std::vector<sfm::ReconstructedPair>>(value);
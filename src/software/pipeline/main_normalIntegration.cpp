@@ -43,7 +43,7 @@
 // These constants define the current software version.
 // They must be updated when the command line is changed.
 #define ALICEVISION_SOFTWARE_VERSION_MAJOR 1
-#define ALICEVISION_SOFTWARE_VERSION_MINOR 0
+#define ALICEVISION_SOFTWARE_VERSION_MINOR 1
 
 using namespace aliceVision;
 
@@ -62,6 +62,9 @@ int aliceVision_main(int argc, char** argv)
     // Image downscale factor during process
     int downscale = 1;
 
+    // Poisson integration method
+    std::string integrationMethod = "dct";
+
     // clang-format off
     po::options_description requiredParams("Required parameters");
     requiredParams.add_options()
@@ -75,7 +78,10 @@ int aliceVision_main(int argc, char** argv)
         ("sfmDataFile,s", po::value<std::string>(&sfmDataFile)->default_value(""),
          "Path to the input SfMData file.")
         ("downscale,d", po::value<int>(&downscale)->default_value(downscale),
-         "Downscale factor for faster results.");
+         "Downscale factor for faster results.")
+        ("method,m", po::value<std::string>(&integrationMethod)->default_value(integrationMethod),
+         "Poisson integration method: 'dct' (full-grid cosine transform) or 'multigrid' "
+         "(geometric multigrid, faster on high-resolution normal maps).");
     // clang-format on
 
     CmdLine cmdline("AliceVision normalIntegration");
@@ -87,9 +93,11 @@ int aliceVision_main(int argc, char** argv)
         return EXIT_FAILURE;
     }
 
+    const photometricStereo::EIntegrationMethod method = photometricStereo::EIntegrationMethod_stringToEnum(integrationMethod);
+
     if (sfmDataFile.compare("") == 0)
     {
-        photometricStereo::normalIntegration(inputPath, isPerspective, downscale, outputFolder);
+        photometricStereo::normalIntegration(inputPath, isPerspective, downscale, outputFolder, method);
     }
     else
     {
@@ -99,7 +107,7 @@ int aliceVision_main(int argc, char** argv)
             ALICEVISION_LOG_ERROR("The input file '" + sfmDataFile + "' cannot be read.");
             return EXIT_FAILURE;
         }
-        photometricStereo::normalIntegration(sfmData, inputPath, isPerspective, downscale, outputFolder);
+        photometricStereo::normalIntegration(sfmData, inputPath, isPerspective, downscale, outputFolder, method);
     }
 
     ALICEVISION_LOG_INFO("Task done in (s): " + std::to_string(timer.elapsed()));
@@ -149,7 +149,7 @@ bool processImage(const PanoramaMap& panoramaMap,
                   const std::string& labelsFilePath,
                   const std::string& outputFolder,
                   const image::EStorageDataType& storageDataType,
-                  IndexT viewReference,
+                  const std::string& outputName,
                   const BoundingBox& referenceBoundingBox,
                   bool showBorders,
                   bool showSeams)
@@ -522,18 +522,7 @@ bool processImage(const PanoramaMap& panoramaMap,
         return false;
     }
 
-    std::string warpedPath;
-
-    if (viewReference == UndefinedIndexT)
-    {
-        warpedPath = "panorama";
-    }
-    else
-    {
-        warpedPath = sfmData.getViews().at(viewReference)->getImage().getMetadata().at("AliceVision:warpedPath");
-    }
-
-    const std::string outputFilePath = (fs::path(outputFolder) / (warpedPath + ".exr")).string();
+    const std::string outputFilePath = (fs::path(outputFolder) / (outputName + ".exr")).string();
     image::Image<image::RGBAfColor>& output = compositer->getOutput();
 
     if (storageDataType == image::EStorageDataType::HalfFinite)
@@ -638,6 +627,7 @@ int aliceVision_main(int argc, char** argv)
     int rangeIteration = -1;
     int rangeSize = 1;
     int maxThreads = 1;
+    int tileShardingSize = 0;
     int forceMinPyramidLevels = 0;
     bool showBorders = false;
     bool showSeams = false;
@@ -676,7 +666,11 @@ int aliceVision_main(int argc, char** argv)
         ("labels,l", po::value<std::string>(&labelsFilepath)->required(),
          "Labels image from seams estimation.")
         ("useTiling,n", po::value<bool>(&useTiling)->default_value(useTiling),
-         "Use tiling for compositing.");
+         "Use tiling for compositing.")
+        ("tileShardingSize", po::value<int>(&tileShardingSize)->default_value(tileShardingSize),
+         "Shard the panorama into regular output tiles of the given size instead of per-view regions. "
+         "Each chunk (rangeIteration/rangeSize) composites its range of tiles with the same seams, "
+         "so the compositing of a large panorama can be distributed (0 to disable).");
     // clang-format on
 
     CmdLine cmdline("Performs the panorama stiching of warped images, with an option to use constraints from precomputed seams maps.\n"
@@ -745,7 +739,11 @@ int aliceVision_main(int argc, char** argv)
         rangeIteration = 0;
         rangeSize = 1;
     }
-    if (rangeIteration != -1)
+    if (tileShardingSize > 0)
+    {
+        // the range is interpreted over the output tiles, once the panorama size is known
+    }
+    else if (rangeIteration != -1)
     {
         if (rangeIteration < 0 || rangeSize < 0)
         {
@@ -792,6 +790,79 @@ int aliceVision_main(int argc, char** argv)
         return EXIT_FAILURE;
     }
 
+    if (tileShardingSize > 0)
+    {
+        // Regular output-tile sharding: the panorama is divided into a regular grid of output
+        // tiles and each chunk composites a contiguous range of them with the same seams.
+        // The tiles are assembled into the final panorama by panoramaMerging.
+        const int tileCountX = divideRoundUp(int(panoramaMap->getWidth()), tileShardingSize);
+        const int tileCountY = divideRoundUp(int(panoramaMap->getHeight()), tileShardingSize);
+        const int tileCount = tileCountX * tileCountY;
+
+        int shardStart = 0;
+        int shardEnd = tileCount;
+        if (rangeIteration != -1)
+        {
+            if (rangeIteration < 0 || rangeSize < 0)
+            {
+                ALICEVISION_LOG_ERROR("Range is incorrect");
+                return EXIT_FAILURE;
+            }
+
+            shardStart = rangeIteration * rangeSize;
+            shardEnd = std::min(tileCount, shardStart + rangeSize);
+
+            if (shardStart >= tileCount)
+            {
+                // nothing to compute for this chunk
+                return EXIT_SUCCESS;
+            }
+        }
+
+        bool succeeded = true;
+
+        for (int tileIndex = shardStart; tileIndex < shardEnd; tileIndex++)
+        {
+            ALICEVISION_LOG_INFO("Processing output tile " << tileIndex - shardStart + 1 << "/" << shardEnd - shardStart);
+
+            BoundingBox tileBoundingBox;
+            tileBoundingBox.left = (tileIndex % tileCountX) * tileShardingSize;
+            tileBoundingBox.top = (tileIndex / tileCountX) * tileShardingSize;
+            tileBoundingBox.width = std::min(tileShardingSize, int(panoramaMap->getWidth()) - tileBoundingBox.left);
+            tileBoundingBox.height = std::min(tileShardingSize, int(panoramaMap->getHeight()) - tileBoundingBox.top);
+
+            // Skip the tiles no input overlaps, the merger fills them with empty pixels
+            std::vector<IndexT> overlappingViews;
+            if (!panoramaMap->getOverlaps(overlappingViews, tileBoundingBox) || overlappingViews.empty())
+            {
+                continue;
+            }
+
+            if (!processImage(*panoramaMap,
+                              sfmData,
+                              compositerType,
+                              warpingFolder,
+                              labelsFilepath,
+                              outputFolder,
+                              storageDataType,
+                              "tile_" + std::to_string(tileIndex),
+                              tileBoundingBox,
+                              showBorders,
+                              showSeams))
+            {
+                succeeded = false;
+                continue;
+            }
+        }
+
+        if (!succeeded)
+        {
+            return EXIT_FAILURE;
+        }
+
+        return EXIT_SUCCESS;
+    }
+
     // Distribute more smartly inputs among chunks
     std::vector<std::vector<IndexT>> chunks;
     if (!panoramaMap->optimizeChunks(chunks, rangeSize))
@@ -827,6 +898,8 @@ int aliceVision_main(int argc, char** argv)
                 return EXIT_FAILURE;
             }
 
+            const std::string warpedPath = sfmData.getViews().at(viewReference)->getImage().getMetadata().at("AliceVision:warpedPath");
+
             if (!processImage(*panoramaMap,
                               sfmData,
                               compositerType,
@@ -834,7 +907,7 @@ int aliceVision_main(int argc, char** argv)
                               labelsFilepath,
                               outputFolder,
                               storageDataType,
-                              viewReference,
+                              warpedPath,
                               referenceBoundingBox,
                               showBorders,
                               showSeams))
@@ -859,7 +932,7 @@ int aliceVision_main(int argc, char** argv)
                           labelsFilepath,
                           outputFolder,
                           storageDataType,
-                          UndefinedIndexT,
+                          "panorama",
                           referenceBoundingBox,
                           showBorders,
                           showSeams))
@@ -102,6 +102,9 @@ int aliceVision_main(int argc, char** argv)
          "Add an intermediate refine with rotation+focal in the different BA steps.")
         ("intermediateRefineWithFocalDist", po::value<bool>(&params.intermediateRefineWithFocalDist)->default_value(params.intermediateRefineWithFocalDist),
          "Add an intermediate refine with rotation+focal+distortion in the different BA steps.")
+        ("bundleSolver", po::value<sfm::EBASolverBackend>(&params.solverBackend)->default_value(params.solverBackend),
+         "Hardware backend of the bundle adjustment linear solver (cpu, gpu). "
+         "'gpu' uses the CUDA dense solver of Ceres and falls back to the CPU if CUDA is not available.")
         ("outputViewsAndPoses", po::value<std::string>(&outputViewsAndPosesFilepath),
          "Path of the output SfMData file.")
         ("randomSeed", po::value<int>(&randomSeed)->default_value(randomSeed),
@@ -138,7 +138,9 @@ class CircleDetector
         {
             return false;
         }
-        _pyramids.push_back(pyramid);
+
+#pragma omp critical
+        _pyramids.push_back(std::move(pyramid));
 
         return true;
     }
@@ -190,13 +192,18 @@ class CircleDetector
 
         debugImage(gradientImage, "gradientImage", pyramid_id, level);
 
-        if (_gradientImage.width() != gradientImage.width() || _gradientImage.height() != gradientImage.height())
-        {
-            _gradientImage = gradientImage;
-        }
-        else
+        // Accumulate with the gradients of the other images
+        // (the gradient size only changes when entering a new level)
+#pragma omp critical
         {
-            _gradientImage += gradientImage;
+            if (_gradientImage.width() != gradientImage.width() || _gradientImage.height() != gradientImage.height())
+            {
+                _gradientImage = gradientImage;
+            }
+            else
+            {
+                _gradientImage += gradientImage;
+            }
         }
 
         return true;
@@ -218,15 +225,23 @@ class CircleDetector
 
         for (int current_level = _pyramids[0].countLevels() - 1; current_level > 1; current_level--)
         {
-            // Compute gradients
-            size_t current_pyramid_id = 0;
-            for (PyramidFloat& pyr : _pyramids)
+            // Compute gradients for each image independently
+            // The circle scores only depend on the accumulated gradient image,
+            // whose update is protected in preprocessLevel
+            bool failed = false;
+
+#pragma omp parallel for
+            for (int current_pyramid_id = 0; current_pyramid_id < _pyramids.size(); current_pyramid_id++)
             {
-                if (!preprocessLevel(pyr, current_pyramid_id, current_level))
+                if (!preprocessLevel(_pyramids[current_pyramid_id], current_pyramid_id, current_level))
                 {
-                    return false;
+                    failed = true;
                 }
-                current_pyramid_id++;
+            }
+
+            if (failed)
+            {
+                return false;
             }
 
             // Estimate the search area
@@ -800,26 +815,37 @@ bool buildContactSheetImage(image::Image<image::RGBfColor>& output,
         // Create row thumbnails
         image::Image<image::RGBfColor> rowOutput(rowWidth, rowHeight, true);
 
+        // Precompute the thumbnails positions so they can be loaded concurrently
+        std::vector<std::pair<int, const Contact*>> rowItems;
         int posX = space;
         for (const auto& item : rowpair.second)
         {
-            int rawResizedHeight = int(ratioResize * double(item.second.height));
-            int rawResizedWidth = int(ratioResize * double(item.second.width));
+            rowItems.push_back(std::make_pair(posX, &item.second));
+            posX += int(ratioResize * double(orientedWidth(item.second))) + space;
+        }
 
-            int resizedHeight = int(ratioResize * double(orientedHeight(item.second)));
-            int resizedWidth = int(ratioResize * double(orientedWidth(item.second)));
+        // Each thumbnail writes to its own block of the row
+#pragma omp parallel for
+        for (int idItem = 0; idItem < rowItems.size(); idItem++)
+        {
+            const Contact& contact = *rowItems[idItem].second;
+
+            int rawResizedHeight = int(ratioResize * double(contact.height));
+            int rawResizedWidth = int(ratioResize * double(contact.width));
+
+            int resizedHeight = int(ratioResize * double(orientedHeight(contact)));
+            int resizedWidth = int(ratioResize * double(orientedWidth(contact)));
 
             image::Image<image::RGBfColor> input;
             image::Image<image::RGBfColor> rawThumbnail(rawResizedWidth, rawResizedHeight);
             image::Image<image::RGBfColor> thumbnail(resizedWidth, resizedHeight);
 
-            image::readImage(item.second.path, input, image::EImageColorSpace::SRGB);
+            image::readImage(contact.path, input, image::EImageColorSpace::SRGB);
 
             resample(rawThumbnail, input);
-            applyOrientation(thumbnail, rawThumbnail, item.second.orientation);
+            applyOrientation(thumbnail, rawThumbnail, contact.orientation);
 
-            rowOutput.block(0, posX, resizedHeight, resizedWidth) = thumbnail;
-            posX += resizedWidth + space;
+            rowOutput.block(0, rowItems[idItem].first, resizedHeight, resizedWidth) = thumbnail;
         }
 
         int centeredX = (maxWidth - rowWidth) / 2;
@@ -1307,20 +1333,34 @@ int main(int argc, char* argv[])
                     fs::path path(sfmOutputDataFilepath);
                     detector.setDebugDirectory(path.parent_path().string());
                 }
+                std::vector<std::string> imagePaths;
                 for (const auto& v : sfmData.getViews())
+                {
+                    imagePaths.push_back(v.second->getImage().getImagePath());
+                }
+
+                // Load the images and build their gradient pyramids concurrently
+                bool appendFailed = false;
+
+#pragma omp parallel for
+                for (int idImage = 0; idImage < imagePaths.size(); idImage++)
                 {
                     // Read original image
                     image::Image<float> grayscale;
-                    image::readImage(v.second->getImage().getImagePath(), grayscale, image::EImageColorSpace::SRGB);
+                    image::readImage(imagePaths[idImage], grayscale, image::EImageColorSpace::SRGB);
 
-                    const bool res = detector.appendImage(grayscale);
-                    if (!res)
+                    if (!detector.appendImage(grayscale))
                     {
-                        ALICEVISION_LOG_ERROR("Image is incompatible with fisheye detection");
-                        return EXIT_FAILURE;
+                        appendFailed = true;
                     }
                 }
 
+                if (appendFailed)
+                {
+                    ALICEVISION_LOG_ERROR("Image is incompatible with fisheye detection");
+                    return EXIT_FAILURE;
+                }
+
                 if (!detector.process())
                 {
                     ALICEVISION_LOG_ERROR("Failed to find circle");
@@ -46,6 +46,7 @@ int aliceVision_main(int argc, char** argv)
     image::EStorageDataType storageDataType = image::EStorageDataType::Float;
     const size_t tileSize = 256;
     bool useTiling = true;
+    bool useTileSharding = false;
 
     // Description of mandatory parameters
     // clang-format off
@@ -64,7 +65,10 @@ int aliceVision_main(int argc, char** argv)
         ("storageDataType", po::value<image::EStorageDataType>(&storageDataType)->default_value(storageDataType),
          ("Storage data type: " + image::EStorageDataType_informations()).c_str())
         ("useTiling,n", po::value<bool>(&useTiling)->default_value(useTiling),
-         "Use tiling for compositing.");
+         "Use tiling for compositing.")
+        ("useTileSharding", po::value<bool>(&useTileSharding)->default_value(useTileSharding),
+         "Merge the regular output tiles (tile_*.exr) produced by the PanoramaCompositing "
+         "tile sharding mode instead of the per-view images.");
     // clang-format on
 
     CmdLine cmdline("Merges all the image tiles created by the PanoramaCompositing.\n"
@@ -100,7 +104,26 @@ int aliceVision_main(int argc, char** argv)
     }
 
     std::vector<std::pair<IndexT, std::string>> sourcesList;
-    if (useTiling)
+    if (useTileSharding)
+    {
+        // Shards are regular output tiles and do not relate to a view, collect them from the folder
+        std::vector<std::string> shardPaths;
+        for (const auto& entry : fs::directory_iterator(compositingFolder))
+        {
+            const std::string stem = entry.path().stem().string();
+            if (entry.path().extension() == ".exr" && stem.compare(0, 5, "tile_") == 0)
+            {
+                shardPaths.push_back(entry.path().string());
+            }
+        }
+        std::sort(shardPaths.begin(), shardPaths.end());
+
+        for (IndexT shardIndex = 0; shardIndex < shardPaths.size(); shardIndex++)
+        {
+            sourcesList.push_back(std::make_pair(shardIndex, shardPaths[shardIndex]));
+        }
+    }
+    else if (useTiling)
     {
         for (auto viewItem : sfmData.getViews())
         {
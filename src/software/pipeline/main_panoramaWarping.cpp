@@ -299,6 +299,17 @@ int aliceVision_main(int argc, char** argv)
         image::Image<image::RGBfColor> source;
         image::readImage(imagePath, source, workingColorSpace);
 
+        // The pyramid and the metadata only depend on the source image,
+        // compute them once for all the sub bounding boxes.
+        GaussianPyramidNoMask pyramid(source.width(), source.height());
+        if (!pyramid.process(source))
+        {
+            ALICEVISION_LOG_ERROR("Problem creating pyramid.");
+            continue;
+        }
+
+        const oiio::ParamValueList srcMetadata = image::readImageMetadata(imagePath);
+
         for (int idsub = 0; idsub < coarsesBbox.size(); idsub++)
         {
             const auto coarseBbox = coarsesBbox[idsub];
@@ -505,8 +516,8 @@ int aliceVision_main(int argc, char** argv)
             globalBbox.width = std::min(globalBbox.width, panoramaSize.first);
             globalBbox.height = std::min(globalBbox.height, panoramaSize.second);
 
-            // Load metadata and update for output
-            oiio::ParamValueList metadata = image::readImageMetadata(imagePath);
+            // Update metadata for output
+            oiio::ParamValueList metadata = srcMetadata;
             metadata.push_back(oiio::ParamValue("AliceVision:offsetX", globalBbox.left));
             metadata.push_back(oiio::ParamValue("AliceVision:offsetY", globalBbox.top));
             metadata.push_back(oiio::ParamValue("AliceVision:panoramaWidth", panoramaSize.first));
@@ -555,13 +566,6 @@ int aliceVision_main(int argc, char** argv)
             out_mask->open(maskFilepath, spec_mask);
             out_weights->open(weightFilepath, spec_weights);
 
-            GaussianPyramidNoMask pyramid(source.width(), source.height());
-            if (!pyramid.process(source))
-            {
-                ALICEVISION_LOG_ERROR("Problem creating pyramid.");
-                continue;
-            }
-
             std::vector<BoundingBox> boxes;
             for (int y = 0; y < globalBbox.height; y += tileSize)
             {
@@ -20,6 +20,7 @@
 #include <stdio.h>
 #include <cmath>
 #include <filesystem>
+#include <map>
 #include <vector>
 #include <set>
 #include <iterator>
@@ -44,6 +45,7 @@ namespace fs = std::filesystem;
 template<class ImageT, class MaskFuncT>
 void process(const std::string& dstColorImage,
              const IntrinsicBase* cam,
+             const image::Image<Vec2f>* undistortionMap,
              const oiio::ParamValueList& metadata,
              const std::string& srcImage,
              bool evCorrection,
@@ -70,10 +72,10 @@ void process(const std::string& dstColorImage,
     // undistort
     if (cam->isValid() && cam->hasDistortion())
     {
-        // undistort the image and save it
+        // undistort the image with the precomputed map of its intrinsic and save it
         using Pix = typename ImageT::Tpixel;
         Pix pixZero(Pix::Zero());
-        UndistortImage(image, cam, image_ud, pixZero);
+        UndistortImage(image, *undistortionMap, image_ud, pixZero);
         writeImage(dstColorImage, image_ud, image::ImageWriteOptions(), metadata);
     }
     else
@@ -128,6 +130,16 @@ bool prepareDenseScene(const SfMData& sfmData,
     const double medianCameraExposure = sfmData.getMedianCameraExposureSetting().getExposure();
     ALICEVISION_LOG_INFO("Median Camera Exposure: " << medianCameraExposure << ", Median EV: " << std::log2(1.0 / medianCameraExposure));
 
+    // precompute the undistortion map of each intrinsic once,
+    // so that the distortion model is not re-evaluated for every view sharing the same camera
+    std::map<IndexT, image::Image<Vec2f>> undistortionMaps;
+    for (const auto& intrinsicPair : sfmData.getIntrinsics())
+    {
+        const IntrinsicBase* cam = intrinsicPair.second.get();
+        if (cam->isValid() && cam->hasDistortion())
+            camera::computeUndistortionMap(cam, undistortionMaps[intrinsicPair.first]);
+    }
+
 #pragma omp parallel for num_threads(3)
     for (int i = 0; i < viewIds.size(); ++i)
     {
@@ -237,6 +249,8 @@ bool prepareDenseScene(const SfMData& sfmData,
             const std::string dstColorImage =
               (fs::path(outFolder) / (baseFilename + "." + image::EImageFileType_enumToString(outputFileType))).string();
             const IntrinsicBase* cam = iterIntrinsic->second.get();
+            const auto itUndistortionMap = undistortionMaps.find(iterIntrinsic->first);
+            const image::Image<Vec2f>* undistortionMap = (itUndistortionMap != undistortionMaps.end()) ? &itUndistortionMap->second : nullptr;
 
             // add exposure values to images metadata
             const double cameraExposure = view->getImage().getCameraExposureSetting().getExposure();
@@ -255,7 +269,7 @@ bool prepareDenseScene(const SfMData& sfmData,
             if (tryLoadMask(&mask, masksFolders, viewId, srcImage, maskExtension))
             {
                 process<Image<RGBAfColor>>(
-                  dstColorImage, cam, metadata, srcImage, evCorrection, exposureCompensation, [&mask](Image<RGBAfColor>& image) {
+                  dstColorImage, cam, undistortionMap, metadata, srcImage, evCorrection, exposureCompensation, [&mask](Image<RGBAfColor>& image) {
                       if (image.width() * image.height() != mask.width() * mask.height())
                       {
                           ALICEVISION_LOG_WARNING("Invalid image mask size: mask is ignored.");
@@ -272,7 +286,7 @@ bool prepareDenseScene(const SfMData& sfmData,
             else
             {
                 const auto noMaskingFunc = [](Image<RGBAfColor>& image) {};
-                process<Image<RGBAfColor>>(dstColorImage, cam, metadata, srcImage, evCorrection, exposureCompensation, noMaskingFunc);
+                process<Image<RGBAfColor>>(dstColorImage, cam, undistortionMap, metadata, srcImage, evCorrection, exposureCompensation, noMaskingFunc);
             }
         }
 
@@ -339,6 +353,11 @@ int aliceVision_main(int argc, char* argv[])
         return EXIT_FAILURE;
     }
 
+    // Set the OpenImageIO thread pools so that the EXR reads and writes are multi-threaded
+    HardwareContext hwc = cmdline.getHardwareContext();
+    oiio::attribute("threads", static_cast<int>(hwc.getMaxThreads()));
+    oiio::attribute("exr_threads", static_cast<int>(hwc.getMaxThreads()));
+
     // set output file type
     image::EImageFileType outputFileType = image::EImageFileType_stringToEnum(outImageFileTypeName);
 
@@ -346,9 +365,9 @@ int aliceVision_main(int argc, char* argv[])
     if (!fs::exists(outFolder))
         fs::create_directory(outFolder);
 
-    // Read the input SfM scene
+    // Read the input SfM scene (the structure is never used here, skip it)
     SfMData sfmData;
-    if (!sfmDataIO::load(sfmData, sfmDataFilename, sfmDataIO::ESfMData::ALL))
+    if (!sfmDataIO::load(sfmData, sfmDataFilename, sfmDataIO::ESfMData(sfmDataIO::VIEWS | sfmDataIO::INTRINSICS | sfmDataIO::EXTRINSICS)))
     {
         ALICEVISION_LOG_ERROR("The input SfMData file '" << sfmDataFilename << "' cannot be read.");
         return EXIT_FAILURE;
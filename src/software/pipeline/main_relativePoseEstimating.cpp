@@ -342,16 +342,12 @@ int aliceVision_main(int argc, char** argv)
 
     // Load tracks
     ALICEVISION_LOG_INFO("Load tracks");
-    std::ifstream tracksFile(tracksFilename);
-    if (tracksFile.is_open() == false)
+    track::TracksMap mapTracks;
+    if (!track::loadTracks(tracksFilename, mapTracks))
     {
         ALICEVISION_LOG_ERROR("The input tracks file '" + tracksFilename + "' cannot be read.");
         return EXIT_FAILURE;
     }
-    std::stringstream buffer;
-    buffer << tracksFile.rdbuf();
-    boost::json::value jv = boost::json::parse(buffer.str());
-    track::TracksMap mapTracks(track::flat_map_value_to<track::Track>(jv));
 
     // Compute tracks per view
     ALICEVISION_LOG_INFO("Estimate tracks per view");
@@ -502,7 +498,8 @@ int aliceVision_main(int argc, char** argv)
         double score = iinter / iunion;
         reconstructed.score = 0.5 * score + 0.5 * areaScore;
 
-// Buffered output to avoid lo
+// Buffered output: completed chunks are appended and flushed as soon as they are
+// filled, so an interrupted run still leaves its finished pairs on disk.
 #pragma omp critical
         {
             reconstructedPairs.push_back(reconstructed);
@@ -510,7 +507,7 @@ int aliceVision_main(int argc, char** argv)
             if (reconstructedPairs.size() > 1000)
             {
                 boost::json::value jv = boost::json::value_from(reconstructedPairs);
-                of << boost::json::serialize(jv);
+                of << boost::json::serialize(jv) << std::endl;
                 reconstructedPairs.clear();
             }
         }
@@ -519,7 +516,7 @@ int aliceVision_main(int argc, char** argv)
     // Serialize last pairs
     {
         boost::json::value jv = boost::json::value_from(reconstructedPairs);
-        of << boost::json::serialize(jv);
+        of << boost::json::serialize(jv) << std::endl;
     }
 
     of.close();
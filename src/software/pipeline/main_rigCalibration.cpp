@@ -93,6 +93,8 @@ int aliceVision_main(int argc, char** argv)
     std::string vocTreeFilepath;
     /// the vocabulary tree weights file
     std::string weightsFilepath;
+    /// the database snapshot file, reloaded if it exists and written otherwise
+    std::string databaseSnapshotFilepath;
     /// the localization algorithm to use for the voctree localizer
     std::string algostring = "AllResults";
     /// number of documents to search when querying the voctree
@@ -155,6 +157,10 @@ int aliceVision_main(int argc, char** argv)
          "[voctree] Filename for the vocabulary tree.")
         ("voctreeWeights", po::value<std::string>(&weightsFilepath),
          "[voctree] Filename for the vocabulary tree weights.")
+        ("voctreeDbSnapshot", po::value<std::string>(&databaseSnapshotFilepath),
+         "[voctree] Filename for the database snapshot: if the file exists the database is "
+         "reloaded from it instead of quantizing every view, otherwise the built database "
+         "is saved there for the next runs against the same map.")
         ("algorithm", po::value<std::string>(&algostring)->default_value(algostring),
          "[voctree] Algorithm type: {FirstBest,AllResults}.")
         ("nbImageMatch", po::value<std::size_t>(&numResults)->default_value(numResults),
@@ -241,7 +247,7 @@ int aliceVision_main(int argc, char** argv)
     {
         ALICEVISION_COUT("Calibrating sequence using the voctree localizer");
         localization::VoctreeLocalizer* tmpLoc =
-          new localization::VoctreeLocalizer(sfmData, descriptorsFolder, vocTreeFilepath, weightsFilepath, matchDescTypes);
+          new localization::VoctreeLocalizer(sfmData, descriptorsFolder, vocTreeFilepath, weightsFilepath, matchDescTypes, databaseSnapshotFilepath);
 
         localizer.reset(tmpLoc);
 
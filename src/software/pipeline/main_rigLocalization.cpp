@@ -11,7 +11,7 @@
 #endif
 #include <aliceVision/rig/Rig.hpp>
 #include <aliceVision/image/io.hpp>
-#include <aliceVision/dataio/FeedProvider.hpp>
+#include <aliceVision/dataio/SyncFeedProvider.hpp>
 #include <aliceVision/feature/ImageDescriber.hpp>
 #include <aliceVision/sfmData/SfMData.hpp>
 #include <aliceVision/sfmDataIO/sfmDataIO.hpp>
@@ -96,12 +96,20 @@ int aliceVision_main(int argc, char** argv)
     std::string vocTreeFilepath;
     /// the vocabulary tree weights file
     std::string weightsFilepath;
+    /// the database snapshot file, reloaded if it exists and written otherwise
+    std::string databaseSnapshotFilepath;
     /// the localization algorithm to use for the voctree localizer
     std::string algostring = "AllResults";
     /// number of documents to search when querying the voctree
     std::size_t numResults = 4;
     /// maximum number of matching documents to retain
     std::size_t maxResults = 10;
+    /// number of previous frames to match against for frame tracking
+    std::size_t nbFrameBufferMatching = 10;
+    /// enable the frame-to-frame tracking mode
+    bool useFrameTracking = false;
+    /// minimum number of associations the tracking must collect before falling back
+    std::size_t minNbTrackingAssociations = 100;
 
     // parameters for cctag localizer
     std::size_t nNearestKeyFrames = 5;
@@ -136,6 +144,9 @@ int aliceVision_main(int argc, char** argv)
          "The describer types to use for the matching.")
         ("preset", po::value<feature::EImageDescriberPreset>(&featDescPreset.descPreset)->default_value(featDescPreset.descPreset),
          "Preset for the feature extractor when localizing a new image {LOW,MEDIUM,NORMAL,HIGH,ULTRA}.")
+        ("parallelOctaves", po::value<bool>(&featDescPreset.parallelOctaves)->default_value(featDescPreset.parallelOctaves),
+         "Process the scale-space octaves concurrently when extracting the features of a new image, "
+         "to lower the per-frame latency.")
         ("resectionEstimator", po::value<robustEstimation::ERobustEstimator>(&resectionEstimator)->default_value(resectionEstimator),
          std::string("The type of *sac framework to use for resection (" + str_estimatorChoices + ").").c_str())
         ("matchingEstimator", po::value<robustEstimation::ERobustEstimator>(&matchingEstimator)->default_value(matchingEstimator),
@@ -161,6 +172,10 @@ int aliceVision_main(int argc, char** argv)
          "[voctree] Filename for the vocabulary tree.")
         ("voctreeWeights", po::value<std::string>(&weightsFilepath),
          "[voctree] Filename for the vocabulary tree weights.")
+        ("voctreeDbSnapshot", po::value<std::string>(&databaseSnapshotFilepath),
+         "[voctree] Filename for the database snapshot: if the file exists the database is "
+         "reloaded from it instead of quantizing every view, otherwise the built database "
+         "is saved there for the next runs against the same map.")
         ("algorithm", po::value<std::string>(&algostring)->default_value(algostring),
          "[voctree] Algorithm type: {FirstBest,AllResults}.")
         ("nbImageMatch", po::value<std::size_t>(&numResults)->default_value(numResults),
@@ -171,6 +186,16 @@ int aliceVision_main(int argc, char** argv)
         ("matchingError", po::value<double>(&matchingErrorMax)->default_value(matchingErrorMax),
          "[voctree] Maximum matching error (in pixels) allowed for image matching with "
          "geometric verification. If set to 0, it lets the ACRansac select an optimal value.")
+        ("nbFrameBufferMatching", po::value<std::size_t>(&nbFrameBufferMatching)->default_value(nbFrameBufferMatching),
+         "[voctree] Number of previous frames of the sequence to use for matching "
+         "(0 = Disable)")
+        ("useFrameTracking", po::value<bool>(&useFrameTracking)->default_value(useFrameTracking),
+         "[voctree] Enable the frame-to-frame tracking mode: each frame is first matched "
+         "only against the last localized frames, the full voctree retrieval runs only "
+         "when the tracking does not collect enough associations.")
+        ("minNbTrackingAssociations", po::value<std::size_t>(&minNbTrackingAssociations)->default_value(minNbTrackingAssociations),
+         "[voctree] Minimum number of 2D-3D associations the frame tracking must collect, "
+         "below this the localization falls back to the full voctree retrieval.")
     #if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_CCTAG)
         // parameters for cctag localizer
         ("nNearestKeyFrames", po::value<std::size_t>(&nNearestKeyFrames)->default_value(nNearestKeyFrames),
@@ -243,7 +268,7 @@ int aliceVision_main(int argc, char** argv)
     {
         ALICEVISION_COUT("Localizing sequence using the voctree localizer");
         localization::VoctreeLocalizer* tmpLoc =
-          new localization::VoctreeLocalizer(sfmData, descriptorsFolder, vocTreeFilepath, weightsFilepath, matchDescTypes);
+          new localization::VoctreeLocalizer(sfmData, descriptorsFolder, vocTreeFilepath, weightsFilepath, matchDescTypes, databaseSnapshotFilepath);
         localizer.reset(tmpLoc);
 
         localization::VoctreeLocalizer::Parameters* tmpParam = new localization::VoctreeLocalizer::Parameters();
@@ -254,6 +279,9 @@ int aliceVision_main(int argc, char** argv)
         tmpParam->_maxResults = maxResults;
         tmpParam->_ccTagUseCuda = false;
         tmpParam->_matchingError = matchingErrorMax;
+        tmpParam->_nbFrameBufferMatching = nbFrameBufferMatching;
+        tmpParam->_useFrameTracking = useFrameTracking;
+        tmpParam->_minNbTrackingAssociations = minNbTrackingAssociations;
     }
 #if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_CCTAG)
     else
@@ -304,25 +332,22 @@ int aliceVision_main(int argc, char** argv)
     }
 #endif
 
-    std::vector<dataio::FeedProvider*> feeders(numCameras);
     std::vector<std::string> subMediaFilepath(numCameras);
 
-    // Init the feeder for each camera
     for (std::size_t idCamera = 0; idCamera < numCameras; ++idCamera)
     {
-        const std::string& calibFile = cameraIntrinsics[idCamera];
-        const std::string& feedPath = mediaPath[idCamera];
         // contains the folder where the video, the images or the filelist is
         subMediaFilepath[idCamera] =
           fs::is_directory(fs::path(mediaPath[idCamera])) ? (mediaPath[idCamera]) : (fs::path(mediaPath[idCamera]).parent_path().string());
+    }
 
-        // create the feedProvider
-        feeders[idCamera] = new dataio::FeedProvider(feedPath, calibFile);
-        if (!feeders[idCamera]->isInit())
-        {
-            ALICEVISION_CERR("ERROR while initializing the FeedProvider for the camera " << idCamera << " " << feedPath);
-            return EXIT_FAILURE;
-        }
+    // create the synchronized feed, one prefetch thread per camera so that the decoding
+    // of the cameras of the rig overlaps instead of being serialized per frame
+    dataio::SyncFeedProvider feed(mediaPath, cameraIntrinsics);
+    if (!feed.isInit())
+    {
+        ALICEVISION_CERR("ERROR while initializing the FeedProvider for one of the cameras!");
+        return EXIT_FAILURE;
     }
 
     bool haveImage = true;
@@ -345,51 +370,33 @@ int aliceVision_main(int argc, char** argv)
 
     while (haveImage)
     {
+        // get the next synchronized frame of every camera, decoded in parallel by the feed
+        std::vector<dataio::SyncFeedProvider::Frame> frames;
+        haveImage = feed.readNextSynchronizedFrames(frames);
+        if (!haveImage)
+        {
+            // no more images are available
+            break;
+        }
+
         // @fixme It's better to have arrays of pointers...
         std::vector<image::Image<float>> vec_imageGrey;
         std::vector<camera::Pinhole> vec_queryIntrinsics;
         vec_imageGrey.reserve(numCameras);
         vec_queryIntrinsics.reserve(numCameras);
 
-        // for each camera get the image and the associated internal parameters
         for (std::size_t idCamera = 0; idCamera < numCameras; ++idCamera)
         {
-            image::Image<float> imageGrey;
-            camera::Pinhole queryIntrinsics;
-            bool hasIntrinsics = false;
-            std::string currentImgName;
-            haveImage = feeders[idCamera]->readImage(imageGrey, queryIntrinsics, currentImgName, hasIntrinsics);
-            feeders[idCamera]->goToNextFrame();
-
-            if (!haveImage)
-            {
-                if (idCamera > 0)
-                {
-                    // this is quite odd, it means that eg the fist camera has an image but
-                    // one of the others has not image
-                    ALICEVISION_CERR("This is weird... Camera " << idCamera
-                                                                << " seems not to have any available images while some other cameras do...");
-                    return EXIT_FAILURE;  // a bit harsh but if we are here it's cheesy to say the less
-                }
-                break;
-            }
-
             // for now let's suppose that the cameras are calibrated internally too
-            if (!hasIntrinsics)
+            if (!frames[idCamera].hasIntrinsics)
             {
                 ALICEVISION_CERR("For now only internally calibrated cameras are supported!"
-                                 << "\nCamera " << idCamera << " does not have calibration for image " << currentImgName);
+                                 << "\nCamera " << idCamera << " does not have calibration for image " << frames[idCamera].mediaPath);
                 return EXIT_FAILURE;  // a bit harsh but if we are here it's cheesy to say the less
             }
 
-            vec_imageGrey.push_back(imageGrey);
-            vec_queryIntrinsics.push_back(queryIntrinsics);
-        }
-
-        if (!haveImage)
-        {
-            // no more images are available
-            break;
+            vec_imageGrey.push_back(std::move(frames[idCamera].image));
+            vec_queryIntrinsics.push_back(frames[idCamera].camIntrinsics);
         }
 
         ALICEVISION_COUT("******************************");
@@ -19,6 +19,7 @@
 #include <aliceVision/system/Logger.hpp>
 #include <aliceVision/system/main.hpp>
 #include <aliceVision/system/Timer.hpp>
+#include <aliceVision/system/Trace.hpp>
 
 #include <geogram/basic/common.h>
 
@@ -205,7 +206,10 @@ int aliceVision_main(int argc, char* argv[])
         // Need visibilities to compute unwrap
         mesh.remapVisibilities(texParams.visibilityRemappingMethod, mp, refMesh);
         ALICEVISION_LOG_INFO("Input mesh has no UV coordinates, start unwrapping (" + unwrapMethod + ")");
-        mesh.unwrap(mp, mesh::EUnwrapMethod_stringToEnum(unwrapMethod));
+        {
+            system::TraceSpan span("unwrap");
+            mesh.unwrap(mp, mesh::EUnwrapMethod_stringToEnum(unwrapMethod));
+        }
         ALICEVISION_LOG_INFO("Unwrapping done.");
     }
 
@@ -233,6 +237,7 @@ int aliceVision_main(int argc, char* argv[])
     if (!inputMeshFilepath.empty() && !sfmDataFilename.empty() && texParams.textureFileType != image::EImageFileType::NONE)
     {
         ALICEVISION_LOG_INFO("Generate textures.");
+        system::TraceSpan span("generateTextures");
         mesh.generateTextures(mp, outputFolder, hwc.getMaxMemory(), texParams.textureFileType);
     }
 
@@ -241,6 +246,7 @@ int aliceVision_main(int argc, char* argv[])
          bumpMappingParams.displacementFileType != image::EImageFileType::NONE))
     {
         ALICEVISION_LOG_INFO("Generate height and normal maps.");
+        system::TraceSpan span("generateNormalAndHeightMaps");
 
         mesh::Mesh denseMesh;
         denseMesh.load(inputRefMeshFilepath);
@@ -251,6 +257,7 @@ int aliceVision_main(int argc, char* argv[])
     // save final obj file
     if (!inputMeshFilepath.empty())
     {
+        system::TraceSpan span("saveTexturedMesh", "io");
         mesh.saveAs(outputFolder, "texturedMesh", outputMeshFileType);
     }
 
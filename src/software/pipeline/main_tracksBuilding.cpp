@@ -44,6 +44,7 @@ int aliceVision_main(int argc, char** argv)
     int minNbMatches = 0;
     int minInputTrackLength = 2;
     bool filterTrackForks = true;
+    bool useMultithreading = true;
     bool useOnlyMatchesFromInputFolder = false;
 
     // user optional parameters
@@ -78,7 +79,9 @@ int aliceVision_main(int argc, char** argv)
          "Matches folders previously added to the SfMData file will be ignored.")
         ("filterTrackForks", po::value<bool>(&filterTrackForks)->default_value(filterTrackForks),
          "Enable/Disable the track forks removal. "
-         "A track contains a fork when incoherent matches leads to multiple features in the same image for a single track.");
+         "A track contains a fork when incoherent matches leads to multiple features in the same image for a single track.")
+        ("useMultithreading", po::value<bool>(&useMultithreading)->default_value(useMultithreading),
+         "Enable/Disable multithreading in the track construction and filtering.");
     // clang-format on
 
     CmdLine cmdline("AliceVision tracksBuilding");
@@ -127,23 +130,22 @@ int aliceVision_main(int argc, char** argv)
     // Create tracks
     track::TracksBuilder tracksBuilder;
     ALICEVISION_LOG_INFO("Track building");
-    tracksBuilder.build(pairwiseMatches);
+    tracksBuilder.build(pairwiseMatches, useMultithreading);
 
     ALICEVISION_LOG_INFO("Track filtering");
-    tracksBuilder.filter(filterTrackForks, minInputTrackLength);
+    tracksBuilder.filter(filterTrackForks, minInputTrackLength, useMultithreading);
 
     ALICEVISION_LOG_INFO("Track export to structure");
     track::TracksMap mapTracks;
     tracksBuilder.exportToSTL(mapTracks);
 
-    // write the json file with the tree
+    // write the tracks file (JSON or indexed binary, based on the extension)
     ALICEVISION_LOG_INFO("Export to file");
-    std::stringstream ss;
-
-    boost::json::value jv = boost::json::value_from(mapTracks);
-    std::ofstream of(tracksFilename);
-    of << boost::json::serialize(jv);
-    of.close();
+    if (!track::saveTracks(tracksFilename, mapTracks))
+    {
+        ALICEVISION_LOG_ERROR("Unable to write the output tracks file '" + tracksFilename + "'.");
+        return EXIT_FAILURE;
+    }
 
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,124 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <aliceVision/system/Logger.hpp>
+#include <aliceVision/system/main.hpp>
+
+#include <boost/program_options/parsers.hpp>
+
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+// These constants define the current software version.
+// They must be updated when the command line is changed.
+#define ALICEVISION_SOFTWARE_VERSION_MAJOR 1
+#define ALICEVISION_SOFTWARE_VERSION_MINOR 0
+
+using namespace aliceVision;
+
+// Stage entry points built into the worker with a unique name (see worker/*Stage.cpp),
+// each one is the unmodified aliceVision_main() of the corresponding tool.
+int aliceVision_main_featureExtraction(int argc, char* argv[]);
+int aliceVision_main_imageMatching(int argc, char* argv[]);
+int aliceVision_main_featureMatching(int argc, char* argv[]);
+int aliceVision_main_incrementalSfM(int argc, char* argv[]);
+
+/**
+ * Persistent worker executing a sequence of pipeline stage invocations in a single process.
+ *
+ * The worker reads one invocation per line from the standard input: the stage name followed
+ * by the arguments of the corresponding tool (shell-like quoting is supported), e.g.
+ *
+ *     featureExtraction --input scene.sfm --output features/
+ *     featureMatching --input scene.sfm --featuresFolders features/ --output matches/
+ *     exit
+ *
+ * After each stage the worker writes a status line "worker done <stage> <exitCode>" to the
+ * standard output, so a supervisor (e.g. Meshroom) can chain the stages of a chunk without
+ * paying one process spawn and one round of global initializations per stage.
+ */
+int aliceVision_main(int argc, char** argv)
+{
+    const std::map<std::string, std::function<int(int, char**)>> stages = {
+      {"featureExtraction", aliceVision_main_featureExtraction},
+      {"imageMatching", aliceVision_main_imageMatching},
+      {"featureMatching", aliceVision_main_featureMatching},
+      {"incrementalSfM", aliceVision_main_incrementalSfM},
+    };
+
+    if (argc > 1)
+    {
+        // the worker has no command line options, any argument prints the protocol description
+        std::cout << "Usage: " << argv[0] << std::endl
+                  << std::endl
+                  << "Reads one stage invocation per line from the standard input, as the stage name" << std::endl
+                  << "followed by the arguments of the corresponding tool, and executes the stages" << std::endl
+                  << "sequentially in this process. An empty line is ignored, \"exit\" stops the worker." << std::endl
+                  << "After each stage, \"worker done <stage> <exitCode>\" is written to the standard output." << std::endl
+                  << std::endl
+                  << "Available stages:" << std::endl;
+
+        for (const auto& stagePair : stages)
+            std::cout << "\t- " << stagePair.first << std::endl;
+
+        const std::string arg(argv[1]);
+        return (arg == "-h" || arg == "--help") ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    ALICEVISION_LOG_INFO("Worker ready, reading stage invocations from the standard input.");
+    std::cout << "worker ready" << std::endl;
+
+    std::string line;
+    while (std::getline(std::cin, line))
+    {
+        std::vector<std::string> args = boost::program_options::split_unix(line);
+
+        if (args.empty())
+            continue;
+
+        const std::string stageName = args.front();
+
+        if (stageName == "exit")
+            break;
+
+        const auto stageIt = stages.find(stageName);
+        if (stageIt == stages.end())
+        {
+            ALICEVISION_LOG_ERROR("Unknown stage '" << stageName << "'.");
+            std::cout << "worker error " << stageName << " unknown stage" << std::endl;
+            continue;
+        }
+
+        // rebuild an argv for the stage, argv[0] being the stage name
+        std::vector<char*> stageArgv;
+        stageArgv.reserve(args.size());
+        for (std::string& arg : args)
+            stageArgv.push_back(arg.data());
+
+        // same protection as the main() wrapper: a failed stage must not kill the worker
+        int status = EXIT_FAILURE;
+        try
+        {
+            status = stageIt->second(static_cast<int>(stageArgv.size()), stageArgv.data());
+        }
+        catch (const std::exception& e)
+        {
+            ALICEVISION_LOG_ERROR(e.what());
+        }
+        catch (...)
+        {
+            ALICEVISION_LOG_ERROR("Unknown exception in stage '" << stageName << "'.");
+        }
+
+        std::cout << "worker done " << stageName << " " << status << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
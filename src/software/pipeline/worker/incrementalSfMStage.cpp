@@ -0,0 +1,12 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Build the incrementalSfM tool into the worker under a unique entry point name,
+// so that the stage implementation stays single-source (see main_worker.cpp).
+#define ALICEVISION_NO_MAIN
+#define aliceVision_main aliceVision_main_incrementalSfM
+
+#include "../main_incrementalSfM.cpp"
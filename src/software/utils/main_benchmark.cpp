@@ -0,0 +1,369 @@
+// This file is part of the AliceVision project.
+// Copyright (c) 2026 AliceVision contributors.
+// This Source Code Form is subject to the terms of the Mozilla Public License,
+// v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <aliceVision/config.hpp>
+#include <aliceVision/system/Logger.hpp>
+#include <aliceVision/cmdline/cmdline.hpp>
+#include <aliceVision/system/main.hpp>
+#include <aliceVision/system/Timer.hpp>
+#include <aliceVision/mvsData/Point3d.hpp>
+#include <aliceVision/mvsData/StaticVector.hpp>
+#include <aliceVision/mesh/Mesh.hpp>
+#include <aliceVision/fuseCut/MaxFlow_PushRelabel.hpp>
+#include <aliceVision/multiview/resection/P4PfSolver.hpp>
+
+#if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_CUDA)
+    #include <aliceVision/depthMap/cuda/host/memory.hpp>
+    #include <aliceVision/depthMap/cuda/host/DeviceMemoryPool.hpp>
+    #include <aliceVision/depthMap/cuda/host/utils.hpp>
+#endif
+
+#include <boost/program_options.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#if !defined(_WIN32)
+    #include <sys/resource.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+// These constants define the current software version.
+// They must be updated when the command line is changed.
+#define ALICEVISION_SOFTWARE_VERSION_MAJOR 1
+#define ALICEVISION_SOFTWARE_VERSION_MINOR 0
+
+using namespace aliceVision;
+
+namespace po = boost::program_options;
+namespace pt = boost::property_tree;
+
+namespace {
+
+/**
+ * @brief Peak resident set size of the process, in megabytes.
+ */
+double getPeakRssMB()
+{
+#if defined(_WIN32)
+    return 0.0;  // not reported on this platform
+#else
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    #if defined(__APPLE__)
+    return double(usage.ru_maxrss) / (1024.0 * 1024.0);  // bytes
+    #else
+    return double(usage.ru_maxrss) / 1024.0;  // kilobytes
+    #endif
+#endif
+}
+
+/**
+ * @brief One registered benchmark: the body returns the GPU time in milliseconds, or a
+ * negative value if the benchmark has no GPU part.
+ */
+struct Benchmark
+{
+    std::string name;
+    std::function<double()> body;
+};
+
+/**
+ * @brief Build a deterministic terrain-like grid mesh (dim x dim vertices).
+ */
+void buildSyntheticGridMesh(mesh::Mesh& mesh, int dim)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> heightDistribution(0.0, 0.1);
+
+    mesh.pts.reserve(dim * dim);
+    for (int y = 0; y < dim; ++y)
+        for (int x = 0; x < dim; ++x)
+            mesh.pts.push_back(Point3d(double(x), double(y), heightDistribution(rng)));
+
+    mesh.tris.reserve(2 * (dim - 1) * (dim - 1));
+    for (int y = 0; y < dim - 1; ++y)
+    {
+        for (int x = 0; x < dim - 1; ++x)
+        {
+            const int p = y * dim + x;
+            mesh.tris.push_back(mesh::Mesh::triangle(p, p + 1, p + dim));
+            mesh.tris.push_back(mesh::Mesh::triangle(p + 1, p + dim + 1, p + dim));
+        }
+    }
+}
+
+/**
+ * @brief Vertex neighborhood construction, normal computation and normal smoothing
+ * on a synthetic grid mesh, as run by meshFiltering.
+ */
+double benchmarkMeshSmoothNormals(int scale)
+{
+    mesh::Mesh mesh;
+    buildSyntheticGridMesh(mesh, 500 * scale);
+
+    StaticVector<StaticVector<int>> ptsNeighPts;
+    mesh.getPtsNeighPtsOrdered(ptsNeighPts);
+
+    StaticVector<Point3d> nms;
+    mesh.computeNormalsForPts(nms);
+    mesh.smoothNormals(nms, ptsNeighPts);
+
+    return -1.0;
+}
+
+/**
+ * @brief Minimum s-t cut of a 6-connected grid graph with random capacities,
+ * the shape of the graph-cut solved by GraphFiller::binarize.
+ */
+double benchmarkMaxFlow(int scale)
+{
+    const int dim = 50 * scale;
+    const int nbNodes = dim * dim * dim;
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> capacityDistribution(0.f, 10.f);
+
+    fuseCut::MaxFlow_PushRelabel maxFlowGraph(nbNodes);
+
+    for (int n = 0; n < nbNodes; ++n)
+        maxFlowGraph.addNode(n, capacityDistribution(rng), capacityDistribution(rng));
+
+    const auto nodeIndex = [dim](int x, int y, int z) { return (z * dim + y) * dim + x; };
+    for (int z = 0; z < dim; ++z)
+    {
+        for (int y = 0; y < dim; ++y)
+        {
+            for (int x = 0; x < dim; ++x)
+            {
+                if (x + 1 < dim)
+                    maxFlowGraph.addEdge(nodeIndex(x, y, z), nodeIndex(x + 1, y, z), capacityDistribution(rng), capacityDistribution(rng));
+                if (y + 1 < dim)
+                    maxFlowGraph.addEdge(nodeIndex(x, y, z), nodeIndex(x, y + 1, z), capacityDistribution(rng), capacityDistribution(rng));
+                if (z + 1 < dim)
+                    maxFlowGraph.addEdge(nodeIndex(x, y, z), nodeIndex(x, y, z + 1), capacityDistribution(rng), capacityDistribution(rng));
+            }
+        }
+    }
+
+    maxFlowGraph.compute();
+
+    return -1.0;
+}
+
+/**
+ * @brief P4Pf minimal solver and residual evaluation over many random hypothesis samples,
+ * the work done by a RANSAC-based localization.
+ */
+double benchmarkResectionP4Pf(int scale)
+{
+    const int nbPoints = 500;
+    const int nbSamples = 2000 * scale;
+    const double focal = 1000.0;
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> pointDistribution(-2.0, 2.0);
+    std::uniform_real_distribution<double> depthDistribution(4.0, 8.0);
+    std::uniform_int_distribution<int> indexDistribution(0, nbPoints - 1);
+
+    // synthetic cloud in front of a camera at the origin, projected with a known focal length
+    Mat x3d(3, nbPoints);
+    Mat x2d(2, nbPoints);
+    for (int i = 0; i < nbPoints; ++i)
+    {
+        x3d(0, i) = pointDistribution(rng);
+        x3d(1, i) = pointDistribution(rng);
+        x3d(2, i) = depthDistribution(rng);
+        x2d(0, i) = focal * x3d(0, i) / x3d(2, i);
+        x2d(1, i) = focal * x3d(1, i) / x3d(2, i);
+    }
+
+    const multiview::resection::P4PfSolver solver;
+    const multiview::resection::P4PfError errorEstimator;
+    std::vector<multiview::resection::P4PfModel> models;
+
+    Mat sample2d(2, 4);
+    Mat sample3d(3, 4);
+    double bestError = std::numeric_limits<double>::max();
+
+    for (int s = 0; s < nbSamples; ++s)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            const int index = indexDistribution(rng);
+            sample2d.col(i) = x2d.col(index);
+            sample3d.col(i) = x3d.col(index);
+        }
+
+        models.clear();
+        solver.solve(sample2d, sample3d, models);
+
+        // evaluate each hypothesis over all the correspondences, as RANSAC scoring does
+        for (const multiview::resection::P4PfModel& model : models)
+        {
+            double sumError = 0.0;
+            for (int i = 0; i < nbPoints; ++i)
+                sumError += errorEstimator.error(model, x2d.col(i), x3d.col(i));
+            bestError = std::min(bestError, sumError);
+        }
+    }
+
+    if (bestError > 1.0)
+        ALICEVISION_LOG_WARNING("Unexpected residual in the P4Pf benchmark: " << bestError);
+
+    return -1.0;
+}
+
+#if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_CUDA)
+/**
+ * @brief Device buffer allocation and host/device transfers of depth-map-sized and
+ * volume-sized buffers, timed on the device with CUDA events.
+ */
+double benchmarkGpuMemory(int scale)
+{
+    using namespace depthMap;
+
+    const CudaSize<2> size(1024 * scale, 1024 * scale);
+
+    CudaHostMemoryHeap<float, 2> buffer_hmh(size);
+    std::fill(buffer_hmh.getBuffer(), buffer_hmh.getBuffer() + buffer_hmh.getUnitsTotal(), 1.f);
+
+    cudaEvent_t start;
+    cudaEvent_t stop;
+    CHECK_CUDA_RETURN_ERROR(cudaEventCreate(&start));
+    CHECK_CUDA_RETURN_ERROR(cudaEventCreate(&stop));
+
+    CHECK_CUDA_RETURN_ERROR(cudaEventRecord(start, 0));
+
+    for (int i = 0; i < 16; ++i)
+    {
+        CudaDeviceMemoryPitched<float, 2> buffer_dmp(size);
+        buffer_dmp.copyFrom(buffer_hmh);
+        buffer_hmh.copyFrom(buffer_dmp);
+    }
+
+    CHECK_CUDA_RETURN_ERROR(cudaEventRecord(stop, 0));
+    CHECK_CUDA_RETURN_ERROR(cudaEventSynchronize(stop));
+
+    float gpuTimeMs = 0.f;
+    CHECK_CUDA_RETURN_ERROR(cudaEventElapsedTime(&gpuTimeMs, start, stop));
+
+    CHECK_CUDA_RETURN_ERROR(cudaEventDestroy(start));
+    CHECK_CUDA_RETURN_ERROR(cudaEventDestroy(stop));
+
+    DeviceMemoryPool::getInstance().clear();
+
+    return double(gpuTimeMs);
+}
+#endif
+
+}  // namespace
+
+/*
+ * This program runs reproducible benchmarks of the MVS stack building blocks on
+ * synthetic inputs and writes the measurements as JSON, so successive runs on the
+ * same hardware can be compared to catch performance regressions.
+ */
+int aliceVision_main(int argc, char** argv)
+{
+    std::string outputJsonPath;
+    std::string benchmarkNames;
+    int nbRuns = 3;
+    int scale = 1;
+
+    // clang-format off
+    po::options_description requiredParams("Required parameters");
+    requiredParams.add_options()
+        ("output,o", po::value<std::string>(&outputJsonPath)->required(),
+         "Output JSON report file.");
+
+    po::options_description optionalParams("Optional parameters");
+    optionalParams.add_options()
+        ("benchmarks", po::value<std::string>(&benchmarkNames)->default_value(benchmarkNames),
+         "Comma-separated list of benchmark names to run (empty: run all).")
+        ("nbRuns", po::value<int>(&nbRuns)->default_value(nbRuns),
+         "Number of runs per benchmark (the best run is reported next to the individual times).")
+        ("scale", po::value<int>(&scale)->default_value(scale),
+         "Size multiplier of the synthetic inputs.");
+    // clang-format on
+
+    CmdLine cmdline("AliceVision benchmark");
+    cmdline.add(requiredParams);
+    cmdline.add(optionalParams);
+    if (!cmdline.execute(argc, argv))
+    {
+        return EXIT_FAILURE;
+    }
+
+    std::vector<Benchmark> benchmarks = {
+      {"mesh_smoothNormals", [&]() { return benchmarkMeshSmoothNormals(scale); }},
+      {"fuseCut_maxFlow", [&]() { return benchmarkMaxFlow(scale); }},
+      {"resection_p4pf", [&]() { return benchmarkResectionP4Pf(scale); }},
+#if ALICEVISION_IS_DEFINED(ALICEVISION_HAVE_CUDA)
+      {"gpu_deviceMemory", [&]() { return benchmarkGpuMemory(scale); }},
+#endif
+    };
+
+    pt::ptree reportTree;
+    reportTree.put("nbRuns", nbRuns);
+    reportTree.put("scale", scale);
+
+    pt::ptree benchmarksTree;
+
+    for (const Benchmark& benchmark : benchmarks)
+    {
+        if (!benchmarkNames.empty() && benchmarkNames.find(benchmark.name) == std::string::npos)
+            continue;
+
+        ALICEVISION_LOG_INFO("Run benchmark: " << benchmark.name);
+
+        pt::ptree runsTree;
+        double bestWallTimeMs = std::numeric_limits<double>::max();
+        double bestGpuTimeMs = -1.0;
+
+        for (int run = 0; run < nbRuns; ++run)
+        {
+            system::Timer timer;
+            const double gpuTimeMs = benchmark.body();
+            const double wallTimeMs = timer.elapsedMs();
+
+            if (wallTimeMs < bestWallTimeMs)
+            {
+                bestWallTimeMs = wallTimeMs;
+                bestGpuTimeMs = gpuTimeMs;
+            }
+
+            pt::ptree runTree;
+            runTree.put("", wallTimeMs);
+            runsTree.push_back(std::make_pair("", runTree));
+        }
+
+        pt::ptree benchmarkTree;
+        benchmarkTree.put("name", benchmark.name);
+        benchmarkTree.add_child("wallTimesMs", runsTree);
+        benchmarkTree.put("bestWallTimeMs", bestWallTimeMs);
+        if (bestGpuTimeMs >= 0.0)
+            benchmarkTree.put("gpuTimeMs", bestGpuTimeMs);
+        benchmarkTree.put("peakRssMB", getPeakRssMB());
+
+        benchmarksTree.push_back(std::make_pair("", benchmarkTree));
+
+        ALICEVISION_LOG_INFO("Benchmark " << benchmark.name << " done: " << bestWallTimeMs << " ms (best of " << nbRuns << ").");
+    }
+
+    reportTree.add_child("benchmarks", benchmarksTree);
+    pt::write_json(outputJsonPath, reportTree);
+
+    ALICEVISION_LOG_INFO("Benchmark report saved: " << outputJsonPath);
+
+    return EXIT_SUCCESS;
+}
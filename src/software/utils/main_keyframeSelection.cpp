@@ -51,6 +51,9 @@ int aliceVision_main(int argc, char** argv)
     std::size_t rescaledWidthFlow = 720;    // width of the rescaled frames for the flow; 0 if no rescale is performed (smart selection)
     std::size_t sharpnessWindowSize = 200;  // sliding window's size in sharpness computation (smart selection)
     std::size_t flowCellSize = 90;          // size of the cells within a frame used to compute the optical flow (smart selection)
+    bool useCoarseToFine = false;           // score all the frames at a subsampled resolution, refine around candidates only (smart selection)
+    std::size_t coarseScale = 4;            // divider applied to the rescaled widths for the coarse scoring pass (smart selection)
+    std::size_t refinementRadius = 5;       // number of frames around a candidate keyframe rescored at the requested resolution (smart selection)
     std::string outputExtension = "exr";    // file extension of the written keyframes (keyframes will not be written if set to "none")
     image::EStorageDataType exrDataType =   // storage data type for EXR output files
       image::EStorageDataType::Float;
@@ -138,6 +141,16 @@ int aliceVision_main(int argc, char** argv)
          "Size, in pixels, of the sliding window that is used to compute the sharpness score of a frame.")
         ("flowCellSize", po::value<std::size_t>(&flowCellSize)->default_value(flowCellSize),
          "Size, in pixels, of the cells within an input frame that are used to compute the optical flow scores.")
+        ("useCoarseToFine", po::value<bool>(&useCoarseToFine)->default_value(useCoarseToFine),
+         "Score all the frames at an aggressively subsampled resolution first, and rescore only the frames around "
+         "each candidate keyframe at the requested resolution. Much faster on long takes, at the cost of slightly "
+         "less accurate subsequence boundaries.")
+        ("coarseScale", po::value<std::size_t>(&coarseScale)->default_value(coarseScale),
+         "Divider applied to the rescaled widths for the coarse scoring pass of the coarse-to-fine selection "
+         "(must be greater than 1).")
+        ("refinementRadius", po::value<std::size_t>(&refinementRadius)->default_value(refinementRadius),
+         "Number of frames on each side of a candidate keyframe that are rescored at the requested resolution "
+         "during the coarse-to-fine selection.")
         ("minBlockSize", po::value<std::size_t>(&minBlockSize)->default_value(minBlockSize),
          "Minimum number of frames processed by a single thread when multi-threading is used.")
         ("maskPaths", po::value<std::vector<std::string>>(&maskPaths)->default_value(models)->multitoken(),
@@ -277,7 +290,10 @@ int aliceVision_main(int argc, char** argv)
     }
 
     // Process media paths with regular or smart method
-    if (useSmartSelection)
+    if (useSmartSelection && useCoarseToFine)
+        selector.processSmartCoarseToFine(
+          pxDisplacement, rescaledWidthSharp, rescaledWidthFlow, sharpnessWindowSize, flowCellSize, coarseScale, refinementRadius, skipSharpnessComputation);
+    else if (useSmartSelection)
         selector.processSmart(pxDisplacement, rescaledWidthSharp, rescaledWidthFlow, sharpnessWindowSize, flowCellSize, skipSharpnessComputation);
     else
         selector.processRegular();
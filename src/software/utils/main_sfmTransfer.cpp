@@ -303,7 +303,7 @@ int aliceVision_main(int argc, char** argv)
                             commonViewsMap.emplace(viewPair.second, viewPair.first);
                         }
 
-                        std::map<IndexT, aliceVision::sfmData::Landmark> newLandmarks;
+                        aliceVision::sfmData::Landmarks newLandmarks;
                         for (const auto& landIt : refLandmarks)
                         {
                             // Copy of the current landmark :
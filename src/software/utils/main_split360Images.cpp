@@ -30,6 +30,8 @@
 #include <iterator>
 #include <filesystem>
 #include <fstream>
+#include <map>
+#include <mutex>
 #include <vector>
 #include <memory>
 
@@ -55,9 +57,10 @@ class PinholeCameraR
       : _R(R)
     {
         _K << focal, 0, width / 2.0, 0, focal, height / 2.0, 0, 0, 1;
+        _Kinv = _K.inverse();
     }
 
-    Vec3 getLocalRay(double x, double y) const { return (_K.inverse() * Vec3(x, y, 1.0)).normalized(); }
+    Vec3 getLocalRay(double x, double y) const { return (_Kinv * Vec3(x, y, 1.0)).normalized(); }
 
     Vec3 getRay(double x, double y) const { return _R * getLocalRay(x, y); }
 
@@ -66,6 +69,8 @@ class PinholeCameraR
     Mat3 _R;
     /// Intrinsic matrix
     Mat3 _K;
+    /// Inverse intrinsic matrix, cached as it is applied per pixel
+    Mat3 _Kinv;
 };
 
 /**
@@ -84,6 +89,86 @@ double focalFromPinholeHeight(int height, double thetaMax = degreeToRadian(60.0)
     return f;
 }
 
+/**
+ * @brief Backward-mapping look-up tables from the pinhole splits to the equirectangular
+ * source: for each split, the source coordinates of every output pixel.
+ * The mapping only depends on the split layout and the source dimensions, not on the
+ * frame content, so it is computed once and shared across all the frames of a sequence.
+ */
+struct EquirectangularLUT
+{
+    /// One map per split, splitResolution * splitResolution coordinates in row major order
+    std::vector<std::vector<Vec2f>> maps;
+};
+
+/**
+ * @brief Lazily built cache of the remap LUTs, keyed on the source image dimensions
+ * (all the frames of a video share a single entry).
+ */
+class EquirectangularLUTCache
+{
+  public:
+    EquirectangularLUTCache(std::size_t nbSplits, std::size_t splitResolution, double fovDegree)
+      : _nbSplits(nbSplits),
+        _splitResolution(splitResolution),
+        _fovDegree(fovDegree)
+    {}
+
+    /// Get the LUT for the given source dimensions, building it on first use
+    std::shared_ptr<const EquirectangularLUT> get(int inWidth, int inHeight)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        const auto key = std::make_pair(inWidth, inHeight);
+        const auto it = _luts.find(key);
+        if (it != _luts.end())
+        {
+            return it->second;
+        }
+
+        auto lut = std::make_shared<EquirectangularLUT>();
+        lut->maps.resize(_nbSplits);
+
+        const double twoPi = boost::math::constants::pi<double>() * 2.0;
+        const double alpha = twoPi / static_cast<double>(_nbSplits);
+
+        const double fov = degreeToRadian(_fovDegree);
+        const double focal_px = (_splitResolution / 2.0) / tan(fov / 2.0);
+
+        double angle = 0.0;
+        for (std::size_t s = 0; s < _nbSplits; ++s)
+        {
+            const PinholeCameraR camera(focal_px, _splitResolution, _splitResolution, RotationAroundY(angle));
+
+            std::vector<Vec2f>& map = lut->maps[s];
+            map.resize(_splitResolution * _splitResolution);
+
+            for (int j = 0; j < _splitResolution; ++j)
+            {
+                for (int i = 0; i < _splitResolution; ++i)
+                {
+                    const Vec3 ray = camera.getRay(i, j);
+                    const Vec2 x = SphericalMapping::toEquirectangular(ray, inWidth, inHeight);
+                    map[j * _splitResolution + i] = x.cast<float>();
+                }
+            }
+
+            angle += alpha;
+        }
+
+        _luts.emplace(key, lut);
+        return lut;
+    }
+
+  private:
+    std::size_t _nbSplits;
+    std::size_t _splitResolution;
+    double _fovDegree;
+
+    std::map<std::pair<int, int>, std::shared_ptr<const EquirectangularLUT>> _luts;
+    std::mutex _mutex;
+};
+
 bool splitDualFisheye(sfmData::SfMData& outSfmData,
                       const std::string& imagePath,
                       const std::string& outputFolder,
@@ -172,6 +257,7 @@ bool splitEquirectangular(sfmData::SfMData& outSfmData,
                           const std::string& imagePath,
                           const std::string& outputFolder,
                           const std::string& extension,
+                          EquirectangularLUTCache& lutCache,
                           std::size_t nbSplits,
                           std::size_t splitResolution,
                           double fovDegree)
@@ -183,20 +269,11 @@ bool splitEquirectangular(sfmData::SfMData& outSfmData,
     const int inWidth = imageSource.width();
     const int inHeight = imageSource.height();
 
-    std::vector<PinholeCameraR> cameras;
-
-    const double twoPi = boost::math::constants::pi<double>() * 2.0;
-    const double alpha = twoPi / static_cast<double>(nbSplits);
-
     const double fov = degreeToRadian(fovDegree);
     const double focal_px = (splitResolution / 2.0) / tan(fov / 2.0);
 
-    double angle = 0.0;
-    for (std::size_t i = 0; i < nbSplits; ++i)
-    {
-        cameras.emplace_back(focal_px, splitResolution, splitResolution, RotationAroundY(angle));
-        angle += alpha;
-    }
+    // Retrieve the backward mapping, computed once for the whole sequence
+    const std::shared_ptr<const EquirectangularLUT> lut = lutCache.get(inWidth, inHeight);
 
     const image::Sampler2d<image::SamplerLinear> sampler;
     image::Image<image::RGBColor> imaOut(splitResolution, splitResolution, image::BLACK);
@@ -205,19 +282,18 @@ bool splitEquirectangular(sfmData::SfMData& outSfmData,
     std::string rigFolder = outputFolder + "/rig";
     fs::create_directory(rigFolder);
 
-    size_t index = 0;
-    for (const PinholeCameraR& camera : cameras)
+    for (size_t index = 0; index < nbSplits; ++index)
     {
         imaOut.fill(image::BLACK);
 
         // Backward mapping:
         // - Find for each pixels of the pinhole image where it comes from the panoramic image
+        const std::vector<Vec2f>& map = lut->maps[index];
         for (int j = 0; j < splitResolution; ++j)
         {
             for (int i = 0; i < splitResolution; ++i)
             {
-                const Vec3 ray = camera.getRay(i, j);
-                const Vec2 x = SphericalMapping::toEquirectangular(ray, inWidth, inHeight);
+                const Vec2f& x = map[j * splitResolution + i];
                 imaOut(j, i) = sampler(imageSource, x(1), x(0));
             }
         }
@@ -262,9 +338,6 @@ bool splitEquirectangular(sfmData::SfMData& outSfmData,
               /* metadata */ image::getMapFromMetadata(outMetadataSpec.extra_attribs));
             views.emplace(viewId, view);
         }
-
-        // Increment index
-        ++index;
     }
     ALICEVISION_LOG_INFO(imagePath + " successfully split");
     return true;
@@ -518,6 +591,9 @@ int aliceVision_main(int argc, char** argv)
     // - all views have the same intrinsic
     sfmData::SfMData outSfmData;
 
+    // Remap LUTs shared by all the frames of the sequence
+    EquirectangularLUTCache equirectangularLutCache(equirectangularNbSplits, equirectangularSplitResolution, fov);
+
 // Split images to create views
 #pragma omp parallel for num_threads(nbThreads)
     for (int i = 0; i < imagePaths.size(); ++i)
@@ -533,8 +609,8 @@ int aliceVision_main(int argc, char** argv)
             }
             else
             {
-                hasCorrectPath =
-                  splitEquirectangular(outSfmData, imagePath, outputFolder, extension, equirectangularNbSplits, equirectangularSplitResolution, fov);
+                hasCorrectPath = splitEquirectangular(
+                  outSfmData, imagePath, outputFolder, extension, equirectangularLutCache, equirectangularNbSplits, equirectangularSplitResolution, fov);
             }
         }
         else if (splitMode == "dualfisheye")
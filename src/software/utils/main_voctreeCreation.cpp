@@ -52,6 +52,7 @@ int aliceVision_main(int argc, char** argv)
     std::uint32_t K = 10;
     std::uint32_t restart = 5;
     std::uint32_t LEVELS = 6;
+    std::uint32_t minibatchSize = 0;
     bool sanityCheck = true;
 
     // clang-format off
@@ -74,6 +75,9 @@ int aliceVision_main(int argc, char** argv)
          "Number of times that the kmean is launched for each cluster, the best solution is kept.")
         (",L", po::value<uint32_t>(&LEVELS)->default_value(6),
          "Number of levels of the tree.")
+        ("minibatchSize", po::value<uint32_t>(&minibatchSize)->default_value(minibatchSize),
+         "Use mini-batch kmeans with the given batch size on large clusters, much faster on big descriptor sets "
+         "at the cost of a slightly less accurate tree (0: always use full kmeans iterations).")
         ("sanitycheck,s", po::value<bool>(&sanityCheck)->default_value(sanityCheck),
          "Perform a sanity check at the end of the creation of the vocabulary tree. "
          "The sanity check is a query to the database with the same documents/images useed to train the vocabulary tree.");
@@ -122,6 +126,7 @@ int aliceVision_main(int argc, char** argv)
     aliceVision::voctree::TreeBuilder<DescriptorFloat> builder(DescriptorFloat(0));
     builder.setVerbose(tbVerbosity);
     builder.kmeans().setRestarts(restart);
+    builder.kmeans().setMiniBatchSize(minibatchSize);
     ALICEVISION_COUT("Building a tree of L=" << LEVELS << " levels with a branching factor of k=" << K);
     detect_start = std::chrono::steady_clock::now();
     builder.build(descriptors, K, LEVELS);
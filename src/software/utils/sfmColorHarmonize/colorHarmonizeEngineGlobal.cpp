@@ -31,6 +31,7 @@
 
 #include <dependencies/vectorGraphics/svgDrawer.hpp>
 
+#include <atomic>
 #include <numeric>
 #include <iomanip>
 #include <iterator>
@@ -198,122 +199,146 @@ bool ColorHarmonizationEngineGlobal::Process()
     map_relativeHistograms[1].resize(_pairwiseMatches.size());
     map_relativeHistograms[2].resize(_pairwiseMatches.size());
 
-    for (size_t i = 0; i < _pairwiseMatches.size(); ++i)
+    // Collect the edges up front, so that the histograms can be computed concurrently
+    std::vector<matching::PairwiseMatches::const_iterator> edgeIterators;
+    edgeIterators.reserve(_pairwiseMatches.size());
+    for (matching::PairwiseMatches::const_iterator iter = _pairwiseMatches.begin(); iter != _pairwiseMatches.end(); ++iter)
+        edgeIterators.push_back(iter);
+
+    std::atomic<bool> hasFailed{false};
+
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t i = 0; i < static_cast<int64_t>(edgeIterators.size()); ++i)
     {
-        matching::PairwiseMatches::const_iterator iter = _pairwiseMatches.begin();
-        std::advance(iter, i);
+        if (hasFailed)
+            continue;
 
-        const size_t viewI = iter->first.first;
-        const size_t viewJ = iter->first.second;
+        try
+        {
+            const matching::PairwiseMatches::const_iterator iter = edgeIterators[i];
 
-        //
-        const MatchesPerDescType& matchesPerDesc = iter->second;
+            const size_t viewI = iter->first.first;
+            const size_t viewJ = iter->first.second;
 
-        //-- Edges names:
-        std::pair<std::string, std::string> p_imaNames;
-        p_imaNames = make_pair(_fileNames[viewI], _fileNames[viewJ]);
-        std::cout << "Current edge : " << fs::path(p_imaNames.first).filename().string() << "\t" << fs::path(p_imaNames.second).filename().string()
-                  << std::endl;
+            //
+            const MatchesPerDescType& matchesPerDesc = iter->second;
 
-        //-- Compute the masks from the data selection:
-        Image<unsigned char> maskI(_imageSize[viewI].first, _imageSize[viewI].second);
-        Image<unsigned char> maskJ(_imageSize[viewJ].first, _imageSize[viewJ].second);
+            //-- Edges names:
+            std::pair<std::string, std::string> p_imaNames;
+            p_imaNames = make_pair(_fileNames[viewI], _fileNames[viewJ]);
+#pragma omp critical
+            std::cout << "Current edge : " << fs::path(p_imaNames.first).filename().string() << "\t" << fs::path(p_imaNames.second).filename().string()
+                      << std::endl;
 
-        switch (_selectionMethod)
-        {
-            case EHistogramSelectionMethod::eHistogramHarmonizeFullFrame:
-            {
-                colorHarmonization::CommonDataByPair_fullFrame dataSelector(p_imaNames.first, p_imaNames.second);
-                dataSelector.computeMask(maskI, maskJ);
-            }
-            break;
-            case EHistogramSelectionMethod::eHistogramHarmonizeMatchedPoints:
-            {
-                int circleSize = 10;
-                colorHarmonization::CommonDataByPair_matchedPoints dataSelector(p_imaNames.first,
-                                                                                p_imaNames.second,
-                                                                                matchesPerDesc,
-                                                                                _regionsPerView.getRegionsPerDesc(viewI),
-                                                                                _regionsPerView.getRegionsPerDesc(viewJ),
-                                                                                circleSize);
-                dataSelector.computeMask(maskI, maskJ);
-            }
-            break;
-            case EHistogramSelectionMethod::eHistogramHarmonizeVLDSegment:
-            {
-                maskI.fill(0);
-                maskJ.fill(0);
+            //-- Compute the masks from the data selection:
+            Image<unsigned char> maskI(_imageSize[viewI].first, _imageSize[viewI].second);
+            Image<unsigned char> maskJ(_imageSize[viewJ].first, _imageSize[viewJ].second);
 
-                for (const auto& matchesIt : matchesPerDesc)
+            switch (_selectionMethod)
+            {
+                case EHistogramSelectionMethod::eHistogramHarmonizeFullFrame:
                 {
-                    const feature::EImageDescriberType descType = matchesIt.first;
-                    const IndMatches& matches = matchesIt.second;
-                    colorHarmonization::CommonDataByPair_vldSegment dataSelector(p_imaNames.first,
-                                                                                 p_imaNames.second,
-                                                                                 matches,
-                                                                                 _regionsPerView.getRegions(viewI, descType).Features(),
-                                                                                 _regionsPerView.getRegions(viewJ, descType).Features());
-
+                    colorHarmonization::CommonDataByPair_fullFrame dataSelector(p_imaNames.first, p_imaNames.second);
+                    dataSelector.computeMask(maskI, maskJ);
+                }
+                break;
+                case EHistogramSelectionMethod::eHistogramHarmonizeMatchedPoints:
+                {
+                    int circleSize = 10;
+                    colorHarmonization::CommonDataByPair_matchedPoints dataSelector(p_imaNames.first,
+                                                                                    p_imaNames.second,
+                                                                                    matchesPerDesc,
+                                                                                    _regionsPerView.getRegionsPerDesc(viewI),
+                                                                                    _regionsPerView.getRegionsPerDesc(viewJ),
+                                                                                    circleSize);
                     dataSelector.computeMask(maskI, maskJ);
                 }
+                break;
+                case EHistogramSelectionMethod::eHistogramHarmonizeVLDSegment:
+                {
+                    maskI.fill(0);
+                    maskJ.fill(0);
+
+                    for (const auto& matchesIt : matchesPerDesc)
+                    {
+                        const feature::EImageDescriberType descType = matchesIt.first;
+                        const IndMatches& matches = matchesIt.second;
+                        colorHarmonization::CommonDataByPair_vldSegment dataSelector(p_imaNames.first,
+                                                                                     p_imaNames.second,
+                                                                                     matches,
+                                                                                     _regionsPerView.getRegions(viewI, descType).Features(),
+                                                                                     _regionsPerView.getRegions(viewJ, descType).Features());
+
+                        dataSelector.computeMask(maskI, maskJ);
+                    }
+                }
+                break;
+                default:
+                    throw std::invalid_argument("Selection method unsupported");
             }
-            break;
-            default:
-                std::cout << "Selection method unsupported" << std::endl;
-                return false;
-        }
 
-        //-- Export the masks
-        bool bExportMask = false;
-        if (bExportMask)
-        {
-            std::string sEdge = _fileNames[viewI] + "_" + _fileNames[viewJ];
-            sEdge = (fs::path(_outputDirectory) / sEdge).string();
+            //-- Export the masks
+            bool bExportMask = false;
+            if (bExportMask)
+            {
+                std::string sEdge = _fileNames[viewI] + "_" + _fileNames[viewJ];
+                sEdge = (fs::path(_outputDirectory) / sEdge).string();
 
-            if (!fs::exists(sEdge))
-                fs::create_directory(sEdge);
+                if (!fs::exists(sEdge))
+                    fs::create_directory(sEdge);
 
-            std::string out_filename_I = "00_mask_I.png";
-            out_filename_I = (fs::path(sEdge) / out_filename_I).string();
+                std::string out_filename_I = "00_mask_I.png";
+                out_filename_I = (fs::path(sEdge) / out_filename_I).string();
 
-            std::string out_filename_J = "00_mask_J.png";
-            out_filename_J = (fs::path(sEdge) / out_filename_J).string();
-            writeImage(out_filename_I, maskI, image::ImageWriteOptions());
-            writeImage(out_filename_J, maskJ, image::ImageWriteOptions());
-        }
+                std::string out_filename_J = "00_mask_J.png";
+                out_filename_J = (fs::path(sEdge) / out_filename_J).string();
+                writeImage(out_filename_I, maskI, image::ImageWriteOptions());
+                writeImage(out_filename_J, maskJ, image::ImageWriteOptions());
+            }
 
-        //-- Compute the histograms
-        Image<RGBColor> imageI, imageJ;
-        readImage(p_imaNames.first, imageI, image::EImageColorSpace::LINEAR);
-        readImage(p_imaNames.second, imageJ, image::EImageColorSpace::LINEAR);
-
-        utils::Histogram<double> histoI(minvalue, maxvalue, bin);
-        utils::Histogram<double> histoJ(minvalue, maxvalue, bin);
-
-        int channelIndex = 0;  // RED channel
-        colorHarmonization::CommonDataByPair::computeHisto(histoI, maskI, channelIndex, imageI);
-        colorHarmonization::CommonDataByPair::computeHisto(histoJ, maskJ, channelIndex, imageJ);
-        relativeColorHistogramEdge& edgeR = map_relativeHistograms[channelIndex][i];
-        edgeR =
-          relativeColorHistogramEdge(map_cameraNodeToCameraIndex[viewI], map_cameraNodeToCameraIndex[viewJ], histoI.GetHist(), histoJ.GetHist());
-
-        histoI = histoJ = utils::Histogram<double>(minvalue, maxvalue, bin);
-        channelIndex = 1;  // GREEN channel
-        colorHarmonization::CommonDataByPair::computeHisto(histoI, maskI, channelIndex, imageI);
-        colorHarmonization::CommonDataByPair::computeHisto(histoJ, maskJ, channelIndex, imageJ);
-        relativeColorHistogramEdge& edgeG = map_relativeHistograms[channelIndex][i];
-        edgeG =
-          relativeColorHistogramEdge(map_cameraNodeToCameraIndex[viewI], map_cameraNodeToCameraIndex[viewJ], histoI.GetHist(), histoJ.GetHist());
-
-        histoI = histoJ = utils::Histogram<double>(minvalue, maxvalue, bin);
-        channelIndex = 2;  // BLUE channel
-        colorHarmonization::CommonDataByPair::computeHisto(histoI, maskI, channelIndex, imageI);
-        colorHarmonization::CommonDataByPair::computeHisto(histoJ, maskJ, channelIndex, imageJ);
-        relativeColorHistogramEdge& edgeB = map_relativeHistograms[channelIndex][i];
-        edgeB =
-          relativeColorHistogramEdge(map_cameraNodeToCameraIndex[viewI], map_cameraNodeToCameraIndex[viewJ], histoI.GetHist(), histoJ.GetHist());
+            //-- Compute the histograms
+            Image<RGBColor> imageI, imageJ;
+            readImage(p_imaNames.first, imageI, image::EImageColorSpace::LINEAR);
+            readImage(p_imaNames.second, imageJ, image::EImageColorSpace::LINEAR);
+
+            utils::Histogram<double> histoI(minvalue, maxvalue, bin);
+            utils::Histogram<double> histoJ(minvalue, maxvalue, bin);
+
+            int channelIndex = 0;  // RED channel
+            colorHarmonization::CommonDataByPair::computeHisto(histoI, maskI, channelIndex, imageI);
+            colorHarmonization::CommonDataByPair::computeHisto(histoJ, maskJ, channelIndex, imageJ);
+            relativeColorHistogramEdge& edgeR = map_relativeHistograms[channelIndex][i];
+            edgeR =
+              relativeColorHistogramEdge(map_cameraNodeToCameraIndex.at(viewI), map_cameraNodeToCameraIndex.at(viewJ), histoI.GetHist(), histoJ.GetHist());
+
+            histoI = histoJ = utils::Histogram<double>(minvalue, maxvalue, bin);
+            channelIndex = 1;  // GREEN channel
+            colorHarmonization::CommonDataByPair::computeHisto(histoI, maskI, channelIndex, imageI);
+            colorHarmonization::CommonDataByPair::computeHisto(histoJ, maskJ, channelIndex, imageJ);
+            relativeColorHistogramEdge& edgeG = map_relativeHistograms[channelIndex][i];
+            edgeG =
+              relativeColorHistogramEdge(map_cameraNodeToCameraIndex.at(viewI), map_cameraNodeToCameraIndex.at(viewJ), histoI.GetHist(), histoJ.GetHist());
+
+            histoI = histoJ = utils::Histogram<double>(minvalue, maxvalue, bin);
+            channelIndex = 2;  // BLUE channel
+            colorHarmonization::CommonDataByPair::computeHisto(histoI, maskI, channelIndex, imageI);
+            colorHarmonization::CommonDataByPair::computeHisto(histoJ, maskJ, channelIndex, imageJ);
+            relativeColorHistogramEdge& edgeB = map_relativeHistograms[channelIndex][i];
+            edgeB =
+              relativeColorHistogramEdge(map_cameraNodeToCameraIndex.at(viewI), map_cameraNodeToCameraIndex.at(viewJ), histoI.GetHist(), histoJ.GetHist());
+        }
+        catch (const std::exception& e)
+        {
+            // exceptions cannot cross the parallel region: log and report the failure
+#pragma omp critical
+            std::cerr << "Failed to compute the histograms of an edge: " << e.what() << std::endl;
+            hasFailed = true;
+        }
     }
 
+    if (hasFailed)
+        return false;
+
     std::cout << "\n -- \n SOLVE for color consistency with linear programming\n --" << std::endl;
     //-- Solve for the gains and offsets:
     std::vector<size_t> vec_indexToFix;
@@ -332,38 +357,22 @@ bool ColorHarmonizationEngineGlobal::Process()
 #else
     typedef OSI_CISolverWrapper SOLVER_LP_T;
 #endif
-    // Red channel
-    {
-        SOLVER_LP_T lpSolver(vec_solution_r.size());
-
-        GainOffsetConstraintBuilder cstBuilder(map_relativeHistograms[0], vec_indexToFix);
-        LPConstraintsSparse constraint;
-        cstBuilder.Build(constraint);
-        lpSolver.setup(constraint);
-        lpSolver.solve();
-        lpSolver.getSolution(vec_solution_r);
-    }
-    // Green channel
-    {
-        SOLVER_LP_T lpSolver(vec_solution_g.size());
+    // The R, G and B gain-offset problems are independent: solve them concurrently,
+    // each on its own solver instance
+    std::vector<double>* channelSolutions[3] = {&vec_solution_r, &vec_solution_g, &vec_solution_b};
 
-        GainOffsetConstraintBuilder cstBuilder(map_relativeHistograms[1], vec_indexToFix);
-        LPConstraintsSparse constraint;
-        cstBuilder.Build(constraint);
-        lpSolver.setup(constraint);
-        lpSolver.solve();
-        lpSolver.getSolution(vec_solution_g);
-    }
-    // Blue channel
+#pragma omp parallel for
+    for (int channel = 0; channel < 3; ++channel)
     {
-        SOLVER_LP_T lpSolver(vec_solution_b.size());
+        std::vector<double>& solution = *channelSolutions[channel];
+        SOLVER_LP_T lpSolver(solution.size());
 
-        GainOffsetConstraintBuilder cstBuilder(map_relativeHistograms[2], vec_indexToFix);
+        GainOffsetConstraintBuilder cstBuilder(map_relativeHistograms[channel], vec_indexToFix);
         LPConstraintsSparse constraint;
         cstBuilder.Build(constraint);
         lpSolver.setup(constraint);
         lpSolver.solve();
-        lpSolver.getSolution(vec_solution_b);
+        lpSolver.getSolution(solution);
     }
 
     std::cout << std::endl
@@ -492,69 +501,35 @@ bool ColorHarmonizationEngineGlobal::CleanGraph()
     // Create a graph from pairwise correspondences:
     // - keep the largest connected component.
 
-    graph::indexedGraph putativeGraph(getImagePairs(_pairwiseMatches));
+    const graph::ViewGraph putativeGraph(getImagePairs(_pairwiseMatches));
 
-    // Save the graph before cleaning:
-    graph::exportToGraphvizData((fs::path(_outputDirectory) / "initialGraph").string(), putativeGraph.g);
-
-    const int connectedComponentCount = lemon::countConnectedComponents(putativeGraph.g);
+    std::vector<std::size_t> componentPerNode;
+    const std::size_t connectedComponentCount = putativeGraph.connectedComponents(componentPerNode);
     std::cout << "\n"
               << "ColorHarmonizationEngineGlobal::CleanGraph() :: => connected Component cardinal: " << connectedComponentCount << std::endl;
 
     if (connectedComponentCount > 1)  // If more than one CC, keep the largest
     {
-        // Search the largest CC index
-        const std::map<IndexT, std::set<lemon::ListGraph::Node>> map_subgraphs =
-          aliceVision::graph::exportGraphToMapSubgraphs<lemon::ListGraph, IndexT>(putativeGraph.g);
-        size_t count = std::numeric_limits<size_t>::min();
-        std::map<IndexT, std::set<lemon::ListGraph::Node>>::const_iterator iterLargestCC = map_subgraphs.end();
-        for (std::map<IndexT, std::set<lemon::ListGraph::Node>>::const_iterator iter = map_subgraphs.begin(); iter != map_subgraphs.end(); ++iter)
-        {
-            if (iter->second.size() > count)
-            {
-                count = iter->second.size();
-                iterLargestCC = iter;
-            }
-            std::cout << "Connected component of size : " << iter->second.size() << std::endl;
-        }
+        const std::set<IndexT> largestCC = putativeGraph.largestConnectedComponent();
+        std::cout << "Largest connected component of size : " << largestCC.size() << std::endl;
 
-        //-- Remove all nodes that are not listed in the largest CC
-        for (std::map<IndexT, std::set<lemon::ListGraph::Node>>::const_iterator iter = map_subgraphs.begin(); iter != map_subgraphs.end(); ++iter)
+        //-- Remove all matches from nodes that are not listed in the largest CC
+        for (matching::PairwiseMatches::iterator iterM = _pairwiseMatches.begin(); iterM != _pairwiseMatches.end();)
         {
-            if (iter == iterLargestCC)  // Skip this CC since it's the one we want to keep
-                continue;
-
-            const std::set<lemon::ListGraph::Node>& ccSet = iter->second;
-            for (std::set<lemon::ListGraph::Node>::const_iterator iter2 = ccSet.begin(); iter2 != ccSet.end(); ++iter2)
-            {
-                // Remove all outgoing edges
-                for (lemon::ListGraph::OutArcIt e(putativeGraph.g, *iter2); e != INVALID; ++e)
-                {
-                    putativeGraph.g.erase(e);
-                    const IndexT Idu = (*putativeGraph.map_nodeMapIndex)[putativeGraph.g.target(e)];
-                    const IndexT Idv = (*putativeGraph.map_nodeMapIndex)[putativeGraph.g.source(e)];
-                    matching::PairwiseMatches::iterator iterM = _pairwiseMatches.find(std::make_pair(Idu, Idv));
-                    if (iterM != _pairwiseMatches.end())
-                    {
-                        _pairwiseMatches.erase(iterM);
-                    }
-                    else  // Try to find the opposite directed edge
-                    {
-                        iterM = _pairwiseMatches.find(std::make_pair(Idv, Idu));
-                        if (iterM != _pairwiseMatches.end())
-                            _pairwiseMatches.erase(iterM);
-                    }
-                }
-            }
+            if (largestCC.count(iterM->first.first) && largestCC.count(iterM->first.second))
+                ++iterM;
+            else
+                iterM = _pairwiseMatches.erase(iterM);
         }
     }
 
-    // Save the graph after cleaning:
-    graph::exportToGraphvizData((fs::path(_outputDirectory) / "cleanedGraph").string(), putativeGraph.g);
+    // Save the graph after cleaning (the graphviz export works on the lemon structure):
+    const graph::indexedGraph cleanedGraph(getImagePairs(_pairwiseMatches));
+    graph::exportToGraphvizData((fs::path(_outputDirectory) / "cleanedGraph").string(), cleanedGraph.g);
 
     std::cout << "\n"
-              << "Cardinal of nodes: " << lemon::countNodes(putativeGraph.g) << "\n"
-              << "Cardinal of edges: " << lemon::countEdges(putativeGraph.g) << std::endl
+              << "Cardinal of nodes: " << lemon::countNodes(cleanedGraph.g) << "\n"
+              << "Cardinal of edges: " << lemon::countEdges(cleanedGraph.g) << std::endl
               << std::endl;
 
     return true;